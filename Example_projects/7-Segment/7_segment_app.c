@@ -1,63 +1,73 @@
 #include "7_segment_app.h"
 
+/* Timer driven : the digits are multiplexed from the Timer2 ISR ,
+ * needs TIMER2_INTERRUPT_FEATURE_ENABLE in mcal_interrupt_gen_cfg.h
+ */
 
-static uint8 counter = 0;
-
-static segment_t seg_com_Cathode  = {
-    .segment_pins[SEGMENT_PIN0].port = PORTC_INDEX,
-    .segment_pins[SEGMENT_PIN0].pin  = PIN0,
-    .segment_pins[SEGMENT_PIN0].direction = GPIO_DIRECTION_OUTPUT,
-    
-    .segment_pins[SEGMENT_PIN1].port = PORTC_INDEX,
-    .segment_pins[SEGMENT_PIN1].pin  = PIN1,
-    .segment_pins[SEGMENT_PIN1].direction = GPIO_DIRECTION_OUTPUT,
-    
-    .segment_pins[SEGMENT_PIN2].port = PORTC_INDEX,
-    .segment_pins[SEGMENT_PIN2].pin  = PIN2,
-    .segment_pins[SEGMENT_PIN2].direction = GPIO_DIRECTION_OUTPUT,
-    
-    .segment_pins[SEGMENT_PIN3].port = PORTC_INDEX,
-    .segment_pins[SEGMENT_PIN3].pin  = PIN3,
-    .segment_pins[SEGMENT_PIN3].direction = GPIO_DIRECTION_OUTPUT,
-    
-    .segment_type = SEGMENT_COMMON_CATHODE
-};
+#if TIMER2_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+
+static uint16 counter = 0;
+static volatile uint16 tick_count = 0;
+static volatile uint8 count_due = FALSE;
+
+/* BCD bus RC0..RC3 to a 4511 decoder , digit commons RD0..RD3 through NPN drivers */
+static seven_segment_mux_t display = {
+    .segment.segment_pins[SEGMENT_PIN0].port = PORTC_INDEX,
+    .segment.segment_pins[SEGMENT_PIN0].pin  = PIN0,
+    .segment.segment_pins[SEGMENT_PIN0].direction = GPIO_DIRECTION_OUTPUT,
+
+    .segment.segment_pins[SEGMENT_PIN1].port = PORTC_INDEX,
+    .segment.segment_pins[SEGMENT_PIN1].pin  = PIN1,
+    .segment.segment_pins[SEGMENT_PIN1].direction = GPIO_DIRECTION_OUTPUT,
+
+    .segment.segment_pins[SEGMENT_PIN2].port = PORTC_INDEX,
+    .segment.segment_pins[SEGMENT_PIN2].pin  = PIN2,
+    .segment.segment_pins[SEGMENT_PIN2].direction = GPIO_DIRECTION_OUTPUT,
+
+    .segment.segment_pins[SEGMENT_PIN3].port = PORTC_INDEX,
+    .segment.segment_pins[SEGMENT_PIN3].pin  = PIN3,
+    .segment.segment_pins[SEGMENT_PIN3].direction = GPIO_DIRECTION_OUTPUT,
 
-static segment_t seg_com_Anode  = {
-    .segment_pins[SEGMENT_PIN0].port = PORTD_INDEX,
-    .segment_pins[SEGMENT_PIN0].pin  = PIN0,
-    .segment_pins[SEGMENT_PIN0].direction = GPIO_DIRECTION_OUTPUT,
-    
-    .segment_pins[SEGMENT_PIN1].port = PORTD_INDEX,
-    .segment_pins[SEGMENT_PIN1].pin  = PIN1,
-    .segment_pins[SEGMENT_PIN1].direction = GPIO_DIRECTION_OUTPUT,
-    
-    .segment_pins[SEGMENT_PIN2].port = PORTD_INDEX,
-    .segment_pins[SEGMENT_PIN2].pin  = PIN2,
-    .segment_pins[SEGMENT_PIN2].direction = GPIO_DIRECTION_OUTPUT,
-    
-    .segment_pins[SEGMENT_PIN3].port = PORTD_INDEX,
-    .segment_pins[SEGMENT_PIN3].pin  = PIN3,
-    .segment_pins[SEGMENT_PIN3].direction = GPIO_DIRECTION_OUTPUT,
-    
-    .segment_type = SEGMENT_COMMON_ANODE
+    .segment.segment_type = SEGMENT_COMMON_CATHODE,
+
+    .digit_pins[0].port = PORTD_INDEX, .digit_pins[0].pin = PIN0,
+    .digit_pins[1].port = PORTD_INDEX, .digit_pins[1].pin = PIN1,
+    .digit_pins[2].port = PORTD_INDEX, .digit_pins[2].pin = PIN2,
+    .digit_pins[3].port = PORTD_INDEX, .digit_pins[3].pin = PIN3,
+    .digit_count = SEVEN_SEGMENT_APP_DIGITS,
+    .digit_active_level = GPIO_PIN_HIGH
 };
 
+static void Seven_Segment_Tick(void){
+    seven_segment_mux_refresh(&display);
+    tick_count++;
+    if(SEVEN_SEGMENT_APP_COUNT_TICKS <= tick_count){
+        tick_count = 0;
+        count_due = TRUE;
+    }
+}
+
 void Seven_Segment_app(void){
-    
-    seven_segment_initialize(&seg_com_Cathode);
-    seven_segment_initialize(&seg_com_Anode);
-    
+    /* 8 MHz , prescaler 1 , PR2 = 255 , postscaler 2 : 256 us tick , 4.1 ms frame */
+    timer2_t tick_timer = {
+        .prescaler_division = timer2_prescaler_div_1 ,
+        .postscaler_division = timer2_postscaler_div_2 ,
+        .TMR_InterruptHandler = Seven_Segment_Tick ,
+        .preloaded_value = 0
+    };
+
+    seven_segment_mux_initialize(&display);
+    seven_segment_mux_write_number(&display , counter);
+    timer2_init(&tick_timer);
+
     while(1){
-        if( MAX_DIGIT < counter){
-            counter = 0;
+        /* Main loop only updates the digit buffer , the ISR refreshes the display */
+        if(TRUE == count_due){
+            count_due = FALSE;
+            counter = (MAX_NUMBER <= counter) ? 0 : (counter + 1);
+            seven_segment_mux_write_number(&display , counter);
         }
-        seven_segment_write_number(&seg_com_Cathode ,counter );
-        seven_segment_write_number(&seg_com_Anode , MAX_DIGIT - counter );
-        counter++;
-        __delay_ms(500);
-        
     }
-    
-    
-}
\ No newline at end of file
+}
+
+#endif
@@ -1,12 +1,20 @@
 #ifndef SEGMENT_H
 #define	SEGMENT_H
 
-#include"../ecual/7_Segment/ecu_7Seg.h"
+#include"../../ecual/7_Segment/ecu_7Seg_mux.h"
+#include"../../mcal/Timer2/Timer2.h"
 
-#define MAX_DIGIT 9
+#define MAX_NUMBER 9999
 
+/* Digits of the multiplexed display */
+#define SEVEN_SEGMENT_APP_DIGITS            4
+
+/* 256 us ticks between two counter steps : ~500 ms */
+#define SEVEN_SEGMENT_APP_COUNT_TICKS       1953
+
+#if TIMER2_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
 void Seven_Segment_app(void);
+#endif
 
 
 #endif	/* 7_SEGMENT_H */
-
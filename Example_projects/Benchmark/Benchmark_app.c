@@ -0,0 +1,250 @@
+#include "Benchmark_app.h"
+
+#if TIMER1_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+
+/********************** Data Types Declaration **********************/
+
+typedef struct{
+    const uint8 *name ;
+    void (* run)(void);
+}benchmark_case_t;
+
+typedef struct{
+    uint32 min ;
+    uint32 max ;
+    uint32 sum ;
+    Std_ReturnType status ;     /* Return of the last run , a NACK shows up here */
+}benchmark_result_t;
+
+/********************** Function Declaration **********************/
+
+static uint32 Benchmark_Cycles(void);
+static void Benchmark_Measure(const benchmark_case_t *bench_case , uint32 overhead , benchmark_result_t *result);
+static void Benchmark_Print_Cycles(uint32 cycles);
+static void Benchmark_Print_Row(const benchmark_case_t *bench_case , const benchmark_result_t *result);
+static void Bench_Empty(void);
+static void Bench_Gpio_Write(void);
+static void Bench_Lcd_String(void);
+static void Bench_I2C_Read_Register(void);
+static void Bench_Uart_String(void);
+static void Bench_Adc_Blocking(void);
+#if (CCP_CFG_PWM_MODE_SELECTED == CCP1_CFG_SELECTED_MODE) || (CCP_CFG_PWM_MODE_SELECTED == CCP2_CFG_SELECTED_MODE)
+static void Bench_Pwm_Duty(void);
+#endif
+
+/********************** Variable Definition **********************/
+
+/* Free running , Fosc / 4 , no prescaler : one count per instruction cycle */
+static timer1_t bench_timer = {
+    .timer1_preload_value = 0 ,
+    .TMR_InterruptHandler = NULL ,
+    .prescaler_division = timer1_prescaler_dive_1 ,
+    .timer1_mode = TIMER1_TIMER_MODE_CFG ,
+    .timer1_osc_cfg = TIMER1_OSC_DISABLE ,
+    .timer1_reg_rw_mode = TIMER1_RD_16BIT_MODE_CFG ,
+};
+
+static usart_t uart_obj = {
+    .baudrate = 9600,
+    .baudrate_cfg = BAUDRATE_ASYNC_8BIT_LOW_SPEED,
+
+    .usart_tx_cfg.usart_tx_enable = EUSART_ASYNCHRONOUS_TX_ENABLE,
+    .usart_tx_cfg.usart_tx_9bit_enable = EUSART_ASYNCHRONOUS_9BIT_TX_DISABLE,
+    .usart_tx_cfg.usart_tx_interrupt_enable = EUSART_ASYNCHRONOUS_INTERRUPT_TX_DISABLE,
+
+    .usart_rx_cfg.usart_rx_enable = EUSART_ASYNCHRONOUS_RX_DISABLE,
+    .usart_rx_cfg.usart_rx_9bit_enable = EUSART_ASYNCHRONOUS_9BIT_RX_DISABLE,
+    .usart_rx_cfg.usart_rx_interrupt_enable = EUSART_ASYNCHRONOUS_INTERRUPT_RX_DISABLE,
+};
+
+static mssp_i2c_t i2c_obj = {
+    .i2c_clock  = 100000,
+    .i2c_cfg.i2c_mode = MSSP_I2C_MASTER_MODE,
+    .i2c_cfg.i2c_mode_cfg = MSSP_I2C_MASTER_MODE_DEFINED_CLK,
+    .i2c_cfg.i2c_slew_rate = I2C_SLEW_RATE_DISABLE_100kHZ,
+    .i2c_cfg.i2c_SMBus_Control = I2C_SMBUS_DISABLE,
+};
+
+/* Same wiring as the Smart Home master LCD */
+static chr_lcd_4bit_t bench_lcd = {
+    .lcd_data[0].port = PORTB_INDEX , .lcd_data[0].pin = PIN4 , .lcd_data[0].direction = GPIO_DIRECTION_OUTPUT ,
+    .lcd_data[1].port = PORTB_INDEX , .lcd_data[1].pin = PIN5 , .lcd_data[1].direction = GPIO_DIRECTION_OUTPUT ,
+    .lcd_data[2].port = PORTB_INDEX , .lcd_data[2].pin = PIN6 , .lcd_data[2].direction = GPIO_DIRECTION_OUTPUT ,
+    .lcd_data[3].port = PORTB_INDEX , .lcd_data[3].pin = PIN7 , .lcd_data[3].direction = GPIO_DIRECTION_OUTPUT ,
+    .lcd_en.port = PORTA_INDEX , .lcd_en.pin = PIN2 , .lcd_en.direction = GPIO_DIRECTION_OUTPUT ,
+    .lcd_rs.port = PORTA_INDEX , .lcd_rs.pin = PIN3 , .lcd_rs.direction = GPIO_DIRECTION_OUTPUT ,
+};
+
+static adc_conf_t bench_adc = {
+    .acquisition_time = ADC_12_TAD ,
+    .conversion_clock = ADC_CONVERSION_CLOCK_FOSC_DIV_8 ,       /* Tad = 1 us at 8 MHz */
+    .adc_channel = ADC_CHANNEL_AN0 ,
+    .result_format = ADC_RESULT_RIGHT ,
+    .voltage_reference = ADC_VOLTAGE_REFERENCE_DISABLE ,
+};
+
+#if (CCP_CFG_PWM_MODE_SELECTED == CCP1_CFG_SELECTED_MODE) || (CCP_CFG_PWM_MODE_SELECTED == CCP2_CFG_SELECTED_MODE)
+static ccp_t bench_pwm = {
+#if CCP_CFG_PWM_MODE_SELECTED == CCP1_CFG_SELECTED_MODE
+    .ccp_inst = CCP1_INST,
+    .pin.pin = PIN2,
+#else
+    .ccp_inst = CCP2_INST,
+    .pin.pin = PIN1,
+#endif
+    .ccp_mode = CCP_PWM_MODE_SELECTED,
+    .ccp_mode_variant = CCP_PWM_MODE,
+    .PWM_Frequency = 5000,
+    .timer2_prescaler_division = 4,
+    .pin.port = PORTC_INDEX,
+    .pin.direction = GPIO_DIRECTION_OUTPUT,
+};
+static uint8 bench_duty = ZERO_INIT;
+#endif
+
+static pin_config_t bench_pin = {
+    .port = PORTD_INDEX , .pin = PIN0 , .direction = GPIO_DIRECTION_OUTPUT , .logic = GPIO_PIN_LOW
+};
+static Logic_t bench_logic = GPIO_PIN_LOW;
+
+/* Payloads : 16 chars , one LCD row / one typical UART line */
+static uint8 bench_string[] = "Benchmark 0..15 ";
+static uint8 bench_i2c_data = ZERO_INIT;
+static adc_result_t bench_adc_result = ZERO_INIT;
+
+/* Status of the case being measured , set by its run function */
+static Std_ReturnType bench_status = E_OK;
+
+static const benchmark_case_t bench_cases[] = {
+    { "gpio_pin_write_logic              " , Bench_Gpio_Write        },
+    { "lcd_4bit_send_string (16 chars)   " , Bench_Lcd_String        },
+    { "MSSP_I2C_Read_Registers (1 B)     " , Bench_I2C_Read_Register },
+    { "EUSART_ASYNC_Write_String (16 B)  " , Bench_Uart_String       },
+    { "ADC_GetConversion_Blocking        " , Bench_Adc_Blocking      },
+#if (CCP_CFG_PWM_MODE_SELECTED == CCP1_CFG_SELECTED_MODE) || (CCP_CFG_PWM_MODE_SELECTED == CCP2_CFG_SELECTED_MODE)
+    { "CCP_PWM_Set_Duty                  " , Bench_Pwm_Duty          },
+#endif
+};
+static const benchmark_case_t bench_empty = { "(empty case)" , Bench_Empty };
+
+static benchmark_result_t bench_result;
+static uint8 bench_field[BENCHMARK_CYCLES_WIDTH + 1];
+
+static uint8 bench_header[] = "\r\nCase                                   min     avg     max  status\r\n";
+static uint8 bench_footer[] = "1 cycle = 4 / Fosc , call overhead removed\r\n";
+
+/********************** Function Definition **********************/
+
+void Benchmark_app(void){
+    Std_ReturnType ret = E_NOT_OK;
+    uint32 l_overhead = ZERO_INIT;
+    uint8 l_index = ZERO_INIT;
+
+    ret = EUSART_ASYNC_Init(&uart_obj);
+    ret = MSSP_I2C_Init(&i2c_obj);
+    ret = lcd_4bit_initialize(&bench_lcd);
+    ret = ADC_Init(&bench_adc);
+#if (CCP_CFG_PWM_MODE_SELECTED == CCP1_CFG_SELECTED_MODE) || (CCP_CFG_PWM_MODE_SELECTED == CCP2_CFG_SELECTED_MODE)
+    ret = CCP_Init(&bench_pwm);
+#endif
+    ret = gpio_pin_initialize(&bench_pin);
+    ret = timer1_init(&bench_timer);
+    /* TMR1_ISR is the only enabled source : it extends the cycle count */
+    ret = Interrupt_Manager_Global_Enable();
+
+    /* Cost of the timestamps and of an empty case call , removed from every case */
+    Benchmark_Measure(&bench_empty , 0 , &bench_result);
+    l_overhead = bench_result.min;
+
+    ret = EUSART_ASYNC_Write_String_Blocking(bench_header , sizeof(bench_header) - 1);
+    for(l_index = ZERO_INIT ; l_index < (sizeof(bench_cases) / sizeof(bench_cases[0])) ; l_index++){
+        Benchmark_Measure(&bench_cases[l_index] , l_overhead , &bench_result);
+        Benchmark_Print_Row(&bench_cases[l_index] , &bench_result);
+    }
+    ret = EUSART_ASYNC_Write_String_Blocking(bench_footer , sizeof(bench_footer) - 1);
+
+    while(1){
+
+    }
+}
+
+/********************** Static Function Definition **********************/
+
+static uint32 Benchmark_Cycles(void){
+    uint32 l_overflows = ZERO_INIT;
+    uint16 l_count = ZERO_INIT;
+    (void)timer1_Read_Extended(&bench_timer , &l_overflows , &l_count);
+    return ((l_overflows << 16) | l_count);
+}
+
+static void Benchmark_Measure(const benchmark_case_t *bench_case , uint32 overhead , benchmark_result_t *result){
+    uint32 l_start = ZERO_INIT;
+    uint32 l_cycles = ZERO_INIT;
+    uint8 l_run = ZERO_INIT;
+
+    result->min = 0xFFFFFFFFUL;
+    result->max = ZERO_INIT;
+    result->sum = ZERO_INIT;
+    for(l_run = ZERO_INIT ; l_run < BENCHMARK_ITERATIONS ; l_run++){
+        l_start = Benchmark_Cycles();
+        bench_case->run();
+        l_cycles = Benchmark_Cycles() - l_start;
+        l_cycles = (l_cycles > overhead) ? (l_cycles - overhead) : 0;
+        result->min = (l_cycles < result->min) ? l_cycles : result->min;
+        result->max = (l_cycles > result->max) ? l_cycles : result->max;
+        result->sum += l_cycles;
+    }
+    result->status = bench_status;
+}
+
+static void Benchmark_Print_Cycles(uint32 cycles){
+    (void)convert_uint_to_string_fixed(cycles , BENCHMARK_CYCLES_WIDTH , ' ' , bench_field);
+    (void)EUSART_ASYNC_Write_String_Blocking(bench_field , BENCHMARK_CYCLES_WIDTH);
+}
+
+static void Benchmark_Print_Row(const benchmark_case_t *bench_case , const benchmark_result_t *result){
+    uint8 l_length = ZERO_INIT;
+    while('\0' != bench_case->name[l_length]){
+        l_length++;
+    }
+    (void)EUSART_ASYNC_Write_String_Blocking((uint8 *)bench_case->name , l_length);
+    Benchmark_Print_Cycles(result->min);
+    Benchmark_Print_Cycles(result->sum / BENCHMARK_ITERATIONS);
+    Benchmark_Print_Cycles(result->max);
+    (void)EUSART_ASYNC_Write_String_Blocking((E_OK == result->status) ? (uint8 *)"      ok\r\n" : (uint8 *)"  failed\r\n" , 10);
+}
+
+static void Bench_Empty(void){
+    bench_status = E_OK;
+}
+
+static void Bench_Gpio_Write(void){
+    bench_logic = (GPIO_PIN_LOW == bench_logic) ? GPIO_PIN_HIGH : GPIO_PIN_LOW;
+    bench_status = gpio_pin_write_logic(&bench_pin , bench_logic);
+}
+
+static void Bench_Lcd_String(void){
+    bench_status = lcd_4bit_send_string(&bench_lcd , bench_string);
+}
+
+static void Bench_I2C_Read_Register(void){
+    /* Read_Registers checks the slave ACK , an absent device makes the row read failed */
+    bench_status = MSSP_I2C_Read_Registers(BENCHMARK_I2C_ADDRESS , BENCHMARK_I2C_REGISTER , &bench_i2c_data , 1);
+}
+
+static void Bench_Uart_String(void){
+    bench_status = EUSART_ASYNC_Write_String_Blocking(bench_string , sizeof(bench_string) - 1);
+}
+
+static void Bench_Adc_Blocking(void){
+    bench_status = ADC_GetConversion_Blocking(&bench_adc , ADC_CHANNEL_AN0 , &bench_adc_result);
+}
+
+#if (CCP_CFG_PWM_MODE_SELECTED == CCP1_CFG_SELECTED_MODE) || (CCP_CFG_PWM_MODE_SELECTED == CCP2_CFG_SELECTED_MODE)
+static void Bench_Pwm_Duty(void){
+    bench_duty = (50 == bench_duty) ? 25 : 50;
+    bench_status = CCP_PWM_Set_Duty(&bench_pwm , bench_duty);
+}
+#endif
+
+#endif
@@ -0,0 +1,61 @@
+/*
+ * @file    Benchmark_app.h
+ * @brief   Instruction-cycle benchmark of the MCAL / ECUAL hot paths
+ *
+ * @details
+ * Timer1 runs free on Fosc/4 without prescaler , one count is one
+ * instruction cycle (0.5 us at 8 MHz). Its overflows are counted by
+ * TMR1_ISR , so timer1_Read_Extended() gives a 32-bit cycle stamp and
+ * slow calls (LCD strings , UART at 9600 baud) are measured too.
+ *
+ * Each case runs BENCHMARK_ITERATIONS times. Min / average / max cycles
+ * minus the cost of an empty case go out over EUSART as one table , the
+ * regression baseline of the performance changes.
+ *
+ * Layer: Application
+ * Target MCU: PIC18F4620
+ *
+ * Author: Abdelmoniem Ahmed
+ * Linkedin: https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * Date: 2026
+ */
+
+#ifndef BENCHMARK_APP_H
+#define	BENCHMARK_APP_H
+
+/* Section : Includes */
+#include"../../mcal/Timer1/timer1.h"
+#include"../../mcal/ADC/hal_adc.h"
+#include"../../mcal/CCP/CCP.h"
+#include"../../mcal/EUSART/hal_eusart.h"
+#include"../../mcal/I2C/I2C_APIs.h"
+#include"../../mcal/Interrupt/mcal_interrupt_manager.h"
+#include"../../ecual/Chr_LCD/ecu_Chr_lcd.h"
+
+/* Section : Macro Declaration */
+
+/* Runs per case , min / average / max taken over them */
+#define BENCHMARK_ITERATIONS            8
+
+/* I2C register read target (7-bit) : TC74A5 temperature register */
+#define BENCHMARK_I2C_ADDRESS           0x4D
+#define BENCHMARK_I2C_REGISTER          0x00
+
+/* Width of the cycle columns of the report */
+#define BENCHMARK_CYCLES_WIDTH          8
+
+/* Section : Function Declarations */
+
+#if TIMER1_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+/**
+ * @brief Run every benchmark case once and print the table over EUSART
+ *
+ * @note
+ * Needs TIMER1_INTERRUPT_FEATURE_ENABLE (overflow count). Other interrupt
+ * sources stay off , only TMR1_ISR (once per 65536 cycles) lands inside
+ * the measured windows.
+ */
+void Benchmark_app(void);
+#endif
+
+#endif	/* BENCHMARK_APP_H */
@@ -28,79 +28,20 @@ static chr_lcd_4bit_t Chr_Lcd_4Bit = {
     .lcd_rs.direction = GPIO_DIRECTION_OUTPUT ,
 };
 
-static uint8 custom_full_battery[] = {
-    0x0E,
-    0x0E,
-    0x1F,
-    0x1F,
-    0x1F,
-    0x1F,
-    0x1F,
-    0x00
-};
-static uint8 custom_eighty_percent_battery[] = {
-    0x0E,
-    0x0A,
-    0x11,
-    0x1F,
-    0x1F,
-    0x1F,
-    0x1F,
-    0x00
-};
-static uint8 custom_fifty_percent_battery[] = {
-    0x0E,
-    0x0A,
-    0x11,
-    0x11,
-    0x1F,
-    0x1F,
-    0x1F,
-    0x00
-};
-static uint8 custom_twenty_percent_battery[] = {
-    0x0E,
-    0x0A,
-    0x11,
-    0x11,
-    0x11,
-    0x1F,
-    0x1F,
-    0x00
-};
-static uint8 custom_empty_battery[] = {
-    0x0E,
-    0x0A,
-    0x11,
-    0x11,
-    0x11,
-    0x11,
-    0x1F,
-    0x00
-};
-static uint8 custom_bluetooth[] = {
-  0x04,
-  0x06,
-  0x15,
-  0x0E,
-  0x0E,
-  0x15,
-  0x06,
-  0x04
-};
-static uint8 custom_wifi[] = {
-  0x0E,
-  0x1B,
-  0x00,
-  0x0E,
-  0x0A,
-  0x00,
-  0x04,
-  0x00
+/* Custom characters , kept in flash and loaded in CGRAM once : glyph n is character code n */
+static const uint8 lcd_glyphs[GLYPH_COUNT * LCD_CGRAM_GLYPH_SIZE] = {
+    0x0E , 0x0E , 0x1F , 0x1F , 0x1F , 0x1F , 0x1F , 0x00 ,     /* GLYPH_BATTERY_FULL */
+    0x0E , 0x0A , 0x11 , 0x1F , 0x1F , 0x1F , 0x1F , 0x00 ,     /* GLYPH_BATTERY_80 */
+    0x0E , 0x0A , 0x11 , 0x11 , 0x1F , 0x1F , 0x1F , 0x00 ,     /* GLYPH_BATTERY_50 */
+    0x0E , 0x0A , 0x11 , 0x11 , 0x11 , 0x1F , 0x1F , 0x00 ,     /* GLYPH_BATTERY_20 */
+    0x0E , 0x0A , 0x11 , 0x11 , 0x11 , 0x11 , 0x1F , 0x00 ,     /* GLYPH_BATTERY_EMPTY */
+    0x0E , 0x1B , 0x00 , 0x0E , 0x0A , 0x00 , 0x04 , 0x00 ,     /* GLYPH_WIFI */
+    0x04 , 0x06 , 0x15 , 0x0E , 0x0E , 0x15 , 0x06 , 0x04       /* GLYPH_BLUETOOTH */
 };
 
 void Chr_LCD_app(void){
     lcd_4bit_initialize(&Chr_Lcd_4Bit);
+    lcd_4bit_load_cgram(&Chr_Lcd_4Bit , lcd_glyphs , GLYPH_COUNT);
     
     while(1){
         lcd_4bit_send_command(&Chr_Lcd_4Bit ,_LCD_CLEAR);
@@ -110,9 +51,9 @@ void Chr_LCD_app(void){
         lcd_4bit_send_string_pos(&Chr_Lcd_4Bit , ROW3 , 3 , "Embedded Engineer");
         __delay_ms(1000);
         
-        lcd_4bit_send_custom_char(&Chr_Lcd_4Bit ,ROW1 , 20 , custom_full_battery , 1 );
-        lcd_4bit_send_custom_char(&Chr_Lcd_4Bit ,ROW1 , 19 , custom_wifi , 6 );
-        lcd_4bit_send_custom_char(&Chr_Lcd_4Bit ,ROW1 , 18 , custom_bluetooth , 7 );
+        lcd_4bit_send_char_data_pos(&Chr_Lcd_4Bit ,ROW1 , 20 , GLYPH_BATTERY_FULL );
+        lcd_4bit_send_char_data_pos(&Chr_Lcd_4Bit ,ROW1 , 19 , GLYPH_WIFI );
+        lcd_4bit_send_char_data_pos(&Chr_Lcd_4Bit ,ROW1 , 18 , GLYPH_BLUETOOTH );
         __delay_ms(1000);
         
         lcd_4bit_send_command(&Chr_Lcd_4Bit ,_LCD_DISPLAY_SHIFT_LEFT);
@@ -138,52 +79,52 @@ void Chr_LCD_app(void){
         __delay_ms(1000);
         
         /* Discharge */
-        lcd_4bit_send_custom_char(&Chr_Lcd_4Bit ,ROW1 , 20 , custom_eighty_percent_battery , 2 );
+        lcd_4bit_send_char_data_pos(&Chr_Lcd_4Bit ,ROW1 , 20 , GLYPH_BATTERY_80 );
         __delay_ms(1000);
-        lcd_4bit_send_custom_char(&Chr_Lcd_4Bit ,ROW1 , 20 , custom_fifty_percent_battery , 3 );
+        lcd_4bit_send_char_data_pos(&Chr_Lcd_4Bit ,ROW1 , 20 , GLYPH_BATTERY_50 );
         __delay_ms(1000);
-        lcd_4bit_send_custom_char(&Chr_Lcd_4Bit ,ROW1 , 20 , custom_twenty_percent_battery , 4 );
+        lcd_4bit_send_char_data_pos(&Chr_Lcd_4Bit ,ROW1 , 20 , GLYPH_BATTERY_20 );
         __delay_ms(1000);
-        lcd_4bit_send_custom_char(&Chr_Lcd_4Bit ,ROW1 , 20 , custom_empty_battery , 5 );
+        lcd_4bit_send_char_data_pos(&Chr_Lcd_4Bit ,ROW1 , 20 , GLYPH_BATTERY_EMPTY );
         __delay_ms(1000);
         
         lcd_4bit_send_string_pos(&Chr_Lcd_4Bit , ROW2 , 3 , "Charging        ");
         __delay_ms(1000);
         
         /* Charging */
-        lcd_4bit_send_custom_char(&Chr_Lcd_4Bit ,ROW1 , 20 , custom_twenty_percent_battery , 4 );
+        lcd_4bit_send_char_data_pos(&Chr_Lcd_4Bit ,ROW1 , 20 , GLYPH_BATTERY_20 );
         __delay_ms(1000);
-        lcd_4bit_send_custom_char(&Chr_Lcd_4Bit ,ROW1 , 20 , custom_fifty_percent_battery , 3 );
+        lcd_4bit_send_char_data_pos(&Chr_Lcd_4Bit ,ROW1 , 20 , GLYPH_BATTERY_50 );
         __delay_ms(1000);
-        lcd_4bit_send_custom_char(&Chr_Lcd_4Bit ,ROW1 , 20 , custom_eighty_percent_battery , 2 );
+        lcd_4bit_send_char_data_pos(&Chr_Lcd_4Bit ,ROW1 , 20 , GLYPH_BATTERY_80 );
         __delay_ms(1000);
-        lcd_4bit_send_custom_char(&Chr_Lcd_4Bit ,ROW1 , 20 , custom_full_battery , 1 );        
+        lcd_4bit_send_char_data_pos(&Chr_Lcd_4Bit ,ROW1 , 20 , GLYPH_BATTERY_FULL );        
         __delay_ms(1000);
         
         lcd_4bit_send_string_pos(&Chr_Lcd_4Bit , ROW2 , 3 , "Discharge          ");
         __delay_ms(1000);
         
         /* Discharge */
-        lcd_4bit_send_custom_char(&Chr_Lcd_4Bit ,ROW1 , 20 , custom_eighty_percent_battery , 2 );
+        lcd_4bit_send_char_data_pos(&Chr_Lcd_4Bit ,ROW1 , 20 , GLYPH_BATTERY_80 );
         __delay_ms(1000);
-        lcd_4bit_send_custom_char(&Chr_Lcd_4Bit ,ROW1 , 20 , custom_fifty_percent_battery , 3 );
+        lcd_4bit_send_char_data_pos(&Chr_Lcd_4Bit ,ROW1 , 20 , GLYPH_BATTERY_50 );
         __delay_ms(1000);
-        lcd_4bit_send_custom_char(&Chr_Lcd_4Bit ,ROW1 , 20 , custom_twenty_percent_battery , 4 );
+        lcd_4bit_send_char_data_pos(&Chr_Lcd_4Bit ,ROW1 , 20 , GLYPH_BATTERY_20 );
         __delay_ms(1000);
-        lcd_4bit_send_custom_char(&Chr_Lcd_4Bit ,ROW1 , 20 , custom_empty_battery , 5 );
+        lcd_4bit_send_char_data_pos(&Chr_Lcd_4Bit ,ROW1 , 20 , GLYPH_BATTERY_EMPTY );
         __delay_ms(1000);
         
         lcd_4bit_send_string_pos(&Chr_Lcd_4Bit , ROW2 , 3 , "Charging           ");
         __delay_ms(1000);
         
         /* Charging */
-        lcd_4bit_send_custom_char(&Chr_Lcd_4Bit ,ROW1 , 20 , custom_twenty_percent_battery , 4 );
+        lcd_4bit_send_char_data_pos(&Chr_Lcd_4Bit ,ROW1 , 20 , GLYPH_BATTERY_20 );
         __delay_ms(1000);
-        lcd_4bit_send_custom_char(&Chr_Lcd_4Bit ,ROW1 , 20 , custom_fifty_percent_battery , 3 );
+        lcd_4bit_send_char_data_pos(&Chr_Lcd_4Bit ,ROW1 , 20 , GLYPH_BATTERY_50 );
         __delay_ms(1000);
-        lcd_4bit_send_custom_char(&Chr_Lcd_4Bit ,ROW1 , 20 , custom_eighty_percent_battery , 2 );
+        lcd_4bit_send_char_data_pos(&Chr_Lcd_4Bit ,ROW1 , 20 , GLYPH_BATTERY_80 );
         __delay_ms(1000);
-        lcd_4bit_send_custom_char(&Chr_Lcd_4Bit ,ROW1 , 20 , custom_full_battery , 1 );        
+        lcd_4bit_send_char_data_pos(&Chr_Lcd_4Bit ,ROW1 , 20 , GLYPH_BATTERY_FULL );        
         __delay_ms(1000);
     }    
 }
@@ -6,6 +6,16 @@
 
 #define Chr_Lcd_MAX_LEN 20
 
+/* Character codes of lcd_glyphs[] */
+#define GLYPH_BATTERY_FULL      0
+#define GLYPH_BATTERY_80        1
+#define GLYPH_BATTERY_50        2
+#define GLYPH_BATTERY_20        3
+#define GLYPH_BATTERY_EMPTY     4
+#define GLYPH_WIFI              5
+#define GLYPH_BLUETOOTH         6
+#define GLYPH_COUNT             7
+
 void Chr_LCD_app(void);
 
 #endif	/* CHR_LCD_APP_H */
@@ -88,3 +88,48 @@ void Led_Blink_Hal_app(void){
     }
     
 }
+
+
+/* Timer driven : blink , dim and breathe without any delay loop ,
+ * needs TIMER2_INTERRUPT_FEATURE_ENABLE in mcal_interrupt_gen_cfg.h
+ */
+
+#if TIMER2_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+
+static output_pattern_t led_pattern;
+
+static void Led_Pattern_Tick(void){
+    Output_Pattern_Tick(&led_pattern);
+}
+
+void Led_Pattern_app(void){
+    /* 8 MHz , prescaler 1 , PR2 = 255 , postscaler 2 : 256 us tick , 4.1 ms frame */
+    timer2_t tick_timer = {
+        .prescaler_division = timer2_prescaler_div_1 ,
+        .postscaler_division = timer2_postscaler_div_2 ,
+        .TMR_InterruptHandler = Led_Pattern_Tick ,
+        .preloaded_value = 0
+    };
+    uint8 channel[8];
+    
+    Output_Pattern_Init(&led_pattern , PORTC_INDEX);
+    for(uint8 i = 0 ; i<8 ; i++){
+        Output_Pattern_Add_Led(&led_pattern , &(led[i]) , &(channel[i]));
+    }
+    
+    Output_Pattern_Blink(&led_pattern , channel[0] , 61 , 61);      /* 2 Hz */
+    Output_Pattern_Blink(&led_pattern , channel[1] , 12 , 232);     /* 50 ms flash every second */
+    for(uint8 i = 2 ; i<6 ; i++){
+        Output_Pattern_Dim(&led_pattern , channel[i] , (uint8)(i * 2)); /* 4 brightness levels */
+    }
+    Output_Pattern_Breathe(&led_pattern , channel[6] , 4);          /* ~0.5 s cycle */
+    Output_Pattern_Breathe(&led_pattern , channel[7] , 16);         /* ~2 s cycle */
+    
+    timer2_init(&tick_timer);
+    
+    while(1){
+        /* Main loop free : the patterns run from the Timer2 ISR */
+    }
+}
+
+#endif
@@ -4,11 +4,16 @@
 /* Includes */
 
 #include"../../ecual/LED/ecu_led.h"
+#include"../../ecual/Output_Pattern/ecu_output_pattern.h"
+#include"../../mcal/Timer2/Timer2.h"
 
 /* Function Declaration */
 
 void Led_Blink_app(void);
 void Led_Blink_Hal_app(void);
+#if TIMER2_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+void Led_Pattern_app(void);
+#endif
 
 #endif	/* LED_BLINK_APP_H */
 
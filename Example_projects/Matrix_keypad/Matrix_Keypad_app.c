@@ -87,6 +87,7 @@ void Matrix_Keypad_Led_App(void){
     timer1_init(&tmr_10ms);
 //    led_initialize(&led0);
 //    led_initialize(&led1);
+    Interrupt_Manager_Global_Enable();
     
     lcd_4bit_send_command(&Chr_Lcd_4Bit ,_LCD_CLEAR);
     lcd_4bit_send_command(&Chr_Lcd_4Bit , _LCD_CURSOR_OFF_DISPLAY_ON);
@@ -5,6 +5,7 @@
 #include"../../ecual/Chr_LCD/ecu_Chr_lcd.h"
 #include"../../ecual/LED/ecu_led.h"
 #include"../../mcal/Timer1/timer1.h"
+#include"../../mcal/Interrupt/mcal_interrupt_manager.h"
 
 void Matrix_Keypad_Led_App(void);
 
@@ -10,7 +10,9 @@
  */
 static void slave_application_intialize(void);
 
-static void MSSP_I2C_INTERRUPT_HANDLER(void);
+static void Slave_Register_Written(uint8 reg);
+static void Slave_Command_Process(void);
+static void Slave_Telemetry_Publish(uint8 pwm_duty , uint8 status);
 
 
 static mssp_i2c_t i2c_obj = {
@@ -21,9 +23,6 @@ static mssp_i2c_t i2c_obj = {
     .i2c_cfg.i2c_SMBus_Control = I2C_SMBUS_DISABLE,
     .i2c_cfg.i2c_slave_address = 0x70,
     .i2c_cfg.i2c_general_call = I2C_GENERAL_CALL_DISABLE,
-#if     SMART_HOME_SLAVE_BUILD == SMART_HOME_NODE      
-    .MSSP_I2C_DEFAULT_INTERRUPT_HANDLER = MSSP_I2C_INTERRUPT_HANDLER,
-#endif    
 };
 static led_t yellow_led = {
     .port_name = PORTD_INDEX,
@@ -57,50 +56,107 @@ static timer2_t tim2 = {
     .preloaded_value = 99
 };
 
-static volatile uint8 temperature = ZERO_INIT;
-static volatile uint8 mssp_i2c_transimit_data = 'y';
-static volatile uint8 dummy_buffer;
+/* I2C register map : telemetry frame (read-only) , command frame (written by the master) */
+static volatile uint8 slave_registers[TELEMETRY_MAP_SIZE];
+static const uint8 slave_write_mask[TELEMETRY_MAP_SIZE] = {
+    0x00 , 0x00 , 0x00 , 0x00 , 0x00 , 0x00 , 0x00 , 0x00 ,
+    0xFF , 0xFF , 0xFF , 0xFF
+};
+static const i2c_slave_register_map_t slave_map = {
+    .registers = slave_registers,
+    .write_mask = slave_write_mask,
+    .register_written = Slave_Register_Written,
+    .length = TELEMETRY_MAP_SIZE
+};
+/* Complete command frames , handed from MSSP_I2C_ISR to the main loop without masking interrupts */
+#define SLAVE_COMMAND_QUEUE_SIZE        4
+typedef struct{
+    uint8 bytes[TELEMETRY_COMMAND_SIZE] ;
+}slave_command_frame_t;
+static SPSC_QUEUE_TYPE(slave_command_frame_t , SLAVE_COMMAND_QUEUE_SIZE) command_queue;
+static smart_home_telemetry_t telemetry = {
+    .setpoint = TELEMETRY_DEFAULT_SETPOINT
+};
+static sint8 temperature = ZERO_INIT;
 
-static volatile uint8 system_init = 0;
+/* Main loop only : the fan is started once the first command has arrived */
+static uint8 command_received = FALSE;
+static uint8 motor_started = FALSE;
 
 static Std_ReturnType ret = E_NOT_OK; 
 
 /************************** Function Definition **************************/
 void slave_mcu_main_app(void){
+    uint8 l_duty = ZERO_INIT;
+    uint8 l_status = ZERO_INIT;
+    
     slave_application_intialize();
+    Slave_Telemetry_Publish(ZERO_INIT , ZERO_INIT);
 
     while(1){
+        /* Latest command written by the master */
+        Slave_Command_Process();
         
-        if(1 == system_init){
+        if((FALSE == motor_started) && (TRUE == command_received)){
             ret = CCP_Init(&pwm);
             ret = dc_motor_initialize(&motor);
             ret = timer2_init(&tim2);
             ret = CCP_PWM_Start(&pwm);
+            motor_started = TRUE;
         }
+        else{ /* Nothing */ }
         
+        l_status = ZERO_INIT;
+        l_duty = ZERO_INIT;
         if((20 > temperature) && (temperature > 5)){
             ret = dc_motor_move_backward(&motor);
-            ret = CCP_PWM_Set_Duty(&pwm ,40 );            
+            l_duty = 40;
         }
         else if((20 <= temperature) && (35 > temperature) ){
             ret = dc_motor_move_forward(&motor);
-            ret = CCP_PWM_Set_Duty(&pwm ,40 );
+            l_duty = 40;
+            l_status |= TELEMETRY_STATUS_FAN_FORWARD;
         }
         else if((35 <= temperature) && (45 > temperature)){
             ret = dc_motor_move_forward(&motor);
-            ret = CCP_PWM_Set_Duty(&pwm ,50 );
+            l_duty = 50;
+            l_status |= TELEMETRY_STATUS_FAN_FORWARD;
         }
-        else if((45 <= temperature) && (50 > temperature)){
+        else if(45 <= temperature){
             ret = dc_motor_move_forward(&motor);
-            ret = CCP_PWM_Set_Duty(&pwm ,80 );
+            l_duty = (temperature < (sint8)telemetry.setpoint) ? 80 : 100;
+            l_status |= TELEMETRY_STATUS_FAN_FORWARD;
         }
-        else if(50 <= temperature){
-            ret = dc_motor_move_forward(&motor);
-            ret = CCP_PWM_Set_Duty(&pwm ,100 );
+        else{
+            /* Too cold : fan left as is */
+            l_duty = telemetry.pwm_duty;
+            l_status |= (uint8)(telemetry.status & TELEMETRY_STATUS_FAN_FORWARD);
+        }
+        
+        if(ZERO_INIT != l_duty){
+            ret = CCP_PWM_Set_Duty(&pwm , l_duty);
+            l_status |= TELEMETRY_STATUS_FAN_ON;
+        }
+        else{ /* Nothing */ }
+        if(temperature >= (sint8)telemetry.setpoint){
             ret = led_turn_on(&yellow_led);
-            continue;
+            l_status |= TELEMETRY_STATUS_ALARM;
+        }
+        else{
+            ret = led_turn_off(&yellow_led);
+        }
+        if(TELEMETRY_STATUS_COMMAND_ERROR == (telemetry.status & TELEMETRY_STATUS_COMMAND_ERROR)){
+            l_status |= TELEMETRY_STATUS_COMMAND_ERROR;
+        }
+        else{
+            l_status &= (uint8)~TELEMETRY_STATUS_COMMAND_ERROR;
         }
-        ret = led_turn_off(&yellow_led);
+        
+        if((l_duty != telemetry.pwm_duty) || (l_status != telemetry.status) ||
+           (temperature != telemetry.temperature)){
+            Slave_Telemetry_Publish(l_duty , l_status);
+        }
+        else{ /* Frame already up to date */ }
     }
     
 }
@@ -110,33 +166,73 @@ static void slave_application_intialize(void){
     Std_ReturnType ret = E_NOT_OK;
     
     ret = MSSP_I2C_Init(&i2c_obj);
+#if     SMART_HOME_SLAVE_BUILD == SMART_HOME_NODE
+    ret = MSSP_I2C_Slave_Register_Map_Init(&slave_map);
+#endif
     ret = led_initialize(&yellow_led);
+#if CONFIG_ENABLE == GPIO_MARKER_CONFIGURATION
+    /* Statistics read with GPIO_Marker_Get , no UART on this node */
+    ret = Time_Service_Init();
+    ret = GPIO_Marker_Init(Time_Get_Micros);
+    ret = GPIO_Marker_Path_Init(SLAVE_MARKER_PATH_COMMAND , GPIO_MARKER_USER0 , GPIO_MARKER_PWM);
+#endif
+    ret = Interrupt_Manager_Global_Enable();
 }
 
-static void MSSP_I2C_INTERRUPT_HANDLER(void){
-    /* Holds Clock low (Clock Stretch) */
-    I2C_CLOCK_STRETCH_ENABLE();
+/* Called by MSSP_I2C_ISR after the master wrote one register */
+static void Slave_Register_Written(uint8 reg){
+    uint8 l_index = ZERO_INIT;
     
-    if((SSPSTATbits.R_nW == 0) && (SSPSTATbits.D_nA == 0) ){
-        /* Read Address Data From Master */
-        dummy_buffer = SSPBUF;
-        while(!SSPSTATbits.BF);
-        temperature = SSPBUF;
+    /* The last byte (CRC) completes the command burst */
+    if((TELEMETRY_COMMAND_REGISTER + TELEMETRY_COMMAND_SIZE - 1) == reg){
+        if(!SPSC_QUEUE_IS_FULL(command_queue)){
+            for(l_index = ZERO_INIT ; l_index < TELEMETRY_COMMAND_SIZE ; l_index++){
+                SPSC_QUEUE_BACK(command_queue).bytes[l_index] = slave_registers[TELEMETRY_COMMAND_REGISTER + l_index];
+            }
+            SPSC_QUEUE_PUBLISH(command_queue , 1);
+            GPIO_MARKER_HIT(USER0);
+        }
+        else{ /* Main loop behind : the master sends the next command anyway */ }
     }
-    else if((SSPSTATbits.R_nW == 1) && (SSPSTATbits.D_nA == 0)){
-        /* Write Data To Master */
-        dummy_buffer = SSPBUF; //clear address
-        SSPBUF = mssp_i2c_transimit_data;
+    else{ /* Nothing */ }
+}
+
+/* Apply the queued command frames , a frame failing its CRC is reported and dropped */
+static void Slave_Command_Process(void){
+    smart_home_command_t l_command;
+    
+    while(!SPSC_QUEUE_IS_EMPTY(command_queue)){
+        command_received = TRUE;
+        if(E_OK == Telemetry_Command_Unpack(SPSC_QUEUE_FRONT(command_queue).bytes , &l_command)){
+            temperature = l_command.temperature;
+            telemetry.setpoint = l_command.setpoint;
+            telemetry.status &= (uint8)~TELEMETRY_STATUS_COMMAND_ERROR;
+        }
+        else{
+            telemetry.status |= TELEMETRY_STATUS_COMMAND_ERROR;
+        }
+        SPSC_QUEUE_RELEASE(command_queue);
     }
+}
+
+/* Rebuild the telemetry frame , swapped into the map with interrupts masked */
+static void Slave_Telemetry_Publish(uint8 pwm_duty , uint8 status){
+    uint8 l_frame[TELEMETRY_FRAME_SIZE];
+    uint8 l_index = ZERO_INIT;
+    uint8 l_gie = ZERO_INIT;
     
-    /* Releases Clock */
-    I2C_CLOCK_STRETCH_DISABLE();
+    telemetry.sequence++;
+    telemetry.temperature = temperature;
+    telemetry.fan_rpm = ZERO_INIT;          /* No tachometer on this node */
+    telemetry.pwm_duty = pwm_duty;
+    telemetry.status = status;
+    (void)Telemetry_Frame_Pack(&telemetry , l_frame);
     
-    if(0 == system_init){
-        system_init = 1;
-    }
-    else{
-        system_init = 2;
+    l_gie = INTCONbits.GIE;
+    INTCONbits.GIE = 0;
+    for(l_index = ZERO_INIT ; l_index < TELEMETRY_FRAME_SIZE ; l_index++){
+        slave_registers[TELEMETRY_FRAME_REGISTER + l_index] = l_frame[l_index];
     }
+    INTCONbits.GIE = l_gie;
 }
 
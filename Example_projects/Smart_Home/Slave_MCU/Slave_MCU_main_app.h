@@ -5,11 +5,20 @@
 /************************** Includes **************************/
 #include"ecu_layer_init.h"
 #include"I2C_APIs.h"
+#include"mcal_interrupt_manager.h"
 #include"../../mcal/CCP/CCP.h"
 #include"../../mcal/Timer2/Timer2.h"
+#include"../../mcal/GPIO/hal_gpio_marker.h"
+#include"../Smart_Home_telemetry.h"
+#if CONFIG_ENABLE == GPIO_MARKER_CONFIGURATION
+#include"../../ecual/Time_Service/ecu_time.h"
+#endif
 
 /************************** Declarations **************************/
 
+/* GPIO marker path (GPIO_MARKER_CONFIGURATION) : command frame received (USER0) to PWM duty loaded */
+#define SLAVE_MARKER_PATH_COMMAND       0x00
+
 /************************** Macro Functions Declarations **************************/
 
 /************************** Data Type Declarations **************************/
@@ -6,9 +6,28 @@ static void Smart_Home_app_init(void);
 static void RealTimeClock_DS1307_Date(void);
 static void TemperatureSensor_TC74(void);
 static void Chr_LCD_Hello_MSG(void);
+static void Chr_LCD_System_Start_MSG(void);
 static void Chr_LCD_Date_Time_Temp_MSG(void);
 static void Slave_Communication(void);
-static void TMR0_Handler(void);
+static void App_Keypad_Task(void);
+static void App_Boot_Task(void);
+static void App_Telemetry_Task(void);
+static void App_Lcd_Refresh_Task(void);
+static void App_5sec_Task(void);
+static void Password_Wait(uint16 wait_ms , password_state_t next_state);
+static void Password_Wait_Expired(void);
+static void Password_On_Key(const event_t *event);
+static void App_Rtc_Second_ISR(void);
+static void App_On_Rtc_Second(const event_t *event);
+static void App_On_Temperature_Display(const event_t *event);
+static void App_On_Temperature_Slave(const event_t *event);
+static void App_On_Temperature_Stats(const event_t *event);
+#if INTERRUPT_FEATURE_ENABLE != EUSART_TX_INTERRUPT_FEATURE_ENABLE
+static void Temperature_Stats_Format(sint16 value , uint8 *str);
+#endif
+static Std_ReturnType Boot_Lcd_Step(uint8 *done , uint16 *wait_ms);
+static Std_ReturnType Boot_Rtc_Step(uint8 *done , uint16 *wait_ms);
+static Std_ReturnType Boot_Tc74_Step(uint8 *done , uint16 *wait_ms);
 
 /********************** Variable Definition **********************/
 
@@ -57,14 +76,46 @@ static chr_lcd_4bit_t Chr_Lcd_4Bit = {
     .lcd_rs.pin  = PIN3 ,
     .lcd_rs.direction = GPIO_DIRECTION_OUTPUT ,
 };
-static timer0_t tim_10ms ={
-    .timer0_preload_value = 45536,
-    .prescaler_enable = PRESCALER_NOT_ASSIGNED_CFG,
-    .counter_edge_select = TIMER0_RISING_EDGE_CFG,
-    .clock_source = TIMER0_INTERNAL_CLK_SRC_CFG,
-    .timer_resolution = TIMER0_16BIT_MODE_CFG,
-    
-    .TMR_InterruptHandler = TMR0_Handler,
+/* Password phase : keypad scan , background boot and telemetry from the first second */
+static scheduler_task_t password_tasks[] = {
+    { .task_function = App_Boot_Task        , .period = SCHEDULER_MS_TO_TICKS(1)     , .offset = 0 },
+    { .task_function = App_Keypad_Task      , .period = SCHEDULER_MS_TO_TICKS(10)    , .offset = 0 },
+    { .task_function = App_Telemetry_Task   , .period = SCHEDULER_MS_TO_TICKS(1000)  , .offset = 0 },
+};
+static scheduler_t password_scheduler = {
+    .tasks = password_tasks , .task_count = sizeof(password_tasks) / sizeof(password_tasks[0])
+};
+
+/* Main phase , offsets stagger the long tasks away from the RTC second */
+static scheduler_task_t app_tasks[] = {
+    { .task_function = App_Boot_Task        , .period = SCHEDULER_MS_TO_TICKS(1)     , .offset = 0 },
+    { .task_function = App_Lcd_Refresh_Task , .period = SCHEDULER_MS_TO_TICKS(10)    , .offset = 0 },
+    { .task_function = App_5sec_Task        , .period = SCHEDULER_MS_TO_TICKS(5000)  , .offset = SCHEDULER_MS_TO_TICKS(5250) },
+};
+static scheduler_t app_scheduler = {
+    .tasks = app_tasks , .task_count = sizeof(app_tasks) / sizeof(app_tasks[0])
+};
+
+/* Password phase : key presses drive the password state machine */
+static const event_subscriber_t password_subscribers[] = {
+    { .event_id = SMART_HOME_EVENT_KEY          , .handler = Password_On_Key },
+};
+static const event_table_t password_events = {
+    .subscribers = password_subscribers ,
+    .subscriber_count = sizeof(password_subscribers) / sizeof(password_subscribers[0])
+};
+
+/* Main phase : each RTC second reads the sensor , the new reading fans out to the display and the slave ,
+ * closed statistics windows to the UART report and the EEPROM log */
+static const event_subscriber_t app_subscribers[] = {
+    { .event_id = SMART_HOME_EVENT_RTC_SECOND   , .handler = App_On_Rtc_Second },
+    { .event_id = SMART_HOME_EVENT_TEMPERATURE  , .handler = App_On_Temperature_Display },
+    { .event_id = SMART_HOME_EVENT_TEMPERATURE  , .handler = App_On_Temperature_Slave },
+    { .event_id = SMART_HOME_EVENT_TEMP_STATS   , .handler = App_On_Temperature_Stats },
+};
+static const event_table_t app_events = {
+    .subscribers = app_subscribers ,
+    .subscriber_count = sizeof(app_subscribers) / sizeof(app_subscribers[0])
 };
 static keypad_t matrix_keypad = {
     .keypad_row_pins[0].port = PORTD_INDEX , .keypad_row_pins[0].pin = PIN0 ,
@@ -96,8 +147,49 @@ static keypad_t matrix_keypad = {
     .keypad_column_pins[3].direction = GPIO_DIRECTION_INPUT ,
 };
 
+/* Drivers usable right after reset , brought up once by initialize_ecu_layer() */
+static const ecu_layer_entry_t smart_home_ecu_entries[] = {
+    ECU_LAYER_ENTRY_KEYPAD(&matrix_keypad) ,
+    ECU_LAYER_ENTRY_UART(&uart_obj) ,
+    ECU_LAYER_ENTRY_I2C(&i2c_obj) ,
+};
+static const ecu_layer_cfg_t smart_home_ecu_cfg = {
+    .entries = smart_home_ecu_entries ,
+    .entry_count = sizeof(smart_home_ecu_entries) / sizeof(smart_home_ecu_entries[0])
+};
+static uint32 smart_home_init_status = ZERO_INIT;
+
+/* Slow peripherals , their power-on waits overlap in the background (SMART_HOME_BOOT_x order) */
+static boot_task_t smart_home_boot_tasks[] = {
+    { .step_function = Boot_Lcd_Step  , .timeout = SCHEDULER_MS_TO_TICKS(100)  },
+    { .step_function = Boot_Rtc_Step  , .timeout = SCHEDULER_MS_TO_TICKS(100)  },
+    { .step_function = Boot_Tc74_Step , .timeout = SCHEDULER_MS_TO_TICKS(1000) },
+};
+static boot_sequencer_t smart_home_boot = {
+    .tasks = smart_home_boot_tasks ,
+    .task_count = sizeof(smart_home_boot_tasks) / sizeof(smart_home_boot_tasks[0])
+};
+static boot_task_state_t boot_state = BOOT_TASK_RUNNING;
+static uint8 lcd_init_step = CHR_LCD_INIT_STEP_START;
+
 static RealTimeClock_DS1307_t time;
 
+/* TC74 read every second : the register pointer stays on TEMP */
+static tc74_sensor_t temp_sensor = {
+    .address = TEMP_SENSOR_ADDRESS ,
+    .pointer = TC74_POINTER_UNKNOWN ,
+};
+
+/* DS1307 SQW/OUT (1 Hz , open drain with pull-up) on RB0 / INT0 , every edge posts SMART_HOME_EVENT_RTC_SECOND */
+static const Interrupt_INTx_t rtc_sqw_int = {
+    .External_InterruptHandler = App_Rtc_Second_ISR ,
+    .source = Interrupt_INT0 ,
+    .edge = Interrupt_Falling_Edge ,
+    .mcu_pin.port = PORTB_INDEX ,
+    .mcu_pin.pin = PIN0 ,
+    .mcu_pin.direction = GPIO_DIRECTION_INPUT ,
+};
+
 static Std_ReturnType ret = E_NOT_OK;
 
 /* Lock App Variable */
@@ -109,14 +201,18 @@ static uint8 password[] = "6102004" ;
 static uint8 password_buffer[MAX_PASSWORD_DIGIT+1];
 static uint8 pass_len = sizeof(password);
 
-static uint8 keypad_val_crnt = NO_KEY;
-static uint8 keypad_val_prev = NO_KEY;
+static keypad_event_t keypad_event;
+static uint8 events_idle = FALSE;
+
+static chr_lcd_fb_t lcd_fb;
 
 static uint8 pass_status = PASSWORD_FAILED;
 
 static uint8 match = 1;
 
 static password_state_t password_state = PASSWORD_SHOW_PROMPT;
+static password_state_t password_next_state = PASSWORD_SHOW_PROMPT;
+static uint8 password_timer = TIMER_WHEEL_INVALID_ID;
 
 /* Application variable */
 
@@ -125,79 +221,95 @@ static uint8 space_msg[]    = "----------------------------------\r\n";
 static uint8 Hello_msg_lcd[] = "Hello Embedded" ;
 static uint8 Hello_msg2_lcd[] = "System World" ;
 static uint8 system_start[] = "System Started" ;
+static uint8 boot_time_msg[6];
 
-static uint8 celsius[] = {
-  0x06,
-  0x09,
-  0x06,
-  0x00,
-  0x07,
-  0x04,
-  0x07,
-  0x00
+/* CGRAM glyph , kept in flash */
+static const uint8 celsius[LCD_CGRAM_GLYPH_SIZE] = {
+    0x06 , 0x09 , 0x06 , 0x00 , 0x07 , 0x04 , 0x07 , 0x00
 };
 
 static uint8 Date[12] ;
 static uint8 Time[10] ;
 static sint8 temp_msg[5];
-static uint8 ack;
-
-static volatile uint8  tmr0_10ms_flag = ZERO_INIT;
-static volatile uint8 tmr0_1sec_counter = ZERO_INIT; 
-static volatile uint16 tmr0_5sec_counter = ZERO_INIT;
-static volatile uint16 tmr0_10sec_counter = ZERO_INIT;
-static volatile uint8  app_locked_30sec = ZERO_INIT;
 
 
-static volatile uint8 app_1sec_flag = 1;
-static volatile uint8 app_5sec_flag = ZERO_INIT;
-static volatile uint8 app_10sec_flag = ZERO_INIT;
-
 static sint8 temp = ZERO_INIT;
 
-static uint8 temp_log_addr_counter = 0;
-static uint8 max_temp  = 0;
-static uint8 min_temp  = 0xFF;
-static uint8 last_temp = 0;
+/* Slave MCU exchange : one command burst and one telemetry burst per second */
+static smart_home_command_t slave_command = { .setpoint = TELEMETRY_DEFAULT_SETPOINT };
+static smart_home_telemetry_t slave_telemetry;
+static uint8 slave_frame[TELEMETRY_FRAME_SIZE];
+static uint8 slave_frame_errors = 0;
+
+/* Temperature statistics : one sample per RTC second , summaries only leave the MCU */
+static sensor_stats_t temp_stats;
+static sensor_stats_summary_t temp_summary;
+static uint32 uptime_s = ZERO_INIT;
+static uint8 temp_stats_closed = ZERO_INIT;
+#if INTERRUPT_FEATURE_ENABLE != EUSART_TX_INTERRUPT_FEATURE_ENABLE
+/* "min" at 17 , "avg" at 26 , "max" at 35 : sign and 3 digits each */
+static uint8 temp_stats_msg[] = "Temp 1 min : min +000 avg +000 max +000\r\n";
+#endif
+
+static eeprom_log_t temp_log = { .start_address = TEMP_LOG_START_ADDRESS , .slot_count = TEMP_LOG_SLOT_COUNT };
+static uint8 temp_log_record[EEPROM_LOG_RECORD_SIZE];
 
 /********************** Function Definition **********************/
 
 void Smart_Home_App(void){
     
-    ret = keypad_initialize(&matrix_keypad);
-    ret = timer0_init(&tim_10ms);
-    ret = lcd_4bit_initialize(&Chr_Lcd_4Bit);    
+    /* Keypad , UART and I2C : pins merged per port , each driver initialized once */
+    ret = initialize_ecu_layer(&smart_home_ecu_cfg , &smart_home_init_status);
+#if CONFIG_ENABLE == GPIO_MARKER_CONFIGURATION
+    /* Marker timestamps from the 1 us time service (Timer1) */
+    ret = Time_Service_Init();
+    ret = GPIO_Marker_Init(Time_Get_Micros);
+    ret = GPIO_Marker_Path_Init(SMART_HOME_MARKER_PATH_KEY , GPIO_MARKER_KEYPAD , GPIO_MARKER_LCD);
+    ret = GPIO_Marker_Path_Init(SMART_HOME_MARKER_PATH_TEMP , GPIO_MARKER_USER0 , GPIO_MARKER_I2C);
+#endif
+    ret = Scheduler_Init(&password_scheduler);
+    ret = Timer_Wheel_Init();
+    /* LCD , RTC and TC74 come up from App_Boot_Task , nothing waits for them here */
+    ret = Boot_Sequencer_Init(&smart_home_boot);
+    ret = Event_Init(&password_events);
+    
+    /* Restore the lifetime temperature range of the previous run */
+    ret = Sensor_Stats_Init(&temp_stats);
+    ret = EEPROM_Log_Init(&temp_log);
+    if(E_OK == EEPROM_Log_Read_Latest(&temp_log , temp_log_record)){
+        ret = Sensor_Stats_Restore_Range(&temp_stats , (sint8)temp_log_record[TEMP_LOG_MIN_INDEX] ,
+                                         (sint8)temp_log_record[TEMP_LOG_MAX_INDEX]);
+    }
+    else{ /* Nothing */ }
+    
+    /* Keypad , scheduler tick and EEPROM writer ready : one global enable */
+    ret = Interrupt_Manager_Global_Enable();
     
     while((MAX_PASSWORD_ATTEMPT+1 > password_attempt) && (!pass_status) ){
         
+        ret = Scheduler_Dispatch(&password_scheduler);
+        ret = Timer_Wheel_Process();
+        /* Key presses run Password_On_Key */
+        ret = Event_Dispatch();
+        
         switch(password_state){
             
             case PASSWORD_SHOW_PROMPT :
-                /* Clear LCD */
-                lcd_4bit_send_command(&Chr_Lcd_4Bit ,_LCD_CLEAR);
-                lcd_4bit_send_command(&Chr_Lcd_4Bit , _LCD_CURSOR_OFF_DISPLAY_ON);
-                /* Enter Password Message */
-                lcd_4bit_send_string_pos(&Chr_Lcd_4Bit , ROW2 , 1 , "Enter Password : ");
-                password_state = PASSWORD_READING;
+                /* The LCD may still be in its power-on wait */
+                ret = Boot_Sequencer_Get_State(&smart_home_boot , SMART_HOME_BOOT_LCD , &boot_state);
+                if(BOOT_TASK_RUNNING != boot_state){
+                    /* Clear LCD */
+                    lcd_4bit_send_command(&Chr_Lcd_4Bit ,_LCD_CLEAR);
+                    lcd_4bit_send_command(&Chr_Lcd_4Bit , _LCD_CURSOR_OFF_DISPLAY_ON);
+                    /* Enter Password Message */
+                    lcd_4bit_send_string_pos(&Chr_Lcd_4Bit , ROW2 , 1 , "Enter Password : ");
+                    password_state = PASSWORD_READING;
+                }
+                else{ /* Keys pressed before the prompt is shown are ignored */ }
                 break;
                 
             case PASSWORD_READING :
-                if(tmr0_10ms_flag){
-                    tmr0_10ms_flag = 0;
-                    Keypad_Update(&matrix_keypad ,&keypad_val_crnt );
-                }
-                if((NO_KEY == keypad_val_prev) && (NO_KEY != keypad_val_crnt) ){
-                    if(('=' != keypad_val_crnt) && ( (MAX_PASSWORD_DIGIT - 1) > password_counter) ){
-                        password_buffer[password_counter] = keypad_val_crnt;
-                        password_counter++;
-                        lcd_4bit_send_char_data_pos(&Chr_Lcd_4Bit , ROW3 , password_counter , '*');
-                    }
-                    if(('=' == keypad_val_crnt) || ( (MAX_PASSWORD_DIGIT - 1) <= password_counter)){
-                        password_state = PASSWORD_CHECK;
-                        __delay_ms(500);
-                    }
-                }
-                keypad_val_prev = keypad_val_crnt;
+                /* Every debounced press is an event , handled by Password_On_Key */
                 break;
             
             case PASSWORD_CHECK :
@@ -226,10 +338,20 @@ void Smart_Home_App(void){
                 break;
                 
             case PASSWORD_GRANTED :
-                pass_status = PASSWORD_PASSED;
                 lcd_4bit_send_command(&Chr_Lcd_4Bit ,_LCD_CLEAR);
                 lcd_4bit_send_string_pos(&Chr_Lcd_4Bit , ROW2 , 1 , "Access Granted! ");
-                __delay_ms(2000);
+                Password_Wait(2000 , PASSWORD_HELLO);
+                break;
+            case PASSWORD_HELLO :
+                Chr_LCD_Hello_MSG();
+                Password_Wait(1000 , PASSWORD_SYSTEM_START);
+                break;
+            case PASSWORD_SYSTEM_START :
+                Chr_LCD_System_Start_MSG();
+                Password_Wait(1000 , PASSWORD_ACCEPTED);
+                break;
+            case PASSWORD_ACCEPTED :
+                pass_status = PASSWORD_PASSED;
                 break;
             case PASSWORD_DENIED :
                 password_attempt++;
@@ -238,29 +360,27 @@ void Smart_Home_App(void){
                 lcd_4bit_send_command(&Chr_Lcd_4Bit , _LCD_CURSOR_OFF_DISPLAY_ON);
                 /* Enter Password Message */
                 lcd_4bit_send_string_pos(&Chr_Lcd_4Bit , ROW2 , 1 , "Invalid Password ");
-                __delay_ms(1000);
                 if( MAX_PASSWORD_ATTEMPT > password_attempt){
-                    password_state = PASSWORD_SHOW_PROMPT;
-                    lcd_4bit_send_string_pos(&Chr_Lcd_4Bit , ROW3 , 5 , "try again ");
-                    __delay_ms(2000);
+                    Password_Wait(1000 , PASSWORD_RETRY);
                 }
                 else{
-                    password_state = PASSWORD_LOCKED;
+                    Password_Wait(1000 , PASSWORD_LOCKED);
                 }
                 break;
+            case PASSWORD_RETRY :
+                lcd_4bit_send_string_pos(&Chr_Lcd_4Bit , ROW3 , 5 , "try again ");
+                Password_Wait(2000 , PASSWORD_SHOW_PROMPT);
+                break;
             case PASSWORD_LOCKED :
                 lcd_4bit_send_command(&Chr_Lcd_4Bit ,_LCD_CLEAR);
                 lcd_4bit_send_string_pos(&Chr_Lcd_4Bit , ROW2 , 1 , "System Locked ");
                 lcd_4bit_send_string_pos(&Chr_Lcd_4Bit , ROW3 , 5 , "wait 30 seconds");
-                app_locked_30sec = 0;
-                /*  
-                 * Wait ~30 seconds (3  10 sec ticks)
-                 * Timer interrupt must continue running! 
-                 */
-                while(3 > app_locked_30sec);
-                password_state = PASSWORD_SHOW_PROMPT;
                 password_attempt = 0;
                 pass_status = PASSWORD_FAILED;
+                Password_Wait(30000 , PASSWORD_SHOW_PROMPT);
+                break;
+            case PASSWORD_WAITING :
+                /* Keys pressed while a message is shown are ignored by Password_On_Key */
                 break;
             default :
                 password_state = PASSWORD_SHOW_PROMPT;
@@ -270,65 +390,29 @@ void Smart_Home_App(void){
          
     if(PASSWORD_PASSED == pass_status){
         Smart_Home_app_init();
-        Chr_LCD_Hello_MSG();
         
         /* Clear LCD */
         lcd_4bit_send_command(&Chr_Lcd_4Bit ,_LCD_CLEAR);
         lcd_4bit_send_command(&Chr_Lcd_4Bit , _LCD_CURSOR_OFF_DISPLAY_ON);
+        /* Celsius sign loaded once in CGRAM (code 0) , the framebuffer then owns the display */
+        lcd_4bit_load_cgram(&Chr_Lcd_4Bit , celsius , 1);
+        ret = lcd_fb_initialize(&lcd_fb , &Chr_Lcd_4Bit);
+        
+        /* Releases start now , the boot task goes on if anything is still coming up */
+        ret = Scheduler_Init(&app_scheduler);
+        ret = Event_Init(&app_events);
         
         while(1){
-
-            if(1 == app_1sec_flag){
-                app_1sec_flag = 0;
-                ret = RealTimeClock_DS1307_Get_Date_Time(&time);
-                RealTimeClock_DS1307_Date();    /* Construct The Date & Time Array */
-                ret = TempSensor_TC74_Read_Temp(TEMP_SENSOR_ADDRESS , &temp);
-                TemperatureSensor_TC74();       /* Construct The Temperature Array */
-
-                /* After Array Construction , time to display */
-                Chr_LCD_Date_Time_Temp_MSG();
-
-                /* Send Temperature Value For Slave MCU */
-                Slave_Communication();  
+            /* Run-to-completion dispatch : periodic jobs of app_tasks , then the pending events */
+            ret = Scheduler_Dispatch(&app_scheduler);
+            ret = Timer_Wheel_Process();
+            ret = Event_Dispatch();
+            /* Nothing released or posted : IDLE until the next tick or interrupt , the wheel needs Timer0 */
+            ret = Event_Is_Idle(&events_idle);
+            if(TRUE == events_idle){
+                ret = Scheduler_Idle(&app_scheduler , POWER_MODE_IDLE);
             }
-            else{ /* Nothing */ }
-
-            if(1 == app_5sec_flag){
-                app_5sec_flag = 0;
-
-                /* Change the arrays used for character lcd to be used for uart */
-                Time[8] = '\r';
-                Date[10] = '\r';
-                temp_msg[3] = '\r';
-
-                /* Debugging messages through uart */
-
-                EUSART_ASYNC_Write_String_Blocking("Date : ", 7);
-                EUSART_ASYNC_Write_String_Blocking(Date , sizeof(Date));
-                EUSART_ASYNC_Write_String_Blocking("Time : ", 7);
-                EUSART_ASYNC_Write_String_Blocking(Time , sizeof(Time));
-                EUSART_ASYNC_Write_String_Blocking("Temperature : ", 14);
-                EUSART_ASYNC_Write_String_Blocking(temp_msg , sizeof(temp_msg));
-                EUSART_ASYNC_Write_String_Blocking(space_msg , sizeof(space_msg));
-            }
-            else{ /* Nothing */ }
-
-            if(1 == app_10sec_flag){
-                app_10sec_flag = 0;
-
-                last_temp = temp;
-                max_temp = max_temp > last_temp ? max_temp : last_temp ;
-                min_temp = min_temp < last_temp ? min_temp : last_temp ;
-
-                /* EEPROM Used For Data Logging,  EEPROM1_ADDRESS For Every Temp Value 
-                 *                                EEPROM2_ADDRESS For max,min,last Temp Value
-                 */
-                EEPROM_24C02C_Write_Byte(EEPROM1_ADDRESS , temp_log_addr_counter++ , last_temp );
-                EEPROM_24C02C_Write_Byte(EEPROM2_ADDRESS , MAX_TEMP_VAL_ADDRESS , max_temp );
-                EEPROM_24C02C_Write_Byte(EEPROM2_ADDRESS , MIN_TEMP_VAL_ADDRESS , min_temp );
-                EEPROM_24C02C_Write_Byte(EEPROM2_ADDRESS , LAST_TEMP_VAL_ADDRESS, last_temp );
-            }
-            else{ /* Nothing */ }
+            else{ /* Events posted by the handlers , dispatched on the next pass */ }
         }
     }
         
@@ -337,40 +421,48 @@ void Smart_Home_App(void){
 /********************** Function Declaration **********************/
 
 static void Smart_Home_app_init(void){
-    ret = EUSART_ASYNC_Init(&uart_obj);
-    ret = MSSP_I2C_Init(&i2c_obj);
-    ret = lcd_4bit_initialize(&Chr_Lcd_4Bit);
-    ret = timer0_init(&tim_10ms);
+    /* UART , I2C and keypad are up (smart_home_ecu_cfg) , LCD , RTC and TC74 (smart_home_boot) */
+    uint16 l_boot_ticks = ZERO_INIT;
+    uint8 l_boot_done = FALSE;
+    ret = Boot_Sequencer_Is_Done(&smart_home_boot , &l_boot_done , &l_boot_ticks);
+#if INTERRUPT_FEATURE_ENABLE == EUSART_TX_INTERRUPT_FEATURE_ENABLE
+    (void)Trace_Init();
+#endif
+    if(TRUE == l_boot_done){
+#if INTERRUPT_FEATURE_ENABLE == EUSART_TX_INTERRUPT_FEATURE_ENABLE
+        TRACE_LOG(SMART_HOME_TRACE_BOOT , ZERO_INIT , l_boot_ticks * SCHEDULER_TICK_MS);
+#else
+        (void)convert_short_to_string(l_boot_ticks * SCHEDULER_TICK_MS , boot_time_msg);
+        EUSART_ASYNC_Write_String_Blocking("Boot time (ms) : ", 17);
+        EUSART_ASYNC_Write_String_Blocking(boot_time_msg , sizeof(boot_time_msg) - 1);
+        EUSART_ASYNC_Write_String_Blocking("\r\n", 2);
+#endif
+    }
+    else{ /* Still booting , App_Boot_Task keeps running in app_tasks */ }
 }
 
 static void RealTimeClock_DS1307_Date(void){
     Date[0] = '2' ;
     Date[1] = '0' ;
     
-    Date[2] = ((time.Year & 0xF0) >> 4) + '0';
-    Date[3] = (time.Year & 0x0F) + '0' ;
+    (void)convert_bcd_to_string(time.Year , &Date[2]);
     Date[4] = '/';
     
-    Date[5] = ((time.Month & 0xF0) >> 4)+ '0'  ;
-    Date[6] = (time.Month & 0x0F)+ '0' ;
+    (void)convert_bcd_to_string(time.Month , &Date[5]);
     Date[7] = '/';
     
-    Date[8] = ((time.Day & 0xF0) >> 4)+ '0';
-    Date[9] = (time.Day & 0x0F)+ '0' ;
+    (void)convert_bcd_to_string(time.Day , &Date[8]);
     
     Date[10] = '\r';
     Date[11] = '\n';
     
-    Time[0] = ((time.Hours & 0xF0) >> 4)+ '0';
-    Time[1] = (time.Hours & 0x0F)+ '0' ;
+    (void)convert_bcd_to_string(time.Hours , &Time[0]);
     Time[2] = ':';
     
-    Time[3] = ((time.Minutes & 0xF0) >> 4)+ '0' ;
-    Time[4] = (time.Minutes & 0x0F)+ '0' ;
+    (void)convert_bcd_to_string(time.Minutes , &Time[3]);
     Time[5] = ':';
     
-    Time[6] = ((time.Seconds & 0xF0) >> 4) + '0' ;
-    Time[7] = (time.Seconds & 0x0F)+ '0' ;
+    (void)convert_bcd_to_string(time.Seconds , &Time[6]);
     
     Time[8] = '\r';
     Time[9] = '\n';
@@ -381,32 +473,31 @@ static void Chr_LCD_Hello_MSG(void){
     
     lcd_4bit_send_string_pos(&Chr_Lcd_4Bit , ROW1 , 1 , Hello_msg_lcd);
     lcd_4bit_send_string_pos(&Chr_Lcd_4Bit , ROW2 , 5 , Hello_msg2_lcd);
-    __delay_ms(1000);
-    
+}
+static void Chr_LCD_System_Start_MSG(void){
     lcd_4bit_send_string_pos(&Chr_Lcd_4Bit , ROW1 , 1 , "                                ");
     lcd_4bit_send_string_pos(&Chr_Lcd_4Bit , ROW2 , 1 , "                                ");
     
     lcd_4bit_send_string_pos(&Chr_Lcd_4Bit , ROW1 , 1 , system_start);
-    __delay_ms(1000);
 }
 static void Chr_LCD_Date_Time_Temp_MSG(void){
-    /* LCD Display Time - Date - Temperature */
+    /* LCD Display Time - Date - Temperature , written in the framebuffer only */
         
     /* time display */
-    lcd_4bit_send_string_pos(&Chr_Lcd_4Bit ,ROW1 , 1 , "Time  ");
+    lcd_fb_write_string(&lcd_fb ,ROW1 , 1 , "Time  ");
     Time[8] = '\0';
-    lcd_4bit_send_string_pos(&Chr_Lcd_4Bit ,ROW1 , 7 , Time);
+    lcd_fb_write_string(&lcd_fb ,ROW1 , 7 , Time);
     
     /* Date display */
-    lcd_4bit_send_string_pos(&Chr_Lcd_4Bit ,ROW2 , 1 , "Date ");
+    lcd_fb_write_string(&lcd_fb ,ROW2 , 1 , "Date ");
     Date[10] = '\0';
-    lcd_4bit_send_string_pos(&Chr_Lcd_4Bit ,ROW2 , 6 , Date);
+    lcd_fb_write_string(&lcd_fb ,ROW2 , 6 , Date);
     
     /* Temperature display */
-    lcd_4bit_send_string_pos(&Chr_Lcd_4Bit ,ROW3 , 1 , "Temperature ");
+    lcd_fb_write_string(&lcd_fb ,ROW3 , 1 , "Temperature ");
     temp_msg[3] = '\0';
-    lcd_4bit_send_string(&Chr_Lcd_4Bit , temp_msg);
-    lcd_4bit_send_custom_char(&Chr_Lcd_4Bit ,ROW3 , 16 , celsius , 1 );
+    lcd_fb_write_string(&lcd_fb ,ROW3 , 13 , temp_msg);
+    lcd_fb_write_char(&lcd_fb ,ROW3 , 16 , CELSIUS_CGRAM_CODE );
     
 }
 static void TemperatureSensor_TC74(void){
@@ -418,43 +509,228 @@ static void TemperatureSensor_TC74(void){
             temp_msg[0] = '-';
             temp_l = -temp_l;
         }
-        temp_msg[1] = (temp_l/10)+'0';
-        temp_msg[2] = (temp_l%10)+'0';
+        (void)convert_uint_to_string_fixed((uint8)temp_l , 2 , '0' , (uint8 *)&temp_msg[1]);
         temp_msg[3] = '\r';
         temp_msg[4] = '\n';
 }
 static void Slave_Communication(void){
-    /* Send Temperature Value For Slave */
-    ret = MSSP_I2C_Master_Send_Start();
-    ret = MSSP_I2C_Master_Write_Blocking( (SLAVE_ADDRESS << 1) , &ack);
-    ret = MSSP_I2C_Master_Send_Repeated_Start();
-    ret = MSSP_I2C_Master_Write_Blocking(temp , &ack);
-    ret = MSSP_I2C_Master_Send_Stop();    
+    /* Send Temperature Value For Slave : one command burst */
+    slave_command.sequence++;
+    slave_command.temperature = temp;
+    ret = Telemetry_Command_Pack(&slave_command , slave_frame);
+    ret = MSSP_I2C_Write_Registers(SLAVE_ADDRESS , TELEMETRY_COMMAND_REGISTER , slave_frame , TELEMETRY_COMMAND_SIZE);
+    
+    /* Fetch the whole slave state : one telemetry burst , kept only if the CRC matches */
+    ret = MSSP_I2C_Read_Registers(SLAVE_ADDRESS , TELEMETRY_FRAME_REGISTER , slave_frame , TELEMETRY_FRAME_SIZE);
+    if((E_OK != ret) || (E_OK != Telemetry_Frame_Unpack(slave_frame , &slave_telemetry))){
+        slave_frame_errors++;
+    }
+    else{ /* slave_telemetry up to date */ }
 }
 
-static void TMR0_Handler(void){
-    tmr0_1sec_counter++;
-    tmr0_5sec_counter++;
-    tmr0_10sec_counter++;
-    tmr0_10ms_flag = 1;
-    
-    if(100 == tmr0_1sec_counter){
-        tmr0_1sec_counter = 0;
-        app_1sec_flag = 1 ;
+/* Non-blocking message time : the state machine idles in PASSWORD_WAITING */
+static void Password_Wait(uint16 wait_ms , password_state_t next_state){
+    password_next_state = next_state;
+    if(E_OK == Timer_Wheel_Start(SCHEDULER_MS_TO_TICKS(wait_ms) , 0 , Password_Wait_Expired , &password_timer)){
+        password_state = PASSWORD_WAITING;
     }
-    else{ /* Nothing */ }
-    
-    if(500 == tmr0_5sec_counter){
-        tmr0_5sec_counter = 0;
-        app_5sec_flag = 1 ;
+    else{
+        password_state = next_state;
+    }
+}
+
+static void Password_Wait_Expired(void){
+    password_state = password_next_state;
+}
+
+/* Digits while the prompt is shown , keys pressed in any other state are ignored */
+static void Password_On_Key(const event_t *event){
+    if((PASSWORD_READING == password_state) && (KEYPAD_EVENT_PRESS == (keypad_event_type_t)event->arg16)){
+        if(('=' != event->arg8) && ( (MAX_PASSWORD_DIGIT - 1) > password_counter) ){
+            password_buffer[password_counter] = event->arg8;
+            password_counter++;
+            lcd_4bit_send_char_data_pos(&Chr_Lcd_4Bit , ROW3 , password_counter , '*');
+        }
+        if(('=' == event->arg8) || ( (MAX_PASSWORD_DIGIT - 1) <= password_counter)){
+            Password_Wait(500 , PASSWORD_CHECK);
+        }
+    }
+    else{ /* Release / repeat not used for the password */ }
+}
+
+static void App_Keypad_Task(void){
+    ret = Keypad_Update(&matrix_keypad , NULL);
+    /* Every debounced press is forwarded , fast keystrokes are not lost */
+    while(E_OK == Keypad_Get_Event(&matrix_keypad , &keypad_event)){
+        ret = Event_Post(SMART_HOME_EVENT_KEY , keypad_event.key , (uint16)keypad_event.type);
+    }
+}
+
+/* INT0 , interrupt context : the RTC driver has counted the edge */
+static void App_Rtc_Second_ISR(void){
+    (void)Event_Post_From_ISR(SMART_HOME_EVENT_RTC_SECOND , ZERO_INIT , ZERO_INIT);
+}
+
+static void App_Boot_Task(void){
+    /* One test per tick once every boot task has settled */
+    ret = Boot_Sequencer_Process(&smart_home_boot);
+}
+
+static void App_Telemetry_Task(void){
+    /* Slave exchange runs during the password phase too , with the last valid temperature */
+    ret = Boot_Sequencer_Get_State(&smart_home_boot , SMART_HOME_BOOT_TC74 , &boot_state);
+    if(BOOT_TASK_DONE == boot_state){
+        ret = TempSensor_TC74_Read_Temp_Fast(&temp_sensor , &temp);
+        GPIO_MARKER_HIT(USER0);
+    }
+    else{ /* First conversion not ready */ }
+    Slave_Communication();
+}
+
+static Std_ReturnType Boot_Lcd_Step(uint8 *done , uint16 *wait_ms){
+    Std_ReturnType l_ret = E_OK;
+    uint8 l_wait_ms = ZERO_INIT;
+    l_ret = lcd_4bit_initialize_step(&Chr_Lcd_4Bit , &lcd_init_step , &l_wait_ms);
+    *wait_ms = l_wait_ms;
+    *done = (CHR_LCD_INIT_STEP_DONE == lcd_init_step) ? TRUE : FALSE;
+    return l_ret;
+}
+
+static Std_ReturnType Boot_Rtc_Step(uint8 *done , uint16 *wait_ms){
+    /* One I2C burst , SQW edges keep the cache after that */
+    *done = TRUE;
+    return RealTimeClock_DS1307_Cache_Init(&rtc_sqw_int);
+}
+
+static Std_ReturnType Boot_Tc74_Step(uint8 *done , uint16 *wait_ms){
+    Std_ReturnType l_ret = E_OK;
+    uint8 l_ready = FALSE;
+    /* TEMP is not valid before the first conversion (DATA_RDY) */
+    l_ret = TempSensor_TC74_Is_Data_Ready(&temp_sensor , &l_ready);
+    if((E_OK == l_ret) && (TRUE == l_ready)){
+        l_ret = TempSensor_TC74_Read_Temp_Fast(&temp_sensor , &temp);
+        *done = TRUE;
+    }
+    else{
+        /* NACK while the sensor powers up is retried until the timeout */
+        l_ret = E_OK;
+        *wait_ms = SMART_HOME_TC74_POLL_MS;
+    }
+    return l_ret;
+}
+
+static void App_Lcd_Refresh_Task(void){
+    /* Background LCD refresh : only the changed cells are sent */
+    ret = lcd_fb_refresh(&lcd_fb);
+}
+
+static void App_On_Rtc_Second(const event_t *event){
+    /* Cached clock : SQW ticks , one I2C burst per re-sync period */
+    ret = RealTimeClock_DS1307_Cache_Get(&time);
+    RealTimeClock_DS1307_Date();    /* Construct The Date & Time Array */
+    uptime_s++;
+    ret = TempSensor_TC74_Read_Temp_Fast(&temp_sensor , &temp);
+    GPIO_MARKER_HIT(USER0);
+    if(E_OK == ret){
+        /* A few hundred cycles : the window summaries are reported from their own event */
+        ret = Sensor_Stats_Push(&temp_stats , temp , uptime_s , &temp_stats_closed);
+        if(ZERO_INIT != temp_stats_closed){
+            ret = Event_Post(SMART_HOME_EVENT_TEMP_STATS , temp_stats_closed , ZERO_INIT);
+        }
+        else{ /* Nothing */ }
+    }
+    else{ /* Failed read : the statistics skip this second */ }
+    ret = Event_Post(SMART_HOME_EVENT_TEMPERATURE , (uint8)temp , ZERO_INIT);
+}
+
+static void App_On_Temperature_Display(const event_t *event){
+    TemperatureSensor_TC74();       /* Construct The Temperature Array */
+
+    /* After Array Construction , time to display */
+    Chr_LCD_Date_Time_Temp_MSG();
+}
+
+static void App_On_Temperature_Slave(const event_t *event){
+    /* Send Temperature Value For Slave MCU */
+    Slave_Communication();
+}
+
+static void App_5sec_Task(void){
+#if INTERRUPT_FEATURE_ENABLE == EUSART_TX_INTERRUPT_FEATURE_ENABLE
+    /* 24 bytes queued in the TX ring instead of ~90 blocking , tools/trace/trace_decode.py prints them */
+    TRACE_LOG(SMART_HOME_TRACE_DATE , time.Day , (time.Year << 8) | time.Month);
+    TRACE_LOG(SMART_HOME_TRACE_TIME , time.Seconds , (time.Hours << 8) | time.Minutes);
+    TRACE_LOG(SMART_HOME_TRACE_TEMP , temp , ZERO_INIT);
+#else
+    /* Change the arrays used for character lcd to be used for uart */
+    Time[8] = '\r';
+    Date[10] = '\r';
+    temp_msg[3] = '\r';
+
+    /* Debugging messages through uart */
+
+    EUSART_ASYNC_Write_String_Blocking("Date : ", 7);
+    EUSART_ASYNC_Write_String_Blocking(Date , sizeof(Date));
+    EUSART_ASYNC_Write_String_Blocking("Time : ", 7);
+    EUSART_ASYNC_Write_String_Blocking(Time , sizeof(Time));
+    EUSART_ASYNC_Write_String_Blocking("Temperature : ", 14);
+    EUSART_ASYNC_Write_String_Blocking(temp_msg , sizeof(temp_msg));
+    EUSART_ASYNC_Write_String_Blocking(space_msg , sizeof(space_msg));
+#endif
+}
+
+static void App_On_Temperature_Stats(const event_t *event){
+    sint16 l_mean = ZERO_INIT;
+
+    /* Minute window : min / avg / max report on UART */
+    if((SENSOR_STATS_CLOSED(SENSOR_STATS_MINUTE) & event->arg8) &&
+       (E_OK == Sensor_Stats_Get(&temp_stats , SENSOR_STATS_MINUTE , &temp_summary))){
+        l_mean = SENSOR_STATS_Q8_ROUND(temp_summary.mean_q8);
+#if INTERRUPT_FEATURE_ENABLE == EUSART_TX_INTERRUPT_FEATURE_ENABLE
+        TRACE_LOG(SMART_HOME_TRACE_TEMP_STATS , l_mean , ((uint16)(uint8)temp_summary.max << 8) | (uint8)temp_summary.min);
+        TRACE_LOG(SMART_HOME_TRACE_TEMP_VAR , (0xFFUL < temp_summary.count) ? 0xFFU : temp_summary.count ,
+                  (0xFFFFUL < temp_summary.variance_q8) ? 0xFFFFU : temp_summary.variance_q8);
+#else
+        Temperature_Stats_Format(temp_summary.min , &temp_stats_msg[17]);
+        Temperature_Stats_Format(l_mean , &temp_stats_msg[26]);
+        Temperature_Stats_Format(temp_summary.max , &temp_stats_msg[35]);
+        EUSART_ASYNC_Write_String_Blocking(temp_stats_msg , sizeof(temp_stats_msg) - 1);
+#endif
+#if CONFIG_ENABLE == GPIO_MARKER_CONFIGURATION
+        /* Lines longer than the TX ring : blocking , debug builds only */
+        ret = GPIO_Marker_Report(EUSART_ASYNC_Write_String_Blocking);
+#endif
     }
     else{ /* Nothing */ }
-    
-    if(1000 == tmr0_10sec_counter){
-        tmr0_10sec_counter = 0;
-        app_10sec_flag = 1 ;
-        app_locked_30sec++;
+
+    /* Hour window : one summary record in the internal EEPROM log , at most 5 blocking byte writes per hour */
+    if((SENSOR_STATS_CLOSED(SENSOR_STATS_HOUR) & event->arg8) &&
+       (E_OK == Sensor_Stats_Get(&temp_stats , SENSOR_STATS_HOUR , &temp_summary))){
+        temp_log_record[TEMP_LOG_HOUR_MEAN_INDEX] = (uint8)SENSOR_STATS_Q8_ROUND(temp_summary.mean_q8);
+        temp_log_record[TEMP_LOG_HOUR_MIN_INDEX]  = (uint8)temp_summary.min;
+        temp_log_record[TEMP_LOG_HOUR_MAX_INDEX]  = (uint8)temp_summary.max;
+        ret = Sensor_Stats_Get(&temp_stats , SENSOR_STATS_TOTAL , &temp_summary);
+        temp_log_record[TEMP_LOG_MAX_INDEX]       = (uint8)temp_summary.max;
+        temp_log_record[TEMP_LOG_MIN_INDEX]       = (uint8)temp_summary.min;
+        ret = EEPROM_Log_Append(&temp_log , temp_log_record);
     }
-    else{ /* Nothing */ }   
+    else{ /* Nothing */ }
 }
 
+#if INTERRUPT_FEATURE_ENABLE != EUSART_TX_INTERRUPT_FEATURE_ENABLE
+/* Sign and 3 digits , the TC74 range is -65 .. +127 C */
+static void Temperature_Stats_Format(sint16 value , uint8 *str){
+    uint8 l_digits[4];
+    uint16 l_value = (uint16)value;
+
+    if(0 > value){
+        str[0] = '-';
+        l_value = (uint16)(-value);
+    }
+    else{
+        str[0] = '+';
+    }
+    (void)convert_uint_to_string_fixed(l_value , 3 , '0' , l_digits);
+    memcpy(&str[1] , l_digits , 3);
+}
+#endif
@@ -8,8 +8,20 @@
 #include"../../mcal/EEPROM/hal_eeprom.h"
 #include"../../mcal/EUSART/hal_eusart.h"
 #include"../../mcal/I2C/I2C_APIs.h"
-#include"../../mcal/Timer0/Timer0.h"
+#include"../../mcal/Interrupt/mcal_interrupt_manager.h"
+#include"../../mcal/GPIO/hal_gpio_marker.h"
 #include"../../ecual/ecu_layer_init.h"
+#include"../../ecual/EEPROM_Log/ecu_eeprom_log.h"
+#include"../../ecual/Scheduler/ecu_scheduler.h"
+#include"../../ecual/Scheduler/ecu_timer_wheel.h"
+#include"../../ecual/Scheduler/ecu_boot_sequencer.h"
+#include"../../ecual/Scheduler/ecu_event.h"
+#include"../../ecual/Trace/ecu_trace.h"
+#include"../../ecual/Sensor_Stats/ecu_sensor_stats.h"
+#include"Smart_Home_telemetry.h"
+#if CONFIG_ENABLE == GPIO_MARKER_CONFIGURATION
+#include"../../ecual/Time_Service/ecu_time.h"
+#endif
 
 
 /********************** Macro Declaration **********************/
@@ -19,9 +31,15 @@
 #define EEPROM1_ADDRESS                 0x50
 #define EEPROM2_ADDRESS                 0x51
 
-#define MAX_TEMP_VAL_ADDRESS            0x00
-#define MIN_TEMP_VAL_ADDRESS            0x01
-#define LAST_TEMP_VAL_ADDRESS           0x02
+/* Temperature summary record , appended to the internal EEPROM log once per hour */
+#define TEMP_LOG_MAX_INDEX              0x00    /* Lifetime max , restored after a reset */
+#define TEMP_LOG_MIN_INDEX              0x01    /* Lifetime min , restored after a reset */
+#define TEMP_LOG_HOUR_MEAN_INDEX        0x02    /* Last hour , rounded mean */
+#define TEMP_LOG_HOUR_MIN_INDEX         0x03
+#define TEMP_LOG_HOUR_MAX_INDEX         0x04
+
+#define TEMP_LOG_START_ADDRESS          0x000
+#define TEMP_LOG_SLOT_COUNT             (DATA_EEPROM_SIZE / EEPROM_LOG_SLOT_SIZE)
 
 #define PASSWORD_FAILED                 0x00
 #define PASSWORD_PASSED                 0x01
@@ -29,6 +47,33 @@
 #define MAX_PASSWORD_ATTEMPT            0x03
 #define MAX_PASSWORD_DIGIT              10
 
+#define CELSIUS_CGRAM_CODE              0x00    /* celsius[] , first glyph of lcd_4bit_load_cgram */
+
+/* smart_home_boot_tasks[] indexes */
+#define SMART_HOME_BOOT_LCD             0x00
+#define SMART_HOME_BOOT_RTC             0x01
+#define SMART_HOME_BOOT_TC74            0x02
+
+#define SMART_HOME_TC74_POLL_MS         10      /* DATA_RDY poll period during boot */
+
+/* Application events (ecu_event) */
+#define SMART_HOME_EVENT_KEY            0x01    /* Keypad event : arg8 = key , arg16 = keypad_event_type_t */
+#define SMART_HOME_EVENT_RTC_SECOND     0x02    /* DS1307 SQW edge , posted by the INT0 handler */
+#define SMART_HOME_EVENT_TEMPERATURE    0x03    /* New TC74 reading : arg8 = temperature (sint8) */
+#define SMART_HOME_EVENT_TEMP_STATS     0x04    /* Statistics window closed : arg8 = SENSOR_STATS_CLOSED() mask */
+
+/* Trace events (EUSART_TX_INTERRUPT_FEATURE_ENABLE) , RTC fields are BCD */
+#define SMART_HOME_TRACE_BOOT           0x10    /* trace: "boot time {a16} ms" */
+#define SMART_HOME_TRACE_DATE           0x11    /* trace: "date 20{hi:02x}/{lo:02x}/{a8:02x}" */
+#define SMART_HOME_TRACE_TIME           0x12    /* trace: "time {hi:02x}:{lo:02x}:{a8:02x}" */
+#define SMART_HOME_TRACE_TEMP           0x13    /* trace: "temperature {s8} C" */
+#define SMART_HOME_TRACE_TEMP_STATS     0x14    /* trace: "temperature 1 min : min {slo} avg {s8} max {shi} C" */
+#define SMART_HOME_TRACE_TEMP_VAR       0x15    /* trace: "temperature 1 min : variance {a16}/256 C2 , {a8} samples" */
+
+/* GPIO marker paths (GPIO_MARKER_CONFIGURATION) , reported every minute */
+#define SMART_HOME_MARKER_PATH_KEY      0x00    /* Debounced press to '*' on the LCD */
+#define SMART_HOME_MARKER_PATH_TEMP     0x01    /* TC74 read (USER0) to command written to the slave */
+
 /********************** Data Types Declaration **********************/
 
 typedef enum{
@@ -37,7 +82,12 @@ typedef enum{
     PASSWORD_CHECK,
     PASSWORD_GRANTED,
     PASSWORD_DENIED,
-    PASSWORD_LOCKED        
+    PASSWORD_RETRY,
+    PASSWORD_LOCKED,
+    PASSWORD_ACCEPTED,
+    PASSWORD_HELLO,         /* Granted : hello message , then PASSWORD_SYSTEM_START */
+    PASSWORD_SYSTEM_START,
+    PASSWORD_WAITING        /* Message shown , Password_Wait timer running */
 }password_state_t;
 
 /********************** Function Declaration **********************/
@@ -0,0 +1,92 @@
+/**
+ * @file    Smart_Home_telemetry.c
+ * @brief   Master / Slave telemetry frames of the Smart Home project
+ *
+ * @details
+ * CRC-8 from ecual/CRC , one byte at a time : the frames sit in volatile
+ * I2C buffers.
+ */
+
+#include "Smart_Home_telemetry.h"
+
+uint8 Telemetry_CRC8(const volatile uint8 *data , uint8 length){
+    uint8 l_crc = CRC8_INIT;
+
+    while(ZERO_INIT != length){
+        l_crc = CRC8_Update(l_crc , *data);
+        data++;
+        length--;
+    }
+    return l_crc;
+}
+
+Std_ReturnType Telemetry_Frame_Pack(const smart_home_telemetry_t *telemetry , volatile uint8 *frame){
+    Std_ReturnType ret = E_OK;
+
+    if((NULL == telemetry) || (NULL == frame)){
+        ret = E_NOT_OK;
+    }
+    else{
+        frame[0] = telemetry->sequence;
+        frame[1] = (uint8)telemetry->temperature;
+        frame[2] = telemetry->setpoint;
+        frame[3] = (uint8)(telemetry->fan_rpm);
+        frame[4] = (uint8)(telemetry->fan_rpm >> 8);
+        frame[5] = telemetry->pwm_duty;
+        frame[6] = telemetry->status;
+        frame[7] = Telemetry_CRC8(frame , TELEMETRY_FRAME_SIZE - 1);
+    }
+    return ret;
+}
+
+Std_ReturnType Telemetry_Frame_Unpack(const volatile uint8 *frame , smart_home_telemetry_t *telemetry){
+    Std_ReturnType ret = E_OK;
+
+    if((NULL == telemetry) || (NULL == frame)){
+        ret = E_NOT_OK;
+    }
+    else if(frame[7] != Telemetry_CRC8(frame , TELEMETRY_FRAME_SIZE - 1)){
+        ret = E_NOT_OK;
+    }
+    else{
+        telemetry->sequence = frame[0];
+        telemetry->temperature = (sint8)frame[1];
+        telemetry->setpoint = frame[2];
+        telemetry->fan_rpm = (uint16)(((uint16)frame[4] << 8) | frame[3]);
+        telemetry->pwm_duty = frame[5];
+        telemetry->status = frame[6];
+    }
+    return ret;
+}
+
+Std_ReturnType Telemetry_Command_Pack(const smart_home_command_t *command , volatile uint8 *frame){
+    Std_ReturnType ret = E_OK;
+
+    if((NULL == command) || (NULL == frame)){
+        ret = E_NOT_OK;
+    }
+    else{
+        frame[0] = command->sequence;
+        frame[1] = (uint8)command->temperature;
+        frame[2] = command->setpoint;
+        frame[3] = Telemetry_CRC8(frame , TELEMETRY_COMMAND_SIZE - 1);
+    }
+    return ret;
+}
+
+Std_ReturnType Telemetry_Command_Unpack(const volatile uint8 *frame , smart_home_command_t *command){
+    Std_ReturnType ret = E_OK;
+
+    if((NULL == command) || (NULL == frame)){
+        ret = E_NOT_OK;
+    }
+    else if(frame[3] != Telemetry_CRC8(frame , TELEMETRY_COMMAND_SIZE - 1)){
+        ret = E_NOT_OK;
+    }
+    else{
+        command->sequence = frame[0];
+        command->temperature = (sint8)frame[1];
+        command->setpoint = frame[2];
+    }
+    return ret;
+}
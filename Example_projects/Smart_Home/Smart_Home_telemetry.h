@@ -0,0 +1,104 @@
+/**
+ * @file    Smart_Home_telemetry.h
+ * @brief   Master / Slave telemetry frames of the Smart Home project
+ *
+ * @details
+ * The Slave MCU serves one I2C register map (MSSP_I2C_Slave_Register_Map_Init) :
+ *
+ * | Register | Frame                         | Direction       |
+ * |----------|-------------------------------|-----------------|
+ * | 0x00     | Telemetry (8 bytes)           | Slave -> Master |
+ * | 0x08     | Command   (4 bytes)           | Master -> Slave |
+ *
+ * Telemetry : seq , temperature , setpoint , rpm (LSB , MSB) , duty , status , CRC-8
+ * Command   : seq , temperature , setpoint , CRC-8
+ *
+ * The master sends one command burst and fetches the whole slave state in
+ * one read burst per cycle. CRC-8 (polynomial 0x07 , init 0x00 , SMBus PEC)
+ * covers every byte before it : a frame torn by a concurrent update or
+ * corrupted on the bus is rejected and read again on the next cycle.
+ */
+
+#ifndef SMART_HOME_TELEMETRY_H
+#define	SMART_HOME_TELEMETRY_H
+
+/********************** Includes **********************/
+#include"../../common/std_types.h"
+#include"../../ecual/CRC/ecu_crc.h"
+
+/********************** Macro Declaration **********************/
+
+/* Slave register map layout */
+#define TELEMETRY_FRAME_REGISTER        0x00
+#define TELEMETRY_FRAME_SIZE            8
+#define TELEMETRY_COMMAND_REGISTER      (TELEMETRY_FRAME_REGISTER + TELEMETRY_FRAME_SIZE)
+#define TELEMETRY_COMMAND_SIZE          4
+#define TELEMETRY_MAP_SIZE              (TELEMETRY_FRAME_SIZE + TELEMETRY_COMMAND_SIZE)
+
+/* Status flags of the telemetry frame */
+#define TELEMETRY_STATUS_FAN_ON         0x01
+#define TELEMETRY_STATUS_FAN_FORWARD    0x02
+#define TELEMETRY_STATUS_ALARM          0x04    /* Temperature at or above the setpoint */
+#define TELEMETRY_STATUS_COMMAND_ERROR  0x08    /* Last command frame failed its CRC */
+
+/* Alarm setpoint used until the first valid command */
+#define TELEMETRY_DEFAULT_SETPOINT      50
+
+/********************** Data Type Declarations **********************/
+
+/**
+ * @brief Slave state , read by the master in one burst
+ */
+typedef struct{
+    uint8  sequence ;           /* Incremented by the slave on every frame update */
+    sint8  temperature ;        /* Last temperature applied , degrees C */
+    uint8  setpoint ;           /* Alarm threshold , degrees C */
+    uint16 fan_rpm ;            /* 0 when the node has no tachometer */
+    uint8  pwm_duty ;           /* Fan duty , percent */
+    uint8  status ;             /* TELEMETRY_STATUS_xxx */
+}smart_home_telemetry_t;
+
+/**
+ * @brief Master command , written to the slave in one burst
+ */
+typedef struct{
+    uint8  sequence ;           /* Incremented by the master on every command */
+    sint8  temperature ;
+    uint8  setpoint ;
+}smart_home_command_t;
+
+/********************** Function Declarations **********************/
+
+/**
+ * @brief CRC-8 , polynomial 0x07 , init 0x00
+ * @param data   Bytes to cover
+ * @param length Number of bytes
+ * @return CRC of the bytes
+ */
+uint8 Telemetry_CRC8(const volatile uint8 *data , uint8 length);
+
+/**
+ * @brief Serialize a telemetry frame with its CRC
+ * @return Std_ReturnType (E_OK / E_NOT_OK on null pointer)
+ */
+Std_ReturnType Telemetry_Frame_Pack(const smart_home_telemetry_t *telemetry , volatile uint8 *frame);
+
+/**
+ * @brief Check the CRC of a telemetry frame and decode it
+ * @return Std_ReturnType (E_OK / E_NOT_OK on null pointer or CRC mismatch , telemetry untouched)
+ */
+Std_ReturnType Telemetry_Frame_Unpack(const volatile uint8 *frame , smart_home_telemetry_t *telemetry);
+
+/**
+ * @brief Serialize a command frame with its CRC
+ * @return Std_ReturnType (E_OK / E_NOT_OK on null pointer)
+ */
+Std_ReturnType Telemetry_Command_Pack(const smart_home_command_t *command , volatile uint8 *frame);
+
+/**
+ * @brief Check the CRC of a command frame and decode it
+ * @return Std_ReturnType (E_OK / E_NOT_OK on null pointer or CRC mismatch , command untouched)
+ */
+Std_ReturnType Telemetry_Command_Unpack(const volatile uint8 *frame , smart_home_command_t *command);
+
+#endif	/* SMART_HOME_TELEMETRY_H */
@@ -52,6 +52,10 @@ int main() {
     Led_Blink_app();
 #endif   
     
+#if     BENCHMARK_APP == WORKING_APPLICATION            /* @ APPLICATION_H file */ 
+    Benchmark_app();
+#endif   
+    
     while(1){
         
     }
@@ -60,6 +64,10 @@ int main() {
 
 void application_initialize(void){
     Std_ReturnType ret = E_NOT_OK;
+    
+    /* Interrupts masked and priority map applied before any peripheral init ,
+       each application enables them once its peripherals are initialized */
+    ret = Interrupt_Manager_Init();
 
 }
   
@@ -48,6 +48,7 @@
 /* Both in the Smart Home Project */
 #include"Example_projects/Smart_Home/Smart_Home_app.h"
 #include "Example_projects/Smart_Home/Slave_MCU/Slave_MCU_main_app.h"
+#include"Example_projects/Benchmark/Benchmark_app.h"
 
 /* Section: Macro Declarations */
 
@@ -60,6 +61,15 @@
 #define CHR_LCD_APP                         NOT_WORKING_APPLICATION
 #define LED_BLINK_APP                       NOT_WORKING_APPLICATION
 #define LED_BLINK_HAL_APP                   NOT_WORKING_APPLICATION
+#define BENCHMARK_APP                       NOT_WORKING_APPLICATION
+
+#if (BENCHMARK_APP == WORKING_APPLICATION) && (TIMER1_INTERRUPT_FEATURE_ENABLE != INTERRUPT_FEATURE_ENABLE)
+#error "BENCHMARK_APP needs TIMER1_INTERRUPT_FEATURE_ENABLE (32-bit cycle count)"
+#endif
+
+#if (SEVEN_SEGMENT_APP == WORKING_APPLICATION) && (TIMER2_INTERRUPT_FEATURE_ENABLE != INTERRUPT_FEATURE_ENABLE)
+#error "SEVEN_SEGMENT_APP needs TIMER2_INTERRUPT_FEATURE_ENABLE (multiplexing tick)"
+#endif
 
 /* Section: Macro Functions Declarations */
 
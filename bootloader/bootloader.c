@@ -0,0 +1,386 @@
+/*
+ * @file    bootloader.c
+ * @brief   UART / RS-485 serial bootloader implementation
+ *
+ * @details
+ * Polled EUSART , interrupts stay off. Block payloads are received
+ * straight into the window buffer they will be programmed from and the
+ * CRC is updated per byte (ecu_crc nibble table , ~30 cycles) , so a byte is
+ * handled well within its 87 us at 115200 baud and back-to-back frames
+ * never overrun the 2-byte receive FIFO.
+ *
+ * Layer: Bootloader
+ * Target MCU: PIC18F4620
+ *
+ * Author: Abdelmoniem Ahmed
+ * Linkedin: https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * Date: 2026
+ */
+
+#include "bootloader.h"
+
+/* Sequence distance below it is a gap , above it a block already taken */
+#define BOOTLOADER_SEQUENCE_HALF            0x80
+
+/* Section : Data Types Declarations */
+
+typedef struct{
+    uint16 row ;
+    uint8 data[FLASH_ROW_SIZE] ;
+}bootloader_block_t;
+
+/* Section : Static Variables */
+
+static usart_t boot_usart = {
+    .baudrate = BOOTLOADER_BAUDRATE ,
+    .baudrate_cfg = BAUDRATE_ASYNC_16BIT_HIGH_SPEED ,
+    .usart_tx_cfg.usart_tx_enable = EUSART_ASYNCHRONOUS_TX_ENABLE ,
+    .usart_tx_cfg.usart_tx_interrupt_enable = EUSART_ASYNCHRONOUS_INTERRUPT_TX_DISABLE ,
+    .usart_rx_cfg.usart_rx_enable = EUSART_ASYNCHRONOUS_RX_ENABLE ,
+    .usart_rx_cfg.usart_rx_interrupt_enable = EUSART_ASYNCHRONOUS_INTERRUPT_RX_DISABLE
+};
+
+#if BOOTLOADER_RS485_DE_CFG == BOOTLOADER_RS485_DE_ENABLE
+static pin_config_t boot_de_pin = {
+    .port = BOOTLOADER_RS485_DE_PORT ,
+    .pin = BOOTLOADER_RS485_DE_PIN ,
+    .direction = GPIO_DIRECTION_OUTPUT ,
+    .logic = GPIO_PIN_LOW
+};
+#endif
+
+static bootloader_block_t boot_window[BOOTLOADER_WINDOW_BLOCKS];
+static uint8 boot_window_count = ZERO_INIT;
+static uint8 boot_window_status = BOOTLOADER_STATUS_OK;
+static uint8 boot_next_sequence = ZERO_INIT;       /* Counts the buffered blocks too */
+
+/* Reset vector row , held back until RUN */
+static uint8 boot_reset_row[FLASH_ROW_SIZE];
+static uint8 boot_reset_row_pending = FALSE;
+
+/* Reset vector row read back by Bootloader_Check_Application */
+static uint8 boot_row_buffer[FLASH_ROW_SIZE];
+
+/* Section : Static Function Declarations */
+
+static Std_ReturnType bootloader_read_byte(uint8 *data , uint32 timeout_us);
+static Std_ReturnType bootloader_receive_frame(uint16 timeout_ms , uint8 *header);
+static void bootloader_accept_block(uint8 sequence , uint16 row);
+static uint8 bootloader_program_row(uint16 row , const uint8 *data);
+static uint8 bootloader_program_window(void);
+static uint8 bootloader_erase(uint16 row_count);
+static uint8 bootloader_run(void);
+static void bootloader_reply(uint8 status);
+
+/* Section : Function Definitions */
+
+Std_ReturnType Bootloader_Init(void){
+    Std_ReturnType ret = E_OK;
+
+#if BOOTLOADER_RS485_DE_CFG == BOOTLOADER_RS485_DE_ENABLE
+    ret = gpio_pin_initialize(&boot_de_pin);
+#endif
+    ret &= EUSART_ASYNC_Init(&boot_usart);
+    return ret;
+}
+
+Std_ReturnType Bootloader_Check_Application(uint8 *app_valid){
+    Std_ReturnType ret = E_OK;
+    uint8 l_index = ZERO_INIT;
+
+    if(NULL == app_valid){
+        ret = E_NOT_OK;
+    }
+    else{
+        *app_valid = FALSE;
+        ret = Flash_Read_Block(BOOTLOADER_APP_START , boot_row_buffer , FLASH_ROW_SIZE);
+        for(l_index = ZERO_INIT ; l_index < FLASH_ROW_SIZE ; l_index++){
+            if(FLASH_ERASED_BYTE != boot_row_buffer[l_index]){
+                *app_valid = TRUE;
+            }
+            else{ /* Nothing */ }
+        }
+    }
+    return ret;
+}
+
+Std_ReturnType Bootloader_Process(uint16 timeout_ms , uint8 *run_requested){
+    Std_ReturnType ret = E_OK;
+    uint8 l_header[BOOTLOADER_HEADER_SIZE];
+    uint8 l_status = BOOTLOADER_STATUS_OK;
+    uint16 l_argument = ZERO_INIT;
+
+    if(NULL == run_requested){
+        ret = E_NOT_OK;
+    }
+    else{
+        ret = bootloader_receive_frame(timeout_ms , l_header);
+        if(E_OK == ret){
+            l_argument = (uint16)(((uint16)l_header[2] << 8) | l_header[3]);
+            switch(l_header[0]){
+                case BOOTLOADER_CMD_INFO :
+                    bootloader_reply(BOOTLOADER_STATUS_OK);
+                    break;
+                case BOOTLOADER_CMD_ERASE :
+                    l_status = bootloader_erase(l_argument);
+                    /* The host numbers the blocks of the new image from here */
+                    boot_next_sequence = l_header[1];
+                    bootloader_reply(l_status);
+                    break;
+                case BOOTLOADER_CMD_BLOCK :
+                    bootloader_accept_block(l_header[1] , l_argument);
+                    break;
+                case BOOTLOADER_CMD_BLOCK_SYNC :
+                    bootloader_accept_block(l_header[1] , l_argument);
+                    bootloader_reply(bootloader_program_window());
+                    break;
+                case BOOTLOADER_CMD_RUN :
+                    l_status = bootloader_run();
+                    bootloader_reply(l_status);
+                    *run_requested = (BOOTLOADER_STATUS_OK == l_status) ? TRUE : FALSE;
+                    break;
+                default :
+                    bootloader_reply(BOOTLOADER_STATUS_COMMAND);
+                    break;
+            }
+        }
+        else{ /* Timeout or broken frame , the host resends */ }
+    }
+    return ret;
+}
+
+void Bootloader_Start_Application(void){
+    uint8 l_tx_idle = FALSE;
+
+    /* The RUN reply leaves before SPEN drops */
+    do{
+        (void)EUSART_ASYNC_TX_Is_Idle(&l_tx_idle);
+    }while(FALSE == l_tx_idle);
+    (void)EUSART_ASYNC_DeInit(&boot_usart);
+    asm("goto " ___mkstr(BOOTLOADER_APP_START));
+}
+
+/* Section : Static Function Definitions */
+
+/**
+ * @brief Poll the receiver until a byte arrives or timeout_us elapsed
+ */
+static Std_ReturnType bootloader_read_byte(uint8 *data , uint32 timeout_us){
+    Std_ReturnType ret = EUSART_ASYNC_Read_Byte_Polled(data);
+    uint32 l_waited = ZERO_INIT;
+
+    while((E_OK != ret) && (l_waited < timeout_us)){
+        __delay_us(BOOTLOADER_POLL_US);
+        l_waited += BOOTLOADER_POLL_US;
+        ret = EUSART_ASYNC_Read_Byte_Polled(data);
+    }
+    return ret;
+}
+
+/**
+ * @brief Receive one frame , block payloads land in the next window slot
+ *
+ * @param header Command , sequence , argument high , argument low
+ */
+static Std_ReturnType bootloader_receive_frame(uint16 timeout_ms , uint8 *header){
+    Std_ReturnType ret = E_OK;
+    uint16 l_crc = CRC16_CCITT_INIT;
+    uint8 *l_payload = NULL;
+    uint8 l_byte = ZERO_INIT;
+    uint8 l_index = ZERO_INIT;
+    uint8 l_started = FALSE;
+
+    /* Hunt for the sync byte , line noise is skipped */
+    do{
+        ret = bootloader_read_byte(&l_byte , (uint32)timeout_ms * 1000UL);
+    }while((E_OK == ret) && (BOOTLOADER_FRAME_SYNC != l_byte));
+    l_started = (E_OK == ret) ? TRUE : FALSE;
+
+    for(l_index = ZERO_INIT ; (E_OK == ret) && (l_index < BOOTLOADER_HEADER_SIZE) ; l_index++){
+        ret = bootloader_read_byte(&header[l_index] , BOOTLOADER_BYTE_TIMEOUT_US);
+        l_crc = CRC16_Update(l_crc , header[l_index]);
+    }
+
+    if((E_OK == ret) && ((BOOTLOADER_CMD_BLOCK == header[0]) || (BOOTLOADER_CMD_BLOCK_SYNC == header[0]))){
+        /* A full window still takes the bytes , they are only not stored */
+        l_payload = (boot_window_count < BOOTLOADER_WINDOW_BLOCKS) ? boot_window[boot_window_count].data : NULL;
+        for(l_index = ZERO_INIT ; (E_OK == ret) && (l_index < FLASH_ROW_SIZE) ; l_index++){
+            ret = bootloader_read_byte(&l_byte , BOOTLOADER_BYTE_TIMEOUT_US);
+            l_crc = CRC16_Update(l_crc , l_byte);
+            if(NULL != l_payload){
+                l_payload[l_index] = l_byte;
+            }
+            else{ /* Nothing */ }
+        }
+    }
+    else{ /* No payload */ }
+
+    /* CRC high then low , run through the CRC the remainder is zero */
+    for(l_index = ZERO_INIT ; (E_OK == ret) && (l_index < 2) ; l_index++){
+        ret = bootloader_read_byte(&l_byte , BOOTLOADER_BYTE_TIMEOUT_US);
+        l_crc = CRC16_Update(l_crc , l_byte);
+    }
+    if((E_OK == ret) && (ZERO_INIT != l_crc)){
+        ret = E_NOT_OK;
+    }
+    else{ /* Nothing */ }
+
+    if((E_NOT_OK == ret) && (TRUE == l_started)){
+        /* A frame was started and lost , maybe a block of the window */
+        boot_window_status = BOOTLOADER_STATUS_FRAME;
+    }
+    else{ /* Nothing */ }
+    return ret;
+}
+
+/**
+ * @brief Keep the block just received when it is the next one expected
+ */
+static void bootloader_accept_block(uint8 sequence , uint16 row){
+    uint8 l_distance = (uint8)(sequence - boot_next_sequence);
+
+    if(ZERO_INIT == l_distance){
+        if(boot_window_count < BOOTLOADER_WINDOW_BLOCKS){
+            boot_window[boot_window_count].row = row;
+            boot_window_count++;
+            boot_next_sequence++;
+        }
+        else{
+            /* The host sent more than one window */
+            boot_window_status = BOOTLOADER_STATUS_FRAME;
+        }
+    }
+    else if(l_distance < BOOTLOADER_SEQUENCE_HALF){
+        /* Blocks before this one were lost */
+        boot_window_status = BOOTLOADER_STATUS_FRAME;
+    }
+    else{ /* Resent block , already buffered or programmed */ }
+}
+
+/**
+ * @brief Program and verify one row , rows cleared by ERASE skip the erase cycle
+ */
+static uint8 bootloader_program_row(uint16 row , const uint8 *data){
+    uint8 l_status = BOOTLOADER_STATUS_OK;
+
+    if((BOOTLOADER_APP_FIRST_ROW > row) || (FLASH_ROW_COUNT <= row)){
+        l_status = BOOTLOADER_STATUS_RANGE;
+    }
+    else if(E_OK != Flash_Write_Block((uint32)row * FLASH_ROW_SIZE , data , FLASH_ROW_SIZE)){
+        l_status = BOOTLOADER_STATUS_VERIFY;
+    }
+    else{ /* Nothing */ }
+    return l_status;
+}
+
+/**
+ * @brief Program the buffered blocks in order , once the host has stopped sending
+ *
+ * @return First programming error , else the window receive status
+ */
+static uint8 bootloader_program_window(void){
+    uint8 l_status = BOOTLOADER_STATUS_OK;
+    uint8 l_programmed = ZERO_INIT;
+    bootloader_block_t *l_block = NULL;
+
+    while((BOOTLOADER_STATUS_OK == l_status) && (l_programmed < boot_window_count)){
+        l_block = &boot_window[l_programmed];
+        if(BOOTLOADER_APP_FIRST_ROW == l_block->row){
+            memcpy(boot_reset_row , l_block->data , FLASH_ROW_SIZE);
+            boot_reset_row_pending = TRUE;
+        }
+        else{
+            l_status = bootloader_program_row(l_block->row , l_block->data);
+        }
+        if(BOOTLOADER_STATUS_OK == l_status){
+            l_programmed++;
+        }
+        else{ /* The reply points the host at this block */ }
+    }
+    boot_next_sequence = (uint8)(boot_next_sequence - boot_window_count + l_programmed);
+    if(BOOTLOADER_STATUS_OK == l_status){
+        l_status = boot_window_status;
+    }
+    else{ /* Nothing */ }
+    boot_window_count = ZERO_INIT;
+    boot_window_status = BOOTLOADER_STATUS_OK;
+    return l_status;
+}
+
+/**
+ * @brief Erase row_count application rows (0 = up to the end of the flash) ,
+ *        the reset vector row first
+ */
+static uint8 bootloader_erase(uint16 row_count){
+    uint8 l_status = BOOTLOADER_STATUS_OK;
+
+    if((ZERO_INIT == row_count) || ((FLASH_ROW_COUNT - BOOTLOADER_APP_FIRST_ROW) < row_count)){
+        row_count = (uint16)(FLASH_ROW_COUNT - BOOTLOADER_APP_FIRST_ROW);
+    }
+    else{ /* Nothing */ }
+    /* Blank rows are skipped , the erase of a small image stays short */
+    if(E_OK != Flash_Erase_Block(BOOTLOADER_APP_START , row_count)){
+        l_status = BOOTLOADER_STATUS_VERIFY;
+    }
+    else{ /* Nothing */ }
+    boot_window_count = ZERO_INIT;
+    boot_window_status = BOOTLOADER_STATUS_OK;
+    boot_reset_row_pending = FALSE;
+    return l_status;
+}
+
+/**
+ * @brief Write the held back reset vector row , the image is complete
+ */
+static uint8 bootloader_run(void){
+    uint8 l_status = BOOTLOADER_STATUS_OK;
+    uint8 l_app_valid = FALSE;
+
+    if(TRUE == boot_reset_row_pending){
+        l_status = bootloader_program_row(BOOTLOADER_APP_FIRST_ROW , boot_reset_row);
+        boot_reset_row_pending = (BOOTLOADER_STATUS_OK == l_status) ? FALSE : TRUE;
+    }
+    else{ /* Application already complete , RUN just starts it */ }
+    if(BOOTLOADER_STATUS_OK == l_status){
+        (void)Bootloader_Check_Application(&l_app_valid);
+        l_status = (TRUE == l_app_valid) ? BOOTLOADER_STATUS_OK : BOOTLOADER_STATUS_NO_APP;
+    }
+    else{ /* Nothing */ }
+    /* Blocks of an unfinished window are dropped */
+    boot_window_count = ZERO_INIT;
+    return l_status;
+}
+
+static void bootloader_reply(uint8 status){
+    uint8 l_reply[BOOTLOADER_REPLY_SIZE];
+    uint16 l_crc = CRC16_CCITT_INIT;
+    uint8 l_index = ZERO_INIT;
+#if BOOTLOADER_RS485_DE_CFG == BOOTLOADER_RS485_DE_ENABLE
+    uint8 l_tx_idle = FALSE;
+#endif
+
+    l_reply[0] = BOOTLOADER_REPLY_SYNC;
+    l_reply[1] = status;
+    l_reply[2] = boot_next_sequence;
+    l_reply[3] = BOOTLOADER_VERSION;
+    l_reply[4] = BOOTLOADER_WINDOW_BLOCKS;
+    l_reply[5] = (uint8)(BOOTLOADER_APP_FIRST_ROW >> 8);
+    l_reply[6] = (uint8)BOOTLOADER_APP_FIRST_ROW;
+    for(l_index = 1 ; l_index < (BOOTLOADER_REPLY_SIZE - 2) ; l_index++){
+        l_crc = CRC16_Update(l_crc , l_reply[l_index]);
+    }
+    l_reply[BOOTLOADER_REPLY_SIZE - 2] = (uint8)(l_crc >> 8);
+    l_reply[BOOTLOADER_REPLY_SIZE - 1] = (uint8)l_crc;
+
+#if BOOTLOADER_RS485_DE_CFG == BOOTLOADER_RS485_DE_ENABLE
+    (void)gpio_pin_write_logic(&boot_de_pin , GPIO_PIN_HIGH);
+#endif
+    (void)EUSART_ASYNC_Write_String_Blocking(l_reply , BOOTLOADER_REPLY_SIZE);
+#if BOOTLOADER_RS485_DE_CFG == BOOTLOADER_RS485_DE_ENABLE
+    /* Release the bus after the stop bit of the last byte */
+    do{
+        (void)EUSART_ASYNC_TX_Is_Idle(&l_tx_idle);
+    }while(FALSE == l_tx_idle);
+    (void)gpio_pin_write_logic(&boot_de_pin , GPIO_PIN_LOW);
+#endif
+}
@@ -0,0 +1,144 @@
+/*
+ * @file    bootloader.h
+ * @brief   UART / RS-485 serial bootloader with windowed row streaming
+ *
+ * @details
+ * Lives in the boot block (0x0000 - BOOTLOADER_APP_START - 1) and
+ * programs the application above it , one 64-byte flash row per block.
+ *
+ * Host -> bootloader frame :
+ *  - 0x55 , command , sequence , argument (2 , big endian)
+ *  - 64 data bytes (BLOCK / BLOCK_SYNC only)
+ *  - CRC-16-CCITT (2 , big endian) over command .. data , init 0xFFFF
+ *
+ * Bootloader -> host reply (BOOTLOADER_REPLY_SIZE bytes) :
+ *  - 0xAA , status , next expected sequence , version , window ,
+ *    first application row (2) , CRC-16-CCITT over status .. row
+ *
+ * Window : the host sends up to BOOTLOADER_WINDOW_BLOCKS blocks back to
+ * back , the last as BLOCK_SYNC. They are received straight into the
+ * window buffers , then all rows are programmed in one go and one reply
+ * acknowledges them (go-back-N : the host resends from the sequence in
+ * the reply). The PIC18 stalls during a flash cycle and its receiver
+ * only holds 2 bytes , so no row is programmed while the link is
+ * sending ; one line turnaround per window instead of per block keeps
+ * the half-duplex RS-485 link busy.
+ *
+ * The row holding the application reset vector is written last , by
+ * RUN : an update cut short leaves no valid application and the
+ * bootloader keeps control on the next reset.
+ *
+ * Layer: Bootloader
+ * Target MCU: PIC18F4620
+ *
+ * Author: Abdelmoniem Ahmed
+ * Linkedin: https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * Date: 2026
+ */
+
+#ifndef BOOTLOADER_H
+#define	BOOTLOADER_H
+
+/* Section : Includes */
+#include"../mcal/EUSART/hal_eusart.h"
+#include"../mcal/Flash/hal_flash.h"
+#include"../mcal/GPIO/hal_gpio.h"
+#include"../ecual/CRC/ecu_crc.h"
+
+/* Section : Macro Declaration */
+
+#define BOOTLOADER_VERSION                  0x01
+
+/* Link speed , 117647 baud real at 8 MHz (BRG16 , BRGH , +2.1 %) */
+#define BOOTLOADER_BAUDRATE                 115200UL
+
+/* First application address : end of the 2 KB boot block (WRTB / CPB).
+ * Plain literals , the vector redirection pastes them into asm() */
+#define BOOTLOADER_APP_START                0x0800
+#define BOOTLOADER_APP_HIGH_VECTOR          0x0808
+#define BOOTLOADER_APP_LOW_VECTOR           0x0818
+
+#if (BOOTLOADER_APP_START % FLASH_ROW_SIZE) || \
+    (BOOTLOADER_APP_HIGH_VECTOR != (BOOTLOADER_APP_START + 0x08)) || \
+    (BOOTLOADER_APP_LOW_VECTOR != (BOOTLOADER_APP_START + 0x18))
+#error "BOOTLOADER_APP_START must be row aligned , the vectors 0x08 / 0x18 above it"
+#endif
+
+#define BOOTLOADER_APP_FIRST_ROW            ((uint16)(BOOTLOADER_APP_START / FLASH_ROW_SIZE))
+
+/* Blocks programmed per acknowledge , 8 x 66 bytes of RAM */
+#define BOOTLOADER_WINDOW_BLOCKS            8
+
+/* After reset with a valid application : time given to the host to say INFO */
+#define BOOTLOADER_ENTRY_WINDOW_MS          250
+
+/* A frame whose bytes stop for this long is dropped */
+#define BOOTLOADER_BYTE_TIMEOUT_US          2000
+
+/* Receiver poll period , well below one byte time (87 us at 115200) */
+#define BOOTLOADER_POLL_US                  10
+
+/* RS-485 driver enable , high while the bootloader transmits */
+#define BOOTLOADER_RS485_DE_ENABLE          1
+#define BOOTLOADER_RS485_DE_DISABLE         0
+#define BOOTLOADER_RS485_DE_CFG             BOOTLOADER_RS485_DE_DISABLE
+#define BOOTLOADER_RS485_DE_PORT            PORTC_INDEX
+#define BOOTLOADER_RS485_DE_PIN             PIN5
+
+/* Frame layout */
+#define BOOTLOADER_FRAME_SYNC               0x55
+#define BOOTLOADER_REPLY_SYNC               0xAA
+#define BOOTLOADER_HEADER_SIZE              4       /* command , sequence , argument */
+#define BOOTLOADER_REPLY_SIZE               9
+
+/* Commands */
+#define BOOTLOADER_CMD_INFO                 'I'     /* Reply only                                   */
+#define BOOTLOADER_CMD_ERASE                'E'     /* Erase argument rows from the first (0 = all) */
+#define BOOTLOADER_CMD_BLOCK                'B'     /* Row argument , 64 bytes , no reply          */
+#define BOOTLOADER_CMD_BLOCK_SYNC           'S'     /* Same , then program the window and reply    */
+#define BOOTLOADER_CMD_RUN                  'R'     /* Write the reset vector row , reply , start  */
+
+/* Reply status */
+#define BOOTLOADER_STATUS_OK                0x00
+#define BOOTLOADER_STATUS_FRAME             0x01    /* Window block lost (CRC , gap or overflow)   */
+#define BOOTLOADER_STATUS_RANGE             0x02    /* Row in the boot block or beyond the flash   */
+#define BOOTLOADER_STATUS_VERIFY            0x03    /* Flash read back differs                     */
+#define BOOTLOADER_STATUS_NO_APP            0x04    /* RUN without an application reset vector     */
+#define BOOTLOADER_STATUS_COMMAND           0x05    /* Unknown command                             */
+
+/* Section : Function Declarations */
+
+/**
+ * @brief Start the EUSART at BOOTLOADER_BAUDRATE , polled , interrupts off
+ *
+ * @return E_OK , E_NOT_OK when the baud rate is out of tolerance
+ */
+Std_ReturnType Bootloader_Init(void);
+
+/**
+ * @brief Tell whether an application is programmed
+ *
+ * @param app_valid TRUE when the reset vector row is not erased
+ *
+ * @return E_OK , E_NOT_OK on null pointer
+ */
+Std_ReturnType Bootloader_Check_Application(uint8 *app_valid);
+
+/**
+ * @brief Wait for one frame , execute it and reply when the command asks for it
+ *
+ * @param timeout_ms    Time allowed for the frame to start
+ * @param run_requested Set TRUE once RUN succeeded , the caller then
+ *                      calls Bootloader_Start_Application()
+ *
+ * @return E_OK when a frame was handled , E_NOT_OK on timeout , broken
+ *         frame or null pointer
+ */
+Std_ReturnType Bootloader_Process(uint16 timeout_ms , uint8 *run_requested);
+
+/**
+ * @brief Release the EUSART and jump to BOOTLOADER_APP_START , does not return
+ */
+void Bootloader_Start_Application(void);
+
+#endif	/* BOOTLOADER_H */
@@ -0,0 +1,46 @@
+/*
+ * @file    bootloader_main.c
+ * @brief   Bootloader entry point and interrupt vector redirection
+ *
+ * @details
+ * Built as its own MPLAB X project at address 0 (see README.md). After a
+ * reset a valid application gets BOOTLOADER_ENTRY_WINDOW_MS for the host
+ * to say INFO , otherwise it is started. Without an application the
+ * bootloader waits for the host forever.
+ *
+ * Layer: Bootloader
+ * Target MCU: PIC18F4620
+ *
+ * Author: Abdelmoniem Ahmed
+ * Linkedin: https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * Date: 2026
+ */
+
+#include "bootloader.h"
+
+/* The bootloader runs with interrupts off , the vectors belong to the
+ * application linked with --codeoffset=BOOTLOADER_APP_START */
+asm("PSECT intcode");
+asm("goto " ___mkstr(BOOTLOADER_APP_HIGH_VECTOR));
+asm("PSECT intcodelo");
+asm("goto " ___mkstr(BOOTLOADER_APP_LOW_VECTOR));
+
+int main(void){
+    Std_ReturnType ret = E_NOT_OK;
+    uint8 l_app_valid = FALSE;
+    uint8 l_run = FALSE;
+
+    ret = Bootloader_Init();
+    ret = Bootloader_Check_Application(&l_app_valid);
+    if(TRUE == l_app_valid){
+        /* Silence during the entry window starts the application */
+        l_run = (E_OK == Bootloader_Process(BOOTLOADER_ENTRY_WINDOW_MS , &l_run)) ? l_run : TRUE;
+    }
+    else{ /* Nothing to start */ }
+
+    while(FALSE == l_run){
+        (void)Bootloader_Process(BOOTLOADER_ENTRY_WINDOW_MS , &l_run);
+    }
+    Bootloader_Start_Application();
+    return (EXIT_SUCCESS);
+}
@@ -0,0 +1,29 @@
+/**
+ * @file report_format.c
+ * @brief -> Text line helpers shared by the diagnostic reports
+ * @author Abdelmoniem Ahmed
+ * @linkedin <- https://www.linkedin.com/in/abdelmoniem-ahmed/ ->
+ */
+
+#include"report_format.h"
+
+uint8 report_append_text(uint8 *line , uint8 size , uint8 index , const uint8 *text){
+    while(('\0' != *text) && (size > index)){
+        line[index] = *text;
+        index++;
+        text++;
+    }
+    return index;
+}
+
+uint8 report_append_hex(uint8 *line , uint8 size , uint8 index , uint32 value , uint8 digits){
+    uint8 l_nibble = ZERO_INIT;
+
+    while((ZERO_INIT != digits) && (size > index)){
+        digits--;
+        l_nibble = (uint8)((value >> (digits * 4)) & 0x0F);
+        line[index] = (uint8)((10 > l_nibble) ? (l_nibble + '0') : (l_nibble - 10 + 'A'));
+        index++;
+    }
+    return index;
+}
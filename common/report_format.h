@@ -0,0 +1,56 @@
+/**
+ * @file report_format.h
+ * @brief  -> Text line helpers shared by the diagnostic reports
+ * @author Abdelmoniem Ahmed
+ * @linkedin <- https://www.linkedin.com/in/abdelmoniem-ahmed/ ->
+ *
+ * @details
+ * The instrumentation , profiler , stack monitor and GPIO marker reports
+ * build each line in a local buffer and hand it to a caller write
+ * function. The helpers append at index and return the new index , so
+ * calls chain :
+ *
+ *     l_index = report_append_text(l_line , LINE_SIZE , ZERO_INIT , (const uint8 *)"n=");
+ *     l_index = report_append_hex(l_line , LINE_SIZE , l_index , count , 4);
+ *
+ * A full line truncates what does not fit , the index never passes size.
+ * No terminating '\0' is written , the length is the returned index.
+ */
+
+#ifndef REPORT_FORMAT_H
+#define	REPORT_FORMAT_H
+
+/* Section : Includes */
+
+#include "std_types.h"
+
+/* Section : Macro Declaration */
+
+/* Section : Macro Functions Declarations */
+
+/* Section : Data Types Declarations */
+
+/* Section : Function Declarations */
+
+/**
+ * @brief Append a '\0' terminated string
+ * @param line  Line buffer
+ * @param size  Size of the line buffer
+ * @param index Position of the first appended character
+ * @param text  String to copy , without its '\0'
+ * @return Index after the last appended character
+ */
+uint8 report_append_text(uint8 *line , uint8 size , uint8 index , const uint8 *text);
+
+/**
+ * @brief Append a value as fixed-width upper case hexadecimal
+ * @param line   Line buffer
+ * @param size   Size of the line buffer
+ * @param index  Position of the first appended digit
+ * @param value  Value to print
+ * @param digits Number of digits (1 .. 8) , upper nibbles are dropped
+ * @return Index after the last appended digit
+ */
+uint8 report_append_hex(uint8 *line , uint8 size , uint8 index , uint32 value , uint8 digits);
+
+#endif	/* REPORT_FORMAT_H */
@@ -0,0 +1,74 @@
+/**
+ * @file spsc_queue.h
+ * @brief  -> Lock-free single-producer / single-consumer queue for ISR to main hand-offs
+ * @author Abdelmoniem Ahmed
+ * @linkedin <- https://www.linkedin.com/in/abdelmoniem-ahmed/ ->
+ *
+ * @details
+ * A queue is a struct of two free-running single-byte indices and a
+ * power-of-two item array , declared with SPSC_QUEUE_TYPE() :
+ *
+ *     static SPSC_QUEUE_TYPE(uint8 , 64) rx_queue ;            bytes
+ *     SPSC_QUEUE_TYPE(keypad_event_t , 8) event_queue ;        records , as a struct member
+ *
+ * Only the producer writes head , only the consumer writes tail. Each is a
+ * single byte , so its load or store is atomic on the 8-bit core and no
+ * side needs a critical section :
+ *  - producer : check SPSC_QUEUE_IS_FULL() , fill SPSC_QUEUE_BACK() ,
+ *               then SPSC_QUEUE_PUBLISH() makes the item visible
+ *  - consumer : check SPSC_QUEUE_IS_EMPTY() , read SPSC_QUEUE_FRONT() ,
+ *               then SPSC_QUEUE_RELEASE() hands the slot back
+ *
+ * The producer can fill several slots with SPSC_QUEUE_SLOT() and publish
+ * them with one SPSC_QUEUE_PUBLISH(_Q , count) , the consumer never sees
+ * half of a frame. head - tail is the fill level at any wrap , which is
+ * why the capacity is a power of two , 128 at most.
+ */
+
+#ifndef SPSC_QUEUE_H
+#define	SPSC_QUEUE_H
+
+/* Section : Includes */
+
+#include "std_types.h"
+
+/* Section : Macro Declaration */
+
+/* Use in #if : TRUE when _SIZE is a power of two from 2 to 128 */
+#define SPSC_QUEUE_SIZE_VALID(_SIZE)        (((_SIZE) >= 2) && ((_SIZE) <= 128) && (0 == ((_SIZE) & ((_SIZE) - 1))))
+
+/* Section : Macro Functions Declarations */
+
+/* Anonymous queue type of _SIZE items of _TYPE , zero (empty) when static */
+#define SPSC_QUEUE_TYPE(_TYPE , _SIZE)      struct{ volatile uint8 head ; volatile uint8 tail ; _TYPE items[_SIZE] ; }
+
+#define SPSC_QUEUE_CAPACITY(_Q)             ((uint8)(sizeof((_Q).items) / sizeof((_Q).items[0])))
+#define SPSC_QUEUE_MASK(_Q)                 ((uint8)(SPSC_QUEUE_CAPACITY(_Q) - 1))
+
+/* Fill level , exact for the caller's own side , conservative for the other */
+#define SPSC_QUEUE_USED(_Q)                 ((uint8)((_Q).head - (_Q).tail))
+#define SPSC_QUEUE_FREE(_Q)                 ((uint8)(SPSC_QUEUE_CAPACITY(_Q) - SPSC_QUEUE_USED(_Q)))
+#define SPSC_QUEUE_IS_EMPTY(_Q)             ((_Q).head == (_Q).tail)
+#define SPSC_QUEUE_IS_FULL(_Q)              (SPSC_QUEUE_CAPACITY(_Q) <= SPSC_QUEUE_USED(_Q))
+
+/* Item at a free-running index , producer side : head + n , consumer side : tail + n */
+#define SPSC_QUEUE_SLOT(_Q , _INDEX)        ((_Q).items[(uint8)(_INDEX) & SPSC_QUEUE_MASK(_Q)])
+
+/* Oldest item (consumer) and next free slot (producer) */
+#define SPSC_QUEUE_FRONT(_Q)                SPSC_QUEUE_SLOT((_Q) , (_Q).tail)
+#define SPSC_QUEUE_BACK(_Q)                 SPSC_QUEUE_SLOT((_Q) , (_Q).head)
+
+/* Producer : make _COUNT filled slots visible , one byte store */
+#define SPSC_QUEUE_PUBLISH(_Q , _COUNT)     ((_Q).head = (uint8)((_Q).head + (_COUNT)))
+
+/* Consumer : the front item is done with , its slot goes back to the producer */
+#define SPSC_QUEUE_RELEASE(_Q)              ((_Q).tail = (uint8)((_Q).tail + 1))
+
+/* Empty the queue , only while neither side runs (init , interrupt masked) */
+#define SPSC_QUEUE_RESET(_Q)                do{ (_Q).head = ZERO_INIT ; (_Q).tail = ZERO_INIT ; }while(0)
+
+/* Section : Data Types Declarations */
+
+/* Section : Function Declarations */
+
+#endif	/* SPSC_QUEUE_H */
@@ -17,6 +17,7 @@
 
 /* Section : Data Types Declarations */
 
+#ifndef HOST_SIM_BUILD
 typedef unsigned char      uint8   ;
 typedef unsigned int       uint16  ;
 typedef unsigned long int  uint32  ;
@@ -25,6 +26,17 @@ typedef signed char        sint8   ;
 typedef signed int         sint16  ;
 typedef signed long int    sint32  ;
 typedef signed long long   sint64  ;
+#else
+/* Host simulation build (tools/host_sim) : keep the XC8 widths on gcc */
+typedef unsigned char      uint8   ;
+typedef unsigned short     uint16  ;
+typedef unsigned int       uint32  ;
+typedef unsigned long long uint64  ;
+typedef signed char        sint8   ;
+typedef signed short       sint16  ;
+typedef signed int         sint32  ;
+typedef signed long long   sint64  ;
+#endif
 
 typedef uint8 Std_ReturnType ; 
 
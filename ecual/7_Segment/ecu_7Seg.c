@@ -30,6 +30,8 @@ Std_ReturnType seven_segment_initialize( segment_t * seg){
         ret = gpio_pin_initialize(&(seg->segment_pins[SEGMENT_PIN1]));
         ret = gpio_pin_initialize(&(seg->segment_pins[SEGMENT_PIN2]));
         ret = gpio_pin_initialize(&(seg->segment_pins[SEGMENT_PIN3]));
+        /* E_NOT_OK only means per-pin writes are used */
+        (void)gpio_pin_group_initialize(&(seg->segment_group) , seg->segment_pins , 4);
         
     }
     return ret;
@@ -43,6 +45,9 @@ Std_ReturnType seven_segment_write_number(const segment_t * seg , uint8 number )
     if((NULL == seg) || ( 9 < number )){
        ret = E_NOT_OK; 
     }
+    else if(ZERO_INIT != seg->segment_group.mask){
+        ret = gpio_pin_group_write(&(seg->segment_group) , number);
+    }
     else{
         gpio_pin_write_logic(&(seg->segment_pins[SEGMENT_PIN0]) ,   number & 0x01 );
         gpio_pin_write_logic(&(seg->segment_pins[SEGMENT_PIN1]) , ((number >> 1) & 0x01) );
@@ -51,10 +51,13 @@ typedef enum{
  *
  * @details
  * Holds GPIO pin configuration for 4 data lines and the segment type.
+ * segment_group is filled by seven_segment_initialize() when the 4 pins
+ * are consecutive on one port , the digit is then written in one LATx write.
  */
 typedef struct{
     pin_config_t segment_pins[4] ;
     segment_type_t segment_type ;
+    gpio_pin_group_t segment_group ;
 }segment_t;
 
 
@@ -72,6 +75,8 @@ typedef struct{
  *
  * @note
  * Only initializes the 4 data pins. Common pin handling should be done externally.
+ * Also builds segment_group , pins that are not consecutive on one port
+ * fall back to per-pin writes.
  */
 Std_ReturnType seven_segment_initialize( segment_t * seg);
 
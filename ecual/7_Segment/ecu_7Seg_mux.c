@@ -0,0 +1,155 @@
+/* 
+ * @file    ecu_7Seg_mux.c
+ * @brief   Multiplexed N-digit 7-segment display engine implementation
+ *
+ * @details
+ * The digit enables are stored as (port , bit mask) pairs and the BCD bus
+ * as the segment_t pin group , so the refresh only issues masked LATx
+ * writes. digit_mask holds the port bit to write for "on" , 0 for "off"
+ * is obtained by writing the complement under the same mask.
+ *
+ * Layer: ECUAL
+ * Target MCU: PIC18F
+ *
+ * @author  Abdelmoniem Ahmed
+ * @linkedin https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * @date    2026
+ */
+
+#include"ecu_7Seg_mux.h"
+
+/* Digit enable : on / off through the precomputed (port , mask) pair */
+#define SEVEN_SEGMENT_MUX_DIGIT_ON(_MUX , _INDEX)   \
+    gpio_port_write_masked((_MUX)->digit_port[_INDEX] , (_MUX)->digit_mask[_INDEX] , ((GPIO_PIN_HIGH == (_MUX)->digit_active_level) ? 0xFF : 0x00))
+#define SEVEN_SEGMENT_MUX_DIGIT_OFF(_MUX , _INDEX)  \
+    gpio_port_write_masked((_MUX)->digit_port[_INDEX] , (_MUX)->digit_mask[_INDEX] , ((GPIO_PIN_HIGH == (_MUX)->digit_active_level) ? 0x00 : 0xFF))
+
+/**
+ * @brief Initialize the BCD bus , the digit pins and the write tables
+ */
+Std_ReturnType seven_segment_mux_initialize(seven_segment_mux_t *mux){
+    Std_ReturnType ret = E_OK;
+    uint8 l_index = ZERO_INIT;
+    
+    if((NULL == mux) || (ZERO_INIT == mux->digit_count) || (SEVEN_SEGMENT_MUX_MAX_DIGITS < mux->digit_count)){
+        ret = E_NOT_OK;
+    }
+    else{
+        ret = seven_segment_initialize(&(mux->segment));
+        if(ZERO_INIT == mux->segment.segment_group.mask){
+            /* The refresh relies on one LATx write for the BCD bus */
+            ret = E_NOT_OK;
+        }
+        else{
+            mux->brightness = SEVEN_SEGMENT_MUX_BRIGHTNESS_STEPS;
+            mux->current_digit = ZERO_INIT;
+            mux->phase = ZERO_INIT;
+            for(l_index = ZERO_INIT ; l_index < mux->digit_count ; l_index++){
+                mux->digits[l_index] = SEVEN_SEGMENT_MUX_BLANK;
+                mux->digit_port[l_index] = mux->digit_pins[l_index].port;
+                mux->digit_mask[l_index] = (uint8)(1 << mux->digit_pins[l_index].pin);
+                mux->digit_pins[l_index].direction = GPIO_DIRECTION_OUTPUT;
+                mux->digit_pins[l_index].logic = (GPIO_PIN_HIGH == mux->digit_active_level) ? GPIO_PIN_LOW : GPIO_PIN_HIGH;
+                ret &= gpio_pin_initialize(&(mux->digit_pins[l_index]));
+            }
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Set one digit of the buffer
+ */
+Std_ReturnType seven_segment_mux_write_digit(seven_segment_mux_t *mux , uint8 index , uint8 value){
+    Std_ReturnType ret = E_OK;
+    
+    if((NULL == mux) || (index >= mux->digit_count) || ((9 < value) && (SEVEN_SEGMENT_MUX_BLANK != value))){
+        ret = E_NOT_OK;
+    }
+    else{
+        mux->digits[index] = value;
+    }
+    return ret;
+}
+
+/**
+ * @brief Show an unsigned number , right aligned , leading zeros blanked
+ */
+Std_ReturnType seven_segment_mux_write_number(seven_segment_mux_t *mux , uint32 number){
+    Std_ReturnType ret = E_OK;
+    uint8 l_digits[SEVEN_SEGMENT_MUX_MAX_DIGITS];
+    uint8 l_index = ZERO_INIT;
+    
+    if((NULL == mux) || (ZERO_INIT == mux->digit_count) || (SEVEN_SEGMENT_MUX_MAX_DIGITS < mux->digit_count)){
+        ret = E_NOT_OK;
+    }
+    else{
+        /* Split right to left in a local copy , the buffer changes only if the number fits */
+        l_index = mux->digit_count;
+        do{
+            l_index--;
+            l_digits[l_index] = (uint8)(number % 10);
+            number /= 10;
+        }while((ZERO_INIT != number) && (ZERO_INIT != l_index));
+        
+        if(ZERO_INIT != number){
+            ret = E_NOT_OK;
+        }
+        else{
+            while(ZERO_INIT != l_index){
+                l_index--;
+                l_digits[l_index] = SEVEN_SEGMENT_MUX_BLANK;
+            }
+            for(l_index = ZERO_INIT ; l_index < mux->digit_count ; l_index++){
+                mux->digits[l_index] = l_digits[l_index];
+            }
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Set the on-time of every digit
+ */
+Std_ReturnType seven_segment_mux_set_brightness(seven_segment_mux_t *mux , uint8 brightness){
+    Std_ReturnType ret = E_OK;
+    
+    if((NULL == mux) || (SEVEN_SEGMENT_MUX_BRIGHTNESS_STEPS < brightness)){
+        ret = E_NOT_OK;
+    }
+    else{
+        mux->brightness = brightness;
+    }
+    return ret;
+}
+
+/**
+ * @brief Advance the multiplexing by one tick
+ */
+void seven_segment_mux_refresh(seven_segment_mux_t *mux){
+    if(ZERO_INIT == mux->phase){
+        /* Slot start : never show the next value on the previous digit */
+        (void)SEVEN_SEGMENT_MUX_DIGIT_OFF(mux , mux->current_digit);
+        mux->current_digit++;
+        if(mux->current_digit >= mux->digit_count){
+            mux->current_digit = ZERO_INIT;
+        }
+        else{ /* Nothing */ }
+        (void)gpio_pin_group_write(&(mux->segment.segment_group) , mux->digits[mux->current_digit]);
+        if(ZERO_INIT != mux->brightness){
+            (void)SEVEN_SEGMENT_MUX_DIGIT_ON(mux , mux->current_digit);
+        }
+        else{ /* Display off */ }
+    }
+    else if(mux->phase == mux->brightness){
+        /* End of the on-time */
+        (void)SEVEN_SEGMENT_MUX_DIGIT_OFF(mux , mux->current_digit);
+    }
+    else{ /* Nothing */ }
+    
+    mux->phase++;
+    if(mux->phase >= SEVEN_SEGMENT_MUX_BRIGHTNESS_STEPS){
+        mux->phase = ZERO_INIT;
+    }
+    else{ /* Nothing */ }
+}
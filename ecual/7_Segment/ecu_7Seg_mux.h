@@ -0,0 +1,146 @@
+/* 
+ * @file    ecu_7Seg_mux.h
+ * @brief   Multiplexed N-digit 7-segment display engine
+ *
+ * @details
+ * N digits share one segment_t BCD bus (external BCD-to-7-segment decoder)
+ * and each digit has its own common (enable) pin. The application writes a
+ * RAM digit buffer , and seven_segment_mux_refresh() , called from a timer
+ * ISR , drives one digit per digit slot :
+ *
+ *  slot = SEVEN_SEGMENT_MUX_BRIGHTNESS_STEPS ticks
+ *  - tick 0            : previous digit off , BCD bus <- next digit , digit on
+ *  - tick = brightness : digit off (brightness < steps)
+ *
+ * Refresh rate = tick rate / (SEVEN_SEGMENT_MUX_BRIGHTNESS_STEPS x digit_count).
+ * Every port access is a single masked LATx write from tables built once by
+ * seven_segment_mux_initialize() , the ISR never calls the per-pin GPIO APIs.
+ *
+ * Layer: ECUAL
+ * Target MCU: PIC18F
+ *
+ * @author  Abdelmoniem Ahmed
+ * @linkedin https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * @date    2026
+ */
+
+#ifndef ECU_7SEG_MUX_H
+#define	ECU_7SEG_MUX_H
+
+/* Section : Includes */
+
+#include"ecu_7Seg.h"
+
+/* Section : Macro Declaration */
+
+/* Digits per display */
+#define SEVEN_SEGMENT_MUX_MAX_DIGITS            8
+
+/* Ticks per digit slot = brightness levels (on-time steps) */
+#define SEVEN_SEGMENT_MUX_BRIGHTNESS_STEPS      4
+
+/* Digit buffer code that blanks the digit (4511 / 74LS48 style decoders blank BCD > 9) */
+#define SEVEN_SEGMENT_MUX_BLANK                 0x0F
+
+#if (SEVEN_SEGMENT_MUX_MAX_DIGITS == 0) || (SEVEN_SEGMENT_MUX_MAX_DIGITS > 8)
+#error "SEVEN_SEGMENT_MUX_MAX_DIGITS must be 1..8"
+#endif
+
+#if (SEVEN_SEGMENT_MUX_BRIGHTNESS_STEPS == 0) || (SEVEN_SEGMENT_MUX_BRIGHTNESS_STEPS > 16)
+#error "SEVEN_SEGMENT_MUX_BRIGHTNESS_STEPS must be 1..16"
+#endif
+
+/* Section : Data Types Declarations */
+
+/**
+ * @struct seven_segment_mux_t
+ * @brief Multiplexed display : configuration , then driver-owned state
+ *
+ * @details
+ * - segment            : Shared BCD bus , the 4 pins must be consecutive on one port
+ * - digit_pins         : Digit common pins , digit_pins[0] is the leftmost digit
+ * - digit_count        : Digits used (1 .. SEVEN_SEGMENT_MUX_MAX_DIGITS)
+ * - digit_active_level : GPIO_PIN_HIGH or GPIO_PIN_LOW , level that turns a digit on
+ */
+typedef struct{
+    segment_t segment ;
+    pin_config_t digit_pins[SEVEN_SEGMENT_MUX_MAX_DIGITS] ;
+    uint8 digit_count ;
+    uint8 digit_active_level : 1 ;
+    uint8 reserved           : 7 ;
+    
+    /* Driver owned */
+    port_index_t digit_port[SEVEN_SEGMENT_MUX_MAX_DIGITS] ;
+    uint8 digit_mask[SEVEN_SEGMENT_MUX_MAX_DIGITS] ;
+    volatile uint8 digits[SEVEN_SEGMENT_MUX_MAX_DIGITS] ;
+    volatile uint8 brightness ;
+    uint8 current_digit ;
+    uint8 phase ;
+}seven_segment_mux_t;
+
+/* Section : Function Declarations */
+
+/**
+ * @brief Initialize the BCD bus , the digit pins and the write tables
+ *
+ * @param mux Pointer to the display
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Display ready , blank , full brightness
+ *         - E_NOT_OK : Null pointer , bad digit_count or BCD pins not consecutive on one port
+ *
+ * @note Start the timer calling seven_segment_mux_refresh() afterwards.
+ */
+Std_ReturnType seven_segment_mux_initialize(seven_segment_mux_t *mux);
+
+/**
+ * @brief Set one digit of the buffer
+ *
+ * @param mux   Pointer to the display
+ * @param index Digit index , 0 = leftmost
+ * @param value 0 - 9 or SEVEN_SEGMENT_MUX_BLANK
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Digit updated , shown from its next slot on
+ *         - E_NOT_OK : Null pointer , index out of range or bad value
+ */
+Std_ReturnType seven_segment_mux_write_digit(seven_segment_mux_t *mux , uint8 index , uint8 value);
+
+/**
+ * @brief Show an unsigned number , right aligned , leading zeros blanked
+ *
+ * @param mux    Pointer to the display
+ * @param number Number to show
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Buffer updated
+ *         - E_NOT_OK : Null pointer , digit_count out of 1 .. SEVEN_SEGMENT_MUX_MAX_DIGITS
+ *                      or number wider than digit_count (buffer untouched)
+ */
+Std_ReturnType seven_segment_mux_write_number(seven_segment_mux_t *mux , uint32 number);
+
+/**
+ * @brief Set the on-time of every digit
+ *
+ * @param mux        Pointer to the display
+ * @param brightness 0 (off) .. SEVEN_SEGMENT_MUX_BRIGHTNESS_STEPS (always on during its slot)
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Applied from the next slot
+ *         - E_NOT_OK : Null pointer or brightness out of range
+ */
+Std_ReturnType seven_segment_mux_set_brightness(seven_segment_mux_t *mux , uint8 brightness);
+
+/**
+ * @brief Advance the multiplexing by one tick , call it from a timer ISR
+ *
+ * @param mux Pointer to an initialized display
+ *
+ * @note
+ * Two masked LATx writes at a slot start , one at the end of the on-time ,
+ * nothing on the other ticks. Example : Timer2 tick every 250 us with
+ * 4 steps and 4 digits refreshes the display at 250 Hz.
+ */
+void seven_segment_mux_refresh(seven_segment_mux_t *mux);
+
+#endif	/* ECU_7SEG_MUX_H */
@@ -0,0 +1,158 @@
+/*
+ * @file    ecu_adc_filter.c
+ * @brief   Oversampling , moving-average and exponential filters implementation
+ *
+ * @details
+ * All filters use 32-bit sums and shifts only , no divides and no
+ * floating point.
+ *
+ * Layer: ECUAL
+ * Target MCU: PIC18F4620
+ *
+ * Author: Abdelmoniem Ahmed
+ * Linkedin: https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * Date: 2026
+ */
+
+#include "ecu_adc_filter.h"
+
+/* Section : Function Definitions */
+
+Std_ReturnType ADC_Filter_Oversample_Blocking(const adc_conf_t *_adc , adc_channel_select_t channel ,
+                                              uint8 extra_bits , adc_result_t *result){
+    Std_ReturnType ret = E_OK;
+    adc_result_t l_sample = ZERO_INIT;
+    uint32 l_sum = ZERO_INIT;
+    uint16 l_count = ZERO_INIT;
+    uint16 l_samples = ZERO_INIT;
+
+    if((NULL == _adc) || (NULL == result) || (ADC_FILTER_OVERSAMPLE_BITS_MAX < extra_bits)){
+        ret = E_NOT_OK;
+    }
+    else{
+        /* 4^n = 2^(2n) */
+        l_samples = (uint16)(1U << (extra_bits << 1));
+        for(l_count = ZERO_INIT ; (l_count < l_samples) && (E_OK == ret) ; l_count++){
+#if CONFIG_ENABLE == ADC_FAST_CONFIGURATION
+            l_sample = ADC_Fast_Convert_Blocking(channel);
+#else
+            ret = ADC_GetConversion_Blocking(_adc , channel , &l_sample);
+#endif
+            l_sum += l_sample;
+        }
+        *result = (adc_result_t)(l_sum >> extra_bits);
+    }
+    return ret;
+}
+
+Std_ReturnType ADC_Filter_Oversample_Init(adc_oversample_t *filter){
+    Std_ReturnType ret = E_OK;
+
+    if((NULL == filter) || (ADC_FILTER_OVERSAMPLE_BITS_MAX < filter->extra_bits)){
+        ret = E_NOT_OK;
+    }
+    else{
+        filter->sum = ZERO_INIT;
+        filter->count = ZERO_INIT;
+    }
+    return ret;
+}
+
+Std_ReturnType ADC_Filter_Oversample_Push(adc_oversample_t *filter , adc_result_t sample ,
+                                          adc_result_t *result , uint8 *ready){
+    Std_ReturnType ret = E_OK;
+
+    if((NULL == filter) || (NULL == result) || (NULL == ready)){
+        ret = E_NOT_OK;
+    }
+    else{
+        filter->sum += sample;
+        filter->count++;
+        if(filter->count >= (uint16)(1U << (filter->extra_bits << 1))){
+            *result = (adc_result_t)(filter->sum >> filter->extra_bits);
+            *ready = 1;
+            filter->sum = ZERO_INIT;
+            filter->count = ZERO_INIT;
+        }
+        else{
+            *ready = 0;
+        }
+    }
+    return ret;
+}
+
+Std_ReturnType ADC_Filter_Average_Init(adc_average_t *filter){
+    Std_ReturnType ret = E_OK;
+
+    if((NULL == filter) || (NULL == filter->window) || (ADC_FILTER_AVERAGE_LOG2_MAX < filter->length_log2)){
+        ret = E_NOT_OK;
+    }
+    else{
+        filter->sum = ZERO_INIT;
+        filter->index = ZERO_INIT;
+        filter->primed = 0;
+    }
+    return ret;
+}
+
+Std_ReturnType ADC_Filter_Average_Push(adc_average_t *filter , adc_result_t sample , adc_result_t *result){
+    Std_ReturnType ret = E_OK;
+    uint8 l_length = ZERO_INIT;
+    uint8 l_index = ZERO_INIT;
+
+    if((NULL == filter) || (NULL == result)){
+        ret = E_NOT_OK;
+    }
+    else{
+        l_length = (uint8)(1U << filter->length_log2);
+        if(0 == filter->primed){
+            for(l_index = ZERO_INIT ; l_index < l_length ; l_index++){
+                filter->window[l_index] = sample;
+            }
+            filter->sum = (uint32)sample << filter->length_log2;
+            filter->primed = 1;
+        }
+        else{
+            /* Running sum : drop the oldest sample , add the new one */
+            filter->sum -= filter->window[filter->index];
+            filter->sum += sample;
+            filter->window[filter->index] = sample;
+        }
+        filter->index = (uint8)((filter->index + 1) & (l_length - 1));
+        *result = (adc_result_t)(filter->sum >> filter->length_log2);
+    }
+    return ret;
+}
+
+Std_ReturnType ADC_Filter_Ema_Init(adc_ema_t *filter){
+    Std_ReturnType ret = E_OK;
+
+    if((NULL == filter) || (ZERO_INIT == filter->shift) || (ADC_FILTER_EMA_SHIFT_MAX < filter->shift)){
+        ret = E_NOT_OK;
+    }
+    else{
+        filter->state = ZERO_INIT;
+        filter->primed = 0;
+    }
+    return ret;
+}
+
+Std_ReturnType ADC_Filter_Ema_Push(adc_ema_t *filter , adc_result_t sample , adc_result_t *result){
+    Std_ReturnType ret = E_OK;
+
+    if((NULL == filter) || (NULL == result)){
+        ret = E_NOT_OK;
+    }
+    else{
+        if(0 == filter->primed){
+            filter->state = (uint32)sample << filter->shift;
+            filter->primed = 1;
+        }
+        else{
+            /* y * 2^n += x - y , state >> shift never exceeds state */
+            filter->state = filter->state - (filter->state >> filter->shift) + sample;
+        }
+        *result = (adc_result_t)((filter->state + (1UL << (filter->shift - 1))) >> filter->shift);
+    }
+    return ret;
+}
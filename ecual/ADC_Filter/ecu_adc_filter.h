@@ -0,0 +1,192 @@
+/*
+ * @file    ecu_adc_filter.h
+ * @brief   Oversampling , moving-average and exponential filters on hal_adc
+ *
+ * @details
+ * Integer-only filters for noisy analog inputs , shared by the
+ * applications instead of each one averaging on its own :
+ *  - Oversampling : 4^n consecutive conversions summed and shifted right
+ *    by n , a result with n extra bits (10 + n bits)
+ *  - Moving average : running sum over a ring buffer of 2^n samples ,
+ *    one add , one subtract and one shift per sample
+ *  - Exponential filter : y += (x - y) / 2^n , kept as y * 2^n in fixed
+ *    point so small steps are not lost to truncation
+ *
+ * No divides and no floating point. Every filter state is a caller-owned
+ * structure , so each sensor keeps its own instance.
+ *
+ * Layer: ECUAL
+ * Target MCU: PIC18F4620
+ *
+ * Author: Abdelmoniem Ahmed
+ * Linkedin: https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * Date: 2026
+ */
+
+#ifndef ECU_ADC_FILTER_H
+#define	ECU_ADC_FILTER_H
+
+/* Section : Includes */
+#include"../../mcal/ADC/hal_adc.h"
+
+/* Section : Macro Declaration */
+
+/* Extra bits of resolution by oversampling , 4^6 = 4096 samples , 16-bit result */
+#define ADC_FILTER_OVERSAMPLE_BITS_MAX      6
+
+/* Moving-average window of 2^7 = 128 samples at most (8-bit ring index) */
+#define ADC_FILTER_AVERAGE_LOG2_MAX         7
+
+/* Exponential filter alpha = 1 / 2^shift , shift 1 .. 15 (32-bit state) */
+#define ADC_FILTER_EMA_SHIFT_MAX            15
+
+/* Section : Data Types Declarations */
+
+/**
+ * @struct adc_oversample_t
+ * @brief Oversampling accumulator , filled one sample at a time
+ *
+ * @details
+ * - extra_bits  : Extra resolution bits (n) , 4^n samples per result
+ * - sum / count : Runtime , reset by ADC_Filter_Oversample_Init
+ */
+typedef struct{
+    uint32 sum ;
+    uint16 count ;
+    uint8  extra_bits ;
+}adc_oversample_t;
+
+/**
+ * @struct adc_average_t
+ * @brief Moving average over a power-of-two window
+ *
+ * @details
+ * - window      : Caller-owned ring buffer of 2^length_log2 samples
+ * - length_log2 : Window length as a power of two
+ * - sum / index / primed : Runtime , reset by ADC_Filter_Average_Init
+ */
+typedef struct{
+    adc_result_t *window ;
+    uint32 sum ;
+    uint8  length_log2 ;
+    uint8  index ;
+    uint8  primed ;
+}adc_average_t;
+
+/**
+ * @struct adc_ema_t
+ * @brief Exponential moving average in fixed point
+ *
+ * @details
+ * - shift  : alpha = 1 / 2^shift , larger is smoother and slower
+ * - state  : Runtime , filter output * 2^shift
+ * - primed : Runtime , reset by ADC_Filter_Ema_Init
+ */
+typedef struct{
+    uint32 state ;
+    uint8  shift ;
+    uint8  primed ;
+}adc_ema_t;
+
+/* Section : Function Declarations */
+
+/**
+ * @brief Convert 4^extra_bits times back to back and decimate
+ *
+ * @param _adc       Pointer to an initialized ADC configuration
+ * @param channel    Channel to convert
+ * @param extra_bits Extra resolution bits (0 .. ADC_FILTER_OVERSAMPLE_BITS_MAX)
+ * @param result     Pointer to the (10 + extra_bits)-bit result
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Result valid
+ *         - E_NOT_OK : Null pointer , extra_bits too large or conversion error
+ *
+ * @note
+ * Blocking. Each conversion starts as soon as the previous one is done ,
+ * so the sample rate is set by the ADC acquisition and conversion times.
+ * Extra bits are only real if the input carries about 1 LSB of noise.
+ */
+Std_ReturnType ADC_Filter_Oversample_Blocking(const adc_conf_t *_adc , adc_channel_select_t channel ,
+                                              uint8 extra_bits , adc_result_t *result);
+
+/**
+ * @brief Reset an oversampling accumulator
+ *
+ * @param filter Pointer to the accumulator (extra_bits set)
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Accumulator empty
+ *         - E_NOT_OK : Null pointer or extra_bits too large
+ */
+Std_ReturnType ADC_Filter_Oversample_Init(adc_oversample_t *filter);
+
+/**
+ * @brief Add one sample , e.g. from a triggered ADC block
+ *
+ * @param filter Pointer to an initialized accumulator
+ * @param sample New ADC sample
+ * @param result Pointer to the decimated result , written when ready
+ * @param ready  Pointer set to 1 when 4^extra_bits samples were summed
+ *               (the accumulator then restarts) , 0 otherwise
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Sample added
+ *         - E_NOT_OK : Null pointer
+ */
+Std_ReturnType ADC_Filter_Oversample_Push(adc_oversample_t *filter , adc_result_t sample ,
+                                          adc_result_t *result , uint8 *ready);
+
+/**
+ * @brief Reset a moving average
+ *
+ * @param filter Pointer to the filter (window , length_log2 set)
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Filter empty , primed by the next sample
+ *         - E_NOT_OK : Null pointer or length_log2 too large
+ */
+Std_ReturnType ADC_Filter_Average_Init(adc_average_t *filter);
+
+/**
+ * @brief Add one sample and return the window average
+ *
+ * @param filter Pointer to an initialized filter
+ * @param sample New ADC sample
+ * @param result Pointer to the average of the last 2^length_log2 samples
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Result valid
+ *         - E_NOT_OK : Null pointer
+ *
+ * @note The first sample fills the whole window , no start-up ramp.
+ */
+Std_ReturnType ADC_Filter_Average_Push(adc_average_t *filter , adc_result_t sample , adc_result_t *result);
+
+/**
+ * @brief Reset an exponential filter
+ *
+ * @param filter Pointer to the filter (shift set)
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Filter empty , primed by the next sample
+ *         - E_NOT_OK : Null pointer or shift out of 1 .. ADC_FILTER_EMA_SHIFT_MAX
+ */
+Std_ReturnType ADC_Filter_Ema_Init(adc_ema_t *filter);
+
+/**
+ * @brief Add one sample and return the filtered value (rounded)
+ *
+ * @param filter Pointer to an initialized filter
+ * @param sample New ADC sample
+ * @param result Pointer to the filtered value
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Result valid
+ *         - E_NOT_OK : Null pointer
+ *
+ * @note The first sample sets the output , no start-up ramp.
+ */
+Std_ReturnType ADC_Filter_Ema_Push(adc_ema_t *filter , adc_result_t sample , adc_result_t *result);
+
+#endif	/* ECU_ADC_FILTER_H */
@@ -0,0 +1,98 @@
+/*
+ * @file    ecu_crc.h
+ * @brief   Table-driven CRC-8 and CRC-16-CCITT shared by protocols and storage
+ *
+ * @details
+ * One implementation for every integrity check of the tree (EEPROM and
+ * flash logs , I2C telemetry , bootloader frames) :
+ *  - CRC-8       : polynomial 0x07 (x^8 + x^2 + x + 1) , init CRC8_INIT ,
+ *                  no reflection , no final XOR (SMBus PEC)
+ *  - CRC-16-CCITT: polynomial 0x1021 , init CRC16_CCITT_INIT , no
+ *                  reflection , no final XOR (CCITT-FALSE , XMODEM with init 0)
+ *
+ * Two table sizes per CRC , chosen at build time :
+ *  - CRC_TABLE_NIBBLE : 16 entries (16 / 32 bytes of flash) , two lookups
+ *                       per byte
+ *  - CRC_TABLE_FULL   : 256 entries (256 / 512 bytes of flash) , one
+ *                       lookup per byte
+ *
+ * The _Update functions take one byte and the running CRC , so a frame
+ * can be checked while it streams in (an ISR per received byte). Run a
+ * CRC over the data followed by its own CRC (high byte first for CRC-16)
+ * and the result is zero when nothing was corrupted.
+ *
+ * Layer: ECUAL
+ * Target MCU: PIC18F4620
+ *
+ * Author: Abdelmoniem Ahmed
+ * Linkedin: https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * Date: 2026
+ */
+
+#ifndef ECU_CRC_H
+#define	ECU_CRC_H
+
+/* Section : Includes */
+#include"../../common/std_types.h"
+
+/* Section : Macro Declaration */
+
+/* Table sizes */
+#define CRC_TABLE_NIBBLE                    0
+#define CRC_TABLE_FULL                      1
+
+#define CRC8_TABLE_CFG                      CRC_TABLE_NIBBLE
+#define CRC16_TABLE_CFG                     CRC_TABLE_NIBBLE
+
+/* Start values */
+#define CRC8_INIT                           0x00
+#define CRC16_CCITT_INIT                    0xFFFFU
+
+/* Section : Function Declarations */
+
+/**
+ * @brief Add one byte to a running CRC-8
+ *
+ * @param crc  CRC so far , CRC8_INIT for the first byte
+ * @param data Next byte
+ *
+ * @return Updated CRC
+ *
+ * @note Safe from an ISR , XC8 gives the interrupt context its own copy
+ *       of a function called from both sides.
+ */
+uint8 CRC8_Update(uint8 crc , uint8 data);
+
+/**
+ * @brief CRC-8 of a block , continuing from crc
+ *
+ * @param crc    CRC so far , CRC8_INIT for a new block
+ * @param data   Pointer to the bytes , NULL returns crc unchanged
+ * @param length Number of bytes
+ *
+ * @return Updated CRC
+ */
+uint8 CRC8_Compute(uint8 crc , const uint8 *data , uint16 length);
+
+/**
+ * @brief Add one byte to a running CRC-16-CCITT
+ *
+ * @param crc  CRC so far , CRC16_CCITT_INIT for the first byte
+ * @param data Next byte
+ *
+ * @return Updated CRC
+ */
+uint16 CRC16_Update(uint16 crc , uint8 data);
+
+/**
+ * @brief CRC-16-CCITT of a block , continuing from crc
+ *
+ * @param crc    CRC so far , CRC16_CCITT_INIT for a new block
+ * @param data   Pointer to the bytes , NULL returns crc unchanged
+ * @param length Number of bytes
+ *
+ * @return Updated CRC
+ */
+uint16 CRC16_Compute(uint16 crc , const uint8 *data , uint16 length);
+
+#endif	/* ECU_CRC_H */
@@ -15,8 +15,8 @@
  * Design characteristics:
  * - Blocking implementation
  * - Polling-based (no interrupts)
- * - LCD busy flag is NOT read
- * - Timing requirements are satisfied using software delays
+ * - LCD busy flag is read only with CHR_LCD_BUSY_FLAG_CFG (RW pin wired)
+ * - Otherwise timing requirements are satisfied using software delays
  *
  * Configuration:
  * - Interface mode is selected via ecu_Chr_lcd_cfg.h
@@ -36,6 +36,7 @@
  */
 
 #include"ecu_Chr_lcd.h"
+#include"../../mcal/GPIO/hal_gpio_marker.h"
 
 #if CHR_LCD_4BIT_OR_8BIT_MODE_CFG == CHR_LCD_4BIT_MODE_ENABLE
 
@@ -54,10 +55,60 @@ static Std_ReturnType lcd_4bit_send_enable_signal(const chr_lcd_4bit_t * lcd);
  */
 static Std_ReturnType lcd_4bit_set_cursor(const chr_lcd_4bit_t * lcd , uint8 row , uint8 column);
 
+#if CHR_LCD_BUSY_FLAG_CFG == CHR_LCD_FEATURE_ENABLE
+
+/**
+ * @brief Poll the busy flag until the LCD is ready , E_NOT_OK on timeout
+ */
+static Std_ReturnType lcd_4bit_wait_ready(const chr_lcd_4bit_t * lcd);
+
+/**
+ * @brief Switch D4..D7 between output (write) and input (busy-flag read)
+ */
+static Std_ReturnType lcd_4bit_data_direction(const chr_lcd_4bit_t * lcd , direction_t direction);
+
+#endif
+
+#if CHR_LCD_FRAMEBUFFER_CFG == CHR_LCD_FEATURE_ENABLE
+
+/* Framebuffer dirty bitmap helpers , _CELL = row * CHR_LCD_COLUMNS + column */
+#define LCD_FB_CELLS                        (CHR_LCD_ROWS * CHR_LCD_COLUMNS)
+#define LCD_FB_DIRTY_SET(_FB , _CELL)       ((_FB)->dirty[(_CELL) >> 3] |= (uint8)(1 << ((_CELL) & 0x07)))
+#define LCD_FB_DIRTY_CLEAR(_FB , _CELL)     ((_FB)->dirty[(_CELL) >> 3] &= (uint8)~(1 << ((_CELL) & 0x07)))
+#define LCD_FB_DIRTY_READ(_FB , _CELL)      (((_FB)->dirty[(_CELL) >> 3] >> ((_CELL) & 0x07)) & 0x01)
+
+/**
+ * @brief Store a cell in the shadow , marks it dirty when it changes
+ */
+static void lcd_fb_set_cell(chr_lcd_fb_t * fb , uint8 row_index , uint8 column_index , uint8 data);
+
+/**
+ * @brief Send one dirty cell , the set-cursor is skipped when the LCD
+ *        address counter already points to it
+ */
+static Std_ReturnType lcd_fb_send_cell(chr_lcd_fb_t * fb , uint8 row_index , uint8 column_index);
+
+/**
+ * @brief Send the dirty cells of a row from column_index to the row end
+ */
+static Std_ReturnType lcd_fb_flush_row(chr_lcd_fb_t * fb , uint8 row_index , uint8 column_index);
+
+/**
+ * @brief Keep the attached framebuffer coherent with a raw command
+ */
+static void lcd_fb_track_command(const chr_lcd_4bit_t * lcd , uint8 command);
+
+#endif
+
 #endif
 
 #if CHR_LCD_4BIT_OR_8BIT_MODE_CFG == CHR_LCD_8BIT_MODE_ENABLE
 
+/**
+ * @brief Put a byte on D0..D7 , one LATx write when lcd_data_group is set for this LCD
+ */
+static Std_ReturnType lcd_8bit_send_byte(const chr_lcd_8bit_t * lcd , uint8 _data_command);
+
 /**
  * @brief Generate enable pulse for 8-bit LCD mode
  */
@@ -70,30 +121,67 @@ static Std_ReturnType lcd_8bit_set_cursor(const chr_lcd_8bit_t * lcd , uint8 row
 
 #endif
 
+/* DDRAM address of column 1 , index = row - 1 (rows 3 / 4 continue rows 1 / 2) */
+static const uint8 lcd_row_addresses[ROW4] = {
+    _LCD_DDRAM_START + 0x00 , _LCD_DDRAM_START + 0x40 , _LCD_DDRAM_START + 0x14 , _LCD_DDRAM_START + 0x54
+};
+
+/*
+ * Data lines of the LCD initialized last as one pin group , kept here so the
+ * LCD configuration stays const. mask = 0 when the pins are not consecutive ,
+ * another LCD (lcd_group_owner differs) is written pin by pin.
+ */
+#if CHR_LCD_4BIT_OR_8BIT_MODE_CFG == CHR_LCD_4BIT_MODE_ENABLE
+static const chr_lcd_4bit_t *lcd_group_owner = NULL;
+#elif CHR_LCD_4BIT_OR_8BIT_MODE_CFG == CHR_LCD_8BIT_MODE_ENABLE
+static const chr_lcd_8bit_t *lcd_group_owner = NULL;
+#endif
+static gpio_pin_group_t lcd_data_group;
+
+/* Decimal weights for the subtract-only conversion , index 0 = 10^9 */
+#define LCD_DECIMAL_DIGITS_MAX              10
+#define LCD_DECIMAL_FIRST_BYTE_DIGIT        7   /* 10^2 */
+#define LCD_DECIMAL_FIRST_SHORT_DIGIT       5   /* 10^4 */
+#define LCD_DECIMAL_FIRST_INT_DIGIT         0   /* 10^9 */
+
+static const uint32 lcd_decimal_weights[LCD_DECIMAL_DIGITS_MAX] = {
+    1000000000UL , 100000000UL , 10000000UL , 1000000UL , 100000UL ,
+    10000UL , 1000UL , 100UL , 10UL , 1UL
+};
+
+/**
+ * @brief Write the decimal digits of data without leading zeros , '\0' terminated
+ *
+ * @details
+ * Each digit is found by repeated subtraction of its weight (9 at most),
+ * the PIC18 has no divide instruction so this beats the / and % helpers.
+ * first_digit skips the weights that cannot fit in the source type.
+ *
+ * @return Number of digits written (1 at least)
+ */
+static uint8 lcd_decimal_digits(uint32 data , uint8 first_digit , uint8 *str);
+
 Std_ReturnType convert_byte_to_string(uint8 data , uint8 *str){
     Std_ReturnType ret = E_OK;
     if (NULL == str) {
         ret = E_NOT_OK;
     }
     else{
-        memset(str , "\0" , 4);
-        sprintf(str , "%i" , data);
+        (void)lcd_decimal_digits(data , LCD_DECIMAL_FIRST_BYTE_DIGIT , str);
     }
     return ret ;
 }
 
 Std_ReturnType convert_short_to_string(uint16 data , uint8 *str){
     Std_ReturnType ret = E_OK;
-    uint8 temp_string[6] = {0} , l_counter = 0;
+    uint8 l_counter = ZERO_INIT;
     if (NULL == str) {
         ret = E_NOT_OK;
     }
     else{
-        memset(temp_string , '\0' , 6);
-        memset(str , ' ' , 6);
-        sprintf(temp_string , "%i" , data);
-        while( '\0' != temp_string[l_counter]){
-            str[l_counter] = temp_string[l_counter];
+        l_counter = lcd_decimal_digits(data , LCD_DECIMAL_FIRST_SHORT_DIGIT , str);
+        while(5 > l_counter){
+            str[l_counter] = ' ';
             l_counter++;
         }
         str[5] = '\0';
@@ -107,40 +195,164 @@ Std_ReturnType convert_int_to_string(uint32 data , uint8 *str){
         ret = E_NOT_OK;
     }
     else{
-        memset(str , '\0' , 11);
-        sprintf(str , "%i" , data);
+        (void)lcd_decimal_digits(data , LCD_DECIMAL_FIRST_INT_DIGIT , str);
+    }
+    return ret ;
+}
+
+Std_ReturnType convert_uint_to_string_fixed(uint32 data , uint8 width , uint8 pad_char , uint8 *str){
+    Std_ReturnType ret = E_OK;
+    uint8 l_digits[LCD_DECIMAL_DIGITS_MAX + 1];
+    uint8 l_length = ZERO_INIT;
+    uint8 l_counter = ZERO_INIT;
+    if ((NULL == str) || (ZERO_INIT == width)) {
+        ret = E_NOT_OK;
+    }
+    else{
+        l_length = lcd_decimal_digits(data , LCD_DECIMAL_FIRST_INT_DIGIT , l_digits);
+        if(l_length > width){
+            /* Value does not fit : show the field as overflowed */
+            for(l_counter = ZERO_INIT ; l_counter < width ; l_counter++){
+                str[l_counter] = '*';
+            }
+            ret = E_NOT_OK;
+        }
+        else{
+            for(l_counter = ZERO_INIT ; l_counter < (width - l_length) ; l_counter++){
+                str[l_counter] = pad_char;
+            }
+            for(l_counter = ZERO_INIT ; l_counter < l_length ; l_counter++){
+                str[(width - l_length) + l_counter] = l_digits[l_counter];
+            }
+        }
+        str[width] = '\0';
+    }
+    return ret ;
+}
+
+Std_ReturnType convert_bcd_to_string(uint8 bcd , uint8 *str){
+    Std_ReturnType ret = E_OK;
+    if ((NULL == str) || (0x09 < (bcd >> 4)) || (0x09 < (bcd & 0x0F))) {
+        ret = E_NOT_OK;
+    }
+    else{
+        str[0] = (uint8)((bcd >> 4) + '0');
+        str[1] = (uint8)((bcd & 0x0F) + '0');
+        str[2] = '\0';
     }
     return ret ;
 }
 
+static uint8 lcd_decimal_digits(uint32 data , uint8 first_digit , uint8 *str){
+    uint8 l_length = ZERO_INIT;
+    uint8 l_digit = ZERO_INIT;
+    uint32 l_weight = ZERO_INIT;
+
+    for( ; first_digit < LCD_DECIMAL_DIGITS_MAX ; first_digit++){
+        l_weight = lcd_decimal_weights[first_digit];
+        l_digit = '0';
+        while(data >= l_weight){
+            data -= l_weight;
+            l_digit++;
+        }
+        /* Leading zeros dropped , the units digit is always kept */
+        if(('0' != l_digit) || (ZERO_INIT != l_length) || ((LCD_DECIMAL_DIGITS_MAX - 1) == first_digit)){
+            str[l_length] = l_digit;
+            l_length++;
+        }
+        else{ /* Nothing */ }
+    }
+    str[l_length] = '\0';
+    return l_length;
+}
+
 
 #if CHR_LCD_4BIT_OR_8BIT_MODE_CFG == CHR_LCD_4BIT_MODE_ENABLE
 
 Std_ReturnType lcd_4bit_initialize(const chr_lcd_4bit_t * lcd ){
+    Std_ReturnType ret = E_OK ;
+    uint8 l_step = CHR_LCD_INIT_STEP_START;
+    uint8 l_wait_ms = ZERO_INIT;
+    do{
+        ret = lcd_4bit_initialize_step(lcd , &l_step , &l_wait_ms);
+        /* __delay_ms() needs a constant , the power-on waits are counted */
+        while(ZERO_INIT != l_wait_ms){
+            __delay_ms(1);
+            l_wait_ms--;
+        }
+    }while((E_OK == ret) && (CHR_LCD_INIT_STEP_DONE != l_step));
+    return ret ;
+}
+
+Std_ReturnType lcd_4bit_initialize_step(const chr_lcd_4bit_t * lcd , uint8 *step , uint8 *wait_ms){
     Std_ReturnType ret = E_OK ;
     uint8 lcd_pin_counter = 0 ;
-    if(NULL == lcd){
+    if((NULL == lcd) || (NULL == step) || (NULL == wait_ms)){
         ret = E_NOT_OK;
     }
     else{
-        ret = gpio_pin_initialize(&(lcd->lcd_rs));
-        ret = gpio_pin_initialize(&(lcd->lcd_en));
-        for(lcd_pin_counter = 0 ; lcd_pin_counter < 4 ; lcd_pin_counter++){
-            ret = gpio_pin_initialize(&(lcd->lcd_data[lcd_pin_counter]));            
+        *wait_ms = ZERO_INIT;
+        switch(*step){
+            case CHR_LCD_INIT_STEP_START :
+                ret &= gpio_pin_initialize(&(lcd->lcd_rs));
+                ret &= gpio_pin_initialize(&(lcd->lcd_en));
+                for(lcd_pin_counter = 0 ; lcd_pin_counter < 4 ; lcd_pin_counter++){
+                    ret &= gpio_pin_initialize(&(lcd->lcd_data[lcd_pin_counter]));            
+                }
+                /* E_NOT_OK only means lcd_send_4bits() writes pin by pin */
+                (void)gpio_pin_group_initialize(&lcd_data_group , lcd->lcd_data , 4);
+                lcd_group_owner = lcd;
+#if CHR_LCD_BUSY_FLAG_CFG == CHR_LCD_FEATURE_ENABLE
+                ret &= gpio_pin_initialize(&(lcd->lcd_rw));
+                /* Write cycles from the first reset nibble on */
+                ret &= gpio_pin_write_logic(&(lcd->lcd_rw) , GPIO_PIN_LOW);
+#endif
+                /* Power-on wait before the first function set */
+                *wait_ms = CHR_LCD_POWER_ON_WAIT_MS;
+                *step = CHR_LCD_INIT_STEP_RESET_1;
+                break;
+            case CHR_LCD_INIT_STEP_RESET_1 :
+#if CHR_LCD_BUSY_FLAG_CFG == CHR_LCD_FEATURE_ENABLE
+                /* Reset by instruction : BF cannot be read before the 4-bit function set */
+                ret &= lcd_send_4bits(lcd , (_LCD_8BIT_MODE_2LINE >> 4));
+                ret &= lcd_4bit_send_enable_signal(lcd);
+#else
+                ret &= lcd_4bit_send_command(lcd , _LCD_8BIT_MODE_2LINE );
+#endif
+                *wait_ms = CHR_LCD_RESET_WAIT_MS;
+                *step = CHR_LCD_INIT_STEP_CONFIGURE;
+                break;
+            case CHR_LCD_INIT_STEP_CONFIGURE :
+                /* The remaining waits are microseconds , not worth yielding for */
+#if CHR_LCD_BUSY_FLAG_CFG == CHR_LCD_FEATURE_ENABLE
+                ret &= lcd_send_4bits(lcd , (_LCD_8BIT_MODE_2LINE >> 4));
+                ret &= lcd_4bit_send_enable_signal(lcd);
+                __delay_us(150);
+                ret &= lcd_send_4bits(lcd , (_LCD_8BIT_MODE_2LINE >> 4));
+                ret &= lcd_4bit_send_enable_signal(lcd);
+                __delay_us(50);
+                ret &= lcd_send_4bits(lcd , (_LCD_4BIT_MODE_2LINE >> 4));
+                ret &= lcd_4bit_send_enable_signal(lcd);
+                /* From here every command waits on BF */
+                ret &= lcd_4bit_send_command(lcd , _LCD_4BIT_MODE_2LINE);
+#else
+                ret &= lcd_4bit_send_command(lcd , _LCD_8BIT_MODE_2LINE );
+                __delay_us(150);
+                ret &= lcd_4bit_send_command(lcd , _LCD_8BIT_MODE_2LINE );
+#endif
+                ret &= lcd_4bit_send_command(lcd , _LCD_CLEAR );
+                ret &= lcd_4bit_send_command(lcd , _LCD_RETURN_HOME );
+                ret &= lcd_4bit_send_command(lcd , _LCD_ENTRY_MODE );
+                ret &= lcd_4bit_send_command(lcd , _LCD_CURSOR_OFF_DISPLAY_ON );
+                ret &= lcd_4bit_send_command(lcd , _LCD_4BIT_MODE_2LINE);
+                ret &= lcd_4bit_send_command(lcd , _LCD_DDRAM_START );
+                *step = CHR_LCD_INIT_STEP_DONE;
+                break;
+            default :
+                /* CHR_LCD_INIT_STEP_DONE or a corrupted step */
+                ret = (CHR_LCD_INIT_STEP_DONE == *step) ? E_OK : E_NOT_OK;
+                break;
         }
-        __delay_ms(20);
-        ret = lcd_4bit_send_command(lcd , _LCD_8BIT_MODE_2LINE );
-        __delay_ms(5);
-        ret = lcd_4bit_send_command(lcd , _LCD_8BIT_MODE_2LINE );
-        __delay_us(150);
-        ret = lcd_4bit_send_command(lcd , _LCD_8BIT_MODE_2LINE );
-        
-        ret = lcd_4bit_send_command(lcd , _LCD_CLEAR );
-        ret = lcd_4bit_send_command(lcd , _LCD_RETURN_HOME );
-        ret = lcd_4bit_send_command(lcd , _LCD_ENTRY_MODE );
-        ret = lcd_4bit_send_command(lcd , _LCD_CURSOR_OFF_DISPLAY_ON );
-        ret = lcd_4bit_send_command(lcd , _LCD_4BIT_MODE_2LINE);
-        ret = lcd_4bit_send_command(lcd , _LCD_DDRAM_START );
     }
     return ret ;
 }
@@ -152,11 +364,17 @@ Std_ReturnType lcd_4bit_send_command(const chr_lcd_4bit_t * lcd , uint8 command
         ret = E_NOT_OK;
     }
     else{
-        ret = gpio_pin_write_logic(&(lcd->lcd_rs) , GPIO_PIN_LOW);
-        ret = lcd_send_4bits(lcd , (command >> 4 ));
-        ret = lcd_4bit_send_enable_signal(lcd);
-        ret = lcd_send_4bits(lcd , (command));
-        ret = lcd_4bit_send_enable_signal(lcd);
+#if CHR_LCD_BUSY_FLAG_CFG == CHR_LCD_FEATURE_ENABLE
+        ret = lcd_4bit_wait_ready(lcd);
+#endif
+        ret &= gpio_pin_write_logic(&(lcd->lcd_rs) , GPIO_PIN_LOW);
+        ret &= lcd_send_4bits(lcd , (command >> 4 ));
+        ret &= lcd_4bit_send_enable_signal(lcd);
+        ret &= lcd_send_4bits(lcd , (command));
+        ret &= lcd_4bit_send_enable_signal(lcd);
+#if CHR_LCD_FRAMEBUFFER_CFG == CHR_LCD_FEATURE_ENABLE
+        lcd_fb_track_command(lcd , command);
+#endif
     }
     return ret ;
 }
@@ -168,11 +386,22 @@ Std_ReturnType lcd_4bit_send_char_data(const chr_lcd_4bit_t * lcd , uint8 data){
         ret = E_NOT_OK;
     }
     else{
-        ret = gpio_pin_write_logic(&(lcd->lcd_rs) , GPIO_PIN_HIGH);
-        ret = lcd_send_4bits(lcd , (data >> 4 ));
-        ret = lcd_4bit_send_enable_signal(lcd);
-        ret = lcd_send_4bits(lcd , (data));
-        ret = lcd_4bit_send_enable_signal(lcd);
+#if CHR_LCD_BUSY_FLAG_CFG == CHR_LCD_FEATURE_ENABLE
+        ret = lcd_4bit_wait_ready(lcd);
+#endif
+        ret &= gpio_pin_write_logic(&(lcd->lcd_rs) , GPIO_PIN_HIGH);
+        ret &= lcd_send_4bits(lcd , (data >> 4 ));
+        ret &= lcd_4bit_send_enable_signal(lcd);
+        ret &= lcd_send_4bits(lcd , (data));
+        ret &= lcd_4bit_send_enable_signal(lcd);
+        GPIO_MARKER_HIT(LCD);
+#if CHR_LCD_FRAMEBUFFER_CFG == CHR_LCD_FEATURE_ENABLE
+        /* Written at a position the framebuffer does not track */
+        if(NULL != lcd->lcd_fb){
+            lcd->lcd_fb->cursor_cell = CHR_LCD_FB_CURSOR_UNKNOWN;
+        }
+        else{ /* Nothing */ }
+#endif
     }
     return ret ;
 }
@@ -183,6 +412,16 @@ Std_ReturnType lcd_4bit_send_char_data_pos(const chr_lcd_4bit_t * lcd , uint8 ro
     if(NULL == lcd){
         ret = E_NOT_OK;
     }
+#if CHR_LCD_FRAMEBUFFER_CFG == CHR_LCD_FEATURE_ENABLE
+    else if(NULL != lcd->lcd_fb){
+        /* Sent only when it differs from the LCD contents */
+        ret = lcd_fb_write_char(lcd->lcd_fb , row , column , data);
+        if(E_OK == ret){
+            ret = lcd_fb_flush_row(lcd->lcd_fb , row - 1 , column - 1);
+        }
+        else{ /* Nothing */ }
+    }
+#endif
     else{
         lcd_4bit_set_cursor(lcd , row , column);
         lcd_4bit_send_char_data(lcd , data);
@@ -191,7 +430,7 @@ Std_ReturnType lcd_4bit_send_char_data_pos(const chr_lcd_4bit_t * lcd , uint8 ro
 }
 
 
-Std_ReturnType lcd_4bit_send_string(const chr_lcd_4bit_t * lcd , uint8 *str ){
+Std_ReturnType lcd_4bit_send_string(const chr_lcd_4bit_t * lcd , const uint8 *str ){
     Std_ReturnType ret = E_OK ;
     if(NULL == lcd){
         ret = E_NOT_OK;
@@ -206,11 +445,21 @@ Std_ReturnType lcd_4bit_send_string(const chr_lcd_4bit_t * lcd , uint8 *str ){
 }
 
 
-Std_ReturnType lcd_4bit_send_string_pos(const chr_lcd_4bit_t * lcd , uint8 row , uint8 column, uint8 *str ){
+Std_ReturnType lcd_4bit_send_string_pos(const chr_lcd_4bit_t * lcd , uint8 row , uint8 column, const uint8 *str ){
     Std_ReturnType ret = E_OK ;
     if(NULL == lcd){
         ret = E_NOT_OK;
     }
+#if CHR_LCD_FRAMEBUFFER_CFG == CHR_LCD_FEATURE_ENABLE
+    else if(NULL != lcd->lcd_fb){
+        /* Only the characters that differ from the LCD contents are sent */
+        ret = lcd_fb_write_string(lcd->lcd_fb , row , column , str);
+        if(E_OK == ret){
+            ret = lcd_fb_flush_row(lcd->lcd_fb , row - 1 , column - 1);
+        }
+        else{ /* Nothing */ }
+    }
+#endif
     else{
         ret = lcd_4bit_set_cursor(lcd , row , column);
         ret = lcd_4bit_send_string(lcd , str);
@@ -239,6 +488,143 @@ Std_ReturnType lcd_4bit_send_custom_char(const chr_lcd_4bit_t * lcd , uint8 row
     return ret ;
 }
 
+Std_ReturnType lcd_4bit_load_cgram(const chr_lcd_4bit_t * lcd , const uint8 *glyphs , uint8 glyph_count){
+    Std_ReturnType ret = E_OK ;
+    uint8 l_index = ZERO_INIT;
+    if((NULL == lcd) || (NULL == glyphs) || (ZERO_INIT == glyph_count) || (LCD_CGRAM_GLYPH_COUNT < glyph_count)){
+        ret = E_NOT_OK;
+    }
+    else{
+        /* One address command , the CGRAM address counter steps by itself */
+        ret = lcd_4bit_send_command(lcd , _LCD_CGRAM_START);
+        for(l_index = ZERO_INIT ; l_index < (uint8)(glyph_count * LCD_CGRAM_GLYPH_SIZE) ; l_index++){
+            ret &= lcd_4bit_send_char_data(lcd , glyphs[l_index]);
+        }
+        /* Back to DDRAM , the next data write lands on the display again */
+        ret &= lcd_4bit_send_command(lcd , _LCD_DDRAM_START);
+    }
+    return ret ;
+}
+
+
+#if CHR_LCD_FRAMEBUFFER_CFG == CHR_LCD_FEATURE_ENABLE
+
+Std_ReturnType lcd_fb_initialize(chr_lcd_fb_t * fb , chr_lcd_4bit_t * lcd){
+    Std_ReturnType ret = E_OK ;
+    uint8 l_index = ZERO_INIT ;
+    if((NULL == fb) || (NULL == lcd)){
+        ret = E_NOT_OK;
+    }
+    else{
+        fb->lcd = lcd;
+        memset(fb->shadow , ' ' , sizeof(fb->shadow));
+        for(l_index = ZERO_INIT ; l_index < sizeof(fb->dirty) ; l_index++){
+            fb->dirty[l_index] = ZERO_INIT;
+        }
+        fb->refresh_row = ZERO_INIT;
+        fb->refresh_column = ZERO_INIT;
+        fb->cursor_cell = CHR_LCD_FB_CURSOR_UNKNOWN;
+        lcd->lcd_fb = fb;
+        ret = lcd_4bit_send_command(lcd , _LCD_CLEAR);
+#if CHR_LCD_BUSY_FLAG_CFG == CHR_LCD_FEATURE_DISABLE
+        __delay_ms(2);
+#endif
+    }
+    return ret ;
+}
+
+
+Std_ReturnType lcd_fb_clear(chr_lcd_fb_t * fb){
+    Std_ReturnType ret = E_OK ;
+    uint8 l_row = ZERO_INIT , l_column = ZERO_INIT ;
+    if(NULL == fb){
+        ret = E_NOT_OK;
+    }
+    else{
+        for(l_row = ZERO_INIT ; l_row < CHR_LCD_ROWS ; l_row++){
+            for(l_column = ZERO_INIT ; l_column < CHR_LCD_COLUMNS ; l_column++){
+                lcd_fb_set_cell(fb , l_row , l_column , ' ');
+            }
+        }
+    }
+    return ret ;
+}
+
+
+Std_ReturnType lcd_fb_write_char(chr_lcd_fb_t * fb , uint8 row , uint8 column , uint8 data){
+    Std_ReturnType ret = E_OK ;
+    if((NULL == fb) || (ROW1 > row) || (CHR_LCD_ROWS < row) || (1 > column) || (CHR_LCD_COLUMNS < column)){
+        ret = E_NOT_OK;
+    }
+    else{
+        lcd_fb_set_cell(fb , row - 1 , column - 1 , data);
+    }
+    return ret ;
+}
+
+
+Std_ReturnType lcd_fb_write_string(chr_lcd_fb_t * fb , uint8 row , uint8 column , const uint8 *str){
+    Std_ReturnType ret = E_OK ;
+    uint8 l_column = ZERO_INIT ;
+    if((NULL == fb) || (NULL == str) || (ROW1 > row) || (CHR_LCD_ROWS < row) || (1 > column) || (CHR_LCD_COLUMNS < column)){
+        ret = E_NOT_OK;
+    }
+    else{
+        for(l_column = column - 1 ; (l_column < CHR_LCD_COLUMNS) && (*str) ; l_column++){
+            lcd_fb_set_cell(fb , row - 1 , l_column , *str++);
+        }
+    }
+    return ret ;
+}
+
+
+Std_ReturnType lcd_fb_refresh(chr_lcd_fb_t * fb){
+    Std_ReturnType ret = E_OK ;
+    uint8 l_checked = ZERO_INIT , l_sent = ZERO_INIT , l_cell = ZERO_INIT ;
+    if(NULL == fb){
+        ret = E_NOT_OK;
+    }
+    else{
+        /* Round robin over the cells , stops after one full lap or the cell budget */
+        for(l_checked = ZERO_INIT ; (l_checked < LCD_FB_CELLS) && (l_sent < CHR_LCD_FB_CELLS_PER_REFRESH) ; l_checked++){
+            l_cell = (fb->refresh_row * CHR_LCD_COLUMNS) + fb->refresh_column;
+            if(LCD_FB_DIRTY_READ(fb , l_cell)){
+                ret &= lcd_fb_send_cell(fb , fb->refresh_row , fb->refresh_column);
+                l_sent++;
+            }
+            else{ /* Nothing */ }
+            fb->refresh_column++;
+            if(CHR_LCD_COLUMNS <= fb->refresh_column){
+                fb->refresh_column = ZERO_INIT;
+                fb->refresh_row = ((fb->refresh_row + 1) < CHR_LCD_ROWS) ? (fb->refresh_row + 1) : ZERO_INIT;
+            }
+            else{ /* Nothing */ }
+        }
+    }
+    return ret ;
+}
+
+
+Std_ReturnType lcd_fb_is_synced(const chr_lcd_fb_t * fb , uint8 * synced){
+    Std_ReturnType ret = E_OK ;
+    uint8 l_index = ZERO_INIT ;
+    if((NULL == fb) || (NULL == synced)){
+        ret = E_NOT_OK;
+    }
+    else{
+        *synced = TRUE;
+        for(l_index = ZERO_INIT ; l_index < sizeof(fb->dirty) ; l_index++){
+            if(ZERO_INIT != fb->dirty[l_index]){
+                *synced = FALSE;
+            }
+            else{ /* Nothing */ }
+        }
+    }
+    return ret ;
+}
+
+#endif
+
 
 #elif CHR_LCD_4BIT_OR_8BIT_MODE_CFG == CHR_LCD_8BIT_MODE_ENABLE
 
@@ -254,6 +640,9 @@ Std_ReturnType lcd_8bit_initialize(const chr_lcd_8bit_t * lcd ){
         for(lcd_pin_counter = 0 ; lcd_pin_counter < 8 ; lcd_pin_counter++){
             ret = gpio_pin_initialize(&(lcd->lcd_data[lcd_pin_counter]));            
         }
+        /* E_NOT_OK only means lcd_8bit_send_byte() writes pin by pin */
+        (void)gpio_pin_group_initialize(&lcd_data_group , lcd->lcd_data , 8);
+        lcd_group_owner = lcd;
         __delay_ms(20);
         ret = lcd_8bit_send_command(lcd , _LCD_8BIT_MODE_2LINE );
         __delay_ms(5);
@@ -274,16 +663,12 @@ Std_ReturnType lcd_8bit_initialize(const chr_lcd_8bit_t * lcd ){
 
 Std_ReturnType lcd_8bit_send_command(const chr_lcd_8bit_t * lcd , uint8 command ){
     Std_ReturnType ret = E_OK ;
-    uint8 l_lcd_data_counter = ZERO_INIT ;
     if(NULL == lcd){
         ret = E_NOT_OK;
     }
     else{
         ret = gpio_pin_write_logic(&(lcd->lcd_rs) , GPIO_PIN_LOW);
-        for(l_lcd_data_counter = 0 ; l_lcd_data_counter < 8 ; l_lcd_data_counter++ ){
-            ret = gpio_pin_write_logic(&(lcd->lcd_data[l_lcd_data_counter]) 
-                                    , (command >> l_lcd_data_counter) & BIT_MASK);
-        }
+        ret = lcd_8bit_send_byte(lcd , command);
         ret = lcd_8bit_send_enable_signal(lcd); 
     }
     return ret ;
@@ -292,17 +677,14 @@ Std_ReturnType lcd_8bit_send_command(const chr_lcd_8bit_t * lcd , uint8 command
 
 Std_ReturnType lcd_8bit_send_char_data(const chr_lcd_8bit_t * lcd , uint8 data){
     Std_ReturnType ret = E_OK ;
-    uint8 l_lcd_data_counter = ZERO_INIT ;
     if(NULL == lcd){
         ret = E_NOT_OK;
     }
     else{
         ret = gpio_pin_write_logic(&(lcd->lcd_rs) , GPIO_PIN_HIGH);
-        for(l_lcd_data_counter = 0 ; l_lcd_data_counter < 8 ; l_lcd_data_counter++ ){
-            ret = gpio_pin_write_logic(&(lcd->lcd_data[l_lcd_data_counter]) 
-                                    , (data >> l_lcd_data_counter) & BIT_MASK);
-        }
+        ret = lcd_8bit_send_byte(lcd , data);
         ret = lcd_8bit_send_enable_signal(lcd);
+        GPIO_MARKER_HIT(LCD);
     }
     return ret ;
 
@@ -322,7 +704,7 @@ Std_ReturnType lcd_8bit_send_char_data_pos(const chr_lcd_8bit_t * lcd , uint8 ro
 }
 
 
-Std_ReturnType lcd_8bit_send_string(const chr_lcd_8bit_t * lcd , uint8 *str ){
+Std_ReturnType lcd_8bit_send_string(const chr_lcd_8bit_t * lcd , const uint8 *str ){
     Std_ReturnType ret = E_OK ;
     if(NULL == lcd){
         ret = E_NOT_OK;
@@ -336,7 +718,7 @@ Std_ReturnType lcd_8bit_send_string(const chr_lcd_8bit_t * lcd , uint8 *str ){
 }
 
 
-Std_ReturnType lcd_8bit_send_string_pos(const chr_lcd_8bit_t * lcd , uint8 row , uint8 column, uint8 *str ){
+Std_ReturnType lcd_8bit_send_string_pos(const chr_lcd_8bit_t * lcd , uint8 row , uint8 column, const uint8 *str ){
     Std_ReturnType ret = E_OK ;
     if(NULL == lcd){
         ret = E_NOT_OK;
@@ -371,29 +753,50 @@ Std_ReturnType lcd_8bit_send_custom_char(const chr_lcd_8bit_t * lcd , uint8 row
     return ret ;
 }
 
+Std_ReturnType lcd_8bit_load_cgram(const chr_lcd_8bit_t * lcd , const uint8 *glyphs , uint8 glyph_count){
+    Std_ReturnType ret = E_OK ;
+    uint8 l_index = ZERO_INIT;
+    if((NULL == lcd) || (NULL == glyphs) || (ZERO_INIT == glyph_count) || (LCD_CGRAM_GLYPH_COUNT < glyph_count)){
+        ret = E_NOT_OK;
+    }
+    else{
+        /* One address command , the CGRAM address counter steps by itself */
+        ret = lcd_8bit_send_command(lcd , _LCD_CGRAM_START);
+        for(l_index = ZERO_INIT ; l_index < (uint8)(glyph_count * LCD_CGRAM_GLYPH_SIZE) ; l_index++){
+            ret &= lcd_8bit_send_char_data(lcd , glyphs[l_index]);
+        }
+        /* Back to DDRAM , the next data write lands on the display again */
+        ret &= lcd_8bit_send_command(lcd , _LCD_DDRAM_START);
+    }
+    return ret ;
+}
+
 #endif
 
 #if CHR_LCD_4BIT_OR_8BIT_MODE_CFG == CHR_LCD_4BIT_MODE_ENABLE
 
 static Std_ReturnType lcd_send_4bits(const chr_lcd_4bit_t * lcd , uint8 _data_command){
     Std_ReturnType ret = E_OK;
-    ret = gpio_pin_write_logic(&(lcd->lcd_data[0]) , ((_data_command >> 0 ) & (uint8)0x01) );
-    ret = gpio_pin_write_logic(&(lcd->lcd_data[1]) , ((_data_command >> 1 ) & (uint8)0x01) );
-    ret = gpio_pin_write_logic(&(lcd->lcd_data[2]) , ((_data_command >> 2 ) & (uint8)0x01) );
-    ret = gpio_pin_write_logic(&(lcd->lcd_data[3]) , ((_data_command >> 3 ) & (uint8)0x01) );
+    if((lcd_group_owner == lcd) && (ZERO_INIT != lcd_data_group.mask)){
+        ret = gpio_pin_group_write(&lcd_data_group , (_data_command & (uint8)0x0F));
+    }
+    else{
+        ret = gpio_pin_write_logic(&(lcd->lcd_data[0]) , ((_data_command >> 0 ) & (uint8)0x01) );
+        ret = gpio_pin_write_logic(&(lcd->lcd_data[1]) , ((_data_command >> 1 ) & (uint8)0x01) );
+        ret = gpio_pin_write_logic(&(lcd->lcd_data[2]) , ((_data_command >> 2 ) & (uint8)0x01) );
+        ret = gpio_pin_write_logic(&(lcd->lcd_data[3]) , ((_data_command >> 3 ) & (uint8)0x01) );
+    }
     return ret ;
 }
 
 
 static Std_ReturnType lcd_4bit_set_cursor(const chr_lcd_4bit_t * lcd , uint8 row , uint8 column){
     Std_ReturnType ret = E_OK;
-    column--;
-    switch (row) {
-        case ROW1 : ret = lcd_4bit_send_command(lcd , (0x80 + column)); break;
-        case ROW2 : ret = lcd_4bit_send_command(lcd , (0xC0 + column)); break;
-        case ROW3 : ret = lcd_4bit_send_command(lcd , (0x94 + column)); break;
-        case ROW4 : ret = lcd_4bit_send_command(lcd , (0xd4 + column)); break;
-        default   :  ;
+    if((ROW1 > row) || (ROW4 < row)){
+        ret = E_NOT_OK;
+    }
+    else{
+        ret = lcd_4bit_send_command(lcd , (uint8)(lcd_row_addresses[row - 1] + column - 1));
     }
     return ret ;
 }
@@ -407,10 +810,127 @@ static Std_ReturnType lcd_4bit_send_enable_signal(const chr_lcd_4bit_t * lcd){
     return ret ;
 }
 
+#if CHR_LCD_BUSY_FLAG_CFG == CHR_LCD_FEATURE_ENABLE
+
+static Std_ReturnType lcd_4bit_wait_ready(const chr_lcd_4bit_t * lcd){
+    Std_ReturnType ret = E_OK;
+    Logic_t busy_flag = GPIO_PIN_HIGH;
+    uint16 poll_counter = ZERO_INIT;
+    ret &= lcd_4bit_data_direction(lcd , GPIO_DIRECTION_INPUT);
+    ret &= gpio_pin_write_logic(&(lcd->lcd_rs) , GPIO_PIN_LOW);
+    ret &= gpio_pin_write_logic(&(lcd->lcd_rw) , GPIO_PIN_HIGH);
+    while((GPIO_PIN_HIGH == busy_flag) && (CHR_LCD_BUSY_POLL_MAX > poll_counter)){
+        /* High nibble : BF on D7 */
+        ret &= gpio_pin_write_logic(&(lcd->lcd_en) , GPIO_PIN_HIGH);
+        __delay_us(1);
+        ret &= gpio_pin_read_logic(&(lcd->lcd_data[3]) , &busy_flag);
+        ret &= gpio_pin_write_logic(&(lcd->lcd_en) , GPIO_PIN_LOW);
+        __delay_us(1);
+        /* Low nibble (address counter) , clocked out and ignored */
+        ret &= gpio_pin_write_logic(&(lcd->lcd_en) , GPIO_PIN_HIGH);
+        __delay_us(1);
+        ret &= gpio_pin_write_logic(&(lcd->lcd_en) , GPIO_PIN_LOW);
+        __delay_us(1);
+        poll_counter++;
+    }
+    ret &= gpio_pin_write_logic(&(lcd->lcd_rw) , GPIO_PIN_LOW);
+    ret &= lcd_4bit_data_direction(lcd , GPIO_DIRECTION_OUTPUT);
+    ret &= (GPIO_PIN_HIGH == busy_flag) ? E_NOT_OK : E_OK;
+    return ret;
+}
+
+static Std_ReturnType lcd_4bit_data_direction(const chr_lcd_4bit_t * lcd , direction_t direction){
+    Std_ReturnType ret = E_OK;
+    uint8 lcd_pin_counter = ZERO_INIT;
+    pin_config_t data_pin;
+    for(lcd_pin_counter = ZERO_INIT ; lcd_pin_counter < 4 ; lcd_pin_counter++){
+        data_pin = lcd->lcd_data[lcd_pin_counter];
+        data_pin.direction = direction;
+        ret &= gpio_pin_direction_initialize(&data_pin);
+    }
+    return ret;
+}
+
+#endif
+
+#if CHR_LCD_FRAMEBUFFER_CFG == CHR_LCD_FEATURE_ENABLE
+
+static void lcd_fb_set_cell(chr_lcd_fb_t * fb , uint8 row_index , uint8 column_index , uint8 data){
+    uint8 l_cell = (row_index * CHR_LCD_COLUMNS) + column_index;
+    if(fb->shadow[row_index][column_index] != data){
+        fb->shadow[row_index][column_index] = data;
+        LCD_FB_DIRTY_SET(fb , l_cell);
+    }
+    else{ /* Nothing */ }
+}
+
+static Std_ReturnType lcd_fb_send_cell(chr_lcd_fb_t * fb , uint8 row_index , uint8 column_index){
+    Std_ReturnType ret = E_OK;
+    uint8 l_cell = (row_index * CHR_LCD_COLUMNS) + column_index;
+    LCD_FB_DIRTY_CLEAR(fb , l_cell);
+    if(l_cell != fb->cursor_cell){
+        ret = lcd_4bit_set_cursor(fb->lcd , row_index + 1 , column_index + 1);
+    }
+    else{ /* Address counter already there */ }
+    ret &= lcd_4bit_send_char_data(fb->lcd , fb->shadow[row_index][column_index]);
+    /* Auto-increment stays on the row , the next row is not the next DDRAM address */
+    fb->cursor_cell = ((E_OK == ret) && ((column_index + 1) < CHR_LCD_COLUMNS)) ? (l_cell + 1) : CHR_LCD_FB_CURSOR_UNKNOWN;
+    return ret;
+}
+
+static Std_ReturnType lcd_fb_flush_row(chr_lcd_fb_t * fb , uint8 row_index , uint8 column_index){
+    Std_ReturnType ret = E_OK;
+    uint8 l_cell = (row_index * CHR_LCD_COLUMNS) + column_index;
+    for( ; column_index < CHR_LCD_COLUMNS ; column_index++){
+        if(LCD_FB_DIRTY_READ(fb , l_cell)){
+            ret &= lcd_fb_send_cell(fb , row_index , column_index);
+        }
+        else{ /* Nothing */ }
+        l_cell++;
+    }
+    return ret;
+}
+
+static void lcd_fb_track_command(const chr_lcd_4bit_t * lcd , uint8 command){
+    chr_lcd_fb_t * fb = lcd->lcd_fb;
+    uint8 l_index = ZERO_INIT;
+    if(NULL != fb){
+        if(_LCD_CLEAR == command){
+            /* The LCD is blank now , so is the framebuffer */
+            memset(fb->shadow , ' ' , sizeof(fb->shadow));
+            for(l_index = ZERO_INIT ; l_index < sizeof(fb->dirty) ; l_index++){
+                fb->dirty[l_index] = ZERO_INIT;
+            }
+        }
+        else{ /* Nothing */ }
+        /* Any command (set-cursor included) may move the address counter */
+        fb->cursor_cell = CHR_LCD_FB_CURSOR_UNKNOWN;
+    }
+    else{ /* Nothing */ }
+}
+
+#endif
+
 #endif
 
 #if CHR_LCD_4BIT_OR_8BIT_MODE_CFG == CHR_LCD_8BIT_MODE_ENABLE
 
+static Std_ReturnType lcd_8bit_send_byte(const chr_lcd_8bit_t * lcd , uint8 _data_command){
+    Std_ReturnType ret = E_OK;
+    uint8 l_lcd_data_counter = ZERO_INIT ;
+    if((lcd_group_owner == lcd) && (ZERO_INIT != lcd_data_group.mask)){
+        ret = gpio_pin_group_write(&lcd_data_group , _data_command);
+    }
+    else{
+        for(l_lcd_data_counter = 0 ; l_lcd_data_counter < 8 ; l_lcd_data_counter++ ){
+            ret = gpio_pin_write_logic(&(lcd->lcd_data[l_lcd_data_counter]) 
+                                    , (_data_command >> l_lcd_data_counter) & BIT_MASK);
+        }
+    }
+    return ret ;
+}
+
+
 static Std_ReturnType lcd_8bit_send_enable_signal(const chr_lcd_8bit_t * lcd){
     Std_ReturnType ret = E_OK;
     ret = gpio_pin_write_logic(&(lcd->lcd_en) , GPIO_PIN_HIGH);
@@ -422,13 +942,11 @@ static Std_ReturnType lcd_8bit_send_enable_signal(const chr_lcd_8bit_t * lcd){
 
 static Std_ReturnType lcd_8bit_set_cursor(const chr_lcd_8bit_t * lcd , uint8 row , uint8 column){
     Std_ReturnType ret = E_OK;
-    column--;
-    switch (row) {
-        case ROW1 : ret = lcd_8bit_send_command(lcd , (0x80 + column)); break;
-        case ROW2 : ret = lcd_8bit_send_command(lcd , (0xC0 + column)); break;
-        case ROW3 : ret = lcd_8bit_send_command(lcd , (0x94 + column)); break;
-        case ROW4 : ret = lcd_8bit_send_command(lcd , (0xd4 + column)); break;
-        default   :  ;
+    if((ROW1 > row) || (ROW4 < row)){
+        ret = E_NOT_OK;
+    }
+    else{
+        ret = lcd_8bit_send_command(lcd , (uint8)(lcd_row_addresses[row - 1] + column - 1));
     }
     return ret ;
 }
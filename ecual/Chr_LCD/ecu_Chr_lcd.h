@@ -18,7 +18,8 @@
  * - Custom character (CGRAM) handling
  *
  * Design notes:
- * - The driver is blocking and polling-based
+ * - The driver is blocking and polling-based ; 4-bit init can also run
+ *   step by step (lcd_4bit_initialize_step) to overlap its power-on wait
  * - LCD busy flag is not read; fixed delays are used instead
  * - Clock configuration is expected to be handled by the application
  *
@@ -43,6 +44,28 @@
 
 /* Section : Macro Declaration */
 
+/**
+ * @name 4-bit initialization steps
+ * @brief Values of the step counter used by lcd_4bit_initialize_step()
+ * @{
+ */
+#define CHR_LCD_INIT_STEP_START             0x00
+#define CHR_LCD_INIT_STEP_RESET_1           0x01
+#define CHR_LCD_INIT_STEP_CONFIGURE         0x02
+#define CHR_LCD_INIT_STEP_DONE              0x03
+/** @} */
+
+/**
+ * @def CHR_LCD_POWER_ON_WAIT_MS
+ * @brief Wait after VDD rises before the first function set (HD44780 > 15 ms)
+ */
+#define CHR_LCD_POWER_ON_WAIT_MS            20
+/**
+ * @def CHR_LCD_RESET_WAIT_MS
+ * @brief Wait after the first reset function set (HD44780 > 4.1 ms)
+ */
+#define CHR_LCD_RESET_WAIT_MS               5
+
 /**
  * @def _LCD_CLEAR
  * @brief Clear LCD display and reset cursor position
@@ -108,6 +131,16 @@
  * @brief Start address of DDRAM
  */
 #define _LCD_DDRAM_START                    0x80
+/**
+ * @def LCD_CGRAM_GLYPH_SIZE
+ * @brief Bytes per custom character (5x8 dots , one row per byte)
+ */
+#define LCD_CGRAM_GLYPH_SIZE                8
+/**
+ * @def LCD_CGRAM_GLYPH_COUNT
+ * @brief Custom characters held by the CGRAM (character codes 0 .. 7)
+ */
+#define LCD_CGRAM_GLYPH_COUNT               8
 
 
 /**
@@ -131,6 +164,12 @@
  */
 #define ROW4                                4
 
+/**
+ * @def CHR_LCD_FB_CURSOR_UNKNOWN
+ * @brief chr_lcd_fb_t cursor_cell value when the LCD address counter is unknown
+ */
+#define CHR_LCD_FB_CURSOR_UNKNOWN           0xFF
+
 /* Section : Macro Functions Declarations */
 
 
@@ -150,17 +189,64 @@
  * - RS : Register Select (Command/Data)
  * - EN : Enable signal
  * - DATA[4] : LCD data lines (D4?D7)
+ * - RW : Read / Write , only with CHR_LCD_BUSY_FLAG_CFG (busy-flag polling)
+ *
+ * When D4..D7 are consecutive pins of one port , lcd_4bit_initialize()
+ * records them as a pin group and each nibble is a single LATx write.
+ * The group is kept by the driver for the LCD initialized last.
+ *
+ * lcd_fb is set by lcd_fb_initialize() : the _pos write APIs then diff
+ * against that framebuffer and send only the changed characters.
  *
  * @note
  * All pins must be configured as OUTPUT before initialization.
  */
 
+#if CHR_LCD_FRAMEBUFFER_CFG == CHR_LCD_FEATURE_ENABLE
+struct chr_lcd_fb_s ;
+#endif
+
 typedef struct{
     pin_config_t lcd_rs ;
     pin_config_t lcd_en ;
     pin_config_t lcd_data[4] ;
+#if CHR_LCD_BUSY_FLAG_CFG == CHR_LCD_FEATURE_ENABLE
+    pin_config_t lcd_rw ;
+#endif
+#if CHR_LCD_FRAMEBUFFER_CFG == CHR_LCD_FEATURE_ENABLE
+    struct chr_lcd_fb_s * lcd_fb ;
+#endif
 }chr_lcd_4bit_t;
 
+#if CHR_LCD_FRAMEBUFFER_CFG == CHR_LCD_FEATURE_ENABLE
+
+/**
+ * @struct chr_lcd_fb_t
+ * @brief RAM framebuffer of a 4-bit LCD
+ *
+ * @details
+ * - lcd    : LCD the framebuffer is refreshed to
+ * - shadow : Character wanted in every cell
+ * - dirty  : One bit per cell (row * CHR_LCD_COLUMNS + column) , set when
+ *            the cell differs from what the LCD shows
+ * - refresh_row / refresh_column : Next cell checked by lcd_fb_refresh()
+ * - cursor_cell : Cell the LCD address counter points to , CHR_LCD_FB_CURSOR_UNKNOWN
+ *                 after any command , a set-cursor is skipped when the next
+ *                 dirty cell is this one
+ *
+ * Filled by lcd_fb_initialize() , do not modify directly.
+ */
+typedef struct chr_lcd_fb_s{
+    const chr_lcd_4bit_t * lcd ;
+    uint8 shadow[CHR_LCD_ROWS][CHR_LCD_COLUMNS] ;
+    uint8 dirty[((CHR_LCD_ROWS * CHR_LCD_COLUMNS) + 7) / 8] ;
+    uint8 refresh_row ;
+    uint8 refresh_column ;
+    uint8 cursor_cell ;
+}chr_lcd_fb_t;
+
+#endif
+
 #elif CHR_LCD_4BIT_OR_8BIT_MODE_CFG == CHR_LCD_8BIT_MODE_ENABLE
 
 /**
@@ -176,6 +262,11 @@ typedef struct{
  * - EN : Enable signal
  * - DATA[8] : LCD data lines (D0?D7)
  *
+ * When D0..D7 are the eight pins of one port in order ,
+ * lcd_8bit_initialize() records them as a pin group and each byte is a
+ * single LATx write. The group is kept by the driver for the LCD
+ * initialized last.
+ *
  * @note
  * All pins must be configured as OUTPUT before initialization.
  */
@@ -204,11 +295,36 @@ typedef struct{
  * @note
  * GPIO pins must be configured as output.
  * Clock configuration must be done by the application.
+ * With CHR_LCD_BUSY_FLAG_CFG the HD44780 4-bit reset sequence is used and
+ * every step after it waits on the busy flag instead of a fixed delay.
  */
 Std_ReturnType lcd_4bit_initialize(const chr_lcd_4bit_t * lcd );
 
+/**
+ * @brief Run one step of the 4-bit initialization without blocking
+ *
+ * @details
+ * Splits lcd_4bit_initialize() at its millisecond power-on waits so the
+ * caller can do other work (UART , I2C , sensors) while the HD44780 powers
+ * up. Start with *step = CHR_LCD_INIT_STEP_START , then call again once
+ * *wait_ms milliseconds have passed until *step reads CHR_LCD_INIT_STEP_DONE.
+ * Sub-millisecond waits are still done inline.
+ *
+ * @param lcd     Pointer to LCD configuration structure
+ * @param step    Caller-owned step counter , advanced by each call
+ * @param wait_ms Milliseconds to wait before the next call (0 when done)
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Step executed (or sequence already complete)
+ *         - E_NOT_OK : Invalid parameter or unknown step
+ */
+Std_ReturnType lcd_4bit_initialize_step(const chr_lcd_4bit_t * lcd , uint8 *step , uint8 *wait_ms);
+
 /**
  * @brief Send command to LCD in 4-bit mode
+ *
+ * @note With CHR_LCD_BUSY_FLAG_CFG it first waits for BF = 0 and returns
+ *       E_NOT_OK when the LCD stays busy for CHR_LCD_BUSY_POLL_MAX reads.
  */
 Std_ReturnType lcd_4bit_send_command(const chr_lcd_4bit_t * lcd , uint8 command );
 
@@ -225,12 +341,12 @@ Std_ReturnType lcd_4bit_send_char_data_pos(const chr_lcd_4bit_t * lcd , uint8 ro
 /**
  * @brief Send string to LCD in 4-bit mode
  */
-Std_ReturnType lcd_4bit_send_string(const chr_lcd_4bit_t * lcd , uint8 *str );
+Std_ReturnType lcd_4bit_send_string(const chr_lcd_4bit_t * lcd , const uint8 *str );
 
 /**
  * @brief Send string to specific position in 4-bit mode
  */
-Std_ReturnType lcd_4bit_send_string_pos(const chr_lcd_4bit_t * lcd , uint8 row , uint8 column, uint8 *str );
+Std_ReturnType lcd_4bit_send_string_pos(const chr_lcd_4bit_t * lcd , uint8 row , uint8 column, const uint8 *str );
 
 /**
  * @brief Send custom character to LCD in 4-bit mode
@@ -238,6 +354,95 @@ Std_ReturnType lcd_4bit_send_string_pos(const chr_lcd_4bit_t * lcd , uint8 row ,
 Std_ReturnType lcd_4bit_send_custom_char(const chr_lcd_4bit_t * lcd , uint8 row 
                                        , uint8 column , const uint8 _chr[] , uint8 mem_position );
 
+/**
+ * @brief Load custom characters in CGRAM in one burst , glyph n becomes character code n
+ *
+ * @param lcd         Pointer to LCD configuration structure
+ * @param glyphs      glyph_count * LCD_CGRAM_GLYPH_SIZE bytes , a const table stays in flash
+ * @param glyph_count 1 .. LCD_CGRAM_GLYPH_COUNT
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Glyphs loaded
+ *         - E_NOT_OK : Null pointer or bad glyph count
+ *
+ * @note Call it once at init , then draw the glyphs as characters 0 .. glyph_count - 1
+ *       (lcd_4bit_send_char_data_pos) instead of reloading them with
+ *       lcd_4bit_send_custom_char. The address counter is left at DDRAM 0x00.
+ */
+Std_ReturnType lcd_4bit_load_cgram(const chr_lcd_4bit_t * lcd , const uint8 *glyphs , uint8 glyph_count);
+
+#if CHR_LCD_FRAMEBUFFER_CFG == CHR_LCD_FEATURE_ENABLE
+
+/**
+ * @brief Attach a framebuffer to an initialized LCD
+ *
+ * @param fb  Pointer to the framebuffer
+ * @param lcd Pointer to an LCD already set up by lcd_4bit_initialize
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Framebuffer ready
+ *         - E_NOT_OK : Null pointer
+ *
+ * @note Clears the LCD (blocking , once) so the blank shadow matches it.
+ * @note From now on lcd_4bit_send_string_pos / lcd_4bit_send_char_data_pos
+ *       go through the framebuffer and send only the characters that differ
+ *       from it , _LCD_CLEAR blanks the framebuffer too.
+ */
+Std_ReturnType lcd_fb_initialize(chr_lcd_fb_t * fb , chr_lcd_4bit_t * lcd);
+
+/**
+ * @brief Blank the framebuffer (RAM only)
+ */
+Std_ReturnType lcd_fb_clear(chr_lcd_fb_t * fb);
+
+/**
+ * @brief Write a character into the framebuffer (RAM only)
+ *
+ * @param fb     Pointer to the framebuffer
+ * @param row    ROW1 .. CHR_LCD_ROWS
+ * @param column 1 .. CHR_LCD_COLUMNS
+ * @param data   Character , CGRAM codes 0 .. 7 allowed
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Cell written (marked dirty only if it changed)
+ *         - E_NOT_OK : Null pointer or position outside the display
+ */
+Std_ReturnType lcd_fb_write_char(chr_lcd_fb_t * fb , uint8 row , uint8 column , uint8 data);
+
+/**
+ * @brief Write a string into the framebuffer (RAM only)
+ *
+ * @note The string is clipped at the end of the row.
+ */
+Std_ReturnType lcd_fb_write_string(chr_lcd_fb_t * fb , uint8 row , uint8 column , const uint8 *str);
+
+/**
+ * @brief Send up to CHR_LCD_FB_CELLS_PER_REFRESH dirty cells to the LCD
+ *
+ * @param fb Pointer to the framebuffer
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Refresh step done
+ *         - E_NOT_OK : Null pointer
+ *
+ * @note Call from a periodic task (e.g. every 10 ms).
+ * @note Consecutive dirty cells of a row are sent without a set-cursor
+ *       command in between (the LCD address counter auto-increments).
+ * @note lcd_4bit_send_string / lcd_4bit_send_char_data write at an unknown
+ *       position and bypass the framebuffer , use the _pos APIs.
+ */
+Std_ReturnType lcd_fb_refresh(chr_lcd_fb_t * fb);
+
+/**
+ * @brief Check whether every cell has reached the LCD
+ *
+ * @param fb     Pointer to the framebuffer
+ * @param synced TRUE when no cell is dirty
+ */
+Std_ReturnType lcd_fb_is_synced(const chr_lcd_fb_t * fb , uint8 * synced);
+
+#endif
+
 
 #elif CHR_LCD_4BIT_OR_8BIT_MODE_CFG == CHR_LCD_8BIT_MODE_ENABLE
 
@@ -281,12 +486,12 @@ Std_ReturnType lcd_8bit_send_char_data_pos(const chr_lcd_8bit_t * lcd , uint8 ro
 /**
  * @brief Send string to LCD in 8-bit mode
  */
-Std_ReturnType lcd_8bit_send_string(const chr_lcd_8bit_t * lcd , uint8 *str );
+Std_ReturnType lcd_8bit_send_string(const chr_lcd_8bit_t * lcd , const uint8 *str );
 
 /**
  * @brief Send string to specific position in 8-bit mode
  */
-Std_ReturnType lcd_8bit_send_string_pos(const chr_lcd_8bit_t * lcd , uint8 row , uint8 column, uint8 *str );
+Std_ReturnType lcd_8bit_send_string_pos(const chr_lcd_8bit_t * lcd , uint8 row , uint8 column, const uint8 *str );
 
 /**
  * @brief Send custom character to LCD in 8-bit mode
@@ -294,24 +499,41 @@ Std_ReturnType lcd_8bit_send_string_pos(const chr_lcd_8bit_t * lcd , uint8 row ,
 Std_ReturnType lcd_8bit_send_custom_char(const chr_lcd_8bit_t * lcd , uint8 row 
                                        , uint8 column , const uint8 _chr[] , uint8 mem_position );
 
+/**
+ * @brief Load custom characters in CGRAM in one burst , glyph n becomes character code n
+ *
+ * @param lcd         Pointer to LCD configuration structure
+ * @param glyphs      glyph_count * LCD_CGRAM_GLYPH_SIZE bytes , a const table stays in flash
+ * @param glyph_count 1 .. LCD_CGRAM_GLYPH_COUNT
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Glyphs loaded
+ *         - E_NOT_OK : Null pointer or bad glyph count
+ *
+ * @note Call it once at init , then draw the glyphs as characters 0 .. glyph_count - 1
+ *       (lcd_8bit_send_char_data_pos) instead of reloading them with
+ *       lcd_8bit_send_custom_char. The address counter is left at DDRAM 0x00.
+ */
+Std_ReturnType lcd_8bit_load_cgram(const chr_lcd_8bit_t * lcd , const uint8 *glyphs , uint8 glyph_count);
+
 #endif
 
 
 /**
- * @brief Convert uint8 value to string
+ * @brief Convert uint8 value to decimal string
  *
  * @param data Numeric value
- * @param str Pointer to output string buffer
+ * @param str Pointer to output string buffer (4 bytes)
  *
  * @return Std_ReturnType
  */
 Std_ReturnType convert_byte_to_string(uint8 data , uint8 *str);
 
 /**
- * @brief Convert uint16 value to decimal string
+ * @brief Convert uint16 value to decimal string , left aligned and space padded to 5 chars
  *
  * @param data Numeric value
- * @param str Pointer to output string buffer
+ * @param str Pointer to output string buffer (6 bytes)
  *
  * @return Std_ReturnType
  */
@@ -321,11 +543,40 @@ Std_ReturnType convert_short_to_string(uint16 data , uint8 *str);
  * @brief Convert uint32 value to decimal string
  *
  * @param data Numeric value
- * @param str Pointer to output string buffer
+ * @param str Pointer to output string buffer (11 bytes)
  *
  * @return Std_ReturnType
  */
 Std_ReturnType convert_int_to_string(uint32 data , uint8 *str);
 
+/**
+ * @brief Convert uint32 value to a right aligned fixed-width decimal field
+ *
+ * @param data     Numeric value
+ * @param width    Field width in chars
+ * @param pad_char Fill of the unused leading chars ('0' for zero padding , ' ' otherwise)
+ * @param str      Pointer to output string buffer (width + 1 bytes)
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Field written
+ *         - E_NOT_OK : Null pointer , zero width or value wider than the field (filled with '*')
+ *
+ * @note
+ * Division free like the other convert_* APIs , e.g. width 2 and '0' gives "07".
+ */
+Std_ReturnType convert_uint_to_string_fixed(uint32 data , uint8 width , uint8 pad_char , uint8 *str);
+
+/**
+ * @brief Convert a packed BCD byte (DS1307 registers) to two ASCII digits
+ *
+ * @param bcd Packed BCD value , tens in the high nibble
+ * @param str Pointer to output string buffer (3 bytes)
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Digits written
+ *         - E_NOT_OK : Null pointer or a nibble above 9
+ */
+Std_ReturnType convert_bcd_to_string(uint8 bcd , uint8 *str);
+
 #endif	/* ECU_CHR_LCD_H */
 
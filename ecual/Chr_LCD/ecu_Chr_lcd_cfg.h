@@ -72,6 +72,53 @@
  */
 #define CHR_LCD_4BIT_OR_8BIT_MODE_CFG           CHR_LCD_4BIT_MODE_ENABLE
 
+/**
+ * @def CHR_LCD_FEATURE_ENABLE / CHR_LCD_FEATURE_DISABLE
+ * @brief Values of the optional feature switches below
+ */
+#define CHR_LCD_FEATURE_ENABLE                  0X01
+#define CHR_LCD_FEATURE_DISABLE                 0X00
+
+/**
+ * @def CHR_LCD_FRAMEBUFFER_CFG
+ * @brief Non-blocking framebuffer API (4-bit mode only)
+ *
+ * @details
+ * Writes go to a RAM shadow of the display , lcd_fb_refresh() called from
+ * a periodic task sends the changed cells a few at a time.
+ */
+#define CHR_LCD_FRAMEBUFFER_CFG                 CHR_LCD_FEATURE_ENABLE
+
+/**
+ * @def CHR_LCD_ROWS / CHR_LCD_COLUMNS
+ * @brief Geometry of the display held in the framebuffer
+ */
+#define CHR_LCD_ROWS                            4
+#define CHR_LCD_COLUMNS                         20
+
+/**
+ * @def CHR_LCD_FB_CELLS_PER_REFRESH
+ * @brief Maximum cells sent to the LCD by one lcd_fb_refresh() call
+ */
+#define CHR_LCD_FB_CELLS_PER_REFRESH            8
+
+/**
+ * @def CHR_LCD_BUSY_FLAG_CFG
+ * @brief Busy-flag polling instead of fixed delays (4-bit mode only)
+ *
+ * @details
+ * Needs the LCD RW line wired to an MCU pin (chr_lcd_4bit_t lcd_rw).
+ * Every command / data byte waits for BF = 0 , and the initialization
+ * uses fixed waits only where the HD44780 cannot report BF yet.
+ */
+#define CHR_LCD_BUSY_FLAG_CFG                   CHR_LCD_FEATURE_DISABLE
+
+/**
+ * @def CHR_LCD_BUSY_POLL_MAX
+ * @brief Busy-flag reads before giving up (covers the 1.6 ms clear)
+ */
+#define CHR_LCD_BUSY_POLL_MAX                   500
+
 /* Section: Macro Functions Declarations */
 
 /* Section: Data Type Declarations */
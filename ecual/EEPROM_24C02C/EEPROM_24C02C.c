@@ -3,12 +3,12 @@
  * @brief   24C02C I2C EEPROM Driver Implementation
  *
  * @details
- * This source file implements functions for reading and writing single bytes
- * to the 24C02C EEPROM via I2C using the MSSP I2C driver.
+ * This source file implements functions for reading and writing the
+ * 24C02C EEPROM via I2C through the I2C bus selector.
  *
  * Layer      : ECUAL
  * Target MCU : PIC18F4620
- * Communication : I2C (MSSP)
+ * Communication : I2C (MSSP or software bus)
  * Author     : Abdelmoniem Ahmed
  * LinkedIn   : https://www.linkedin.com/in/abdelmoniem-ahmed/
  * Date       : 2026
@@ -16,20 +16,109 @@
 
 #include"EEPROM_24C02C.h"
 
+/* Bus the EEPROM is wired to */
+static i2c_bus_t eeprom_24c02c_bus = I2C_BUS_MSSP ;
+
+/********************** Static Function Declaration **********************/
+
+static Std_ReturnType EEPROM_24C02C_Ack_Polling(uint8 eeprom_address);
+
 /********************** Function Definitions **********************/
 
+Std_ReturnType EEPROM_24C02C_Bind_Bus(i2c_bus_t bus){
+    Std_ReturnType ret = E_OK;
+    
+    if(I2C_BUS_SOFT < bus){
+        ret = E_NOT_OK;
+    }
+    else{
+        eeprom_24c02c_bus = bus;
+    }
+    return ret;
+}
+
 Std_ReturnType EEPROM_24C02C_Write_Byte(uint8 eeprom_address , uint8 mem_address , uint8 data ){
     Std_ReturnType ret = E_NOT_OK;
        
-    ret = MSSP_I2C_Write_Byte_Register(eeprom_address , mem_address , data);
-    __delay_ms(5);    /**< Wait for EEPROM internal write cycle to complete */
+    ret = I2C_Bus_Write_Registers(eeprom_24c02c_bus , eeprom_address , mem_address , &data , 1);
+    if(E_OK == ret){
+        /* Wait for EEPROM internal write cycle to complete */
+        ret = EEPROM_24C02C_Ack_Polling(eeprom_address);
+    }
+    else{ /* Nothing */ }
     return ret;
 }
 
 Std_ReturnType EEPROM_24C02C_Read_Byte(uint8 eeprom_address , uint8 mem_address , uint8 *data ){
     Std_ReturnType ret = E_NOT_OK;
 
-    ret = MSSP_I2C_Read_Byte_Register(eeprom_address , mem_address , data);
+    ret = I2C_Bus_Read_Registers(eeprom_24c02c_bus , eeprom_address , mem_address , data , 1);
+    
+    return ret;
+}
+
+Std_ReturnType EEPROM_24C02C_Write_Block(uint8 eeprom_address , uint8 mem_address , const uint8 *data , uint8 length ){
+    Std_ReturnType ret = E_OK;
+    uint8 l_chunk = ZERO_INIT;
+    
+    if((NULL == data) || (ZERO_INIT == length) || (EEPROM_24C02C_SIZE < ((uint16)mem_address + length))){
+        ret = E_NOT_OK;
+    }
+    else{
+        while((E_OK == ret) && (ZERO_INIT < length)){
+            /* Bytes left up to the end of the current page */
+            l_chunk = EEPROM_24C02C_PAGE_SIZE - (mem_address & (EEPROM_24C02C_PAGE_SIZE - 1));
+            if(l_chunk > length){
+                l_chunk = length;
+            }
+            else{ /* Nothing */ }
+            ret = I2C_Bus_Write_Registers(eeprom_24c02c_bus , eeprom_address , mem_address , data , l_chunk);
+            if(E_OK == ret){
+                ret = EEPROM_24C02C_Ack_Polling(eeprom_address);
+            }
+            else{ /* Nothing */ }
+            mem_address += l_chunk;
+            data += l_chunk;
+            length -= l_chunk;
+        }
+    }
+    return ret;
+}
+
+Std_ReturnType EEPROM_24C02C_Read_Block(uint8 eeprom_address , uint8 mem_address , uint8 *data , uint8 length ){
+    Std_ReturnType ret = E_NOT_OK;
+    
+    if((NULL == data) || (ZERO_INIT == length) || (EEPROM_24C02C_SIZE < ((uint16)mem_address + length))){
+        ret = E_NOT_OK;
+    }
+    else{
+        /* The address counter auto-increments across pages on reads */
+        ret = I2C_Bus_Read_Registers(eeprom_24c02c_bus , eeprom_address , mem_address , data , length);
+    }
+    return ret;
+}
+
+/********************** Static Function Definitions **********************/
+
+/**
+ * @brief Probe the device address until it acknowledges (write cycle done)
+ *
+ * @param eeprom_address I2C slave address of the EEPROM
+ *
+ * @return E_OK once acknowledged , E_NOT_OK after EEPROM_24C02C_ACK_POLL_MAX probes
+ */
+static Std_ReturnType EEPROM_24C02C_Ack_Polling(uint8 eeprom_address){
+    Std_ReturnType ret = E_NOT_OK;
+    uint8 l_attempt = ZERO_INIT;
+    
+    /* The 24C02C ignores its address while the internal write cycle is running */
+    for(l_attempt = ZERO_INIT ; (l_attempt < EEPROM_24C02C_ACK_POLL_MAX) && (E_OK != ret) ; l_attempt++){
+        ret = I2C_Bus_Probe(eeprom_24c02c_bus , eeprom_address);
+    }
+    if(E_OK != ret){
+        ret = E_NOT_OK;
+    }
+    else{ /* Nothing */ }
     
     return ret;
 }
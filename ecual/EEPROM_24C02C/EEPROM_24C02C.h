@@ -4,16 +4,19 @@
  *
  * @details
  * This header file provides a high-level interface for reading and writing
- * single bytes to a 24C02C EEPROM via I2C. It uses the MSSP I2C driver
- * located in the MCAL layer.
+ * a 24C02C EEPROM via I2C. It goes through the I2C bus selector of the
+ * MCAL layer , MSSP bus unless EEPROM_24C02C_Bind_Bus picks another one.
  *
  * Features:
- *  - Write a single byte to a memory address
- *  - Read a single byte from a memory address
+ *  - Write / read a single byte to / from a memory address
+ *  - Page writes (8-byte pages) for multi-byte blocks
+ *  - Sequential multi-byte reads
+ *  - ACK polling : writes return as soon as the internal cycle finishes
+ *  - MSSP or software I2C bus
  *
  * Layer      : ECUAL
  * Target MCU : PIC18F4620
- * Communication : I2C (MSSP)
+ * Communication : I2C (MSSP or software bus)
  * Author     : Abdelmoniem Ahmed
  * LinkedIn   : https://www.linkedin.com/in/abdelmoniem-ahmed/
  * Date       : 2026
@@ -23,12 +26,33 @@
 #define	EEPROM_24C02C_H
 
 /********************** Includes **********************/
-#include"../../mcal/I2C/I2C_APIs.h"
+#include"../../mcal/I2C/I2C_Bus.h"
 
 /********************** Macro Declaration  **********************/
 
+#define EEPROM_24C02C_SIZE                  256     /* Bytes */
+#define EEPROM_24C02C_PAGE_SIZE             8       /* Bytes per page write , MUST be a power of two */
+
+/* Address probes before a write cycle is considered stuck (~100 us each @ 100 kHz , tWC = 5 ms max) */
+#define EEPROM_24C02C_ACK_POLL_MAX          100
+
 /********************** Function Declaration **********************/
 
+/**
+ * @brief Select the I2C bus the EEPROM is wired to , I2C_BUS_MSSP by default
+ *
+ * @param bus I2C_BUS_MSSP or I2C_BUS_SOFT
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Bus selected
+ *         - E_NOT_OK : Unknown bus
+ *
+ * @note
+ * On the software bus the write cycles and their ACK polling no longer
+ * hold the MSSP , sensor reads on it go on meanwhile.
+ */
+Std_ReturnType EEPROM_24C02C_Bind_Bus(i2c_bus_t bus);
+
 /**
  * @brief Write a single byte to a 24C02C EEPROM memory address
  *
@@ -41,8 +65,8 @@
  *         - E_NOT_OK : Communication failure or invalid pointer
  *
  * @note
- * A small delay (~5ms) is added after the write to allow the EEPROM
- * to complete its internal write cycle.
+ * Returns once the EEPROM acknowledges its address again , i.e. as soon
+ * as the internal write cycle has completed (ACK polling).
  */
 Std_ReturnType EEPROM_24C02C_Write_Byte(uint8 eeprom_address , uint8 mem_address , uint8 data );
 
@@ -59,5 +83,40 @@ Std_ReturnType EEPROM_24C02C_Write_Byte(uint8 eeprom_address , uint8 mem_address
  */
 Std_ReturnType EEPROM_24C02C_Read_Byte(uint8 eeprom_address , uint8 mem_address , uint8 *data );
 
+/**
+ * @brief Write a block of bytes using page writes
+ *
+ * @param eeprom_address I2C slave address of the EEPROM (0x50 or 0x51)
+ * @param mem_address    First memory address to write
+ * @param data           Pointer to the source buffer
+ * @param length         Number of bytes to write (1 - 255)
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Every page written and its write cycle completed
+ *         - E_NOT_OK : Invalid pointer / length , block runs past the end
+ *                      of the memory or communication failure
+ *
+ * @note
+ * The block is split on EEPROM_24C02C_PAGE_SIZE boundaries (the device
+ * wraps inside a page otherwise). Each page is one I2C transaction
+ * followed by ACK polling.
+ */
+Std_ReturnType EEPROM_24C02C_Write_Block(uint8 eeprom_address , uint8 mem_address , const uint8 *data , uint8 length );
+
+/**
+ * @brief Read a block of bytes with one sequential read
+ *
+ * @param eeprom_address I2C slave address of the EEPROM (0x50 or 0x51)
+ * @param mem_address    First memory address to read
+ * @param data           Pointer to the destination buffer
+ * @param length         Number of bytes to read (1 - 255)
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Read operation successful
+ *         - E_NOT_OK : Invalid pointer / length , block runs past the end
+ *                      of the memory or communication failure
+ */
+Std_ReturnType EEPROM_24C02C_Read_Block(uint8 eeprom_address , uint8 mem_address , uint8 *data , uint8 length );
+
 #endif	/* EEPROM_24C02C_H */
 
@@ -0,0 +1,185 @@
+/*
+ * @file    ecu_eeprom_log.c
+ * @brief   Wear-leveled circular record log implementation
+ *
+ * @details
+ * Implements record append / latest-record lookup over a ring of
+ * Data EEPROM slots with sequence numbers and a CRC-8 per slot.
+ *
+ * Layer: ECUAL
+ * Target MCU: PIC18F4620
+ *
+ * Author: Abdelmoniem Ahmed
+ * Linkedin: https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * Date: 2026
+ */
+
+#include "ecu_eeprom_log.h"
+
+/* Slot byte offsets */
+#define EEPROM_LOG_SEQUENCE_OFFSET          0
+#define EEPROM_LOG_RECORD_OFFSET            2
+#define EEPROM_LOG_CRC_OFFSET               (EEPROM_LOG_RECORD_OFFSET + EEPROM_LOG_RECORD_SIZE)
+
+/* Section : Static Function Declarations */
+
+static uint16 eeprom_log_slot_address(const eeprom_log_t *log , uint16 slot);
+static uint16 eeprom_log_next_sequence(uint16 sequence);
+static uint16 eeprom_log_read_sequence(const eeprom_log_t *log , uint16 slot);
+static uint8  eeprom_log_read_slot(const eeprom_log_t *log , uint16 slot , uint8 *slot_data);
+
+/* Section : Function Definitions */
+
+Std_ReturnType EEPROM_Log_Init(eeprom_log_t *log){
+    Std_ReturnType ret = E_OK;
+    uint8 l_slot_data[EEPROM_LOG_SLOT_SIZE];
+    uint16 l_candidate = ZERO_INIT;
+    uint16 l_sequence = ZERO_INIT;
+    uint16 l_slot = ZERO_INIT;
+
+    if((NULL == log) || (2 > log->slot_count) ||
+       (DATA_EEPROM_SIZE < ((uint32)log->start_address + ((uint32)log->slot_count * EEPROM_LOG_SLOT_SIZE)))){
+        ret = E_NOT_OK;
+    }
+    else{
+        log->log_empty = TRUE;
+        log->head_slot = ZERO_INIT;
+        log->head_sequence = EEPROM_LOG_ERASED_SEQUENCE;
+
+        /* Index scan : follow the consecutive sequence run that starts at slot 0 */
+        l_sequence = eeprom_log_read_sequence(log , 0);
+        if(EEPROM_LOG_ERASED_SEQUENCE == l_sequence){
+            /* Slot 0 never written , or torn while wrapping around */
+            l_candidate = log->slot_count - 1;
+        }
+        else{
+            l_candidate = ZERO_INIT;
+            for(l_slot = 1 ; (l_slot < log->slot_count) && (l_candidate == (l_slot - 1)) ; l_slot++){
+                if(eeprom_log_next_sequence(l_sequence) == eeprom_log_read_sequence(log , l_slot)){
+                    l_sequence = eeprom_log_next_sequence(l_sequence);
+                    l_candidate = l_slot;
+                }
+                else{ /* End of the run */ }
+            }
+        }
+
+        /* A torn append leaves a bad CRC : the record before it is the head */
+        if(FALSE == eeprom_log_read_slot(log , l_candidate , l_slot_data)){
+            l_candidate = (ZERO_INIT == l_candidate) ? (log->slot_count - 1) : (l_candidate - 1);
+        }
+        else{ /* Nothing */ }
+        if(TRUE == eeprom_log_read_slot(log , l_candidate , l_slot_data)){
+            log->log_empty = FALSE;
+            log->head_slot = l_candidate;
+            log->head_sequence = (uint16)l_slot_data[EEPROM_LOG_SEQUENCE_OFFSET] |
+                                 ((uint16)l_slot_data[EEPROM_LOG_SEQUENCE_OFFSET + 1] << 8);
+        }
+        else{ /* Nothing */ }
+    }
+    return ret;
+}
+
+Std_ReturnType EEPROM_Log_Append(eeprom_log_t *log , const uint8 *record){
+    Std_ReturnType ret = E_OK;
+    uint8 l_slot_data[EEPROM_LOG_SLOT_SIZE];
+    uint16 l_slot = ZERO_INIT;
+    uint16 l_sequence = ZERO_INIT;
+    uint8 l_index = ZERO_INIT;
+
+    if((NULL == log) || (NULL == record)){
+        ret = E_NOT_OK;
+    }
+    else{
+        if(TRUE == log->log_empty){
+            l_slot = ZERO_INIT;
+            l_sequence = ZERO_INIT;
+        }
+        else{
+            l_slot = ((log->head_slot + 1) < log->slot_count) ? (log->head_slot + 1) : ZERO_INIT;
+            l_sequence = eeprom_log_next_sequence(log->head_sequence);
+        }
+
+        l_slot_data[EEPROM_LOG_SEQUENCE_OFFSET]     = (uint8)(l_sequence);
+        l_slot_data[EEPROM_LOG_SEQUENCE_OFFSET + 1] = (uint8)(l_sequence >> 8);
+        for(l_index = ZERO_INIT ; l_index < EEPROM_LOG_RECORD_SIZE ; l_index++){
+            l_slot_data[EEPROM_LOG_RECORD_OFFSET + l_index] = record[l_index];
+        }
+        l_slot_data[EEPROM_LOG_CRC_OFFSET] = CRC8_Compute(CRC8_INIT , l_slot_data , EEPROM_LOG_CRC_OFFSET);
+
+        /* Written in address order : the CRC byte lands last */
+        ret = Data_EEPROM_Write_Block(eeprom_log_slot_address(log , l_slot) , l_slot_data , EEPROM_LOG_SLOT_SIZE);
+        if(E_OK == ret){
+            log->log_empty = FALSE;
+            log->head_slot = l_slot;
+            log->head_sequence = l_sequence;
+        }
+        else{ /* Nothing */ }
+    }
+    return ret;
+}
+
+Std_ReturnType EEPROM_Log_Read_Latest(const eeprom_log_t *log , uint8 *record){
+    Std_ReturnType ret = E_OK;
+    uint8 l_slot_data[EEPROM_LOG_SLOT_SIZE];
+    uint8 l_index = ZERO_INIT;
+
+    if((NULL == log) || (NULL == record) || (TRUE == log->log_empty)){
+        ret = E_NOT_OK;
+    }
+    else if(FALSE == eeprom_log_read_slot(log , log->head_slot , l_slot_data)){
+        ret = E_NOT_OK;
+    }
+    else{
+        for(l_index = ZERO_INIT ; l_index < EEPROM_LOG_RECORD_SIZE ; l_index++){
+            record[l_index] = l_slot_data[EEPROM_LOG_RECORD_OFFSET + l_index];
+        }
+    }
+    return ret;
+}
+
+/* Section : Static Function Definitions */
+
+static uint16 eeprom_log_slot_address(const eeprom_log_t *log , uint16 slot){
+    return (uint16)(log->start_address + (slot * EEPROM_LOG_SLOT_SIZE));
+}
+
+/**
+ * @brief Next sequence number , 0xFFFF is skipped since it marks an erased slot
+ */
+static uint16 eeprom_log_next_sequence(uint16 sequence){
+    sequence++;
+    if(EEPROM_LOG_ERASED_SEQUENCE == sequence){
+        sequence = ZERO_INIT;
+    }
+    else{ /* Nothing */ }
+    return sequence;
+}
+
+static uint16 eeprom_log_read_sequence(const eeprom_log_t *log , uint16 slot){
+    uint16 l_address = eeprom_log_slot_address(log , slot) + EEPROM_LOG_SEQUENCE_OFFSET;
+    uint8 l_low = ZERO_INIT;
+    uint8 l_high = ZERO_INIT;
+
+    (void)Data_EEPROM_Read_Byte(l_address , &l_low);
+    (void)Data_EEPROM_Read_Byte(l_address + 1 , &l_high);
+    return (uint16)l_low | ((uint16)l_high << 8);
+}
+
+/**
+ * @brief Read a whole slot , TRUE when it holds a written record with a good CRC
+ */
+static uint8 eeprom_log_read_slot(const eeprom_log_t *log , uint16 slot , uint8 *slot_data){
+    uint16 l_address = eeprom_log_slot_address(log , slot);
+    uint8 l_valid = FALSE;
+    uint8 l_index = ZERO_INIT;
+
+    for(l_index = ZERO_INIT ; l_index < EEPROM_LOG_SLOT_SIZE ; l_index++){
+        (void)Data_EEPROM_Read_Byte(l_address + l_index , &slot_data[l_index]);
+    }
+    if(((EEPROM_LOG_ERASED_SEQUENCE & 0xFF) != slot_data[EEPROM_LOG_SEQUENCE_OFFSET]) ||
+       ((EEPROM_LOG_ERASED_SEQUENCE >> 8) != slot_data[EEPROM_LOG_SEQUENCE_OFFSET + 1])){
+        l_valid = (CRC8_Compute(CRC8_INIT , slot_data , EEPROM_LOG_CRC_OFFSET) == slot_data[EEPROM_LOG_CRC_OFFSET]) ? TRUE : FALSE;
+    }
+    else{ /* Nothing */ }
+    return l_valid;
+}
@@ -0,0 +1,110 @@
+/*
+ * @file    ecu_eeprom_log.h
+ * @brief   Wear-leveled circular record log on the internal Data EEPROM
+ *
+ * @details
+ * Stores fixed-size records in a ring of slots inside the PIC18F4620
+ * Data EEPROM (hal_eeprom). Every append goes to the next slot, so the
+ * write cycles are spread over the whole area instead of hitting the
+ * same cells.
+ *
+ * Slot layout (EEPROM_LOG_SLOT_SIZE bytes):
+ *  - sequence : 2 bytes , incremented on every append (0xFFFF = erased)
+ *  - record   : EEPROM_LOG_RECORD_SIZE bytes of user data
+ *  - crc      : CRC-8 over sequence + record
+ *
+ * At boot only the sequence numbers are scanned to find the head :
+ * the newest slot is the last one of the consecutive sequence run.
+ *
+ * Layer: ECUAL
+ * Target MCU: PIC18F4620
+ *
+ * Author: Abdelmoniem Ahmed
+ * Linkedin: https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * Date: 2026
+ */
+
+#ifndef ECU_EEPROM_LOG_H
+#define	ECU_EEPROM_LOG_H
+
+/* Section : Includes */
+#include"../../mcal/EEPROM/hal_eeprom.h"
+#include"../CRC/ecu_crc.h"
+
+/* Section : Macro Declaration */
+
+/* User data bytes per record */
+#define EEPROM_LOG_RECORD_SIZE              5
+
+/* Sequence (2) + record + CRC-8 (1) */
+#define EEPROM_LOG_SLOT_SIZE                (EEPROM_LOG_RECORD_SIZE + 3)
+
+/* Sequence number of a never written (erased) slot */
+#define EEPROM_LOG_ERASED_SEQUENCE          0xFFFFU
+
+/* Section : Data Types Declarations */
+
+/**
+ * @struct eeprom_log_t
+ * @brief Log area configuration and runtime head
+ *
+ * @details
+ * - start_address : First Data EEPROM address of the area
+ * - slot_count    : Number of slots (area = slot_count * EEPROM_LOG_SLOT_SIZE bytes) , 2 at least
+ * - head_slot / head_sequence / log_empty : Filled by EEPROM_Log_Init , do not modify
+ */
+typedef struct{
+    uint16 start_address ;
+    uint16 slot_count ;
+    uint16 head_slot ;
+    uint16 head_sequence ;
+    uint8  log_empty ;
+}eeprom_log_t;
+
+/* Section : Function Declarations */
+
+/**
+ * @brief Locate the newest valid record of the log area
+ *
+ * @param log Pointer to the log descriptor (start_address , slot_count set)
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Head located (or the area is empty)
+ *         - E_NOT_OK : Null pointer or area outside the Data EEPROM
+ *
+ * @note
+ * Reads the sequence numbers only , plus the CRC check of the head slot.
+ * A slot torn by a reset during an append fails its CRC and the head
+ * falls back to the previous record.
+ */
+Std_ReturnType EEPROM_Log_Init(eeprom_log_t *log);
+
+/**
+ * @brief Append a record in the slot after the head
+ *
+ * @param log    Pointer to an initialized log descriptor
+ * @param record Pointer to EEPROM_LOG_RECORD_SIZE bytes
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Record written , it is the new head
+ *         - E_NOT_OK : Null pointer or EEPROM write failure
+ *
+ * @note
+ * Blocking , one write cycle (~4 ms) per byte that differs from the
+ * slot's previous contents.
+ */
+Std_ReturnType EEPROM_Log_Append(eeprom_log_t *log , const uint8 *record);
+
+/**
+ * @brief Read the newest record
+ *
+ * @param log    Pointer to an initialized log descriptor
+ * @param record Pointer to EEPROM_LOG_RECORD_SIZE bytes
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Record copied
+ *         - E_NOT_OK : Null pointer , empty log or CRC mismatch
+ */
+Std_ReturnType EEPROM_Log_Read_Latest(const eeprom_log_t *log , uint8 *record);
+
+#endif	/* ECU_EEPROM_LOG_H */
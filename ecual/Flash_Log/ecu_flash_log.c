@@ -0,0 +1,266 @@
+/*
+ * @file    ecu_flash_log.c
+ * @brief   Append-only record log in a program flash area implementation
+ *
+ * @details
+ * Implements record append / read by age over a ring of flash rows with
+ * sequence numbers and a CRC-8 per slot. The current row lives in RAM
+ * and is written through Flash_Write_Block , which erases a row only
+ * when a bit has to go back to 1.
+ *
+ * Sequence numbers run modulo FLASH_LOG_SEQUENCE_MODULO : 0xFFFF is never
+ * used , it is what an erased slot reads.
+ *
+ * Layer: ECUAL
+ * Target MCU: PIC18F4620
+ *
+ * Author: Abdelmoniem Ahmed
+ * Linkedin: https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * Date: 2026
+ */
+
+#include "ecu_flash_log.h"
+
+/* Slot byte offsets */
+#define FLASH_LOG_SEQUENCE_OFFSET           0
+#define FLASH_LOG_RECORD_OFFSET             2
+#define FLASH_LOG_CRC_OFFSET                (FLASH_LOG_RECORD_OFFSET + FLASH_LOG_RECORD_SIZE)
+
+/* 0x0000 .. 0xFFFE */
+#define FLASH_LOG_SEQUENCE_MODULO           0xFFFFUL
+
+/* Section : Static Function Declarations */
+
+static uint32 flash_log_row_address(const flash_log_t *log , uint16 row);
+static uint16 flash_log_sequence_back(uint16 sequence , uint16 steps);
+static uint8  flash_log_is_newer(uint16 sequence , uint16 reference);
+static uint8  flash_log_slot_valid(const uint8 *slot_data , uint16 *sequence);
+static void   flash_log_open_row(flash_log_t *log , uint16 row);
+
+/* Section : Function Definitions */
+
+Std_ReturnType Flash_Log_Init(flash_log_t *log){
+    Std_ReturnType ret = E_OK;
+    uint8 l_slot_data[FLASH_LOG_SLOT_SIZE];
+    uint16 l_sequence = ZERO_INIT;
+    uint16 l_row = ZERO_INIT;
+    uint8 l_slot = ZERO_INIT;
+
+    if((NULL == log) || (2 > log->row_count) || (ZERO_INIT != (log->start_address & FLASH_ROW_MASK)) ||
+       (FLASH_SIZE < (log->start_address + ((uint32)log->row_count * FLASH_ROW_SIZE)))){
+        ret = E_NOT_OK;
+    }
+    else{
+        log->log_empty = TRUE;
+        log->head_row = ZERO_INIT;
+        log->head_slot = ZERO_INIT;
+        log->head_sequence = FLASH_LOG_ERASED_SEQUENCE;
+        log->row_dirty = FALSE;
+
+        /* Row scan : the newest first slot marks the head row */
+        for(l_row = ZERO_INIT ; l_row < log->row_count ; l_row++){
+            (void)Flash_Read_Block(flash_log_row_address(log , l_row) , l_slot_data , FLASH_LOG_SLOT_SIZE);
+            if((TRUE == flash_log_slot_valid(l_slot_data , &l_sequence)) &&
+               ((TRUE == log->log_empty) || (TRUE == flash_log_is_newer(l_sequence , log->head_sequence)))){
+                log->log_empty = FALSE;
+                log->head_row = l_row;
+                log->head_sequence = l_sequence;
+            }
+            else{ /* Erased , torn or older */ }
+        }
+
+        if(FALSE == log->log_empty){
+            /* Follow the consecutive sequence run inside the head row */
+            (void)Flash_Read_Block(flash_log_row_address(log , log->head_row) , log->row_buffer , FLASH_ROW_SIZE);
+            for(l_slot = 1 ; (l_slot < FLASH_LOG_SLOTS_PER_ROW) && (l_slot == (log->head_slot + 1)) ; l_slot++){
+                if((TRUE == flash_log_slot_valid(&log->row_buffer[l_slot * FLASH_LOG_SLOT_SIZE] , &l_sequence)) &&
+                   (flash_log_sequence_back(l_sequence , 1) == log->head_sequence)){
+                    log->head_slot = l_slot;
+                    log->head_sequence = l_sequence;
+                }
+                else{ /* End of the run */ }
+            }
+            /* A torn slot after the head is rewritten with the next row write */
+            (void)memset(&log->row_buffer[(log->head_slot + 1) * FLASH_LOG_SLOT_SIZE] , FLASH_ERASED_BYTE ,
+                         (FLASH_LOG_SLOTS_PER_ROW - 1 - log->head_slot) * FLASH_LOG_SLOT_SIZE);
+        }
+        else{
+            flash_log_open_row(log , ZERO_INIT);
+        }
+    }
+    return ret;
+}
+
+Std_ReturnType Flash_Log_Append(flash_log_t *log , const uint8 *record){
+    Std_ReturnType ret = E_OK;
+    uint8 *l_slot_data = NULL;
+    uint16 l_sequence = ZERO_INIT;
+    uint8 l_slot = ZERO_INIT;
+
+    if((NULL == log) || (NULL == record)){
+        ret = E_NOT_OK;
+    }
+    else{
+        if(TRUE == log->log_empty){
+            l_slot = ZERO_INIT;
+            l_sequence = ZERO_INIT;
+        }
+        else{
+            l_sequence = (uint16)(((uint32)log->head_sequence + 1) % FLASH_LOG_SEQUENCE_MODULO);
+            if((log->head_slot + 1) < FLASH_LOG_SLOTS_PER_ROW){
+                l_slot = log->head_slot + 1;
+            }
+            else{
+                /* Head row full , its write may have failed : retry before it leaves RAM */
+                ret = Flash_Log_Flush(log);
+                if(E_OK == ret){
+                    /* The oldest row is reused */
+                    flash_log_open_row(log , ((log->head_row + 1) < log->row_count) ? (log->head_row + 1) : ZERO_INIT);
+                }
+                else{ /* Nothing */ }
+                l_slot = ZERO_INIT;
+            }
+        }
+    }
+    if(E_OK == ret){
+        l_slot_data = &log->row_buffer[l_slot * FLASH_LOG_SLOT_SIZE];
+        l_slot_data[FLASH_LOG_SEQUENCE_OFFSET]     = (uint8)(l_sequence);
+        l_slot_data[FLASH_LOG_SEQUENCE_OFFSET + 1] = (uint8)(l_sequence >> 8);
+        (void)memcpy(&l_slot_data[FLASH_LOG_RECORD_OFFSET] , record , FLASH_LOG_RECORD_SIZE);
+        l_slot_data[FLASH_LOG_CRC_OFFSET] = CRC8_Compute(CRC8_INIT , l_slot_data , FLASH_LOG_CRC_OFFSET);
+
+        log->log_empty = FALSE;
+        log->head_slot = l_slot;
+        log->head_sequence = l_sequence;
+        log->row_dirty = TRUE;
+
+        /* A full row is programmed at once , one cycle for the whole row */
+        if((FLASH_LOG_SLOTS_PER_ROW - 1) == l_slot){
+            ret = Flash_Log_Flush(log);
+        }
+        else{ /* Stays in RAM */ }
+    }
+    return ret;
+}
+
+Std_ReturnType Flash_Log_Flush(flash_log_t *log){
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == log){
+        ret = E_NOT_OK;
+    }
+    else if(TRUE == log->row_dirty){
+        /* Erases first when the row still holds the records of the previous lap */
+        ret = Flash_Write_Block(flash_log_row_address(log , log->head_row) , log->row_buffer , FLASH_ROW_SIZE);
+        log->row_dirty = (E_OK == ret) ? FALSE : TRUE;
+    }
+    else{ /* Nothing buffered */ }
+    return ret;
+}
+
+Std_ReturnType Flash_Log_Read(const flash_log_t *log , uint16 age , uint8 *record){
+    Std_ReturnType ret = E_OK;
+    uint8 l_slot_data[FLASH_LOG_SLOT_SIZE];
+    const uint8 *l_source = l_slot_data;
+    uint32 l_total = ZERO_INIT;
+    uint32 l_position = ZERO_INIT;
+    uint16 l_row = ZERO_INIT;
+    uint16 l_sequence = ZERO_INIT;
+
+    if((NULL == log) || (NULL == record) || (TRUE == log->log_empty)){
+        ret = E_NOT_OK;
+    }
+    else{
+        l_total = (uint32)log->row_count * FLASH_LOG_SLOTS_PER_ROW;
+        if(l_total <= age){
+            ret = E_NOT_OK;
+        }
+        else{
+            l_position = ((uint32)log->head_row * FLASH_LOG_SLOTS_PER_ROW) + log->head_slot;
+            l_position = (l_position + l_total - age) % l_total;
+            l_row = (uint16)(l_position / FLASH_LOG_SLOTS_PER_ROW);
+            if(log->head_row == l_row){
+                /* The head row may hold records not programmed yet */
+                l_source = &log->row_buffer[(l_position % FLASH_LOG_SLOTS_PER_ROW) * FLASH_LOG_SLOT_SIZE];
+            }
+            else{
+                (void)Flash_Read_Block(flash_log_row_address(log , l_row) +
+                                       ((l_position % FLASH_LOG_SLOTS_PER_ROW) * FLASH_LOG_SLOT_SIZE) ,
+                                       l_slot_data , FLASH_LOG_SLOT_SIZE);
+            }
+            /* A slot of an older lap or a torn one ends the log */
+            if((FALSE == flash_log_slot_valid(l_source , &l_sequence)) ||
+               (flash_log_sequence_back(log->head_sequence , age) != l_sequence)){
+                ret = E_NOT_OK;
+            }
+            else{
+                (void)memcpy(record , &l_source[FLASH_LOG_RECORD_OFFSET] , FLASH_LOG_RECORD_SIZE);
+            }
+        }
+    }
+    return ret;
+}
+
+Std_ReturnType Flash_Log_Erase(flash_log_t *log){
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == log){
+        ret = E_NOT_OK;
+    }
+    else{
+        ret = Flash_Erase_Block(log->start_address , log->row_count);
+        log->log_empty = TRUE;
+        log->head_row = ZERO_INIT;
+        log->head_slot = ZERO_INIT;
+        log->head_sequence = FLASH_LOG_ERASED_SEQUENCE;
+        flash_log_open_row(log , ZERO_INIT);
+    }
+    return ret;
+}
+
+/* Section : Static Function Definitions */
+
+static uint32 flash_log_row_address(const flash_log_t *log , uint16 row){
+    return log->start_address + ((uint32)row * FLASH_ROW_SIZE);
+}
+
+/**
+ * @brief Sequence number steps appends before sequence
+ */
+static uint16 flash_log_sequence_back(uint16 sequence , uint16 steps){
+    return (uint16)(((uint32)sequence + FLASH_LOG_SEQUENCE_MODULO - (steps % FLASH_LOG_SEQUENCE_MODULO)) % FLASH_LOG_SEQUENCE_MODULO);
+}
+
+/**
+ * @brief TRUE when sequence was appended after reference , serial number
+ *        order : the area holds far fewer slots than half the modulo
+ */
+static uint8 flash_log_is_newer(uint16 sequence , uint16 reference){
+    uint32 l_distance = ((uint32)sequence + FLASH_LOG_SEQUENCE_MODULO - reference) % FLASH_LOG_SEQUENCE_MODULO;
+
+    return ((ZERO_INIT != l_distance) && (l_distance < (FLASH_LOG_SEQUENCE_MODULO / 2))) ? TRUE : FALSE;
+}
+
+/**
+ * @brief TRUE when the slot holds a written record with a good CRC
+ */
+static uint8 flash_log_slot_valid(const uint8 *slot_data , uint16 *sequence){
+    uint8 l_valid = FALSE;
+
+    *sequence = (uint16)slot_data[FLASH_LOG_SEQUENCE_OFFSET] |
+                ((uint16)slot_data[FLASH_LOG_SEQUENCE_OFFSET + 1] << 8);
+    if(FLASH_LOG_ERASED_SEQUENCE != *sequence){
+        l_valid = (CRC8_Compute(CRC8_INIT , slot_data , FLASH_LOG_CRC_OFFSET) == slot_data[FLASH_LOG_CRC_OFFSET]) ? TRUE : FALSE;
+    }
+    else{ /* Nothing */ }
+    return l_valid;
+}
+
+/**
+ * @brief Make row the head row with an empty buffer , its flash copy is
+ *        erased by the first Flash_Log_Flush when needed
+ */
+static void flash_log_open_row(flash_log_t *log , uint16 row){
+    log->head_row = row;
+    (void)memset(log->row_buffer , FLASH_ERASED_BYTE , FLASH_ROW_SIZE);
+}
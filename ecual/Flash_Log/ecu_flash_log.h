@@ -0,0 +1,148 @@
+/*
+ * @file    ecu_flash_log.h
+ * @brief   Append-only record log in a program flash area
+ *
+ * @details
+ * Stores fixed-size records in a ring of 64-byte flash rows (hal_flash).
+ * Records are collected in a RAM copy of the current row and the row is
+ * programmed once it is full (one ~2 ms cycle per FLASH_LOG_SLOTS_PER_ROW
+ * records) or on Flash_Log_Flush(). Opening a row erases it , that drops
+ * the oldest row once the area has wrapped.
+ *
+ * Slot layout (FLASH_LOG_SLOT_SIZE bytes , a divisor of 64):
+ *  - sequence : 2 bytes , incremented on every append (0xFFFF = erased)
+ *  - record   : FLASH_LOG_RECORD_SIZE bytes of user data
+ *  - crc      : CRC-8 over sequence + record
+ *
+ * At boot the first slot of every row is read to find the newest row ,
+ * then that row is walked to its last record.
+ *
+ * Layer: ECUAL
+ * Target MCU: PIC18F4620
+ *
+ * Author: Abdelmoniem Ahmed
+ * Linkedin: https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * Date: 2026
+ */
+
+#ifndef ECU_FLASH_LOG_H
+#define	ECU_FLASH_LOG_H
+
+/* Section : Includes */
+#include"../../mcal/Flash/hal_flash.h"
+#include"../CRC/ecu_crc.h"
+
+/* Section : Macro Declaration */
+
+/* User data bytes per record */
+#define FLASH_LOG_RECORD_SIZE               5
+
+/* Sequence (2) + record + CRC-8 (1) */
+#define FLASH_LOG_SLOT_SIZE                 (FLASH_LOG_RECORD_SIZE + 3)
+#define FLASH_LOG_SLOTS_PER_ROW             (FLASH_ROW_SIZE / FLASH_LOG_SLOT_SIZE)
+
+#if (FLASH_ROW_SIZE % FLASH_LOG_SLOT_SIZE)
+#error "FLASH_LOG_SLOT_SIZE must divide FLASH_ROW_SIZE (record size 1 , 5 , 13 , 29 or 61)"
+#endif
+
+/* Sequence number of a never written (erased) slot */
+#define FLASH_LOG_ERASED_SEQUENCE           0xFFFFU
+
+/* Section : Data Types Declarations */
+
+/**
+ * @struct flash_log_t
+ * @brief Log area configuration , runtime head and row buffer
+ *
+ * @details
+ * - start_address : First flash address of the area , row aligned , kept
+ *                   out of the code by the linker (e.g. --rom=default,-C000-FFFF)
+ * - row_count     : Number of rows (area = row_count * 64 bytes) , 2 at least
+ * - head_row / head_slot / head_sequence / log_empty / row_dirty / row_buffer :
+ *                   Filled by Flash_Log_Init , do not modify
+ */
+typedef struct{
+    uint32 start_address ;
+    uint16 row_count ;
+    uint16 head_row ;
+    uint8  head_slot ;
+    uint16 head_sequence ;
+    uint8  log_empty ;
+    uint8  row_dirty ;
+    uint8  row_buffer[FLASH_ROW_SIZE] ;
+}flash_log_t;
+
+/* Section : Function Declarations */
+
+/**
+ * @brief Locate the newest record of the log area
+ *
+ * @param log Pointer to the log descriptor (start_address , row_count set)
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Head located (or the area is empty)
+ *         - E_NOT_OK : Null pointer , area not row aligned or outside the flash
+ *
+ * @note
+ * A slot torn by a reset during a row write fails its CRC , the head is
+ * the record before it. The next row write rewrites the torn row.
+ */
+Std_ReturnType Flash_Log_Init(flash_log_t *log);
+
+/**
+ * @brief Append a record after the head
+ *
+ * @param log    Pointer to an initialized log descriptor
+ * @param record Pointer to FLASH_LOG_RECORD_SIZE bytes
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Record buffered (and its row programmed when full)
+ *         - E_NOT_OK : Null pointer or flash write failure
+ *
+ * @note
+ * Only the record filling a row costs a ~2 ms write cycle (plus one
+ * erase cycle when the row that follows is opened). Records still in
+ * the row buffer are lost on reset until Flash_Log_Flush().
+ */
+Std_ReturnType Flash_Log_Append(flash_log_t *log , const uint8 *record);
+
+/**
+ * @brief Program the buffered records of the current row
+ *
+ * @param log Pointer to an initialized log descriptor
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Nothing buffered , or row programmed and verified
+ *         - E_NOT_OK : Null pointer or flash write failure
+ *
+ * @note
+ * The rest of the row stays erased , later appends are programmed over
+ * it without an erase.
+ */
+Std_ReturnType Flash_Log_Flush(flash_log_t *log);
+
+/**
+ * @brief Read a record by age
+ *
+ * @param log    Pointer to an initialized log descriptor
+ * @param age    0 = newest , 1 = the one before , ...
+ * @param record Pointer to FLASH_LOG_RECORD_SIZE bytes
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Record copied
+ *         - E_NOT_OK : Null pointer , older than the oldest record or CRC mismatch
+ */
+Std_ReturnType Flash_Log_Read(const flash_log_t *log , uint16 age , uint8 *record);
+
+/**
+ * @brief Empty the log , every row of the area is erased
+ *
+ * @param log Pointer to an initialized log descriptor
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Area erased
+ *         - E_NOT_OK : Null pointer or erase failure
+ */
+Std_ReturnType Flash_Log_Erase(flash_log_t *log);
+
+#endif	/* ECU_FLASH_LOG_H */
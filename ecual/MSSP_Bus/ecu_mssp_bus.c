@@ -0,0 +1,167 @@
+/*
+ * @file    ecu_mssp_bus.c
+ * @brief   MSSP ownership and transaction queue implementation
+ *
+ * @details
+ * Ring of descriptor pointers , head / tail free-running 8-bit indexes.
+ * Transactions are only run from MSSP_Bus_Process() , never from an ISR.
+ *
+ * Layer: ECUAL
+ * Target MCU: PIC18F4620
+ *
+ * Author: Abdelmoniem Ahmed
+ * Linkedin: https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * Date: 2026
+ */
+
+#include "ecu_mssp_bus.h"
+
+/* Section : Static Function Declarations */
+
+static Std_ReturnType mssp_bus_switch(mssp_bus_protocol_t protocol);
+static uint8 mssp_bus_interrupt_transfer_running(void);
+
+/* Section : Static Variables */
+
+static SPSC_QUEUE_TYPE(mssp_bus_transaction_t * , MSSP_BUS_QUEUE_SIZE) mssp_bus_queue;
+static mssp_spi_t *mssp_bus_spi_cfg = NULL;
+static const mssp_i2c_t *mssp_bus_i2c_cfg = NULL;
+static mssp_bus_protocol_t mssp_bus_protocol = MSSP_BUS_PROTOCOL_NONE;
+
+/* Section : Function Definitions */
+
+Std_ReturnType MSSP_Bus_Init(mssp_spi_t *spi_cfg , const mssp_i2c_t *i2c_cfg){
+    Std_ReturnType ret = E_OK;
+
+    if((NULL == spi_cfg) && (NULL == i2c_cfg)){
+        ret = E_NOT_OK;
+    }
+    else{
+        mssp_bus_spi_cfg = spi_cfg;
+        mssp_bus_i2c_cfg = i2c_cfg;
+        SPSC_QUEUE_RESET(mssp_bus_queue);
+        mssp_bus_protocol = MSSP_BUS_PROTOCOL_NONE;
+    }
+    return ret;
+}
+
+Std_ReturnType MSSP_Bus_Submit(mssp_bus_transaction_t *transaction){
+    Std_ReturnType ret = E_OK;
+
+    if((NULL == transaction) || (NULL == transaction->run) ||
+       (MSSP_BUS_TRANSACTION_PENDING == transaction->status) ||
+       ((MSSP_BUS_PROTOCOL_SPI == transaction->protocol) && (NULL == mssp_bus_spi_cfg)) ||
+       ((MSSP_BUS_PROTOCOL_I2C == transaction->protocol) && (NULL == mssp_bus_i2c_cfg)) ||
+       ((MSSP_BUS_PROTOCOL_SPI != transaction->protocol) && (MSSP_BUS_PROTOCOL_I2C != transaction->protocol))){
+        ret = E_NOT_OK;
+    }
+    else if(SPSC_QUEUE_IS_FULL(mssp_bus_queue)){
+        ret = E_NOT_OK;
+    }
+    else{
+        transaction->status = MSSP_BUS_TRANSACTION_PENDING;
+        transaction->result = E_OK;
+        SPSC_QUEUE_BACK(mssp_bus_queue) = transaction;
+        SPSC_QUEUE_PUBLISH(mssp_bus_queue , 1);
+    }
+    return ret;
+}
+
+Std_ReturnType MSSP_Bus_Process(void){
+    Std_ReturnType ret = E_OK;
+    mssp_bus_transaction_t *l_transaction = NULL;
+
+    while((!SPSC_QUEUE_IS_EMPTY(mssp_bus_queue)) && (0 == mssp_bus_interrupt_transfer_running())){
+        l_transaction = SPSC_QUEUE_FRONT(mssp_bus_queue);
+        SPSC_QUEUE_RELEASE(mssp_bus_queue);
+
+        l_transaction->result = mssp_bus_switch(l_transaction->protocol);
+        if(E_OK == l_transaction->result){
+            l_transaction->result = l_transaction->run(l_transaction);
+        }
+        else{ /* Mode switch failed , nothing sent */ }
+
+        if(E_OK == l_transaction->result){
+            l_transaction->status = MSSP_BUS_TRANSACTION_DONE;
+        }
+        else{
+            l_transaction->status = MSSP_BUS_TRANSACTION_FAILED;
+            ret = E_NOT_OK;
+        }
+        if(NULL != l_transaction->complete){
+            l_transaction->complete(l_transaction);
+        }
+        else{ /* Nothing */ }
+    }
+    return ret;
+}
+
+Std_ReturnType MSSP_Bus_Is_Idle(uint8 *is_idle){
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == is_idle){
+        ret = E_NOT_OK;
+    }
+    else{
+        *is_idle = SPSC_QUEUE_IS_EMPTY(mssp_bus_queue) ? TRUE : FALSE;
+    }
+    return ret;
+}
+
+/* Section : Static Function Definitions */
+
+/**
+ * @brief Put the MSSP in the protocol of the next transaction , no-op if already there
+ */
+static Std_ReturnType mssp_bus_switch(mssp_bus_protocol_t protocol){
+    Std_ReturnType ret = E_OK;
+
+    if(protocol != mssp_bus_protocol){
+        if(MSSP_BUS_PROTOCOL_SPI == mssp_bus_protocol){
+            ret = MSSP_SPI_DeInit(mssp_bus_spi_cfg);
+        }
+        else if(MSSP_BUS_PROTOCOL_I2C == mssp_bus_protocol){
+            ret = MSSP_I2C_DeInit(mssp_bus_i2c_cfg);
+        }
+        else{ /* Not owned yet */ }
+
+        if(MSSP_BUS_PROTOCOL_SPI == protocol){
+            ret &= MSSP_SPI_Init(mssp_bus_spi_cfg);
+        }
+        else{
+            ret &= MSSP_I2C_Init(mssp_bus_i2c_cfg);
+        }
+        mssp_bus_protocol = (E_OK == ret) ? protocol : MSSP_BUS_PROTOCOL_NONE;
+    }
+    else{ /* Same protocol , back-to-back */ }
+    return ret;
+}
+
+/**
+ * @brief An interrupt-driven SPI or I2C transfer still owns the MSSP
+ */
+static uint8 mssp_bus_interrupt_transfer_running(void){
+    uint8 l_running = 0;
+#if INTERRUPT_FEATURE_ENABLE == MSSP_SPI_INTERRUPT_FEATURE_ENABLE
+    uint8 l_busy = 0;
+#endif
+#if INTERRUPT_FEATURE_ENABLE == MSSP_I2C_INTERRUPT_FEATURE_ENABLE
+    uint8 l_idle = TRUE;
+#endif
+
+#if INTERRUPT_FEATURE_ENABLE == MSSP_SPI_INTERRUPT_FEATURE_ENABLE
+    if(MSSP_BUS_PROTOCOL_SPI == mssp_bus_protocol){
+        (void)MSSP_SPI_Transfer_Is_Busy(&l_busy);
+        l_running = l_busy;
+    }
+    else{ /* Nothing */ }
+#endif
+#if INTERRUPT_FEATURE_ENABLE == MSSP_I2C_INTERRUPT_FEATURE_ENABLE
+    if(MSSP_BUS_PROTOCOL_I2C == mssp_bus_protocol){
+        (void)MSSP_I2C_Master_Is_Idle(&l_idle);
+        l_running = (TRUE == l_idle) ? 0 : 1;
+    }
+    else{ /* Nothing */ }
+#endif
+    return l_running;
+}
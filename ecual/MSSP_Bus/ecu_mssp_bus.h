@@ -0,0 +1,137 @@
+/*
+ * @file    ecu_mssp_bus.h
+ * @brief   MSSP ownership and transaction queue shared by SPI and I2C users
+ *
+ * @details
+ * SPI and I2C share the MSSP module and the RC3 / RC4 pins. Instead of
+ * every ECUAL driver running a full MSSP_SPI_Init() / MSSP_I2C_Init()
+ * before it talks , drivers queue transactions here :
+ *  - A transaction names its protocol and a run function that performs
+ *    the bus work with the blocking MCAL APIs (MSSP_SPI_Transfer ,
+ *    MSSP_I2C_Read_Registers , ...)
+ *  - MSSP_Bus_Process() runs the queue back-to-back in submission order ,
+ *    and re-initializes the MSSP only when the protocol changes between
+ *    two transactions
+ *
+ * The mode is never switched while an interrupt-driven SPI or I2C
+ * transfer still runs , the queue waits for the next call.
+ *
+ * Layer: ECUAL
+ * Target MCU: PIC18F4620
+ *
+ * Author: Abdelmoniem Ahmed
+ * Linkedin: https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * Date: 2026
+ */
+
+#ifndef ECU_MSSP_BUS_H
+#define	ECU_MSSP_BUS_H
+
+/* Section : Includes */
+#include"../../mcal/SPI/SPI_APIs.h"
+#include"../../mcal/I2C/I2C_APIs.h"
+
+/* Section : Macro Declaration */
+
+/* Pending transactions , power of two (2 .. 128) */
+#define MSSP_BUS_QUEUE_SIZE                 8
+
+#if !SPSC_QUEUE_SIZE_VALID(MSSP_BUS_QUEUE_SIZE)
+#error "MSSP_BUS_QUEUE_SIZE must be a power of two between 2 and 128"
+#endif
+
+/* Section : Data Types Declarations */
+
+/**
+ * @brief Protocol a transaction needs the MSSP in
+ */
+typedef enum{
+    MSSP_BUS_PROTOCOL_NONE = 0 ,        /* MSSP not owned yet (internal) */
+    MSSP_BUS_PROTOCOL_SPI ,
+    MSSP_BUS_PROTOCOL_I2C
+}mssp_bus_protocol_t;
+
+/**
+ * @brief Transaction status
+ */
+typedef enum{
+    MSSP_BUS_TRANSACTION_IDLE = 0 ,     /* Never submitted */
+    MSSP_BUS_TRANSACTION_PENDING ,      /* Queued or running */
+    MSSP_BUS_TRANSACTION_DONE ,         /* run returned E_OK */
+    MSSP_BUS_TRANSACTION_FAILED         /* run or the mode switch failed */
+}mssp_bus_status_t;
+
+/**
+ * @brief One bus transaction , owned by the submitting driver
+ *
+ * @details
+ * - run      : Performs the bus work , the MSSP is already in `protocol`
+ * - complete : Optional , called after run from MSSP_Bus_Process()
+ * - context  : Free for the driver (buffers , device entry , ...)
+ *
+ * The descriptor must stay valid until `status` leaves PENDING.
+ */
+typedef struct mssp_bus_transaction_s{
+    Std_ReturnType (* run)(struct mssp_bus_transaction_s *transaction);
+    void (* complete)(struct mssp_bus_transaction_s *transaction);
+    void *context ;
+    mssp_bus_protocol_t protocol ;
+    Std_ReturnType result ;
+    volatile mssp_bus_status_t status ;
+}mssp_bus_transaction_t;
+
+/* Section : Function Declarations */
+
+/**
+ * @brief Register the SPI and I2C configurations the bus switches between
+ *
+ * @param spi_cfg SPI configuration , NULL if no SPI user
+ * @param i2c_cfg I2C configuration , NULL if no I2C user
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Bus ready , empty queue , MSSP mode set on the first transaction
+ *         - E_NOT_OK : Both configurations NULL
+ *
+ * @note The MSSP belongs to the bus from now on : drivers no longer call
+ *       MSSP_SPI_Init() / MSSP_I2C_Init() themselves.
+ */
+Std_ReturnType MSSP_Bus_Init(mssp_spi_t *spi_cfg , const mssp_i2c_t *i2c_cfg);
+
+/**
+ * @brief Queue a transaction
+ *
+ * @param transaction Pointer to a caller-owned descriptor
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Queued , status PENDING
+ *         - E_NOT_OK : Null pointer or run , protocol without a configuration ,
+ *                      already pending or queue full
+ *
+ * @note Main loop context only , like MSSP_Bus_Process().
+ */
+Std_ReturnType MSSP_Bus_Submit(mssp_bus_transaction_t *transaction);
+
+/**
+ * @brief Run the queued transactions back-to-back
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Queue empty , or waiting for an interrupt transfer
+ *         - E_NOT_OK : At least one transaction failed
+ *
+ * @note Call it from the main loop. Transactions submitted by a run or
+ *       complete callback are run in the same call.
+ */
+Std_ReturnType MSSP_Bus_Process(void);
+
+/**
+ * @brief Tell whether the queue is empty
+ *
+ * @param is_idle Pointer to store TRUE (nothing queued) or FALSE
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Status returned
+ *         - E_NOT_OK : Null pointer
+ */
+Std_ReturnType MSSP_Bus_Is_Idle(uint8 *is_idle);
+
+#endif	/* ECU_MSSP_BUS_H */
@@ -4,7 +4,9 @@
  *
  * @details
  * Provides functions to initialize and read a 4x4 keypad using GPIO HAL.
- * Rows are set as outputs and columns as inputs. Pressed keys are detected by scanning rows.
+ * Rows are set as outputs and columns as inputs. The whole matrix is scanned into a
+ * bitmap , every key is debounced on its own and press / release / repeat events
+ * are queued in the keypad object.
  *
  * Layer: ECUAL
  * Target MCU: PIC18F
@@ -15,6 +17,10 @@
  */
 
 #include "ecu_keypad.h"
+#include "../../mcal/GPIO/hal_gpio_marker.h"
+
+/* repeat_index value when no key is held */
+#define KEYPAD_NO_INDEX                     0xFF
 
 /*---------------- Button Mapping ----------------*/
 
@@ -25,123 +31,275 @@ static const uint8 btn_values[KEYPAD_ROW][KEYPAD_COLUMN] = {
                                                        {'#' , '0', '=', '+'}
                                                      };
 
-static uint8 current_key = NO_KEY;
-static uint8 last_key = NO_KEY;
-static uint8 stable_key = NO_KEY;
-static uint8 key_counter = 0;
+#if EXTERNAL_INTERRUPT_OnChange_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+/* Keypad owning the RB4..RB7 callbacks */
+static keypad_t * keypad_event_obj = NULL;
+#endif
 
-static Keypad_State_t state = IDLE_STATE ;
+static Std_ReturnType keypad_scan(keypad_t * keypad_obj);
+static void keypad_debounce(keypad_t * keypad_obj);
+static void keypad_push_event(keypad_t * keypad_obj , uint8 key , keypad_event_type_t type);
+static Std_ReturnType keypad_rows_write(const keypad_t * keypad_obj , Logic_t logic);
 
-static Std_ReturnType keypad_get_value(const keypad_t * keypad_obj , uint8 * value );
+#if EXTERNAL_INTERRUPT_OnChange_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+static void keypad_column_edge_handler(void);
+#endif
 
 
 /**
- * @brief Initialize keypad GPIO pins
+ * @brief Initialize keypad GPIO pins and clear the runtime state
  */
 
-Std_ReturnType keypad_initialize(const keypad_t * keypad_obj){
+Std_ReturnType keypad_initialize(keypad_t * keypad_obj){
     Std_ReturnType ret = E_OK ;
     if(NULL == keypad_obj){
         ret = E_NOT_OK;
     }
     else{
-        uint8 keypad_row = ZERO_INIT , keypad_column = ZERO_INIT ;
+        uint8 keypad_row = ZERO_INIT , keypad_column = ZERO_INIT , keypad_key = ZERO_INIT ;
         for(keypad_row = ZERO_INIT ; keypad_row < KEYPAD_ROW ; keypad_row++){
             ret = gpio_pin_initialize(&(keypad_obj->keypad_row_pins[keypad_row]));
         }
         for(keypad_column = ZERO_INIT ; keypad_column < KEYPAD_COLUMN ; keypad_column++){
             ret = gpio_pin_direction_initialize(&(keypad_obj->keypad_column_pins[keypad_column]));
         }
+        keypad_obj->raw_keys = ZERO_INIT;
+        keypad_obj->stable_keys = ZERO_INIT;
+        for(keypad_key = ZERO_INIT ; keypad_key < KEYPAD_KEYS ; keypad_key++){
+            keypad_obj->debounce_counter[keypad_key] = ZERO_INIT;
+        }
+        keypad_obj->repeat_index = KEYPAD_NO_INDEX;
+        keypad_obj->repeat_counter = ZERO_INIT;
+        SPSC_QUEUE_RESET(keypad_obj->event_queue);
+        keypad_obj->event_mode = FALSE;
+        keypad_obj->event_pending = FALSE;
     }
     return ret;    
 }
 
 /* MUST BE CALLED EVERY 10 ms */
 
-Std_ReturnType Keypad_Update(const keypad_t * keypad_obj ,uint8 * value){
-    Std_ReturnType ret = E_NOT_OK;
+Std_ReturnType Keypad_Update(keypad_t * keypad_obj ,uint8 * value){
+    Std_ReturnType ret = E_OK;
+    uint8 row_counter = ZERO_INIT , column_counter = ZERO_INIT ;
+    uint16 key_bit = 1;
  
-    if((NULL == keypad_obj) || (NULL == value)){
+    if(NULL == keypad_obj){
         ret = E_NOT_OK;
     }
     else{
-        ret = keypad_get_value(keypad_obj , &current_key);
+        if((TRUE == keypad_obj->event_mode) && (FALSE == keypad_obj->event_pending) &&
+           (ZERO_INIT == keypad_obj->raw_keys) && (ZERO_INIT == keypad_obj->stable_keys)){
+            /* Event mode : no edge since the last scan and nothing held , skip the scan */
+        }
+        else{
+            keypad_obj->event_pending = FALSE;
+            ret = keypad_scan(keypad_obj);
+            keypad_debounce(keypad_obj);
+        }
         
-        switch(state){
-            case IDLE_STATE:
-                if(current_key != NO_KEY){
-                    key_counter = 1;
-                    state = DEBOUNCE_STATE;
-                }
-                break;
-            case DEBOUNCE_STATE :
-                if(current_key == last_key){
-                    key_counter++;
-                    if(THRESHOLD_VAL <= key_counter){
-                        stable_key = current_key;
-                        state = PRESSED_STATE;
+        if(NULL != value){
+            *value = NO_KEY;
+            for(row_counter = ZERO_INIT ; (row_counter < KEYPAD_ROW) && (NO_KEY == *value) ; row_counter++){
+                for(column_counter = ZERO_INIT ; (column_counter < KEYPAD_COLUMN) && (NO_KEY == *value) ; column_counter++){
+                    if(keypad_obj->stable_keys & key_bit){
+                        *value = btn_values[row_counter][column_counter];
                     }
+                    else{ /* Nothing */ }
+                    key_bit <<= 1;
                 }
-                else{
-                    state = IDLE_STATE;
-                    key_counter = 0;
-                }
-                break;
-            case PRESSED_STATE : 
-                if(current_key == NO_KEY){
-                    stable_key = NO_KEY;
-                    state = IDLE_STATE;
-                    key_counter = 0;
-                }
-                break;
-            default :
-                break;
             }
-            last_key = current_key;
         }
-    *value = stable_key;
-    
+        else{ /* Nothing */ }
+    }
+    return ret;
+}
+
+Std_ReturnType Keypad_Get_Event(keypad_t * keypad_obj , keypad_event_t * event){
+    Std_ReturnType ret = E_OK;
+    if((NULL == keypad_obj) || (NULL == event) || SPSC_QUEUE_IS_EMPTY(keypad_obj->event_queue)){
+        ret = E_NOT_OK;
+    }
+    else{
+        *event = SPSC_QUEUE_FRONT(keypad_obj->event_queue);
+        SPSC_QUEUE_RELEASE(keypad_obj->event_queue);
+    }
     return ret;
 }
 
 
 /**
- * @brief Scan keypad and return pressed key
+ * @brief Scan the whole matrix into raw_keys
  * 
  * @param keypad_obj Pointer to keypad configuration
- * @param value Pointer to store the detected key
  * 
  * @return Std_ReturnType
- *         - E_OK     : Key read successfully
- *         - E_NOT_OK : Null pointer provided
+ *         - E_OK     : Matrix scanned
+ *         - E_NOT_OK : GPIO access failed
  *
- * @note If multiple keys are pressed simultaneously, the last detected key in scan order is returned.
+ * @note Each row is raised then lowered once , in event mode all rows are
+ *       driven high again at the end of the scan.
  */
-static Std_ReturnType keypad_get_value(const keypad_t * keypad_obj , uint8 * value ){
+static Std_ReturnType keypad_scan(keypad_t * keypad_obj){
     Std_ReturnType ret = E_OK ;
-    uint8 row_counter = ZERO_INIT , column_counter = ZERO_INIT , counter = ZERO_INIT ;
-    uint8 return_logic = ZERO_INIT;
-    if((NULL == keypad_obj) || (NULL == value)){
+    uint8 row_counter = ZERO_INIT , column_counter = ZERO_INIT ;
+    Logic_t return_logic = GPIO_PIN_LOW;
+    uint16 key_bit = 1;
+    uint16 keys = ZERO_INIT;
+
+    ret = keypad_rows_write(keypad_obj , GPIO_PIN_LOW);
+    for(row_counter = ZERO_INIT ; row_counter < KEYPAD_ROW ; row_counter++){
+        ret = gpio_pin_write_logic(&(keypad_obj->keypad_row_pins[row_counter]) , GPIO_PIN_HIGH );
+        for(column_counter = ZERO_INIT ; column_counter < KEYPAD_COLUMN ; column_counter++){
+            ret = gpio_pin_read_logic( &(keypad_obj->keypad_column_pins[column_counter]), &return_logic );
+            if(GPIO_PIN_HIGH == return_logic){
+                keys |= key_bit;
+            }
+            else{ /* Nothing */ }
+            key_bit <<= 1;
+        }
+        ret = gpio_pin_write_logic(&(keypad_obj->keypad_row_pins[row_counter]) , GPIO_PIN_LOW );
+    }
+    if(TRUE == keypad_obj->event_mode){
+        ret = keypad_rows_write(keypad_obj , GPIO_PIN_HIGH);
+    }
+    else{ /* Nothing */ }
+    keypad_obj->raw_keys = keys;
+    return ret;
+}
+
+/**
+ * @brief Per-key debounce of raw_keys into stable_keys , queues the events
+ *
+ * @note A key changes state after THRESHOLD_VAL scans disagreeing with its
+ *       stable state. The last pressed key repeats while it is held.
+ */
+static void keypad_debounce(keypad_t * keypad_obj){
+    uint8 row_counter = ZERO_INIT , column_counter = ZERO_INIT , key_index = ZERO_INIT ;
+    uint16 key_bit = 1;
+
+    for(row_counter = ZERO_INIT ; row_counter < KEYPAD_ROW ; row_counter++){
+        for(column_counter = ZERO_INIT ; column_counter < KEYPAD_COLUMN ; column_counter++){
+            if((keypad_obj->raw_keys ^ keypad_obj->stable_keys) & key_bit){
+                keypad_obj->debounce_counter[key_index]++;
+                if(THRESHOLD_VAL <= keypad_obj->debounce_counter[key_index]){
+                    keypad_obj->debounce_counter[key_index] = ZERO_INIT;
+                    keypad_obj->stable_keys ^= key_bit;
+                    if(keypad_obj->stable_keys & key_bit){
+                        keypad_push_event(keypad_obj , btn_values[row_counter][column_counter] , KEYPAD_EVENT_PRESS);
+                        GPIO_MARKER_HIT(KEYPAD);
+                        keypad_obj->repeat_index = key_index;
+                        keypad_obj->repeat_counter = ZERO_INIT;
+                    }
+                    else{
+                        keypad_push_event(keypad_obj , btn_values[row_counter][column_counter] , KEYPAD_EVENT_RELEASE);
+                        if(key_index == keypad_obj->repeat_index){
+                            keypad_obj->repeat_index = KEYPAD_NO_INDEX;
+                        }
+                        else{ /* Nothing */ }
+                    }
+                }
+                else{ /* Nothing */ }
+            }
+            else{
+                keypad_obj->debounce_counter[key_index] = ZERO_INIT;
+            }
+            key_bit <<= 1;
+            key_index++;
+        }
+    }
+
+    if(KEYPAD_NO_INDEX != keypad_obj->repeat_index){
+        keypad_obj->repeat_counter++;
+        if(KEYPAD_REPEAT_DELAY <= keypad_obj->repeat_counter){
+            keypad_obj->repeat_counter = KEYPAD_REPEAT_DELAY - KEYPAD_REPEAT_PERIOD;
+            /* btn_values is row major , the key index addresses it flat */
+            keypad_push_event(keypad_obj , ((const uint8 *)btn_values)[keypad_obj->repeat_index] , KEYPAD_EVENT_REPEAT);
+        }
+        else{ /* Nothing */ }
+    }
+    else{ /* Nothing */ }
+}
+
+static void keypad_push_event(keypad_t * keypad_obj , uint8 key , keypad_event_type_t type){
+    keypad_event_t *l_event = &SPSC_QUEUE_BACK(keypad_obj->event_queue);
+
+    if(!SPSC_QUEUE_IS_FULL(keypad_obj->event_queue)){
+        l_event->key = key;
+        l_event->type = type;
+        SPSC_QUEUE_PUBLISH(keypad_obj->event_queue , 1);
+    }
+    else{ /* FIFO full : event dropped */ }
+}
+
+static Std_ReturnType keypad_rows_write(const keypad_t * keypad_obj , Logic_t logic){
+    Std_ReturnType ret = E_OK ;
+    uint8 row_counter = ZERO_INIT ;
+    for(row_counter = ZERO_INIT ; row_counter < KEYPAD_ROW ; row_counter++){
+        ret = gpio_pin_write_logic(&(keypad_obj->keypad_row_pins[row_counter]) , logic);
+    }
+    return ret;
+}
+
+#if EXTERNAL_INTERRUPT_OnChange_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+
+/**
+ * @brief Switch to interrupt-on-change event mode
+ */
+Std_ReturnType keypad_event_mode_initialize(keypad_t * keypad_obj){
+    Std_ReturnType ret = E_OK ;
+    Interrupt_RBx_t column_interrupt = {
+        .External_InterruptHandler_High = keypad_column_edge_handler ,
+        .External_InterruptHandler_Low  = keypad_column_edge_handler
+    };
+    uint8 keypad_column = ZERO_INIT ;
+    if(NULL == keypad_obj){
         ret = E_NOT_OK;
     }
     else{
-        *value = NO_KEY;
-        
-        for(row_counter = ZERO_INIT ; row_counter < KEYPAD_ROW ; row_counter++){
-            for(counter = ZERO_INIT ; counter < KEYPAD_ROW ; counter++){
-                ret = gpio_pin_write_logic(&(keypad_obj->keypad_row_pins[counter]) , GPIO_PIN_LOW);
+        for(keypad_column = ZERO_INIT ; (keypad_column < KEYPAD_COLUMN) && (E_OK == ret) ; keypad_column++){
+            if((PORTB_INDEX != keypad_obj->keypad_column_pins[keypad_column].port) ||
+               ((PIN4 + keypad_column) != keypad_obj->keypad_column_pins[keypad_column].pin)){
+                ret = E_NOT_OK;
             }
-            ret = gpio_pin_write_logic(&(keypad_obj->keypad_row_pins[row_counter]) , GPIO_PIN_HIGH );
-            for(column_counter  =ZERO_INIT ; column_counter < KEYPAD_COLUMN ; column_counter++){
-                ret = gpio_pin_read_logic( &(keypad_obj->keypad_column_pins[column_counter]), &return_logic );
-                if(GPIO_PIN_HIGH == return_logic){
-                    *value = btn_values[row_counter][column_counter];
-                    return E_OK;
-                }   
-                
+            else{ /* Nothing */ }
+        }
+        if(E_OK == ret){
+            /* Rows driven before the callbacks are armed , so no spurious edge */
+            ret = keypad_rows_write(keypad_obj , GPIO_PIN_HIGH);
+            keypad_obj->event_pending = TRUE;
+            keypad_obj->event_mode = TRUE;
+            keypad_event_obj = keypad_obj;
+            for(keypad_column = ZERO_INIT ; keypad_column < KEYPAD_COLUMN ; keypad_column++){
+                column_interrupt.mcu_pin = keypad_obj->keypad_column_pins[keypad_column];
+                ret = interrupt_RBx_Init(&column_interrupt);
             }
         }
+        else{ /* Nothing */ }
     }
     return ret;
 }
 
+Std_ReturnType Keypad_Is_Idle(const keypad_t * keypad_obj , uint8 * idle){
+    Std_ReturnType ret = E_OK ;
+    if((NULL == keypad_obj) || (NULL == idle) || (FALSE == keypad_obj->event_mode)){
+        ret = E_NOT_OK;
+    }
+    else{
+        *idle = ((FALSE == keypad_obj->event_pending) && (ZERO_INIT == keypad_obj->raw_keys) &&
+                 (ZERO_INIT == keypad_obj->stable_keys)) ? TRUE : FALSE;
+    }
+    return ret;
+}
+
+/**
+ * @brief RB4..RB7 change callback , both edges : only flag a scan request
+ */
+static void keypad_column_edge_handler(void){
+    if(NULL != keypad_event_obj){
+        keypad_event_obj->event_pending = TRUE;
+    }
+    else{ /* Nothing */ }
+}
+
+#endif
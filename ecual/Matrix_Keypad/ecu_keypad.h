@@ -6,6 +6,10 @@
  * This module provides high-level APIs to initialize and read a 4x4 matrix keypad.
  * Each key press is detected by scanning rows and reading columns using GPIO HAL.
  *
+ * Event mode (keypad_event_mode_initialize) : all rows are kept driven
+ * and the columns wired to RB4..RB7 raise the PORTB change interrupt , the
+ * matrix is scanned only after an edge so the CPU can idle between presses.
+ *
  * Layer: ECUAL
  * Target MCU: PIC18F
  * 
@@ -21,43 +25,88 @@
 /* Section : Includes */
 
 #include"hal_gpio.h"
+#include"spsc_queue.h"
+#include"../../mcal/Interrupt/mcal_externl_interrupt.h"
 
 /* Section : Macro Declaration */
 
 #define KEYPAD_COLUMN 4         /**< Number of keypad columns */
 #define KEYPAD_ROW 4            /**< Number of keypad rows */
+#define KEYPAD_KEYS             (KEYPAD_ROW * KEYPAD_COLUMN)
 
 #define NO_KEY              0xFF
-#define THRESHOLD_VAL       0x08
+#define THRESHOLD_VAL       0x08    /**< Stable scans (10 ms each) before a key changes state */
+
+#define KEYPAD_REPEAT_DELAY     50  /**< Scans a key is held before the first repeat (500 ms) */
+#define KEYPAD_REPEAT_PERIOD    10  /**< Scans between two repeat events (100 ms) */
+
+/* Must be a power of two (2 .. 128) */
+#define KEYPAD_EVENT_QUEUE_SIZE 8
+
+#if !SPSC_QUEUE_SIZE_VALID(KEYPAD_EVENT_QUEUE_SIZE)
+#error "KEYPAD_EVENT_QUEUE_SIZE must be a power of two between 2 and 128"
+#endif
+
+#if KEYPAD_KEYS > 16
+#error "The key bitmaps are 16 bits wide , KEYPAD_ROW * KEYPAD_COLUMN must not exceed 16"
+#endif
 
 /* Section : Macro Functions Declarations */
 
 /* Section : Data Types Declarations */
 
+/**
+ * @enum keypad_event_type_t
+ * @brief Kind of keypad event pushed in the FIFO
+ */
 typedef enum {
-    IDLE_STATE,
-    DEBOUNCE_STATE,
-    PRESSED_STATE
-}Keypad_State_t;
+    KEYPAD_EVENT_PRESS,
+    KEYPAD_EVENT_RELEASE,
+    KEYPAD_EVENT_REPEAT
+}keypad_event_type_t;
+
+/**
+ * @struct keypad_event_t
+ * @brief One keypad FIFO entry
+ */
+typedef struct{
+    uint8 key ;                     /**< Mapped key value ('0' .. '9' , '+' ...) */
+    keypad_event_type_t type ;
+}keypad_event_t;
 
 /**
  * @struct keypad_t
- * @brief Keypad configuration structure
+ * @brief Keypad configuration and runtime state
  *
  * @details
- * Holds the GPIO pins for rows and columns of the keypad.
+ * Configuration (set by the application):
  * - keypad_row_pins    : Array of row pins
  * - keypad_column_pins : Array of column pins
+ *
+ * Runtime state (cleared by keypad_initialize , do not modify):
+ * - raw_keys / stable_keys : Scanned and debounced key bitmaps , bit = row * KEYPAD_COLUMN + column
+ * - debounce_counter       : Per-key count of scans disagreeing with stable_keys
+ * - repeat_index / repeat_counter : Last pressed key and its hold time
+ * - event_queue            : Press / release / repeat FIFO (spsc_queue.h) , filled by the scan
+ * - event_mode / event_pending : Interrupt-on-change mode
  */
 typedef struct{
     pin_config_t keypad_column_pins[KEYPAD_COLUMN] ;
     pin_config_t keypad_row_pins[KEYPAD_ROW] ; 
+    uint16 raw_keys ;
+    uint16 stable_keys ;
+    uint8 debounce_counter[KEYPAD_KEYS] ;
+    uint8 repeat_index ;
+    uint8 repeat_counter ;
+    SPSC_QUEUE_TYPE(keypad_event_t , KEYPAD_EVENT_QUEUE_SIZE) event_queue ;
+    uint8 event_mode ;
+    volatile uint8 event_pending ;
 }keypad_t;
 
 /* Section : Function Declarations */
 
 /**
- * @brief Initialize all keypad GPIO pins
+ * @brief Initialize all keypad GPIO pins and clear the runtime state
  * 
  * @param keypad_obj Pointer to keypad configuration
  * 
@@ -65,22 +114,75 @@ typedef struct{
  *         - E_OK     : Keypad initialized successfully
  *         - E_NOT_OK : Null pointer provided
  */
-Std_ReturnType keypad_initialize(const keypad_t * keypad_obj);
+Std_ReturnType keypad_initialize(keypad_t * keypad_obj);
 
 /**
- * @brief Scan keypad and return stable pressed key
+ * @brief Scan the whole matrix , debounce every key and queue its events
  *        MUST BE CALLED EVERY 10 ms   
  * 
  * @param keypad_obj Pointer to keypad configuration
- * @param value Pointer to store the detected key
+ * @param value Pointer to store the first held key in scan order (NO_KEY if none) , may be NULL
  * 
  * @return Std_ReturnType
- *         - E_OK     : Key read successfully
+ *         - E_OK     : Keypad scanned successfully
  *         - E_NOT_OK : Null pointer provided
  *
- * @note If multiple keys are pressed simultaneously, the last detected key in scan order is returned.
+ * @note Every key has its own debounce counter , several keys can be held
+ *       and each press / release is queued (see Keypad_Get_Event).
+ * @note When the FIFO is full new events are dropped.
+ * @note In event mode the matrix is not scanned while idle and no column edge occurred.
  */
-Std_ReturnType Keypad_Update(const keypad_t * keypad_obj ,uint8 * value);
+Std_ReturnType Keypad_Update(keypad_t * keypad_obj ,uint8 * value);
 
-#endif	/* ECU_KEYPAD_H */
+/**
+ * @brief Pop the oldest keypad event
+ *
+ * @param keypad_obj Pointer to keypad configuration
+ * @param event      Pointer to store the event
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Event copied
+ *         - E_NOT_OK : Null pointer or FIFO empty
+ *
+ * @note Safe to call from the main loop while Keypad_Update runs in a timer ISR.
+ */
+Std_ReturnType Keypad_Get_Event(keypad_t * keypad_obj , keypad_event_t * event);
+
+#if EXTERNAL_INTERRUPT_OnChange_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+
+/**
+ * @brief Switch the keypad to interrupt-on-change event mode
+ *
+ * @param keypad_obj Pointer to an initialized keypad configuration
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Event mode active
+ *         - E_NOT_OK : Null pointer or columns not wired to RB4..RB7
+ *                      (column i must be RB(4 + i))
+ *
+ * @note
+ * Registers the RB4..RB7 change callbacks and drives every row high , a
+ * press then pulls its column high and raises RBIF.
+ * Keypad_Update() must still be called every 10 ms for debouncing.
+ * Only one keypad can use event mode (RB4..RB7 are a single resource).
+ */
+Std_ReturnType keypad_event_mode_initialize(keypad_t * keypad_obj);
 
+/**
+ * @brief Check whether the keypad needs more Keypad_Update() calls
+ *
+ * @param keypad_obj Pointer to keypad configuration
+ * @param idle Pointer to store the result
+ *             - TRUE  : No key down and no pending edge , the CPU may idle
+ *                       until the next interrupt
+ *             - FALSE : A key is being debounced / held , keep updating
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Status read
+ *         - E_NOT_OK : Null pointer or event mode not active
+ */
+Std_ReturnType Keypad_Is_Idle(const keypad_t * keypad_obj , uint8 * idle);
+
+#endif
+
+#endif	/* ECU_KEYPAD_H */
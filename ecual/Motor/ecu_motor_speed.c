@@ -0,0 +1,165 @@
+/*
+ * @file    ecu_motor_speed.c
+ * @brief   Closed-loop PID speed control implementation
+ *
+ * @details
+ * One PID step per Motor_Speed_Update() , 32-bit integer math with
+ * every term clamped so the sum cannot overflow.
+ *
+ * Layer: ECUAL
+ * Target MCU: PIC18F4620
+ *
+ * Author: Abdelmoniem Ahmed
+ * Linkedin: https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * Date: 2026
+ */
+
+#include "ecu_motor_speed.h"
+
+#if MOTOR_SPEED_CONTROL_ENABLE == 0x01
+
+/* Largest P / D term , Q8 permille : well above the output range */
+#define MOTOR_SPEED_TERM_LIMIT              ((sint32)CCP_PWM_DUTY_PERMILLE_MAX << (MOTOR_SPEED_GAIN_SHIFT + 2))
+
+/* Section : Static Function Declarations */
+
+static sint32 motor_speed_clamp(sint32 value , sint32 min , sint32 max);
+static Std_ReturnType motor_speed_apply(motor_speed_t *control , uint16 duty);
+
+/* Section : Function Definitions */
+
+Std_ReturnType Motor_Speed_Init(motor_speed_t *control){
+    Std_ReturnType ret = E_OK;
+
+    if((NULL == control) || (NULL == control->motor) || (NULL == control->pwm) || (NULL == control->tach) ||
+       (control->out_min > control->out_max) || (CCP_PWM_DUTY_PERMILLE_MAX < control->out_max)){
+        ret = E_NOT_OK;
+    }
+    else{
+        control->setpoint = ZERO_INIT;
+        control->measured = ZERO_INIT;
+        control->integral = ZERO_INIT;
+        control->running = 0;
+        ret = motor_speed_apply(control , ZERO_INIT);
+        ret &= dc_motor_stop(control->motor);
+    }
+    return ret;
+}
+
+Std_ReturnType Motor_Speed_Set_Target(motor_speed_t *control , uint16 rpm){
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == control){
+        ret = E_NOT_OK;
+    }
+    else{
+        control->setpoint = rpm;
+    }
+    return ret;
+}
+
+Std_ReturnType Motor_Speed_Update(motor_speed_t *control){
+    Std_ReturnType ret = E_OK;
+    sint32 l_error = ZERO_INIT;
+    sint32 l_p_term = ZERO_INIT;
+    sint32 l_d_term = ZERO_INIT;
+    sint32 l_output = ZERO_INIT;
+    uint16 l_previous = ZERO_INIT;
+    uint16 l_rpm = ZERO_INIT;
+
+    if(NULL == control){
+        ret = E_NOT_OK;
+    }
+    else{
+        ret = CCP_Capture_Get_Rpm(control->tach , &l_rpm);
+        l_previous = control->measured;
+        control->measured = l_rpm;
+
+        if(ZERO_INIT == control->setpoint){
+            if(control->running){
+                control->running = 0;
+                control->integral = ZERO_INIT;
+                ret &= motor_speed_apply(control , ZERO_INIT);
+                ret &= dc_motor_stop(control->motor);
+            }
+            else{ /* Already stopped */ }
+        }
+        else{
+            if(0 == control->running){
+                control->running = 1;
+                control->integral = (sint32)control->out_min << MOTOR_SPEED_GAIN_SHIFT;
+                ret &= dc_motor_move_forward(control->motor);
+            }
+            else{ /* Nothing */ }
+
+            l_error = (sint32)control->setpoint - (sint32)l_rpm;
+            l_p_term = motor_speed_clamp(l_error * control->kp , -MOTOR_SPEED_TERM_LIMIT , MOTOR_SPEED_TERM_LIMIT);
+            /* Derivative on measurement : a set-point step gives no kick */
+            l_d_term = motor_speed_clamp(((sint32)l_previous - (sint32)l_rpm) * control->kd ,
+                                         -MOTOR_SPEED_TERM_LIMIT , MOTOR_SPEED_TERM_LIMIT);
+
+            /* Conditional integration : hold while saturated in the error direction */
+            if(!(((control->output >= control->out_max) && (0 < l_error)) ||
+                 ((control->output <= control->out_min) && (0 > l_error)))){
+                control->integral += motor_speed_clamp(l_error * control->ki , -MOTOR_SPEED_TERM_LIMIT , MOTOR_SPEED_TERM_LIMIT);
+            }
+            else{ /* Nothing */ }
+            control->integral = motor_speed_clamp(control->integral ,
+                                                  (sint32)control->out_min << MOTOR_SPEED_GAIN_SHIFT ,
+                                                  (sint32)control->out_max << MOTOR_SPEED_GAIN_SHIFT);
+
+            l_output = (l_p_term + control->integral + l_d_term) >> MOTOR_SPEED_GAIN_SHIFT;
+            l_output = motor_speed_clamp(l_output , control->out_min , control->out_max);
+
+            /* Slew limit */
+            if(ZERO_INIT != control->max_step){
+                l_output = motor_speed_clamp(l_output , (sint32)control->output - control->max_step ,
+                                             (sint32)control->output + control->max_step);
+            }
+            else{ /* Nothing */ }
+            ret &= motor_speed_apply(control , (uint16)l_output);
+        }
+    }
+    return ret;
+}
+
+Std_ReturnType Motor_Speed_Get_Status(const motor_speed_t *control , uint16 *rpm , uint16 *duty){
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == control){
+        ret = E_NOT_OK;
+    }
+    else{
+        if(NULL != rpm){
+            *rpm = control->measured;
+        }
+        else{ /* Nothing */ }
+        if(NULL != duty){
+            *duty = control->output;
+        }
+        else{ /* Nothing */ }
+    }
+    return ret;
+}
+
+/* Section : Static Function Definitions */
+
+static sint32 motor_speed_clamp(sint32 value , sint32 min , sint32 max){
+    sint32 l_value = value;
+
+    if(l_value < min){
+        l_value = min;
+    }
+    else if(l_value > max){
+        l_value = max;
+    }
+    else{ /* Nothing */ }
+    return l_value;
+}
+
+static Std_ReturnType motor_speed_apply(motor_speed_t *control , uint16 duty){
+    control->output = duty;
+    return CCP_PWM_Set_Duty_Permille(control->pwm , duty);
+}
+
+#endif
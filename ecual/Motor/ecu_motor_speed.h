@@ -0,0 +1,142 @@
+/*
+ * @file    ecu_motor_speed.h
+ * @brief   Closed-loop PID speed control of a DC motor
+ *
+ * @details
+ * Ties three drivers together :
+ *  - dc_motor_t (ecu_DC_motor)  : direction pins of the H-bridge
+ *  - CCP PWM                    : duty on the bridge enable , in permille
+ *  - CCP capture engine         : measured speed in RPM (tachometer)
+ *
+ * Motor_Speed_Update() runs one PID step. Call it at a fixed rate , as a
+ * scheduler task (ecu_scheduler) : the integral and derivative gains are
+ * per update period , changing the period changes the tuning.
+ *
+ * Fixed point , no floating point :
+ *  - Gains are Q8 (256 = 1.0) , per RPM of error , output in permille
+ *  - Integral term kept in Q8 permille , clamped to the output range
+ *    (anti-windup) and frozen while the output is saturated in the
+ *    direction of the error (conditional integration)
+ *  - Derivative on the measurement , no kick on set-point changes
+ *  - Output slew limited to max_step permille per update
+ *
+ * Built when one CCP is in PWM mode and one runs the capture engine
+ * (CCP_CFG.h , CCPx interrupt enabled).
+ *
+ * Layer: ECUAL
+ * Target MCU: PIC18F4620
+ *
+ * Author: Abdelmoniem Ahmed
+ * Linkedin: https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * Date: 2026
+ */
+
+#ifndef ECU_MOTOR_SPEED_H
+#define	ECU_MOTOR_SPEED_H
+
+/* Section : Includes */
+#include"ecu_DC_motor.h"
+#include"../../mcal/CCP/CCP.h"
+
+/* Section : Macro Declaration */
+
+#if ((CCP1_CAPTURE_ENGINE_ENABLE == 0X01) || (CCP2_CAPTURE_ENGINE_ENABLE == 0X01)) && \
+    ((CCP_CFG_PWM_MODE_SELECTED == CCP1_CFG_SELECTED_MODE) || (CCP_CFG_PWM_MODE_SELECTED == CCP2_CFG_SELECTED_MODE))
+#define MOTOR_SPEED_CONTROL_ENABLE          0x01
+#else
+#define MOTOR_SPEED_CONTROL_ENABLE          0x00
+#endif
+
+/* Gain fixed point : Q8 */
+#define MOTOR_SPEED_GAIN_SHIFT              8
+#define MOTOR_SPEED_GAIN(_X)                ((sint16)((_X) * (1 << MOTOR_SPEED_GAIN_SHIFT)))
+
+#if MOTOR_SPEED_CONTROL_ENABLE == 0x01
+
+/* Section : Data Types Declarations */
+
+/**
+ * @struct motor_speed_t
+ * @brief Speed controller configuration and state
+ *
+ * @details
+ * - motor / pwm / tach   : Drivers , initialized by the application
+ * - kp / ki / kd         : Q8 gains (MOTOR_SPEED_GAIN(0.5) = 128)
+ * - out_min / out_max    : Duty range while running , permille
+ * - max_step             : Largest duty change per update , permille (0 = no limit)
+ * - setpoint .. output   : Runtime , reset by Motor_Speed_Init , do not modify
+ */
+typedef struct{
+    dc_motor_t *motor ;
+    const ccp_t *pwm ;
+    const ccp_t *tach ;
+    sint16 kp ;
+    sint16 ki ;
+    sint16 kd ;
+    uint16 out_min ;
+    uint16 out_max ;
+    uint16 max_step ;
+    uint16 setpoint ;
+    uint16 measured ;
+    uint16 output ;
+    sint32 integral ;
+    uint8  running ;
+}motor_speed_t;
+
+/* Section : Function Declarations */
+
+/**
+ * @brief Reset the controller and stop the motor (duty 0)
+ *
+ * @param control Pointer to the controller (drivers , gains and limits set)
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Controller idle , set-point 0
+ *         - E_NOT_OK : Null pointer , out_min > out_max or out_max > 1000
+ *
+ * @note CCP PWM , Timer2 , the capture engine and the motor pins are
+ *       initialized by the application before.
+ */
+Std_ReturnType Motor_Speed_Init(motor_speed_t *control);
+
+/**
+ * @brief Set the target speed
+ *
+ * @param control Pointer to an initialized controller
+ * @param rpm     Target speed , 0 stops the motor on the next update
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Set-point stored
+ *         - E_NOT_OK : Null pointer
+ */
+Std_ReturnType Motor_Speed_Set_Target(motor_speed_t *control , uint16 rpm);
+
+/**
+ * @brief Run one PID step : read the speed , compute and write the duty
+ *
+ * @param control Pointer to an initialized controller
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Duty updated
+ *         - E_NOT_OK : Null pointer or driver error
+ *
+ * @note Call at a fixed rate from a scheduler task , not from an ISR.
+ */
+Std_ReturnType Motor_Speed_Update(motor_speed_t *control);
+
+/**
+ * @brief Read the last measured speed and applied duty
+ *
+ * @param control Pointer to an initialized controller
+ * @param rpm     Pointer to the measured speed , may be NULL
+ * @param duty    Pointer to the applied duty in permille , may be NULL
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Values copied
+ *         - E_NOT_OK : Null controller
+ */
+Std_ReturnType Motor_Speed_Get_Status(const motor_speed_t *control , uint16 *rpm , uint16 *duty);
+
+#endif
+
+#endif	/* ECU_MOTOR_SPEED_H */
@@ -0,0 +1,303 @@
+/* 
+ * @file    ecu_output_pattern.c
+ * @brief   Blink / dim / breathe pattern engine implementation
+ *
+ * @details
+ * The main loop APIs rewrite a channel with interrupts masked , so the
+ * tick never sees a half-updated pattern. The tick builds the port value
+ * of every channel and writes it once through gpio_port_write_masked().
+ *
+ * Layer: ECUAL
+ * Target MCU: PIC18F
+ * 
+ * Author: Abdelmoniem Ahmed
+ * Linkedin: https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * Date: 2026
+ */
+
+#include "ecu_output_pattern.h"
+
+/* Section : Static Function Declarations */
+
+static output_pattern_channel_t * output_pattern_channel_get(output_pattern_t *engine , uint8 channel);
+static Std_ReturnType output_pattern_channel_add(output_pattern_t *engine , uint8 port , uint8 pin ,
+                                                 uint8 *channel , output_pattern_channel_t **added);
+static void output_pattern_frame(output_pattern_channel_t *channel);
+
+/* Section : Function Definitions */
+
+Std_ReturnType Output_Pattern_Init(output_pattern_t *engine , port_index_t port){
+    Std_ReturnType ret = E_OK;
+    
+    if((NULL == engine) || (PORT_MAX_NUMBER <= port)){
+        ret = E_NOT_OK;
+    }
+    else{
+        engine->port = port;
+        engine->port_mask = ZERO_INIT;
+        engine->channel_count = ZERO_INIT;
+        engine->phase = ZERO_INIT;
+    }
+    return ret;
+}
+
+Std_ReturnType Output_Pattern_Add_Led(output_pattern_t *engine , const led_t *led , uint8 *channel){
+    Std_ReturnType ret = E_OK;
+    output_pattern_channel_t *l_channel = NULL;
+    
+    if(NULL == led){
+        ret = E_NOT_OK;
+    }
+    else{
+        ret = output_pattern_channel_add(engine , led->port_name , led->pin , channel , &l_channel);
+        if(E_OK == ret){
+            ret = led_initialize(led);
+            l_channel->mode = (GPIO_PIN_HIGH == led->led_status) ? OUTPUT_PATTERN_ON : OUTPUT_PATTERN_OFF;
+        }
+        else{ /* Nothing */ }
+    }
+    return ret;
+}
+
+Std_ReturnType Output_Pattern_Add_Relay(output_pattern_t *engine , const relay_t *relay ,
+                                        uint16 min_on , uint16 min_off , uint8 *channel){
+    Std_ReturnType ret = E_OK;
+    output_pattern_channel_t *l_channel = NULL;
+    
+    if(NULL == relay){
+        ret = E_NOT_OK;
+    }
+    else{
+        ret = output_pattern_channel_add(engine , relay->relay_port , relay->relay_pin , channel , &l_channel);
+        if(E_OK == ret){
+            ret = relay_initialize(relay);
+            l_channel->is_relay = TRUE;
+            l_channel->min_on = min_on;
+            l_channel->min_off = min_off;
+            l_channel->output = (RELAY_ON_STATUS == relay->relay_status) ? TRUE : FALSE;
+            l_channel->mode = (RELAY_ON_STATUS == relay->relay_status) ? OUTPUT_PATTERN_ON : OUTPUT_PATTERN_OFF;
+        }
+        else{ /* Nothing */ }
+    }
+    return ret;
+}
+
+Std_ReturnType Output_Pattern_Set(output_pattern_t *engine , uint8 channel , uint8 on){
+    Std_ReturnType ret = E_OK;
+    output_pattern_channel_t *l_channel = output_pattern_channel_get(engine , channel);
+    uint8 l_gie = ZERO_INIT;
+    
+    if(NULL == l_channel){
+        ret = E_NOT_OK;
+    }
+    else{
+        l_gie = INTCONbits.GIE;
+        INTCONbits.GIE = 0;
+        l_channel->mode = (FALSE != on) ? OUTPUT_PATTERN_ON : OUTPUT_PATTERN_OFF;
+        INTCONbits.GIE = l_gie;
+    }
+    return ret;
+}
+
+Std_ReturnType Output_Pattern_Blink(output_pattern_t *engine , uint8 channel , uint16 on_frames , uint16 off_frames){
+    Std_ReturnType ret = E_OK;
+    output_pattern_channel_t *l_channel = output_pattern_channel_get(engine , channel);
+    uint8 l_gie = ZERO_INIT;
+    
+    if((NULL == l_channel) || (ZERO_INIT == on_frames) || (ZERO_INIT == off_frames)){
+        ret = E_NOT_OK;
+    }
+    else{
+        l_gie = INTCONbits.GIE;
+        INTCONbits.GIE = 0;
+        l_channel->on_frames = on_frames;
+        l_channel->off_frames = off_frames;
+        l_channel->counter = ZERO_INIT;
+        l_channel->blink_on = TRUE;
+        l_channel->mode = OUTPUT_PATTERN_BLINK;
+        INTCONbits.GIE = l_gie;
+    }
+    return ret;
+}
+
+Std_ReturnType Output_Pattern_Dim(output_pattern_t *engine , uint8 channel , uint8 duty){
+    Std_ReturnType ret = E_OK;
+    output_pattern_channel_t *l_channel = output_pattern_channel_get(engine , channel);
+    uint8 l_gie = ZERO_INIT;
+    
+    if((NULL == l_channel) || (TRUE == l_channel->is_relay) || (OUTPUT_PATTERN_PWM_STEPS < duty)){
+        /* A relay contact must never be chopped at PWM rate */
+        ret = E_NOT_OK;
+    }
+    else{
+        l_gie = INTCONbits.GIE;
+        INTCONbits.GIE = 0;
+        l_channel->duty = duty;
+        l_channel->mode = OUTPUT_PATTERN_DIM;
+        INTCONbits.GIE = l_gie;
+    }
+    return ret;
+}
+
+Std_ReturnType Output_Pattern_Breathe(output_pattern_t *engine , uint8 channel , uint16 step_frames){
+    Std_ReturnType ret = E_OK;
+    output_pattern_channel_t *l_channel = output_pattern_channel_get(engine , channel);
+    uint8 l_gie = ZERO_INIT;
+    
+    if((NULL == l_channel) || (TRUE == l_channel->is_relay) || (ZERO_INIT == step_frames)){
+        ret = E_NOT_OK;
+    }
+    else{
+        l_gie = INTCONbits.GIE;
+        INTCONbits.GIE = 0;
+        l_channel->on_frames = step_frames;
+        l_channel->counter = ZERO_INIT;
+        l_channel->duty = ZERO_INIT;
+        l_channel->rising = TRUE;
+        l_channel->mode = OUTPUT_PATTERN_BREATHE;
+        INTCONbits.GIE = l_gie;
+    }
+    return ret;
+}
+
+void Output_Pattern_Tick(output_pattern_t *engine){
+    output_pattern_channel_t *l_channel = NULL;
+    uint8 l_value = ZERO_INIT;
+    uint8 l_on = FALSE;
+    uint8 l_index = ZERO_INIT;
+    
+    for(l_index = ZERO_INIT ; l_index < engine->channel_count ; l_index++){
+        l_channel = &(engine->channels[l_index]);
+        if(ZERO_INIT == engine->phase){
+            output_pattern_frame(l_channel);
+        }
+        else{ /* Patterns advance once per frame */ }
+        
+        switch(l_channel->mode){
+            case OUTPUT_PATTERN_ON      : l_on = TRUE; break;
+            case OUTPUT_PATTERN_BLINK   : l_on = l_channel->blink_on; break;
+            case OUTPUT_PATTERN_DIM     :
+            case OUTPUT_PATTERN_BREATHE : l_on = (engine->phase < l_channel->duty) ? TRUE : FALSE; break;
+            default                     : l_on = FALSE; break;
+        }
+        
+        if(TRUE == l_channel->is_relay){
+            /* Anti-chatter : the request wins only once the current state is old enough */
+            if((l_on != l_channel->output) &&
+               (l_channel->hold >= ((TRUE == l_channel->output) ? l_channel->min_on : l_channel->min_off))){
+                l_channel->output = l_on;
+                l_channel->hold = ZERO_INIT;
+            }
+            else{ /* Nothing */ }
+            l_on = l_channel->output;
+        }
+        else{ /* Nothing */ }
+        
+        if(TRUE == l_on){
+            l_value |= l_channel->mask;
+        }
+        else{ /* Nothing */ }
+    }
+    (void)gpio_port_write_masked(engine->port , engine->port_mask , l_value);
+    
+    engine->phase++;
+    if(OUTPUT_PATTERN_PWM_STEPS <= engine->phase){
+        engine->phase = ZERO_INIT;
+    }
+    else{ /* Nothing */ }
+}
+
+/* Section : Static Function Definitions */
+
+static output_pattern_channel_t * output_pattern_channel_get(output_pattern_t *engine , uint8 channel){
+    output_pattern_channel_t *l_channel = NULL;
+    
+    if((NULL != engine) && (channel < engine->channel_count)){
+        l_channel = &(engine->channels[channel]);
+    }
+    else{ /* Nothing */ }
+    return l_channel;
+}
+
+/**
+ * @brief Reserve the next channel for a pin of the engine port
+ */
+static Std_ReturnType output_pattern_channel_add(output_pattern_t *engine , uint8 port , uint8 pin ,
+                                                 uint8 *channel , output_pattern_channel_t **added){
+    Std_ReturnType ret = E_OK;
+    output_pattern_channel_t *l_channel = NULL;
+    uint8 l_mask = (uint8)(1 << pin);
+    uint8 l_gie = ZERO_INIT;
+    
+    if((NULL == engine) || (NULL == channel) || (engine->port != port) ||
+       (ZERO_INIT != (engine->port_mask & l_mask)) || (OUTPUT_PATTERN_MAX_CHANNELS <= engine->channel_count)){
+        ret = E_NOT_OK;
+    }
+    else{
+        l_channel = &(engine->channels[engine->channel_count]);
+        l_channel->on_frames = ZERO_INIT;
+        l_channel->off_frames = ZERO_INIT;
+        l_channel->counter = ZERO_INIT;
+        l_channel->hold = ZERO_INIT;
+        l_channel->min_on = ZERO_INIT;
+        l_channel->min_off = ZERO_INIT;
+        l_channel->mask = l_mask;
+        l_channel->duty = ZERO_INIT;
+        l_channel->mode = OUTPUT_PATTERN_OFF;
+        l_channel->is_relay = FALSE;
+        l_channel->blink_on = FALSE;
+        l_channel->rising = FALSE;
+        l_channel->output = FALSE;
+        
+        /* The tick sees the channel only once it is complete */
+        l_gie = INTCONbits.GIE;
+        INTCONbits.GIE = 0;
+        *channel = engine->channel_count;
+        *added = l_channel;
+        engine->channel_count++;
+        engine->port_mask |= l_mask;
+        INTCONbits.GIE = l_gie;
+    }
+    return ret;
+}
+
+/**
+ * @brief Advance the pattern of one channel by one frame
+ */
+static void output_pattern_frame(output_pattern_channel_t *channel){
+    if(0xFFFF != channel->hold){
+        channel->hold++;
+    }
+    else{ /* Saturated */ }
+    
+    if(OUTPUT_PATTERN_BLINK == channel->mode){
+        channel->counter++;
+        if(channel->counter >= ((TRUE == channel->blink_on) ? channel->on_frames : channel->off_frames)){
+            channel->counter = ZERO_INIT;
+            channel->blink_on ^= 1;
+        }
+        else{ /* Nothing */ }
+    }
+    else if(OUTPUT_PATTERN_BREATHE == channel->mode){
+        channel->counter++;
+        if(channel->counter >= channel->on_frames){
+            channel->counter = ZERO_INIT;
+            if(TRUE == channel->rising){
+                channel->duty++;
+                if(OUTPUT_PATTERN_PWM_STEPS <= channel->duty){
+                    channel->rising = FALSE;
+                }
+                else{ /* Nothing */ }
+            }
+            else{
+                channel->duty--;
+                if(ZERO_INIT == channel->duty){
+                    channel->rising = TRUE;
+                }
+                else{ /* Nothing */ }
+            }
+        }
+        else{ /* Nothing */ }
+    }
+    else{ /* Steady and dimmed channels have no frame state */ }
+}
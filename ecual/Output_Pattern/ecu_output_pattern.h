@@ -0,0 +1,215 @@
+/* 
+ * @file    ecu_output_pattern.h
+ * @brief   Blink / dim / breathe pattern engine for LED and relay outputs
+ *
+ * @details
+ * One engine drives up to 8 channels of one port from a periodic timer
+ * tick and updates all of them with a single masked LATx write per tick :
+ *  - LED channels   : steady on / off , blink , software PWM dim , breathe
+ *  - Relay channels : steady on / off , blink , with a minimum on and
+ *                     off time (anti-chatter) applied to every change
+ *
+ * Time base :
+ *  - tick  : one Output_Pattern_Tick() call , e.g. a Timer2 tick ISR
+ *  - frame : OUTPUT_PATTERN_PWM_STEPS ticks = one software PWM period
+ * Blink , breathe and relay times are counted in frames.
+ * Example : 256 us tick , 16 steps -> 4.1 ms frame (244 Hz PWM).
+ *
+ * Channels are added from led_t / relay_t objects , all on the engine port.
+ * Use one engine per port when the outputs are spread over several ports.
+ *
+ * Layer: ECUAL
+ * Target MCU: PIC18F
+ * 
+ * Author: Abdelmoniem Ahmed
+ * Linkedin: https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * Date: 2026
+ */
+
+#ifndef ECU_OUTPUT_PATTERN_H
+#define	ECU_OUTPUT_PATTERN_H
+
+/* Section : Includes */
+
+#include"../LED/ecu_led.h"
+#include"../Relay/ecu_relay.h"
+
+/* Section : Macro Declaration */
+
+/* Software PWM resolution , ticks per frame (duty 0 .. OUTPUT_PATTERN_PWM_STEPS) */
+#define OUTPUT_PATTERN_PWM_STEPS            16
+
+/* Channels per engine , one port at most */
+#define OUTPUT_PATTERN_MAX_CHANNELS         8
+
+#if (OUTPUT_PATTERN_PWM_STEPS < 2) || (OUTPUT_PATTERN_PWM_STEPS > 64)
+#error "OUTPUT_PATTERN_PWM_STEPS must be 2..64"
+#endif
+
+#if (OUTPUT_PATTERN_MAX_CHANNELS == 0) || (OUTPUT_PATTERN_MAX_CHANNELS > 8)
+#error "OUTPUT_PATTERN_MAX_CHANNELS must be 1..8"
+#endif
+
+/* Section : Data Types Declarations */
+
+/**
+ * @enum output_pattern_mode_t
+ * @brief Pattern of one channel
+ */
+typedef enum{
+    OUTPUT_PATTERN_OFF = 0,
+    OUTPUT_PATTERN_ON,
+    OUTPUT_PATTERN_BLINK,
+    OUTPUT_PATTERN_DIM,             /* LED only */
+    OUTPUT_PATTERN_BREATHE          /* LED only */
+}output_pattern_mode_t;
+
+/**
+ * @struct output_pattern_channel_t
+ * @brief State of one channel , owned by the engine
+ */
+typedef struct{
+    uint16 on_frames ;              /* Blink on time  / relay minimum on time */
+    uint16 off_frames ;             /* Blink off time / relay minimum off time */
+    uint16 counter ;                /* Frames in the current blink phase or breathe step */
+    uint16 hold ;                   /* Relay : frames since the last output change */
+    uint16 min_on ;
+    uint16 min_off ;
+    uint8  mask ;                   /* Port bit of the channel */
+    uint8  duty ;                   /* DIM duty / BREATHE current level */
+    uint8  mode       : 3 ;         /* @ref output_pattern_mode_t */
+    uint8  is_relay   : 1 ;
+    uint8  blink_on   : 1 ;
+    uint8  rising     : 1 ;         /* BREATHE direction */
+    uint8  output     : 1 ;         /* Relay : level applied to the pin */
+    uint8  reserved   : 1 ;
+}output_pattern_channel_t;
+
+/**
+ * @struct output_pattern_t
+ * @brief Pattern engine of one port
+ *
+ * @details Zero-initialize it (static storage) and call Output_Pattern_Init().
+ */
+typedef struct{
+    output_pattern_channel_t channels[OUTPUT_PATTERN_MAX_CHANNELS] ;
+    port_index_t port ;
+    uint8 port_mask ;               /* Bits owned by the engine */
+    uint8 channel_count ;
+    uint8 phase ;                   /* Tick inside the frame */
+}output_pattern_t;
+
+/* Section : Function Declarations */
+
+/**
+ * @brief Bind an empty engine to a port
+ *
+ * @param engine Pointer to the engine
+ * @param port   Port of every channel
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Engine ready , no channel
+ *         - E_NOT_OK : Null pointer or invalid port
+ */
+Std_ReturnType Output_Pattern_Init(output_pattern_t *engine , port_index_t port);
+
+/**
+ * @brief Initialize an LED and add it as a channel , steady at led->led_status
+ *
+ * @param engine  Pointer to the engine
+ * @param led     LED on the engine port
+ * @param channel Pointer to the returned channel number
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Channel added
+ *         - E_NOT_OK : Null pointer , other port , pin already used or engine full
+ */
+Std_ReturnType Output_Pattern_Add_Led(output_pattern_t *engine , const led_t *led , uint8 *channel);
+
+/**
+ * @brief Initialize a relay and add it as a channel , steady at relay->relay_status
+ *
+ * @param engine  Pointer to the engine
+ * @param relay   Relay on the engine port
+ * @param min_on  Minimum on time in frames
+ * @param min_off Minimum off time in frames
+ * @param channel Pointer to the returned channel number
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Channel added
+ *         - E_NOT_OK : Null pointer , other port , pin already used or engine full
+ *
+ * @note The minimum time of the initial state applies to the first change.
+ */
+Std_ReturnType Output_Pattern_Add_Relay(output_pattern_t *engine , const relay_t *relay ,
+                                        uint16 min_on , uint16 min_off , uint8 *channel);
+
+/**
+ * @brief Steady on or off
+ *
+ * @param engine  Pointer to the engine
+ * @param channel Channel number
+ * @param on      TRUE = OUTPUT_PATTERN_ON , FALSE = OUTPUT_PATTERN_OFF
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Applied from the next tick (relay : once its minimum time elapsed)
+ *         - E_NOT_OK : Null pointer or bad channel
+ */
+Std_ReturnType Output_Pattern_Set(output_pattern_t *engine , uint8 channel , uint8 on);
+
+/**
+ * @brief Blink , starting with the on phase
+ *
+ * @param engine     Pointer to the engine
+ * @param channel    Channel number
+ * @param on_frames  On time in frames (1 at least)
+ * @param off_frames Off time in frames (1 at least)
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Blinking
+ *         - E_NOT_OK : Null pointer , bad channel or zero time
+ *
+ * @note A relay never switches faster than its minimum on / off times.
+ */
+Std_ReturnType Output_Pattern_Blink(output_pattern_t *engine , uint8 channel , uint16 on_frames , uint16 off_frames);
+
+/**
+ * @brief Dim an LED through software PWM
+ *
+ * @param engine  Pointer to the engine
+ * @param channel LED channel number
+ * @param duty    0 .. OUTPUT_PATTERN_PWM_STEPS ticks on per frame
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Dimming
+ *         - E_NOT_OK : Null pointer , bad channel , relay channel or duty out of range
+ */
+Std_ReturnType Output_Pattern_Dim(output_pattern_t *engine , uint8 channel , uint8 duty);
+
+/**
+ * @brief Breathe an LED , duty ramps 0 -> max -> 0 continuously
+ *
+ * @param engine      Pointer to the engine
+ * @param channel     LED channel number
+ * @param step_frames Frames per duty step (1 at least) ,
+ *                    full cycle = 2 x OUTPUT_PATTERN_PWM_STEPS x step_frames frames
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Breathing
+ *         - E_NOT_OK : Null pointer , bad channel , relay channel or zero step
+ */
+Std_ReturnType Output_Pattern_Breathe(output_pattern_t *engine , uint8 channel , uint16 step_frames);
+
+/**
+ * @brief Advance every channel by one tick , call it from a timer ISR
+ *
+ * @param engine Pointer to an initialized engine
+ *
+ * @note
+ * Patterns advance once per frame (first tick of the frame) , the PWM
+ * compare runs every tick. All channels land in one masked LATx write ,
+ * the other pins of the port are untouched.
+ */
+void Output_Pattern_Tick(output_pattern_t *engine);
+
+#endif	/* ECU_OUTPUT_PATTERN_H */
@@ -12,36 +12,292 @@
 
 #include "RealTimeClock_DS1307.h"
 
+/* Valid BCD value in min .. max */
+#define RTC_BCD_IN_RANGE(_value , _min , _max)      ((((_value) & 0x0F) <= 0x09) && ((_value) >= (_min)) && ((_value) <= (_max)))
+#define RTC_NVRAM_IN_RANGE(_offset , _length)       (((ZERO_INIT) != (_length)) && \
+                                                     ((uint16)(_offset) + (_length) <= REAL_TIME_CLOCK_DS1307_NVRAM_SIZE))
+
+/* Bus the DS1307 is wired to */
+static i2c_bus_t rtc_bus = I2C_BUS_MSSP ;
+
+#if EXTERNAL_INTERRUPT_INTx_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+/* Static Function Declaration */
+
+static void RealTimeClock_DS1307_SQW_Handler(void);
+static void RealTimeClock_DS1307_Advance(uint8 seconds);
+static uint8 RealTimeClock_DS1307_BCD_Increment(uint8 * value , uint8 max , uint8 wrap);
+
+/* Static Variables */
+
+/* Days per month in BCD , February patched for leap years */
+static const uint8 rtc_days_in_month[12] = {
+    0x31 , 0x28 , 0x31 , 0x30 , 0x31 , 0x30 , 0x31 , 0x31 , 0x30 , 0x31 , 0x30 , 0x31
+};
+
+/* Enable bit of the SQW input , indexed by INTERRUPT_INTx_src */
+static const uint32 rtc_sqw_sources[3] = {
+    INTERRUPT_CRITICAL_INT0 , INTERRUPT_CRITICAL_INT1 , INTERRUPT_CRITICAL_INT2
+};
+
+static Interrupt_INTx_t rtc_sqw_int;
+static void (* rtc_sqw_user_handler)(void) = NULL;            /* Chained after the edge count */
+static RealTimeClock_DS1307_t rtc_cache;
+static volatile uint8 rtc_pending_seconds = ZERO_INIT;     /* SQW edges not yet applied */
+static uint16 rtc_seconds_since_sync = ZERO_INIT;
+static uint8 rtc_cache_started = FALSE;
+#endif
+
 /* Function Definiton */
 
+Std_ReturnType RealTimeClock_DS1307_Bind_Bus(i2c_bus_t bus){
+    Std_ReturnType ret = E_OK;
+    
+    if(I2C_BUS_SOFT < bus){
+        ret = E_NOT_OK;
+    }
+    else{
+        rtc_bus = bus;
+    }
+    return ret ;
+}
+
 Std_ReturnType RealTimeClock_DS1307_Get_Date_Time(RealTimeClock_DS1307_t * time){
     Std_ReturnType ret = E_OK;
+    uint8 rtc_registers[REAL_TIME_CLOCK_DS1307_TIME_REGISTERS] = {0};
     
     if(NULL == time){
         ret = E_NOT_OK;
     }
     else{
-        ret = MSSP_I2C_Read_Byte_Register(  REAL_TIME_CLOCK_DS1307_ADDRESS ,
-                                        SECONDS_REGISTER_ADDRESS ,
-                                        &(time->Seconds) );
-        
-        ret = MSSP_I2C_Read_Byte_Register(  REAL_TIME_CLOCK_DS1307_ADDRESS ,
-                                        MINUTES_REGISTER_ADDRESS ,
-                                        &(time->Minutes) );
-        
-        ret = MSSP_I2C_Read_Byte_Register(  REAL_TIME_CLOCK_DS1307_ADDRESS ,
-                                        HOURS_REGISTER_ADDRESS ,
-                                        &(time->Hours) );
-        ret = MSSP_I2C_Read_Byte_Register(  REAL_TIME_CLOCK_DS1307_ADDRESS ,
-                                        DATE_REGISTER_ADDRESS ,
-                                        &(time->Day) );
-        ret = MSSP_I2C_Read_Byte_Register(  REAL_TIME_CLOCK_DS1307_ADDRESS ,
-                                        MONTH_REGISTER_ADDRESS ,
-                                        &(time->Month) );
-        
-        ret = MSSP_I2C_Read_Byte_Register(  REAL_TIME_CLOCK_DS1307_ADDRESS ,
-                                        YEAR_REGISTER_ADDRESS ,
-                                        &(time->Year) );
+        /* One burst from SECONDS (0x00) up to YEAR (0x06) instead of six single-register transactions */
+        ret = I2C_Bus_Read_Registers( rtc_bus , REAL_TIME_CLOCK_DS1307_ADDRESS ,
+                                      SECONDS_REGISTER_ADDRESS ,
+                                      rtc_registers ,
+                                      REAL_TIME_CLOCK_DS1307_TIME_REGISTERS );
+        if(E_OK == ret){
+            time->Seconds = rtc_registers[SECONDS_REGISTER_ADDRESS];
+            time->Minutes = rtc_registers[MINUTES_REGISTER_ADDRESS];
+            time->Hours   = rtc_registers[HOURS_REGISTER_ADDRESS];
+            time->Day     = rtc_registers[DATE_REGISTER_ADDRESS];
+            time->Month   = rtc_registers[MONTH_REGISTER_ADDRESS];
+            time->Year    = rtc_registers[YEAR_REGISTER_ADDRESS];
+        }
+        else{ /* Nothing */ }
     }     
     return ret ;
 }
+
+Std_ReturnType RealTimeClock_DS1307_Set_Date_Time(const RealTimeClock_DS1307_t * time){
+    Std_ReturnType ret = E_OK;
+    uint8 rtc_registers[REAL_TIME_CLOCK_DS1307_TIME_REGISTERS] = {0};
+    
+    if((NULL == time) ||
+       !RTC_BCD_IN_RANGE(time->Seconds , 0x00 , 0x59) || !RTC_BCD_IN_RANGE(time->Minutes , 0x00 , 0x59) ||
+       !RTC_BCD_IN_RANGE(time->Hours , 0x00 , 0x23) || !RTC_BCD_IN_RANGE(time->Day , 0x01 , 0x31) ||
+       !RTC_BCD_IN_RANGE(time->Month , 0x01 , 0x12) || !RTC_BCD_IN_RANGE(time->Year , 0x00 , 0x99)){
+        ret = E_NOT_OK;
+    }
+    else{
+        /* Day of week is not part of RealTimeClock_DS1307_t : keep the device value */
+        ret = I2C_Bus_Read_Registers( rtc_bus , REAL_TIME_CLOCK_DS1307_ADDRESS ,
+                                      DAY_REGISTER_ADDRESS ,
+                                      &rtc_registers[DAY_REGISTER_ADDRESS] ,
+                                      1 );
+        if(E_OK == ret){
+            rtc_registers[SECONDS_REGISTER_ADDRESS] = time->Seconds;      /* CH = 0 , oscillator running */
+            rtc_registers[MINUTES_REGISTER_ADDRESS] = time->Minutes;
+            rtc_registers[HOURS_REGISTER_ADDRESS]   = time->Hours;        /* Bit 6 = 0 , 24-hour mode */
+            rtc_registers[DATE_REGISTER_ADDRESS]    = time->Day;
+            rtc_registers[MONTH_REGISTER_ADDRESS]   = time->Month;
+            rtc_registers[YEAR_REGISTER_ADDRESS]    = time->Year;
+            ret = I2C_Bus_Write_Registers( rtc_bus , REAL_TIME_CLOCK_DS1307_ADDRESS ,
+                                           SECONDS_REGISTER_ADDRESS ,
+                                           rtc_registers ,
+                                           REAL_TIME_CLOCK_DS1307_TIME_REGISTERS );
+        }
+        else{ /* Nothing */ }
+#if EXTERNAL_INTERRUPT_INTx_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+        if((E_OK == ret) && (TRUE == rtc_cache_started)){
+            ret = RealTimeClock_DS1307_Cache_Resync();
+        }
+        else{ /* Nothing */ }
+#endif
+    }
+    return ret ;
+}
+
+Std_ReturnType RealTimeClock_DS1307_NVRAM_Read(uint8 offset , uint8 * data , uint8 length){
+    Std_ReturnType ret = E_OK;
+    
+    if((NULL == data) || !RTC_NVRAM_IN_RANGE(offset , length)){
+        ret = E_NOT_OK;
+    }
+    else{
+        ret = I2C_Bus_Read_Registers( rtc_bus , REAL_TIME_CLOCK_DS1307_ADDRESS ,
+                                      (uint8)(NVRAM_REGISTER_ADDRESS + offset) ,
+                                      data ,
+                                      length );
+    }
+    return ret ;
+}
+
+Std_ReturnType RealTimeClock_DS1307_NVRAM_Write(uint8 offset , const uint8 * data , uint8 length){
+    Std_ReturnType ret = E_OK;
+    
+    if((NULL == data) || !RTC_NVRAM_IN_RANGE(offset , length)){
+        ret = E_NOT_OK;
+    }
+    else{
+        ret = I2C_Bus_Write_Registers( rtc_bus , REAL_TIME_CLOCK_DS1307_ADDRESS ,
+                                       (uint8)(NVRAM_REGISTER_ADDRESS + offset) ,
+                                       data ,
+                                       length );
+    }
+    return ret ;
+}
+
+#if EXTERNAL_INTERRUPT_INTx_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+Std_ReturnType RealTimeClock_DS1307_Cache_Init(const Interrupt_INTx_t * sqw_int){
+    Std_ReturnType ret = E_OK;
+    uint8 l_control = REAL_TIME_CLOCK_DS1307_SQW_1HZ;
+    
+    if(NULL == sqw_int){
+        ret = E_NOT_OK;
+    }
+    else{
+        rtc_cache_started = FALSE;
+        ret = I2C_Bus_Write_Registers( rtc_bus , REAL_TIME_CLOCK_DS1307_ADDRESS ,
+                                       CONTROL_REGISTER_ADDRESS ,
+                                       &l_control ,
+                                       1 );
+        if(E_OK == ret){
+            rtc_sqw_int = *sqw_int;
+            rtc_sqw_user_handler = sqw_int->External_InterruptHandler;
+            rtc_sqw_int.External_InterruptHandler = RealTimeClock_DS1307_SQW_Handler;
+            rtc_cache_started = TRUE;
+            ret = RealTimeClock_DS1307_Cache_Resync();
+            ret &= interrupt_INTx_Init(&rtc_sqw_int);
+        }
+        else{ /* Nothing */ }
+    }
+    return ret ;
+}
+
+Std_ReturnType RealTimeClock_DS1307_Cache_Get(RealTimeClock_DS1307_t * time){
+    Std_ReturnType ret = E_OK;
+    interrupt_critical_t l_section;
+    uint8 l_seconds = ZERO_INIT;
+    
+    if((NULL == time) || (FALSE == rtc_cache_started)){
+        ret = E_NOT_OK;
+    }
+    else{
+        /* Take the edges counted by the handler , only the SQW input is masked */
+        (void)Interrupt_Critical_Enter(&l_section , rtc_sqw_sources[rtc_sqw_int.source]);
+        l_seconds = rtc_pending_seconds;
+        rtc_pending_seconds = ZERO_INIT;
+        (void)Interrupt_Critical_Exit(&l_section);
+        
+        RealTimeClock_DS1307_Advance(l_seconds);
+        rtc_seconds_since_sync += l_seconds;
+        if(REAL_TIME_CLOCK_DS1307_RESYNC_SECONDS <= rtc_seconds_since_sync){
+            ret = RealTimeClock_DS1307_Cache_Resync();
+        }
+        else{ /* Cache still trusted */ }
+        *time = rtc_cache;
+    }
+    return ret ;
+}
+
+Std_ReturnType RealTimeClock_DS1307_Cache_Resync(void){
+    Std_ReturnType ret = E_OK;
+    RealTimeClock_DS1307_t l_time;
+    interrupt_critical_t l_section;
+    
+    if(FALSE == rtc_cache_started){
+        ret = E_NOT_OK;
+    }
+    else{
+        ret = RealTimeClock_DS1307_Get_Date_Time(&l_time);
+        if(E_OK == ret){
+            /* Edges counted during the read belong to the time just read */
+            (void)Interrupt_Critical_Enter(&l_section , rtc_sqw_sources[rtc_sqw_int.source]);
+            rtc_pending_seconds = ZERO_INIT;
+            (void)Interrupt_Critical_Exit(&l_section);
+            l_time.Seconds &= 0x7F;         /* CH bit */
+            l_time.Hours &= 0x3F;           /* 24-hour mode */
+            rtc_cache = l_time;
+            rtc_seconds_since_sync = ZERO_INIT;
+        }
+        else{ /* Keep counting from SQW , retried on the next call */ }
+    }
+    return ret ;
+}
+
+/* Static Function Definition */
+
+/**
+ * @brief INTx handler on every SQW edge : one second , applied later by Cache_Get
+ */
+static void RealTimeClock_DS1307_SQW_Handler(void){
+    if(0xFF != rtc_pending_seconds){
+        rtc_pending_seconds++;
+    }
+    else{ /* Saturated , the next re-sync corrects the cache */ }
+    if(rtc_sqw_user_handler){
+        rtc_sqw_user_handler();
+    }
+    else{ /* Nothing */ }
+}
+
+/**
+ * @brief Add seconds to the cache with the minute / hour / date / month / year carries
+ */
+static void RealTimeClock_DS1307_Advance(uint8 seconds){
+    uint8 l_days = ZERO_INIT;
+    uint8 l_year = ZERO_INIT;
+    uint8 l_month = ZERO_INIT;
+    
+    while(ZERO_INIT != seconds){
+        seconds--;
+        if(RealTimeClock_DS1307_BCD_Increment(&rtc_cache.Seconds , 0x59 , 0x00) &&
+           RealTimeClock_DS1307_BCD_Increment(&rtc_cache.Minutes , 0x59 , 0x00) &&
+           RealTimeClock_DS1307_BCD_Increment(&rtc_cache.Hours , 0x23 , 0x00)){
+            /* Midnight : the month length decides the date carry */
+            l_month = (uint8)(((rtc_cache.Month >> 4) * 10) + (rtc_cache.Month & 0x0F));
+            l_year = (uint8)(((rtc_cache.Year >> 4) * 10) + (rtc_cache.Year & 0x0F));
+            l_days = ((ZERO_INIT == l_month) || (12 < l_month)) ? 0x31 : rtc_days_in_month[l_month - 1];
+            if((2 == l_month) && (ZERO_INIT == (l_year & 0x03))){
+                l_days = 0x29;
+            }
+            else{ /* Nothing */ }
+            if(RealTimeClock_DS1307_BCD_Increment(&rtc_cache.Day , l_days , 0x01) &&
+               RealTimeClock_DS1307_BCD_Increment(&rtc_cache.Month , 0x12 , 0x01)){
+                (void)RealTimeClock_DS1307_BCD_Increment(&rtc_cache.Year , 0x99 , 0x00);
+            }
+            else{ /* Nothing */ }
+        }
+        else{ /* No carry past this field */ }
+    }
+}
+
+/**
+ * @brief BCD increment , back to wrap past max
+ * @return 1 on carry out , 0 otherwise
+ */
+static uint8 RealTimeClock_DS1307_BCD_Increment(uint8 * value , uint8 max , uint8 wrap){
+    uint8 l_carry = 0;
+    
+    if(*value >= max){
+        *value = wrap;
+        l_carry = 1;
+    }
+    else if(0x09 == (*value & 0x0F)){
+        *value = (uint8)((*value & 0xF0) + 0x10);
+    }
+    else{
+        (*value)++;
+    }
+    return l_carry;
+}
+#endif
@@ -9,12 +9,17 @@
  * The driver allows the application layer to read the current
  * date and time stored inside the DS1307 registers.
  *
- * The DS1307 communication is performed through the MSSP I2C
- * driver located in the MCAL layer.
+ * The DS1307 communication is performed through the I2C bus selector
+ * of the MCAL layer , on the MSSP bus unless
+ * RealTimeClock_DS1307_Bind_Bus picks the software bus.
  *
  * Supported features:
  *  - Read current time (hours, minutes, seconds)
  *  - Read current date (day, month, year)
+ *  - Set date and time (one burst write , clock started , 24-hour mode)
+ *  - Read / write the 56 bytes of battery-backed NVRAM
+ *  - Cached time advanced by the 1 Hz SQW output on an INTx pin ,
+ *    re-synchronized over I2C every REAL_TIME_CLOCK_DS1307_RESYNC_SECONDS
  *
  * Notes:
  *  - DS1307 stores time values in BCD format.
@@ -22,7 +27,7 @@
  *
  * Layer      : ECUAL
  * Target MCU : PIC18F4620
- * Communication : I2C (MSSP)
+ * Communication : I2C (MSSP or software bus)
  *
  * @author   Abdelmoniem Ahmed
  * @linkedin https://www.linkedin.com/in/abdelmoniem-ahmed/
@@ -34,7 +39,9 @@
 
 /* Section : Includes */
 
-#include "../../mcal/I2C/I2C_APIs.h"
+#include "../../mcal/I2C/I2C_Bus.h"
+#include "../../mcal/Interrupt/mcal_externl_interrupt.h"
+#include "../../mcal/Interrupt/mcal_interrupt_critical.h"
 
 /* Section : Macro Declaration */
 
@@ -55,6 +62,20 @@
 #define MONTH_REGISTER_ADDRESS                  0x05
 #define YEAR_REGISTER_ADDRESS                   0x06
 
+/* Number of timekeeping registers (0x00 .. 0x06) read in one burst */
+#define REAL_TIME_CLOCK_DS1307_TIME_REGISTERS   0x07
+
+/* Battery-backed NVRAM : registers 0x08 .. 0x3F */
+#define NVRAM_REGISTER_ADDRESS                  0x08
+#define REAL_TIME_CLOCK_DS1307_NVRAM_SIZE       56
+
+/* Control register : SQWE = 1 , RS1:RS0 = 00 -> 1 Hz square wave on SQW/OUT */
+#define CONTROL_REGISTER_ADDRESS                0x07
+#define REAL_TIME_CLOCK_DS1307_SQW_1HZ          0x10
+
+/* Cached clock : seconds counted from SQW between two I2C re-syncs */
+#define REAL_TIME_CLOCK_DS1307_RESYNC_SECONDS   60
+
 
 /* Section : Macro Functions Declarations */
 
@@ -80,6 +101,17 @@ typedef struct{
 
 /* Section : Function Declarations */
 
+/**
+ * @brief Select the I2C bus the DS1307 is wired to , I2C_BUS_MSSP by default
+ *
+ * @param bus I2C_BUS_MSSP or I2C_BUS_SOFT
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Bus selected
+ *         - E_NOT_OK : Unknown bus
+ */
+Std_ReturnType RealTimeClock_DS1307_Bind_Bus(i2c_bus_t bus);
+
 /**
  * @brief Read current date and time from the DS1307 RTC
  *
@@ -90,6 +122,7 @@ typedef struct{
  *         - E_NOT_OK : Null pointer or communication failure
  *
  * @note
+ * The registers are fetched in a single I2C burst read.
  * The function reads the following DS1307 registers:
  *  - Seconds  (0x00)
  *  - Minutes  (0x01)
@@ -101,5 +134,98 @@ typedef struct{
 
 Std_ReturnType RealTimeClock_DS1307_Get_Date_Time(RealTimeClock_DS1307_t * time);
 
+/**
+ * @brief Set the date and time of the DS1307
+ *
+ * @param time Date and time in BCD (Hours 0x00 - 0x23 , Day 0x01 - 0x31 ,
+ *             Month 0x01 - 0x12 , Year 0x00 - 0x99)
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Clock set and running
+ *         - E_NOT_OK : Null pointer , value out of range or communication failure
+ *
+ * @note
+ * Registers 0x00 - 0x06 are written in one burst , the day-of-week
+ * register is read first and written back unchanged. The clock-halt bit
+ * is cleared and 24-hour mode selected. The cached clock , when started ,
+ * is re-synced.
+ */
+Std_ReturnType RealTimeClock_DS1307_Set_Date_Time(const RealTimeClock_DS1307_t * time);
+
+/**
+ * @brief Read bytes of the battery-backed NVRAM
+ *
+ * @param offset First byte (0 - 55)
+ * @param data   Destination buffer
+ * @param length Number of bytes , offset + length <= REAL_TIME_CLOCK_DS1307_NVRAM_SIZE
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Read successful
+ *         - E_NOT_OK : Null pointer , zero length , range past the NVRAM or communication failure
+ *
+ * @note One burst read , no write delay and no wear limit (unlike an EEPROM).
+ */
+Std_ReturnType RealTimeClock_DS1307_NVRAM_Read(uint8 offset , uint8 * data , uint8 length);
+
+/**
+ * @brief Write bytes of the battery-backed NVRAM
+ *
+ * @param offset First byte (0 - 55)
+ * @param data   Source buffer
+ * @param length Number of bytes , offset + length <= REAL_TIME_CLOCK_DS1307_NVRAM_SIZE
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Write successful
+ *         - E_NOT_OK : Null pointer , zero length , range past the NVRAM or communication failure
+ *
+ * @note One burst write , the data is valid as soon as the STOP is sent.
+ */
+Std_ReturnType RealTimeClock_DS1307_NVRAM_Write(uint8 offset , const uint8 * data , uint8 length);
+
+#if EXTERNAL_INTERRUPT_INTx_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+/**
+ * @brief Start the cached clock driven by the DS1307 1 Hz SQW output
+ *
+ * @param sqw_int INTx source , edge and pin wired to SQW/OUT (open drain ,
+ *                pull-up required). The driver installs its own handler ,
+ *                a non NULL handler field is called by it on every edge
+ *                (interrupt context , e.g. to post a tick event).
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : SQW enabled , cache loaded , INTx armed
+ *         - E_NOT_OK : Null pointer or communication failure
+ *
+ * @note The MSSP I2C master must be initialized first.
+ */
+Std_ReturnType RealTimeClock_DS1307_Cache_Init(const Interrupt_INTx_t * sqw_int);
+
+/**
+ * @brief Read the cached date and time (BCD , same layout as Get_Date_Time)
+ *
+ * @param time Pointer to structure that will hold the date and time.
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Cached time returned
+ *         - E_NOT_OK : Null pointer , cache not started , or the periodic
+ *                      re-sync failed (time still advanced from SQW)
+ *
+ * @note
+ * The seconds counted by the INTx handler since the last call are added
+ * to the cache here , with the calendar carries (24-hour mode , leap
+ * years 2000 - 2099). One burst read refreshes the cache every
+ * REAL_TIME_CLOCK_DS1307_RESYNC_SECONDS , no I2C traffic otherwise.
+ */
+Std_ReturnType RealTimeClock_DS1307_Cache_Get(RealTimeClock_DS1307_t * time);
+
+/**
+ * @brief Refresh the cache from the DS1307 now (e.g. after setting the clock)
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Cache reloaded
+ *         - E_NOT_OK : Cache not started or communication failure
+ */
+Std_ReturnType RealTimeClock_DS1307_Cache_Resync(void);
+#endif
+
 #endif	/* REALTIMECLOCK_DS1307_H */
 
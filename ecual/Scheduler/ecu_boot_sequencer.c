@@ -0,0 +1,127 @@
+/*
+ * @file    ecu_boot_sequencer.c
+ * @brief   Non-blocking boot sequencer implementation
+ *
+ * @details
+ * Every running task keeps the tick of its next step. A step that asks
+ * for 0 ms runs again on the next Process call , a step that asks for a
+ * wait is skipped until the tick reaches it , other tasks keep going.
+ *
+ * Layer: ECUAL
+ * Target MCU: PIC18F4620
+ *
+ * Author: Abdelmoniem Ahmed
+ * Linkedin: https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * Date: 2026
+ */
+
+#include "ecu_boot_sequencer.h"
+
+/* Tick a is at or after tick b , modulo 2^16 */
+#define BOOT_TICK_REACHED(_A , _B)          (0 <= (sint16)((uint16)((_A) - (_B))))
+
+/* Section : Function Definitions */
+
+Std_ReturnType Boot_Sequencer_Init(boot_sequencer_t *sequencer){
+    Std_ReturnType ret = E_OK;
+    uint8 l_index = ZERO_INIT;
+
+    if((NULL == sequencer) || (NULL == sequencer->tasks) || (ZERO_INIT == sequencer->task_count)){
+        ret = E_NOT_OK;
+    }
+    else{
+        ret = Scheduler_Get_Tick(&(sequencer->start_tick));
+        sequencer->boot_ticks = ZERO_INIT;
+        sequencer->done = FALSE;
+        for(l_index = ZERO_INIT ; l_index < sequencer->task_count ; l_index++){
+            sequencer->tasks[l_index].next_run = sequencer->start_tick;
+            sequencer->tasks[l_index].state = (NULL != sequencer->tasks[l_index].step_function) ?
+                                              BOOT_TASK_RUNNING : BOOT_TASK_FAILED;
+        }
+    }
+    return ret;
+}
+
+Std_ReturnType Boot_Sequencer_Process(boot_sequencer_t *sequencer){
+    Std_ReturnType ret = E_OK;
+    boot_task_t *l_task = NULL;
+    uint16 l_now = ZERO_INIT;
+    uint16 l_wait_ms = ZERO_INIT;
+    uint8 l_task_done = FALSE;
+    uint8 l_running = FALSE;
+    uint8 l_index = ZERO_INIT;
+
+    if(NULL == sequencer){
+        ret = E_NOT_OK;
+    }
+    else if(TRUE == sequencer->done){
+        /* Nothing left , the call costs one test */
+    }
+    else{
+        for(l_index = ZERO_INIT ; l_index < sequencer->task_count ; l_index++){
+            l_task = &(sequencer->tasks[l_index]);
+            (void)Scheduler_Get_Tick(&l_now);
+            if((BOOT_TASK_RUNNING == l_task->state) && (BOOT_TICK_REACHED(l_now , l_task->next_run))){
+                l_task_done = FALSE;
+                l_wait_ms = ZERO_INIT;
+                if(E_OK != l_task->step_function(&l_task_done , &l_wait_ms)){
+                    l_task->state = BOOT_TASK_FAILED;
+                }
+                else if(TRUE == l_task_done){
+                    l_task->state = BOOT_TASK_DONE;
+                }
+                else{
+                    (void)Scheduler_Get_Tick(&l_now);
+                    l_task->next_run = l_now + SCHEDULER_MS_TO_TICKS(l_wait_ms);
+                }
+            }
+            else{ /* Waiting or settled */ }
+
+            /* A task past its timeout gives up , the others are not held back */
+            if((BOOT_TASK_RUNNING == l_task->state) && (ZERO_INIT != l_task->timeout) &&
+               (l_task->timeout <= (uint16)(l_now - sequencer->start_tick))){
+                l_task->state = BOOT_TASK_FAILED;
+            }
+            else{ /* Nothing */ }
+
+            if(BOOT_TASK_RUNNING == l_task->state){
+                l_running = TRUE;
+            }
+            else{ /* Nothing */ }
+        }
+        if(FALSE == l_running){
+            sequencer->boot_ticks = (uint16)(l_now - sequencer->start_tick);
+            sequencer->done = TRUE;
+        }
+        else{ /* Nothing */ }
+    }
+    return ret;
+}
+
+Std_ReturnType Boot_Sequencer_Get_State(const boot_sequencer_t *sequencer , uint8 index , boot_task_state_t *state){
+    Std_ReturnType ret = E_OK;
+
+    if((NULL == sequencer) || (NULL == state) || (index >= sequencer->task_count)){
+        ret = E_NOT_OK;
+    }
+    else{
+        *state = sequencer->tasks[index].state;
+    }
+    return ret;
+}
+
+Std_ReturnType Boot_Sequencer_Is_Done(const boot_sequencer_t *sequencer , uint8 *done , uint16 *boot_ticks){
+    Std_ReturnType ret = E_OK;
+
+    if((NULL == sequencer) || (NULL == done)){
+        ret = E_NOT_OK;
+    }
+    else{
+        *done = sequencer->done;
+        if(NULL != boot_ticks){
+            *boot_ticks = sequencer->boot_ticks;
+        }
+        else{ /* Boot time not wanted */ }
+    }
+    return ret;
+}
@@ -0,0 +1,144 @@
+/*
+ * @file    ecu_boot_sequencer.h
+ * @brief   Non-blocking bring-up of slow peripherals on the scheduler tick
+ *
+ * @details
+ * Fast drivers (UART , I2C , keypad , the tick itself) are initialized
+ * directly at reset. Peripherals that need long waits before they are
+ * usable (LCD power-on , first sensor conversion , external clock warm-up)
+ * are written as init state machines : each call of a step function does
+ * the work that needs no waiting and returns how long to wait before the
+ * next call.
+ *
+ * Boot_Sequencer_Process() runs every step whose wait has elapsed , so the
+ * waits of all boot tasks overlap each other and the application loop ,
+ * instead of adding up in front of it.
+ *
+ * Per task :
+ *  - step_function : one state machine step , reports done / next wait
+ *  - timeout       : ticks from Boot_Sequencer_Init() after which a task
+ *                    still not done is marked failed , 0 = no timeout
+ *
+ * Layer: ECUAL
+ * Target MCU: PIC18F4620
+ *
+ * Author: Abdelmoniem Ahmed
+ * Linkedin: https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * Date: 2026
+ */
+
+#ifndef ECU_BOOT_SEQUENCER_H
+#define	ECU_BOOT_SEQUENCER_H
+
+/* Section : Includes */
+#include"ecu_scheduler.h"
+
+/* Section : Data Types Declarations */
+
+/**
+ * @brief One init state machine step
+ *
+ * @param done    Set to TRUE when the peripheral is ready (no more calls)
+ * @param wait_ms Milliseconds before the next call , 0 = next Process call
+ *
+ * @return E_OK to continue , E_NOT_OK marks the task failed
+ */
+typedef Std_ReturnType (* boot_step_function_t)(uint8 *done , uint16 *wait_ms);
+
+/**
+ * @enum boot_task_state_t
+ * @brief Progress of one boot task
+ */
+typedef enum{
+    BOOT_TASK_RUNNING = 0 ,     /* Steps still to run */
+    BOOT_TASK_DONE ,            /* Peripheral ready */
+    BOOT_TASK_FAILED            /* Step error or timeout */
+}boot_task_state_t;
+
+/**
+ * @struct boot_task_t
+ * @brief One entry of the boot table
+ *
+ * @details
+ * - step_function / timeout : Set by the application
+ * - next_run / state        : Filled by the sequencer , do not modify
+ */
+typedef struct{
+    boot_step_function_t step_function ;
+    uint16 timeout ;
+    uint16 next_run ;
+    boot_task_state_t state ;
+}boot_task_t;
+
+/**
+ * @struct boot_sequencer_t
+ * @brief Boot table descriptor
+ *
+ * @details
+ * - tasks / task_count      : Set by the application
+ * - start_tick / boot_ticks : Filled by the sequencer , do not modify
+ */
+typedef struct{
+    boot_task_t *tasks ;
+    uint8 task_count ;
+    uint16 start_tick ;
+    uint16 boot_ticks ;         /* Init to last task settled , valid once done */
+    uint8 done ;
+}boot_sequencer_t;
+
+/* Section : Function Declarations */
+
+/**
+ * @brief Arm every boot task , the first steps run on the next Process call
+ *
+ * @param sequencer Pointer to the boot table descriptor
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Table armed
+ *         - E_NOT_OK : Null pointer or empty table
+ *
+ * @note Scheduler_Init() must run first (it owns the tick).
+ */
+Std_ReturnType Boot_Sequencer_Init(boot_sequencer_t *sequencer);
+
+/**
+ * @brief Run every boot step whose wait has elapsed
+ *
+ * @param sequencer Pointer to the boot table descriptor
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Table processed
+ *         - E_NOT_OK : Null pointer
+ *
+ * @note Call it from the main loop or from a 1 tick scheduler task.
+ */
+Std_ReturnType Boot_Sequencer_Process(boot_sequencer_t *sequencer);
+
+/**
+ * @brief Read the progress of one boot task
+ *
+ * @param sequencer Pointer to the boot table descriptor
+ * @param index     Task index in the table
+ * @param state     Pointer to the returned state
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : State returned
+ *         - E_NOT_OK : Null pointer or index out of range
+ */
+Std_ReturnType Boot_Sequencer_Get_State(const boot_sequencer_t *sequencer , uint8 index , boot_task_state_t *state);
+
+/**
+ * @brief Check whether every boot task has settled (done or failed)
+ *
+ * @param sequencer  Pointer to the boot table descriptor
+ * @param done       Pointer to the returned flag
+ * @param boot_ticks Pointer to the returned boot time in ticks , may be NULL ,
+ *                   only meaningful when *done is TRUE
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Flag returned
+ *         - E_NOT_OK : Null pointer
+ */
+Std_ReturnType Boot_Sequencer_Is_Done(const boot_sequencer_t *sequencer , uint8 *done , uint16 *boot_ticks);
+
+#endif	/* ECU_BOOT_SEQUENCER_H */
@@ -0,0 +1,158 @@
+/*
+ * @file    ecu_event.c
+ * @brief   Event queue with a publish / subscribe dispatcher implementation
+ *
+ * @details
+ * Event_Dispatch() takes at most the events pending when it is called ,
+ * an event posted by a handler waits for the next call : a handler that
+ * re-posts its own event cannot hold the main loop.
+ *
+ * Layer: ECUAL
+ * Target MCU: PIC18F4620
+ *
+ * Author: Abdelmoniem Ahmed
+ * Linkedin: https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * Date: 2026
+ */
+
+#include "ecu_event.h"
+
+/* Section : Static Function Declarations */
+
+static void event_publish(const event_t *event);
+
+/* Section : Static Variables */
+
+static SPSC_QUEUE_TYPE(event_t , EVENT_ISR_QUEUE_SIZE) event_isr_queue;
+static SPSC_QUEUE_TYPE(event_t , EVENT_QUEUE_SIZE) event_queue;
+static const event_table_t *event_table = NULL;
+
+/* One writer each : the ISR counter (interrupt context) , the main loop counter */
+static volatile uint8 event_isr_dropped = ZERO_INIT;
+static uint8 event_dropped = ZERO_INIT;
+
+/* Section : Function Definitions */
+
+Std_ReturnType Event_Init(const event_table_t *table){
+    Std_ReturnType ret = E_OK;
+
+    if((NULL == table) || (NULL == table->subscribers) || (ZERO_INIT == table->subscriber_count)){
+        ret = E_NOT_OK;
+    }
+    else{
+        event_table = table;
+    }
+    return ret;
+}
+
+Std_ReturnType Event_Post(uint8 event_id , uint8 arg8 , uint16 arg16){
+    Std_ReturnType ret = E_OK;
+    event_t *l_event = &SPSC_QUEUE_BACK(event_queue);
+
+    if(SPSC_QUEUE_IS_FULL(event_queue)){
+        if(EVENT_DROPPED_MAX != event_dropped){
+            event_dropped++;
+        }
+        else{ /* Saturated */ }
+        ret = E_NOT_OK;
+    }
+    else{
+        l_event->event_id = event_id;
+        l_event->arg8 = arg8;
+        l_event->arg16 = arg16;
+        SPSC_QUEUE_PUBLISH(event_queue , 1);
+    }
+    return ret;
+}
+
+Std_ReturnType Event_Post_From_ISR(uint8 event_id , uint8 arg8 , uint16 arg16){
+    Std_ReturnType ret = E_OK;
+    event_t *l_event = &SPSC_QUEUE_BACK(event_isr_queue);
+
+    if(SPSC_QUEUE_IS_FULL(event_isr_queue)){
+        if(EVENT_DROPPED_MAX != event_isr_dropped){
+            event_isr_dropped++;
+        }
+        else{ /* Saturated */ }
+        ret = E_NOT_OK;
+    }
+    else{
+        l_event->event_id = event_id;
+        l_event->arg8 = arg8;
+        l_event->arg16 = arg16;
+        SPSC_QUEUE_PUBLISH(event_isr_queue , 1);
+    }
+    return ret;
+}
+
+Std_ReturnType Event_Dispatch(void){
+    Std_ReturnType ret = E_OK;
+    event_t l_event;
+    uint8 l_isr_pending = ZERO_INIT;
+    uint8 l_pending = ZERO_INIT;
+
+    if(NULL == event_table){
+        ret = E_NOT_OK;
+    }
+    else{
+        l_isr_pending = SPSC_QUEUE_USED(event_isr_queue);
+        l_pending = SPSC_QUEUE_USED(event_queue);
+        while(ZERO_INIT != l_isr_pending){
+            /* Copied out first , the ISR may reuse the slot while the handlers run */
+            l_event = SPSC_QUEUE_FRONT(event_isr_queue);
+            SPSC_QUEUE_RELEASE(event_isr_queue);
+            event_publish(&l_event);
+            l_isr_pending--;
+        }
+        while(ZERO_INIT != l_pending){
+            l_event = SPSC_QUEUE_FRONT(event_queue);
+            SPSC_QUEUE_RELEASE(event_queue);
+            event_publish(&l_event);
+            l_pending--;
+        }
+    }
+    return ret;
+}
+
+Std_ReturnType Event_Is_Idle(uint8 *idle){
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == idle){
+        ret = E_NOT_OK;
+    }
+    else{
+        *idle = (SPSC_QUEUE_IS_EMPTY(event_isr_queue) && SPSC_QUEUE_IS_EMPTY(event_queue)) ? TRUE : FALSE;
+    }
+    return ret;
+}
+
+Std_ReturnType Event_Get_Dropped(uint8 *dropped){
+    Std_ReturnType ret = E_OK;
+    uint16 l_total = ZERO_INIT;
+
+    if(NULL == dropped){
+        ret = E_NOT_OK;
+    }
+    else{
+        l_total = (uint16)event_isr_dropped + event_dropped;
+        *dropped = (EVENT_DROPPED_MAX < l_total) ? EVENT_DROPPED_MAX : (uint8)l_total;
+    }
+    return ret;
+}
+
+/* Section : Static Function Definitions */
+
+/**
+ * @brief Call every subscriber of the event , in table order
+ */
+static void event_publish(const event_t *event){
+    uint8 l_index = ZERO_INIT;
+
+    for(l_index = ZERO_INIT ; l_index < event_table->subscriber_count ; l_index++){
+        if((event->event_id == event_table->subscribers[l_index].event_id) &&
+           (NULL != event_table->subscribers[l_index].handler)){
+            event_table->subscribers[l_index].handler(event);
+        }
+        else{ /* Other event */ }
+    }
+}
@@ -0,0 +1,160 @@
+/*
+ * @file    ecu_event.h
+ * @brief   Event queue with a publish / subscribe run-to-completion dispatcher
+ *
+ * @details
+ * Drivers and tasks post small events , Event_Dispatch() hands each one
+ * to its subscribers from the main loop. A handler runs to completion
+ * before the next event is taken , so handlers never preempt each other
+ * and may use any driver.
+ *
+ * Two SPSC queues (spsc_queue.h) keep posting lock free :
+ *  - Event_Post_From_ISR : producer = interrupt context
+ *  - Event_Post          : producer = main loop (tasks , handlers , callbacks)
+ * Events posted by an ISR are dispatched first.
+ *
+ * The subscriber table is owned by the application : every entry whose
+ * event_id matches is called , in table order. Event_Init() with another
+ * table switches tables , pending events are kept.
+ *
+ * Layer: ECUAL
+ * Target MCU: PIC18F4620
+ *
+ * Author: Abdelmoniem Ahmed
+ * Linkedin: https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * Date: 2026
+ */
+
+#ifndef ECU_EVENT_H
+#define	ECU_EVENT_H
+
+/* Section : Includes */
+#include"spsc_queue.h"
+
+/* Section : Macro Declaration */
+
+/* Queue depths , powers of two (2 .. 128) , 4 bytes of RAM per event */
+#define EVENT_ISR_QUEUE_SIZE                8
+#define EVENT_QUEUE_SIZE                    8
+
+/* Saturation value of the drop counter */
+#define EVENT_DROPPED_MAX                   0xFF
+
+#if !SPSC_QUEUE_SIZE_VALID(EVENT_ISR_QUEUE_SIZE) || !SPSC_QUEUE_SIZE_VALID(EVENT_QUEUE_SIZE)
+#error "EVENT_ISR_QUEUE_SIZE and EVENT_QUEUE_SIZE must be powers of two between 2 and 128"
+#endif
+
+/* Section : Data Types Declarations */
+
+/**
+ * @struct event_t
+ * @brief One posted event , ids are chosen by the application
+ */
+typedef struct{
+    uint8  event_id ;
+    uint8  arg8 ;
+    uint16 arg16 ;
+}event_t;
+
+/**
+ * @brief Subscriber callback , runs in the main loop context
+ */
+typedef void (* event_handler_t)(const event_t *event);
+
+/**
+ * @struct event_subscriber_t
+ * @brief One entry of the subscriber table
+ */
+typedef struct{
+    uint8 event_id ;
+    event_handler_t handler ;
+}event_subscriber_t;
+
+/**
+ * @struct event_table_t
+ * @brief Subscriber table descriptor , can live in flash
+ */
+typedef struct{
+    const event_subscriber_t *subscribers ;
+    uint8 subscriber_count ;
+}event_table_t;
+
+/* Section : Function Declarations */
+
+/**
+ * @brief Select the subscriber table
+ *
+ * @param table Pointer to the subscriber table descriptor
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Table selected
+ *         - E_NOT_OK : Null pointer or empty table
+ */
+Std_ReturnType Event_Init(const event_table_t *table);
+
+/**
+ * @brief Queue an event from the main loop
+ *
+ * @param event_id Application event id
+ * @param arg8     First payload field
+ * @param arg16    Second payload field
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Event queued
+ *         - E_NOT_OK : Queue full , the event is counted as dropped
+ *
+ * @note An event posted by a handler is dispatched by the next Event_Dispatch().
+ */
+Std_ReturnType Event_Post(uint8 event_id , uint8 arg8 , uint16 arg16);
+
+/**
+ * @brief Queue an event from an interrupt handler
+ *
+ * @param event_id Application event id
+ * @param arg8     First payload field
+ * @param arg16    Second payload field
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Event queued
+ *         - E_NOT_OK : Queue full , the event is counted as dropped
+ *
+ * @note
+ * The ISR queue has a single producer : with INTERRUPT_PRIORITY_LEVELS_ENABLE
+ * post from handlers of one priority level only.
+ */
+Std_ReturnType Event_Post_From_ISR(uint8 event_id , uint8 arg8 , uint16 arg16);
+
+/**
+ * @brief Hand the pending events to their subscribers , call it from the main loop
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Pending events dispatched (an event without subscriber is discarded)
+ *         - E_NOT_OK : No subscriber table , the events stay queued
+ *
+ * @note Not reentrant : handlers must not call it.
+ */
+Std_ReturnType Event_Dispatch(void);
+
+/**
+ * @brief Check that both queues are empty , before an idle or sleep decision
+ *
+ * @param idle Pointer to the result (TRUE : nothing pending)
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Result returned
+ *         - E_NOT_OK : Null pointer
+ */
+Std_ReturnType Event_Is_Idle(uint8 *idle);
+
+/**
+ * @brief Read the number of events dropped on full queues (saturating)
+ *
+ * @param dropped Pointer to the returned count
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Count returned
+ *         - E_NOT_OK : Null pointer
+ */
+Std_ReturnType Event_Get_Dropped(uint8 *dropped);
+
+#endif	/* ECU_EVENT_H */
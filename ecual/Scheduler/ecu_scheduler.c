@@ -0,0 +1,178 @@
+/*
+ * @file    ecu_scheduler.c
+ * @brief   Cooperative time-triggered task scheduler implementation
+ *
+ * @details
+ * The Timer0 callback increments the tick counter and nothing else ,
+ * release checks and overrun bookkeeping run in Scheduler_Dispatch().
+ *
+ * Layer: ECUAL
+ * Target MCU: PIC18F4620
+ *
+ * Author: Abdelmoniem Ahmed
+ * Linkedin: https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * Date: 2026
+ */
+
+#include "ecu_scheduler.h"
+
+/* Tick a is at or after tick b , modulo 2^16 */
+#define SCHEDULER_TICK_REACHED(_A , _B)     (0 <= (sint16)((uint16)((_A) - (_B))))
+
+/* Section : Static Function Declarations */
+
+static void scheduler_tick_isr(void);
+static uint16 scheduler_tick_read(void);
+static void scheduler_overrun(scheduler_task_t *task);
+
+/* Section : Static Variables */
+
+static volatile uint16 scheduler_tick = ZERO_INIT;
+
+static timer0_t scheduler_timer = {
+    .timer0_preload_value = (uint16)SCHEDULER_TIMER0_PRELOAD ,
+    .prescaler_enable = PRESCALER_NOT_ASSIGNED_CFG ,
+    .counter_edge_select = TIMER0_RISING_EDGE_CFG ,
+    .clock_source = TIMER0_INTERNAL_CLK_SRC_CFG ,
+    .timer_resolution = TIMER0_16BIT_MODE_CFG ,
+    .TMR_InterruptHandler = scheduler_tick_isr ,
+};
+
+/* Section : Function Definitions */
+
+Std_ReturnType Scheduler_Init(scheduler_t *scheduler){
+    Std_ReturnType ret = E_OK;
+    uint16 l_now = ZERO_INIT;
+    uint8 l_index = ZERO_INIT;
+
+    if((NULL == scheduler) || (NULL == scheduler->tasks) || (ZERO_INIT == scheduler->task_count)){
+        ret = E_NOT_OK;
+    }
+    else{
+        ret = timer0_init(&scheduler_timer);
+        l_now = scheduler_tick_read();
+        for(l_index = ZERO_INIT ; l_index < scheduler->task_count ; l_index++){
+            scheduler->tasks[l_index].next_release = l_now + scheduler->tasks[l_index].offset;
+            scheduler->tasks[l_index].overrun_count = ZERO_INIT;
+            scheduler->tasks[l_index].task_done = FALSE;
+        }
+    }
+    return ret;
+}
+
+Std_ReturnType Scheduler_Dispatch(scheduler_t *scheduler){
+    Std_ReturnType ret = E_OK;
+    scheduler_task_t *l_task = NULL;
+    uint16 l_release = ZERO_INIT;
+    uint16 l_deadline = ZERO_INIT;
+    uint8 l_overrun = FALSE;
+    uint8 l_index = ZERO_INIT;
+
+    if(NULL == scheduler){
+        ret = E_NOT_OK;
+    }
+    else{
+        for(l_index = ZERO_INIT ; l_index < scheduler->task_count ; l_index++){
+            l_task = &(scheduler->tasks[l_index]);
+            if((FALSE == l_task->task_done) && (NULL != l_task->task_function) &&
+               (SCHEDULER_TICK_REACHED(scheduler_tick_read() , l_task->next_release))){
+                l_release = l_task->next_release;
+                l_task->task_function();
+
+                /* At most one overrun per release : late finish or missed releases */
+                l_deadline = (ZERO_INIT == l_task->deadline) ? l_task->period : l_task->deadline;
+                l_overrun = ((ZERO_INIT != l_deadline) &&
+                             (SCHEDULER_TICK_REACHED(scheduler_tick_read() , l_release + l_deadline + 1))) ? TRUE : FALSE;
+
+                if(ZERO_INIT == l_task->period){
+                    l_task->task_done = TRUE;
+                }
+                else{
+                    /* Keep the release grid , drop the releases already missed */
+                    l_task->next_release = l_release + l_task->period;
+                    while(SCHEDULER_TICK_REACHED(scheduler_tick_read() , l_task->next_release)){
+                        l_task->next_release += l_task->period;
+                        l_overrun = TRUE;
+                    }
+                }
+
+                if(TRUE == l_overrun){
+                    scheduler_overrun(l_task);
+                }
+                else{ /* Nothing */ }
+            }
+            else{ /* Not released yet */ }
+        }
+    }
+    return ret;
+}
+
+Std_ReturnType Scheduler_Get_Tick(uint16 *tick){
+    Std_ReturnType ret = E_OK;
+    if(NULL == tick){
+        ret = E_NOT_OK;
+    }
+    else{
+        *tick = scheduler_tick_read();
+    }
+    return ret;
+}
+
+Std_ReturnType Scheduler_Idle(const scheduler_t *scheduler , power_mode_t deepest){
+    Std_ReturnType ret = E_OK;
+    const scheduler_task_t *l_task = NULL;
+    power_mode_t l_mode = POWER_MODE_SLEEP;
+    uint8 l_gie = ZERO_INIT;
+    uint8 l_index = ZERO_INIT;
+
+    if((NULL == scheduler) || (POWER_MODE_SLEEP < deepest)){
+        ret = E_NOT_OK;
+    }
+    else{
+        /* Masked from the check to the SLEEP instruction , a tick in between wakes at once */
+        l_gie = INTCONbits.GIE;
+        INTCONbits.GIE = 0;
+        for(l_index = ZERO_INIT ; (l_index < scheduler->task_count) && (POWER_MODE_RUN != l_mode) ; l_index++){
+            l_task = &(scheduler->tasks[l_index]);
+            if((FALSE == l_task->task_done) && (NULL != l_task->task_function)){
+                /* Released now : run , pending : IDLE to keep the tick */
+                l_mode = (SCHEDULER_TICK_REACHED(scheduler_tick , l_task->next_release)) ? POWER_MODE_RUN : POWER_MODE_IDLE;
+            }
+            else{ /* Done , no wake-up needed */ }
+        }
+        if(l_mode > deepest){
+            l_mode = deepest;
+        }
+        else{ /* Nothing */ }
+        ret = Power_Enter(l_mode , NULL);
+        INTCONbits.GIE = l_gie;
+    }
+    return ret;
+}
+
+/* Section : Static Function Definitions */
+
+/**
+ * @brief Timer0 callback , O(1)
+ */
+static void scheduler_tick_isr(void){
+    scheduler_tick++;
+}
+
+/**
+ * @brief Tear-free read of the 16-bit tick , the ISR may fire between the two bytes
+ */
+static uint16 scheduler_tick_read(void){
+    uint16 l_tick = ZERO_INIT;
+    do{
+        l_tick = scheduler_tick;
+    }while(l_tick != scheduler_tick);
+    return l_tick;
+}
+
+static void scheduler_overrun(scheduler_task_t *task){
+    if(SCHEDULER_OVERRUN_MAX > task->overrun_count){
+        task->overrun_count++;
+    }
+    else{ /* Saturated */ }
+}
@@ -0,0 +1,155 @@
+/*
+ * @file    ecu_scheduler.h
+ * @brief   Cooperative time-triggered task scheduler on a Timer0 system tick
+ *
+ * @details
+ * Timer0 raises a SCHEDULER_TICK_MS system tick , the ISR only increments
+ * a counter. Tasks come from a static table owned by the application and
+ * are released by Scheduler_Dispatch() from the main loop , each one runs
+ * to completion in table order (lower index first).
+ *
+ * Per task :
+ *  - period   : ticks between two releases , 0 = one-shot
+ *  - offset   : ticks from Scheduler_Init() to the first release , used to
+ *               stagger tasks that share a period
+ *  - deadline : ticks after the release by which the task must have
+ *               finished , 0 = period (implicit deadline)
+ *
+ * A task that finishes after its deadline , or whose releases were missed
+ * because the loop was busy , counts an overrun. Missed releases are
+ * dropped , never run in a burst.
+ *
+ * Scheduler_Idle() puts the core in IDLE (Timer0 keeps ticking) when no
+ * task is released , or in SLEEP when no task is left at all.
+ *
+ * Layer: ECUAL
+ * Target MCU: PIC18F4620
+ *
+ * Author: Abdelmoniem Ahmed
+ * Linkedin: https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * Date: 2026
+ */
+
+#ifndef ECU_SCHEDULER_H
+#define	ECU_SCHEDULER_H
+
+/* Section : Includes */
+#include"../../mcal/Timer0/Timer0.h"
+#include"../../mcal/Power/hal_power.h"
+
+/* Section : Macro Declaration */
+
+/* System tick period in ms , shared by every application */
+#define SCHEDULER_TICK_MS                   1
+
+/* Timer0 16-bit preload giving one tick , no prescaler (Fosc / 4 input) */
+#define SCHEDULER_TIMER0_PRELOAD            (65536UL - (((_XTAL_FREQ) / 4000UL) * SCHEDULER_TICK_MS))
+
+/* Saturation value of scheduler_task_t overrun_count */
+#define SCHEDULER_OVERRUN_MAX               0xFF
+
+#if TIMER0_INTERRUPT_FEATURE_ENABLE != INTERRUPT_FEATURE_ENABLE
+#error "Scheduler needs TIMER0_INTERRUPT_FEATURE_ENABLE"
+#endif
+
+#if (((_XTAL_FREQ) / 4000UL) * SCHEDULER_TICK_MS) > 65535UL
+#error "SCHEDULER_TICK_MS too long for Timer0 without prescaler"
+#endif
+
+/* Section : Macro Functions Declarations */
+
+/* Ticks in a duration given in ms */
+#define SCHEDULER_MS_TO_TICKS(_MS)          ((uint16)((_MS) / SCHEDULER_TICK_MS))
+
+/* Section : Data Types Declarations */
+
+/**
+ * @struct scheduler_task_t
+ * @brief One entry of the task table
+ *
+ * @details
+ * - task_function / period / offset / deadline : Set by the application
+ * - next_release / overrun_count / task_done   : Filled by the scheduler , do not modify
+ *
+ * Periods , offsets and deadlines are below 32768 ticks (tick counter
+ * comparisons are done modulo 2^16).
+ */
+typedef struct{
+    void (* task_function)(void);
+    uint16 period ;
+    uint16 offset ;
+    uint16 deadline ;
+    uint16 next_release ;
+    uint8  overrun_count ;
+    uint8  task_done ;
+}scheduler_task_t;
+
+/**
+ * @struct scheduler_t
+ * @brief Task table descriptor
+ */
+typedef struct{
+    scheduler_task_t *tasks ;
+    uint8 task_count ;
+}scheduler_t;
+
+/* Section : Function Declarations */
+
+/**
+ * @brief Start the system tick and release the task table
+ *
+ * @param scheduler Pointer to the task table descriptor
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Tick running , first releases at tick + offset
+ *         - E_NOT_OK : Null pointer , empty table or Timer0 failure
+ *
+ * @note
+ * Timer0 is owned by the scheduler. Calling it again with another table
+ * switches tables , the tick counter keeps running.
+ */
+Std_ReturnType Scheduler_Init(scheduler_t *scheduler);
+
+/**
+ * @brief Run every released task once , call it from the main loop
+ *
+ * @param scheduler Pointer to an initialized task table descriptor
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Table scanned
+ *         - E_NOT_OK : Null pointer
+ */
+Std_ReturnType Scheduler_Dispatch(scheduler_t *scheduler);
+
+/**
+ * @brief Read the system tick counter (wraps every 65536 ticks)
+ *
+ * @param tick Pointer to the returned tick count
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Tick copied
+ *         - E_NOT_OK : Null pointer
+ */
+Std_ReturnType Scheduler_Get_Tick(uint16 *tick);
+
+/**
+ * @brief Enter a power-managed mode while no task is released
+ *
+ * @param scheduler Pointer to an initialized task table descriptor
+ * @param deepest   Deepest mode allowed , POWER_MODE_IDLE keeps the tick
+ *                  running for tick users outside the table (timer wheel)
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Woken up , or a task was already released (no wait)
+ *         - E_NOT_OK : Null pointer or invalid mode
+ *
+ * @note
+ * Call it from the main loop after Scheduler_Dispatch(). With periodic or
+ * pending one-shot tasks the core only IDLEs , the next tick wakes it.
+ * SLEEP is entered when every task is done , Timer0 then stops and only
+ * an external wake source (button , RTC SQW , I2C slave ...) resumes the
+ * loop. Busy votes of the power manager downgrade SLEEP to IDLE.
+ */
+Std_ReturnType Scheduler_Idle(const scheduler_t *scheduler , power_mode_t deepest);
+
+#endif	/* ECU_SCHEDULER_H */
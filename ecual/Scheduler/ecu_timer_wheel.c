@@ -0,0 +1,222 @@
+/*
+ * @file    ecu_timer_wheel.c
+ * @brief   Hashed software timer wheel implementation
+ *
+ * @details
+ * Nodes are linked by pool index (TIMER_WHEEL_NODE_NONE = end of list).
+ * Expired nodes of a slot are first moved to a pending list , then their
+ * callbacks run , so a callback may start or stop any timer safely.
+ *
+ * Layer: ECUAL
+ * Target MCU: PIC18F4620
+ *
+ * Author: Abdelmoniem Ahmed
+ * Linkedin: https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * Date: 2026
+ */
+
+#include "ecu_timer_wheel.h"
+
+#define TIMER_WHEEL_MASK                    (TIMER_WHEEL_SLOTS - 1)
+#define TIMER_WHEEL_NODE_NONE               0xFF
+
+/* Timer id = generation (high nibble) , pool index (low nibble) */
+#define TIMER_WHEEL_ID(_GEN , _INDEX)       ((uint8)(((_GEN) << 4) | (_INDEX)))
+#define TIMER_WHEEL_ID_INDEX(_ID)           ((_ID) & 0x0F)
+#define TIMER_WHEEL_ID_GEN(_ID)             ((_ID) >> 4)
+
+/* Node states */
+#define TIMER_WHEEL_NODE_FREE               0x00
+#define TIMER_WHEEL_NODE_RUNNING            0x01
+#define TIMER_WHEEL_NODE_PENDING            0x02    /* Expired , callback not run yet */
+#define TIMER_WHEEL_NODE_CANCELLED          0x03    /* Stopped while pending */
+
+/* Section : Data Types Declarations */
+
+typedef struct{
+    timer_wheel_callback_t callback ;
+    uint16 period ;
+    uint16 rounds ;         /* Whole wheel turns left before expiry */
+    uint8  next ;
+    uint8  prev ;
+    uint8  slot ;
+    uint8  generation : 4 ;
+    uint8  state      : 4 ;
+}timer_wheel_node_t;
+
+/* Section : Static Function Declarations */
+
+static void timer_wheel_insert(uint8 index , uint16 ticks);
+static void timer_wheel_unlink(uint8 index);
+static void timer_wheel_free(uint8 index);
+
+/* Section : Static Variables */
+
+static timer_wheel_node_t timer_wheel_pool[TIMER_WHEEL_POOL_SIZE];
+static uint8 timer_wheel_slot_head[TIMER_WHEEL_SLOTS];
+static uint8 timer_wheel_free_head = TIMER_WHEEL_NODE_NONE;
+static uint16 timer_wheel_time = ZERO_INIT;    /* Last processed tick */
+
+/* Section : Function Definitions */
+
+Std_ReturnType Timer_Wheel_Init(void){
+    Std_ReturnType ret = E_OK;
+    uint8 l_index = ZERO_INIT;
+
+    for(l_index = ZERO_INIT ; l_index < TIMER_WHEEL_SLOTS ; l_index++){
+        timer_wheel_slot_head[l_index] = TIMER_WHEEL_NODE_NONE;
+    }
+    timer_wheel_free_head = TIMER_WHEEL_NODE_NONE;
+    for(l_index = ZERO_INIT ; l_index < TIMER_WHEEL_POOL_SIZE ; l_index++){
+        timer_wheel_free(l_index);
+    }
+    ret = Scheduler_Get_Tick(&timer_wheel_time);
+    return ret;
+}
+
+Std_ReturnType Timer_Wheel_Start(uint16 delay , uint16 period , timer_wheel_callback_t callback , uint8 *timer_id){
+    Std_ReturnType ret = E_OK;
+    uint16 l_now = ZERO_INIT;
+    uint8 l_index = ZERO_INIT;
+
+    if((NULL == callback) || (NULL == timer_id)){
+        ret = E_NOT_OK;
+    }
+    else if(TIMER_WHEEL_NODE_NONE == timer_wheel_free_head){
+        *timer_id = TIMER_WHEEL_INVALID_ID;
+        ret = E_NOT_OK;
+    }
+    else{
+        l_index = timer_wheel_free_head;
+        timer_wheel_free_head = timer_wheel_pool[l_index].next;
+
+        timer_wheel_pool[l_index].callback = callback;
+        timer_wheel_pool[l_index].period = period;
+        timer_wheel_pool[l_index].state = TIMER_WHEEL_NODE_RUNNING;
+        timer_wheel_pool[l_index].generation++;
+
+        /* Delay counted from now , even if the wheel lags a few ticks behind */
+        (void)Scheduler_Get_Tick(&l_now);
+        timer_wheel_insert(l_index , (uint16)(l_now - timer_wheel_time) + ((ZERO_INIT == delay) ? 1 : delay));
+        *timer_id = TIMER_WHEEL_ID(timer_wheel_pool[l_index].generation , l_index);
+    }
+    return ret;
+}
+
+Std_ReturnType Timer_Wheel_Stop(uint8 timer_id){
+    Std_ReturnType ret = E_OK;
+    uint8 l_index = TIMER_WHEEL_ID_INDEX(timer_id);
+
+    if((TIMER_WHEEL_POOL_SIZE <= l_index) ||
+       (TIMER_WHEEL_ID_GEN(timer_id) != timer_wheel_pool[l_index].generation)){
+        ret = E_NOT_OK;
+    }
+    else if(TIMER_WHEEL_NODE_RUNNING == timer_wheel_pool[l_index].state){
+        timer_wheel_unlink(l_index);
+        timer_wheel_free(l_index);
+    }
+    else if(TIMER_WHEEL_NODE_PENDING == timer_wheel_pool[l_index].state){
+        /* Still on the pending list of Timer_Wheel_Process , freed there */
+        timer_wheel_pool[l_index].state = TIMER_WHEEL_NODE_CANCELLED;
+    }
+    else{
+        ret = E_NOT_OK;
+    }
+    return ret;
+}
+
+Std_ReturnType Timer_Wheel_Process(void){
+    Std_ReturnType ret = E_OK;
+    timer_wheel_callback_t l_callback = NULL;
+    uint16 l_now = ZERO_INIT;
+    uint8 l_pending = TIMER_WHEEL_NODE_NONE;
+    uint8 l_index = ZERO_INIT;
+    uint8 l_next = ZERO_INIT;
+
+    ret = Scheduler_Get_Tick(&l_now);
+    while(l_now != timer_wheel_time){
+        timer_wheel_time++;
+
+        /* Pass 1 : count down the slot , move the expired nodes to the pending list */
+        l_index = timer_wheel_slot_head[timer_wheel_time & TIMER_WHEEL_MASK];
+        while(TIMER_WHEEL_NODE_NONE != l_index){
+            l_next = timer_wheel_pool[l_index].next;
+            if(ZERO_INIT == timer_wheel_pool[l_index].rounds){
+                timer_wheel_unlink(l_index);
+                timer_wheel_pool[l_index].state = TIMER_WHEEL_NODE_PENDING;
+                timer_wheel_pool[l_index].next = l_pending;
+                l_pending = l_index;
+            }
+            else{
+                timer_wheel_pool[l_index].rounds--;
+            }
+            l_index = l_next;
+        }
+
+        /* Pass 2 : rearm or free , then call back */
+        while(TIMER_WHEEL_NODE_NONE != l_pending){
+            l_index = l_pending;
+            l_pending = timer_wheel_pool[l_index].next;
+            l_callback = NULL;
+            if((TIMER_WHEEL_NODE_PENDING == timer_wheel_pool[l_index].state) &&
+               (ZERO_INIT != timer_wheel_pool[l_index].period)){
+                timer_wheel_pool[l_index].state = TIMER_WHEEL_NODE_RUNNING;
+                l_callback = timer_wheel_pool[l_index].callback;
+                timer_wheel_insert(l_index , timer_wheel_pool[l_index].period);
+            }
+            else{
+                if(TIMER_WHEEL_NODE_PENDING == timer_wheel_pool[l_index].state){
+                    l_callback = timer_wheel_pool[l_index].callback;
+                }
+                else{ /* Stopped by an earlier callback */ }
+                timer_wheel_free(l_index);
+            }
+            if(NULL != l_callback){
+                l_callback();
+            }
+            else{ /* Nothing */ }
+        }
+    }
+    return ret;
+}
+
+/* Section : Static Function Definitions */
+
+/**
+ * @brief Link a node at the head of the slot expiring ticks (1 at least) after timer_wheel_time
+ */
+static void timer_wheel_insert(uint8 index , uint16 ticks){
+    uint8 l_slot = (uint8)((timer_wheel_time + ticks) & TIMER_WHEEL_MASK);
+
+    timer_wheel_pool[index].rounds = (uint16)((ticks - 1) / TIMER_WHEEL_SLOTS);
+    timer_wheel_pool[index].slot = l_slot;
+    timer_wheel_pool[index].prev = TIMER_WHEEL_NODE_NONE;
+    timer_wheel_pool[index].next = timer_wheel_slot_head[l_slot];
+    if(TIMER_WHEEL_NODE_NONE != timer_wheel_slot_head[l_slot]){
+        timer_wheel_pool[timer_wheel_slot_head[l_slot]].prev = index;
+    }
+    else{ /* Nothing */ }
+    timer_wheel_slot_head[l_slot] = index;
+}
+
+static void timer_wheel_unlink(uint8 index){
+    uint8 l_prev = timer_wheel_pool[index].prev;
+    uint8 l_next = timer_wheel_pool[index].next;
+
+    if(TIMER_WHEEL_NODE_NONE != l_prev){
+        timer_wheel_pool[l_prev].next = l_next;
+    }
+    else{
+        timer_wheel_slot_head[timer_wheel_pool[index].slot] = l_next;
+    }
+    if(TIMER_WHEEL_NODE_NONE != l_next){
+        timer_wheel_pool[l_next].prev = l_prev;
+    }
+    else{ /* Nothing */ }
+}
+
+static void timer_wheel_free(uint8 index){
+    timer_wheel_pool[index].state = TIMER_WHEEL_NODE_FREE;
+    timer_wheel_pool[index].next = timer_wheel_free_head;
+    timer_wheel_free_head = index;
+}
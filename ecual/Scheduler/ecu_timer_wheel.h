@@ -0,0 +1,111 @@
+/*
+ * @file    ecu_timer_wheel.h
+ * @brief   Hashed software timer wheel on the scheduler system tick
+ *
+ * @details
+ * Many cheap one-shot and periodic timeouts (bus timeouts , lockouts ,
+ * message expiry , debounce) on top of the ecu_scheduler tick.
+ *
+ * Timers come from a static pool of TIMER_WHEEL_POOL_SIZE nodes. A
+ * running timer sits in the wheel slot (expiry % TIMER_WHEEL_SLOTS) ,
+ * with the number of whole wheel turns left before it expires :
+ *  - Timer_Wheel_Start / Timer_Wheel_Stop : O(1) , doubly linked slot lists
+ *  - Timer_Wheel_Process                  : one slot visited per elapsed tick
+ *
+ * Callbacks run from Timer_Wheel_Process() in the main loop , never from
+ * the ISR , so they may use any driver.
+ *
+ * Layer: ECUAL
+ * Target MCU: PIC18F4620
+ *
+ * Author: Abdelmoniem Ahmed
+ * Linkedin: https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * Date: 2026
+ */
+
+#ifndef ECU_TIMER_WHEEL_H
+#define	ECU_TIMER_WHEEL_H
+
+/* Section : Includes */
+#include"ecu_scheduler.h"
+
+/* Section : Macro Declaration */
+
+/* Wheel slots , power of two (one turn = TIMER_WHEEL_SLOTS ticks) */
+#define TIMER_WHEEL_SLOTS                   32
+
+/* Timer nodes in the static pool , 15 at most : 4-bit index in the id , index 15 could give TIMER_WHEEL_INVALID_ID */
+#define TIMER_WHEEL_POOL_SIZE               8
+
+/* Timer id never returned by Timer_Wheel_Start */
+#define TIMER_WHEEL_INVALID_ID              0xFF
+
+#if (TIMER_WHEEL_SLOTS & (TIMER_WHEEL_SLOTS - 1)) != 0
+#error "TIMER_WHEEL_SLOTS must be a power of two"
+#endif
+
+#if (TIMER_WHEEL_POOL_SIZE == 0) || (TIMER_WHEEL_POOL_SIZE > 15)
+#error "TIMER_WHEEL_POOL_SIZE must be 1..15"
+#endif
+
+/* Section : Data Types Declarations */
+
+/**
+ * @brief Timer expiry callback , runs in the main loop context
+ */
+typedef void (* timer_wheel_callback_t)(void);
+
+/* Section : Function Declarations */
+
+/**
+ * @brief Empty the wheel and release every node of the pool
+ *
+ * @return Std_ReturnType
+ *         - E_OK : Wheel ready , time starts at the current scheduler tick
+ *
+ * @note Scheduler_Init() must run first (it owns the tick).
+ */
+Std_ReturnType Timer_Wheel_Init(void);
+
+/**
+ * @brief Start a one-shot or periodic timer
+ *
+ * @param delay    Ticks until the first expiry (0 is treated as 1)
+ * @param period   Ticks between later expiries , 0 = one-shot
+ * @param callback Function called on every expiry
+ * @param timer_id Pointer to the returned id , used by Timer_Wheel_Stop
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Timer running
+ *         - E_NOT_OK : Null pointer or pool exhausted (timer_id = TIMER_WHEEL_INVALID_ID)
+ *
+ * @note A one-shot node goes back to the pool right before its callback.
+ */
+Std_ReturnType Timer_Wheel_Start(uint16 delay , uint16 period , timer_wheel_callback_t callback , uint8 *timer_id);
+
+/**
+ * @brief Stop a running timer and return its node to the pool
+ *
+ * @param timer_id Id returned by Timer_Wheel_Start
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Timer stopped
+ *         - E_NOT_OK : Id not running (already expired one-shot , stopped or invalid)
+ *
+ * @note
+ * Ids carry a generation count , a stale id never stops the timer that
+ * reused its node.
+ */
+Std_ReturnType Timer_Wheel_Stop(uint8 timer_id);
+
+/**
+ * @brief Expire the timers of every tick elapsed since the last call
+ *
+ * @return Std_ReturnType
+ *         - E_OK : Wheel up to date
+ *
+ * @note Call it from the main loop , next to Scheduler_Dispatch().
+ */
+Std_ReturnType Timer_Wheel_Process(void);
+
+#endif	/* ECU_TIMER_WHEEL_H */
@@ -0,0 +1,258 @@
+/*
+ * @file    ecu_sensor_stats.c
+ * @brief   Incremental sensor statistics implementation
+ *
+ * @details
+ * Welford update per aggregate , with samples and mean in Q8 :
+ *  - d1 = x - mean , mean += d1 / n (remainder carried)
+ *  - d2 = x - mean , m2 += d1 * d2
+ * d1 and d2 have the same sign , so m2 only grows. Both are rounded to Q4
+ * for the product , which then fits 32 bits up to SENSOR_STATS_DEVIATION_MAX.
+ * m2 is a 64-bit whole part (m2_hi : m2) plus the Q8 fraction , added with
+ * carry : at most 2^23 per sample , it can not wrap within 2^31 samples.
+ *
+ * Layer: ECUAL
+ * Target MCU: PIC18F4620
+ *
+ * Author: Abdelmoniem Ahmed
+ * Linkedin: https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * Date: 2026
+ */
+
+/* Section : Includes */
+
+#include"ecu_sensor_stats.h"
+
+/* Section : Macro Declaration */
+
+/* Deviation clamp in Q8 */
+#define SENSOR_STATS_DEVIATION_MAX_Q8       ((sint32)SENSOR_STATS_DEVIATION_MAX << SENSOR_STATS_FRACTION_BITS)
+
+/* Section : Static Variables */
+
+static const uint32 stats_window_length_s[SENSOR_STATS_WINDOW_COUNT] = {
+    SENSOR_STATS_MINUTE_S , SENSOR_STATS_HOUR_S
+};
+
+/* Section : Static Function Declarations */
+
+static void stats_acc_clear(sensor_stats_acc_t *acc);
+static void stats_acc_push(sensor_stats_acc_t *acc , sint16 sample);
+static sint32 stats_clamp_deviation(sint32 deviation);
+static uint32 stats_variance_q8(const sensor_stats_acc_t *acc);
+
+/* Section : Function Definitions */
+
+Std_ReturnType Sensor_Stats_Init(sensor_stats_t *stats){
+    Std_ReturnType ret = E_OK;
+    uint8 l_window = ZERO_INIT;
+
+    if(NULL == stats){
+        ret = E_NOT_OK;
+    }
+    else{
+        stats_acc_clear(&(stats->total));
+        for(l_window = ZERO_INIT ; l_window < SENSOR_STATS_WINDOW_COUNT ; l_window++){
+            stats_acc_clear(&(stats->window[l_window].current));
+            stats_acc_clear(&(stats->window[l_window].last));
+            stats->window[l_window].start_s = ZERO_INIT;
+        }
+        stats->started = FALSE;
+    }
+    return ret;
+}
+
+Std_ReturnType Sensor_Stats_Push(sensor_stats_t *stats , sint16 sample , uint32 now_s , uint8 *closed){
+    Std_ReturnType ret = E_OK;
+    sensor_stats_window_t *l_window = NULL;
+    uint32 l_elapsed = ZERO_INIT;
+    uint8 l_closed = ZERO_INIT;
+    uint8 l_index = ZERO_INIT;
+
+    if(NULL == stats){
+        ret = E_NOT_OK;
+    }
+    else{
+        for(l_index = ZERO_INIT ; l_index < SENSOR_STATS_WINDOW_COUNT ; l_index++){
+            l_window = &(stats->window[l_index]);
+            if(FALSE == stats->started){
+                l_window->start_s = now_s;
+            }
+            else{
+                l_elapsed = now_s - l_window->start_s;
+                if(stats_window_length_s[l_index] <= l_elapsed){
+                    /* The sample belongs to the next window , empty windows of a gap are skipped */
+                    l_window->last = l_window->current;
+                    stats_acc_clear(&(l_window->current));
+                    l_window->start_s = now_s - (l_elapsed % stats_window_length_s[l_index]);
+                    if(ZERO_INIT != l_window->last.count){
+                        l_closed |= SENSOR_STATS_CLOSED(l_index);
+                    }
+                    else{ /* Nothing */ }
+                }
+                else{ /* Nothing */ }
+            }
+            stats_acc_push(&(l_window->current) , sample);
+        }
+        stats_acc_push(&(stats->total) , sample);
+        stats->started = TRUE;
+        if(NULL != closed){
+            *closed = l_closed;
+        }
+        else{ /* Nothing */ }
+    }
+    return ret;
+}
+
+Std_ReturnType Sensor_Stats_Get(const sensor_stats_t *stats , uint8 aggregate , sensor_stats_summary_t *summary){
+    Std_ReturnType ret = E_OK;
+    const sensor_stats_acc_t *l_acc = NULL;
+
+    if((NULL == stats) || (NULL == summary) || (SENSOR_STATS_TOTAL < aggregate)){
+        ret = E_NOT_OK;
+    }
+    else{
+        l_acc = (SENSOR_STATS_TOTAL == aggregate) ? &(stats->total) : &(stats->window[aggregate].last);
+        if(ZERO_INIT == l_acc->count){
+            ret = E_NOT_OK;
+        }
+        else{
+            summary->count = l_acc->count;
+            summary->mean_q8 = l_acc->mean_q8;
+            summary->variance_q8 = stats_variance_q8(l_acc);
+            summary->min = l_acc->min;
+            summary->max = l_acc->max;
+        }
+    }
+    return ret;
+}
+
+Std_ReturnType Sensor_Stats_Restore_Range(sensor_stats_t *stats , sint16 min , sint16 max){
+    Std_ReturnType ret = E_OK;
+
+    if((NULL == stats) || (min > max)){
+        ret = E_NOT_OK;
+    }
+    else{
+        if(min < stats->total.min){
+            stats->total.min = min;
+        }
+        else{ /* Nothing */ }
+        if(max > stats->total.max){
+            stats->total.max = max;
+        }
+        else{ /* Nothing */ }
+    }
+    return ret;
+}
+
+/* Section : Static Function Definitions */
+
+static void stats_acc_clear(sensor_stats_acc_t *acc){
+    acc->count = ZERO_INIT;
+    acc->mean_q8 = ZERO_INIT;
+    acc->mean_rem = ZERO_INIT;
+    acc->m2_hi = ZERO_INIT;
+    acc->m2 = ZERO_INIT;
+    acc->m2_frac = ZERO_INIT;
+    acc->min = (sint16)0x7FFF;
+    acc->max = (sint16)-0x8000;
+}
+
+static void stats_acc_push(sensor_stats_acc_t *acc , sint16 sample){
+    sint32 l_sample_q8 = (sint32)sample * (1L << SENSOR_STATS_FRACTION_BITS);
+    sint32 l_count = ZERO_INIT;
+    sint32 l_d1 = ZERO_INIT;
+    sint32 l_d2 = ZERO_INIT;
+    sint32 l_step = ZERO_INIT;
+    sint32 l_product = ZERO_INIT;
+    uint32 l_whole = ZERO_INIT;
+
+    if(0x7FFFFFFFUL > acc->count){
+        acc->count++;
+        l_count = (sint32)acc->count;
+
+        l_d1 = l_sample_q8 - acc->mean_q8;
+        l_step = l_d1 / l_count;
+        acc->mean_q8 += l_step;
+        /* |remainder| < count per step , one correction keeps it below count */
+        acc->mean_rem += l_d1 - (l_step * l_count);
+        if(acc->mean_rem >= l_count){
+            acc->mean_q8++;
+            acc->mean_rem -= l_count;
+        }
+        else if(acc->mean_rem <= -l_count){
+            acc->mean_q8--;
+            acc->mean_rem += l_count;
+        }
+        else{ /* Nothing */ }
+        l_d2 = l_sample_q8 - acc->mean_q8;
+
+        /* The remainder correction can step the mean 1 LSB past the sample , the sign then differs */
+        l_product = ((stats_clamp_deviation(l_d1) + 8) >> 4) * ((stats_clamp_deviation(l_d2) + 8) >> 4);
+        if(ZERO_INIT < l_product){
+            /* Q8 product : the fraction is carried in m2_frac , the whole part added to m2 with carry */
+            l_product += acc->m2_frac;
+            acc->m2_frac = (uint8)l_product;
+            l_whole = (uint32)l_product >> SENSOR_STATS_FRACTION_BITS;
+            acc->m2 += l_whole;
+            if(acc->m2 < l_whole){
+                acc->m2_hi++;
+            }
+            else{ /* Nothing */ }
+        }
+        else{ /* Nothing */ }
+    }
+    else{ /* Count saturated : the aggregate is frozen */ }
+
+    if(sample < acc->min){
+        acc->min = sample;
+    }
+    else{ /* Nothing */ }
+    if(sample > acc->max){
+        acc->max = sample;
+    }
+    else{ /* Nothing */ }
+}
+
+static sint32 stats_clamp_deviation(sint32 deviation){
+    sint32 l_deviation = deviation;
+
+    if(SENSOR_STATS_DEVIATION_MAX_Q8 < l_deviation){
+        l_deviation = SENSOR_STATS_DEVIATION_MAX_Q8;
+    }
+    else if(-SENSOR_STATS_DEVIATION_MAX_Q8 > l_deviation){
+        l_deviation = -SENSOR_STATS_DEVIATION_MAX_Q8;
+    }
+    else{ /* Nothing */ }
+    return l_deviation;
+}
+
+static uint32 stats_variance_q8(const sensor_stats_acc_t *acc){
+    uint32 l_variance = ZERO_INIT;
+    uint32 l_low = ZERO_INIT;
+    uint32 l_rem = ZERO_INIT;
+    uint8 l_bit = ZERO_INIT;
+
+    /* (m2_hi : m2 : m2_frac) / count , the 72-bit Q8 sum split at bit 32 */
+    l_rem = (acc->m2_hi << SENSOR_STATS_FRACTION_BITS) | (acc->m2 >> (32 - SENSOR_STATS_FRACTION_BITS));
+    l_low = (acc->m2 << SENSOR_STATS_FRACTION_BITS) | acc->m2_frac;
+    if((l_rem >= acc->count) || ((acc->m2_hi >> (32 - SENSOR_STATS_FRACTION_BITS)) != ZERO_INIT)){
+        /* Quotient above 32 bits , out of reach with the deviation clamp */
+        l_variance = 0xFFFFFFFFUL;
+    }
+    else{
+        /* Long division : l_rem < count < 2^31 , the shifted remainder fits 32 bits */
+        for(l_bit = ZERO_INIT ; l_bit < 32 ; l_bit++){
+            l_rem = (l_rem << 1) | (l_low >> 31);
+            l_low <<= 1;
+            l_variance <<= 1;
+            if(l_rem >= acc->count){
+                l_rem -= acc->count;
+                l_variance |= 1;
+            }
+            else{ /* Nothing */ }
+        }
+    }
+    return l_variance;
+}
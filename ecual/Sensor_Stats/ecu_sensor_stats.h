@@ -0,0 +1,183 @@
+/*
+ * @file    ecu_sensor_stats.h
+ * @brief   Incremental min / max / mean / variance per sensor , with 1 min and 1 h windows
+ *
+ * @details
+ * One caller-owned sensor_stats_t per sensor (TC74 temperature , ADC
+ * channel ...) , fed one sample at a time with a seconds timestamp.
+ * Three aggregates are kept up to date on every sample :
+ *  - Total  : since Sensor_Stats_Init
+ *  - Minute : tumbling SENSOR_STATS_MINUTE_S window
+ *  - Hour   : tumbling SENSOR_STATS_HOUR_S window
+ * A window closes on the first sample past its end , the closed window
+ * stays readable until the next one closes. Push reports which windows
+ * closed , so only summaries are persisted or sent.
+ *
+ * Fixed point , no floating point and no 64-bit types :
+ *  - mean     : Welford update in Q8 (mean * 256) , the truncated part of
+ *               each step is carried so the mean stays exact for any count
+ *  - variance : sum of squared deviations in Q8 (64-bit whole part held
+ *               in two 32-bit words) , population variance (/ count).
+ *               Deviations from the mean above SENSOR_STATS_DEVIATION_MAX
+ *               are clamped , the sum then can not overflow before the
+ *               count saturates
+ *
+ * Cost : one 32-bit divide per aggregate per sample , meant for sensor
+ * rates (a few samples per second). Sensor_Stats_Get divides the 72-bit
+ * sum bit by bit (32 steps). Not re-entrant : push and read from
+ * the same context.
+ *
+ * Layer: ECUAL
+ * Target MCU: PIC18F4620
+ *
+ * Author: Abdelmoniem Ahmed
+ * Linkedin: https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * Date: 2026
+ */
+
+#ifndef ECU_SENSOR_STATS_H
+#define	ECU_SENSOR_STATS_H
+
+/* Section : Includes */
+
+#include"../../common/std_types.h"
+
+/* Section : Macro Declaration */
+
+/* Aggregates , SENSOR_STATS_MINUTE / _HOUR are also the Push closed bit positions */
+#define SENSOR_STATS_MINUTE                 0
+#define SENSOR_STATS_HOUR                   1
+#define SENSOR_STATS_TOTAL                  2
+
+#define SENSOR_STATS_WINDOW_COUNT           2
+
+/* Window lengths in seconds */
+#define SENSOR_STATS_MINUTE_S               60UL
+#define SENSOR_STATS_HOUR_S                 3600UL
+
+/* Fraction bits of the mean and of the variance */
+#define SENSOR_STATS_FRACTION_BITS          8
+
+/* Largest |sample - mean| kept exact in the variance , 16-bit ADC codes excluded */
+#define SENSOR_STATS_DEVIATION_MAX          2896
+
+/* Section : Macro Functions Declarations */
+
+/* Push closed mask bit of a window */
+#define SENSOR_STATS_CLOSED(_WINDOW)        ((uint8)(1U << (_WINDOW)))
+
+/* Q8 value rounded to a whole sample unit */
+#define SENSOR_STATS_Q8_ROUND(_Q8)          ((sint16)(((sint32)(_Q8) + (1L << (SENSOR_STATS_FRACTION_BITS - 1))) >> SENSOR_STATS_FRACTION_BITS))
+
+/* Section : Data Types Declarations */
+
+/**
+ * @struct sensor_stats_acc_t
+ * @brief Running aggregate , internal to the module
+ */
+typedef struct{
+    uint32 count ;
+    sint32 mean_q8 ;
+    sint32 mean_rem ;           /* Truncated part of the mean steps , count * mean_q8 + mean_rem = sum */
+    uint32 m2_hi ;              /* Sum of squared deviations , whole part , upper 32 bits */
+    uint32 m2 ;                 /* Sum of squared deviations , whole part , lower 32 bits */
+    sint16 min ;
+    sint16 max ;
+    uint8  m2_frac ;            /* Sum of squared deviations , Q8 fraction */
+}sensor_stats_acc_t;
+
+/**
+ * @struct sensor_stats_window_t
+ * @brief Tumbling window , internal to the module
+ */
+typedef struct{
+    sensor_stats_acc_t current ;
+    sensor_stats_acc_t last ;   /* Last closed window , empty until the first close */
+    uint32 start_s ;
+}sensor_stats_window_t;
+
+/**
+ * @struct sensor_stats_t
+ * @brief Statistics of one sensor , reset by Sensor_Stats_Init
+ */
+typedef struct{
+    sensor_stats_acc_t total ;
+    sensor_stats_window_t window[SENSOR_STATS_WINDOW_COUNT];
+    uint8 started ;
+}sensor_stats_t;
+
+/**
+ * @struct sensor_stats_summary_t
+ * @brief One aggregate , as read by Sensor_Stats_Get
+ *
+ * @details
+ * mean_q8 / variance_q8 are in 1 / 256 sample units , see
+ * SENSOR_STATS_Q8_ROUND. With the deviation clamp variance_q8 stays below
+ * SENSOR_STATS_DEVIATION_MAX^2 * 256 , it fits 32 bits.
+ */
+typedef struct{
+    uint32 count ;
+    sint32 mean_q8 ;
+    uint32 variance_q8 ;
+    sint16 min ;
+    sint16 max ;
+}sensor_stats_summary_t;
+
+/* Section : Function Declarations */
+
+/**
+ * @brief Clear every aggregate , the windows start on the first sample
+ *
+ * @param stats Pointer to the sensor statistics
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Statistics empty
+ *         - E_NOT_OK : Null pointer
+ */
+Std_ReturnType Sensor_Stats_Init(sensor_stats_t *stats);
+
+/**
+ * @brief Add one sample to every aggregate
+ *
+ * @param stats  Pointer to the sensor statistics
+ * @param sample New reading (sint8 temperature , ADC result ...)
+ * @param now_s  Monotonic time in seconds , wrap safe
+ * @param closed Optional (NULL) : SENSOR_STATS_CLOSED() bits of the
+ *               windows closed by this sample , 0 if none
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Sample added
+ *         - E_NOT_OK : Null pointer
+ *
+ * @note A window without any sample is skipped , it never reports closed.
+ */
+Std_ReturnType Sensor_Stats_Push(sensor_stats_t *stats , sint16 sample , uint32 now_s , uint8 *closed);
+
+/**
+ * @brief Read one aggregate
+ *
+ * @param stats     Pointer to the sensor statistics
+ * @param aggregate SENSOR_STATS_TOTAL , or SENSOR_STATS_MINUTE / _HOUR
+ *                  for the last closed window
+ * @param summary   Pointer to the returned summary
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Summary valid
+ *         - E_NOT_OK : Null pointer , bad aggregate or no sample yet
+ */
+Std_ReturnType Sensor_Stats_Get(const sensor_stats_t *stats , uint8 aggregate , sensor_stats_summary_t *summary);
+
+/**
+ * @brief Widen the total min / max with a range persisted before a reset
+ *
+ * @param stats Pointer to the sensor statistics
+ * @param min   Persisted minimum
+ * @param max   Persisted maximum
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Range merged , the count and mean are not changed
+ *         - E_NOT_OK : Null pointer or min above max
+ */
+Std_ReturnType Sensor_Stats_Restore_Range(sensor_stats_t *stats , sint16 min , sint16 max);
+
+#endif	/* ECU_SENSOR_STATS_H */
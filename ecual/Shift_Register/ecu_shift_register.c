@@ -0,0 +1,88 @@
+/*
+ * @file    ecu_shift_register.c
+ * @brief   74HC595 / 74HC165 chains on the EUSART synchronous master
+ *
+ * @details
+ * Write : the bytes are streamed , then a RCLK pulse copies the shift
+ * stage to the outputs. Read : a SH/LD low pulse loads all the inputs ,
+ * then the bytes are clocked in.
+ *
+ * Layer: ECUAL
+ * Target MCU: PIC18F4620
+ *
+ * Author: Abdelmoniem Ahmed
+ * Linkedin: https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * Date: 2026
+ */
+
+/* Section : Includes */
+
+#include"ecu_shift_register.h"
+
+/* Section : Macro Declaration */
+
+/* Section : Macro Functions Declarations */
+
+/* Section : Data Types Declarations */
+
+/* Section : Function Declarations */
+
+Std_ReturnType Shift_Register_Init(shift_register_t *chain){
+    Std_ReturnType ret = E_OK;
+    if((NULL == chain) ||
+       ((ZERO_INIT == chain->output_count) && (ZERO_INIT == chain->input_count)) ||
+       (chain->output_count > SHIFT_REGISTER_CHAIN_MAX) ||
+       (chain->input_count > SHIFT_REGISTER_CHAIN_MAX)){
+        ret = E_NOT_OK;
+    }
+    else{
+        if(chain->output_count > ZERO_INIT){
+            chain->latch_pin.direction = GPIO_DIRECTION_OUTPUT;
+            chain->latch_pin.logic = GPIO_PIN_LOW;
+            ret &= gpio_pin_initialize(&(chain->latch_pin));
+        }
+        else{ /* Nothing */ }
+        if(chain->input_count > ZERO_INIT){
+            chain->load_pin.direction = GPIO_DIRECTION_OUTPUT;
+            chain->load_pin.logic = GPIO_PIN_HIGH;
+            ret &= gpio_pin_initialize(&(chain->load_pin));
+        }
+        else{ /* Nothing */ }
+        ret &= EUSART_SYNC_Master_Init(&(chain->bus));
+    }
+    return ret;
+}
+
+Std_ReturnType Shift_Register_Write(shift_register_t *chain , const uint8 *outputs){
+    Std_ReturnType ret = E_NOT_OK;
+    if((NULL == chain) || (NULL == outputs) || (ZERO_INIT == chain->output_count)){
+        ret = E_NOT_OK;
+    }
+    else{
+        ret = EUSART_SYNC_Master_Write(outputs , chain->output_count);
+        if(E_OK == ret){
+            /* tWH(RCLK) is 20 ns , two port writes are far longer */
+            ret &= gpio_pin_write_logic(&(chain->latch_pin) , GPIO_PIN_HIGH);
+            ret &= gpio_pin_write_logic(&(chain->latch_pin) , GPIO_PIN_LOW);
+        }
+        else{ /* Nothing */ }
+    }
+    return ret;
+}
+
+Std_ReturnType Shift_Register_Read(shift_register_t *chain , uint8 *inputs){
+    Std_ReturnType ret = E_NOT_OK;
+    if((NULL == chain) || (NULL == inputs) || (ZERO_INIT == chain->input_count)){
+        ret = E_NOT_OK;
+    }
+    else{
+        /* Parallel load , QH then holds input 7 of the nearest register */
+        ret = gpio_pin_write_logic(&(chain->load_pin) , GPIO_PIN_LOW);
+        ret &= gpio_pin_write_logic(&(chain->load_pin) , GPIO_PIN_HIGH);
+        if(E_OK == ret){
+            ret = EUSART_SYNC_Master_Read(inputs , chain->input_count);
+        }
+        else{ /* Nothing */ }
+    }
+    return ret;
+}
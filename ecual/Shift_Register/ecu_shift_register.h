@@ -0,0 +1,103 @@
+/*
+ * @file    ecu_shift_register.h
+ * @brief   74HC595 output / 74HC165 input chains on the EUSART synchronous master
+ *
+ * @details
+ * The chains are clocked by the EUSART (CK = RC6 , DT = RC7) , so the MSSP
+ * stays free for I2C or SPI. Wiring :
+ *  - 74HC595 : SER = DT , SRCLK = CK , RCLK = latch_pin , QH' to the SER
+ *              of the next register
+ *  - 74HC165 : QH = DT through a 1 kOhm resistor (the EUSART drives DT
+ *              while writing) , CLK = CK , SH/LD = load_pin , QH of the
+ *              next register to SER
+ *
+ * Both chains see every clock : the 595 outputs only change on the latch
+ * pulse and the 165 is reloaded before each read , so the extra clocks are
+ * harmless.
+ *
+ * Bit n of a byte is Qn (595) / input n (165) with the bus initialized
+ * MSB first , clock idle high.
+ *
+ * Layer: ECUAL
+ * Target MCU: PIC18F4620
+ *
+ * Author: Abdelmoniem Ahmed
+ * Linkedin: https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * Date: 2026
+ */
+
+#ifndef ECU_SHIFT_REGISTER_H
+#define	ECU_SHIFT_REGISTER_H
+
+/* Section : Includes */
+
+#include"../../mcal/EUSART/hal_eusart.h"
+
+/* Section : Macro Declaration */
+
+/* Registers per chain , 8 outputs / inputs each */
+#define SHIFT_REGISTER_CHAIN_MAX            16
+
+/* Section : Macro Functions Declarations */
+
+/* Section : Data Types Declarations */
+
+/**
+ * @struct shift_register_t
+ * @brief One output chain and / or one input chain on the synchronous bus
+ *
+ * @details
+ * A chain of length 0 is not fitted , its pin is not touched.
+ */
+typedef struct{
+    usart_sync_t bus ;                  /* EUSART synchronous master , see hal_eusart.h */
+    pin_config_t latch_pin ;            /* 74HC595 RCLK , idle low */
+    pin_config_t load_pin ;             /* 74HC165 SH/LD , idle high */
+    uint8 output_count ;                /* 74HC595 in the chain , 0 .. SHIFT_REGISTER_CHAIN_MAX */
+    uint8 input_count ;                 /* 74HC165 in the chain , 0 .. SHIFT_REGISTER_CHAIN_MAX */
+}shift_register_t;
+
+/* Section : Function Declarations */
+
+/**
+ * @brief Start the synchronous master and set the latch / load pins idle
+ *
+ * @param chain Pointer to the chain configuration , `bus.clock_frequency`
+ *              gets the actual clock
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Chain ready
+ *         - E_NOT_OK : Null pointer , empty or too long chain , bus or pin failure
+ */
+Std_ReturnType Shift_Register_Init(shift_register_t *chain);
+
+/**
+ * @brief Shift the outputs in and latch them , blocking
+ *
+ * @param chain   Pointer to the chain configuration
+ * @param outputs `output_count` bytes in shift order : outputs[0] ends up
+ *                in the register at the far end of the chain
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Outputs updated
+ *         - E_NOT_OK : Null pointer , no output chain or bus failure
+ *
+ * @note Every output changes together on the latch pulse.
+ */
+Std_ReturnType Shift_Register_Write(shift_register_t *chain , const uint8 *outputs);
+
+/**
+ * @brief Load the inputs in parallel and shift them out , blocking
+ *
+ * @param chain  Pointer to the chain configuration
+ * @param inputs `input_count` bytes : inputs[0] is the register wired to DT
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Inputs read
+ *         - E_NOT_OK : Null pointer , no input chain or bus failure
+ *
+ * @note Every input is sampled at the same instant , on the load pulse.
+ */
+Std_ReturnType Shift_Register_Read(shift_register_t *chain , uint8 *inputs);
+
+#endif	/* ECU_SHIFT_REGISTER_H */
@@ -10,7 +10,7 @@
  * 
  * Layer         : ECUAL
  * Target        : PIC18F4620
- * Communication : I2C (MSSP)
+ * Communication : I2C (MSSP or software bus)
  * @author  : Abdelmoniem Ahmed
  * @LinkedIn: https://www.linkedin.com/in/abdelmoniem-ahmed/
  *
@@ -18,8 +18,24 @@
 
 #include"Temperature_Sensor_TC74.h"
 
+/* Bus the sensors are wired to */
+static i2c_bus_t tc74_bus = I2C_BUS_MSSP ;
+
 /* Function Definition */
 
+Std_ReturnType TempSensor_TC74_Bind_Bus(i2c_bus_t bus){
+    Std_ReturnType ret = E_OK;
+    
+    if(I2C_BUS_SOFT < bus){
+        ret = E_NOT_OK;
+    }
+    else{
+        tc74_bus = bus;
+    }
+    
+    return ret;
+}
+
 Std_ReturnType TempSensor_TC74_Read_Temp(uint8 sensor_address ,sint8 *temp){
     Std_ReturnType ret = E_NOT_OK;
     
@@ -27,7 +43,135 @@ Std_ReturnType TempSensor_TC74_Read_Temp(uint8 sensor_address ,sint8 *temp){
         ret = E_NOT_OK;
     }
     else{
-        ret = MSSP_I2C_Read_Byte_Register(sensor_address,TEMP_REGISTER_ADDRESS,temp);
+        ret = I2C_Bus_Read_Registers(tc74_bus , sensor_address , TEMP_REGISTER_ADDRESS , (uint8 *)temp , 1);
+    }
+    
+    return ret;
+}
+
+Std_ReturnType TempSensor_TC74_Read_Temp_Fast(tc74_sensor_t *sensor , sint8 *temp){
+    Std_ReturnType ret = E_NOT_OK;
+    
+    if((NULL == sensor) || (NULL == temp)){
+        ret = E_NOT_OK;
+    }
+    else{
+        if(TEMP_REGISTER_ADDRESS == sensor->pointer){
+            /* Pointer already on TEMP : no register byte */
+            ret = I2C_Bus_Read_Current(tc74_bus , sensor->address , (uint8 *)temp , 1);
+        }
+        else{
+            ret = I2C_Bus_Read_Registers(tc74_bus , sensor->address , TEMP_REGISTER_ADDRESS , (uint8 *)temp , 1);
+        }
+        if(E_OK == ret){
+            sensor->pointer = TEMP_REGISTER_ADDRESS;
+            sensor->temperature = *temp;
+        }
+        else{
+            sensor->pointer = TC74_POINTER_UNKNOWN;
+        }
+    }
+    
+    return ret;
+}
+
+Std_ReturnType TempSensor_TC74_Set_Standby(tc74_sensor_t *sensor , uint8 standby){
+    Std_ReturnType ret = E_NOT_OK;
+    uint8 l_config = (TRUE == standby) ? TC74_CONFIG_STANDBY : 0x00;
+    
+    if(NULL == sensor){
+        ret = E_NOT_OK;
+    }
+    else{
+        ret = I2C_Bus_Write_Registers(tc74_bus , sensor->address , CONFIG_REGISTER_ADDRESS , &l_config , 1);
+        if(E_OK == ret){
+            sensor->pointer = CONFIG_REGISTER_ADDRESS;
+            sensor->wake_pending = (TRUE == standby) ? 0 : 1;
+        }
+        else{
+            sensor->pointer = TC74_POINTER_UNKNOWN;
+        }
+    }
+    
+    return ret;
+}
+
+Std_ReturnType TempSensor_TC74_Is_Data_Ready(tc74_sensor_t *sensor , uint8 *ready){
+    Std_ReturnType ret = E_NOT_OK;
+    uint8 l_config = ZERO_INIT;
+    
+    if((NULL == sensor) || (NULL == ready)){
+        ret = E_NOT_OK;
+    }
+    else{
+        if(CONFIG_REGISTER_ADDRESS == sensor->pointer){
+            ret = I2C_Bus_Read_Current(tc74_bus , sensor->address , &l_config , 1);
+        }
+        else{
+            ret = I2C_Bus_Read_Registers(tc74_bus , sensor->address , CONFIG_REGISTER_ADDRESS , &l_config , 1);
+        }
+        if(E_OK == ret){
+            sensor->pointer = CONFIG_REGISTER_ADDRESS;
+            *ready = (TC74_CONFIG_DATA_READY == (l_config & TC74_CONFIG_DATA_READY)) ? TRUE : FALSE;
+        }
+        else{
+            sensor->pointer = TC74_POINTER_UNKNOWN;
+        }
+    }
+    
+    return ret;
+}
+
+Std_ReturnType TempSensor_TC74_Group_Read(tc74_group_t *group){
+    Std_ReturnType ret = E_NOT_OK;
+    tc74_sensor_t *l_sensor = NULL;
+    uint8 l_index = ZERO_INIT;
+    uint8 l_ready = FALSE;
+    sint8 l_temp = ZERO_INIT;
+    
+    if((NULL == group) || (NULL == group->sensors)){
+        ret = E_NOT_OK;
+    }
+    else{
+        ret = E_OK;
+        for(l_index = ZERO_INIT ; l_index < group->count ; l_index++){
+            l_sensor = &group->sensors[l_index];
+            l_sensor->valid = 0;
+            l_ready = TRUE;
+            if(1 == l_sensor->wake_pending){
+                /* Just woken : the temperature register still holds the pre-standby value */
+                if((E_OK == TempSensor_TC74_Is_Data_Ready(l_sensor , &l_ready)) && (TRUE == l_ready)){
+                    l_sensor->wake_pending = 0;
+                }
+                else{
+                    l_ready = FALSE;
+                }
+            }
+            else{ /* Converting continuously */ }
+            if((TRUE == l_ready) && (E_OK == TempSensor_TC74_Read_Temp_Fast(l_sensor , &l_temp))){
+                l_sensor->valid = 1;
+            }
+            else{
+                ret = E_NOT_OK;
+            }
+        }
+    }
+    
+    return ret;
+}
+
+Std_ReturnType TempSensor_TC74_Group_Standby(tc74_group_t *group , uint8 standby){
+    Std_ReturnType ret = E_NOT_OK;
+    uint8 l_index = ZERO_INIT;
+    
+    if((NULL == group) || (NULL == group->sensors)){
+        ret = E_NOT_OK;
+    }
+    else{
+        ret = E_OK;
+        for(l_index = ZERO_INIT ; l_index < group->count ; l_index++){
+            ret &= TempSensor_TC74_Set_Standby(&group->sensors[l_index] , standby);
+        }
     }
     
     return ret;
@@ -7,10 +7,15 @@
  * 
  *              The TC74 returns temperature as an 8-bit signed value representing
  *              temperature in degrees Celsius.
+ *
+ *              Besides the plain read , a tc74_sensor_t remembers the register
+ *              pointer left in the device , so repeated temperature reads skip
+ *              the register write. A tc74_group_t reads several sensors in one
+ *              pass and can keep them in standby between passes.
  * 
  * Layer         : ECUAL
  * Target        : PIC18F4620
- * Communication : I2C (MSSP)
+ * Communication : I2C (MSSP or software bus)
  * @author  : Abdelmoniem Ahmed
  * @LinkedIn: https://www.linkedin.com/in/abdelmoniem-ahmed/
  *
@@ -20,18 +25,64 @@
 #define	TEMPERATURE_SENSOR_TC74_H
 
 /*************** Includes ***************/
-#include"../../mcal/I2C/I2C_APIs.h"
+#include"../../mcal/I2C/I2C_Bus.h"
 
 /*************** Macro Declarations ***************/
 #define TEMP_SENSOR_ADDRESS             0x4D
 #define TEMP_REGISTER_ADDRESS           0x00
+#define CONFIG_REGISTER_ADDRESS         0x01
+
+/* Config register bits */
+#define TC74_CONFIG_STANDBY             0x80    /* SHDN : no conversion , ~5 uA */
+#define TC74_CONFIG_DATA_READY          0x40    /* DATA_RDY : first conversion done after wake-up */
+
+/* Register pointer not known (power-up , bus error) */
+#define TC74_POINTER_UNKNOWN            0xFF
 
 /*************** Macro Functions Declarations ***************/
 
 /*************** Data Type Declarations ***************/
 
+/**
+ * @brief Sensor state of one TC74
+ *
+ * - address     : 7-bit I2C address , set by the application
+ * - pointer     : Register pointer left in the device (driver owned ,
+ *                 initialize to TC74_POINTER_UNKNOWN)
+ * - wake_pending: Left standby , first conversion not reported yet (driver owned)
+ * - valid       : Last group pass read this sensor (driver owned)
+ * - temperature : Last temperature read , degrees C (driver owned)
+ */
+typedef struct{
+    uint8 address ;
+    uint8 pointer ;
+    uint8 wake_pending : 1 ;
+    uint8 valid        : 1 ;
+    uint8 reserved     : 6 ;
+    sint8 temperature ;
+}tc74_sensor_t;
+
+/**
+ * @brief Sensors read together by TempSensor_TC74_Group_Read
+ */
+typedef struct{
+    tc74_sensor_t *sensors ;
+    uint8 count ;
+}tc74_group_t;
+
 /*************** Function Declarations ***************/
 
+/**
+ * @brief Select the I2C bus the TC74 sensors are wired to , I2C_BUS_MSSP by default
+ *
+ * @param bus I2C_BUS_MSSP or I2C_BUS_SOFT
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Bus selected
+ *         - E_NOT_OK : Unknown bus
+ */
+Std_ReturnType TempSensor_TC74_Bind_Bus(i2c_bus_t bus);
+
 /**
  * @brief Reads the temperature value from the TC74 sensor
  *
@@ -70,5 +121,79 @@
  */
 Std_ReturnType TempSensor_TC74_Read_Temp(uint8 sensor_address ,sint8 *temp);
 
+/**
+ * @brief Read the temperature , skipping the register write when possible
+ *
+ * @param sensor Sensor state
+ * @param temp   Pointer to the temperature , degrees C
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Temperature read (also stored in sensor->temperature)
+ *         - E_NOT_OK : Null pointer or communication failure (pointer forgotten)
+ *
+ * @note
+ * Pointer already at TEMP : START -> addr+R -> temp -> STOP (2 bytes on the bus).
+ * Otherwise the full register read (4 bytes) , and the pointer is remembered.
+ */
+Std_ReturnType TempSensor_TC74_Read_Temp_Fast(tc74_sensor_t *sensor , sint8 *temp);
+
+/**
+ * @brief Enter or leave standby (config register SHDN bit)
+ *
+ * @param sensor  Sensor state
+ * @param standby TRUE : stop converting , FALSE : resume converting
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Config written
+ *         - E_NOT_OK : Null pointer or communication failure
+ *
+ * @note The temperature register holds the last conversion while in standby.
+ *       After wake-up , DATA_RDY tells when a fresh conversion is available.
+ */
+Std_ReturnType TempSensor_TC74_Set_Standby(tc74_sensor_t *sensor , uint8 standby);
+
+/**
+ * @brief Read the DATA_RDY bit of the config register
+ *
+ * @param sensor Sensor state
+ * @param ready  Pointer to store TRUE (conversion available) or FALSE
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Status returned
+ *         - E_NOT_OK : Null pointer or communication failure
+ */
+Std_ReturnType TempSensor_TC74_Is_Data_Ready(tc74_sensor_t *sensor , uint8 *ready);
+
+/**
+ * @brief Read every sensor of a group in one pass (call it from a scheduled task)
+ *
+ * @param group Group of sensors
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Every sensor read (sensor->valid set)
+ *         - E_NOT_OK : Null pointer , or at least one sensor failed or is
+ *                      still waiting for its first conversion (valid cleared ,
+ *                      temperature keeps the previous value)
+ *
+ * @note A sensor woken by TempSensor_TC74_Group_Standby(group , FALSE) is
+ *       read only once its DATA_RDY bit is set.
+ */
+Std_ReturnType TempSensor_TC74_Group_Read(tc74_group_t *group);
+
+/**
+ * @brief Put every sensor of a group in or out of standby
+ *
+ * @param group   Group of sensors
+ * @param standby TRUE : standby , FALSE : converting
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Every sensor updated
+ *         - E_NOT_OK : Null pointer or at least one sensor failed
+ *
+ * @note Wake the group one conversion time (250 ms max) before the next
+ *       TempSensor_TC74_Group_Read , then put it back in standby to save power.
+ */
+Std_ReturnType TempSensor_TC74_Group_Standby(tc74_group_t *group , uint8 standby);
+
 #endif	/* TEMPERATURE_SENSOR_TC74_H */
 
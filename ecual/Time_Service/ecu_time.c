@@ -0,0 +1,132 @@
+/*
+ * @file    ecu_time.c
+ * @brief   Monotonic 32-bit microsecond / millisecond clock implementation
+ *
+ * @details
+ * No state of its own : the overflow counter lives in the timer driver ,
+ * every read converts one coherent (overflows , count) pair.
+ *
+ * Layer: ECUAL
+ * Target MCU: PIC18F4620
+ *
+ * Author: Abdelmoniem Ahmed
+ * Linkedin: https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * Date: 2026
+ */
+
+#include "ecu_time.h"
+
+/*
+ * 125 overflows = 125 * 65536 us = 8192 ms exactly , so
+ * ms = (ovf / 125) * 8192 + ((ovf % 125) * 65536 + count) / 1000
+ * with no intermediate above 2^32.
+ */
+#define TIME_OVERFLOWS_PER_PERIOD           125UL
+#define TIME_MS_PER_PERIOD                  8192UL
+
+#if TIME_SERVICE_TCY_MHZ == 1
+#define TIME_SERVICE_PRESCALER              1
+#elif TIME_SERVICE_TCY_MHZ == 2
+#define TIME_SERVICE_PRESCALER              2
+#elif TIME_SERVICE_TCY_MHZ == 4
+#define TIME_SERVICE_PRESCALER              4
+#else
+#define TIME_SERVICE_PRESCALER              8
+#endif
+
+/* Section : Static Function Declarations */
+
+static Std_ReturnType time_read(uint32 *overflows , uint16 *count);
+
+/* Section : Static Variables */
+
+#if TIME_SERVICE_TIMER_CFG == 1
+static timer1_t time_timer = {
+    .timer1_preload_value = ZERO_INIT ,
+    .TMR_InterruptHandler = NULL ,
+#if TIME_SERVICE_PRESCALER == 1
+    .prescaler_division = timer1_prescaler_dive_1 ,
+#elif TIME_SERVICE_PRESCALER == 2
+    .prescaler_division = timer1_prescaler_dive_2 ,
+#elif TIME_SERVICE_PRESCALER == 4
+    .prescaler_division = timer1_prescaler_dive_4 ,
+#else
+    .prescaler_division = timer1_prescaler_dive_8 ,
+#endif
+    .timer1_mode = TIMER1_TIMER_MODE_CFG ,
+    .timer1_counter_mode = TIMER1_SYNC_COUNTER_MODE_CFG ,
+    .timer1_osc_cfg = TIMER1_OSC_DISABLE ,
+    .timer1_reg_rw_mode = TIMER1_RD_16BIT_MODE_CFG ,
+};
+#else
+static timer3_t time_timer = {
+    .timer3_preloaded_value = ZERO_INIT ,
+    .TMR_InterruptHandler = NULL ,
+#if TIME_SERVICE_PRESCALER == 1
+    .prescaler_division = timer3_prescaler_dive_1 ,
+#elif TIME_SERVICE_PRESCALER == 2
+    .prescaler_division = timer3_prescaler_dive_2 ,
+#elif TIME_SERVICE_PRESCALER == 4
+    .prescaler_division = timer3_prescaler_dive_4 ,
+#else
+    .prescaler_division = timer3_prescaler_dive_8 ,
+#endif
+    .timer3_mode = TIMER3_TIMER_MODE_CFG ,
+    .timer3_reg_rw_mode = TIMER3_RD_16BIT_MODE_CFG ,
+    .timer3_counter_mode = TIMER3_SYNC_COUNTER_MODE_CFG ,
+};
+#endif
+
+/* Section : Function Definitions */
+
+Std_ReturnType Time_Service_Init(void){
+    Std_ReturnType ret = E_OK;
+
+#if TIME_SERVICE_TIMER_CFG == 1
+    ret = timer1_init(&time_timer);
+#else
+    ret = timer3_init(&time_timer);
+#endif
+    return ret;
+}
+
+Std_ReturnType Time_Get_Micros(uint32 *micros){
+    Std_ReturnType ret = E_OK;
+    uint32 l_overflows = ZERO_INIT;
+    uint16 l_count = ZERO_INIT;
+
+    if(NULL == micros){
+        ret = E_NOT_OK;
+    }
+    else{
+        ret = time_read(&l_overflows , &l_count);
+        *micros = (l_overflows << 16) | l_count;
+    }
+    return ret;
+}
+
+Std_ReturnType Time_Get_Millis(uint32 *millis){
+    Std_ReturnType ret = E_OK;
+    uint32 l_overflows = ZERO_INIT;
+    uint16 l_count = ZERO_INIT;
+
+    if(NULL == millis){
+        ret = E_NOT_OK;
+    }
+    else{
+        ret = time_read(&l_overflows , &l_count);
+        *millis = ((l_overflows / TIME_OVERFLOWS_PER_PERIOD) * TIME_MS_PER_PERIOD) +
+                  ((((l_overflows % TIME_OVERFLOWS_PER_PERIOD) << 16) + l_count) / 1000UL);
+    }
+    return ret;
+}
+
+/* Section : Static Function Definitions */
+
+static Std_ReturnType time_read(uint32 *overflows , uint16 *count){
+#if TIME_SERVICE_TIMER_CFG == 1
+    return timer1_Read_Extended(&time_timer , overflows , count);
+#else
+    return timer3_Read_Extended(&time_timer , overflows , count);
+#endif
+}
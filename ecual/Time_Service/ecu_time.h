@@ -0,0 +1,100 @@
+/*
+ * @file    ecu_time.h
+ * @brief   Monotonic 32-bit microsecond / millisecond clock
+ *
+ * @details
+ * Timer1 or Timer3 (TIME_SERVICE_TIMER_CFG) free-runs at 1 tick per us ,
+ * its driver counts the overflows in TMRx_ISR. A timestamp is the
+ * coherent (overflows , count) pair returned by timerx_Read_Extended() :
+ *  - Time_Get_Micros : 32-bit us , wraps every 71.6 min
+ *  - Time_Get_Millis : 32-bit ms , wraps every 49.7 days
+ *
+ * Both may be read from the main loop or from any ISR , an overflow still
+ * pending in the flag is accounted for. Elapsed times are taken with
+ * unsigned subtraction (TIME_ELAPSED) and stay right across the wrap.
+ *
+ * The selected timer is owned by the time service : no other driver may
+ * reload it or use it as a capture / compare time base.
+ *
+ * Layer: ECUAL
+ * Target MCU: PIC18F4620
+ *
+ * Author: Abdelmoniem Ahmed
+ * Linkedin: https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * Date: 2026
+ */
+
+#ifndef ECU_TIME_H
+#define	ECU_TIME_H
+
+/* Section : Includes */
+#include"../../mcal/Timer1/timer1.h"
+#include"../../mcal/Timer3/Timer3.h"
+
+/* Section : Macro Declaration */
+
+/* Time base , 1 = Timer1 , 3 = Timer3 */
+#define TIME_SERVICE_TIMER_CFG              1
+
+/* Timer input clock (Fosc / 4) in MHz , the prescaler brings it to 1 MHz */
+#define TIME_SERVICE_TCY_MHZ                ((_XTAL_FREQ) / 4000000UL)
+
+#if (TIME_SERVICE_TIMER_CFG != 1) && (TIME_SERVICE_TIMER_CFG != 3)
+#error "TIME_SERVICE_TIMER_CFG must be 1 or 3"
+#endif
+
+#if (TIME_SERVICE_TIMER_CFG == 1) && (TIMER1_INTERRUPT_FEATURE_ENABLE != INTERRUPT_FEATURE_ENABLE)
+#error "Time service needs TIMER1_INTERRUPT_FEATURE_ENABLE"
+#endif
+
+#if (TIME_SERVICE_TIMER_CFG == 3) && (TIMER3_INTERRUPT_FEATURE_ENABLE != INTERRUPT_FEATURE_ENABLE)
+#error "Time service needs TIMER3_INTERRUPT_FEATURE_ENABLE"
+#endif
+
+#if ((_XTAL_FREQ) % 4000000UL != 0) || ((TIME_SERVICE_TCY_MHZ != 1) && (TIME_SERVICE_TCY_MHZ != 2) && \
+    (TIME_SERVICE_TCY_MHZ != 4) && (TIME_SERVICE_TCY_MHZ != 8))
+#error "Time service needs Fosc / 4 of 1 , 2 , 4 or 8 MHz for a 1 us tick"
+#endif
+
+/* Section : Macro Functions Declarations */
+
+/* Time from _START to _NOW , same unit , right across one wrap */
+#define TIME_ELAPSED(_NOW , _START)         ((uint32)((uint32)(_NOW) - (uint32)(_START)))
+
+/* Section : Function Declarations */
+
+/**
+ * @brief Start the free-running time base from zero
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Clock running
+ *         - E_NOT_OK : Timer initialization failed
+ *
+ * @note Global interrupts must be enabled for the clock to run past
+ *       one timer overflow (65.536 ms).
+ */
+Std_ReturnType Time_Service_Init(void);
+
+/**
+ * @brief Read the microseconds since Time_Service_Init()
+ *
+ * @param micros Pointer to the returned time , wraps modulo 2^32
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Time returned
+ *         - E_NOT_OK : Null pointer
+ */
+Std_ReturnType Time_Get_Micros(uint32 *micros);
+
+/**
+ * @brief Read the milliseconds since Time_Service_Init()
+ *
+ * @param millis Pointer to the returned time , wraps modulo 2^32
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Time returned
+ *         - E_NOT_OK : Null pointer
+ */
+Std_ReturnType Time_Get_Millis(uint32 *millis);
+
+#endif	/* ECU_TIME_H */
@@ -0,0 +1,97 @@
+/*
+ * @file    ecu_trace.c
+ * @brief   Fixed-size binary trace records over the EUSART TX ring buffer
+ *
+ * @details
+ * One static record is packed and copied into the ring per call , the
+ * whole log call is a handful of byte moves plus the ring copy.
+ *
+ * Layer: ECUAL
+ * Target MCU: PIC18F4620
+ *
+ * Author: Abdelmoniem Ahmed
+ * Linkedin: https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * Date: 2026
+ */
+
+#include "ecu_trace.h"
+
+#if INTERRUPT_FEATURE_ENABLE == EUSART_TX_INTERRUPT_FEATURE_ENABLE
+
+/* Section : Global Variables */
+
+static uint8 trace_record[TRACE_RECORD_SIZE];
+static uint16 trace_dropped = ZERO_INIT;
+
+/* Section : Helper Function Declarations */
+
+static Std_ReturnType trace_emit(uint8 event_id , uint8 arg8 , uint16 arg16);
+
+/* Section : Function Definitions */
+
+Std_ReturnType Trace_Init(void){
+    Std_ReturnType ret = E_OK;
+
+    trace_dropped = ZERO_INIT;
+    ret = trace_emit(TRACE_EVENT_START , ZERO_INIT , TRACE_FORMAT_VERSION);
+    if(E_OK != ret){
+        trace_dropped++;
+    }
+    else{ /* Nothing */ }
+    return ret;
+}
+
+Std_ReturnType Trace_Log(uint8 event_id , uint8 arg8 , uint16 arg16){
+    Std_ReturnType ret = E_OK;
+
+    if(TRACE_EVENT_USER_FIRST > event_id){
+        ret = E_NOT_OK;
+    }
+    else{
+        /* Report the loss first , so the decoder sees where the gap is */
+        if((ZERO_INIT != trace_dropped) && (E_OK == trace_emit(TRACE_EVENT_DROPPED , ZERO_INIT , trace_dropped))){
+            trace_dropped = ZERO_INIT;
+        }
+        else{ /* Nothing lost , or still no room */ }
+
+        ret = (ZERO_INIT == trace_dropped) ? trace_emit(event_id , arg8 , arg16) : E_NOT_OK;
+        if((E_OK != ret) && (0xFFFF != trace_dropped)){
+            trace_dropped++;
+        }
+        else{ /* Nothing */ }
+    }
+    return ret;
+}
+
+Std_ReturnType Trace_Get_Dropped(uint16 *dropped){
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == dropped){
+        ret = E_NOT_OK;
+    }
+    else{
+        *dropped = trace_dropped;
+    }
+    return ret;
+}
+
+/* Section : Helper Function Definitions */
+
+static Std_ReturnType trace_emit(uint8 event_id , uint8 arg8 , uint16 arg16){
+    uint16 l_tick = ZERO_INIT;
+
+    (void)Scheduler_Get_Tick(&l_tick);
+    trace_record[TRACE_RECORD_SYNC]    = TRACE_SYNC_BYTE;
+    trace_record[TRACE_RECORD_EVENT]   = event_id;
+    trace_record[TRACE_RECORD_TICK_L]  = (uint8)l_tick;
+    trace_record[TRACE_RECORD_TICK_H]  = (uint8)(l_tick >> 8);
+    trace_record[TRACE_RECORD_ARG8]    = arg8;
+    trace_record[TRACE_RECORD_ARG16_L] = (uint8)arg16;
+    trace_record[TRACE_RECORD_ARG16_H] = (uint8)(arg16 >> 8);
+    trace_record[TRACE_RECORD_CHECK]   = (uint8)(TRACE_SYNC_BYTE ^ event_id ^ trace_record[TRACE_RECORD_TICK_L] ^
+                                                 trace_record[TRACE_RECORD_TICK_H] ^ arg8 ^
+                                                 trace_record[TRACE_RECORD_ARG16_L] ^ trace_record[TRACE_RECORD_ARG16_H]);
+    return EUSART_ASYNC_Write_String_NonBlocking(trace_record , TRACE_RECORD_SIZE);
+}
+
+#endif
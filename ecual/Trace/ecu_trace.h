@@ -0,0 +1,116 @@
+/*
+ * @file    ecu_trace.h
+ * @brief   Fixed-size binary trace records over the EUSART TX ring buffer
+ *
+ * @details
+ * A trace call packs one 8-byte record and queues it in the EUSART TX ring
+ * with EUSART_ASYNC_Write_String_NonBlocking() : no formatting , no wait
+ * for the line. tools/trace/trace_decode.py turns the stream back into text
+ * and names the events from the application headers.
+ *
+ * Record (little endian) :
+ *  | 0xA5 | event id | tick L | tick H | arg8 | arg16 L | arg16 H | check |
+ *  - tick  : Scheduler_Get_Tick() when the record was queued
+ *  - check : XOR of bytes 0..6 , the decoder resynchronizes on sync + check
+ *
+ * A record that does not fit in the ring is dropped , never split. The
+ * number of lost records is sent as a TRACE_EVENT_DROPPED record as soon
+ * as there is room again.
+ *
+ * The EUSART TX ring only exists with EUSART_TX_INTERRUPT_FEATURE_ENABLE ,
+ * without it TRACE_LOG() compiles to nothing.
+ *
+ * Layer: ECUAL
+ * Target MCU: PIC18F4620
+ *
+ * Author: Abdelmoniem Ahmed
+ * Linkedin: https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * Date: 2026
+ */
+
+#ifndef ECU_TRACE_H
+#define	ECU_TRACE_H
+
+/* Section : Includes */
+#include"../../mcal/EUSART/hal_eusart.h"
+#include"../Scheduler/ecu_scheduler.h"
+
+/* Section : Macro Declaration */
+
+#define TRACE_SYNC_BYTE                     0xA5
+#define TRACE_RECORD_SIZE                   8
+#define TRACE_FORMAT_VERSION                1
+
+/* Record layout */
+#define TRACE_RECORD_SYNC                   0
+#define TRACE_RECORD_EVENT                  1
+#define TRACE_RECORD_TICK_L                 2
+#define TRACE_RECORD_TICK_H                 3
+#define TRACE_RECORD_ARG8                   4
+#define TRACE_RECORD_ARG16_L                5
+#define TRACE_RECORD_ARG16_H                6
+#define TRACE_RECORD_CHECK                  7
+
+/* Reserved event ids , applications number their events from TRACE_EVENT_USER_FIRST */
+#define TRACE_EVENT_DROPPED                 0x00    /* trace: "{a16} records dropped , TX ring full" */
+#define TRACE_EVENT_START                   0x01    /* trace: "trace started , format {a16}" */
+#define TRACE_EVENT_USER_FIRST              0x10
+
+#if TRACE_RECORD_SIZE > EUSART_TX_BUFFER_SIZE
+#error "EUSART_TX_BUFFER_SIZE must hold at least one trace record"
+#endif
+
+/* Section : Macro Functions Declarations */
+
+#if INTERRUPT_FEATURE_ENABLE == EUSART_TX_INTERRUPT_FEATURE_ENABLE
+#define TRACE_LOG(_EVENT , _ARG8 , _ARG16)  ((void)Trace_Log((_EVENT) , (uint8)(_ARG8) , (uint16)(_ARG16)))
+#else
+#define TRACE_LOG(_EVENT , _ARG8 , _ARG16)  ((void)0)
+#endif
+
+/* Section : Function Declarations */
+
+#if INTERRUPT_FEATURE_ENABLE == EUSART_TX_INTERRUPT_FEATURE_ENABLE
+
+/**
+ * @brief Clear the drop counter and queue a TRACE_EVENT_START record
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Start record queued
+ *         - E_NOT_OK : TX ring full , the record is counted as dropped
+ *
+ * @note EUSART_ASYNC_Init() must run first.
+ */
+Std_ReturnType Trace_Init(void);
+
+/**
+ * @brief Queue one trace record
+ *
+ * @param event_id Application event , TRACE_EVENT_USER_FIRST .. 0xFF
+ * @param arg8     First payload field
+ * @param arg16    Second payload field
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Record queued
+ *         - E_NOT_OK : Reserved event id , or TX ring full (record dropped)
+ *
+ * @note Main loop only : the TX ring has a single producer. Blocking EUSART
+ *       writes while records are queued interleave with them , the decoder
+ *       skips the foreign bytes.
+ */
+Std_ReturnType Trace_Log(uint8 event_id , uint8 arg8 , uint16 arg16);
+
+/**
+ * @brief Read the number of records dropped and not reported yet
+ *
+ * @param dropped Pointer to the returned count
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Count returned
+ *         - E_NOT_OK : Null pointer
+ */
+Std_ReturnType Trace_Get_Dropped(uint16 *dropped);
+
+#endif
+
+#endif	/* ECU_TRACE_H */
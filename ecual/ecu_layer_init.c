@@ -5,6 +5,10 @@
  * @details
  * Initializes all high-level ECU modules for your project.
  *
+ * Pass 1 merges the pins of the table into per-port output / input masks
+ * and initial output levels , pass 2 runs the driver inits that carry
+ * state or a protocol.
+ *
  * Layer: ECUAL
  * Target: PIC18F4620
  *
@@ -14,8 +18,221 @@
 
 #include "ecu_layer_init.h"
 
+/* Section : Data Types Declarations */
+
+/**
+ * @brief Pins of one port merged from the table
+ */
+typedef struct{
+    uint8 output_mask ;
+    uint8 input_mask ;
+    uint8 output_logic ;
+}ecu_layer_port_t;
+
+/* Section : Static Function Declarations */
+
+static Std_ReturnType ecu_layer_add_pin(ecu_layer_port_t *ports , uint8 port , uint8 pin ,
+                                        uint8 direction , uint8 logic);
+static Std_ReturnType ecu_layer_add_pins(ecu_layer_port_t *ports , const pin_config_t *pins , uint8 count);
+static Std_ReturnType ecu_layer_collect(ecu_layer_port_t *ports , const ecu_layer_entry_t *entry);
+static Std_ReturnType ecu_layer_driver_init(const ecu_layer_entry_t *entry);
+
+/* Section : Function Definitions */
 
-void initialize_ecu_layer(void)
+Std_ReturnType initialize_ecu_layer(const ecu_layer_cfg_t *cfg , uint32 *status)
 {
+    Std_ReturnType ret = E_OK;
+    Std_ReturnType l_entry_ret = E_OK;
+    ecu_layer_port_t l_ports[PORT_MAX_NUMBER];
+    uint32 l_status = ZERO_INIT;
+    uint8 l_direction = ZERO_INIT;
+    uint8 l_index = ZERO_INIT;
+    
+    if((NULL == cfg) || ((ZERO_INIT != cfg->entry_count) && (NULL == cfg->entries))){
+        ret = E_NOT_OK;
+    }
+    else{
+        for(l_index = ZERO_INIT ; l_index < PORT_MAX_NUMBER ; l_index++){
+            l_ports[l_index].output_mask = ZERO_INIT;
+            l_ports[l_index].input_mask = ZERO_INIT;
+            l_ports[l_index].output_logic = ZERO_INIT;
+        }
+        
+        /* Pass 1 : merge the pins , a bad entry is reported and left out of pass 2 */
+        for(l_index = ZERO_INIT ; l_index < cfg->entry_count ; l_index++){
+            if(E_OK != ecu_layer_collect(l_ports , &(cfg->entries[l_index]))){
+                if(ECU_LAYER_STATUS_ENTRIES > l_index){
+                    l_status |= ((uint32)1 << l_index);
+                }
+                else{ /* Beyond the status word */ }
+                ret = E_NOT_OK;
+            }
+            else{ /* Nothing */ }
+        }
+        
+        /* Levels first , then directions , one write each per port */
+        for(l_index = ZERO_INIT ; l_index < PORT_MAX_NUMBER ; l_index++){
+            if(ZERO_INIT != (l_ports[l_index].output_mask | l_ports[l_index].input_mask)){
+                ret &= gpio_port_write_masked((port_index_t)l_index , l_ports[l_index].output_mask , l_ports[l_index].output_logic);
+                ret &= gpio_port_get_direction_status((port_index_t)l_index , &l_direction);
+                l_direction = (uint8)((l_direction & (uint8)~l_ports[l_index].output_mask) | l_ports[l_index].input_mask);
+                ret &= gpio_port_direction_initialize((port_index_t)l_index , l_direction);
+            }
+            else{ /* Port not used by the table */ }
+        }
+        
+        /* Pass 2 : drivers with state or a protocol */
+        for(l_index = ZERO_INIT ; l_index < cfg->entry_count ; l_index++){
+            if((ECU_LAYER_STATUS_ENTRIES <= l_index) || (ZERO_INIT == (l_status & ((uint32)1 << l_index)))){
+                l_entry_ret = ecu_layer_driver_init(&(cfg->entries[l_index]));
+                if(E_OK != l_entry_ret){
+                    if(ECU_LAYER_STATUS_ENTRIES > l_index){
+                        l_status |= ((uint32)1 << l_index);
+                    }
+                    else{ /* Beyond the status word */ }
+                    ret = E_NOT_OK;
+                }
+                else{ /* Nothing */ }
+            }
+            else{ /* Already failed in pass 1 */ }
+        }
+    }
+    
+    if(NULL != status){
+        *status = l_status;
+    }
+    else{ /* Nothing */ }
+    return ret;
+}
+
+/* Section : Static Function Definitions */
+
+static Std_ReturnType ecu_layer_add_pin(ecu_layer_port_t *ports , uint8 port , uint8 pin ,
+                                        uint8 direction , uint8 logic){
+    Std_ReturnType ret = E_OK;
+    uint8 l_mask = ZERO_INIT;
+    
+    if((PORT_MAX_NUMBER <= port) || (PORT_PIN_MAX_NUMBER <= pin)){
+        ret = E_NOT_OK;
+    }
+    else{
+        l_mask = (uint8)(1 << pin);
+        if(GPIO_DIRECTION_OUTPUT == direction){
+            ports[port].output_mask |= l_mask;
+            ports[port].input_mask &= (uint8)~l_mask;
+            if(GPIO_PIN_HIGH == logic){
+                ports[port].output_logic |= l_mask;
+            }
+            else{
+                ports[port].output_logic &= (uint8)~l_mask;
+            }
+        }
+        else{
+            ports[port].input_mask |= l_mask;
+            ports[port].output_mask &= (uint8)~l_mask;
+        }
+    }
+    return ret;
+}
+
+static Std_ReturnType ecu_layer_add_pins(ecu_layer_port_t *ports , const pin_config_t *pins , uint8 count){
+    Std_ReturnType ret = E_OK;
+    uint8 l_index = ZERO_INIT;
+    
+    for(l_index = ZERO_INIT ; l_index < count ; l_index++){
+        ret &= ecu_layer_add_pin(ports , pins[l_index].port , pins[l_index].pin ,
+                                 pins[l_index].direction , pins[l_index].logic);
+    }
+    return ret;
+}
+
+/**
+ * @brief Merge the pins of one entry
+ */
+static Std_ReturnType ecu_layer_collect(ecu_layer_port_t *ports , const ecu_layer_entry_t *entry){
+    Std_ReturnType ret = E_OK;
+    const led_t *l_led = NULL;
+    const relay_t *l_relay = NULL;
+    const keypad_t *l_keypad = NULL;
+#if CHR_LCD_4BIT_OR_8BIT_MODE_CFG == CHR_LCD_4BIT_MODE_ENABLE
+    const chr_lcd_4bit_t *l_lcd = NULL;
+#elif CHR_LCD_4BIT_OR_8BIT_MODE_CFG == CHR_LCD_8BIT_MODE_ENABLE
+    const chr_lcd_8bit_t *l_lcd = NULL;
+#endif
+    
+    if(NULL == entry->object){
+        ret = E_NOT_OK;
+    }
+    else{
+        switch(entry->driver){
+            case ECU_LAYER_LED :
+                l_led = (const led_t *)entry->object;
+                ret = ecu_layer_add_pin(ports , l_led->port_name , l_led->pin , GPIO_DIRECTION_OUTPUT , l_led->led_status);
+                break;
+            case ECU_LAYER_RELAY :
+                l_relay = (const relay_t *)entry->object;
+                ret = ecu_layer_add_pin(ports , l_relay->relay_port , l_relay->relay_pin , GPIO_DIRECTION_OUTPUT , l_relay->relay_status);
+                break;
+            case ECU_LAYER_MOTOR :
+                ret = ecu_layer_add_pins(ports , ((const dc_motor_t *)entry->object)->dc_motor , 2);
+                break;
+            case ECU_LAYER_KEYPAD :
+                l_keypad = (const keypad_t *)entry->object;
+                ret = ecu_layer_add_pins(ports , l_keypad->keypad_row_pins , KEYPAD_ROW);
+                ret &= ecu_layer_add_pins(ports , l_keypad->keypad_column_pins , KEYPAD_COLUMN);
+                break;
+            case ECU_LAYER_LCD :
+#if CHR_LCD_4BIT_OR_8BIT_MODE_CFG == CHR_LCD_4BIT_MODE_ENABLE
+                l_lcd = (const chr_lcd_4bit_t *)entry->object;
+                ret = ecu_layer_add_pins(ports , l_lcd->lcd_data , 4);
+#if CHR_LCD_BUSY_FLAG_CFG == CHR_LCD_FEATURE_ENABLE
+                ret &= ecu_layer_add_pins(ports , &(l_lcd->lcd_rw) , 1);
+#endif
+#elif CHR_LCD_4BIT_OR_8BIT_MODE_CFG == CHR_LCD_8BIT_MODE_ENABLE
+                l_lcd = (const chr_lcd_8bit_t *)entry->object;
+                ret = ecu_layer_add_pins(ports , l_lcd->lcd_data , 8);
+#endif
+                ret &= ecu_layer_add_pins(ports , &(l_lcd->lcd_rs) , 1);
+                ret &= ecu_layer_add_pins(ports , &(l_lcd->lcd_en) , 1);
+                break;
+            case ECU_LAYER_I2C :
+            case ECU_LAYER_UART :
+                /* MCAL owns the pins (RC3 / RC4 , RC6 / RC7) */
+                break;
+            default :
+                ret = E_NOT_OK;
+                break;
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Driver init of the entries that need more than their pins
+ */
+static Std_ReturnType ecu_layer_driver_init(const ecu_layer_entry_t *entry){
+    Std_ReturnType ret = E_OK;
     
+    switch(entry->driver){
+        case ECU_LAYER_KEYPAD :
+            ret = keypad_initialize((keypad_t *)entry->object);
+            break;
+        case ECU_LAYER_LCD :
+#if CHR_LCD_4BIT_OR_8BIT_MODE_CFG == CHR_LCD_4BIT_MODE_ENABLE
+            ret = lcd_4bit_initialize((const chr_lcd_4bit_t *)entry->object);
+#elif CHR_LCD_4BIT_OR_8BIT_MODE_CFG == CHR_LCD_8BIT_MODE_ENABLE
+            ret = lcd_8bit_initialize((const chr_lcd_8bit_t *)entry->object);
+#endif
+            break;
+        case ECU_LAYER_I2C :
+            ret = MSSP_I2C_Init((const mssp_i2c_t *)entry->object);
+            break;
+        case ECU_LAYER_UART :
+            ret = EUSART_ASYNC_Init((usart_t *)entry->object);
+            break;
+        default :
+            /* LED , relay , motor : pins only , done in pass 1 */
+            break;
+    }
+    return ret;
 }
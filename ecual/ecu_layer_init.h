@@ -7,6 +7,16 @@
  * ECUAL drivers for your project, including LEDs, 7-segment, LCD,
  * keypad, motors, relays, RTC, EEPROM, and temperature sensors.
  *
+ * The drivers to bring up are listed in a static table owned by the
+ * application (ecu_layer_cfg_t) , walked once :
+ *  - Pass 1 : every GPIO pin of the table is merged per port , each port
+ *             gets one masked LATx write (initial levels) then one TRISx
+ *             write , outputs never glitch through a wrong level
+ *  - Pass 2 : drivers with state or a protocol (LCD , keypad , I2C ,
+ *             UART) run their own init , pure GPIO drivers (LED , relay ,
+ *             motor) are already done by pass 1
+ * Every failing entry sets its bit in the aggregate status word.
+ *
  * Layer: ECUAL
  * Target: PIC18F4620
  *
@@ -27,24 +37,84 @@
 #include"Relay/ecu_relay.h"
 #include"RealTimeClock_DS1307/RealTimeClock_DS1307.h"
 #include"EEPROM_24C02C/EEPROM_24C02C.h"
+#include"EEPROM_Log/ecu_eeprom_log.h"
+#include"Flash_Log/ecu_flash_log.h"
 #include"Temperature_Sensor_TC74/Temperature_Sensor_TC74.h"
+#include"../mcal/EUSART/hal_eusart.h"
+#include"../mcal/I2C/I2C_APIs.h"
 
 /* Section : Macro Declaration */
 
+/* Entries tracked one by one in the status word , later entries only fail the return value */
+#define ECU_LAYER_STATUS_ENTRIES            32
+
 /* Section : Macro Functions Declarations */
 
+/* Table entry builders */
+#define ECU_LAYER_ENTRY_LED(_OBJ)           { ECU_LAYER_LED , (void *)(_OBJ) }
+#define ECU_LAYER_ENTRY_RELAY(_OBJ)         { ECU_LAYER_RELAY , (void *)(_OBJ) }
+#define ECU_LAYER_ENTRY_MOTOR(_OBJ)         { ECU_LAYER_MOTOR , (void *)(_OBJ) }
+#define ECU_LAYER_ENTRY_KEYPAD(_OBJ)        { ECU_LAYER_KEYPAD , (void *)(_OBJ) }
+#define ECU_LAYER_ENTRY_LCD(_OBJ)           { ECU_LAYER_LCD , (void *)(_OBJ) }
+#define ECU_LAYER_ENTRY_I2C(_OBJ)           { ECU_LAYER_I2C , (void *)(_OBJ) }
+#define ECU_LAYER_ENTRY_UART(_OBJ)          { ECU_LAYER_UART , (void *)(_OBJ) }
+
 /* Section : Data Types Declarations */
 
+/**
+ * @enum ecu_layer_driver_t
+ * @brief Driver of a table entry
+ *
+ * @note ECU_LAYER_LCD takes a chr_lcd_4bit_t or a chr_lcd_8bit_t following
+ *       CHR_LCD_4BIT_OR_8BIT_MODE_CFG.
+ */
+typedef enum{
+    ECU_LAYER_LED = 0,          /* led_t */
+    ECU_LAYER_RELAY,            /* relay_t */
+    ECU_LAYER_MOTOR,            /* dc_motor_t */
+    ECU_LAYER_KEYPAD,           /* keypad_t */
+    ECU_LAYER_LCD,              /* chr_lcd_4bit_t / chr_lcd_8bit_t */
+    ECU_LAYER_I2C,              /* mssp_i2c_t */
+    ECU_LAYER_UART              /* usart_t (asynchronous) */
+}ecu_layer_driver_t;
+
+/**
+ * @struct ecu_layer_entry_t
+ * @brief One driver object to initialize
+ */
+typedef struct{
+    ecu_layer_driver_t driver ;
+    void *object ;
+}ecu_layer_entry_t;
+
+/**
+ * @struct ecu_layer_cfg_t
+ * @brief Static initialization table
+ */
+typedef struct{
+    const ecu_layer_entry_t *entries ;
+    uint8 entry_count ;
+}ecu_layer_cfg_t;
+
 /* Section : Function Declarations */
 
 /**
- * @brief Initialize all ECUAL layer modules
+ * @brief Initialize all ECUAL layer modules of a configuration table
  *
  * @details
  * This function initializes all peripherals in the ECUAL layer.
  * Call this once at system startup.
+ *
+ * @param cfg    Pointer to the initialization table
+ * @param status Pointer to the aggregate status word , bit n set = entry n
+ *               failed (null object , invalid pin or driver init error) ,
+ *               may be NULL
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Every entry initialized
+ *         - E_NOT_OK : Null table or at least one entry failed
  */
-void initialize_ecu_layer(void);
+Std_ReturnType initialize_ecu_layer(const ecu_layer_cfg_t *cfg , uint32 *status);
 
 #endif	/* ECU_LAYER_INIT_H */
 
@@ -12,14 +12,32 @@
  */
 
 #include"hal_adc.h"
+#include"../Interrupt/mcal_interrupt_critical.h"
 
 #if    INTERRUPT_FEATURE_ENABLE == ADC_INTERRUPT_FEATURE_ENABLE
     static void (* ADC_InterruptHandler ) (void) = NULL;
+    
+    /* Scan sequencer state , adc_scan_active is NULL while no sweep runs */
+    static const adc_scan_t * volatile adc_scan_active = NULL;
+    static const adc_conf_t *adc_scan_conf = NULL;
+    static volatile uint8 adc_scan_index = ZERO_INIT;
+    
+    /* Triggered sampling state , adc_pingpong_active is NULL while stopped */
+    static const adc_pingpong_t * volatile adc_pingpong_active = NULL;
+    static const adc_conf_t *adc_pingpong_conf = NULL;
+    static adc_result_t * volatile adc_pingpong_ready = NULL;
+    static volatile uint8 adc_pingpong_index = ZERO_INIT;
+    static volatile uint8 adc_pingpong_half = ZERO_INIT;
+    static volatile uint8 adc_pingpong_overruns = ZERO_INIT;
 #endif
 
 static Std_ReturnType Set_result_format(const adc_conf_t *_adc );
 static Std_ReturnType Set_voltage_reference(const adc_conf_t *_adc );
 static Std_ReturnType set_channel_input(const adc_channel_select_t channel );
+#if    INTERRUPT_FEATURE_ENABLE == ADC_INTERRUPT_FEATURE_ENABLE
+static void adc_scan_start_channel(adc_channel_select_t channel);
+static void adc_pingpong_store(const adc_pingpong_t *pingpong);
+#endif
 
 Std_ReturnType ADC_Init(const adc_conf_t *_adc ){
     Std_ReturnType ret = E_OK;
@@ -44,21 +62,6 @@ Std_ReturnType ADC_Init(const adc_conf_t *_adc ){
 #if    INTERRUPT_FEATURE_ENABLE == ADC_INTERRUPT_FEATURE_ENABLE
         ADC_INTERRUPT_CLEAR_FLAG();
         ADC_InterruptHandler = _adc->ADC_InterruptHandler; 
-#if INTERRUPT_PRIORITY_LEVELS_ENABLE  ==  INTERRUPT_FEATURE_ENABLE
-        if(Interrupt_High_Priority == _adc->priority){
-            ADC_INTERRUPT_HIGH_PRIORITY();
-        }
-        else if(Interrupt_Low_Priority == _adc->priority){
-            ADC_INTERRUPT_LOW_PRIORITY();
-        }
-        INTERRUPT_PriorityFeatureEnable();
-        INTERRUPT_GlobalInterruptHighEnable();
-        INTERRUPT_GlobalInterruptLowEnable();
-#else
-        INTERRUPT_GlobalInterruptEnable();
-        INTERRUPT_PeripheralInterruptEnable();
-#endif
- 
         ADC_INTERRUPT_ENABLE();
 #endif  
         /* Enable the ADC */
@@ -120,10 +123,10 @@ Std_ReturnType ADC_GetConversionResult(const adc_conf_t *_adc , adc_result_t *Re
     }
     else{
         if(ADC_RESULT_RIGHT == _adc->result_format){
-            *Result = (adc_result_t)((ADRESH << 8) + ADRESL);
+            *Result = ADC_READ_RESULT_RIGHT();
         }
         else if(ADC_RESULT_LEFT == _adc->result_format){
-            *Result = (adc_result_t)((ADRESL >> 6) + (ADRESH*4));
+            *Result = ADC_READ_RESULT_LEFT();
         }
         else{
             ret = E_NOT_OK ;
@@ -132,6 +135,17 @@ Std_ReturnType ADC_GetConversionResult(const adc_conf_t *_adc , adc_result_t *Re
     return ret;
 }
 
+Std_ReturnType ADC_GetConversionResult_8Bit(const adc_conf_t *_adc , uint8 *Result){
+    Std_ReturnType ret = E_OK;
+    if((NULL == _adc) || (NULL == Result) || (ADC_RESULT_LEFT != _adc->result_format)){
+        ret = E_NOT_OK;
+    }
+    else{
+        *Result = ADC_READ_RESULT_8BIT();
+    }
+    return ret;
+}
+
 Std_ReturnType ADC_GetConversion_Blocking(const adc_conf_t *_adc , adc_channel_select_t channel 
                                           , adc_result_t *Result ){
     Std_ReturnType ret = E_OK;
@@ -151,6 +165,41 @@ Std_ReturnType ADC_GetConversion_Blocking(const adc_conf_t *_adc , adc_channel_s
     return ret;
 }
 
+Std_ReturnType ADC_GetConversion_Blocking_8Bit(const adc_conf_t *_adc , adc_channel_select_t channel 
+                                               , uint8 *Result ){
+    Std_ReturnType ret = E_OK;
+    if((NULL == _adc) || (NULL == Result) || (ADC_RESULT_LEFT != _adc->result_format)){
+        ret = E_NOT_OK;
+    }
+    else{
+        ret &= ADC_Select_Channel(channel);
+        ADC_CONVERSION_STARTS();
+        while(ADCON0bits.GO_DONE){ /* Blocking  */ }
+        *Result = ADC_READ_RESULT_8BIT();
+    }
+    return ret;
+}
+
+#if CONFIG_ENABLE == ADC_FAST_CONFIGURATION
+
+adc_result_t ADC_Fast_Convert_Blocking(adc_channel_select_t channel){
+    ADCON0bits.CHS = channel;
+    ADC_CONVERSION_STARTS();
+    while(ADCON0bits.GO_DONE){ /* Blocking  */ }
+    return ADC_FAST_READ();
+}
+
+#if ADC_RESULT_LEFT == ADC_FAST_RESULT_FORMAT
+uint8 ADC_Fast_Convert_Blocking_8Bit(adc_channel_select_t channel){
+    ADCON0bits.CHS = channel;
+    ADC_CONVERSION_STARTS();
+    while(ADCON0bits.GO_DONE){ /* Blocking  */ }
+    return ADC_FAST_READ_8BIT();
+}
+#endif
+
+#endif
+
 
 Std_ReturnType ADC_StartConversion_Interrupt(const adc_conf_t *_adc , adc_channel_select_t channel){
     Std_ReturnType ret = E_OK;
@@ -167,6 +216,135 @@ Std_ReturnType ADC_StartConversion_Interrupt(const adc_conf_t *_adc , adc_channe
 }
 
 
+#if    INTERRUPT_FEATURE_ENABLE == ADC_INTERRUPT_FEATURE_ENABLE
+
+Std_ReturnType ADC_Scan_Start(const adc_conf_t *_adc , const adc_scan_t *scan){
+    Std_ReturnType ret = E_OK;
+    uint8 l_index = ZERO_INIT;
+    
+    if((NULL == _adc) || (NULL == scan) || (NULL == scan->channels) ||
+       (NULL == scan->results) || (ZERO_INIT == scan->channel_count)){
+        ret = E_NOT_OK;
+    }
+    else if((NULL != adc_scan_active) || (NULL != adc_pingpong_active) || (ADC_CONVERSION_STATUS())){
+        ret = E_NOT_OK;
+    }
+    else{
+        /* Every pin of the list made an input once , the ISR only switches CHS */
+        for(l_index = ZERO_INIT ; (l_index < scan->channel_count) && (E_OK == ret) ; l_index++){
+            ret = set_channel_input(scan->channels[l_index]);
+        }
+        if(E_OK == ret){
+            adc_scan_conf = _adc;
+            adc_scan_index = ZERO_INIT;
+            adc_scan_active = scan;
+            adc_scan_start_channel(scan->channels[ZERO_INIT]);
+        }
+        else{ /* Invalid channel in the list */ }
+    }
+    return ret;
+}
+
+Std_ReturnType ADC_Scan_Stop(void){
+    Std_ReturnType ret = E_OK;
+    interrupt_critical_t l_section;
+    
+    ret = Interrupt_Critical_Enter(&l_section , INTERRUPT_CRITICAL_ADC);
+    if(NULL != adc_scan_active){
+        /* Abort the channel in flight , its result would reach ADC_InterruptHandler */
+        ADCON0bits.GODONE = 0;
+        ADC_INTERRUPT_CLEAR_FLAG();
+        adc_scan_active = NULL;
+    }
+    else{ /* No sweep , a single conversion is left alone */ }
+    ret &= Interrupt_Critical_Exit(&l_section);
+    return ret;
+}
+
+Std_ReturnType ADC_Scan_Is_Busy(uint8 *busy){
+    Std_ReturnType ret = E_OK;
+    if(NULL == busy){
+        ret = E_NOT_OK;
+    }
+    else{
+        *busy = (NULL != adc_scan_active) ? 1 : 0 ;
+    }
+    return ret;
+}
+
+Std_ReturnType ADC_Triggered_Start(const adc_conf_t *_adc , const adc_pingpong_t *pingpong ,
+                                   adc_channel_select_t channel){
+    Std_ReturnType ret = E_OK;
+    
+    if((NULL == _adc) || (NULL == pingpong) || (NULL == pingpong->buffer) ||
+       (ZERO_INIT == pingpong->block_length) || (ADC_0_TAD == _adc->acquisition_time)){
+        ret = E_NOT_OK;
+    }
+    else if((NULL != adc_scan_active) || (NULL != adc_pingpong_active) || (ADC_CONVERSION_STATUS())){
+        ret = E_NOT_OK;
+    }
+    else{
+        ret = ADC_Select_Channel(channel);
+        if(E_OK == ret){
+            ADC_INTERRUPT_DISABLE();
+            adc_pingpong_conf = _adc;
+            adc_pingpong_ready = NULL;
+            adc_pingpong_index = ZERO_INIT;
+            adc_pingpong_half = ZERO_INIT;
+            adc_pingpong_overruns = ZERO_INIT;
+            adc_pingpong_active = pingpong;
+            ADC_INTERRUPT_CLEAR_FLAG();
+            ADC_INTERRUPT_ENABLE();
+        }
+        else{ /* Invalid channel */ }
+    }
+    return ret;
+}
+
+Std_ReturnType ADC_Triggered_Stop(void){
+    Std_ReturnType ret = E_OK;
+    interrupt_critical_t l_section;
+    
+    ret = Interrupt_Critical_Enter(&l_section , INTERRUPT_CRITICAL_ADC);
+    if(NULL != adc_pingpong_active){
+        /* Drop the pending result and the half not taken yet */
+        ADC_INTERRUPT_CLEAR_FLAG();
+        adc_pingpong_active = NULL;
+        adc_pingpong_ready = NULL;
+        adc_pingpong_index = ZERO_INIT;
+    }
+    else{ /* Nothing */ }
+    ret &= Interrupt_Critical_Exit(&l_section);
+    return ret;
+}
+
+Std_ReturnType ADC_Triggered_Get_Block(adc_result_t **block){
+    Std_ReturnType ret = E_OK;
+    interrupt_critical_t l_section;
+    if(NULL == block){
+        ret = E_NOT_OK;
+    }
+    else{
+        ret = Interrupt_Critical_Enter(&l_section , INTERRUPT_CRITICAL_ADC);
+        *block = adc_pingpong_ready;
+        adc_pingpong_ready = NULL;
+        ret &= Interrupt_Critical_Exit(&l_section);
+    }
+    return ret;
+}
+
+Std_ReturnType ADC_Triggered_Get_Overruns(uint8 *overruns){
+    Std_ReturnType ret = E_OK;
+    if(NULL == overruns){
+        ret = E_NOT_OK;
+    }
+    else{
+        *overruns = adc_pingpong_overruns;
+    }
+    return ret;
+}
+
+#endif
 
 static Std_ReturnType Set_result_format(const adc_conf_t *_adc ){
     Std_ReturnType ret = E_OK;
@@ -221,15 +399,86 @@ static Std_ReturnType Set_voltage_reference(const adc_conf_t *_adc ){
 
 #if    INTERRUPT_FEATURE_ENABLE == ADC_INTERRUPT_FEATURE_ENABLE
 
+/**
+ * @brief Switch the channel and start its conversion
+ * @note  With ADC_0_TAD the hold capacitor needs a software acquisition
+ *        delay , otherwise the ADC runs ACQT before converting.
+ */
+static void adc_scan_start_channel(adc_channel_select_t channel){
+    ADCON0bits.CHS = channel;
+    if(ADC_0_TAD == ADCON2bits.ACQT){
+        __delay_us(ADC_SCAN_MANUAL_ACQUISITION_US);
+    }
+    else{ /* Acquisition timed by the ADC */ }
+    ADC_CONVERSION_STARTS();
+}
+
+/**
+ * @brief Store one triggered result , swap halves when the current one is full
+ */
+static void adc_pingpong_store(const adc_pingpong_t *pingpong){
+    adc_result_t *l_half = &(pingpong->buffer[adc_pingpong_half ? pingpong->block_length : ZERO_INIT]);
+    
+#if CONFIG_ENABLE == ADC_FAST_CONFIGURATION
+    l_half[adc_pingpong_index] = ADC_FAST_READ();
+#else
+    (void)ADC_GetConversionResult(adc_pingpong_conf , &(l_half[adc_pingpong_index]));
+#endif
+    adc_pingpong_index++;
+    if(adc_pingpong_index >= pingpong->block_length){
+        if((NULL != adc_pingpong_ready) && (0xFF != adc_pingpong_overruns)){
+            adc_pingpong_overruns++;
+        }
+        else{ /* Nothing */ }
+        adc_pingpong_ready = l_half;
+        adc_pingpong_index = ZERO_INIT;
+        adc_pingpong_half ^= 1;
+        if(pingpong->ADC_Block_Ready_Handler){
+            pingpong->ADC_Block_Ready_Handler();
+        }
+        else{ /* Nothing */ }
+    }
+    else{ /* Nothing */ }
+}
+
 /**
  * @brief ADC Interrupt Service Routine
- * @details Clears ADC interrupt flag and calls user-defined callback if set.
+ * @details Clears ADC interrupt flag. In triggered sampling , stores the
+ *          result in the ping-pong buffer. During a sweep , stores the result and
+ *          starts the next channel , then calls the scan complete handler
+ *          after the last one. Otherwise calls the user-defined callback.
  */
 void ADC_ISR(void){
+    const adc_scan_t *l_scan = adc_scan_active;
+    const adc_pingpong_t *l_pingpong = adc_pingpong_active;
+    
     ADC_INTERRUPT_CLEAR_FLAG();
-    if(ADC_InterruptHandler){
+    if(NULL != l_pingpong){
+        adc_pingpong_store(l_pingpong);
+    }
+    else if(NULL != l_scan){
+#if CONFIG_ENABLE == ADC_FAST_CONFIGURATION
+        l_scan->results[adc_scan_index] = ADC_FAST_READ();
+#else
+        (void)ADC_GetConversionResult(adc_scan_conf , &(l_scan->results[adc_scan_index]));
+#endif
+        adc_scan_index++;
+        if(adc_scan_index < l_scan->channel_count){
+            adc_scan_start_channel(l_scan->channels[adc_scan_index]);
+        }
+        else{
+            /* Cleared first , the handler may start the next sweep */
+            adc_scan_active = NULL;
+            if(l_scan->ADC_Scan_Complete_Handler){
+                l_scan->ADC_Scan_Complete_Handler();
+            }
+            else{ /* Nothing */ }
+        }
+    }
+    else if(ADC_InterruptHandler){
         ADC_InterruptHandler();
     }
+    else{ /* Nothing */ }
 }
 
 #endif
@@ -23,6 +23,7 @@
 #include"std_types.h"
 #include"hal_gpio.h"
 #include"mcal_internal_interrupt.h"
+#include"hal_adc_cfg.h"
 
 /* Section : Macro Declaration */
 
@@ -56,6 +57,13 @@
 #define ADC_VOLTAGE_REFERENCE_ENABLE     0x01
 #define ADC_VOLTAGE_REFERENCE_DISABLE    0x00
 
+/**
+ * @brief Scan sequencer : acquisition delay after a channel switch when
+ *        the acquisition time is ADC_0_TAD (manual acquisition) , in us.
+ *        With any other acquisition time the ADC waits by itself.
+ */
+#define ADC_SCAN_MANUAL_ACQUISITION_US   3
+
 /* Section : Macro Functions Declarations */
 
 /**
@@ -100,6 +108,26 @@
 #define ADC_RESULT_RIGHT_FORMAT()                      (ADCON2bits.ADFM = 1)      
 #define ADC_RESULT_LEFT_FORMAT()                       (ADCON2bits.ADFM = 0) 
 
+/**
+ * @brief Read the result registers of the last conversion
+ * @note  ADC_READ_RESULT_8BIT() is the upper 8 bits of the result and
+ *        is valid in left-justified format only : one ADRESH read.
+ */
+#define ADC_READ_RESULT_RIGHT()        ((adc_result_t)(((uint16)ADRESH << 8) | ADRESL))
+#define ADC_READ_RESULT_LEFT()         ((adc_result_t)(((uint16)ADRESH << 2) | (ADRESL >> 6)))
+#define ADC_READ_RESULT_8BIT()         ((uint8)ADRESH)
+
+#if CONFIG_ENABLE == ADC_FAST_CONFIGURATION
+#if ADC_RESULT_RIGHT == ADC_FAST_RESULT_FORMAT
+#define ADC_FAST_READ()                ADC_READ_RESULT_RIGHT()
+#elif ADC_RESULT_LEFT == ADC_FAST_RESULT_FORMAT
+#define ADC_FAST_READ()                ADC_READ_RESULT_LEFT()
+#define ADC_FAST_READ_8BIT()           ADC_READ_RESULT_8BIT()
+#else
+#error "ADC_FAST_RESULT_FORMAT must be ADC_RESULT_RIGHT or ADC_RESULT_LEFT"
+#endif
+#endif
+
 
 /* Section : Data Types Declarations */
 
@@ -155,9 +183,6 @@ typedef enum{
 typedef struct{
 #if    INTERRUPT_FEATURE_ENABLE == ADC_INTERRUPT_FEATURE_ENABLE
     void (* ADC_InterruptHandler) (void);       /**< User callback for ADC interrupt */
-#if INTERRUPT_PRIORITY_LEVELS_ENABLE  ==  INTERRUPT_FEATURE_ENABLE
-    INTERRUPT_Priority_cfg priority;             /**< High/Low priority */
-#endif
 #endif    
     adc_acquisition_time_t  acquisition_time;   /**< ADC acquisition time */
     adc_conversion_clock_t  conversion_clock;   /**< ADC conversion clock */
@@ -172,6 +197,31 @@ typedef struct{
  */
 typedef uint16 adc_result_t;
 
+#if    INTERRUPT_FEATURE_ENABLE == ADC_INTERRUPT_FEATURE_ENABLE
+/**
+ * @brief Scan list , converted channel by channel from ADC_ISR
+ * @note  Owned by the caller , must stay valid until the sweep is done
+ */
+typedef struct{
+    void (* ADC_Scan_Complete_Handler) (void);  /**< Called from ADC_ISR once the sweep is done */
+    const adc_channel_select_t *channels;       /**< Channels , in conversion order */
+    adc_result_t *results;                      /**< results[i] gets the value of channels[i] */
+    uint8 channel_count;                        /**< Entries in channels / results */
+}adc_scan_t;
+
+/**
+ * @brief Ping-pong buffer of the triggered (CCP2 special event) sampling
+ * @details buffer holds 2 * block_length results : while the main loop
+ *          processes one half , ADC_ISR fills the other one.
+ * @note  Owned by the caller , must stay valid until ADC_Triggered_Stop
+ */
+typedef struct{
+    void (* ADC_Block_Ready_Handler) (void);    /**< Optional , called from ADC_ISR when a half is full */
+    adc_result_t *buffer;                       /**< 2 * block_length entries */
+    uint8 block_length;                         /**< Samples per half */
+}adc_pingpong_t;
+#endif
+
 /* Section : Function Declarations */
 
 /**
@@ -218,6 +268,14 @@ Std_ReturnType ADC_IsConversionDone(const adc_conf_t *_adc , uint8 * Conversion_
  */
 Std_ReturnType ADC_GetConversionResult(const adc_conf_t *_adc , adc_result_t *Result);
 
+/**
+ * @brief Get the upper 8 bits of the ADC conversion result (ADRESH only)
+ * @param[in] _adc Pointer to ADC configuration , must be left-justified
+ * @param[out] Result Pointer to store the 8-bit result
+ * @return E_OK if successful, E_NOT_OK if invalid pointer or right-justified
+ */
+Std_ReturnType ADC_GetConversionResult_8Bit(const adc_conf_t *_adc , uint8 *Result);
+
 /**
  * @brief Blocking call: select channel, start conversion, wait, and return result
  * @param[in] _adc Pointer to ADC configuration
@@ -228,6 +286,35 @@ Std_ReturnType ADC_GetConversionResult(const adc_conf_t *_adc , adc_result_t *Re
 Std_ReturnType ADC_GetConversion_Blocking(const adc_conf_t *_adc , adc_channel_select_t channel 
                                           , adc_result_t *Result );
 
+/**
+ * @brief Blocking 8-bit conversion (left-justified configuration only)
+ * @param[in] _adc Pointer to ADC configuration , must be left-justified
+ * @param[in] channel ADC channel to convert
+ * @param[out] Result Pointer to store the 8-bit result
+ * @return E_OK if successful, E_NOT_OK if invalid parameters
+ */
+Std_ReturnType ADC_GetConversion_Blocking_8Bit(const adc_conf_t *_adc , adc_channel_select_t channel 
+                                               , uint8 *Result );
+
+#if CONFIG_ENABLE == ADC_FAST_CONFIGURATION
+/**
+ * @brief Fixed-configuration blocking conversion , no parameter checks
+ * @param[in] channel ADC channel to convert , its pin already an analog input
+ *                    (ADC_Init / ADC_Select_Channel)
+ * @return Conversion result in ADC_FAST_RESULT_FORMAT
+ */
+adc_result_t ADC_Fast_Convert_Blocking(adc_channel_select_t channel);
+
+#if ADC_RESULT_LEFT == ADC_FAST_RESULT_FORMAT
+/**
+ * @brief Fixed-configuration 8-bit blocking conversion , no parameter checks
+ * @param[in] channel ADC channel to convert , its pin already an analog input
+ * @return Upper 8 bits of the conversion result
+ */
+uint8 ADC_Fast_Convert_Blocking_8Bit(adc_channel_select_t channel);
+#endif
+#endif
+
 
 /**
  * @brief Start ADC conversion using interrupt
@@ -237,6 +324,77 @@ Std_ReturnType ADC_GetConversion_Blocking(const adc_conf_t *_adc , adc_channel_s
  */
 Std_ReturnType ADC_StartConversion_Interrupt(const adc_conf_t *_adc , adc_channel_select_t channel);
 
+#if    INTERRUPT_FEATURE_ENABLE == ADC_INTERRUPT_FEATURE_ENABLE
+/**
+ * @brief Start a sweep over a list of channels
+ * @details The first channel is converted now , ADC_ISR then stores each
+ *          result , switches to the next channel and starts it. The scan
+ *          complete handler runs once the last result is stored , instead
+ *          of the per-conversion ADC_InterruptHandler.
+ * @param[in] _adc Pointer to ADC configuration (result format)
+ * @param[in] scan Pointer to the scan list
+ * @return E_OK if started , E_NOT_OK on invalid parameters or ADC busy
+ * @note  A new sweep may be started from the scan complete handler.
+ */
+Std_ReturnType ADC_Scan_Start(const adc_conf_t *_adc , const adc_scan_t *scan);
+
+/**
+ * @brief Abort the running sweep , results already stored are kept
+ * @details The conversion in flight is aborted and ADIF cleared , the ADC
+ *          interrupt enable is restored to its state before the call.
+ * @return E_OK
+ */
+Std_ReturnType ADC_Scan_Stop(void);
+
+/**
+ * @brief Check whether a sweep is running
+ * @param[out] busy 1 = sweep running , 0 = idle
+ * @return E_OK if successful, E_NOT_OK if invalid pointer
+ */
+Std_ReturnType ADC_Scan_Is_Busy(uint8 *busy);
+
+/**
+ * @brief Arm fixed-rate sampling of one channel into a ping-pong buffer
+ * @details Conversions are started by the hardware : CCP2 in
+ *          CCP_COMPARE_MODE_GEN_EVENT resets its timer and sets GO on
+ *          every compare match. ADC_ISR only stores the result , so the
+ *          sample period carries no software jitter.
+ * @param[in] _adc     Pointer to ADC configuration (result format)
+ * @param[in] pingpong Pointer to the ping-pong buffer
+ * @param[in] channel  Channel sampled on every trigger
+ * @return E_OK if armed , E_NOT_OK on invalid parameters or ADC busy
+ * @note  The acquisition time must not be ADC_0_TAD : the trigger gives
+ *        no software slot for a manual acquisition delay.
+ */
+Std_ReturnType ADC_Triggered_Start(const adc_conf_t *_adc , const adc_pingpong_t *pingpong ,
+                                   adc_channel_select_t channel);
+
+/**
+ * @brief Stop storing triggered results (CCP2 keeps running)
+ * @details ADIF is cleared and the half not taken yet is dropped ,
+ *          ADC_Triggered_Get_Block then gives NULL. The ADC interrupt
+ *          enable is restored to its state before the call.
+ * @return E_OK
+ */
+Std_ReturnType ADC_Triggered_Stop(void);
+
+/**
+ * @brief Take the last completed half of the ping-pong buffer
+ * @param[out] block Start of the full half (block_length results) , or
+ *                   NULL when no new half is ready
+ * @return E_OK if successful, E_NOT_OK if invalid pointer
+ * @note  The half stays valid until the other half is full.
+ */
+Std_ReturnType ADC_Triggered_Get_Block(adc_result_t **block);
+
+/**
+ * @brief Number of halves completed while the previous one was not taken
+ * @param[out] overruns Saturating overrun count since ADC_Triggered_Start
+ * @return E_OK if successful, E_NOT_OK if invalid pointer
+ */
+Std_ReturnType ADC_Triggered_Get_Overruns(uint8 *overruns);
+#endif
+
 #endif	/* HAL_ADC_H */
 
 
@@ -0,0 +1,28 @@
+/**
+ * @file hal_adc_cfg.h
+ * @brief ADC configuration header file.
+ *
+ * This file contains compile-time configuration macros
+ * used to enable or disable ADC driver features.
+ *
+ * @author Abdelmoniem Ahmed
+ * @linkedin <- https://www.linkedin.com/in/abdelmoniem-ahmed/ ->
+ * @date 2026
+ */
+
+#ifndef HAL_ADC_CFG_H
+#define	HAL_ADC_CFG_H
+
+/*
+ * Enable the compile-time fixed configuration API (ADC_FAST_xxx).
+ * The result format below is then fixed for the whole application :
+ * reads skip the configuration pointer , the NULL checks and the format
+ * switch , and the scan / triggered ISR paths use the same fast read.
+ * Every adc_conf_t passed to ADC_Init must use the same result_format.
+ */
+#define ADC_FAST_CONFIGURATION             CONFIG_DISABLE
+
+/* Fixed result format : ADC_RESULT_RIGHT or ADC_RESULT_LEFT */
+#define ADC_FAST_RESULT_FORMAT             ADC_RESULT_LEFT
+
+#endif	/* HAL_ADC_CFG_H */
@@ -35,6 +35,30 @@
 
 
 #include"CCP.h"
+#include"../Interrupt/mcal_interrupt_critical.h"
+#include"../GPIO/hal_gpio_marker.h"
+
+/**
+ * @brief  Configuration fields , read from the object or from CCP_CFG.h.
+ *
+ * @details
+ * With CCP_STATIC_CFG_INSTANCE the fields are constants : every instance
+ * and mode test below folds at compile time , the PR2 division included.
+ */
+#if CCP_STATIC_CFG_INSTANCE == CCP_STATIC_CFG_DISABLED
+#define CCP_OBJ_INST(_obj)             ((_obj)->ccp_inst)
+#define CCP_OBJ_MODE(_obj)             ((_obj)->ccp_mode)
+#define CCP_OBJ_VARIANT(_obj)          ((_obj)->ccp_mode_variant)
+#define CCP_OBJ_TMR13(_obj)            ((_obj)->tmr13_cfg)
+/* PR2 = (Fosc / (4 * PWM_Frequency * Prescaler)) - 1 */
+#define CCP_OBJ_PWM_PR2(_obj)          ((uint8)(_XTAL_FREQ /( (uint32)((_obj)->PWM_Frequency) * ((_obj)->timer2_prescaler_division) * 4)) -1)
+#else
+#define CCP_OBJ_INST(_obj)             ((ccp_inst_t)(CCP_STATIC_CFG_INSTANCE - 1))
+#define CCP_OBJ_MODE(_obj)             ((ccp_mode_t)CCP_STATIC_CFG_SELECTED_MODE)
+#define CCP_OBJ_VARIANT(_obj)          ((uint8)CCP_STATIC_CFG_MODE_VARIANT)
+#define CCP_OBJ_TMR13(_obj)            ((ccp_timers_cfg_t)CCP_STATIC_CFG_TMR13)
+#define CCP_OBJ_PWM_PR2(_obj)          ((uint8)(_XTAL_FREQ /( (uint32)(CCP_STATIC_CFG_PWM_FREQUENCY) * (CCP_STATIC_CFG_TIMER2_PRESCALER) * 4)) -1)
+#endif
 
 /**
  * @brief  Configures Timer1/Timer3 selection for Capture/Compare modes.
@@ -46,8 +70,88 @@
  *
  * This function is used internally during CCP initialization.
  */
+#if (CCP_CFG_CAPTURE_MODE_SELECTED == CCP1_CFG_SELECTED_MODE) || (CCP_CFG_CAPTURE_MODE_SELECTED == CCP2_CFG_SELECTED_MODE) || (CCP_CFG_COMPARE_MODE_SELECTED == CCP1_CFG_SELECTED_MODE) || (CCP_CFG_COMPARE_MODE_SELECTED == CCP2_CFG_SELECTED_MODE)
 static void CCP_CAPTURE_COMPARE_TIMERS_CFG_SET(const ccp_t * _ccp_obj);
+#endif
+
+/**
+ * @brief  Object that last initialized each CCP , NULL after CCP_DeInit().
+ */
+static const ccp_t * ccp_init_obj[2] = {NULL , NULL};
+
+/**
+ * @brief  Tells whether the CCP already runs from this configuration object.
+ *
+ * @details
+ * Guard of CCP_Init() : the same object on an enabled module is a no-op.
+ */
+static uint8 CCP_INIT_IS_ACTIVE(const ccp_t * _ccp_obj);
+
+#if (CCP_CFG_PWM_MODE_SELECTED == CCP1_CFG_SELECTED_MODE) || (CCP_CFG_PWM_MODE_SELECTED == CCP2_CFG_SELECTED_MODE)
+/**
+ * @brief  Writes a raw 10-bit duty value to CCPRxL:DCxB.
+ *
+ * @details
+ * Shared by all PWM duty setters , the value is already range checked.
+ */
+static Std_ReturnType CCP_PWM_WRITE_DUTY(const ccp_t * _ccp_obj , uint16 _duty_raw);
+#endif
+
+
+#if (CCP1_CAPTURE_ENGINE_ENABLE == 0X01) || (CCP2_CAPTURE_ENGINE_ENABLE == 0X01)
+
+/* Time base extension : the timer feeding the CCP */
+#define CCP_CAPTURE_TIMER1             0X01
+#define CCP_CAPTURE_TIMER3             0X03
+
+/**
+ * @brief  Capture engine state of one CCP.
+ *
+ * @details
+ * Times are 32-bit : overflows (upper 16 bits) : capture (lower 16 bits).
+ * Sums collect 2^CCP_CAPTURE_AVERAGE_LOG2 periods / high times , the
+ * averages are published at the rising edge that completes them.
+ */
+typedef struct{
+    uint32 last_rise ;
+    uint32 period_sum ;
+    uint32 high_sum ;
+    uint32 period_avg ;
+    uint32 high_avg ;
+    uint16 overflows ;
+    uint8  idle_overflows ;
+    uint8  edge_count ;
+    uint8  pulses_per_revolution ;
+    uint8  timer ;
+    uint8  measure      : 1 ;
+    uint8  active       : 1 ;
+    uint8  rise_seen    : 1 ;
+    uint8  wait_falling : 1 ;
+    uint8  reserved     : 4 ;
+}ccp_capture_engine_t;
 
+static volatile ccp_capture_engine_t ccp_capture_engine[2];
+
+/**
+ * @brief  Timestamps one edge and updates the averages (ISR context).
+ */
+static void CCP_CAPTURE_ENGINE_EDGE(ccp_inst_t _inst , uint16 _capture);
+
+/**
+ * @brief  Counts one timer overflow , detects a stopped input (ISR context).
+ */
+static void CCP_CAPTURE_ENGINE_OVERFLOW(ccp_inst_t _inst);
+
+/**
+ * @brief  Switches the capture edge without a false interrupt.
+ */
+static void CCP_CAPTURE_SET_EDGE(ccp_inst_t _inst , uint8 _mode);
+
+/**
+ * @brief  Copies an engine state with interrupts masked.
+ */
+static Std_ReturnType CCP_CAPTURE_SNAPSHOT(const ccp_t * _ccp_obj , ccp_capture_engine_t * _copy);
+#endif
 
 #if CCP1_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
 /**
@@ -74,24 +178,26 @@ static void CCP_CAPTURE_COMPARE_TIMERS_CFG_SET(const ccp_t * _ccp_obj);
 /* Refer to CCP.h for function documentation */    
 Std_ReturnType CCP_Init(const ccp_t * _ccp_obj){
     Std_ReturnType ret = E_OK;
-    uint32 l_PR2 = 0;
     if(NULL == _ccp_obj){
         ret = E_NOT_OK;
     }
+    else if(CCP_INIT_IS_ACTIVE(_ccp_obj)){
+        /* Already running from this object : nothing to redo */
+    }
     else{
         /* Disable ccp module */
-        if(CCP1_INST == _ccp_obj->ccp_inst){
+        if(CCP1_INST == CCP_OBJ_INST(_ccp_obj)){
             CCP1_SET_MODE(CCP_MODULE_DISABLED);
         }
-        else if(CCP2_INST == _ccp_obj->ccp_inst){
+        else if(CCP2_INST == CCP_OBJ_INST(_ccp_obj)){
             CCP2_SET_MODE(CCP_MODULE_DISABLED);
         } 
         /* Pin Configuration */
         ret = gpio_pin_initialize(&(_ccp_obj->pin));
         /* CCP Initialize Capture Mode */
-        if(CCP_CAPTURE_MODE_SELECTED == _ccp_obj->ccp_mode){
-            if(CCP1_INST == _ccp_obj->ccp_inst){
-                switch(_ccp_obj->ccp_mode_variant){
+        if(CCP_CAPTURE_MODE_SELECTED == CCP_OBJ_MODE(_ccp_obj)){
+            if(CCP1_INST == CCP_OBJ_INST(_ccp_obj)){
+                switch(CCP_OBJ_VARIANT(_ccp_obj)){
                     case CCP_CAPTURE_MODE_EVERY_1_FALLING_EDGE : CCP1_SET_MODE(CCP_CAPTURE_MODE_EVERY_1_FALLING_EDGE); 
                         break;
                     case CCP_CAPTURE_MODE_EVERY_1_RISING_EDGE : CCP1_SET_MODE(CCP_CAPTURE_MODE_EVERY_1_RISING_EDGE); 
@@ -104,7 +210,7 @@ Std_ReturnType CCP_Init(const ccp_t * _ccp_obj){
                 }
             }
             else{
-                switch(_ccp_obj->ccp_mode_variant){
+                switch(CCP_OBJ_VARIANT(_ccp_obj)){
                     case CCP_CAPTURE_MODE_EVERY_1_FALLING_EDGE : CCP2_SET_MODE(CCP_CAPTURE_MODE_EVERY_1_FALLING_EDGE); 
                         break;
                     case CCP_CAPTURE_MODE_EVERY_1_RISING_EDGE : CCP2_SET_MODE(CCP_CAPTURE_MODE_EVERY_1_RISING_EDGE); 
@@ -121,9 +227,9 @@ Std_ReturnType CCP_Init(const ccp_t * _ccp_obj){
 #endif
         }        
         /* CCP Initialize Compare Mode */
-        else if(CCP_COMPARE_MODE_SELECTED == _ccp_obj->ccp_mode){
-            if(CCP1_INST == _ccp_obj->ccp_inst){
-                switch(_ccp_obj->ccp_mode_variant){
+        else if(CCP_COMPARE_MODE_SELECTED == CCP_OBJ_MODE(_ccp_obj)){
+            if(CCP1_INST == CCP_OBJ_INST(_ccp_obj)){
+                switch(CCP_OBJ_VARIANT(_ccp_obj)){
                     case CCP_COMPARE_MODE_TOGGLE_ON_MATCH : CCP1_SET_MODE(CCP_COMPARE_MODE_TOGGLE_ON_MATCH); 
                         break;
                     case CCP_COMPARE_MODE_SET_PIN_LOW : CCP1_SET_MODE(CCP_COMPARE_MODE_SET_PIN_LOW); 
@@ -138,7 +244,7 @@ Std_ReturnType CCP_Init(const ccp_t * _ccp_obj){
                 }
             }
             else{
-                switch(_ccp_obj->ccp_mode_variant){
+                switch(CCP_OBJ_VARIANT(_ccp_obj)){
                     case CCP_COMPARE_MODE_TOGGLE_ON_MATCH : CCP2_SET_MODE(CCP_COMPARE_MODE_TOGGLE_ON_MATCH); 
                         break;
                     case CCP_COMPARE_MODE_SET_PIN_LOW : CCP2_SET_MODE(CCP_COMPARE_MODE_SET_PIN_LOW); 
@@ -158,16 +264,16 @@ Std_ReturnType CCP_Init(const ccp_t * _ccp_obj){
         }
         /* CCP Initialize PWM Mode */
 #if (CCP_CFG_PWM_MODE_SELECTED == CCP1_CFG_SELECTED_MODE) || (CCP_CFG_PWM_MODE_SELECTED == CCP2_CFG_SELECTED_MODE)                    
-        else if(CCP_PWM_MODE_SELECTED == _ccp_obj->ccp_mode){
-            if(CCP1_INST == _ccp_obj->ccp_inst){
-                switch(_ccp_obj->ccp_mode_variant){
+        else if(CCP_PWM_MODE_SELECTED == CCP_OBJ_MODE(_ccp_obj)){
+            if(CCP1_INST == CCP_OBJ_INST(_ccp_obj)){
+                switch(CCP_OBJ_VARIANT(_ccp_obj)){
                     case CCP_PWM_MODE : CCP1_SET_MODE(CCP_PWM_MODE);
                         break;
                     default : ret = E_NOT_OK;    
                 }    
             }
             else{
-                switch(_ccp_obj->ccp_mode_variant){
+                switch(CCP_OBJ_VARIANT(_ccp_obj)){
                     case CCP_PWM_MODE : CCP2_SET_MODE(CCP_PWM_MODE);
                         break;
                     default : ret = E_NOT_OK;    
@@ -176,7 +282,7 @@ Std_ReturnType CCP_Init(const ccp_t * _ccp_obj){
         /* PWM Period Register (PR2) Calculation:
         * PR2 = (Fosc / (4 * PWM_Frequency * Prescaler)) - 1
         */            
-            PR2 = (uint8)(_XTAL_FREQ /( (uint32)(_ccp_obj->PWM_Frequency) * (_ccp_obj->timer2_prescaler_division) * 4)) -1 ;
+            PR2 = CCP_OBJ_PWM_PR2(_ccp_obj) ;
         } 
 #endif
         else{
@@ -184,44 +290,23 @@ Std_ReturnType CCP_Init(const ccp_t * _ccp_obj){
         }
         /* Interrupt Configuration */
 #if (CCP1_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE)
-        if(CCP1_INST == _ccp_obj->ccp_inst){
+        if(CCP1_INST == CCP_OBJ_INST(_ccp_obj)){
             CCP1_INTERRUPT_ENABLE();
             CCP1_INTERRUPT_CLEAR_FLAG();
             CCP1_InterruptHandler = _ccp_obj->CCP_InterruptHandler;
         }
 #endif        
 #if (CCP2_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE)        
-        if(CCP2_INST == _ccp_obj->ccp_inst){
+        if(CCP2_INST == CCP_OBJ_INST(_ccp_obj)){
             CCP2_INTERRUPT_ENABLE();
             CCP2_INTERRUPT_CLEAR_FLAG();
             CCP2_InterruptHandler = _ccp_obj->CCP_InterruptHandler;
         }
-#if INTERRUPT_PRIORITY_LEVELS_ENABLE == INTERRUPT_FEATURE_ENABLE
-        INTERRUPT_PriorityFeatureEnable();
-        if( Interrupt_High_Priority == _ccp_obj->priority ){
-            if(CCP1_INST == _ccp_obj->ccp_inst){
-                CCP1_INTERRUPT_HIGH_PRIORITY();
-            }
-            else{
-                CCP2_INTERRUPT_HIGH_PRIORITY();
-            }
-            INTERRUPT_GlobalInterruptHighEnable();
-        }
-        else{
-            if(CCP1_INST == _ccp_obj->ccp_inst){
-                CCP1_INTERRUPT_LOW_PRIORITY();
-            }
-            else{
-                CCP2_INTERRUPT_LOW_PRIORITY();
-            }
-            INTERRUPT_GlobalInterruptLowEnable();
-        }
-#else
-        INTERRUPT_GlobalInterruptEnable();
-        INTERRUPT_PeripheralInterruptEnable();
-#endif        
 #endif    
-        
+        if((E_OK == ret) && (CCP2_INST >= CCP_OBJ_INST(_ccp_obj))){
+            ccp_init_obj[CCP_OBJ_INST(_ccp_obj)] = _ccp_obj;
+        }
+        else{ /* Nothing */ }
     }
     return ret;
 }
@@ -233,14 +318,16 @@ Std_ReturnType CCP_Init(const ccp_t * _ccp_obj){
             ret = E_NOT_OK;
         }
         else{
-            if(CCP1_INST == _ccp_obj->ccp_inst){
+            if(CCP1_INST == CCP_OBJ_INST(_ccp_obj)){
                 CCP1_SET_MODE(CCP_MODULE_DISABLED);
+                ccp_init_obj[CCP1_INST] = NULL;
 #if  CCP1_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
             CCP1_INTERRUPT_DISABLE();
 #endif                      
             }
             else{
                 CCP2_SET_MODE(CCP_MODULE_DISABLED);
+                ccp_init_obj[CCP2_INST] = NULL;
 #if  CCP2_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
             CCP2_INTERRUPT_DISABLE();
 #endif                 
@@ -253,29 +340,83 @@ Std_ReturnType CCP_Init(const ccp_t * _ccp_obj){
 /* Refer to CCP.h for function documentation */ 
     Std_ReturnType CCP_PWM_Set_Duty(const ccp_t * _ccp_obj , const uint8 _duty){
         Std_ReturnType ret = E_OK;
-        uint16 l_duty_temp = PR2;
+        uint16 l_duty_temp = ZERO_INIT;
+
+        if((NULL == _ccp_obj) || (CCP_PWM_DUTY_PERCENT_MAX < _duty)){
+            ret = E_NOT_OK;
+        }
+        else{
+            l_duty_temp = (uint16)(((uint32)_duty * (((uint16)PR2 + 1) << 2)) / CCP_PWM_DUTY_PERCENT_MAX);
+            ret = CCP_PWM_WRITE_DUTY(_ccp_obj , l_duty_temp);
+            GPIO_MARKER_HIT(PWM);
+        }
+        return ret;
+    }
+/* Refer to CCP.h for function documentation */ 
+    Std_ReturnType CCP_PWM_Set_Duty_Permille(const ccp_t * _ccp_obj , const uint16 _permille){
+        Std_ReturnType ret = E_OK;
+        uint16 l_duty_temp = ZERO_INIT;
 
-        l_duty_temp = (uint16)(4 * (_duty/100.0)*(PR2+1));
-        if(CCP1_INST == _ccp_obj->ccp_inst){
-            CCP1CONbits.DC1B = (l_duty_temp & 0x003);
-            CCPR1L = (uint8)(l_duty_temp >> 2);            
+        if((NULL == _ccp_obj) || (CCP_PWM_DUTY_PERMILLE_MAX < _permille)){
+            ret = E_NOT_OK;
         }
-        else if(CCP2_INST == _ccp_obj->ccp_inst){
-            CCP2CONbits.DC2B = (l_duty_temp & 0x003);
-            CCPR2L = (uint8)(l_duty_temp >> 2);
+        else{
+            l_duty_temp = (uint16)(((uint32)_permille * (((uint16)PR2 + 1) << 2)) / CCP_PWM_DUTY_PERMILLE_MAX);
+            ret = CCP_PWM_WRITE_DUTY(_ccp_obj , l_duty_temp);
+        }
+        return ret;
+    }
+/* Refer to CCP.h for function documentation */ 
+    Std_ReturnType CCP_PWM_Set_Duty_Raw(const ccp_t * _ccp_obj , const uint16 _duty_raw){
+        Std_ReturnType ret = E_OK;
+
+        if((NULL == _ccp_obj) || (CCP_PWM_DUTY_RAW_MAX < _duty_raw)){
+            ret = E_NOT_OK;
         }
         else{
+            ret = CCP_PWM_WRITE_DUTY(_ccp_obj , _duty_raw);
+        }
+        return ret;
+    }
+/* Refer to CCP.h for function documentation */ 
+    Std_ReturnType CCP_PWM_Set_Duty_Synced(const ccp_t * _ccp_obj , const uint16 _duty_raw){
+        Std_ReturnType ret = E_OK;
+        uint8 l_gie = ZERO_INIT;
+        uint8 l_guard = ZERO_INIT;
+
+        if((NULL == _ccp_obj) || (CCP_PWM_DUTY_RAW_MAX < _duty_raw) || (TIMER2_DISABLE_CFG == T2CONbits.TMR2ON)){
+            /* A stopped TMR2 never reaches PR2 , the wait would not end */
             ret = E_NOT_OK;
         }
+        else{
+            /* Guard in TMR2 counts : one count per 1 , 4 or 16 instruction cycles */
+            switch(T2CONbits.T2CKPS){
+                case timer2_prescaler_div_1 : l_guard = CCP_PWM_SYNC_GUARD_CYCLES;
+                    break;
+                case timer2_prescaler_div_4 : l_guard = (uint8)((CCP_PWM_SYNC_GUARD_CYCLES + 3U) >> 2);
+                    break;
+                default : l_guard = (uint8)((CCP_PWM_SYNC_GUARD_CYCLES + 15U) >> 4);   /* T2CKPS = 1x */
+                    break;
+            }
+            if(l_guard < PR2){
+                /* Stay clear of the latch at TMR2 = PR2 */
+                while(TMR2 >= (uint8)(PR2 - l_guard)){ /* Wait */ }
+            }
+            else{ /* Period shorter than the guard , no safe window */ }
+            l_gie = INTCONbits.GIE;
+            INTCONbits.GIE = 0;
+            ret = CCP_PWM_WRITE_DUTY(_ccp_obj , _duty_raw);
+            INTCONbits.GIE = l_gie;
+        }
         return ret;
     }
 /* Refer to CCP.h for function documentation */ 
     Std_ReturnType CCP_PWM_Start(const ccp_t * _ccp_obj){
         Std_ReturnType ret = E_OK;
-        if(CCP1_INST == _ccp_obj->ccp_inst){
+        if(CCP1_INST == CCP_OBJ_INST(_ccp_obj)){
             CCP1_SET_MODE(CCP_PWM_MODE);            
         }
-        else if(CCP2_INST == _ccp_obj->ccp_inst){
+        else if(CCP2_INST == CCP_OBJ_INST(_ccp_obj)){
             CCP2_SET_MODE(CCP_PWM_MODE);
         }
         else{
@@ -286,10 +427,10 @@ Std_ReturnType CCP_Init(const ccp_t * _ccp_obj){
 /* Refer to CCP.h for function documentation */     
     Std_ReturnType CCP_PWM_Stop(const ccp_t * _ccp_obj){
         Std_ReturnType ret = E_OK;
-        if(CCP1_INST == _ccp_obj->ccp_inst){
+        if(CCP1_INST == CCP_OBJ_INST(_ccp_obj)){
             CCP1_SET_MODE(CCP_MODULE_DISABLED);            
         }
-        else if(CCP2_INST == _ccp_obj->ccp_inst){
+        else if(CCP2_INST == CCP_OBJ_INST(_ccp_obj)){
             CCP2_SET_MODE(CCP_MODULE_DISABLED);
         }
         else{
@@ -297,6 +438,83 @@ Std_ReturnType CCP_Init(const ccp_t * _ccp_obj){
         }        
         return ret;
     }
+
+/* Refer to CCP.h for function documentation */
+    Std_ReturnType CCP_PWM_Set_Frequency(const uint32 _frequency , uint8 * _resolution_bits){
+        Std_ReturnType ret = E_OK;
+        uint8 l_pr2 = ZERO_INIT;
+
+        if((CCP_PWM_FREQUENCY_MIN > _frequency) || (CCP_PWM_FREQUENCY_MAX < _frequency)){
+            ret = E_NOT_OK;
+        }
+        else{
+            l_pr2 = CCP_PWM_PR2(_frequency);
+            PR2 = l_pr2;
+            T2CONbits.T2CKPS = CCP_PWM_PRESCALER_CFG(_frequency);
+            if(NULL != _resolution_bits){
+                *_resolution_bits = CCP_PWM_RESOLUTION_BITS(l_pr2);
+            }
+            else{ /* Nothing */ }
+        }
+        return ret;
+    }
+/* Refer to CCP.h for function documentation */
+    Std_ReturnType CCP_PWM_Get_Frequency(uint32 * _frequency , uint8 * _resolution_bits){
+        Std_ReturnType ret = E_OK;
+        uint8 l_pr2 = PR2;
+        uint32 l_prescaler = ZERO_INIT;
+
+        if(NULL == _frequency){
+            ret = E_NOT_OK;
+        }
+        else{
+            switch(T2CONbits.T2CKPS){
+                case timer2_prescaler_div_1 : l_prescaler = 1UL;
+                    break;
+                case timer2_prescaler_div_4 : l_prescaler = 4UL;
+                    break;
+                default : l_prescaler = 16UL;   /* T2CKPS = 1x */
+                    break;
+            }
+            *_frequency = (uint32)_XTAL_FREQ / (4UL * l_prescaler * ((uint32)l_pr2 + 1UL));
+            if(NULL != _resolution_bits){
+                *_resolution_bits = CCP_PWM_RESOLUTION_BITS(l_pr2);
+            }
+            else{ /* Nothing */ }
+        }
+        return ret;
+    }
+
+/**
+ * @brief  Internal duty register write.
+ *
+ * @details
+ * Splits the 10-bit value into CCPRxL (8 MSBs) and DCxB (2 LSBs).
+ * A value above 4 * (PR2 + 1) keeps the output high for the whole period.
+ *
+ * This function is private to this source file.
+ */
+static Std_ReturnType CCP_PWM_WRITE_DUTY(const ccp_t * _ccp_obj , uint16 _duty_raw){
+    Std_ReturnType ret = E_OK;
+
+    if(CCP_PWM_DUTY_RAW_MAX < _duty_raw){
+        /* 100 % with PR2 = 0xFF is 1024 , one count above the register */
+        _duty_raw = CCP_PWM_DUTY_RAW_MAX;
+    }
+    else{ /* Nothing */ }
+    if(CCP1_INST == CCP_OBJ_INST(_ccp_obj)){
+        CCP1CONbits.DC1B = (_duty_raw & 0x003);
+        CCPR1L = (uint8)(_duty_raw >> 2);
+    }
+    else if(CCP2_INST == CCP_OBJ_INST(_ccp_obj)){
+        CCP2CONbits.DC2B = (_duty_raw & 0x003);
+        CCPR2L = (uint8)(_duty_raw >> 2);
+    }
+    else{
+        ret = E_NOT_OK;
+    }
+    return ret;
+}
     
 #endif    
     
@@ -308,19 +526,19 @@ Std_ReturnType CCP_Init(const ccp_t * _ccp_obj){
             ret = E_NOT_OK;
         }
         else{
-            if(CCP1_INST == _ccp_obj->ccp_inst){
+            if(CCP1_INST == CCP_OBJ_INST(_ccp_obj)){
                 if(CCP_CAPTURE_READY == PIR1bits.CCP1IF ){
                     *_capture_status = CCP_CAPTURE_READY;
-                    CCP1_INTERRUPT_CLEAR_FLAG();
+                    PIR1bits.CCP1IF = 0;
                 }
                 else{
                     *_capture_status = CCP_CAPTURE_NOT_READY;
                 }
             }
-            else if(CCP2_INST == _ccp_obj->ccp_inst){
+            else if(CCP2_INST == CCP_OBJ_INST(_ccp_obj)){
                 if(CCP_CAPTURE_READY == PIR2bits.CCP2IF ){
                     *_capture_status = CCP_CAPTURE_READY;
-                    CCP2_INTERRUPT_CLEAR_FLAG();
+                    PIR2bits.CCP2IF = 0;
                 }
                 else{
                     *_capture_status = CCP_CAPTURE_NOT_READY;
@@ -338,12 +556,12 @@ Std_ReturnType CCP_Init(const ccp_t * _ccp_obj){
             ret = E_NOT_OK;
         }
         else{
-            if(CCP1_INST == _ccp_obj->ccp_inst){
+            if(CCP1_INST == CCP_OBJ_INST(_ccp_obj)){
                 capture_temp_val.ccpr_low = CCPR1L;
                 capture_temp_val.ccpr_high = CCPR1H;
                 *capture_value = capture_temp_val.ccpr_16Bit ;
             }
-            else if(CCP2_INST == _ccp_obj->ccp_inst){
+            else if(CCP2_INST == CCP_OBJ_INST(_ccp_obj)){
                 capture_temp_val.ccpr_low = CCPR2L;
                 capture_temp_val.ccpr_high = CCPR2H;
                 *capture_value = capture_temp_val.ccpr_16Bit ;
@@ -355,6 +573,286 @@ Std_ReturnType CCP_Init(const ccp_t * _ccp_obj){
     
 #endif
 
+#if (CCP1_CAPTURE_ENGINE_ENABLE == 0X01) || (CCP2_CAPTURE_ENGINE_ENABLE == 0X01)
+/* Refer to CCP.h for function documentation */
+    Std_ReturnType CCP_Capture_Engine_Start(const ccp_t * _ccp_obj , ccp_capture_measure_t _measure ,
+                                            uint8 _pulses_per_revolution){
+        Std_ReturnType ret = E_OK;
+        uint8 l_gie = ZERO_INIT;
+        volatile ccp_capture_engine_t *l_engine = NULL;
+
+        if((NULL == _ccp_obj) || (ZERO_INIT == _pulses_per_revolution) ||
+           (CCP_CAPTURE_MEASURE_PERIOD_DUTY < _measure) || (CCP2_INST < CCP_OBJ_INST(_ccp_obj))){
+            ret = E_NOT_OK;
+        }
+        else if(((CCP1_INST == CCP_OBJ_INST(_ccp_obj)) && (CCP1_CAPTURE_ENGINE_ENABLE != 0X01)) ||
+                ((CCP2_INST == CCP_OBJ_INST(_ccp_obj)) && (CCP2_CAPTURE_ENGINE_ENABLE != 0X01))){
+            ret = E_NOT_OK;
+        }
+        else{
+            l_engine = &ccp_capture_engine[CCP_OBJ_INST(_ccp_obj)];
+            l_gie = INTCONbits.GIE;
+            INTCONbits.GIE = 0;
+            l_engine->last_rise = ZERO_INIT;
+            l_engine->period_sum = ZERO_INIT;
+            l_engine->high_sum = ZERO_INIT;
+            l_engine->period_avg = ZERO_INIT;
+            l_engine->high_avg = ZERO_INIT;
+            l_engine->idle_overflows = ZERO_INIT;
+            l_engine->edge_count = ZERO_INIT;
+            l_engine->pulses_per_revolution = _pulses_per_revolution;
+            l_engine->measure = _measure;
+            l_engine->rise_seen = 0;
+            l_engine->wait_falling = 0;
+            /* Timer routing , see CCP_CAPTURE_COMPARE_TIMERS_CFG_SET */
+            if((CCP_CAPTURE_COMPARE_TMR3 == CCP_OBJ_TMR13(_ccp_obj)) ||
+               ((CCP2_CAP_COM_TMR3_CCP1_CAP_COM_TMR1 == CCP_OBJ_TMR13(_ccp_obj)) && (CCP2_INST == CCP_OBJ_INST(_ccp_obj)))){
+                l_engine->timer = CCP_CAPTURE_TIMER3;
+            }
+            else{
+                l_engine->timer = CCP_CAPTURE_TIMER1;
+            }
+            l_engine->active = 1;
+            CCP_CAPTURE_SET_EDGE(CCP_OBJ_INST(_ccp_obj) , CCP_CAPTURE_MODE_EVERY_1_RISING_EDGE);
+            INTCONbits.GIE = l_gie;
+        }
+        return ret;
+    }
+/* Refer to CCP.h for function documentation */
+    Std_ReturnType CCP_Capture_Engine_Stop(const ccp_t * _ccp_obj){
+        Std_ReturnType ret = E_OK;
+
+        if((NULL == _ccp_obj) || (CCP2_INST < CCP_OBJ_INST(_ccp_obj))){
+            ret = E_NOT_OK;
+        }
+        else{
+            ccp_capture_engine[CCP_OBJ_INST(_ccp_obj)].active = 0;
+        }
+        return ret;
+    }
+/* Refer to CCP.h for function documentation */
+    Std_ReturnType CCP_Capture_Get_Period(const ccp_t * _ccp_obj , uint32 * _period){
+        Std_ReturnType ret = E_OK;
+        ccp_capture_engine_t l_engine;
+
+        if(NULL == _period){
+            ret = E_NOT_OK;
+        }
+        else{
+            ret = CCP_CAPTURE_SNAPSHOT(_ccp_obj , &l_engine);
+            *_period = (E_OK == ret) ? l_engine.period_avg : ZERO_INIT;
+        }
+        return ret;
+    }
+/* Refer to CCP.h for function documentation */
+    Std_ReturnType CCP_Capture_Get_Duty_Permille(const ccp_t * _ccp_obj , uint16 * _permille){
+        Std_ReturnType ret = E_OK;
+        ccp_capture_engine_t l_engine;
+        uint32 l_permille = ZERO_INIT;
+
+        if(NULL == _permille){
+            ret = E_NOT_OK;
+        }
+        else{
+            ret = CCP_CAPTURE_SNAPSHOT(_ccp_obj , &l_engine);
+            if((E_OK == ret) && (ZERO_INIT != l_engine.period_avg)){
+                /* Both below CCP_CAPTURE_STALL_OVERFLOWS * 2^16 , no overflow */
+                l_permille = (l_engine.high_avg * CCP_PWM_DUTY_PERMILLE_MAX) / l_engine.period_avg;
+                *_permille = (uint16)((CCP_PWM_DUTY_PERMILLE_MAX < l_permille) ? CCP_PWM_DUTY_PERMILLE_MAX : l_permille);
+            }
+            else{
+                *_permille = ZERO_INIT;
+            }
+        }
+        return ret;
+    }
+/* Refer to CCP.h for function documentation */
+    Std_ReturnType CCP_Capture_Get_Rpm(const ccp_t * _ccp_obj , uint16 * _rpm){
+        Std_ReturnType ret = E_OK;
+        ccp_capture_engine_t l_engine;
+        uint32 l_tick_rate = ZERO_INIT;
+        uint32 l_rpm = ZERO_INIT;
+
+        if(NULL == _rpm){
+            ret = E_NOT_OK;
+        }
+        else{
+            ret = CCP_CAPTURE_SNAPSHOT(_ccp_obj , &l_engine);
+            if((E_OK == ret) && (ZERO_INIT != l_engine.period_avg)){
+                l_tick_rate = ((uint32)_XTAL_FREQ / 4UL) >>
+                              ((CCP_CAPTURE_TIMER3 == l_engine.timer) ? T3CONbits.T3CKPS : T1CONbits.T1CKPS);
+                l_rpm = (60UL * l_tick_rate) / (l_engine.period_avg * l_engine.pulses_per_revolution);
+                *_rpm = (uint16)((0xFFFFUL < l_rpm) ? 0xFFFFUL : l_rpm);
+            }
+            else{
+                *_rpm = ZERO_INIT;
+            }
+        }
+        return ret;
+    }
+
+#if (CCP1_CAPTURE_ENGINE_ENABLE == 0X01)
+/* Refer to CCP.h for function documentation */
+    void CCP1_Capture_Timer_Overflow(void){
+        CCP_CAPTURE_ENGINE_OVERFLOW(CCP1_INST);
+    }
+#endif
+
+#if (CCP2_CAPTURE_ENGINE_ENABLE == 0X01)
+/* Refer to CCP.h for function documentation */
+    void CCP2_Capture_Timer_Overflow(void){
+        CCP_CAPTURE_ENGINE_OVERFLOW(CCP2_INST);
+    }
+#endif
+
+/**
+ * @brief  Internal edge handler of the capture engine.
+ *
+ * @details
+ * A capture just after an overflow whose timer interrupt has not run yet
+ * still sees the old overflow count : with the timer flag set and a
+ * small capture value , the pending overflow is added here.
+ *
+ * This function is private to this source file.
+ */
+static void CCP_CAPTURE_ENGINE_EDGE(ccp_inst_t _inst , uint16 _capture){
+    volatile ccp_capture_engine_t *l_engine = &ccp_capture_engine[_inst];
+    uint16 l_high_word = l_engine->overflows;
+    uint8 l_pending = ZERO_INIT;
+    uint32 l_time = ZERO_INIT;
+
+    l_pending = (CCP_CAPTURE_TIMER3 == l_engine->timer) ? PIR2bits.TMR3IF : PIR1bits.TMR1IF;
+    if((l_pending) && (0x8000U > _capture)){
+        l_high_word++;
+    }
+    else{ /* Nothing */ }
+    l_time = ((uint32)l_high_word << 16) | _capture;
+    l_engine->idle_overflows = ZERO_INIT;
+
+    if(l_engine->wait_falling){
+        l_engine->high_sum += l_time - l_engine->last_rise;
+        l_engine->wait_falling = 0;
+        CCP_CAPTURE_SET_EDGE(_inst , CCP_CAPTURE_MODE_EVERY_1_RISING_EDGE);
+    }
+    else{
+        if(l_engine->rise_seen){
+            l_engine->period_sum += l_time - l_engine->last_rise;
+            l_engine->edge_count++;
+            if((1U << CCP_CAPTURE_AVERAGE_LOG2) <= l_engine->edge_count){
+                l_engine->period_avg = l_engine->period_sum >> CCP_CAPTURE_AVERAGE_LOG2;
+                l_engine->high_avg = l_engine->high_sum >> CCP_CAPTURE_AVERAGE_LOG2;
+                l_engine->period_sum = ZERO_INIT;
+                l_engine->high_sum = ZERO_INIT;
+                l_engine->edge_count = ZERO_INIT;
+            }
+            else{ /* Nothing */ }
+        }
+        else{
+            /* First edge , only a reference */
+            l_engine->rise_seen = 1;
+        }
+        l_engine->last_rise = l_time;
+        if(CCP_CAPTURE_MEASURE_PERIOD_DUTY == l_engine->measure){
+            l_engine->wait_falling = 1;
+            CCP_CAPTURE_SET_EDGE(_inst , CCP_CAPTURE_MODE_EVERY_1_FALLING_EDGE);
+        }
+        else{ /* Nothing */ }
+    }
+}
+
+/**
+ * @brief  Internal overflow handler of the capture engine.
+ *
+ * @details
+ * After CCP_CAPTURE_STALL_OVERFLOWS overflows with no edge the values
+ * are cleared and the next edge starts a new measurement.
+ *
+ * This function is private to this source file.
+ */
+static void CCP_CAPTURE_ENGINE_OVERFLOW(ccp_inst_t _inst){
+    volatile ccp_capture_engine_t *l_engine = &ccp_capture_engine[_inst];
+
+    l_engine->overflows++;
+    if((l_engine->active) && (CCP_CAPTURE_STALL_OVERFLOWS > l_engine->idle_overflows)){
+        l_engine->idle_overflows++;
+        if(CCP_CAPTURE_STALL_OVERFLOWS == l_engine->idle_overflows){
+            l_engine->period_sum = ZERO_INIT;
+            l_engine->high_sum = ZERO_INIT;
+            l_engine->period_avg = ZERO_INIT;
+            l_engine->high_avg = ZERO_INIT;
+            l_engine->edge_count = ZERO_INIT;
+            l_engine->rise_seen = 0;
+            if(l_engine->wait_falling){
+                l_engine->wait_falling = 0;
+                CCP_CAPTURE_SET_EDGE(_inst , CCP_CAPTURE_MODE_EVERY_1_RISING_EDGE);
+            }
+            else{ /* Nothing */ }
+        }
+        else{ /* Nothing */ }
+    }
+    else{ /* Nothing */ }
+}
+
+/**
+ * @brief  Internal capture edge selection.
+ *
+ * @details
+ * A mode change may set CCPxIF : the interrupt is masked during the
+ * change and the flag cleared after it.
+ *
+ * This function is private to this source file.
+ */
+static void CCP_CAPTURE_SET_EDGE(ccp_inst_t _inst , uint8 _mode){
+#if (CCP1_CAPTURE_ENGINE_ENABLE == 0X01)
+    if(CCP1_INST == _inst){
+        CCP1_INTERRUPT_DISABLE();
+        CCP1_SET_MODE(_mode);
+        CCP1_INTERRUPT_CLEAR_FLAG();
+        CCP1_INTERRUPT_ENABLE();
+    }
+    else{ /* Nothing */ }
+#endif
+#if (CCP2_CAPTURE_ENGINE_ENABLE == 0X01)
+    if(CCP2_INST == _inst){
+        CCP2_INTERRUPT_DISABLE();
+        CCP2_SET_MODE(_mode);
+        CCP2_INTERRUPT_CLEAR_FLAG();
+        CCP2_INTERRUPT_ENABLE();
+    }
+    else{ /* Nothing */ }
+#endif
+}
+
+/**
+ * @brief  Internal engine state copy.
+ *
+ * @details
+ * The 32-bit values are written by the CCP and timer ISRs , they are
+ * copied with those two sources masked so the caller never sees a torn
+ * value , the other interrupts keep running.
+ *
+ * This function is private to this source file.
+ */
+static Std_ReturnType CCP_CAPTURE_SNAPSHOT(const ccp_t * _ccp_obj , ccp_capture_engine_t * _copy){
+    Std_ReturnType ret = E_OK;
+    interrupt_critical_t l_section;
+    uint32 l_sources = ZERO_INIT;
+
+    if((NULL == _ccp_obj) || (CCP2_INST < CCP_OBJ_INST(_ccp_obj))){
+        ret = E_NOT_OK;
+    }
+    else{
+        l_sources = (CCP1_INST == CCP_OBJ_INST(_ccp_obj)) ? INTERRUPT_CRITICAL_CCP1 : INTERRUPT_CRITICAL_CCP2;
+        l_sources |= (CCP_CAPTURE_TIMER3 == ccp_capture_engine[CCP_OBJ_INST(_ccp_obj)].timer) ?
+                     INTERRUPT_CRITICAL_TMR3 : INTERRUPT_CRITICAL_TMR1;
+        ret = Interrupt_Critical_Enter(&l_section , l_sources);
+        *_copy = ccp_capture_engine[CCP_OBJ_INST(_ccp_obj)];
+        ret &= Interrupt_Critical_Exit(&l_section);
+    }
+    return ret;
+}
+#endif
+
 #if (CCP_CFG_COMPARE_MODE_SELECTED == CCP1_CFG_SELECTED_MODE) || (CCP_CFG_COMPARE_MODE_SELECTED == CCP2_CFG_SELECTED_MODE)
 /* Refer to CCP.h for function documentation */     
     Std_ReturnType CCP_IsCompareComplete(const ccp_t * _ccp_obj , uint8 * _compare_status){
@@ -363,19 +861,19 @@ Std_ReturnType CCP_Init(const ccp_t * _ccp_obj){
             ret = E_NOT_OK;
         }
         else{
-            if(CCP1_INST == _ccp_obj->ccp_inst){
+            if(CCP1_INST == CCP_OBJ_INST(_ccp_obj)){
                 if(CCP_COMPARE_READY == PIR1bits.CCP1IF ){
                     *_compare_status = CCP_COMPARE_READY;
-                    CCP1_INTERRUPT_CLEAR_FLAG();
+                    PIR1bits.CCP1IF = 0;
                 }
                 else{
                     *_compare_status = CCP_COMPARE_NOT_READY;
                 }
             }
-            else if(CCP2_INST == _ccp_obj->ccp_inst){
+            else if(CCP2_INST == CCP_OBJ_INST(_ccp_obj)){
                 if(CCP_COMPARE_READY == PIR2bits.CCP2IF ){
                     *_compare_status = CCP_COMPARE_READY;
-                    CCP2_INTERRUPT_CLEAR_FLAG();
+                    PIR2bits.CCP2IF = 0;
                 }
                 else{
                     *_compare_status = CCP_COMPARE_NOT_READY;
@@ -390,11 +888,11 @@ Std_ReturnType CCP_Init(const ccp_t * _ccp_obj){
         Std_ReturnType ret = E_OK;
         CCP_REG_T compare_temp_val;
         compare_temp_val.ccpr_16Bit = compare_value;
-        if(CCP1_INST == _ccp_obj->ccp_inst){
+        if(CCP1_INST == CCP_OBJ_INST(_ccp_obj)){
             CCPR1L = compare_temp_val.ccpr_low;
             CCPR1H = compare_temp_val.ccpr_high;
         }
-        else if(CCP2_INST == _ccp_obj->ccp_inst){
+        else if(CCP2_INST == CCP_OBJ_INST(_ccp_obj)){
             CCPR2L = compare_temp_val.ccpr_low;
             CCPR2H = compare_temp_val.ccpr_high;
         }
@@ -405,6 +903,18 @@ Std_ReturnType CCP_Init(const ccp_t * _ccp_obj){
 #endif
 
     
+static uint8 CCP_INIT_IS_ACTIVE(const ccp_t * _ccp_obj){
+    uint8 l_active = 0;
+    if((CCP1_INST == CCP_OBJ_INST(_ccp_obj)) && (ccp_init_obj[CCP1_INST] == _ccp_obj)){
+        l_active = (uint8)(CCP_MODULE_DISABLED != CCP1CONbits.CCP1M);
+    }
+    else if((CCP2_INST == CCP_OBJ_INST(_ccp_obj)) && (ccp_init_obj[CCP2_INST] == _ccp_obj)){
+        l_active = (uint8)(CCP_MODULE_DISABLED != CCP2CONbits.CCP2M);
+    }
+    else{ /* Nothing */ }
+    return l_active;
+}
+
 #if (CCP_CFG_CAPTURE_MODE_SELECTED == CCP1_CFG_SELECTED_MODE) || (CCP_CFG_CAPTURE_MODE_SELECTED == CCP2_CFG_SELECTED_MODE) || (CCP_CFG_COMPARE_MODE_SELECTED == CCP1_CFG_SELECTED_MODE) || (CCP_CFG_COMPARE_MODE_SELECTED == CCP2_CFG_SELECTED_MODE)
 /**
  * @brief  Internal timer routing configuration.
@@ -422,7 +932,7 @@ Std_ReturnType CCP_Init(const ccp_t * _ccp_obj){
  * This function is private to this source file.
  */    
 static void CCP_CAPTURE_COMPARE_TIMERS_CFG_SET(const ccp_t * _ccp_obj){ 
-    switch(_ccp_obj->tmr13_cfg){
+    switch(CCP_OBJ_TMR13(_ccp_obj)){
         case CCP_CAPTURE_COMPARE_TMR1 : T3CONbits.T3CCP1 = 0 ; T3CONbits.T3CCP2 = 0 ;
             break;
         case CCP2_CAP_COM_TMR3_CCP1_CAP_COM_TMR1 : T3CONbits.T3CCP1 = 1 ; T3CONbits.T3CCP2 = 0 ;
@@ -452,6 +962,12 @@ static void CCP_CAPTURE_COMPARE_TIMERS_CFG_SET(const ccp_t * _ccp_obj){
  */
 void CCP1_ISR(void){
     CCP1_INTERRUPT_CLEAR_FLAG();
+#if (CCP1_CAPTURE_ENGINE_ENABLE == 0X01)
+    if(ccp_capture_engine[CCP1_INST].active){
+        CCP_CAPTURE_ENGINE_EDGE(CCP1_INST , (uint16)(((uint16)CCPR1H << 8) | CCPR1L));
+    }
+    else{ /* Nothing */ }
+#endif
     if(CCP1_InterruptHandler){
         CCP1_InterruptHandler();
     }
@@ -471,6 +987,12 @@ void CCP1_ISR(void){
  */
 void CCP2_ISR(void){
     CCP2_INTERRUPT_CLEAR_FLAG();
+#if (CCP2_CAPTURE_ENGINE_ENABLE == 0X01)
+    if(ccp_capture_engine[CCP2_INST].active){
+        CCP_CAPTURE_ENGINE_EDGE(CCP2_INST , (uint16)(((uint16)CCPR2H << 8) | CCPR2L));
+    }
+    else{ /* Nothing */ }
+#endif
     if(CCP2_InterruptHandler){
         CCP2_InterruptHandler();
     }
@@ -56,6 +56,8 @@
 #define CCP_COMPARE_MODE_SET_PIN_LOW           ((uint8)0X08)
 #define CCP_COMPARE_MODE_SET_PIN_HIGH          ((uint8)0X09)
 #define CCP_COMPARE_MODE_GEN_SW_INTERRUPT      ((uint8)0X0A)
+/* Special event trigger : resets the compare timer on match , CCP2 also
+ * starts an A/D conversion (see ADC_Triggered_Start in hal_adc.h) */
 #define CCP_COMPARE_MODE_GEN_EVENT             ((uint8)0X0B)
 #define CCP_PWM_MODE                           ((uint8)0X0C)
 
@@ -67,6 +69,49 @@
 #define CCP_COMPARE_NOT_READY  0X00
 #define CCP_COMPARE_READY      0X01
 
+/* PWM duty : raw 10-bit register value (CCPRxL:DCxB) , percent , permille */
+#define CCP_PWM_DUTY_RAW_MAX           ((uint16)0x3FF)
+#define CCP_PWM_DUTY_PERCENT_MAX       ((uint8)100)
+#define CCP_PWM_DUTY_PERMILLE_MAX      ((uint16)1000)
+
+/* Synced duty update : instruction cycles before the period match (PR2) in
+ * which the CCPRxL / DCxB writes are held back , longer than the TMR2 test
+ * and the two writes */
+#define CCP_PWM_SYNC_GUARD_CYCLES      ((uint8)32)
+
+/* PWM frequency range : PR2 = 0xFF with prescaler 16 , up to PR2 = 0 with prescaler 1 */
+#define CCP_PWM_FREQUENCY_MIN          ((uint32)_XTAL_FREQ / (4UL * 16UL * 256UL))
+#define CCP_PWM_FREQUENCY_MAX          ((uint32)_XTAL_FREQ / 4UL)
+
+/* Capture engine : one per CCP in capture mode with its interrupt enabled */
+#if (CCP_CFG_CAPTURE_MODE_SELECTED == CCP1_CFG_SELECTED_MODE) && (CCP1_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE)
+#define CCP1_CAPTURE_ENGINE_ENABLE     0X01
+#else
+#define CCP1_CAPTURE_ENGINE_ENABLE     0X00
+#endif
+#if (CCP_CFG_CAPTURE_MODE_SELECTED == CCP2_CFG_SELECTED_MODE) && (CCP2_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE)
+#define CCP2_CAPTURE_ENGINE_ENABLE     0X01
+#else
+#define CCP2_CAPTURE_ENGINE_ENABLE     0X00
+#endif
+
+/* Mode of the statically configured CCP , same values as ccp_mode_t */
+#if CCP_STATIC_CFG_INSTANCE == CCP_STATIC_CFG_CCP1
+#define CCP_STATIC_CFG_SELECTED_MODE   CCP1_CFG_SELECTED_MODE
+#elif CCP_STATIC_CFG_INSTANCE == CCP_STATIC_CFG_CCP2
+#define CCP_STATIC_CFG_SELECTED_MODE   CCP2_CFG_SELECTED_MODE
+#elif CCP_STATIC_CFG_INSTANCE != CCP_STATIC_CFG_DISABLED
+#error "CCP_STATIC_CFG_INSTANCE must be CCP_STATIC_CFG_DISABLED , CCP_STATIC_CFG_CCP1 or CCP_STATIC_CFG_CCP2"
+#endif
+
+/* PR2 + 1 of the static PWM must fit in 1 .. 256 */
+#if (CCP_STATIC_CFG_INSTANCE != CCP_STATIC_CFG_DISABLED) && (CCP_STATIC_CFG_SELECTED_MODE == CCP_CFG_PWM_MODE_SELECTED)
+#if ((_XTAL_FREQ / (4UL * CCP_STATIC_CFG_PWM_FREQUENCY * CCP_STATIC_CFG_TIMER2_PRESCALER)) < 1) || \
+    ((_XTAL_FREQ / (4UL * CCP_STATIC_CFG_PWM_FREQUENCY * CCP_STATIC_CFG_TIMER2_PRESCALER)) > 256)
+#error "CCP_STATIC_CFG_PWM_FREQUENCY out of range for CCP_STATIC_CFG_TIMER2_PRESCALER"
+#endif
+#endif
+
 /* Section : Macro Functions Declarations */
 
 /**
@@ -79,6 +124,41 @@
  */
 #define CCP2_SET_MODE(__CONFIG)                 (CCP2CONbits.CCP2M = __CONFIG)
 
+/**
+ * @brief PWM period / Timer2 setting for a target frequency in Hz.
+ *
+ * @details
+ * Pure constant expressions : with a constant _HZ they fold at compile
+ * time , CCP_PWM_Set_Frequency() evaluates the same formulas at run time.
+ *  - CCP_PWM_PERIOD_TCY      : PWM period in instruction cycles
+ *  - CCP_PWM_PRESCALER       : Smallest Timer2 prescaler (1 / 4 / 16) that fits
+ *                              the period in PR2 , i.e. the best resolution
+ *  - CCP_PWM_PRESCALER_CFG   : The same as a timer2_prescaler_select_t value
+ *  - CCP_PWM_PR2             : PR2 value , rounded to the nearest period
+ *  - CCP_PWM_RESOLUTION_BITS : Duty resolution log2(4 * (PR2 + 1)) , 2..10 bits
+ *
+ * _HZ must be within CCP_PWM_FREQUENCY_MIN .. CCP_PWM_FREQUENCY_MAX.
+ */
+#define CCP_PWM_PERIOD_TCY(_HZ)        ((uint32)_XTAL_FREQ / (4UL * (uint32)(_HZ)))
+#define CCP_PWM_PRESCALER(_HZ)         ((CCP_PWM_PERIOD_TCY(_HZ) <= 256UL) ? 1UL : \
+                                        ((CCP_PWM_PERIOD_TCY(_HZ) <= 1024UL) ? 4UL : 16UL))
+#define CCP_PWM_PRESCALER_CFG(_HZ)     ((CCP_PWM_PERIOD_TCY(_HZ) <= 256UL) ? timer2_prescaler_div_1 : \
+                                        ((CCP_PWM_PERIOD_TCY(_HZ) <= 1024UL) ? timer2_prescaler_div_4 : timer2_prescaler_div_16))
+#define CCP_PWM_PR2(_HZ)               ((uint8)(((CCP_PWM_PERIOD_TCY(_HZ) + (CCP_PWM_PRESCALER(_HZ) >> 1)) \
+                                        / CCP_PWM_PRESCALER(_HZ)) - 1))
+#define CCP_PWM_RESOLUTION_BITS(_PR2)  ((uint8)(((_PR2) >= 127U) ? (((_PR2) >= 255U) ? 10 : 9) : \
+                                        ((_PR2) >= 31U) ? (((_PR2) >= 63U) ? 8 : 7) : \
+                                        ((_PR2) >= 7U) ? (((_PR2) >= 15U) ? 6 : 5) : \
+                                        ((_PR2) >= 1U) ? (((_PR2) >= 3U) ? 4 : 3) : 2))
+
+/**
+ * @brief Writes PR2 and the Timer2 prescaler for a constant frequency.
+ *        Compiles to two register writes , no run time arithmetic.
+ */
+#define CCP_PWM_SET_FREQUENCY(_HZ)     do{ PR2 = CCP_PWM_PR2(_HZ);\
+                                           T2CONbits.T2CKPS = CCP_PWM_PRESCALER_CFG(_HZ);\
+                                       }while(0)
+
 /* Section : Data Types Declarations */
 
 /**
@@ -144,9 +224,6 @@ typedef struct{
     pin_config_t pin;
 #if (INTERRUPT_FEATURE_ENABLE == CCP1_INTERRUPT_FEATURE_ENABLE) || (INTERRUPT_FEATURE_ENABLE == CCP2_INTERRUPT_FEATURE_ENABLE)
     void (* CCP_InterruptHandler)(void);
-#if ( INTERRUPT_FEATURE_ENABLE == INTERRUPT_PRIORITY_LEVELS_ENABLE)
-    INTERRUPT_Priority_cfg priority;
-#endif    
 #endif
     
 #if (CCP_CFG_PWM_MODE_SELECTED == CCP1_CFG_SELECTED_MODE) || (CCP_CFG_PWM_MODE_SELECTED == CCP2_CFG_SELECTED_MODE)
@@ -160,6 +237,16 @@ typedef struct{
     
 }ccp_t;
 
+/**
+ * @brief Capture engine measurement
+ *  - PERIOD      : every rising edge , period (and RPM) only
+ *  - PERIOD_DUTY : rising and falling edges alternately , period and high time
+ */
+typedef enum{
+    CCP_CAPTURE_MEASURE_PERIOD = 0,
+    CCP_CAPTURE_MEASURE_PERIOD_DUTY
+}ccp_capture_measure_t;
+
 
 /* Section : Function Declarations */
 
@@ -176,6 +263,10 @@ typedef struct{
  *  - Configure the CCP I/O pin direction
  *  - Configure interrupt settings (if enabled)
  *
+ * Calling it again with the object that initialized the module , while
+ * the module is still enabled , does nothing : a running PWM or capture
+ * is not restarted. A modified object must go through CCP_DeInit() first.
+ *
  * @param[in] _ccp_obj  Pointer to a valid CCP configuration structure.
  *
  * @return
@@ -212,15 +303,102 @@ typedef struct{
  *
  * The duty cycle value is written to the CCP duty cycle registers
  * (CCPRxL and CCPxCON<5:4>) according to the PWM resolution.
+ * Computed in integer math : raw = _duty * 4 * (PR2 + 1) / 100.
  *
  * @param[in] _ccp_obj  Pointer to a valid CCP configuration structure.
- * @param[in] _duty     Duty cycle value (0?100 percentage).
+ * @param[in] _duty     Duty cycle value (0..100 percentage).
  *
  * @return
  *      E_OK     : Duty cycle updated successfully.
  *      E_NOT_OK : Operation failed due to invalid parameters.
  */    
     Std_ReturnType CCP_PWM_Set_Duty(const ccp_t * _ccp_obj , const uint8 _duty);
+
+/**
+ * @brief  Updates the PWM duty cycle in permille (0.1 % steps).
+ *
+ * @param[in] _ccp_obj  Pointer to a valid CCP configuration structure.
+ * @param[in] _permille Duty cycle value (0..1000).
+ *
+ * @return
+ *      E_OK     : Duty cycle updated successfully.
+ *      E_NOT_OK : Operation failed due to invalid parameters.
+ */
+    Std_ReturnType CCP_PWM_Set_Duty_Permille(const ccp_t * _ccp_obj , const uint16 _permille);
+
+/**
+ * @brief  Writes the raw 10-bit duty cycle register value.
+ *
+ * @details
+ * High time = _duty_raw * Tosc * Timer2 prescaler. 100 % is reached at
+ * 4 * (PR2 + 1) , the full 10-bit resolution needs PR2 = 0xFF.
+ *
+ * @param[in] _ccp_obj  Pointer to a valid CCP configuration structure.
+ * @param[in] _duty_raw Duty cycle value (0..CCP_PWM_DUTY_RAW_MAX).
+ *
+ * @return
+ *      E_OK     : Duty cycle updated successfully.
+ *      E_NOT_OK : Operation failed due to invalid parameters.
+ */
+    Std_ReturnType CCP_PWM_Set_Duty_Raw(const ccp_t * _ccp_obj , const uint16 _duty_raw);
+
+/**
+ * @brief  Writes the raw 10-bit duty cycle away from the period match.
+ *
+ * @details
+ * The duty registers are latched at the TMR2 = PR2 match. The plain
+ * setters may straddle that match and run one period with the new
+ * 2 LSBs and the old 8 MSBs. This one waits while TMR2 is within
+ * CCP_PWM_SYNC_GUARD_CYCLES of PR2 (in TMR2 counts for the running
+ * prescaler , rounded up) , then writes both registers with
+ * interrupts masked , so the next period gets the new duty as a whole.
+ * Meant for speed control loops updating the duty every period.
+ *
+ * @param[in] _ccp_obj  Pointer to a valid CCP configuration structure.
+ * @param[in] _duty_raw Duty cycle value (0..CCP_PWM_DUTY_RAW_MAX).
+ *
+ * @return
+ *      E_OK     : Duty cycle updated successfully.
+ *      E_NOT_OK : Invalid parameters , or Timer2 stopped (TMR2ON = 0).
+ *
+ * @note Waits CCP_PWM_SYNC_GUARD_CYCLES instruction cycles at most. With a
+ *       period no longer than the guard no wait is done.
+ */
+    Std_ReturnType CCP_PWM_Set_Duty_Synced(const ccp_t * _ccp_obj , const uint16 _duty_raw);
+
+/**
+ * @brief  Sets the PWM frequency of both CCP modules.
+ *
+ * @details
+ * Picks the smallest Timer2 prescaler whose PR2 fits the period (best
+ * duty resolution) and writes PR2 and T2CKPS. Timer2's postscaler and
+ * interrupt are left as they are. Call it after timer2_init() , which
+ * writes the prescaler itself , then set the duty again : the duty
+ * counts scale with PR2.
+ * For a constant frequency CCP_PWM_SET_FREQUENCY() does the same with
+ * no run time arithmetic.
+ *
+ * @param[in]  _frequency        Target frequency in Hz
+ *                               (CCP_PWM_FREQUENCY_MIN..CCP_PWM_FREQUENCY_MAX).
+ * @param[out] _resolution_bits  Effective duty resolution in bits , may be NULL.
+ *
+ * @return
+ *      E_OK     : Frequency set.
+ *      E_NOT_OK : Frequency out of range.
+ */
+    Std_ReturnType CCP_PWM_Set_Frequency(const uint32 _frequency , uint8 * _resolution_bits);
+
+/**
+ * @brief  Reads the PWM frequency and duty resolution from PR2 and T2CKPS.
+ *
+ * @param[out] _frequency        Effective frequency in Hz (rounded down).
+ * @param[out] _resolution_bits  Effective duty resolution in bits , may be NULL.
+ *
+ * @return
+ *      E_OK     : Values read.
+ *      E_NOT_OK : Null frequency pointer.
+ */
+    Std_ReturnType CCP_PWM_Get_Frequency(uint32 * _frequency , uint8 * _resolution_bits);
  
 /**
  * @brief  Starts PWM signal generation.
@@ -293,6 +471,101 @@ typedef struct{
     Std_ReturnType CCP_Capture_Mode_Read_Value(const ccp_t * _ccp_obj , uint16 * capture_value);
 #endif
 
+#if (CCP1_CAPTURE_ENGINE_ENABLE == 0X01) || (CCP2_CAPTURE_ENGINE_ENABLE == 0X01)
+
+/**
+ * @brief  Starts the interrupt-driven capture engine.
+ *
+ * @details
+ * CCPx_ISR timestamps every edge on a 32-bit time base : the 16-bit
+ * capture plus a count of the Timer1 / Timer3 overflows , which
+ * CCPx_Capture_Timer_Overflow() keeps. That function must be the
+ * TMR_InterruptHandler of the timer routed to this CCP (tmr13_cfg).
+ * Periods are averaged over 2^CCP_CAPTURE_AVERAGE_LOG2 edges and read
+ * back without blocking. The user CCP_InterruptHandler still runs after
+ * every edge.
+ *
+ * @param[in] _ccp_obj  Pointer to a CCP configured in capture mode
+ *                      (CCP_Init done , the timer running on Fosc / 4).
+ * @param[in] _measure  Period only , or period and duty.
+ * @param[in] _pulses_per_revolution Tachometer pulses per turn , 1 at least.
+ *
+ * @return
+ *      E_OK     : Engine running , first value after 2^n + 1 edges.
+ *      E_NOT_OK : Invalid parameters or engine not built for this CCP.
+ */
+    Std_ReturnType CCP_Capture_Engine_Start(const ccp_t * _ccp_obj , ccp_capture_measure_t _measure ,
+                                            uint8 _pulses_per_revolution);
+
+/**
+ * @brief  Stops the capture engine , the CCP keeps capturing.
+ *
+ * @param[in] _ccp_obj  Pointer to a valid CCP configuration structure.
+ *
+ * @return
+ *      E_OK     : Engine stopped.
+ *      E_NOT_OK : Invalid parameters.
+ */
+    Std_ReturnType CCP_Capture_Engine_Stop(const ccp_t * _ccp_obj);
+
+/**
+ * @brief  Reads the averaged period in timer ticks.
+ *
+ * @param[in]  _ccp_obj  Pointer to a valid CCP configuration structure.
+ * @param[out] _period   Averaged period , 0 if no value yet or input stopped.
+ *
+ * @return
+ *      E_OK     : Value read.
+ *      E_NOT_OK : Invalid parameters.
+ */
+    Std_ReturnType CCP_Capture_Get_Period(const ccp_t * _ccp_obj , uint32 * _period);
+
+/**
+ * @brief  Reads the averaged duty cycle (CCP_CAPTURE_MEASURE_PERIOD_DUTY).
+ *
+ * @param[in]  _ccp_obj   Pointer to a valid CCP configuration structure.
+ * @param[out] _permille  High time / period in 0.1 % , 0 if no value yet.
+ *
+ * @return
+ *      E_OK     : Value read.
+ *      E_NOT_OK : Invalid parameters.
+ */
+    Std_ReturnType CCP_Capture_Get_Duty_Permille(const ccp_t * _ccp_obj , uint16 * _permille);
+
+/**
+ * @brief  Reads the speed from the averaged period.
+ *
+ * @details
+ * rpm = 60 * timer tick rate / (period * pulses per revolution) , the
+ * tick rate read from the timer prescaler. The division runs here , in
+ * the caller's context , never in the ISR.
+ *
+ * @param[in]  _ccp_obj  Pointer to a valid CCP configuration structure.
+ * @param[out] _rpm      Revolutions per minute , 0 if stopped (saturates at 0xFFFF).
+ *
+ * @return
+ *      E_OK     : Value read.
+ *      E_NOT_OK : Invalid parameters.
+ */
+    Std_ReturnType CCP_Capture_Get_Rpm(const ccp_t * _ccp_obj , uint16 * _rpm);
+#endif
+
+#if (CCP1_CAPTURE_ENGINE_ENABLE == 0X01)
+/**
+ * @brief  Timer overflow hook of the CCP1 capture engine.
+ *         Set it as TMR_InterruptHandler of the timer routed to CCP1.
+ */
+    void CCP1_Capture_Timer_Overflow(void);
+#endif
+
+#if (CCP2_CAPTURE_ENGINE_ENABLE == 0X01)
+/**
+ * @brief  Timer overflow hook of the CCP2 capture engine.
+ *         Set it as TMR_InterruptHandler of the timer routed to CCP2.
+ */
+    void CCP2_Capture_Timer_Overflow(void);
+#endif
+
 #if (CCP_CFG_COMPARE_MODE_SELECTED == CCP1_CFG_SELECTED_MODE) || (CCP_CFG_COMPARE_MODE_SELECTED == CCP2_CFG_SELECTED_MODE)
     
 /**
@@ -48,6 +48,39 @@
  */
 #define CCP2_CFG_SELECTED_MODE           (CCP_CFG_PWM_MODE_SELECTED)
 
+/**
+ * @brief Capture engine (capture mode + CCPx interrupt enabled)
+ *  - CCP_CAPTURE_AVERAGE_LOG2    : Periods averaged per published value , 2^n
+ *  - CCP_CAPTURE_STALL_OVERFLOWS : Timer overflows without an edge before the
+ *                                  input is reported stopped (period / RPM = 0)
+ */
+#define CCP_CAPTURE_AVERAGE_LOG2         2
+#define CCP_CAPTURE_STALL_OVERFLOWS      8
+
+/* Static Configuration Options */
+#define CCP_STATIC_CFG_DISABLED          0X00
+#define CCP_STATIC_CFG_CCP1              0X01
+#define CCP_STATIC_CFG_CCP2              0X02
+
+/**
+ * @brief Static configuration , for fixed hardware with a single CCP
+ *  - CCP_STATIC_CFG_INSTANCE : CCP_STATIC_CFG_DISABLED (fields read from the
+ *                              ccp_t object) , CCP_STATIC_CFG_CCP1 or _CCP2
+ *
+ * When a CCP is selected , the driver drives that CCP only and takes the
+ * fields below instead of the object ones : the mode is CCPx_CFG_SELECTED_MODE.
+ * The object still provides the pin and the interrupt handler.
+ *  - CCP_STATIC_CFG_MODE_VARIANT     : CCP_CAPTURE_MODE_xxx / CCP_COMPARE_MODE_xxx / CCP_PWM_MODE
+ *  - CCP_STATIC_CFG_TMR13            : ccp_timers_cfg_t , capture / compare time base
+ *  - CCP_STATIC_CFG_PWM_FREQUENCY    : Hz , PWM mode
+ *  - CCP_STATIC_CFG_TIMER2_PRESCALER : 1 , 4 or 16 , PWM mode
+ */
+#define CCP_STATIC_CFG_INSTANCE          (CCP_STATIC_CFG_DISABLED)
+#define CCP_STATIC_CFG_MODE_VARIANT      (CCP_PWM_MODE)
+#define CCP_STATIC_CFG_TMR13             (CCP_CAPTURE_COMPARE_TMR1)
+#define CCP_STATIC_CFG_PWM_FREQUENCY     20000UL
+#define CCP_STATIC_CFG_TIMER2_PRESCALER  1
+
 
 /* Section : Macro Functions Declarations */
 
@@ -0,0 +1,175 @@
+/**
+ * @file   hal_clock.c
+ * @author Abdelmoniem Ahmed
+ * @linkedin https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * @brief  HAL Clock Manager implementation
+ *
+ * @details
+ * The core keeps running from the old clock until the new one is ready :
+ * OSTS = 1 once the primary oscillator start-up timer has expired ,
+ * IOFS = 1 once the 8 MHz INTOSC source is stable , T1RUN = 1 once the
+ * device is clocked from the Timer1 oscillator. Each is polled a bounded
+ * number of times , a clock that never starts leaves the old one selected.
+ * With INTOSC as the primary oscillator (CLOCK_INTOSC_PLL_CFG) the primary
+ * and PLL modes both run the 8 MHz block on SCS = primary , PLLEN picks
+ * between 8 and 32 MHz and IOFS tells the block is stable.
+ */
+
+#include"hal_clock.h"
+#include"../Power/hal_power.h"
+
+/* Section : Macro Declaration */
+
+/* Driver busy votes that block a switch : their bit clocks derive from Fosc */
+#define CLOCK_SWITCH_BLOCKING_VOTES     (POWER_VOTE_EUSART_TX | POWER_VOTE_I2C | POWER_VOTE_SPI)
+
+/* Section : Static Variables */
+
+/* INTOSC frequencies by OSCCON.IRCF , 31 kHz is the INTRC source */
+static const uint32 clock_intosc_freq[CLOCK_MODE_INTOSC_8MHZ + 1] = {
+    31250UL , 125000UL , 250000UL , 500000UL , 1000000UL , 2000000UL , 4000000UL , 8000000UL
+};
+
+static clock_mode_t clock_mode = CLOCK_MODE_PRIMARY;
+static uint32 clock_fosc = CLOCK_PRIMARY_FREQ;
+static clock_change_handler_t clock_listeners[CLOCK_LISTENER_MAX];
+static uint8 clock_listener_count = ZERO_INIT;
+
+/* Section : Static Function Declarations */
+
+static Std_ReturnType clock_wait_stable(clock_mode_t mode);
+
+/* Section : Function Definitions */
+
+Std_ReturnType Clock_Switch(clock_mode_t mode){
+    Std_ReturnType ret = E_OK;
+    uint8 l_votes = ZERO_INIT;
+    uint8 l_previous_scs = OSCCONbits.SCS;
+    uint8 l_previous_ircf = OSCCONbits.IRCF;
+    uint8 l_previous_pllen = OSCTUNEbits.PLLEN;
+    uint8 l_index = ZERO_INIT;
+
+    (void)Power_Get_Votes(&l_votes);
+    if((CLOCK_MODE_INTOSC_PLL < mode) || (ZERO_INIT != (l_votes & CLOCK_SWITCH_BLOCKING_VOTES)) ||
+       ((CLOCK_MODE_TIMER1_OSC == mode) && (!T1CONbits.T1OSCEN)) ||
+       ((CLOCK_MODE_INTOSC_PLL == mode) && (CONFIG_ENABLE != CLOCK_INTOSC_PLL_CFG))){
+        ret = E_NOT_OK;
+    }
+    else{
+        /* The PLL only runs on the 4 / 8 MHz INTOSC , off for every other mode */
+        OSCTUNEbits.PLLEN = (CLOCK_MODE_INTOSC_PLL == mode) ? 1 : 0;
+        if((CLOCK_MODE_INTOSC_PLL == mode) ||
+           ((CLOCK_MODE_PRIMARY == mode) && (CONFIG_ENABLE == CLOCK_INTOSC_PLL_CFG))){
+            /* INTOSC is the primary oscillator : 8 MHz , x4 when PLLEN is set */
+            OSCCONbits.IRCF = (uint8)CLOCK_MODE_INTOSC_8MHZ;
+            OSCCONbits.SCS = CLOCK_SCS_PRIMARY;
+        }
+        else if(CLOCK_MODE_PRIMARY == mode){
+            OSCCONbits.SCS = CLOCK_SCS_PRIMARY;
+        }
+        else if(CLOCK_MODE_TIMER1_OSC == mode){
+            OSCCONbits.SCS = CLOCK_SCS_TIMER1;
+        }
+        else{
+            /* IRCF first : SCS then selects the block already at the new rate */
+            OSCCONbits.IRCF = (uint8)mode;
+            OSCCONbits.SCS = CLOCK_SCS_INTOSC;
+        }
+        ret = clock_wait_stable(mode);
+        if(E_OK == ret){
+            clock_mode = mode;
+            clock_fosc = (CLOCK_MODE_PRIMARY == mode) ? CLOCK_PRIMARY_FREQ :
+                         (CLOCK_MODE_TIMER1_OSC == mode) ? CLOCK_TIMER1_OSC_FREQ :
+                         (CLOCK_MODE_INTOSC_PLL == mode) ? CLOCK_INTOSC_PLL_FREQ : clock_intosc_freq[mode];
+            for(l_index = ZERO_INIT ; l_index < clock_listener_count ; l_index++){
+                clock_listeners[l_index](clock_fosc);
+            }
+        }
+        else{
+            OSCCONbits.SCS = l_previous_scs;
+            OSCCONbits.IRCF = l_previous_ircf;
+            OSCTUNEbits.PLLEN = l_previous_pllen;
+        }
+    }
+    return ret;
+}
+
+Std_ReturnType Clock_Get_Mode(clock_mode_t *mode){
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == mode){
+        ret = E_NOT_OK;
+    }
+    else{
+        *mode = clock_mode;
+    }
+    return ret;
+}
+
+Std_ReturnType Clock_Get_Frequency(uint32 *fosc){
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == fosc){
+        ret = E_NOT_OK;
+    }
+    else{
+        *fosc = clock_fosc;
+    }
+    return ret;
+}
+
+Std_ReturnType Clock_Register_Listener(clock_change_handler_t handler){
+    Std_ReturnType ret = E_OK;
+    uint8 l_index = ZERO_INIT;
+    uint8 l_found = FALSE;
+
+    if(NULL == handler){
+        ret = E_NOT_OK;
+    }
+    else{
+        for(l_index = ZERO_INIT ; l_index < clock_listener_count ; l_index++){
+            if(handler == clock_listeners[l_index]){
+                l_found = TRUE;
+            }
+            else{ /* Nothing */ }
+        }
+        if(TRUE == l_found){
+            /* Already registered */
+        }
+        else if(CLOCK_LISTENER_MAX <= clock_listener_count){
+            ret = E_NOT_OK;
+        }
+        else{
+            clock_listeners[clock_listener_count] = handler;
+            clock_listener_count++;
+        }
+    }
+    return ret;
+}
+
+/* Section : Static Function Definitions */
+
+/**
+ * @brief Wait for the status bit that tells the new clock drives the core
+ */
+static Std_ReturnType clock_wait_stable(clock_mode_t mode){
+    Std_ReturnType ret = E_NOT_OK;
+    uint16 l_polls = ZERO_INIT;
+
+    if(CLOCK_MODE_INTOSC_31KHZ == mode){
+        /* INTRC runs whenever the device does */
+        ret = E_OK;
+    }
+    else{
+        for(l_polls = ZERO_INIT ; (l_polls < CLOCK_STABLE_POLL_MAX) && (E_NOT_OK == ret) ; l_polls++){
+            if(((CLOCK_MODE_PRIMARY == mode) && (CONFIG_ENABLE != CLOCK_INTOSC_PLL_CFG) && (OSCCONbits.OSTS)) ||
+               ((CLOCK_MODE_PRIMARY == mode) && (CONFIG_ENABLE == CLOCK_INTOSC_PLL_CFG) && (OSCCONbits.IOFS)) ||
+               ((CLOCK_MODE_TIMER1_OSC == mode) && (T1CONbits.T1RUN)) ||
+               (((CLOCK_MODE_INTOSC_8MHZ >= mode) || (CLOCK_MODE_INTOSC_PLL == mode)) && (OSCCONbits.IOFS))){
+                ret = E_OK;
+            }
+            else{ /* Still starting */ }
+        }
+    }
+    return ret;
+}
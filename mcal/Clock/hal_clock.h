@@ -0,0 +1,140 @@
+/**
+ * @file   hal_clock.h
+ * @author Abdelmoniem Ahmed
+ * @linkedin https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * @brief  HAL Clock Manager for PIC18F4620 (runtime oscillator switching)
+ *
+ * @details
+ * Switches the system clock at runtime through OSCCON.SCS / IRCF :
+ *  - CLOCK_MODE_PRIMARY        : the oscillator of the OSC configuration
+ *                                bits , e.g. HSPLL = 40 MHz from a 10 MHz crystal
+ *  - CLOCK_MODE_INTOSC_xxx     : internal block , 8 MHz down to 31 kHz
+ *  - CLOCK_MODE_TIMER1_OSC     : Timer1 32.768 kHz crystal (T1OSCEN running)
+ *  - CLOCK_MODE_INTOSC_PLL     : 8 MHz INTOSC through the 4x PLL = 32 MHz
+ *
+ * HSPLL is a configuration setting : HS and HSPLL cannot both be reached
+ * at runtime , the primary mode is the one the device was built for.
+ * The INTOSC PLL is the runtime one (OSCTUNE.PLLEN) , it only exists when
+ * the OSC configuration bits make INTOSC the primary oscillator (INTIO67 /
+ * INTIO7) : set CLOCK_INTOSC_PLL_CFG then , CLOCK_MODE_PRIMARY is INTOSC
+ * 8 MHz with the PLL off and _XTAL_FREQ must be the 32 MHz PLL rate.
+ *
+ * The hardware switch is glitch free , but every divider computed from
+ * Fosc is wrong afterwards. Drivers that can follow a new Fosc register
+ * a listener , Clock_Switch() calls each one with the new frequency
+ * (EUSART_ASYNC_Clock_Update , MSSP_I2C_Clock_Update). A switch is refused
+ * while a driver busy vote (hal_power.h) says a transfer is on the wire.
+ *
+ * __delay_ms() / __delay_us() are compiled for _XTAL_FREQ : keep it the
+ * primary (fastest) frequency , the delays then only stretch on a slower clock.
+ */
+
+#ifndef HAL_CLOCK_H
+#define	HAL_CLOCK_H
+
+/* Section : Includes */
+
+#include"std_types.h"
+#include"mcal_internal_interrupt.h"
+
+/* Section : Macro Declaration */
+
+/* CONFIG_ENABLE when the OSC configuration bits are INTIO67 / INTIO7 (INTOSC PLL available) */
+#define CLOCK_INTOSC_PLL_CFG            CONFIG_DISABLE
+
+/* INTOSC 8 MHz x 4 */
+#define CLOCK_INTOSC_PLL_FREQ           32000000UL
+
+/* Fosc of CLOCK_MODE_PRIMARY , set by the OSC configuration bits */
+#if CLOCK_INTOSC_PLL_CFG == CONFIG_ENABLE
+#define CLOCK_PRIMARY_FREQ              8000000UL
+#if _XTAL_FREQ != CLOCK_INTOSC_PLL_FREQ
+#error "CLOCK_INTOSC_PLL_CFG : _XTAL_FREQ must be the 32 MHz PLL rate"
+#endif
+#else
+#define CLOCK_PRIMARY_FREQ              _XTAL_FREQ
+#endif
+
+/* Timer1 oscillator crystal */
+#define CLOCK_TIMER1_OSC_FREQ           32768UL
+
+/* Registered clock-change listeners */
+#define CLOCK_LISTENER_MAX              4
+
+/* Polls of OSTS / IOFS before a switch is given up (start-up of a crystal : ~1 ms) */
+#define CLOCK_STABLE_POLL_MAX           10000U
+
+/* OSCCON.SCS values */
+#define CLOCK_SCS_PRIMARY               0x00
+#define CLOCK_SCS_TIMER1                0x01
+#define CLOCK_SCS_INTOSC                0x02
+
+/* Section : Data Types Declarations */
+
+/**
+ * @enum clock_mode_t
+ * @brief System clock selection , INTOSC values follow OSCCON.IRCF (7 = 8 MHz)
+ */
+typedef enum{
+    CLOCK_MODE_INTOSC_31KHZ = 0,
+    CLOCK_MODE_INTOSC_125KHZ,
+    CLOCK_MODE_INTOSC_250KHZ,
+    CLOCK_MODE_INTOSC_500KHZ,
+    CLOCK_MODE_INTOSC_1MHZ,
+    CLOCK_MODE_INTOSC_2MHZ,
+    CLOCK_MODE_INTOSC_4MHZ,
+    CLOCK_MODE_INTOSC_8MHZ,
+    CLOCK_MODE_PRIMARY,
+    CLOCK_MODE_TIMER1_OSC,
+    CLOCK_MODE_INTOSC_PLL
+}clock_mode_t;
+
+/**
+ * @brief Clock-change listener , called by Clock_Switch() with the new Fosc (Hz)
+ */
+typedef void (* clock_change_handler_t)(uint32 fosc);
+
+/* Section : Function Declarations */
+
+/**
+ * @brief Switch the system clock and notify the listeners
+ *
+ * @param mode Clock to run from
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Running from the new clock , listeners called
+ *         - E_NOT_OK : Invalid mode , transfer in flight (busy vote) ,
+ *                      Timer1 oscillator off , INTOSC PLL without
+ *                      CLOCK_INTOSC_PLL_CFG , or the new clock did not
+ *                      become stable : the previous clock is kept
+ *
+ * @note Call it from the main loop , the listeners run in the caller's context.
+ */
+Std_ReturnType Clock_Switch(clock_mode_t mode);
+
+/**
+ * @brief Read the current clock mode
+ * @param mode Pointer to the returned mode
+ * @return Std_ReturnType (E_OK / E_NOT_OK on null pointer)
+ */
+Std_ReturnType Clock_Get_Mode(clock_mode_t *mode);
+
+/**
+ * @brief Read the current Fosc
+ * @param fosc Pointer to the returned frequency (Hz)
+ * @return Std_ReturnType (E_OK / E_NOT_OK on null pointer)
+ */
+Std_ReturnType Clock_Get_Frequency(uint32 *fosc);
+
+/**
+ * @brief Add a clock-change listener
+ *
+ * @param handler Called after every successful Clock_Switch()
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Registered (or already registered)
+ *         - E_NOT_OK : Null pointer or CLOCK_LISTENER_MAX listeners already
+ */
+Std_ReturnType Clock_Register_Listener(clock_change_handler_t handler);
+
+#endif	/* HAL_CLOCK_H */
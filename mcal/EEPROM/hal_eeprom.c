@@ -10,6 +10,7 @@
  * Driver Characteristics:
  * -----------------------
  * - Polling-based implementation
+ * - Optional EEIF-driven queued writer with read-compare-write
  * - Atomic write sequence protection
  * - Interrupt state preservation
  * - Address boundary validation
@@ -22,11 +23,32 @@
  * -------------
  * - Global interrupts are temporarily disabled during the required
  *   unlock sequence to prevent accidental corruption.
- * - The driver waits until WR bit clears before returning.
+ * - The blocking write waits until WR bit clears before returning ,
+ *   with interrupts enabled.
  */
 
 
 #include"hal_eeprom.h"
+#include"../Interrupt/mcal_interrupt_critical.h"
+
+#if         INTERRUPT_FEATURE_ENABLE == DATA_EEPROM_INTERRUPT_FEATURE_ENABLE
+    static data_eeprom_write_t * eeprom_write_queue[DATA_EEPROM_WRITE_QUEUE_SIZE];
+    static volatile uint8 eeprom_queue_head = ZERO_INIT;
+    static volatile uint8 eeprom_queue_tail = ZERO_INIT;
+    static volatile uint8 eeprom_writer_busy = FALSE;
+    static uint16 eeprom_write_index = ZERO_INIT;
+
+#define DATA_EEPROM_WRITE_QUEUE_MASK        (DATA_EEPROM_WRITE_QUEUE_SIZE - 1)
+#define DATA_EEPROM_WRITE_QUEUE_USED()      ((uint8)(eeprom_queue_head - eeprom_queue_tail))
+#endif
+
+/* Static Function Declaration */
+
+static void Data_EEPROM_Start_Write(uint16 address , uint8 Data);
+static uint8 Data_EEPROM_Read(uint16 address);
+#if         INTERRUPT_FEATURE_ENABLE == DATA_EEPROM_INTERRUPT_FEATURE_ENABLE
+static void Data_EEPROM_Writer_Advance(void);
+#endif
 
 /**
  * @brief  Writes one byte to Data EEPROM
@@ -39,47 +61,42 @@
  *         - E_NOT_OK : Invalid address
  *
  * @note   This function uses polling and blocks until the
- *         write cycle completes (~4ms typical).
+ *         write cycle completes (~4ms typical). Interrupts are only
+ *         held off for the unlock sequence.
  */
 
 Std_ReturnType Data_EEPROM_Write_Byte(uint16 address , uint8 Data){
     
     Std_ReturnType ret = E_OK;
-    uint8 Interrupt_global_Status = 0;
-    uint8 Interrupt_peripheral_Status = 0;
-    /* Read The Interrupt Status "Enabled / Disabled"*/
-    Interrupt_global_Status = INTCONbits.GIE ;
-    Interrupt_peripheral_Status = INTCONbits.PEIE;
-    /* Update the ADDRESS Register */
-    EEADR  = ((uint8)(address&0xFF)); 
-    EEADRH = ((uint8) ((address >> 8) & 0x03) ) ;
-    /* Update the Data Register */
-    EEDATA = Data;        
-    /* Select Access Data to EEPROM */
-    EECON1bits.EEPGD = ACCESS_DATA_EEPROM_MEM ;
-    /* Allows write Cycle To Flash program/ EEPROM */
-    EECON1bits.CFGS  = ACCESS_DATA_EEPROM_MEM ;
-    /* DisAble All Interrupts */
-#if                     INTERRUPT_FEATURE_DISABLE == INTERRUPT_PRIORITY_LEVELS_ENABLE   
-    INTERRUPT_GlobalInterruptDisable();
-#else
-    INTERRUPT_GlobalInterruptHighDisable();
-    INTERRUPT_GlobalInterruptLowDisable();
-#endif    
-    /* Write the Required Sequence -> 0x55 -> 0xAA */
-    EECON2 = 0x55 ;
-    EECON2 = 0xAA ;
-    /* Allow Write Cycle */
-    EECON1bits.WREN = WRITE_ENABLE ;
-    /* Initiate the Erase/Write Cycle */
-    EECON1bits.WR   = WRITE_CYCLE_INITATE ;
-    /* Wait to complete the write process */
-    while(EECON1bits.WR){ /* Nothing , Just Wait */ }
-    /* inhibits Write cycles */
-    EECON1bits.WREN = WRITE_DISABLE ;
-    /* Restore INTERRUPT GIE */
-    INTCONbits.GIE = Interrupt_global_Status ;
-    INTCONbits.PEIE = Interrupt_peripheral_Status;
+#if         INTERRUPT_FEATURE_ENABLE == DATA_EEPROM_INTERRUPT_FEATURE_ENABLE
+    uint8 l_eeie = PIE2bits.EEIE ;
+#endif
+    
+    if(DATA_EEPROM_SIZE <= address){
+        ret = E_NOT_OK;
+    }
+    else{
+#if         INTERRUPT_FEATURE_ENABLE == DATA_EEPROM_INTERRUPT_FEATURE_ENABLE
+        /* Keep the queued writer off EEADR / EEDATA while this byte is written */
+        DATA_EEPROM_INTERRUPT_DISABLE();
+#endif
+        /* Let a running write cycle finish */
+        while(EECON1bits.WR){ /* Nothing , Just Wait */ }
+        Data_EEPROM_Start_Write(address , Data);
+        /* Wait to complete the write process , interrupts are serviced meanwhile */
+        while(EECON1bits.WR){ /* Nothing , Just Wait */ }
+        /* inhibits Write cycles */
+        EECON1bits.WREN = WRITE_DISABLE ;
+#if         INTERRUPT_FEATURE_ENABLE == DATA_EEPROM_INTERRUPT_FEATURE_ENABLE
+        /* EEIF is set by this cycle , not by a queued one : drop it and restart a writer held off */
+        DATA_EEPROM_INTERRUPT_CLEAR_FLAG();
+        if(TRUE == eeprom_writer_busy){
+            Data_EEPROM_Writer_Advance();
+        }
+        else{ /* Nothing */ }
+        PIE2bits.EEIE = l_eeie ;
+#endif
+    }
     return ret;
 }
 
@@ -97,11 +114,149 @@ Std_ReturnType Data_EEPROM_Write_Byte(uint16 address , uint8 Data){
  */
 Std_ReturnType Data_EEPROM_Read_Byte(uint16 address , uint8 *Data){
     Std_ReturnType ret = E_OK;
-    if(NULL == Data){
+#if         INTERRUPT_FEATURE_ENABLE == DATA_EEPROM_INTERRUPT_FEATURE_ENABLE
+    uint8 l_eeie = PIE2bits.EEIE ;
+#endif
+    
+    if((NULL == Data) || (DATA_EEPROM_SIZE <= address)){
+        ret = E_NOT_OK;
+    }
+    else{
+#if         INTERRUPT_FEATURE_ENABLE == DATA_EEPROM_INTERRUPT_FEATURE_ENABLE
+        /* EEADR must not change under a running write cycle */
+        DATA_EEPROM_INTERRUPT_DISABLE();
+#endif
+        while(EECON1bits.WR){ /* Nothing , Just Wait */ }
+        *Data = Data_EEPROM_Read(address);
+#if         INTERRUPT_FEATURE_ENABLE == DATA_EEPROM_INTERRUPT_FEATURE_ENABLE
+        PIE2bits.EEIE = l_eeie ;
+#endif
+    }
+    return ret;
+}
+
+
+
+/**
+ * @brief  Writes a block to Data EEPROM , skipping bytes that already match
+ *
+ * @param  address  First EEPROM address
+ * @param  data     Pointer to the source buffer
+ * @param  length   Number of bytes
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Write successful
+ *         - E_NOT_OK : Invalid parameter or range
+ */
+Std_ReturnType Data_EEPROM_Write_Block(uint16 address , const uint8 *data , uint16 length){
+    Std_ReturnType ret = E_OK;
+    uint8 l_stored = ZERO_INIT;
+    uint16 l_index = ZERO_INIT;
+    
+    if((NULL == data) || (ZERO_INIT == length) || (DATA_EEPROM_SIZE < ((uint32)address + length))){
+        ret = E_NOT_OK;
+    }
+    else{
+        for(l_index = ZERO_INIT ; l_index < length ; l_index++){
+            ret &= Data_EEPROM_Read_Byte(address + l_index , &l_stored);
+            if(l_stored != data[l_index]){
+                ret &= Data_EEPROM_Write_Byte(address + l_index , data[l_index]);
+            }
+            else{ /* Nothing */ }
+        }
+    }
+    return ret;
+}
+
+#if         INTERRUPT_FEATURE_ENABLE == DATA_EEPROM_INTERRUPT_FEATURE_ENABLE
+Std_ReturnType Data_EEPROM_Submit_Write(data_eeprom_write_t *request){
+    Std_ReturnType ret = E_OK;
+    
+    if((NULL == request) || (NULL == request->data) || (ZERO_INIT == request->length) ||
+       (DATA_EEPROM_SIZE < ((uint32)request->address + request->length))){
+        ret = E_NOT_OK;
+    }
+    else{
+        /* The ISR dequeues and starts requests , keep it out while the queue is updated */
+        DATA_EEPROM_INTERRUPT_DISABLE();
+        if(DATA_EEPROM_WRITE_QUEUE_SIZE <= DATA_EEPROM_WRITE_QUEUE_USED()){
+            ret = E_NOT_OK;
+        }
+        else{
+            request->written_count = ZERO_INIT;
+            request->status = DATA_EEPROM_WRITE_PENDING;
+            eeprom_write_queue[eeprom_queue_head & DATA_EEPROM_WRITE_QUEUE_MASK] = request;
+            eeprom_queue_head++;
+            if(FALSE == eeprom_writer_busy){
+                eeprom_writer_busy = TRUE;
+                eeprom_write_index = ZERO_INIT;
+                /* A blocking write may still be running , EEIF then restarts the writer */
+                if(ZERO_INIT == EECON1bits.WR){
+                    /* A finished blocking write or flash cycle left EEIF set */
+                    DATA_EEPROM_INTERRUPT_CLEAR_FLAG();
+                    Data_EEPROM_Writer_Advance();
+                }
+                else{ /* Nothing */ }
+            }
+            else{ /* Nothing */ }
+        }
+        DATA_EEPROM_INTERRUPT_ENABLE();
+    }
+    
+    return ret;
+}
+
+Std_ReturnType Data_EEPROM_Is_Idle(uint8 *is_idle){
+    Std_ReturnType ret = E_OK;
+    
+    if(NULL == is_idle){
         ret = E_NOT_OK;
     }
     else{
+        *is_idle = (FALSE == eeprom_writer_busy) ? TRUE : FALSE;
+    }
+    
+    return ret;
+}
+#endif
+
+/* Static Function Definition */
+
+/**
+ * @brief  Load EEADR / EEDATA and start one erase/write cycle
+ *
+ * @note   Interrupts are masked only around the 0x55 / 0xAA / WR sequence ,
+ *         the caller waits for (or is interrupted by) the end of the cycle.
+ */
+static void Data_EEPROM_Start_Write(uint16 address , uint8 Data){
+    uint8 Interrupt_global_Status = 0;
     
+    /* Update the ADDRESS Register */
+    EEADR  = ((uint8)(address&0xFF)); 
+    EEADRH = ((uint8) ((address >> 8) & 0x03) ) ;
+    /* Update the Data Register */
+    EEDATA = Data;        
+    /* Select Access Data to EEPROM */
+    EECON1bits.EEPGD = ACCESS_DATA_EEPROM_MEM ;
+    /* Allows write Cycle To Flash program/ EEPROM */
+    EECON1bits.CFGS  = ACCESS_DATA_EEPROM_MEM ;
+    /* Allow Write Cycle */
+    EECON1bits.WREN = WRITE_ENABLE ;
+    /* DisAble All Interrupts , GIEH covers both vectors in priority mode */
+    INTERRUPT_CRITICAL_ENTER_ALL(Interrupt_global_Status);
+    /* Write the Required Sequence -> 0x55 -> 0xAA */
+    EECON2 = 0x55 ;
+    EECON2 = 0xAA ;
+    /* Initiate the Erase/Write Cycle */
+    EECON1bits.WR   = WRITE_CYCLE_INITATE ;
+    /* Restore INTERRUPT GIE */
+    INTERRUPT_CRITICAL_EXIT_ALL(Interrupt_global_Status);
+}
+
+/**
+ * @brief  Raw read cycle , the caller makes sure no write cycle is running
+ */
+static uint8 Data_EEPROM_Read(uint16 address){
     /* Update the ADDRESS Register */
     EEADR  = ((uint8)(address&0xFF)); 
     EEADRH = ((uint8) ((address >> 8) & 0x03) );
@@ -115,8 +270,70 @@ Std_ReturnType Data_EEPROM_Read_Byte(uint16 address , uint8 *Data){
     NOP();
     NOP();
     
-    *Data = EEDATA;
+    return EEDATA;
+}
+
+#if         INTERRUPT_FEATURE_ENABLE == DATA_EEPROM_INTERRUPT_FEATURE_ENABLE
+/**
+ * @brief  Start the next byte that differs , completing requests on the way
+ *
+ * @note   Does nothing while a write cycle runs , its EEIF calls again.
+ *         Matching bytes are skipped here , so only differing bytes cost
+ *         an EEIF round trip.
+ */
+static void Data_EEPROM_Writer_Advance(void){
+    data_eeprom_write_t * l_request = NULL;
+    uint8 l_started = FALSE;
+    
+    if(EECON1bits.WR){
+        /* EEADR / EEDATA belong to the running cycle */
+        l_started = TRUE;
     }
-    return ret;
+    else{ /* Nothing */ }
+    while((FALSE == l_started) && (eeprom_queue_head != eeprom_queue_tail)){
+        l_request = eeprom_write_queue[eeprom_queue_tail & DATA_EEPROM_WRITE_QUEUE_MASK];
+        if(eeprom_write_index < l_request->length){
+            if(Data_EEPROM_Read(l_request->address + eeprom_write_index) != l_request->data[eeprom_write_index]){
+                Data_EEPROM_Start_Write(l_request->address + eeprom_write_index , l_request->data[eeprom_write_index]);
+                l_request->written_count++;
+                l_started = TRUE;
+            }
+            else{ /* Nothing */ }
+            eeprom_write_index++;
+        }
+        else{
+            /* Request complete , report it and move to the next one */
+            eeprom_queue_tail++;
+            eeprom_write_index = ZERO_INIT;
+            l_request->status = DATA_EEPROM_WRITE_DONE;
+            if(l_request->write_complete_callback){
+                l_request->write_complete_callback(l_request);
+            }
+            else{ /* Nothing */ }
+        }
+    }
+    if(FALSE == l_started){
+        /* inhibits Write cycles */
+        EECON1bits.WREN = WRITE_DISABLE ;
+        eeprom_writer_busy = FALSE;
+    }
+    else{ /* Nothing */ }
 }
+#endif
 
+/* Interrupt Service Routines */
+
+/**
+ * @brief Data EEPROM write complete Interrupt Service Routine
+ *
+ * Advances the queued writer to the next byte that differs.
+ */
+void DATA_EEPROM_ISR(void){
+#if         INTERRUPT_FEATURE_ENABLE == DATA_EEPROM_INTERRUPT_FEATURE_ENABLE
+    DATA_EEPROM_INTERRUPT_CLEAR_FLAG();
+    if(TRUE == eeprom_writer_busy){
+        Data_EEPROM_Writer_Advance();
+    }
+    else{ /* Nothing */ }
+#endif
+}
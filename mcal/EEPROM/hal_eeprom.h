@@ -10,11 +10,12 @@
  * The driver supports:
  *  - Byte read operation (Polling based)
  *  - Byte write operation (Polling based)
+ *  - Block write with read-compare-write (Polling based)
+ *  - Queued block writes advanced by the EEIF interrupt (Interrupt based)
  *
  * Note:
- *  - The driver uses blocking (polling) technique.
- *  - Interrupts are temporarily disabled during the write unlock sequence
- *    to guarantee atomic operation.
+ *  - Interrupts are disabled only for the 0x55 / 0xAA unlock sequence
+ *    that starts a write cycle , never for the ~4 ms cycle itself.
  */
 
 #ifndef HAL_EEPROM_H
@@ -23,7 +24,7 @@
 /* Section : Includes */
 
 #include"std_types.h"
-#include"mcal_interrupt_config.h"
+#include"mcal_internal_interrupt.h"
 
 /* Section : Macro Declaration */
 
@@ -51,12 +52,52 @@
  * @brief Initiate EEPROM read cycle
  */
 #define READ_CYCLE_INITIATE      0x01
+
+/**
+ * @brief Data EEPROM size in bytes (address range 0x000 - 0x3FF)
+ */
+#define DATA_EEPROM_SIZE         1024
+   
+/**
+ * @brief Queued write requests (descriptors) , MUST be a power of two
+ */
+#define DATA_EEPROM_WRITE_QUEUE_SIZE    4
+
+#if (DATA_EEPROM_WRITE_QUEUE_SIZE & (DATA_EEPROM_WRITE_QUEUE_SIZE - 1)) || (DATA_EEPROM_WRITE_QUEUE_SIZE > 128)
+#error "DATA_EEPROM_WRITE_QUEUE_SIZE must be a power of two , 128 at most"
+#endif
    
 
 /* Section : Macro Functions Declarations */
 
 /* Section : Data Types Declarations */
 
+/**
+ * @brief Queued write request status
+ */
+typedef enum{
+    DATA_EEPROM_WRITE_IDLE = 0 ,        /* Never submitted */
+    DATA_EEPROM_WRITE_PENDING ,         /* Queued or being written */
+    DATA_EEPROM_WRITE_DONE              /* Every byte holds the requested value */
+}data_eeprom_write_status_t;
+
+/**
+ * @brief Queued write request descriptor
+ *
+ * Writes `length` bytes from `data` starting at `address`. Bytes already
+ * holding the requested value are skipped (read-compare-write).
+ * The descriptor and the buffer are owned by the caller and must stay
+ * valid until `status` leaves DATA_EEPROM_WRITE_PENDING.
+ * The completion callback runs in interrupt context.
+ */
+typedef struct data_eeprom_write_s{
+    const uint8 *data ;
+    void (* write_complete_callback)(struct data_eeprom_write_s *request);
+    uint16 address ;
+    uint16 length ;
+    uint16 written_count ;                          /* Bytes that needed a write cycle */
+    volatile data_eeprom_write_status_t status ;
+}data_eeprom_write_t;
 
 
 /* Section : Function Declarations */
@@ -83,9 +124,54 @@ Std_ReturnType Data_EEPROM_Read_Byte(uint16 address , uint8 *Data);
  *         - E_OK      : Operation successful
  *         - E_NOT_OK  : Operation failed (invalid parameters)
  *
- * @note   This function uses polling until the write cycle completes.
+ * @note   This function uses polling until the write cycle completes ,
+ *         interrupts stay enabled while waiting.
  */
 Std_ReturnType Data_EEPROM_Write_Byte(uint16 address , uint8 Data);
 
+/**
+ * @brief  Writes a block to Data EEPROM , skipping bytes that already match
+ *
+ * @param  address   First EEPROM address
+ * @param  data      Pointer to the source buffer
+ * @param  length    Number of bytes (address + length <= DATA_EEPROM_SIZE)
+ *
+ * @return Std_ReturnType
+ *         - E_OK      : Operation successful
+ *         - E_NOT_OK  : Operation failed (invalid parameters)
+ *
+ * @note   Blocking , one write cycle (~4 ms) per byte that differs.
+ */
+Std_ReturnType Data_EEPROM_Write_Block(uint16 address , const uint8 *data , uint16 length);
+
+#if         INTERRUPT_FEATURE_ENABLE == DATA_EEPROM_INTERRUPT_FEATURE_ENABLE
+/**
+ * @brief  Queue a block write advanced by the EEIF interrupt   <- Interrupt Method ->
+ *
+ * @param  request   Pointer to a caller-owned write descriptor
+ *
+ * @return Std_ReturnType
+ *         - E_OK      : Request queued , `status` is DATA_EEPROM_WRITE_PENDING
+ *         - E_NOT_OK  : Null pointer , range outside the EEPROM or queue full
+ *
+ * @note   Returns immediately. Each write cycle is started inside a short
+ *         critical section and the next differing byte is started from
+ *         DATA_EEPROM_ISR. Enables the EEPROM interrupt , global interrupts
+ *         must be enabled by Interrupt_Manager_Global_Enable().
+ */
+Std_ReturnType Data_EEPROM_Submit_Write(data_eeprom_write_t *request);
+
+/**
+ * @brief  Check whether the queued writer is idle
+ *
+ * @param  is_idle   Pointer to store TRUE (nothing queued or being written) or FALSE
+ *
+ * @return Std_ReturnType
+ *         - E_OK      : Status returned
+ *         - E_NOT_OK  : Null pointer
+ */
+Std_ReturnType Data_EEPROM_Is_Idle(uint8 *is_idle);
+#endif
+
 #endif	/* HAL_EEPROM_H */
 
@@ -14,37 +14,131 @@
 
 
 #include"hal_eusart.h"
+#include"../Interrupt/mcal_interrupt_critical.h"
+#include"../Power/hal_power.h"
 
 
 /* Section: Static Function Pointers for Interrupts */
 #if   EUSART_TX_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE 
    static void (* EUSART_TX_InterruptHandler)(void) = NULL ;
-   static uint16 char_counter = ZERO_INIT;
-   static uint8 Tx_buffer[500] = {0} ;
-   static uint8 write_string_flag = ZERO_INIT;
-   static uint16 str_length_int = ZERO_INIT;
    
+   /* SPSC TX ring (spsc_queue.h) : the application is the producer , EUSART_TX_ISR the consumer */
+   static SPSC_QUEUE_TYPE(uint8 , EUSART_TX_BUFFER_SIZE) tx_ring ;
+
+   /* Zero-copy blocks , SPSC like the ring : EUSART_TX_ISR consumes the front entry in place */
+   typedef struct{
+       const uint8 *data ;
+       uint16 length ;
+       uint8 ring_position ;        /* tx_ring.head when queued , the block goes out when tx_ring.tail gets there */
+   }usart_tx_descriptor_t;
+
+   static SPSC_QUEUE_TYPE(usart_tx_descriptor_t , EUSART_TX_DESCRIPTOR_COUNT) tx_descriptors ;
 #endif
     
 #if   EUSART_RX_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE 
     static void (* EUSART_RX_InterruptHandler)(void) = NULL ;   
     static void (* EUSART_FERR_InterruptHandler)(void) = NULL ;
     static void (* EUSART_OERR_InterruptHandler)(void) = NULL ;
-    uint8 *l_data = ZERO_INIT;
+    static void (* EUSART_RX_FrameInterruptHandler)(void) = NULL ;
+    
+    /* SPSC RX ring (spsc_queue.h) : EUSART_RX_ISR is the producer , the application the consumer */
+    static SPSC_QUEUE_TYPE(uint8 , EUSART_RX_BUFFER_SIZE) rx_ring ;
+    
+    static uint8 rx_frame_delimiter = ZERO_INIT;
+    static uint8 rx_delimiter_enable = EUSART_RX_DELIMITER_DISABLE;
+    static uint8 rx_frame_length = EUSART_RX_FRAME_LENGTH_DISABLE;
+    static uint8 rx_frame_counter = ZERO_INIT;
+    
+    static volatile usart_rx_counters_t rx_counters ;
+#endif
+
+#if   EUSART_RS485_CFG == EUSART_RS485_ENABLE
+    static pin_config_t rs485_de_pin ;
+    static uint8 rs485_de_enable = EUSART_RS485_DE_DISABLE;
+    static uint8 rs485_de_asserted = FALSE;         /* Main loop only : write APIs raise , Process drops */
+#if   EUSART_RX_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+    static uint8 multidrop_node_address = EUSART_MULTIDROP_NO_ADDRESS;
+    static volatile uint8 multidrop_frame_address = EUSART_MULTIDROP_NO_ADDRESS;
+#endif
 #endif
 
 
+/* BRG setup saved around a rate change or an auto-baud measurement */
+typedef struct{
+    uint8 spbrg ;
+    uint8 spbrgh ;
+    uint8 brg16 : 1 ;
+    uint8 brgh : 1 ;
+    uint8 rcie : 1 ;
+    uint8 reserved : 5 ;
+}usart_brg_snapshot_t;
+
+static usart_brg_snapshot_t autobaud_saved ;
+
+/* Fosc the BRG is computed for , follows the clock manager through EUSART_ASYNC_Clock_Update */
+static uint32 usart_fosc = _XTAL_FREQ;
+static volatile usart_autobaud_state_t autobaud_state = EUSART_AUTOBAUD_IDLE;
+
+/* Synchronous master , EUSART_ASYNC_Init hands the module back to the asynchronous driver */
+static uint8 usart_sync_running = FALSE;
+static uint8 usart_sync_bit_order = EUSART_SYNC_LSB_FIRST;
+
+/* Bit-reversed nibbles , MSB first on a LSB first shifter */
+static const uint8 usart_sync_nibble_reverse[16] = {
+    0x00 , 0x08 , 0x04 , 0x0C , 0x02 , 0x0A , 0x06 , 0x0E ,
+    0x01 , 0x09 , 0x05 , 0x0D , 0x03 , 0x0B , 0x07 , 0x0F
+};
+
+
 /* Section: Static Helper Functions */
 
 /**
  * @brief Calculates and sets the EUSART baud rate registers.
  *
  * Configures SPBRG and SPBRGH according to the selected baud rate
- * and generator mode in the usart_t object.
+ * and generator mode in the usart_t object , using integer math only.
+ * The resulting baud error is stored in `baudrate_error`.
  *
  * @param _usart_obj Pointer to the USART configuration object.
+ *
+ * @return Std_ReturnType
+ * - E_OK: BRG value in range and error within EUSART_BAUDRATE_ERROR_LIMIT
+ * - E_NOT_OK: Zero baud rate or baud rate not reachable in the selected mode
  */    
-static void usart_baudrate_calculation(usart_t * _usart_obj );
+static Std_ReturnType usart_baudrate_calculation(usart_t * _usart_obj );
+
+#if EUSART_STATIC_BAUDRATE_CFG == EUSART_STATIC_BAUDRATE_DISABLE
+/**
+ * @brief Computes a rounded BRG value and its baud error.
+ *
+ * @param baudrate Requested baud rate (bps).
+ * @param divisor BRG divisor of the mode (64 , 16 or 4).
+ * @param brg_max Largest BRG value of the mode (0xFF or 0xFFFF).
+ * @param brg Pointer to store the BRG value (clamped to range).
+ * @param error Pointer to store the baud error (0.01 % units).
+ */
+static Std_ReturnType usart_brg_compute(uint32 baudrate , uint32 divisor , uint16 brg_max ,
+                                        uint16 *brg , sint16 *error);
+
+/**
+ * @brief Replaces BAUDRATE_ASYNC_AUTO by the asynchronous mode with the lowest error.
+ *
+ * @param _usart_obj Pointer to the USART configuration object.
+ */
+static void usart_baudrate_auto_select(usart_t * _usart_obj);
+
+/* Asynchronous BRG modes tried by BAUDRATE_ASYNC_AUTO , finest divisor first */
+static const struct{
+    baudrate_gen_t cfg ;
+    uint8 divisor ;
+    uint16 brg_max ;
+}usart_async_modes[] = {
+    { BAUDRATE_ASYNC_16BIT_HIGH_SPEED , (uint8)EUSART_BRG_DIVISOR_ASYNC_16BIT_HIGH , 0xFFFF },
+    { BAUDRATE_ASYNC_16BIT_LOW_SPEED  , (uint8)EUSART_BRG_DIVISOR_ASYNC_16BIT_LOW  , 0xFFFF },
+    { BAUDRATE_ASYNC_8BIT_HIGH_SPEED  , (uint8)EUSART_BRG_DIVISOR_ASYNC_8BIT_HIGH  , 0x00FF },
+    { BAUDRATE_ASYNC_8BIT_LOW_SPEED   , (uint8)EUSART_BRG_DIVISOR_ASYNC_8BIT_LOW   , 0x00FF },
+};
+#endif
 
 /**
  * @brief Initializes the EUSART transmitter.
@@ -64,6 +158,35 @@ static void EUSART_ASYNC_TX_Init(usart_t * _usart_obj);
  */
 static void EUSART_ASYNC_RX_Init(usart_t * _usart_obj);
 
+/**
+ * @brief Byte in the configured synchronous bit order , the hardware shifts LSB first.
+ */
+static uint8 usart_sync_bit_order_apply(uint8 _data);
+
+/**
+ * @brief Saves and restores SPBRGH:SPBRG , BRG16 , BRGH and RCIE.
+ */
+static void usart_brg_save(usart_brg_snapshot_t *snapshot);
+static void usart_brg_restore(const usart_brg_snapshot_t *snapshot);
+
+#if EUSART_RS485_CFG == EUSART_RS485_ENABLE
+/**
+ * @brief Initializes the DE pin (low , receiving) and the multidrop address filter.
+ *
+ * @param _usart_obj Pointer to the USART configuration object.
+ *
+ * @return Std_ReturnType
+ * - E_OK: RS-485 configured
+ * - E_NOT_OK: DE pin failure , invalid node address or multidrop without the RX interrupt
+ */
+static Std_ReturnType usart_rs485_init(usart_t * _usart_obj);
+
+/**
+ * @brief Raises DE before a byte is handed to the transmitter.
+ */
+static void usart_rs485_de_assert(void);
+#endif
+
 
 Std_ReturnType EUSART_ASYNC_Init(usart_t * _usart_obj){
     Std_ReturnType ret = E_OK ;
@@ -73,15 +196,22 @@ Std_ReturnType EUSART_ASYNC_Init(usart_t * _usart_obj){
     }
     else{
         RCSTAbits.SPEN = EUSART_DISABLE ;
-        usart_baudrate_calculation(_usart_obj);
+        BAUDCONbits.ABDEN = EUSART_DISABLE ;
+        autobaud_state = EUSART_AUTOBAUD_IDLE;
+        usart_sync_running = FALSE;
+        ret = usart_baudrate_calculation(_usart_obj);
         EUSART_ASYNC_TX_Init(_usart_obj);
         EUSART_ASYNC_RX_Init(_usart_obj);
-        
+#if EUSART_RS485_CFG == EUSART_RS485_ENABLE
+        if(E_NOT_OK == usart_rs485_init(_usart_obj)){
+            ret = E_NOT_OK;
+        }
+        else{ /* Nothing */ }
+#endif
         
         TRISCbits.RC6 = GPIO_DIRECTION_INPUT ;
         TRISCbits.RC7 = GPIO_DIRECTION_INPUT ;
         RCSTAbits.SPEN = EUSART_ENABLE ;
-        ret = E_OK ;
     }
     
     return ret ;
@@ -101,6 +231,132 @@ Std_ReturnType EUSART_ASYNC_DeInit(usart_t * _usart_obj){
     return ret ;
 }
 
+#if EUSART_STATIC_BAUDRATE_CFG == EUSART_STATIC_BAUDRATE_DISABLE
+Std_ReturnType EUSART_ASYNC_Set_Baudrate(usart_t * _usart_obj , uint32 baudrate){
+    Std_ReturnType ret = E_OK ;
+    usart_brg_snapshot_t l_saved ;
+    uint32 l_baudrate = ZERO_INIT;
+    baudrate_gen_t l_baudrate_cfg = BAUDRATE_ASYNC_AUTO;
+    sint16 l_baudrate_error = ZERO_INIT;
+    uint8 l_idle = FALSE;
+    
+    (void)EUSART_ASYNC_TX_Is_Idle(&l_idle);
+    if((NULL == _usart_obj) || (FALSE == l_idle) || (EUSART_AUTOBAUD_RUNNING == autobaud_state)){
+        ret = E_NOT_OK;
+    }
+    else{
+        usart_brg_save(&l_saved);
+        l_baudrate = _usart_obj->baudrate;
+        l_baudrate_cfg = _usart_obj->baudrate_cfg;
+        l_baudrate_error = _usart_obj->baudrate_error;
+        _usart_obj->baudrate = baudrate;
+        ret = usart_baudrate_calculation(_usart_obj);
+        if(E_NOT_OK == ret){
+            /* A clamped BRG is worse than the old rate : keep the link up */
+            usart_brg_restore(&l_saved);
+            _usart_obj->baudrate = l_baudrate;
+            _usart_obj->baudrate_cfg = l_baudrate_cfg;
+            _usart_obj->baudrate_error = l_baudrate_error;
+        }
+        else{ /* Nothing */ }
+    }
+    
+    return ret ;
+}
+
+Std_ReturnType EUSART_ASYNC_Clock_Update(usart_t * _usart_obj , uint32 fosc){
+    Std_ReturnType ret = E_OK ;
+    uint32 l_fosc = usart_fosc;
+    uint8 l_idle = FALSE;
+    
+    if((NULL == _usart_obj) || (ZERO_INIT == fosc)){
+        ret = E_NOT_OK;
+    }
+    else{
+        /* The character in the shift register still needs the old BRG */
+        do{
+            (void)EUSART_ASYNC_TX_Is_Idle(&l_idle);
+        }while(FALSE == l_idle);
+        usart_fosc = fosc;
+        ret = EUSART_ASYNC_Set_Baudrate(_usart_obj , _usart_obj->baudrate);
+        if(E_NOT_OK == ret){
+            usart_fosc = l_fosc;
+        }
+        else{ /* Nothing */ }
+    }
+    
+    return ret ;
+}
+#endif
+
+Std_ReturnType EUSART_ASYNC_AutoBaud_Start(void){
+    Std_ReturnType ret = E_OK ;
+    
+    if((EUSART_ASYNCHRONOUS_RX_ENABLE != RCSTAbits.CREN) || (EUSART_SYNCHRONOUS_MODE == TXSTAbits.SYNC) ||
+       (EUSART_AUTOBAUD_RUNNING == autobaud_state)){
+        ret = E_NOT_OK;
+    }
+    else{
+        usart_brg_save(&autobaud_saved);
+        /* The measurement character raises RCIF , keep it away from the RX ring */
+        PIE1bits.RCIE = INTERRUPT_DISABLE;
+        BAUDCONbits.BRG16 = EUSART_16BIT_BAUDRATE_GEN;
+        TXSTAbits.BRGH = EUSART_ASYNCHRONOUS_HIGH_SPEED_BRG;
+        BAUDCONbits.ABDOVF = EUSART_DISABLE;
+        autobaud_state = EUSART_AUTOBAUD_RUNNING;
+        BAUDCONbits.ABDEN = EUSART_ENABLE;
+    }
+    
+    return ret ;
+}
+
+Std_ReturnType EUSART_ASYNC_AutoBaud_Poll(usart_t * _usart_obj , usart_autobaud_state_t *state){
+    Std_ReturnType ret = E_OK ;
+    uint8 l_discard = ZERO_INIT;
+    uint16 l_brg = ZERO_INIT;
+    
+    if((NULL == _usart_obj) || (NULL == state)){
+        ret = E_NOT_OK;
+    }
+    else{
+        if(EUSART_AUTOBAUD_RUNNING != autobaud_state){
+            /* Nothing */
+        }
+        else if(EUSART_ENABLE == BAUDCONbits.ABDOVF){
+            /* ABDEN stays set after an overflow , the counter has to be stopped here */
+            usart_brg_restore(&autobaud_saved);
+            autobaud_state = EUSART_AUTOBAUD_OVERFLOW;
+        }
+        else if(EUSART_DISABLE == BAUDCONbits.ABDEN){
+            /* Hardware cleared ABDEN : SPBRGH:SPBRG holds the count for the measured rate */
+            l_discard = RCREG;
+            (void)l_discard;
+            l_brg = (uint16)(((uint16)SPBRGH << 8) | SPBRG);
+            _usart_obj->baudrate = usart_fosc / (EUSART_BRG_DIVISOR_ASYNC_16BIT_HIGH * ((uint32)l_brg + 1UL));
+            _usart_obj->baudrate_cfg = BAUDRATE_ASYNC_16BIT_HIGH_SPEED;
+            _usart_obj->baudrate_error = ZERO_INIT;
+            PIE1bits.RCIE = autobaud_saved.rcie;
+            autobaud_state = EUSART_AUTOBAUD_DONE;
+        }
+        else{ /* Still waiting for the sync character */ }
+        *state = autobaud_state;
+    }
+    
+    return ret ;
+}
+
+Std_ReturnType EUSART_ASYNC_AutoBaud_Abort(void){
+    Std_ReturnType ret = E_OK ;
+    
+    if(EUSART_AUTOBAUD_RUNNING == autobaud_state){
+        usart_brg_restore(&autobaud_saved);
+        autobaud_state = EUSART_AUTOBAUD_IDLE;
+    }
+    else{ /* Nothing */ }
+    
+    return ret ;
+}
+
 Std_ReturnType EUSART_ASYNC_Read_Byte_Blocking(uint8 *_data){
     Std_ReturnType ret = E_OK ;
     if(NULL == _data){
@@ -114,6 +370,25 @@ Std_ReturnType EUSART_ASYNC_Read_Byte_Blocking(uint8 *_data){
     
     return ret ;
 }
+
+Std_ReturnType EUSART_ASYNC_Read_Byte_Polled(uint8 *_data){
+    Std_ReturnType ret = E_NOT_OK ;
+    if(NULL == _data){
+        ret = E_NOT_OK;
+    }
+    else if(EUSART_OVERRUN_ERROR_DETECTED == RCSTAbits.OERR){
+        /* The receiver stops on overrun , clearing CREN restarts it */
+        RCSTAbits.CREN = EUSART_ASYNCHRONOUS_RX_DISABLE ;
+        RCSTAbits.CREN = EUSART_ASYNCHRONOUS_RX_ENABLE ;
+    }
+    else if(INTERRUPT_OCCUR == PIR1bits.RCIF){
+        *_data = RCREG ;
+        ret = E_OK ;
+    }
+    else{ /* Nothing received */ }
+    
+    return ret ;
+}
 #if     INTERRUPT_FEATURE_ENABLE == EUSART_RX_INTERRUPT_FEATURE_ENABLE
 Std_ReturnType EUSART_ASYNC_Read_Byte_NonBlocking(uint8 *_data){
     Std_ReturnType ret = E_OK ;
@@ -121,18 +396,76 @@ Std_ReturnType EUSART_ASYNC_Read_Byte_NonBlocking(uint8 *_data){
         ret = E_NOT_OK;
     }
     else{
-        l_data = _data;
-        if(1 == PIR1bits.RCIF){
-           *_data = RCREG ; 
+        if(!SPSC_QUEUE_IS_EMPTY(rx_ring)){
+            *_data = SPSC_QUEUE_FRONT(rx_ring);
+            SPSC_QUEUE_RELEASE(rx_ring);
+        }
+        else if((INTERRUPT_DISABLE == PIE1bits.RCIE) && (INTERRUPT_OCCUR == PIR1bits.RCIF)){
+            /* Receiver configured without interrupt : poll the hardware FIFO */
+            *_data = RCREG ; 
         }
         else{ ret = E_NOT_OK ; }
     }
     return ret ;
 }
+
+Std_ReturnType EUSART_ASYNC_Read_Buffer(uint8 *_data , uint8 max_length , uint8 *read_length){
+    Std_ReturnType ret = E_OK ;
+    uint8 l_count = ZERO_INIT;
+    uint8 l_byte = ZERO_INIT;
+    
+    if((NULL == _data) || (NULL == read_length)){
+        ret = E_NOT_OK;
+    }
+    else{
+        while((l_count < max_length) && (!SPSC_QUEUE_IS_EMPTY(rx_ring))){
+            l_byte = SPSC_QUEUE_FRONT(rx_ring);
+            SPSC_QUEUE_RELEASE(rx_ring);
+            _data[l_count++] = l_byte;
+            if((EUSART_RX_DELIMITER_ENABLE == rx_delimiter_enable) && (rx_frame_delimiter == l_byte)){
+                break;
+            }
+            else{ /* Nothing */ }
+        }
+        *read_length = l_count;
+    }
+    return ret ;
+}
+
+Std_ReturnType EUSART_ASYNC_RX_Get_Available(uint8 *available){
+    Std_ReturnType ret = E_OK ;
+    if(NULL == available){
+        ret = E_NOT_OK;
+    }
+    else{
+        *available = SPSC_QUEUE_USED(rx_ring);
+    }
+    return ret ;
+}
+
+Std_ReturnType EUSART_ASYNC_RX_Get_Counters(usart_rx_counters_t *counters){
+    Std_ReturnType ret = E_OK ;
+    interrupt_critical_t l_section;
+    if(NULL == counters){
+        ret = E_NOT_OK;
+    }
+    else{
+        /* 16-bit counters are updated by the ISR , copy them with RX interrupt masked */
+        ret = Interrupt_Critical_Enter(&l_section , INTERRUPT_CRITICAL_EUSART_RX);
+        counters->hw_overrun_count = rx_counters.hw_overrun_count;
+        counters->framing_error_count = rx_counters.framing_error_count;
+        counters->buffer_overflow_count = rx_counters.buffer_overflow_count;
+        ret &= Interrupt_Critical_Exit(&l_section);
+    }
+    return ret ;
+}
 #endif
 
 Std_ReturnType EUSART_ASYNC_Write_Byte_Blocking( uint8 _data){
     Std_ReturnType ret = E_OK ;
+#if   EUSART_RS485_CFG == EUSART_RS485_ENABLE
+        usart_rs485_de_assert();
+#endif
         while(!(PIR1bits.TXIF));
 #if   EUSART_TX_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE         
         EUSART_TX_INTERRUPT_ENABLE();
@@ -142,7 +475,7 @@ Std_ReturnType EUSART_ASYNC_Write_Byte_Blocking( uint8 _data){
     return ret ;
 }
 
-Std_ReturnType EUSART_ASYNC_Write_String_Blocking(uint8 *_data , uint16 str_length){
+Std_ReturnType EUSART_ASYNC_Write_String_Blocking(const uint8 *_data , uint16 str_length){
     Std_ReturnType ret = E_OK ;
     uint16 char_counter = ZERO_INIT;
     
@@ -153,84 +486,486 @@ Std_ReturnType EUSART_ASYNC_Write_String_Blocking(uint8 *_data , uint16 str_leng
     return ret;
 }
 
+Std_ReturnType EUSART_ASYNC_TX_Is_Idle(uint8 *is_idle){
+    Std_ReturnType ret = E_OK ;
+    
+    if(NULL == is_idle){
+        ret = E_NOT_OK;
+    }
+    else{
+#if     INTERRUPT_FEATURE_ENABLE == EUSART_TX_INTERRUPT_FEATURE_ENABLE
+        *is_idle = (SPSC_QUEUE_IS_EMPTY(tx_ring) && SPSC_QUEUE_IS_EMPTY(tx_descriptors) && (TXSTAbits.TRMT)) ? TRUE : FALSE;
+#else
+        *is_idle = (TXSTAbits.TRMT) ? TRUE : FALSE;
+#endif
+    }
+    
+    return ret ;
+}
+
 #if     INTERRUPT_FEATURE_ENABLE == EUSART_TX_INTERRUPT_FEATURE_ENABLE
 Std_ReturnType EUSART_ASYNC_Write_Byte_NonBlocking(uint8 _data){
-        Std_ReturnType ret = E_OK ;
-        if(PIR1bits.TXIF){
-            
-            EUSART_TX_INTERRUPT_ENABLE();
-            
-            TXREG = _data ;
+    Std_ReturnType ret = E_OK ;
+    
+    if(SPSC_QUEUE_IS_FULL(tx_ring)){
+        ret = E_NOT_OK;
+    }
+    else{
+        SPSC_QUEUE_BACK(tx_ring) = _data;
+        SPSC_QUEUE_PUBLISH(tx_ring , 1);
+#if   EUSART_RS485_CFG == EUSART_RS485_ENABLE
+        usart_rs485_de_assert();
+#endif
+        (void)Power_Vote_Busy(POWER_VOTE_EUSART_TX);
+        /* TXIF is set while TXREG is empty , the ISR picks the byte up immediately */
+        EUSART_TX_INTERRUPT_ENABLE();
+    }
+    
+    return ret ;
+}
+
+Std_ReturnType EUSART_ASYNC_Write_String_NonBlocking(const uint8 *_data , uint16 str_length){
+    Std_ReturnType ret = E_OK ;
+    uint8 l_head = tx_ring.head;
+    uint16 char_counter = ZERO_INIT;
+    
+    if((NULL == _data) || (SPSC_QUEUE_FREE(tx_ring) < str_length)){
+        ret = E_NOT_OK;
+    }
+    else{
+        for(char_counter = ZERO_INIT ; char_counter < str_length ; char_counter++){
+            SPSC_QUEUE_SLOT(tx_ring , l_head) = _data[char_counter];
+            l_head++;
         }
-        else{
+        /* Publish the whole frame at once */
+        SPSC_QUEUE_PUBLISH(tx_ring , str_length);
+#if   EUSART_RS485_CFG == EUSART_RS485_ENABLE
+        usart_rs485_de_assert();
+#endif
+        (void)Power_Vote_Busy(POWER_VOTE_EUSART_TX);
+        EUSART_TX_INTERRUPT_ENABLE();
+    }
+    
+    return ret;
+}
+
+Std_ReturnType EUSART_ASYNC_Write_Const_NonBlocking(const uint8 *_data , uint16 length){
+    Std_ReturnType ret = E_OK ;
+    usart_tx_descriptor_t *l_descriptor = &SPSC_QUEUE_BACK(tx_descriptors);
+    
+    if((NULL == _data) || (ZERO_INIT == length) || SPSC_QUEUE_IS_FULL(tx_descriptors)){
+        ret = E_NOT_OK;
+    }
+    else{
+        l_descriptor->data = _data;
+        l_descriptor->length = length;
+        l_descriptor->ring_position = tx_ring.head;
+        /* Published once complete , the ISR never sees a half written entry */
+        SPSC_QUEUE_PUBLISH(tx_descriptors , 1);
+#if   EUSART_RS485_CFG == EUSART_RS485_ENABLE
+        usart_rs485_de_assert();
+#endif
+        (void)Power_Vote_Busy(POWER_VOTE_EUSART_TX);
+        EUSART_TX_INTERRUPT_ENABLE();
+    }
+    
+    return ret ;
+}
+
+Std_ReturnType EUSART_ASYNC_TX_Get_Free_Space(uint8 *free_space){
+    Std_ReturnType ret = E_OK ;
+    
+    if(NULL == free_space){
+        ret = E_NOT_OK;
+    }
+    else{
+        *free_space = SPSC_QUEUE_FREE(tx_ring);
+    }
+    
+    return ret;
+}
+#endif
+
+Std_ReturnType EUSART_SYNC_Master_Init(usart_sync_t * _sync_obj){
+    Std_ReturnType ret = E_OK ;
+    uint32 l_step = ZERO_INIT;
+    uint32 l_count = ZERO_INIT;
+    
+    if((NULL == _sync_obj) || (ZERO_INIT == _sync_obj->clock_frequency)){
+        ret = E_NOT_OK;
+    }
+    else{
+        /* n + 1 = Fosc / (4 * clock) rounded up , never faster than asked */
+        l_step = EUSART_BRG_DIVISOR_SYNC * _sync_obj->clock_frequency;
+        l_count = (usart_fosc + l_step - 1UL) / l_step;
+        if(0x10000UL < l_count){
             ret = E_NOT_OK;
         }
-        
+        else{
+            RCSTAbits.SPEN = EUSART_DISABLE ;
+            BAUDCONbits.ABDEN = EUSART_DISABLE ;
+            autobaud_state = EUSART_AUTOBAUD_IDLE;
+            /* Polled driver : the asynchronous handlers must not see these flags */
+            PIE1bits.TXIE = INTERRUPT_DISABLE;
+            PIE1bits.RCIE = INTERRUPT_DISABLE;
+            TXSTAbits.TXEN = EUSART_ASYNCHRONOUS_TX_DISABLE;
+            RCSTAbits.CREN = EUSART_ASYNCHRONOUS_RX_DISABLE;
+            RCSTAbits.SREN = EUSART_DISABLE;
+            TXSTAbits.TX9 = EUSART_ASYNCHRONOUS_9BIT_TX_DISABLE;
+            RCSTAbits.RX9 = EUSART_ASYNCHRONOUS_9BIT_RX_DISABLE;
+            TXSTAbits.SYNC = EUSART_SYNCHRONOUS_MODE;
+            TXSTAbits.CSRC = EUSART_SYNC_MASTER_MODE;
+            BAUDCONbits.SCKP = _sync_obj->clock_idle;
+            BAUDCONbits.BRG16 = EUSART_16BIT_BAUDRATE_GEN;
+            SPBRG = (uint8)(l_count - 1UL);
+            SPBRGH = (uint8)((l_count - 1UL) >> 8);
+            _sync_obj->clock_frequency = usart_fosc / (EUSART_BRG_DIVISOR_SYNC * l_count);
+            usart_sync_bit_order = _sync_obj->bit_order;
+            
+            TRISCbits.RC6 = GPIO_DIRECTION_INPUT ;
+            TRISCbits.RC7 = GPIO_DIRECTION_INPUT ;
+            RCSTAbits.SPEN = EUSART_ENABLE ;
+            TXSTAbits.TXEN = EUSART_ASYNCHRONOUS_TX_ENABLE;
+            usart_sync_running = TRUE;
+        }
+    }
+    
     return ret ;
 }
 
-Std_ReturnType EUSART_ASYNC_Write_String_NonBlocking(uint8 *_data , uint16 str_length){
+Std_ReturnType EUSART_SYNC_Master_DeInit(void){
     Std_ReturnType ret = E_OK ;
     
-    if((0 == write_string_flag) && (sizeof(Tx_buffer) >= str_length) && ( NULL != _data)){
-        for(char_counter = ZERO_INIT ; char_counter < str_length ; char_counter++){
-            Tx_buffer[char_counter] = _data[char_counter];
+    RCSTAbits.SPEN = EUSART_DISABLE ;
+    TXSTAbits.TXEN = EUSART_ASYNCHRONOUS_TX_DISABLE;
+    RCSTAbits.SREN = EUSART_DISABLE;
+    TXSTAbits.CSRC = EUSART_SYNC_SLAVE_MODE;
+    BAUDCONbits.SCKP = EUSART_SYNC_CLOCK_IDLE_LOW;
+    usart_sync_running = FALSE;
+    
+    return ret ;
+}
+
+Std_ReturnType EUSART_SYNC_Master_Write(const uint8 *_data , uint16 length){
+    Std_ReturnType ret = E_OK ;
+    uint16 l_index = ZERO_INIT;
+    
+    if((NULL == _data) || (ZERO_INIT == length) || (FALSE == usart_sync_running)){
+        ret = E_NOT_OK;
+    }
+    else{
+        for(l_index = ZERO_INIT ; l_index < length ; l_index++){
+            while(!(PIR1bits.TXIF));
+            TXREG = usart_sync_bit_order_apply(_data[l_index]);
         }
-        write_string_flag = 1;
-        char_counter = 0;
-        str_length_int = str_length ;
-        EUSART_ASYNC_Write_Byte_NonBlocking(Tx_buffer[char_counter]);
+        /* TXIF : the last byte moved to the shift register , TRMT : it is out */
+        while(!(PIR1bits.TXIF));
+        while(!(TXSTAbits.TRMT));
+    }
+    
+    return ret ;
+}
+
+Std_ReturnType EUSART_SYNC_Master_Read(uint8 *_data , uint16 length){
+    Std_ReturnType ret = E_OK ;
+    uint16 l_index = ZERO_INIT;
+    
+    if((NULL == _data) || (ZERO_INIT == length) || (FALSE == usart_sync_running)){
+        ret = E_NOT_OK;
+    }
+    else{
+        /* DT turns into an input : the transmitter must be done with it */
+        while(!(TXSTAbits.TRMT));
+        TXSTAbits.TXEN = EUSART_ASYNCHRONOUS_TX_DISABLE;
+        for(l_index = ZERO_INIT ; l_index < length ; l_index++){
+            /* Single receive : eight clocks , SREN clears itself */
+            RCSTAbits.SREN = EUSART_ENABLE;
+            while(!(PIR1bits.RCIF));
+            _data[l_index] = usart_sync_bit_order_apply(RCREG);
+        }
+        TXSTAbits.TXEN = EUSART_ASYNCHRONOUS_TX_ENABLE;
+    }
+    
+    return ret ;
+}
+
+#if   EUSART_RS485_CFG == EUSART_RS485_ENABLE
+Std_ReturnType EUSART_ASYNC_RS485_Process(void){
+    Std_ReturnType ret = E_OK ;
+    uint8 l_idle = FALSE;
+    
+    if(TRUE == rs485_de_asserted){
+        (void)EUSART_ASYNC_TX_Is_Idle(&l_idle);
+        if(TRUE == l_idle){
+            ret = gpio_pin_write_logic(&rs485_de_pin , GPIO_PIN_LOW);
+            rs485_de_asserted = FALSE;
+        }
+        else{ /* Stop bit of the last byte not out yet */ }
+    }
+    else{ /* Nothing */ }
+    
+    return ret ;
+}
+
+Std_ReturnType EUSART_ASYNC_Multidrop_Write_Address(uint8 address){
+    Std_ReturnType ret = E_OK ;
+    uint8 l_idle = FALSE;
+    
+    if(EUSART_ASYNCHRONOUS_9BIT_TX_ENABLE != TXSTAbits.TX9){
+        ret = E_NOT_OK;
     }
     else{
+        usart_rs485_de_assert();
+        /* TX9D is taken with TXREG : the previous frame must be out first */
+        do{
+            (void)EUSART_ASYNC_TX_Is_Idle(&l_idle);
+        }while(FALSE == l_idle);
+        TXSTAbits.TX9D = EUSART_MULTIDROP_ADDRESS_FRAME;
+        TXREG = address ;
+        /* TXIF is valid one cycle after the TXREG load , it sets again once
+           TXREG (and TX9D) moved into the shift register */
+        NOP();
+        while(!(PIR1bits.TXIF));
+        TXSTAbits.TX9D = EUSART_MULTIDROP_DATA_FRAME;
+    }
+    
+    return ret ;
+}
+
+#if   EUSART_RX_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+Std_ReturnType EUSART_ASYNC_Multidrop_Get_Address(uint8 *address){
+    Std_ReturnType ret = E_OK ;
+    
+    if((NULL == address) || (EUSART_MULTIDROP_NO_ADDRESS == multidrop_frame_address)){
         ret = E_NOT_OK;
     }
+    else{
+        *address = multidrop_frame_address;
+    }
     
-    return ret;
+    return ret ;
 }
 #endif
 
-static void usart_baudrate_calculation(usart_t * _usart_obj ){
-    float baudrate_temp = 0 ;
+static Std_ReturnType usart_rs485_init(usart_t * _usart_obj){
+    Std_ReturnType ret = E_OK ;
+    uint8 l_node_address = _usart_obj->usart_rs485_cfg.node_address;
+    
+    rs485_de_enable = _usart_obj->usart_rs485_cfg.de_enable;
+    rs485_de_asserted = FALSE;
+    if(EUSART_RS485_DE_ENABLE == rs485_de_enable){
+        rs485_de_pin = _usart_obj->usart_rs485_cfg.de_pin;
+        rs485_de_pin.direction = GPIO_DIRECTION_OUTPUT;
+        rs485_de_pin.logic = GPIO_PIN_LOW;
+        ret = gpio_pin_initialize(&rs485_de_pin);
+    }
+    else{ /* DE driven by the application or auto-direction transceiver */ }
+    
+    RCSTAbits.ADDEN = EUSART_DISABLE;
+#if   EUSART_RX_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+    multidrop_node_address = EUSART_MULTIDROP_NO_ADDRESS;
+    multidrop_frame_address = EUSART_MULTIDROP_NO_ADDRESS;
+    if(EUSART_MULTIDROP_NO_ADDRESS == l_node_address){
+        /* Plain RS-485 link */
+    }
+    else if((EUSART_MULTIDROP_BROADCAST_ADDRESS == l_node_address) ||
+            (EUSART_ASYNCHRONOUS_INTERRUPT_RX_ENABLE != _usart_obj->usart_rx_cfg.usart_rx_interrupt_enable)){
+        ret = E_NOT_OK;
+    }
+    else{
+        multidrop_node_address = l_node_address;
+        TXSTAbits.TX9 = EUSART_ASYNCHRONOUS_9BIT_TX_ENABLE;
+        RCSTAbits.RX9 = EUSART_ASYNCHRONOUS_9BIT_RX_ENABLE;
+        /* Only address bytes reach RCREG until one selects this node */
+        RCSTAbits.ADDEN = EUSART_ENABLE;
+    }
+#else
+    if(EUSART_MULTIDROP_NO_ADDRESS != l_node_address){
+        /* The address filter runs in EUSART_RX_ISR */
+        ret = E_NOT_OK;
+    }
+    else{ /* Plain RS-485 link */ }
+#endif
+    
+    return ret ;
+}
+
+static void usart_rs485_de_assert(void){
+    if((EUSART_RS485_DE_ENABLE == rs485_de_enable) && (FALSE == rs485_de_asserted)){
+        (void)gpio_pin_write_logic(&rs485_de_pin , GPIO_PIN_HIGH);
+        rs485_de_asserted = TRUE;
+    }
+    else{ /* Nothing */ }
+}
+#endif
+
+static Std_ReturnType usart_baudrate_calculation(usart_t * _usart_obj ){
+    Std_ReturnType ret = E_OK ;
+    uint16 l_brg = ZERO_INIT;
+    
+#if EUSART_STATIC_BAUDRATE_CFG == EUSART_STATIC_BAUDRATE_ENABLE
+    TXSTAbits.SYNC = EUSART_ASYNCHRONOUS_MODE ;
+    BAUDCONbits.BRG16 = EUSART_16BIT_BAUDRATE_GEN ;
+    TXSTAbits.BRGH = EUSART_ASYNCHRONOUS_HIGH_SPEED_BRG ;
+    l_brg = (uint16)EUSART_BRG_VALUE(EUSART_STATIC_BAUDRATE , EUSART_BRG_DIVISOR_ASYNC_16BIT_HIGH);
+    _usart_obj->baudrate = EUSART_STATIC_BAUDRATE;
+    _usart_obj->baudrate_cfg = BAUDRATE_ASYNC_16BIT_HIGH_SPEED;
+    _usart_obj->baudrate_error = EUSART_BAUDRATE_ERROR(EUSART_STATIC_BAUDRATE , EUSART_BRG_DIVISOR_ASYNC_16BIT_HIGH);
+#else
+    sint16 l_error = ZERO_INIT;
+    
+    if(BAUDRATE_ASYNC_AUTO == _usart_obj->baudrate_cfg){
+        usart_baudrate_auto_select(_usart_obj);
+    }
+    else{ /* Nothing */ }
+    
     switch(_usart_obj->baudrate_cfg){
         case BAUDRATE_ASYNC_8BIT_LOW_SPEED :
                 TXSTAbits.SYNC = EUSART_ASYNCHRONOUS_MODE ;
                 BAUDCONbits.BRG16 = EUSART_8BIT_BAUDRATE_GEN ;
                 TXSTAbits.BRGH = EUSART_ASYNCHRONOUS_LOW_SPEED_BRG ;
-                baudrate_temp = ( (_XTAL_FREQ / (float) _usart_obj->baudrate) / 64) - 1 ;
+                ret = usart_brg_compute(_usart_obj->baudrate , EUSART_BRG_DIVISOR_ASYNC_8BIT_LOW , 0x00FF , &l_brg , &l_error);
             break;
         case BAUDRATE_ASYNC_8BIT_HIGH_SPEED :
                 TXSTAbits.SYNC = EUSART_ASYNCHRONOUS_MODE ;
                 BAUDCONbits.BRG16 = EUSART_8BIT_BAUDRATE_GEN ;
                 TXSTAbits.BRGH = EUSART_ASYNCHRONOUS_HIGH_SPEED_BRG ;
-                baudrate_temp = ( (_XTAL_FREQ / (float) _usart_obj->baudrate) / 16) - 1 ;
+                ret = usart_brg_compute(_usart_obj->baudrate , EUSART_BRG_DIVISOR_ASYNC_8BIT_HIGH , 0x00FF , &l_brg , &l_error);
             break;
         case BAUDRATE_ASYNC_16BIT_LOW_SPEED :
                 TXSTAbits.SYNC = EUSART_ASYNCHRONOUS_MODE ;
                 BAUDCONbits.BRG16 = EUSART_16BIT_BAUDRATE_GEN ;
                 TXSTAbits.BRGH = EUSART_ASYNCHRONOUS_LOW_SPEED_BRG ;
-                baudrate_temp = ( (_XTAL_FREQ / (float) _usart_obj->baudrate) / 16) - 1 ;
+                ret = usart_brg_compute(_usart_obj->baudrate , EUSART_BRG_DIVISOR_ASYNC_16BIT_LOW , 0xFFFF , &l_brg , &l_error);
             break;
         case BAUDRATE_ASYNC_16BIT_HIGH_SPEED :
                 TXSTAbits.SYNC = EUSART_ASYNCHRONOUS_MODE ;
                 BAUDCONbits.BRG16 = EUSART_16BIT_BAUDRATE_GEN ;
                 TXSTAbits.BRGH = EUSART_ASYNCHRONOUS_HIGH_SPEED_BRG ;
-                baudrate_temp = ( (_XTAL_FREQ / (float) _usart_obj->baudrate) / 4) - 1 ;
+                ret = usart_brg_compute(_usart_obj->baudrate , EUSART_BRG_DIVISOR_ASYNC_16BIT_HIGH , 0xFFFF , &l_brg , &l_error);
             break;
         case BAUDRATE_SYNC_8BIT :
                 TXSTAbits.SYNC = EUSART_SYNCHRONOUS_MODE ;
                 BAUDCONbits.BRG16 = EUSART_8BIT_BAUDRATE_GEN ;
-                baudrate_temp = ( (_XTAL_FREQ / (float) _usart_obj->baudrate) / 4) - 1 ;
+                ret = usart_brg_compute(_usart_obj->baudrate , EUSART_BRG_DIVISOR_SYNC , 0x00FF , &l_brg , &l_error);
             break;
         case BAUDRATE_SYNC_16BIT :
                 TXSTAbits.SYNC = EUSART_SYNCHRONOUS_MODE ;
                 BAUDCONbits.BRG16 = EUSART_16BIT_BAUDRATE_GEN ;
-                baudrate_temp = ( (_XTAL_FREQ / (float) _usart_obj->baudrate) / 4) - 1 ;
+                ret = usart_brg_compute(_usart_obj->baudrate , EUSART_BRG_DIVISOR_SYNC , 0xFFFF , &l_brg , &l_error);
             break;
         default :  
+                ret = E_NOT_OK;
             break;
     }
-    SPBRG = (uint8)((uint32)baudrate_temp);
-    SPBRGH = (uint8)( ((uint32)baudrate_temp) >> 8) ;
+    _usart_obj->baudrate_error = l_error;
+#endif
+    SPBRG = (uint8)l_brg;
+    SPBRGH = (uint8)(l_brg >> 8) ;
+    
+    return ret;
+}
+
+#if EUSART_STATIC_BAUDRATE_CFG == EUSART_STATIC_BAUDRATE_DISABLE
+static Std_ReturnType usart_brg_compute(uint32 baudrate , uint32 divisor , uint16 brg_max ,
+                                        uint16 *brg , sint16 *error){
+    Std_ReturnType ret = E_OK ;
+    uint32 l_step = ZERO_INIT;
+    uint32 l_count = ZERO_INIT;
+    uint32 l_actual = ZERO_INIT;
+    uint32 l_diff = ZERO_INIT;
+    uint32 l_error = ZERO_INIT;
+    uint8 l_negative = FALSE;
+    
+    if(ZERO_INIT == baudrate){
+        *brg = ZERO_INIT;
+        *error = ZERO_INIT;
+        ret = E_NOT_OK;
+    }
+    else{
+        /* n + 1 = Fosc / (divisor * baudrate) , rounded to nearest */
+        l_step = divisor * baudrate;
+        l_count = (usart_fosc + (l_step >> 1)) / l_step;
+        if(ZERO_INIT == l_count){
+            l_count = 1;
+            ret = E_NOT_OK;
+        }
+        else if(((uint32)brg_max + 1UL) < l_count){
+            l_count = (uint32)brg_max + 1UL;
+            ret = E_NOT_OK;
+        }
+        else{ /* Nothing */ }
+        *brg = (uint16)(l_count - 1UL);
+        
+        l_actual = usart_fosc / (divisor * l_count);
+        if(l_actual >= baudrate){
+            l_diff = l_actual - baudrate;
+        }
+        else{
+            l_diff = baudrate - l_actual;
+            l_negative = TRUE;
+        }
+        /* error = diff * 10000 / baudrate , done in two base-100 steps to stay inside 32 bits */
+        if(l_diff >= (baudrate * 3UL)){
+            l_error = 32767;
+        }
+        else{
+            l_error = (l_diff / baudrate) * 10000UL;
+            l_diff = (l_diff % baudrate) * 100UL;
+            l_error += (l_diff / baudrate) * 100UL;
+            l_diff = (l_diff % baudrate) * 100UL;
+            l_error += (l_diff / baudrate);
+        }
+        *error = (TRUE == l_negative) ? -(sint16)l_error : (sint16)l_error;
+        if(EUSART_BAUDRATE_ERROR_LIMIT < l_error){
+            ret = E_NOT_OK;
+        }
+        else{ /* Nothing */ }
+    }
+    
+    return ret;
+}
+
+static void usart_baudrate_auto_select(usart_t * _usart_obj){
+    uint8 l_index = ZERO_INIT;
+    uint16 l_brg = ZERO_INIT;
+    sint16 l_error = ZERO_INIT;
+    uint16 l_abs_error = ZERO_INIT;
+    uint16 l_best_error = 0xFFFF;
+    
+    /* Fallback when no mode can reach the requested rate */
+    _usart_obj->baudrate_cfg = BAUDRATE_ASYNC_16BIT_HIGH_SPEED;
+    for(l_index = ZERO_INIT ; l_index < (sizeof(usart_async_modes) / sizeof(usart_async_modes[0])) ; l_index++){
+        if(E_OK == usart_brg_compute(_usart_obj->baudrate , usart_async_modes[l_index].divisor ,
+                                     usart_async_modes[l_index].brg_max , &l_brg , &l_error)){
+            l_abs_error = (l_error < 0) ? (uint16)(-l_error) : (uint16)l_error;
+            if(l_abs_error < l_best_error){
+                l_best_error = l_abs_error;
+                _usart_obj->baudrate_cfg = usart_async_modes[l_index].cfg;
+            }
+            else{ /* Nothing */ }
+        }
+        else{ /* Nothing */ }
+    }
+}
+#endif
+
+static void usart_brg_save(usart_brg_snapshot_t *snapshot){
+    snapshot->spbrg = SPBRG;
+    snapshot->spbrgh = SPBRGH;
+    snapshot->brg16 = BAUDCONbits.BRG16;
+    snapshot->brgh = TXSTAbits.BRGH;
+    snapshot->rcie = PIE1bits.RCIE;
+}
+
+static void usart_brg_restore(const usart_brg_snapshot_t *snapshot){
+    BAUDCONbits.ABDEN = EUSART_DISABLE;
+    BAUDCONbits.ABDOVF = EUSART_DISABLE;
+    BAUDCONbits.BRG16 = snapshot->brg16;
+    TXSTAbits.BRGH = snapshot->brgh;
+    SPBRGH = snapshot->spbrgh;
+    SPBRG = snapshot->spbrg;
+    PIE1bits.RCIE = snapshot->rcie;
 }
 
 static void EUSART_ASYNC_TX_Init(usart_t * _usart_obj){
@@ -241,20 +976,6 @@ static void EUSART_ASYNC_TX_Init(usart_t * _usart_obj){
 #if  EUSART_TX_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
             EUSART_TX_INTERRUPT_DISABLE();
             EUSART_TX_InterruptHandler = _usart_obj->EUSART_TX_DefaultInterruptHandler ;
-#if INTERRUPT_PRIORITY_LEVELS_ENABLE  ==  INTERRUPT_FEATURE_ENABLE
-        if(Interrupt_High_Priority == _usart_obj->usart_tx_cfg.eusart_tx_int_priority){
-            EUSART_TX_INTERRUPT_HIGH_PRIORITY();
-            INTERRUPT_GlobalInterruptHighEnable();
-        }
-        else{
-            EUSART_TX_INTERRUPT_LOW_PRIORITY();
-            INTERRUPT_GlobalInterruptLowEnable();
-        }
-        INTERRUPT_PriorityFeatureEnable();
-#else
-        INTERRUPT_GlobalInterruptEnable();
-        INTERRUPT_PeripheralInterruptEnable();
-#endif
         EUSART_TX_INTERRUPT_ENABLE();
 #endif            
         }
@@ -285,20 +1006,15 @@ static void EUSART_ASYNC_RX_Init(usart_t * _usart_obj){
             EUSART_RX_InterruptHandler    = _usart_obj->EUSART_RX_DefaultInterruptHandler ;
             EUSART_FERR_InterruptHandler  = _usart_obj->EUSART_FERR_DefaultInterruptHandler;
             EUSART_OERR_InterruptHandler  = _usart_obj->EUSART_OERR_DefaultInterruptHandler;      
-#if INTERRUPT_PRIORITY_LEVELS_ENABLE  ==  INTERRUPT_FEATURE_ENABLE
-        if(Interrupt_High_Priority == _usart_obj->usart_rx_cfg.eusart_rx_int_priority){
-            EUSART_RX_INTERRUPT_HIGH_PRIORITY();
-            INTERRUPT_GlobalInterruptHighEnable();
-        }
-        else{
-            EUSART_RX_INTERRUPT_LOW_PRIORITY();
-            INTERRUPT_GlobalInterruptLowEnable();
-        }
-        INTERRUPT_PriorityFeatureEnable();
-#else
-        INTERRUPT_GlobalInterruptEnable();
-        INTERRUPT_PeripheralInterruptEnable();
-#endif
+            EUSART_RX_FrameInterruptHandler = _usart_obj->EUSART_RX_FrameInterruptHandler;
+            rx_frame_delimiter  = _usart_obj->usart_rx_cfg.usart_rx_frame_delimiter;
+            rx_delimiter_enable = _usart_obj->usart_rx_cfg.usart_rx_delimiter_enable;
+            rx_frame_length     = _usart_obj->usart_rx_cfg.usart_rx_frame_length;
+            rx_frame_counter    = ZERO_INIT;
+            SPSC_QUEUE_RESET(rx_ring);
+            rx_counters.hw_overrun_count = ZERO_INIT;
+            rx_counters.framing_error_count = ZERO_INIT;
+            rx_counters.buffer_overflow_count = ZERO_INIT;
         EUSART_RX_INTERRUPT_ENABLE();
 #endif            
         }
@@ -319,6 +1035,17 @@ static void EUSART_ASYNC_RX_Init(usart_t * _usart_obj){
     else{ /* Nothing */ }
 }
 
+static uint8 usart_sync_bit_order_apply(uint8 _data){
+    uint8 l_data = _data;
+    
+    if(EUSART_SYNC_MSB_FIRST == usart_sync_bit_order){
+        l_data = (uint8)((usart_sync_nibble_reverse[_data & 0x0F] << 4) | usart_sync_nibble_reverse[_data >> 4]);
+    }
+    else{ /* Nothing */ }
+    
+    return l_data;
+}
+
 
 /* Section: Interrupt Service Routines */
 
@@ -326,27 +1053,34 @@ static void EUSART_ASYNC_RX_Init(usart_t * _usart_obj){
 /**
  * @brief EUSART Transmit ISR
  *
- * Handles TX interrupt and calls the user-defined callback if assigned.
+ * Handles TX interrupt and calls the user-defined callback if assigned,
+ * then moves the next queued byte from the TX ring buffer to TXREG.
+ * The TX interrupt is disabled once the ring buffer is empty.
  */
 void EUSART_TX_ISR(void){
+    usart_tx_descriptor_t *l_descriptor = &SPSC_QUEUE_FRONT(tx_descriptors);
     
     if(EUSART_TX_InterruptHandler){
         EUSART_TX_InterruptHandler();
     }else{ /* Nothing */ }
-    if(1 == write_string_flag){
-        char_counter++;
-        if(char_counter < str_length_int){
-            EUSART_ASYNC_Write_Byte_NonBlocking(Tx_buffer[char_counter]);
-        }
-        else{
-            write_string_flag = 0;
-            char_counter = 0;
-            str_length_int = 0;
-            EUSART_TX_INTERRUPT_DISABLE();
+    if((!SPSC_QUEUE_IS_EMPTY(tx_descriptors)) && (tx_ring.tail == l_descriptor->ring_position)){
+        /* The ring bytes queued before this block are out , stream it from its own memory */
+        TXREG = *(l_descriptor->data);
+        l_descriptor->data++;
+        l_descriptor->length--;
+        if(ZERO_INIT == l_descriptor->length){
+            SPSC_QUEUE_RELEASE(tx_descriptors);
         }
+        else{ /* Nothing */ }
+    }
+    else if(!SPSC_QUEUE_IS_EMPTY(tx_ring)){
+        TXREG = SPSC_QUEUE_FRONT(tx_ring);
+        SPSC_QUEUE_RELEASE(tx_ring);
     }
     else{
+        /* Ring buffer and blocks drained , the power manager waits for TRMT before SLEEP */
         EUSART_TX_INTERRUPT_DISABLE();
+        (void)Power_Vote_Idle(POWER_VOTE_EUSART_TX);
     }
 }
 #endif
@@ -355,19 +1089,85 @@ void EUSART_TX_ISR(void){
 /**
  * @brief EUSART Receive ISR
  *
- * Handles RX, Framing Error (FERR), and Overrun Error (OERR) interrupts.
- * Calls the user-defined callbacks if assigned.
+ * Drains the 2-byte hardware FIFO into the RX ring buffer and counts
+ * Framing Error (FERR), Overrun Error (OERR) and ring buffer overflow events.
+ * The frame callback fires once per ISR when the delimiter or the configured
+ * number of bytes has arrived. Calls the user-defined callbacks if assigned.
  */
 void EUSART_RX_ISR(void){
+    uint8 l_data = ZERO_INIT;
+    uint8 l_frame_ready = ZERO_INIT;
+#if   EUSART_RS485_CFG == EUSART_RS485_ENABLE
+    uint8 l_ninth_bit = ZERO_INIT;
+#endif
+    
+    while(INTERRUPT_OCCUR == PIR1bits.RCIF){
+#if   EUSART_RS485_CFG == EUSART_RS485_ENABLE
+        /* RX9D also belongs to the top of the FIFO */
+        l_ninth_bit = RCSTAbits.RX9D;
+#endif
+        /* FERR belongs to the byte on top of the FIFO , check it before reading RCREG */
+        if(EUSART_FRAMING_ERROR_DETECTED == RCSTAbits.FERR){
+            rx_counters.framing_error_count++;
+            if(EUSART_FERR_InterruptHandler){
+                EUSART_FERR_InterruptHandler();
+            }else{ /* Nothing */ }
+        }
+        else{ /* Nothing */ }
+        l_data = RCREG ;
+#if   EUSART_RS485_CFG == EUSART_RS485_ENABLE
+        if((EUSART_MULTIDROP_NO_ADDRESS != multidrop_node_address) && (EUSART_MULTIDROP_ADDRESS_FRAME == l_ninth_bit)){
+            /* Address byte , not stored : listen to the frame when it is for this node or everyone */
+            if((multidrop_node_address == l_data) || (EUSART_MULTIDROP_BROADCAST_ADDRESS == l_data)){
+                multidrop_frame_address = l_data;
+                RCSTAbits.ADDEN = EUSART_DISABLE;
+            }
+            else{
+                RCSTAbits.ADDEN = EUSART_ENABLE;
+            }
+            rx_frame_counter = ZERO_INIT;
+        }
+        else
+#endif
+        {
+            if(!SPSC_QUEUE_IS_FULL(rx_ring)){
+                SPSC_QUEUE_BACK(rx_ring) = l_data;
+                SPSC_QUEUE_PUBLISH(rx_ring , 1);
+            }
+            else{
+                rx_counters.buffer_overflow_count++;
+            }
+            rx_frame_counter++;
+            if(((EUSART_RX_DELIMITER_ENABLE == rx_delimiter_enable) && (rx_frame_delimiter == l_data)) ||
+               ((EUSART_RX_FRAME_LENGTH_DISABLE != rx_frame_length) && (rx_frame_length <= rx_frame_counter))){
+                rx_frame_counter = ZERO_INIT;
+                l_frame_ready = 1;
+#if   EUSART_RS485_CFG == EUSART_RS485_ENABLE
+                /* Frame complete : back to address bytes only */
+                if(EUSART_MULTIDROP_NO_ADDRESS != multidrop_node_address){
+                    RCSTAbits.ADDEN = EUSART_ENABLE;
+                }
+                else{ /* Nothing */ }
+#endif
+            }
+            else{ /* Nothing */ }
+        }
+    }
+    if(EUSART_OVERRUN_ERROR_DETECTED == RCSTAbits.OERR){
+        rx_counters.hw_overrun_count++;
+        /* OERR is only cleared by resetting the receive logic */
+        RCSTAbits.CREN = EUSART_ASYNCHRONOUS_RX_DISABLE;
+        RCSTAbits.CREN = EUSART_ASYNCHRONOUS_RX_ENABLE;
+        if(EUSART_OERR_InterruptHandler){
+            EUSART_OERR_InterruptHandler();
+        }else{ /* Nothing */ }
+    }
+    else{ /* Nothing */ }
     if(EUSART_RX_InterruptHandler){
-        *l_data = RCREG ; 
         EUSART_RX_InterruptHandler();
     }else{ /* Nothing */ }
-    if(EUSART_FERR_InterruptHandler){
-        EUSART_FERR_InterruptHandler();
-    }else{ /* Nothing */ }
-    if(EUSART_OERR_InterruptHandler){
-        EUSART_OERR_InterruptHandler();
+    if((1 == l_frame_ready) && (EUSART_RX_FrameInterruptHandler)){
+        EUSART_RX_FrameInterruptHandler();
     }else{ /* Nothing */ }
 }
 #endif
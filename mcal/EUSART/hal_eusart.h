@@ -13,6 +13,8 @@
  * - 9-bit data transmission and reception
  * - Interrupt-driven TX/RX handling
  * - Framing and overrun error detection
+ * - Auto-baud detection (ABDEN) and runtime baud rate switching
+ * - RS-485 driver-enable pin and 9-bit multidrop addressing (EUSART_RS485_CFG)
  *
  * Design follows:
  * - Bare-metal embedded best practices
@@ -30,6 +32,7 @@
 #include"mcal_internal_interrupt.h"
 #include"hal_gpio.h"
 #include"std_types.h"
+#include"spsc_queue.h"
 
 /* Section : Macro Declaration */
 
@@ -76,8 +79,110 @@
 #define EUSART_OVERRUN_ERROR_DETECTED               1
 #define EUSART_OVERRUN_ERROR_CLEARED                0
 
+/* Baud Rate Generator Divisors (Fosc / (divisor * (n + 1))) */
+#define EUSART_BRG_DIVISOR_ASYNC_8BIT_LOW           64UL
+#define EUSART_BRG_DIVISOR_ASYNC_8BIT_HIGH          16UL
+#define EUSART_BRG_DIVISOR_ASYNC_16BIT_LOW          16UL
+#define EUSART_BRG_DIVISOR_ASYNC_16BIT_HIGH         4UL
+#define EUSART_BRG_DIVISOR_SYNC                     4UL
+
+/* Largest accepted baud error in 0.01 % units , EUSART_ASYNC_Init returns E_NOT_OK above it */
+#define EUSART_BAUDRATE_ERROR_LIMIT                 250
+
+/* Compile-Time Baud Rate Selection
+ * When enabled , EUSART_ASYNC_Init ignores usart_t.baudrate / baudrate_cfg and loads
+ * SPBRGH:SPBRG with a value folded by the compiler from EUSART_STATIC_BAUDRATE
+ * (async , 16-bit BRG , high speed : the finest divider the EUSART offers).
+ */
+#define EUSART_STATIC_BAUDRATE_ENABLE               1
+#define EUSART_STATIC_BAUDRATE_DISABLE              0
+
+#define EUSART_STATIC_BAUDRATE_CFG                  EUSART_STATIC_BAUDRATE_DISABLE
+#define EUSART_STATIC_BAUDRATE                      9600UL
+
+/* TX Ring Buffer Size (bytes) , MUST be a power of two (2 .. 128) */
+#define EUSART_TX_BUFFER_SIZE                       64
+
+#if !SPSC_QUEUE_SIZE_VALID(EUSART_TX_BUFFER_SIZE)
+#error "EUSART_TX_BUFFER_SIZE must be a power of two between 2 and 128"
+#endif
+
+/* Constant blocks queued by EUSART_ASYNC_Write_Const_NonBlocking , power of two (2 .. 16) */
+#define EUSART_TX_DESCRIPTOR_COUNT                  4
+
+#if !SPSC_QUEUE_SIZE_VALID(EUSART_TX_DESCRIPTOR_COUNT) || (EUSART_TX_DESCRIPTOR_COUNT > 16)
+#error "EUSART_TX_DESCRIPTOR_COUNT must be a power of two between 2 and 16"
+#endif
+
+/* RX Ring Buffer Size (bytes) , MUST be a power of two (2 .. 128) */
+#define EUSART_RX_BUFFER_SIZE                       64
+
+#if !SPSC_QUEUE_SIZE_VALID(EUSART_RX_BUFFER_SIZE)
+#error "EUSART_RX_BUFFER_SIZE must be a power of two between 2 and 128"
+#endif
+
+/* RX Frame Delimiter Detection */
+#define EUSART_RX_DELIMITER_ENABLE                  1
+#define EUSART_RX_DELIMITER_DISABLE                 0
+
+/* RX Frame Length , 0 disables the N-byte frame event */
+#define EUSART_RX_FRAME_LENGTH_DISABLE              0
+
+/* RS-485 Support
+ * When enabled , usart_t carries a usart_rs485_cfg_t : a transceiver DE pin
+ * driven high while sending , and a multidrop node address. An addressed node
+ * runs with ADDEN set , so the receiver hardware drops every data byte (9th
+ * bit 0) and only address bytes (9th bit 1) raise RCIF. A matching address
+ * clears ADDEN for the frame that follows , the end of the frame sets it again.
+ * Multidrop needs EUSART_RX_INTERRUPT_FEATURE_ENABLE.
+ */
+#define EUSART_RS485_ENABLE                         1
+#define EUSART_RS485_DISABLE                        0
+
+#define EUSART_RS485_CFG                            EUSART_RS485_DISABLE
+
+#define EUSART_RS485_DE_ENABLE                      1
+#define EUSART_RS485_DE_DISABLE                     0
+
+/* Address byte accepted by every node , a node must not reply to it */
+#define EUSART_MULTIDROP_BROADCAST_ADDRESS          0x00
+/* usart_rs485_cfg_t.node_address : no address filter , 8 or 9-bit as configured */
+#define EUSART_MULTIDROP_NO_ADDRESS                 0xFF
+
+/* 9th bit values on the line */
+#define EUSART_MULTIDROP_DATA_FRAME                 0
+#define EUSART_MULTIDROP_ADDRESS_FRAME              1
+
+/* Synchronous master : clock idle level (SCKP) and bit order */
+#define EUSART_SYNC_CLOCK_IDLE_LOW                  0
+#define EUSART_SYNC_CLOCK_IDLE_HIGH                 1
+#define EUSART_SYNC_LSB_FIRST                       0
+#define EUSART_SYNC_MSB_FIRST                       1
+
+/* CSRC : clock from the BRG */
+#define EUSART_SYNC_MASTER_MODE                     1
+#define EUSART_SYNC_SLAVE_MODE                      0
+
+/* Fastest synchronous clock , SPBRGH:SPBRG = 0 */
+#define EUSART_SYNC_CLOCK_MAX                       ((uint32)_XTAL_FREQ / EUSART_BRG_DIVISOR_SYNC)
+
 /* Section : Macro Functions Declarations */
 
+/**
+ * @brief Rounded SPBRGH:SPBRG value for a baud rate and BRG divisor.
+ * @note  Folds to a constant when both arguments are constants.
+ */
+#define EUSART_BRG_VALUE(_baud , _div)          ((((_XTAL_FREQ) + (((_div) * (_baud)) / 2UL)) / ((_div) * (_baud))) - 1UL)
+
+/**
+ * @brief Baud rate actually produced by EUSART_BRG_VALUE(_baud , _div).
+ */
+#define EUSART_ACTUAL_BAUDRATE(_baud , _div)    ((_XTAL_FREQ) / ((_div) * (EUSART_BRG_VALUE(_baud , _div) + 1UL)))
+
+/**
+ * @brief Baud rate error in 0.01 % units (basis points) , signed.
+ */
+#define EUSART_BAUDRATE_ERROR(_baud , _div)     ((sint16)((((sint32)EUSART_ACTUAL_BAUDRATE(_baud , _div) - (sint32)(_baud)) * 10000L) / (sint32)(_baud)))
 
 /* Section : Data Types Declarations */
 
@@ -93,9 +198,22 @@ typedef enum{
     BAUDRATE_ASYNC_16BIT_LOW_SPEED ,
     BAUDRATE_ASYNC_16BIT_HIGH_SPEED ,
     BAUDRATE_SYNC_8BIT ,
-    BAUDRATE_SYNC_16BIT        
+    BAUDRATE_SYNC_16BIT ,
+    BAUDRATE_ASYNC_AUTO                 /* Pick the asynchronous mode with the lowest baud error */
 }baudrate_gen_t;
 
+/**
+ * @brief Auto-Baud Detection State
+ *
+ * Returned by EUSART_ASYNC_AutoBaud_Poll.
+ */
+typedef enum{
+    EUSART_AUTOBAUD_IDLE ,              /* No measurement started , or aborted */
+    EUSART_AUTOBAUD_RUNNING ,           /* Waiting for the 'U' (0x55) sync character */
+    EUSART_AUTOBAUD_DONE ,              /* BRG loaded , usart_t.baudrate holds the measured rate */
+    EUSART_AUTOBAUD_OVERFLOW            /* BRG counter rolled over (line too slow or held low) , previous rate restored */
+}usart_autobaud_state_t;
+
 /**
  * @brief EUSART Transmitter Configuration
  *
@@ -103,7 +221,6 @@ typedef enum{
  * It supports enabling TX, 9-bit transmission, and TX interrupts.
  */
 typedef struct{
-    INTERRUPT_Priority_cfg eusart_tx_int_priority;
     uint8 usart_tx_enable : 1 ;
     uint8 usart_tx_9bit_enable : 1 ;
     uint8 usart_tx_interrupt_enable : 1 ;
@@ -117,11 +234,13 @@ typedef struct{
  * It supports enabling RX, 9-bit reception, and RX interrupts.
  */
 typedef struct{
-    INTERRUPT_Priority_cfg eusart_rx_int_priority;
+    uint8 usart_rx_frame_delimiter ;            /* Byte that closes a frame (e.g. '\n') */
+    uint8 usart_rx_frame_length ;               /* Bytes per frame , EUSART_RX_FRAME_LENGTH_DISABLE to ignore */
     uint8 usart_rx_enable : 1 ;
     uint8 usart_rx_9bit_enable : 1 ;
     uint8 usart_rx_interrupt_enable : 1 ;
-    uint8 usart_rx_reserved : 5 ;
+    uint8 usart_rx_delimiter_enable : 1 ;
+    uint8 usart_rx_reserved : 4 ;
 }usart_rx_cfg_t;
 
 /**
@@ -139,6 +258,37 @@ typedef union{
     uint8 error_status ;
 }usart_error_status_t;
 
+/**
+ * @brief EUSART RX Error Counters
+ *
+ * Accumulated since EUSART_ASYNC_Init.
+ * - hw_overrun_count     : OERR events (RCREG FIFO overrun in hardware)
+ * - framing_error_count  : FERR events
+ * - buffer_overflow_count: bytes dropped because the RX ring buffer was full
+ */
+typedef struct{
+    uint16 hw_overrun_count ;
+    uint16 framing_error_count ;
+    uint16 buffer_overflow_count ;
+}usart_rx_counters_t;
+
+#if EUSART_RS485_CFG == EUSART_RS485_ENABLE
+/**
+ * @brief EUSART RS-485 Configuration
+ *
+ * - de_pin       : Transceiver DE (and /RE tied to it) , high while a byte is on the line
+ * - node_address : Own multidrop address (0x01 .. 0xFE) , EUSART_MULTIDROP_NO_ADDRESS
+ *                  for a plain RS-485 link without address filter
+ * - de_enable    : EUSART_RS485_DE_ENABLE to drive de_pin
+ */
+typedef struct{
+    pin_config_t de_pin ;
+    uint8 node_address ;
+    uint8 de_enable : 1 ;
+    uint8 reserved : 7 ;
+}usart_rs485_cfg_t;
+#endif
+
 /**
  * @brief EUSART Configuration Object
  *
@@ -147,10 +297,14 @@ typedef union{
  */
 typedef struct{
     uint32 baudrate ;
-    baudrate_gen_t baudrate_cfg ;
+    baudrate_gen_t baudrate_cfg ;       /* BAUDRATE_ASYNC_AUTO is replaced by the selected mode */
+    sint16 baudrate_error ;             /* Filled by EUSART_ASYNC_Init , 0.01 % units */
     usart_tx_cfg_t usart_tx_cfg ;
     usart_rx_cfg_t usart_rx_cfg ;
     usart_error_status_t error_status ;
+#if     EUSART_RS485_CFG == EUSART_RS485_ENABLE
+    usart_rs485_cfg_t usart_rs485_cfg ;
+#endif
 #if     INTERRUPT_FEATURE_ENABLE == EUSART_TX_INTERRUPT_FEATURE_ENABLE    
     void (* EUSART_TX_DefaultInterruptHandler)(void);
 #endif
@@ -160,9 +314,26 @@ typedef struct{
 #if     (INTERRUPT_FEATURE_ENABLE == EUSART_RX_INTERRUPT_FEATURE_ENABLE) 
     void (* EUSART_FERR_DefaultInterruptHandler)(void);
     void (* EUSART_OERR_DefaultInterruptHandler)(void);
+    void (* EUSART_RX_FrameInterruptHandler)(void);     /* Delimiter or N-byte frame received */
 #endif
 }usart_t;
 
+/**
+ * @brief Synchronous master configuration
+ *
+ * CK on RC6 , DT on RC7. The clock is the fastest one at or below
+ * `clock_frequency` , EUSART_SYNC_CLOCK_MAX (Fosc / 4) with BRG = 0.
+ * With `clock_idle` EUSART_SYNC_CLOCK_IDLE_HIGH the data changes on the
+ * falling edge and is stable on the rising edge , as 74HC595 / 74HC165
+ * chains need.
+ */
+typedef struct{
+    uint32 clock_frequency ;            /* Hz , filled with the actual clock by Init */
+    uint8 clock_idle : 1 ;              /* EUSART_SYNC_CLOCK_IDLE_LOW / _HIGH */
+    uint8 bit_order  : 1 ;              /* EUSART_SYNC_LSB_FIRST (hardware order) / EUSART_SYNC_MSB_FIRST */
+    uint8 reserved   : 6 ;
+}usart_sync_t;
+
 /* Section : Function Declarations */
 
 /* Section: Function Declarations */
@@ -175,9 +346,16 @@ typedef struct{
  *
  * @param _usart_obj Pointer to a `usart_t` object containing configuration parameters.
  *
+ * The SPBRGH:SPBRG value is computed with rounded integer math and the
+ * resulting baud error is written back to `baudrate_error`.
+ *
  * @return Std_ReturnType
  * - E_OK: Initialization successful
- * - E_NOT_OK: Initialization failed
+ * - E_NOT_OK: Null pointer , zero baud rate , BRG out of range ,
+ *             error above EUSART_BAUDRATE_ERROR_LIMIT , or a multidrop
+ *             node address without the RX interrupt
+ *
+ * @note A multidrop node address forces TX9 and RX9 and sets ADDEN.
  */
 Std_ReturnType EUSART_ASYNC_Init(usart_t * _usart_obj);
 
@@ -195,6 +373,84 @@ Std_ReturnType EUSART_ASYNC_Init(usart_t * _usart_obj);
  */
 Std_ReturnType EUSART_ASYNC_DeInit(usart_t * _usart_obj);
 
+#if EUSART_STATIC_BAUDRATE_CFG == EUSART_STATIC_BAUDRATE_DISABLE
+/**
+ * @brief Switches the baud rate of a running EUSART , without re-initialization.
+ *
+ * Only the baud rate generator is reloaded : rings , counters , callbacks
+ * and the receiver state are kept. Keep `baudrate_cfg` for the mode picked
+ * at init , or set it to BAUDRATE_ASYNC_AUTO to pick the mode again.
+ * Both ends switch between frames , e.g. after the acknowledge of the
+ * switch request has gone out (the call refuses while TX is busy).
+ *
+ * @param _usart_obj Pointer to the initialized `usart_t` object.
+ * @param baudrate New baud rate (bps).
+ *
+ * @return Std_ReturnType
+ * - E_OK: New rate loaded , `baudrate_cfg` / `baudrate_error` updated
+ * - E_NOT_OK: Null pointer , transmitter busy , auto-baud running , or rate
+ *             not reachable : the previous rate stays
+ */
+Std_ReturnType EUSART_ASYNC_Set_Baudrate(usart_t * _usart_obj , uint32 baudrate);
+
+/**
+ * @brief Recomputes the BRG for a new Fosc , the clock-change hook of the EUSART.
+ *
+ * Call it from a clock manager listener (hal_clock.h). Waits for the
+ * character in the shift register , then reloads the BRG for the same
+ * `baudrate` at the new Fosc (`baudrate_error` updated).
+ *
+ * @param _usart_obj Pointer to the initialized `usart_t` object.
+ * @param fosc New oscillator frequency (Hz).
+ *
+ * @return Std_ReturnType
+ * - E_OK: BRG reloaded
+ * - E_NOT_OK: Null pointer , zero Fosc or baud rate not reachable at that
+ *             Fosc : the BRG is unchanged (and now wrong)
+ */
+Std_ReturnType EUSART_ASYNC_Clock_Update(usart_t * _usart_obj , uint32 fosc);
+#endif
+
+/**
+ * @brief Starts an auto-baud measurement (ABDEN).
+ *
+ * The BRG is switched to 16-bit high speed (finest count , 31 bps at least
+ * at 8 MHz) and counts the next received character , which must be 'U'
+ * (0x55). The RX interrupt is masked meanwhile , the measurement byte is
+ * discarded. Poll the result with EUSART_ASYNC_AutoBaud_Poll.
+ *
+ * @return Std_ReturnType
+ * - E_OK: Measurement armed
+ * - E_NOT_OK: Receiver off , synchronous mode or measurement already running
+ */
+Std_ReturnType EUSART_ASYNC_AutoBaud_Start(void);
+
+/**
+ * @brief Checks an auto-baud measurement , call it until it leaves RUNNING.
+ *
+ * On completion the measured rate is written to `baudrate` with
+ * BAUDRATE_ASYNC_16BIT_HIGH_SPEED in `baudrate_cfg`. A BRG overflow (ABDOVF)
+ * ends the measurement and restores the previous rate.
+ *
+ * @param _usart_obj Pointer to the initialized `usart_t` object.
+ * @param state Pointer to store the measurement state.
+ *
+ * @return Std_ReturnType
+ * - E_OK: State returned
+ * - E_NOT_OK: Null pointer
+ */
+Std_ReturnType EUSART_ASYNC_AutoBaud_Poll(usart_t * _usart_obj , usart_autobaud_state_t *state);
+
+/**
+ * @brief Stops a running auto-baud measurement , e.g. on the caller's timeout.
+ *
+ * The previous rate and RX interrupt state are restored.
+ *
+ * @return Std_ReturnType
+ * - E_OK: Measurement stopped (or none running)
+ */
+Std_ReturnType EUSART_ASYNC_AutoBaud_Abort(void);
+
 /**
  * @brief Reads a single byte from the EUSART in blocking mode.
  *
@@ -208,11 +464,27 @@ Std_ReturnType EUSART_ASYNC_DeInit(usart_t * _usart_obj);
  */
 Std_ReturnType EUSART_ASYNC_Read_Byte_Blocking(uint8 *_data);
 
+/**
+ * @brief Reads a received byte if one is waiting in the hardware FIFO.
+ *
+ * Never waits and never uses the RX ring buffer , for receivers polled
+ * with interrupts off (e.g. the bootloader). An overrun (OERR) stops the
+ * receiver : it is restarted here and the call reports no byte , the bytes
+ * lost with it show up in the caller's frame check.
+ *
+ * @param _data Pointer to store the received byte.
+ *
+ * @return Std_ReturnType
+ * - E_OK: Byte read from RCREG
+ * - E_NOT_OK: Null pointer , nothing received or overrun cleared
+ */
+Std_ReturnType EUSART_ASYNC_Read_Byte_Polled(uint8 *_data);
+
 /**
  * @brief Reads a single byte from the EUSART in non-blocking mode.
  *
- * Returns immediately. If data is available, it is stored in `_data`.
- * Otherwise, the function returns an error.
+ * Returns immediately. If the RX ring buffer holds data, the oldest byte
+ * is stored in `_data`. Otherwise, the function returns an error.
  *
  * @param _data Pointer to store the received byte.
  *
@@ -222,6 +494,44 @@ Std_ReturnType EUSART_ASYNC_Read_Byte_Blocking(uint8 *_data);
  */
 #if     INTERRUPT_FEATURE_ENABLE == EUSART_RX_INTERRUPT_FEATURE_ENABLE 
 Std_ReturnType EUSART_ASYNC_Read_Byte_NonBlocking(uint8 *_data);
+
+/**
+ * @brief Reads up to `max_length` bytes from the RX ring buffer.
+ *
+ * Stops early after copying the frame delimiter (when delimiter detection is
+ * enabled), so one call returns one frame.
+ *
+ * @param _data Pointer to the destination buffer.
+ * @param max_length Size of the destination buffer.
+ * @param read_length Pointer to store the number of bytes copied.
+ *
+ * @return Std_ReturnType
+ * - E_OK: Zero or more bytes copied
+ * - E_NOT_OK: Null pointer
+ */
+Std_ReturnType EUSART_ASYNC_Read_Buffer(uint8 *_data , uint8 max_length , uint8 *read_length);
+
+/**
+ * @brief Gets the number of bytes waiting in the RX ring buffer.
+ *
+ * @param available Pointer to store the number of bytes.
+ *
+ * @return Std_ReturnType
+ * - E_OK: Count returned
+ * - E_NOT_OK: Null pointer
+ */
+Std_ReturnType EUSART_ASYNC_RX_Get_Available(uint8 *available);
+
+/**
+ * @brief Gets a snapshot of the RX error counters.
+ *
+ * @param counters Pointer to store the counters.
+ *
+ * @return Std_ReturnType
+ * - E_OK: Counters copied
+ * - E_NOT_OK: Null pointer
+ */
+Std_ReturnType EUSART_ASYNC_RX_Get_Counters(usart_rx_counters_t *counters);
 #endif
 
 /**
@@ -250,19 +560,34 @@ Std_ReturnType EUSART_ASYNC_Write_Byte_Blocking(uint8 _data);
  * - E_OK: String successfully transmitted
  * - E_NOT_OK: Transmission failed
  */
-Std_ReturnType EUSART_ASYNC_Write_String_Blocking(uint8 *_data , uint16 str_length);
+Std_ReturnType EUSART_ASYNC_Write_String_Blocking(const uint8 *_data , uint16 str_length);
+
+/**
+ * @brief Tells whether the last byte has left the transmit shift register.
+ *
+ * TRMT set , and with EUSART_TX_INTERRUPT_FEATURE_ENABLE nothing left in
+ * the TX ring buffer or the constant block queue. A half-duplex driver
+ * (RS-485 DE pin) releases the bus only then.
+ *
+ * @param is_idle Pointer to store TRUE when idle , FALSE otherwise.
+ *
+ * @return Std_ReturnType
+ * - E_OK: State returned
+ * - E_NOT_OK: Null pointer
+ */
+Std_ReturnType EUSART_ASYNC_TX_Is_Idle(uint8 *is_idle);
 
 /**
  * @brief Writes a single byte to the EUSART in non-blocking mode.
  *
- * Returns immediately. If the transmitter is ready, the byte is sent.
- * Otherwise, the function returns an error.
+ * Appends the byte to the TX ring buffer and returns immediately.
+ * The byte is moved to TXREG by EUSART_TX_ISR.
  *
  * @param _data Byte to transmit.
  *
  * @return Std_ReturnType
- * - E_OK: Byte successfully transmitted
- * - E_NOT_OK: Transmitter not ready
+ * - E_OK: Byte queued for transmission
+ * - E_NOT_OK: TX ring buffer is full
  */
 #if     INTERRUPT_FEATURE_ENABLE == EUSART_TX_INTERRUPT_FEATURE_ENABLE
 Std_ReturnType EUSART_ASYNC_Write_Byte_NonBlocking(uint8 _data);
@@ -271,19 +596,147 @@ Std_ReturnType EUSART_ASYNC_Write_Byte_NonBlocking(uint8 _data);
 /**
  * @brief Writes a string of bytes to the EUSART in non-blocking mode.
  *
- * Transmits each byte in `_data` sequentially if the transmitter is ready.
- * Returns an error if the transmitter is busy at any point.
+ * Appends the whole string behind any data already queued in the TX ring
+ * buffer and returns immediately. Nothing is queued if the string does not
+ * fit in the free space, so frames are never split.
  *
  * @param _data Pointer to the array of bytes (string) to transmit.
  * @param str_length Length of the string/array to transmit.
  *
  * @return Std_ReturnType
- * - E_OK: String successfully transmitted
- * - E_NOT_OK: Transmission failed due to busy transmitter
+ * - E_OK: String queued for transmission
+ * - E_NOT_OK: Null pointer or not enough free space in the TX ring buffer
  */
 #if     INTERRUPT_FEATURE_ENABLE == EUSART_TX_INTERRUPT_FEATURE_ENABLE
-Std_ReturnType EUSART_ASYNC_Write_String_NonBlocking(uint8 *_data , uint16 str_length);
+Std_ReturnType EUSART_ASYNC_Write_String_NonBlocking(const uint8 *_data , uint16 str_length);
+
+/**
+ * @brief Queues a constant block for non-blocking transmission , without copying it.
+ *
+ * Only the (pointer , length) pair is queued. EUSART_TX_ISR sends the block
+ * straight from its own memory once the bytes queued before it are out ,
+ * so ring buffer writes and constant blocks leave in call order. A string
+ * literal or a const table stays in flash and takes no TX ring space.
+ *
+ * @param _data Pointer to the block , const data in flash or a buffer left untouched until sent.
+ * @param length Block length , 1 .. 65535 bytes.
+ *
+ * @return Std_ReturnType
+ * - E_OK: Block queued for transmission
+ * - E_NOT_OK: Null pointer , zero length or EUSART_TX_DESCRIPTOR_COUNT blocks already pending
+ */
+Std_ReturnType EUSART_ASYNC_Write_Const_NonBlocking(const uint8 *_data , uint16 length);
+
+/**
+ * @brief Gets the number of free bytes in the TX ring buffer.
+ *
+ * @param free_space Pointer to store the free space in bytes.
+ *
+ * @return Std_ReturnType
+ * - E_OK: Free space returned
+ * - E_NOT_OK: Null pointer
+ */
+Std_ReturnType EUSART_ASYNC_TX_Get_Free_Space(uint8 *free_space);
+#endif
+
+#if     EUSART_RS485_CFG == EUSART_RS485_ENABLE
+/**
+ * @brief Drops the RS-485 DE pin once the last byte has left the shift register.
+ *
+ * TRMT has no interrupt : call it from the main loop. DE goes low on the
+ * first call that finds EUSART_ASYNC_TX_Is_Idle , so the bus turns around
+ * one main loop pass after the stop bit at most.
+ *
+ * @return Std_ReturnType
+ * - E_OK: DE released , or still needed
+ */
+Std_ReturnType EUSART_ASYNC_RS485_Process(void);
+
+/**
+ * @brief Sends a multidrop address byte (9th bit set) , blocking.
+ *
+ * Raises DE , waits until everything queued before it is out (TX9D goes
+ * with the byte in TXREG) , then sends the address with TX9D set. Data
+ * bytes written afterwards by any write API go out with TX9D clear.
+ *
+ * @param address Node address , or EUSART_MULTIDROP_BROADCAST_ADDRESS.
+ *
+ * @return Std_ReturnType
+ * - E_OK: Address byte in the shift register
+ * - E_NOT_OK: Transmitter not in 9-bit mode
+ */
+Std_ReturnType EUSART_ASYNC_Multidrop_Write_Address(uint8 address);
+
+#if     INTERRUPT_FEATURE_ENABLE == EUSART_RX_INTERRUPT_FEATURE_ENABLE
+/**
+ * @brief Gets the address byte that opened the frame being received.
+ *
+ * Own node address or EUSART_MULTIDROP_BROADCAST_ADDRESS , a broadcast frame
+ * gets no reply.
+ *
+ * @param address Pointer to store the address.
+ *
+ * @return Std_ReturnType
+ * - E_OK: Address returned
+ * - E_NOT_OK: Null pointer or no frame selected this node yet
+ */
+Std_ReturnType EUSART_ASYNC_Multidrop_Get_Address(uint8 *address);
+#endif
 #endif
 
+/**
+ * @brief Initializes the EUSART as a synchronous master (polled , half duplex).
+ *
+ * Takes the module over from the asynchronous driver : SPEN is cleared ,
+ * TXIE / RCIE are disabled and auto-baud is stopped. Call EUSART_ASYNC_Init
+ * again to go back to asynchronous mode.
+ *
+ * @param _sync_obj Pointer to the configuration , `clock_frequency` is
+ *                  replaced by the clock actually generated.
+ *
+ * @return Std_ReturnType
+ * - E_OK: Master running
+ * - E_NOT_OK: Null pointer , zero clock , or clock below Fosc / 262144
+ */
+Std_ReturnType EUSART_SYNC_Master_Init(usart_sync_t * _sync_obj);
+
+/**
+ * @brief Stops the synchronous master , CK and DT are released.
+ *
+ * @return Std_ReturnType
+ * - E_OK: Module disabled
+ */
+Std_ReturnType EUSART_SYNC_Master_DeInit(void);
+
+/**
+ * @brief Shifts bytes out on DT , blocking.
+ *
+ * TXREG is reloaded as soon as it empties. Returns once the last bit has
+ * left the shift register (TRMT) : a latch pulse right after it is safe.
+ *
+ * @param _data  Bytes , _data[0] first.
+ * @param length Number of bytes.
+ *
+ * @return Std_ReturnType
+ * - E_OK: Bytes sent
+ * - E_NOT_OK: Null pointer , zero length or master not initialized
+ */
+Std_ReturnType EUSART_SYNC_Master_Write(const uint8 *_data , uint16 length);
+
+/**
+ * @brief Clocks bytes in from DT , blocking.
+ *
+ * One single receive (SREN) per byte , the transmitter is held off while
+ * DT is an input.
+ *
+ * @param _data  Buffer , _data[0] is the first byte clocked in.
+ * @param length Number of bytes.
+ *
+ * @return Std_ReturnType
+ * - E_OK: Bytes received
+ * - E_NOT_OK: Null pointer , zero length or master not initialized
+ */
+Std_ReturnType EUSART_SYNC_Master_Read(uint8 *_data , uint16 length);
+
 
 #endif	/* HAL_EUSART_H */
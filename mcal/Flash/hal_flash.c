@@ -0,0 +1,244 @@
+/**
+ * @file   hal_flash.c
+ * @author Abdelmoniem Ahmed
+ * @brief  HAL Program Flash self-programming driver implementation
+ *
+ * @details
+ * Driver Characteristics:
+ * -----------------------
+ * - Polling-based implementation , the CPU stall ends every cycle
+ * - Row erase / row write with read back verification
+ * - Block write through one RAM row buffer , erase only when needed
+ * - Atomic unlock sequence , interrupt state preservation
+ * - Shares EECON1 with hal_eeprom : a running EEPROM write cycle is
+ *   waited for and the queued EEPROM writer is held off meanwhile
+ *
+ * Table pointer:
+ * --------------
+ * TBLPTR is loaded byte by byte and moved by TBLRD*+ / TBLWT*+ only ,
+ * nothing in between may read constants from flash.
+ */
+
+
+#include"hal_flash.h"
+
+/* Section : Static Variables */
+
+/* Row being merged by Flash_Write_Block */
+static uint8 flash_row_buffer[FLASH_ROW_SIZE];
+
+/* Static Function Declaration */
+
+static void Flash_Set_Table_Pointer(uint32 address);
+static uint8 Flash_Row_Is_Erased(uint32 address);
+static Std_ReturnType Flash_Start_Cycle(uint8 row_erase);
+
+/* Section : Function Definitions */
+
+Std_ReturnType Flash_Read_Block(uint32 address , uint8 *data , uint16 length){
+    Std_ReturnType ret = E_OK;
+    uint16 l_index = ZERO_INIT;
+
+    if((NULL == data) || (ZERO_INIT == length) || (FLASH_SIZE < (address + length))){
+        ret = E_NOT_OK;
+    }
+    else{
+        Flash_Set_Table_Pointer(address);
+        for(l_index = ZERO_INIT ; l_index < length ; l_index++){
+            asm("TBLRD*+");
+            data[l_index] = TABLAT;
+        }
+    }
+    return ret;
+}
+
+Std_ReturnType Flash_Erase_Row(uint32 address){
+    Std_ReturnType ret = E_OK;
+
+    if((FLASH_SIZE <= address) || (ZERO_INIT != (address & FLASH_ROW_MASK))){
+        ret = E_NOT_OK;
+    }
+    else{
+        Flash_Set_Table_Pointer(address);
+        ret = Flash_Start_Cycle(FLASH_ROW_ERASE_ENABLE);
+    }
+    return ret;
+}
+
+Std_ReturnType Flash_Write_Row(uint32 address , const uint8 *data){
+    Std_ReturnType ret = E_OK;
+    uint8 l_index = ZERO_INIT;
+
+    if((NULL == data) || (FLASH_SIZE <= address) || (ZERO_INIT != (address & FLASH_ROW_MASK))){
+        ret = E_NOT_OK;
+    }
+    else{
+        /* Load the 64 holding registers , TBLPTR<5:0> selects each one */
+        Flash_Set_Table_Pointer(address);
+        for(l_index = ZERO_INIT ; l_index < FLASH_ROW_SIZE ; l_index++){
+            TABLAT = data[l_index];
+            asm("TBLWT*+");
+        }
+        /* The post-increment left the row , point back into it for the cycle */
+        Flash_Set_Table_Pointer(address);
+        ret = Flash_Start_Cycle(FLASH_ROW_ERASE_DISABLE);
+
+        /* Read back , a row that was not erased comes out as the AND of both */
+        Flash_Set_Table_Pointer(address);
+        for(l_index = ZERO_INIT ; l_index < FLASH_ROW_SIZE ; l_index++){
+            asm("TBLRD*+");
+            if(TABLAT != data[l_index]){
+                ret = E_NOT_OK;
+            }
+            else{ /* Nothing */ }
+        }
+    }
+    return ret;
+}
+
+Std_ReturnType Flash_Write_Block(uint32 address , const uint8 *data , uint16 length){
+    Std_ReturnType ret = E_OK;
+    uint32 l_row_address = ZERO_INIT;
+    uint8 l_offset = ZERO_INIT;
+    uint8 l_changed = FALSE;
+    uint8 l_needs_erase = FALSE;
+
+    if((NULL == data) || (ZERO_INIT == length) || (FLASH_SIZE < (address + length))){
+        ret = E_NOT_OK;
+    }
+    else{
+        while((E_OK == ret) && (ZERO_INIT != length)){
+            l_row_address = address & ~(uint32)FLASH_ROW_MASK;
+            l_offset = (uint8)(address & FLASH_ROW_MASK);
+            (void)Flash_Read_Block(l_row_address , flash_row_buffer , FLASH_ROW_SIZE);
+            l_changed = FALSE;
+            l_needs_erase = FALSE;
+            for( ; (l_offset < FLASH_ROW_SIZE) && (ZERO_INIT != length) ; l_offset++){
+                if(flash_row_buffer[l_offset] != *data){
+                    l_changed = TRUE;
+                    /* Programming only clears bits */
+                    if(ZERO_INIT != (uint8)(*data & ~flash_row_buffer[l_offset])){
+                        l_needs_erase = TRUE;
+                    }
+                    else{ /* Nothing */ }
+                    flash_row_buffer[l_offset] = *data;
+                }
+                else{ /* Nothing */ }
+                data++;
+                address++;
+                length--;
+            }
+            if((TRUE == l_needs_erase) && (E_OK != Flash_Erase_Row(l_row_address))){
+                ret = E_NOT_OK;
+            }
+            else if(TRUE == l_changed){
+                ret = Flash_Write_Row(l_row_address , flash_row_buffer);
+            }
+            else{ /* Row already holds the data */ }
+        }
+    }
+    return ret;
+}
+
+Std_ReturnType Flash_Erase_Block(uint32 address , uint16 row_count){
+    Std_ReturnType ret = E_OK;
+
+    if((FLASH_SIZE < (address + ((uint32)row_count * FLASH_ROW_SIZE))) ||
+       (ZERO_INIT != (address & FLASH_ROW_MASK))){
+        ret = E_NOT_OK;
+    }
+    else{
+        for( ; (E_OK == ret) && (ZERO_INIT != row_count) ; row_count--){
+            /* A blank check (64 reads) is cheaper than a 2 ms erase cycle */
+            if(FALSE == Flash_Row_Is_Erased(address)){
+                ret = Flash_Erase_Row(address);
+                ret &= (TRUE == Flash_Row_Is_Erased(address)) ? E_OK : E_NOT_OK;
+            }
+            else{ /* Nothing */ }
+            address += FLASH_ROW_SIZE;
+        }
+    }
+    return ret;
+}
+
+/* Section : Static Function Definitions */
+
+static void Flash_Set_Table_Pointer(uint32 address){
+    TBLPTRU = (uint8)(address >> 16);
+    TBLPTRH = (uint8)(address >> 8);
+    TBLPTRL = (uint8)address;
+}
+
+static uint8 Flash_Row_Is_Erased(uint32 address){
+    uint8 l_erased = TRUE;
+    uint8 l_index = ZERO_INIT;
+
+    Flash_Set_Table_Pointer(address);
+    for(l_index = ZERO_INIT ; l_index < FLASH_ROW_SIZE ; l_index++){
+        asm("TBLRD*+");
+        if(FLASH_ERASED_BYTE != TABLAT){
+            l_erased = FALSE;
+        }
+        else{ /* Nothing */ }
+    }
+    return l_erased;
+}
+
+/**
+ * @brief  Erase (FREE = 1) or write cycle on the row selected by TBLPTR
+ *
+ * @return E_NOT_OK when the cycle ended with WRERR (reset during the cycle)
+ */
+static Std_ReturnType Flash_Start_Cycle(uint8 row_erase){
+    Std_ReturnType ret = E_OK;
+    uint8 Interrupt_global_Status = 0;
+    uint8 Interrupt_peripheral_Status = 0;
+#if         INTERRUPT_FEATURE_ENABLE == DATA_EEPROM_INTERRUPT_FEATURE_ENABLE
+    uint8 l_eeie = PIE2bits.EEIE ;
+
+    /* The queued EEPROM writer must not reload EECON1 under this cycle */
+    DATA_EEPROM_INTERRUPT_DISABLE();
+#endif
+    /* A Data EEPROM write cycle may still be running */
+    while(EECON1bits.WR){ /* Nothing , Just Wait */ }
+
+    /* Select Program Flash , not the configuration registers */
+    EECON1bits.EEPGD = ACCESS_FLASH_PROGRAM_MEM ;
+    EECON1bits.CFGS  = ACCESS_FLASH_NOT_CONFIG_MEM ;
+    EECON1bits.FREE  = row_erase ;
+    EECON1bits.WRERR = ZERO_INIT ;
+    EECON1bits.WREN  = FLASH_WRITE_ENABLE ;
+    /* Read The Interrupt Status "Enabled / Disabled"*/
+    Interrupt_global_Status = INTCONbits.GIE ;
+    Interrupt_peripheral_Status = INTCONbits.PEIE;
+    /* DisAble All Interrupts */
+#if                     INTERRUPT_FEATURE_DISABLE == INTERRUPT_PRIORITY_LEVELS_ENABLE
+    INTERRUPT_GlobalInterruptDisable();
+#else
+    INTERRUPT_GlobalInterruptHighDisable();
+    INTERRUPT_GlobalInterruptLowDisable();
+#endif
+    /* Write the Required Sequence -> 0x55 -> 0xAA */
+    EECON2 = 0x55 ;
+    EECON2 = 0xAA ;
+    /* Initiate the cycle , the CPU stalls until it ends */
+    EECON1bits.WR   = FLASH_CYCLE_INITIATE ;
+    NOP();
+    /* Restore INTERRUPT GIE */
+    INTCONbits.GIE = Interrupt_global_Status ;
+    INTCONbits.PEIE = Interrupt_peripheral_Status;
+    /* inhibits Write cycles */
+    EECON1bits.WREN = FLASH_WRITE_DISABLE ;
+    EECON1bits.FREE = FLASH_ROW_ERASE_DISABLE ;
+
+    if(EECON1bits.WRERR){
+        ret = E_NOT_OK;
+    }
+    else{ /* Nothing */ }
+#if         INTERRUPT_FEATURE_ENABLE == DATA_EEPROM_INTERRUPT_FEATURE_ENABLE
+    /* The cycle set EEIF , the queued EEPROM writer must not take it for its own */
+    DATA_EEPROM_INTERRUPT_CLEAR_FLAG();
+    PIE2bits.EEIE = l_eeie ;
+#endif
+    return ret;
+}
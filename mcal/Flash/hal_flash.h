@@ -0,0 +1,149 @@
+/**
+ * @file   hal_flash.h
+ * @author Abdelmoniem Ahmed
+ * @linkedin https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * @brief  HAL Program Flash self-programming driver for PIC18F4620
+ *
+ * @details
+ * Reads , erases and writes the 64 KB program flash through the table
+ * pointer (TBLPTRU:TBLPTRH:TBLPTRL) and TABLAT :
+ *  - Read       : TBLRD*+ per byte , any address , any length
+ *  - Erase row  : 64 bytes set to 0xFF , one ~2 ms cycle
+ *  - Write row  : 64 holding registers loaded with TBLWT*+ , then one
+ *                 ~2 ms cycle programs the whole row , read back to verify
+ *  - Write block: any address / length , row by row through a RAM row
+ *                 buffer (read , merge , erase only when a bit must go
+ *                 0 -> 1 , write) , rows left unchanged are skipped
+ *  - Erase block: consecutive rows , rows already blank are skipped
+ *
+ * Note:
+ *  - The CPU stalls during an erase or write cycle : no instruction runs
+ *    and interrupts wait , peripherals (EUSART receiver , timers) keep
+ *    running. A link must not deliver more than the 2-byte RCREG FIFO
+ *    meanwhile.
+ *  - Interrupts are disabled only for the 0x55 / 0xAA unlock sequence ,
+ *    like hal_eeprom.
+ *  - Nothing stops a caller from erasing the code it runs from , keep
+ *    the boot block under WRTB.
+ */
+
+#ifndef HAL_FLASH_H
+#define	HAL_FLASH_H
+
+/* Section : Includes */
+
+#include"std_types.h"
+#include"mcal_internal_interrupt.h"
+
+/* Section : Macro Declaration */
+
+/**
+ * @brief Program flash size in bytes (address range 0x0000 - 0xFFFF)
+ */
+#define FLASH_SIZE                      0x10000UL
+
+/**
+ * @brief Erase and write block , both are 64 bytes on the PIC18F4620
+ */
+#define FLASH_ROW_SIZE                  64
+#define FLASH_ROW_MASK                  (FLASH_ROW_SIZE - 1)
+#define FLASH_ROW_COUNT                 (FLASH_SIZE / FLASH_ROW_SIZE)
+
+/**
+ * @brief Contents of an erased byte
+ */
+#define FLASH_ERASED_BYTE               0xFF
+
+/**
+ * @brief EECON1 selections for a program flash cycle
+ */
+#define ACCESS_FLASH_PROGRAM_MEM        0x01
+#define ACCESS_FLASH_NOT_CONFIG_MEM     0x00
+#define FLASH_ROW_ERASE_ENABLE          0x01
+#define FLASH_ROW_ERASE_DISABLE         0x00
+#define FLASH_WRITE_ENABLE              0x01
+#define FLASH_WRITE_DISABLE             0x00
+#define FLASH_CYCLE_INITIATE            0x01
+
+/* Section : Macro Functions Declarations */
+
+/* Section : Data Types Declarations */
+
+/* Section : Function Declarations */
+
+/**
+ * @brief  Reads a block of program flash
+ *
+ * @param  address   First flash address
+ * @param  data      Pointer to the destination buffer
+ * @param  length    Number of bytes (address + length <= FLASH_SIZE)
+ *
+ * @return Std_ReturnType
+ *         - E_OK      : Operation successful
+ *         - E_NOT_OK  : Invalid parameters or range
+ */
+Std_ReturnType Flash_Read_Block(uint32 address , uint8 *data , uint16 length);
+
+/**
+ * @brief  Erases one 64-byte row to 0xFF
+ *
+ * @param  address   Row start address (multiple of FLASH_ROW_SIZE)
+ *
+ * @return Std_ReturnType
+ *         - E_OK      : Row erased
+ *         - E_NOT_OK  : Address out of range or not row aligned
+ *
+ * @note   The CPU stalls for the ~2 ms erase cycle.
+ */
+Std_ReturnType Flash_Erase_Row(uint32 address);
+
+/**
+ * @brief  Programs one 64-byte row and verifies it
+ *
+ * @param  address   Row start address (multiple of FLASH_ROW_SIZE)
+ * @param  data      FLASH_ROW_SIZE bytes , in RAM : reading a flash
+ *                   source would move TBLPTR while the holding
+ *                   registers load
+ *
+ * @return Std_ReturnType
+ *         - E_OK      : Row programmed and read back equal
+ *         - E_NOT_OK  : Invalid parameters , WRERR or read back mismatch
+ *
+ * @note   Programming only clears bits , the row must be erased first
+ *         (Flash_Erase_Row) unless every new bit is a subset of the old.
+ *         The CPU stalls for the ~2 ms write cycle.
+ */
+Std_ReturnType Flash_Write_Row(uint32 address , const uint8 *data);
+
+/**
+ * @brief  Writes a block of program flash at any address , erase handled
+ *
+ * @param  address   First flash address
+ * @param  data      Pointer to the source , RAM or flash (const)
+ * @param  length    Number of bytes (address + length <= FLASH_SIZE)
+ *
+ * @return Std_ReturnType
+ *         - E_OK      : Every touched row programmed and verified
+ *         - E_NOT_OK  : Invalid parameters or range , erase / write failure
+ *
+ * @note   Each touched row is read into the driver row buffer and merged.
+ *         A row whose new bytes only clear bits is programmed over without
+ *         an erase , an unchanged row costs no cycle. The rest of a row
+ *         that is erased is rewritten from the buffer , a reset between
+ *         the erase and the write loses that row.
+ */
+Std_ReturnType Flash_Write_Block(uint32 address , const uint8 *data , uint16 length);
+
+/**
+ * @brief  Erases consecutive rows , rows already erased are skipped
+ *
+ * @param  address   First row start address (multiple of FLASH_ROW_SIZE)
+ * @param  row_count Number of rows
+ *
+ * @return Std_ReturnType
+ *         - E_OK      : All rows read back erased
+ *         - E_NOT_OK  : Address out of range or not row aligned , erase failure
+ */
+Std_ReturnType Flash_Erase_Block(uint32 address , uint16 row_count);
+
+#endif	/* HAL_FLASH_H */
@@ -9,6 +9,7 @@
  * @linkedin <- https://www.linkedin.com/in/abdelmoniem-ahmed/ ->
  */
 #include "hal_gpio.h"
+#include "../Interrupt/mcal_interrupt_config.h"
 
 /* Arrays mapping port index to corresponding TRIS, LAT and PORT registers */
 /**
@@ -16,9 +17,17 @@
  *
  * Index corresponds to port_index_t.
  */
+#ifndef HOST_SIM_BUILD
 static volatile uint8 * const tris_registers[] = {&TRISA , &TRISB , &TRISC , &TRISD ,&TRISE  };
 static volatile uint8 * const lat_registers[]  = {&LATA  , &LATB  , &LATC  , &LATD  , &LATE  };
 static volatile uint8 * const port_registers[] = {&PORTA , &PORTB , &PORTC , &PORTD , &PORTE };
+#else
+/* Host build (tools/host_sim) : register names are hook calls without a
+   constant address , the table is fetched through the hook on every use */
+#define tris_registers  host_sim_port_registers(HOST_SIM_ADDR_TRISA)
+#define lat_registers   host_sim_port_registers(HOST_SIM_ADDR_LATA)
+#define port_registers  host_sim_port_registers(HOST_SIM_ADDR_PORTA)
+#endif
 
 
 #if CONFIG_ENABLE == GPIO_PORT_PIN_CONFIGURATION
@@ -55,7 +64,7 @@ Std_ReturnType gpio_pin_get_direction_status (const pin_config_t *_pin_config_ ,
     return ret;
 }
 
-Std_ReturnType gpio_pin_write_logic ( pin_config_t *_pin_config_ , Logic_t logic ){
+Std_ReturnType gpio_pin_write_logic (const pin_config_t *_pin_config_ , Logic_t logic ){
     Std_ReturnType ret = E_OK;
     if( (NULL == _pin_config_) || ((PORT_PIN_MAX_NUMBER-1) < _pin_config_->pin) ){
         ret = E_NOT_OK;
@@ -99,7 +108,7 @@ Std_ReturnType gpio_pin_read_logic (const pin_config_t *_pin_config_ , Logic_t *
     return ret;
 }
 
-Std_ReturnType gpio_pin_toggle_logic ( pin_config_t *_pin_config_ ){
+Std_ReturnType gpio_pin_toggle_logic (const pin_config_t *_pin_config_ ){
     Std_ReturnType ret = E_OK;
     if( (NULL == _pin_config_) || ((PORT_PIN_MAX_NUMBER-1) < _pin_config_->pin) ){
         ret = E_NOT_OK;
@@ -154,7 +163,7 @@ Std_ReturnType gpio_port_read_logic (port_index_t port , uint8 *logic){
         ret = E_NOT_OK ;
     }
     else{
-        *logic = *lat_registers[port] ;
+        *logic = *port_registers[port] ;
     }
     return ret;
 }
@@ -170,4 +179,91 @@ Std_ReturnType gpio_port_toggle_logic (port_index_t port ){
     return ret;
 }
 
+Std_ReturnType gpio_port_write_masked (port_index_t port , uint8 mask , uint8 value){
+    Std_ReturnType ret = E_OK ;
+    if(port > ( PORT_MAX_NUMBER - 1 )){
+        ret = E_NOT_OK ;
+    }
+    else{
+        /* Only the masked bits that differ are flipped by the final XORWF */
+        *lat_registers[port] ^= (uint8)((*lat_registers[port] ^ value) & mask) ;
+    }
+    return ret;
+}
+
+Std_ReturnType gpio_pin_group_initialize (gpio_pin_group_t *group , const pin_config_t *pins , uint8 count){
+    Std_ReturnType ret = E_OK ;
+    uint8 l_index = ZERO_INIT ;
+    if((NULL == group) || (NULL == pins) || (ZERO_INIT == count) || (PORT_PIN_MAX_NUMBER < ((uint8)pins[0].pin + count))){
+        ret = E_NOT_OK ;
+    }
+    else{
+        for(l_index = 1 ; (l_index < count) && (E_OK == ret) ; l_index++){
+            if((pins[l_index].port != pins[0].port) || (pins[l_index].pin != (pins[0].pin + l_index))){
+                ret = E_NOT_OK ;
+            }
+            else{ /* Nothing */ }
+        }
+    }
+    if(NULL != group){
+        if(E_OK == ret){
+            group->port  = pins[0].port ;
+            group->shift = pins[0].pin ;
+            group->mask  = (uint8)(((uint16)1 << count) - 1) << pins[0].pin ;
+        }
+        else{
+            group->mask  = ZERO_INIT ;
+        }
+    }
+    else{ /* Nothing */ }
+    return ret;
+}
+
+Std_ReturnType gpio_pin_group_write (const gpio_pin_group_t *group , uint8 value){
+    Std_ReturnType ret = E_OK ;
+    if((NULL == group) || (ZERO_INIT == group->mask)){
+        ret = E_NOT_OK ;
+    }
+    else{
+        ret = gpio_port_write_masked(group->port , group->mask , (uint8)(value << group->shift));
+    }
+    return ret;
+}
+
+Std_ReturnType gpio_port_snapshot_take (gpio_port_snapshot_t *snapshot){
+    Std_ReturnType ret = E_OK ;
+    uint8 l_port = ZERO_INIT ;
+    if(NULL == snapshot){
+        ret = E_NOT_OK ;
+    }
+    else{
+        snapshot->port_sampled = ZERO_INIT ;
+        for(l_port = ZERO_INIT ; l_port < PORT_MAX_NUMBER ; l_port++){
+#if EXTERNAL_INTERRUPT_OnChange_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+            if((PORTB_INDEX == l_port) && (INTERRUPT_ENABLE == INTCONbits.RBIE)){
+                /* A PORTB read ends the RB4..RB7 mismatch , the change ISR would miss an edge */
+            }
+            else
+#endif
+            {
+                snapshot->port_value[l_port] = *port_registers[l_port] ;
+                snapshot->port_sampled |= (uint8)(1 << l_port) ;
+            }
+        }
+    }
+    return ret;
+}
+
+Std_ReturnType gpio_snapshot_pin_read (const gpio_port_snapshot_t *snapshot , const pin_config_t *_pin_config_ , Logic_t *logic){
+    Std_ReturnType ret = E_OK ;
+    if((NULL == snapshot) || (NULL == _pin_config_) || (NULL == logic) || (_pin_config_->port > ( PORT_MAX_NUMBER - 1 )) ||
+       (ZERO_INIT == READ_BIT(snapshot->port_sampled , _pin_config_->port))){
+        ret = E_NOT_OK ;
+    }
+    else{
+        *logic = READ_BIT(snapshot->port_value[_pin_config_->port] , _pin_config_->pin);
+    }
+    return ret;
+}
+
 #endif
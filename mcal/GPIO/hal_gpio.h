@@ -115,6 +115,42 @@
  */
 #define READ_BIT(REG , BIT_POSN)           ( (REG >> BIT_POSN) & BIT_MASK  )
 
+#if CONFIG_ENABLE == GPIO_FAST_PIN_CONFIGURATION
+
+/*
+ * Fast pin API : the argument is a descriptor from hal_gpio_cfg.h
+ * (<port letter> , <pin number>) , resolved by the preprocessor to the
+ * LATxbits / PORTxbits / TRISxbits field. No pointer , no table lookup ,
+ * no parameter check : use it in time-critical paths only.
+ */
+
+/** @brief Drive a fast pin high (BSF LATx) */
+#define GPIO_FAST_PIN_HIGH(_DESC)               GPIO_FAST_PIN_HIGH_(_DESC)
+/** @brief Drive a fast pin low (BCF LATx) */
+#define GPIO_FAST_PIN_LOW(_DESC)                GPIO_FAST_PIN_LOW_(_DESC)
+/** @brief Write a Logic_t value to a fast pin */
+#define GPIO_FAST_PIN_WRITE(_DESC , _LOGIC)     GPIO_FAST_PIN_WRITE_(_DESC , _LOGIC)
+/** @brief Toggle a fast pin (BTG LATx) */
+#define GPIO_FAST_PIN_TOGGLE(_DESC)             GPIO_FAST_PIN_TOGGLE_(_DESC)
+/** @brief Read a fast pin level (PORTx) , evaluates to 0 or 1 */
+#define GPIO_FAST_PIN_READ(_DESC)               GPIO_FAST_PIN_READ_(_DESC)
+/** @brief Set a fast pin direction (@ref direction_t) */
+#define GPIO_FAST_PIN_DIRECTION(_DESC , _DIR)   GPIO_FAST_PIN_DIRECTION_(_DESC , _DIR)
+/** @brief pin_config_t initializer of a fast pin , to share one descriptor with the checked APIs */
+#define GPIO_FAST_PIN_CONFIG(_DESC , _DIR , _LOGIC)  GPIO_FAST_PIN_CONFIG_(_DESC , _DIR , _LOGIC)
+
+/* Second expansion level : splits the descriptor into port letter and pin number */
+#define GPIO_FAST_PIN_HIGH_(_PORT , _PIN)           ( LAT##_PORT##bits.LAT##_PORT##_PIN = 1 )
+#define GPIO_FAST_PIN_LOW_(_PORT , _PIN)            ( LAT##_PORT##bits.LAT##_PORT##_PIN = 0 )
+#define GPIO_FAST_PIN_WRITE_(_PORT , _PIN , _LOGIC) ( LAT##_PORT##bits.LAT##_PORT##_PIN = (_LOGIC) )
+#define GPIO_FAST_PIN_TOGGLE_(_PORT , _PIN)         ( LAT##_PORT ^= (BIT_MASK << _PIN) )
+#define GPIO_FAST_PIN_READ_(_PORT , _PIN)           ( PORT##_PORT##bits.R##_PORT##_PIN )
+#define GPIO_FAST_PIN_DIRECTION_(_PORT , _PIN , _DIR)   ( TRIS##_PORT##bits.TRIS##_PORT##_PIN = (_DIR) )
+#define GPIO_FAST_PIN_CONFIG_(_PORT , _PIN , _DIR , _LOGIC) \
+    { .port = PORT##_PORT##_INDEX , .pin = PIN##_PIN , .direction = (_DIR) , .logic = (_LOGIC) }
+
+#endif
+
 /* Section : Data Types Declarations */
 
 
@@ -177,6 +213,35 @@ typedef struct {
     uint8 logic           :  1  ;  /* @ref Logic_t */ /**< Initial logic level */
 }pin_config_t;
 
+/**
+ * @struct gpio_pin_group_t
+ * @brief Group of consecutive pins on the same port.
+ *
+ * Filled once by gpio_pin_group_initialize() , then a whole nibble / byte
+ * lands in a single LATx write through gpio_pin_group_write().
+ * mask = 0 marks a group that could not be built (pins not consecutive
+ * or on different ports).
+ */
+typedef struct {
+    uint8 port            :  3  ;  /* @ref port_index_t */ /**< GPIO port index */
+    uint8 shift           :  3  ;  /**< Pin number of the group's bit 0 */
+    uint8 mask                  ;  /**< Port bits owned by the group */
+}gpio_pin_group_t;
+
+/**
+ * @struct gpio_port_snapshot_t
+ * @brief RAM copy of every PORTx register.
+ *
+ * Taken once per tick by gpio_port_snapshot_take() , then debouncers and
+ * scanners read their pins from RAM instead of the SFRs.
+ * port_value is indexed by port_index_t , bit n of port_sampled is set
+ * when port n was read into this snapshot.
+ */
+typedef struct {
+    uint8 port_value[PORT_MAX_NUMBER] ;
+    uint8 port_sampled ;
+}gpio_port_snapshot_t;
+
 
 /* Section : Function Declarations */
 
@@ -209,7 +274,7 @@ Std_ReturnType gpio_pin_get_direction_status (const pin_config_t *_pin_config_ ,
  *
  * @return Std_ReturnType operation status.
  */
-Std_ReturnType gpio_pin_write_logic ( pin_config_t *_pin_config_ , Logic_t logic );
+Std_ReturnType gpio_pin_write_logic (const pin_config_t *_pin_config_ , Logic_t logic );
 
 /**
  * @brief Read the logic level of a GPIO pin.
@@ -228,7 +293,7 @@ Std_ReturnType gpio_pin_read_logic (const pin_config_t *_pin_config_ , Logic_t *
  *
  * @return Std_ReturnType operation status.
  */
-Std_ReturnType gpio_pin_toggle_logic ( pin_config_t *_pin_config_ );
+Std_ReturnType gpio_pin_toggle_logic (const pin_config_t *_pin_config_ );
 
 /**
  * @brief Initialize a GPIO pin.
@@ -280,6 +345,8 @@ Std_ReturnType gpio_port_write_logic (port_index_t port , uint8 logic);
  * @param[out] logic Pointer to store port logic.
  *
  * @return Std_ReturnType operation status.
+ *
+ * @note Samples the pins (PORTx) , not the output latch.
  */
 Std_ReturnType gpio_port_read_logic (port_index_t port , uint8 *logic);
 
@@ -292,6 +359,71 @@ Std_ReturnType gpio_port_read_logic (port_index_t port , uint8 *logic);
  */
 Std_ReturnType gpio_port_toggle_logic (port_index_t port );
 
+/**
+ * @brief Write only the masked bits of a GPIO port.
+ *
+ * @param[in] port  GPIO port index.
+ * @param[in] mask  Port bits to update.
+ * @param[in] value New logic of the masked bits (other bits ignored).
+ *
+ * @return Std_ReturnType operation status.
+ *
+ * @note The unmasked bits are changed by a single XORWF on LATx , so a
+ *       pin driven from an ISR on the same port is never overwritten.
+ */
+Std_ReturnType gpio_port_write_masked (port_index_t port , uint8 mask , uint8 value);
+
+/**
+ * @brief Build a pin group from an array of consecutive pins.
+ *
+ * @param[out] group Pointer to the group to fill.
+ * @param[in]  pins  Pin array , pins[0] is the group's bit 0.
+ * @param[in]  count Number of pins (1 .. 8).
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Group built
+ *         - E_NOT_OK : Null pointer , bad count , pins on different ports
+ *                      or not consecutive (group->mask is left at 0)
+ */
+Std_ReturnType gpio_pin_group_initialize (gpio_pin_group_t *group , const pin_config_t *pins , uint8 count);
+
+/**
+ * @brief Write a value to a pin group in a single LATx write.
+ *
+ * @param[in] group Pointer to an initialized pin group.
+ * @param[in] value Group value , bit 0 goes to pins[0].
+ *
+ * @return Std_ReturnType operation status.
+ */
+Std_ReturnType gpio_pin_group_write (const gpio_pin_group_t *group , uint8 value);
+
+/**
+ * @brief Sample every GPIO port (PORTx) into a snapshot.
+ *
+ * @param[out] snapshot Pointer to the snapshot to fill.
+ *
+ * @return Std_ReturnType operation status.
+ *
+ * @note The ports are read back to back , one SFR access each.
+ * @warning PORTB is skipped while the RB change interrupt is enabled (RBIE) :
+ *          reading PORTB ends the RB4..RB7 mismatch , so an edge between two
+ *          ISR runs would be lost. Its pins then read E_NOT_OK from
+ *          gpio_snapshot_pin_read() , read them in the RBx handler instead.
+ */
+Std_ReturnType gpio_port_snapshot_take (gpio_port_snapshot_t *snapshot);
+
+/**
+ * @brief Read a pin level from a snapshot.
+ *
+ * @param[in]  snapshot    Pointer to a snapshot taken by gpio_port_snapshot_take().
+ * @param[in]  _pin_config_ Pointer to pin configuration structure.
+ * @param[out] logic       Pointer to store logic level.
+ *
+ * @return Std_ReturnType operation status , E_NOT_OK when the pin's port
+ *         was not sampled (PORTB with RBIE set).
+ */
+Std_ReturnType gpio_snapshot_pin_read (const gpio_port_snapshot_t *snapshot , const pin_config_t *_pin_config_ , Logic_t *logic);
+
 #endif
 
 #endif	/* HAL_GPIO_H */
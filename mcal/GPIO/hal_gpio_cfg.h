@@ -33,5 +33,32 @@
 /* Enable port-level GPIO APIs */
 #define GPIO_PORT_CONFIGURATION            CONFIG_ENABLE
 
+/* Enable the compile-time fast pin API (GPIO_FAST_xxx) , the checked APIs stay the default */
+#define GPIO_FAST_PIN_CONFIGURATION        CONFIG_ENABLE
+
+/*
+ * Fast pin descriptors : <port letter> , <pin number>
+ * Each GPIO_FAST_xxx access on a descriptor compiles to a single
+ * BSF / BCF / BTG / BTFSC on the LATx / PORTx / TRISx bit.
+ *
+ * Example :
+ * #define GPIO_FAST_LCD_EN                A , 2
+ */
+
+/* Software I2C master (I2C_Soft.c) , external pull-ups on both lines */
+#define GPIO_FAST_SOFT_I2C_SCL          D , 6
+#define GPIO_FAST_SOFT_I2C_SDA          D , 7
+
+/* Trace markers (hal_gpio_marker.h) , toggled at each driver hit point */
+#define GPIO_MARKER_CONFIGURATION          CONFIG_DISABLE
+
+/* Marker pins , free on both Smart_Home boards */
+#define GPIO_FAST_MARKER_KEYPAD         E , 0
+#define GPIO_FAST_MARKER_LCD            E , 1
+#define GPIO_FAST_MARKER_I2C            E , 2
+#define GPIO_FAST_MARKER_PWM            A , 5
+#define GPIO_FAST_MARKER_USER0          A , 4
+#define GPIO_FAST_MARKER_USER1          C , 5
+
 #endif	/* HAL_GPIO_CFG_H */
 
@@ -0,0 +1,269 @@
+/**
+ * @file    hal_gpio_marker.c
+ * @author  Abdelmoniem Ahmed
+ * @linkedin https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * @brief   GPIO Trace Markers and Per-Path Latency Statistics
+ * @details A hit reads the clock and searches the histogram bucket with
+ *          interrupts enabled , they are masked only while the state or the
+ *          statistics of one path are updated. Averages and text
+ *          formatting are left to the report , which runs in the main loop.
+ */
+
+/* Section : Includes */
+
+#include"hal_gpio_marker.h"
+#include"../Interrupt/mcal_interrupt_critical.h"
+#include"report_format.h"
+
+#if CONFIG_ENABLE == GPIO_MARKER_CONFIGURATION
+
+/* Section : Macro Declaration */
+
+#define GPIO_MARKER_REPORT_LINE_SIZE        100
+
+/* Start / end marker of a path not defined */
+#define GPIO_MARKER_NONE                    0xFF
+
+/* Section : Data Types Declarations */
+
+typedef struct{
+    gpio_marker_stats_t stats ;
+    uint32 start_us ;
+    uint8 start_marker ;
+    uint8 end_marker ;
+    uint8 armed ;
+}gpio_marker_path_t;
+
+/* Section : Static Variables */
+
+static gpio_marker_path_t marker_paths[GPIO_MARKER_PATH_MAX];
+static gpio_marker_clock_t marker_clock = NULL;
+
+static const uint8 * const marker_names[GPIO_MARKER_COUNT] = {
+    (const uint8 *)"KEYPAD" , (const uint8 *)"LCD" , (const uint8 *)"I2C" ,
+    (const uint8 *)"PWM" , (const uint8 *)"USER0" , (const uint8 *)"USER1"
+};
+
+/* Section : Static Function Declarations */
+
+static void marker_path_clear(gpio_marker_path_t *path);
+static void marker_path_record(gpio_marker_path_t *path , uint32 latency , uint8 bucket);
+static uint8 marker_bucket(uint32 latency);
+static uint8 marker_append_name(uint8 *line , const gpio_marker_path_t *path);
+
+/* Section : Function Definitions */
+
+Std_ReturnType GPIO_Marker_Init(gpio_marker_clock_t clock){
+    Std_ReturnType ret = E_OK;
+    uint8 l_path = ZERO_INIT;
+
+    GPIO_FAST_PIN_LOW(GPIO_FAST_MARKER_KEYPAD);
+    GPIO_FAST_PIN_LOW(GPIO_FAST_MARKER_LCD);
+    GPIO_FAST_PIN_LOW(GPIO_FAST_MARKER_I2C);
+    GPIO_FAST_PIN_LOW(GPIO_FAST_MARKER_PWM);
+    GPIO_FAST_PIN_LOW(GPIO_FAST_MARKER_USER0);
+    GPIO_FAST_PIN_LOW(GPIO_FAST_MARKER_USER1);
+    GPIO_FAST_PIN_DIRECTION(GPIO_FAST_MARKER_KEYPAD , GPIO_DIRECTION_OUTPUT);
+    GPIO_FAST_PIN_DIRECTION(GPIO_FAST_MARKER_LCD , GPIO_DIRECTION_OUTPUT);
+    GPIO_FAST_PIN_DIRECTION(GPIO_FAST_MARKER_I2C , GPIO_DIRECTION_OUTPUT);
+    GPIO_FAST_PIN_DIRECTION(GPIO_FAST_MARKER_PWM , GPIO_DIRECTION_OUTPUT);
+    GPIO_FAST_PIN_DIRECTION(GPIO_FAST_MARKER_USER0 , GPIO_DIRECTION_OUTPUT);
+    GPIO_FAST_PIN_DIRECTION(GPIO_FAST_MARKER_USER1 , GPIO_DIRECTION_OUTPUT);
+
+    marker_clock = clock;
+    for(l_path = ZERO_INIT ; l_path < GPIO_MARKER_PATH_MAX ; l_path++){
+        marker_paths[l_path].start_marker = GPIO_MARKER_NONE;
+        marker_paths[l_path].end_marker = GPIO_MARKER_NONE;
+    }
+    ret = GPIO_Marker_Reset();
+    return ret;
+}
+
+Std_ReturnType GPIO_Marker_Path_Init(uint8 path , uint8 start_marker , uint8 end_marker){
+    Std_ReturnType ret = E_OK;
+    uint8 l_gie = ZERO_INIT;
+
+    if((GPIO_MARKER_PATH_MAX <= path) || (GPIO_MARKER_COUNT <= start_marker) || (GPIO_MARKER_COUNT <= end_marker)){
+        ret = E_NOT_OK;
+    }
+    else{
+        INTERRUPT_CRITICAL_ENTER_ALL(l_gie);
+        marker_paths[path].start_marker = start_marker;
+        marker_paths[path].end_marker = end_marker;
+        marker_path_clear(&marker_paths[path]);
+        INTERRUPT_CRITICAL_EXIT_ALL(l_gie);
+    }
+    return ret;
+}
+
+Std_ReturnType GPIO_Marker_Reset(void){
+    Std_ReturnType ret = E_OK;
+    uint8 l_gie = ZERO_INIT;
+    uint8 l_path = ZERO_INIT;
+
+    INTERRUPT_CRITICAL_ENTER_ALL(l_gie);
+    for(l_path = ZERO_INIT ; l_path < GPIO_MARKER_PATH_MAX ; l_path++){
+        marker_path_clear(&marker_paths[l_path]);
+    }
+    INTERRUPT_CRITICAL_EXIT_ALL(l_gie);
+    return ret;
+}
+
+Std_ReturnType GPIO_Marker_Get(uint8 path , gpio_marker_stats_t *stats){
+    Std_ReturnType ret = E_OK;
+    uint8 l_gie = ZERO_INIT;
+
+    if((NULL == stats) || (GPIO_MARKER_PATH_MAX <= path)){
+        ret = E_NOT_OK;
+    }
+    else{
+        INTERRUPT_CRITICAL_ENTER_ALL(l_gie);
+        *stats = marker_paths[path].stats;
+        INTERRUPT_CRITICAL_EXIT_ALL(l_gie);
+    }
+    return ret;
+}
+
+Std_ReturnType GPIO_Marker_Report(gpio_marker_write_t write){
+    Std_ReturnType ret = E_OK;
+    gpio_marker_stats_t l_stats;
+    uint8 l_line[GPIO_MARKER_REPORT_LINE_SIZE];
+    uint8 l_index = ZERO_INIT;
+    uint8 l_path = ZERO_INIT;
+    uint8 l_bucket = ZERO_INIT;
+
+    if(NULL == write){
+        ret = E_NOT_OK;
+    }
+    else{
+        for(l_path = ZERO_INIT ; (l_path < GPIO_MARKER_PATH_MAX) && (E_OK == ret) ; l_path++){
+            ret = GPIO_Marker_Get(l_path , &l_stats);
+            if((E_OK == ret) && (ZERO_INIT != l_stats.count)){
+                l_index = marker_append_name(l_line , &marker_paths[l_path]);
+                l_index = report_append_text(l_line , GPIO_MARKER_REPORT_LINE_SIZE , l_index , (const uint8 *)" n=");
+                l_index = report_append_hex(l_line , GPIO_MARKER_REPORT_LINE_SIZE , l_index , l_stats.count , 8);
+                l_index = report_append_text(l_line , GPIO_MARKER_REPORT_LINE_SIZE , l_index , (const uint8 *)" min=");
+                l_index = report_append_hex(l_line , GPIO_MARKER_REPORT_LINE_SIZE , l_index , l_stats.min_us , 8);
+                l_index = report_append_text(l_line , GPIO_MARKER_REPORT_LINE_SIZE , l_index , (const uint8 *)" avg=");
+                l_index = report_append_hex(l_line , GPIO_MARKER_REPORT_LINE_SIZE , l_index , l_stats.total_us / l_stats.count , 8);
+                l_index = report_append_text(l_line , GPIO_MARKER_REPORT_LINE_SIZE , l_index , (const uint8 *)" max=");
+                l_index = report_append_hex(l_line , GPIO_MARKER_REPORT_LINE_SIZE , l_index , l_stats.max_us , 8);
+                l_index = report_append_text(l_line , GPIO_MARKER_REPORT_LINE_SIZE , l_index , (const uint8 *)"\r\n");
+                ret = write(l_line , l_index);
+
+                l_index = marker_append_name(l_line , &marker_paths[l_path]);
+                l_index = report_append_text(l_line , GPIO_MARKER_REPORT_LINE_SIZE , l_index , (const uint8 *)" h=");
+                for(l_bucket = ZERO_INIT ; l_bucket < GPIO_MARKER_HISTOGRAM_BUCKETS ; l_bucket++){
+                    l_index = report_append_hex(l_line , GPIO_MARKER_REPORT_LINE_SIZE , l_index , l_stats.histogram[l_bucket] , 4);
+                    l_index = report_append_text(l_line , GPIO_MARKER_REPORT_LINE_SIZE , l_index ,
+                                                 (const uint8 *)(((GPIO_MARKER_HISTOGRAM_BUCKETS - 1) > l_bucket) ? " " : "\r\n"));
+                }
+                ret &= write(l_line , l_index);
+            }
+            else{ /* Not defined or no sample yet */ }
+        }
+    }
+    return ret;
+}
+
+void GPIO_Marker_Hit(uint8 marker){
+    uint32 l_now = ZERO_INIT;
+    uint32 l_start = ZERO_INIT;
+    uint32 l_latency = ZERO_INIT;
+    uint8 l_gie = ZERO_INIT;
+    uint8 l_path = ZERO_INIT;
+    uint8 l_bucket = ZERO_INIT;
+    uint8 l_ended = FALSE;
+    gpio_marker_path_t *l_entry = NULL;
+
+    if((NULL != marker_clock) && (GPIO_MARKER_COUNT > marker) && (E_OK == marker_clock(&l_now))){
+        for(l_path = ZERO_INIT ; l_path < GPIO_MARKER_PATH_MAX ; l_path++){
+            l_entry = &marker_paths[l_path];
+            /* End first : a path with start == end measures the time between two hits */
+            INTERRUPT_CRITICAL_ENTER_ALL(l_gie);
+            l_ended = ((marker == l_entry->end_marker) && (TRUE == l_entry->armed)) ? TRUE : FALSE;
+            l_start = l_entry->start_us;
+            if(TRUE == l_ended){
+                l_entry->armed = FALSE;
+            }
+            else{ /* Nothing */ }
+            if(marker == l_entry->start_marker){
+                l_entry->start_us = l_now;
+                l_entry->armed = TRUE;
+            }
+            else{ /* Nothing */ }
+            INTERRUPT_CRITICAL_EXIT_ALL(l_gie);
+            if(TRUE == l_ended){
+                /* Bucket search outside the masked section */
+                l_latency = l_now - l_start;
+                l_bucket = marker_bucket(l_latency);
+                INTERRUPT_CRITICAL_ENTER_ALL(l_gie);
+                marker_path_record(l_entry , l_latency , l_bucket);
+                INTERRUPT_CRITICAL_EXIT_ALL(l_gie);
+            }
+            else{ /* Nothing */ }
+        }
+    }
+    else{ /* Pins only , or clock failure : hit not timed */ }
+}
+
+/* Section : Static Function Definitions */
+
+static void marker_path_clear(gpio_marker_path_t *path){
+    uint8 l_bucket = ZERO_INIT;
+
+    path->stats.count = ZERO_INIT;
+    path->stats.total_us = ZERO_INIT;
+    path->stats.min_us = 0xFFFFFFFF;
+    path->stats.max_us = ZERO_INIT;
+    for(l_bucket = ZERO_INIT ; l_bucket < GPIO_MARKER_HISTOGRAM_BUCKETS ; l_bucket++){
+        path->stats.histogram[l_bucket] = ZERO_INIT;
+    }
+    path->start_us = ZERO_INIT;
+    path->armed = FALSE;
+}
+
+static void marker_path_record(gpio_marker_path_t *path , uint32 latency , uint8 bucket){
+    path->stats.count++;
+    path->stats.total_us += latency;
+    if(latency < path->stats.min_us){
+        path->stats.min_us = latency;
+    }
+    else{ /* Nothing */ }
+    if(latency > path->stats.max_us){
+        path->stats.max_us = latency;
+    }
+    else{ /* Nothing */ }
+    if(0xFFFF > path->stats.histogram[bucket]){
+        path->stats.histogram[bucket]++;
+    }
+    else{ /* Saturated */ }
+}
+
+static uint8 marker_bucket(uint32 latency){
+    uint8 l_bucket = GPIO_MARKER_HISTOGRAM_BUCKETS - 1;
+    uint16 l_value = ZERO_INIT;
+
+    if(latency < ((uint32)1 << (GPIO_MARKER_HISTOGRAM_BUCKETS - 1))){
+        /* 16-bit shifts from here , at most 14 */
+        l_value = (uint16)latency;
+        l_bucket = ZERO_INIT;
+        while(1 < l_value){
+            l_value >>= 1;
+            l_bucket++;
+        }
+    }
+    else{ /* Open-ended last bucket */ }
+    return l_bucket;
+}
+
+static uint8 marker_append_name(uint8 *line , const gpio_marker_path_t *path){
+    uint8 l_index = ZERO_INIT;
+
+    l_index = report_append_text(line , GPIO_MARKER_REPORT_LINE_SIZE , l_index , marker_names[path->start_marker]);
+    l_index = report_append_text(line , GPIO_MARKER_REPORT_LINE_SIZE , l_index , (const uint8 *)">");
+    l_index = report_append_text(line , GPIO_MARKER_REPORT_LINE_SIZE , l_index , marker_names[path->end_marker]);
+    return l_index;
+}
+
+#endif
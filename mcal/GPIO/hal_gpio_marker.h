@@ -0,0 +1,143 @@
+/**
+ * @file    hal_gpio_marker.h
+ * @author  Abdelmoniem Ahmed
+ * @linkedin https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * @brief   GPIO Trace Markers and Per-Path Latency Statistics
+ * @details Optional build (GPIO_MARKER_CONFIGURATION in hal_gpio_cfg.h).
+ *          GPIO_MARKER_HIT(NAME) toggles the GPIO_FAST_MARKER_NAME pin
+ *          (one XORWF on LATx) and timestamps the hit : every edge on a
+ *          marker pin is one hit , for logic-analyzer capture across both
+ *          boards.
+ *
+ *          Hit points in the drivers :
+ *          - KEYPAD : debounced press queued (Keypad_Update)
+ *          - LCD    : character written (lcd_xbit_send_char_data)
+ *          - I2C    : register write done (MSSP / SOFT_I2C_Write_Registers)
+ *          - PWM    : duty cycle loaded (CCP_PWM_Set_Duty)
+ *          USER0 / USER1 are left to the application.
+ *
+ *          A path is a start marker and an end marker. A start hit arms
+ *          it , the next end hit records the latency and disarms it , a new
+ *          start hit before the end restarts the measurement. With start
+ *          equal to end the path measures the time between two hits.
+ *
+ *          Per path : count , min / avg / max (us) and a log2 histogram ,
+ *          bucket b counts the latencies from 2^b to 2^(b+1) - 1 us (bucket
+ *          0 includes 0 , the last bucket everything above).
+ */
+
+#ifndef HAL_GPIO_MARKER_H
+#define	HAL_GPIO_MARKER_H
+
+/* Section : Includes */
+
+#include"hal_gpio.h"
+
+/* Section : Macro Declaration */
+
+/* Marker ids , one GPIO_FAST_MARKER_xxx descriptor each in hal_gpio_cfg.h */
+#define GPIO_MARKER_KEYPAD                  0
+#define GPIO_MARKER_LCD                     1
+#define GPIO_MARKER_I2C                     2
+#define GPIO_MARKER_PWM                     3
+#define GPIO_MARKER_USER0                   4
+#define GPIO_MARKER_USER1                   5
+#define GPIO_MARKER_COUNT                   6
+
+/* Paths measured at the same time */
+#define GPIO_MARKER_PATH_MAX                4
+
+/* Histogram buckets , the last one is open ended (2^15 us and above) */
+#define GPIO_MARKER_HISTOGRAM_BUCKETS       16
+
+#if (CONFIG_ENABLE == GPIO_MARKER_CONFIGURATION) && (CONFIG_ENABLE != GPIO_FAST_PIN_CONFIGURATION)
+#error "GPIO_MARKER_CONFIGURATION needs GPIO_FAST_PIN_CONFIGURATION enabled in hal_gpio_cfg.h"
+#endif
+
+/* Section : Macro Functions Declarations */
+
+#if CONFIG_ENABLE == GPIO_MARKER_CONFIGURATION
+/** @brief Marker hit point , _NAME : KEYPAD , LCD , I2C , PWM , USER0 , USER1 */
+#define GPIO_MARKER_HIT(_NAME)              do{ GPIO_FAST_PIN_TOGGLE(GPIO_FAST_MARKER_##_NAME) ; \
+                                                GPIO_Marker_Hit(GPIO_MARKER_##_NAME) ; }while(0)
+#else
+#define GPIO_MARKER_HIT(_NAME)              do{ }while(0)
+#endif
+
+/* Section : Data Types Declarations */
+
+/**
+ * @brief Timestamp source in us , e.g. Time_Get_Micros (ecu_time.h)
+ */
+typedef Std_ReturnType (* gpio_marker_clock_t)(uint32 *micros);
+
+/**
+ * @brief Byte sink used by the report (e.g. EUSART_ASYNC_Write_String_Blocking)
+ */
+typedef Std_ReturnType (* gpio_marker_write_t)(const uint8 *data , uint16 length);
+
+#if CONFIG_ENABLE == GPIO_MARKER_CONFIGURATION
+
+/**
+ * @brief Latency statistics of one path , in us
+ */
+typedef struct{
+    uint32 count ;
+    uint32 total_us ;
+    uint32 min_us ;             /* 0xFFFFFFFF until the first sample */
+    uint32 max_us ;
+    uint16 histogram[GPIO_MARKER_HISTOGRAM_BUCKETS];   /* Saturates at 0xFFFF */
+}gpio_marker_stats_t;
+
+/* Section : Function Declarations */
+
+/**
+ * @brief Drive every marker pin low as an output , clear the paths
+ * @param clock Timestamp source , NULL : pins only , no statistics
+ * @return Std_ReturnType (E_OK)
+ */
+Std_ReturnType GPIO_Marker_Init(gpio_marker_clock_t clock);
+
+/**
+ * @brief Define a path and clear its statistics
+ * @param path         0 .. GPIO_MARKER_PATH_MAX - 1
+ * @param start_marker GPIO_MARKER_xxx that arms the path
+ * @param end_marker   GPIO_MARKER_xxx that records the latency
+ * @return Std_ReturnType (E_OK / E_NOT_OK on bad path or marker)
+ */
+Std_ReturnType GPIO_Marker_Path_Init(uint8 path , uint8 start_marker , uint8 end_marker);
+
+/**
+ * @brief Clear the statistics of every path , the definitions are kept
+ * @return Std_ReturnType (E_OK)
+ */
+Std_ReturnType GPIO_Marker_Reset(void);
+
+/**
+ * @brief Copy the statistics of one path (taken with interrupts masked)
+ * @param path  Path index
+ * @param stats Pointer to the returned statistics
+ * @return Std_ReturnType (E_OK / E_NOT_OK on null pointer or bad path)
+ */
+Std_ReturnType GPIO_Marker_Get(uint8 path , gpio_marker_stats_t *stats);
+
+/**
+ * @brief Write two text lines per path that has samples (hex values)
+ * @param write Byte sink , e.g. EUSART_ASYNC_Write_String_Blocking
+ * @return Std_ReturnType (E_OK / E_NOT_OK on null pointer or write failure)
+ *
+ * @note Line format : "KEYPAD>LCD n=00000012 min=00000410 avg=00000432 max=000004F0\r\n"
+ *                     "KEYPAD>LCD h=0000 ... 0000\r\n" (bucket 0 first)
+ */
+Std_ReturnType GPIO_Marker_Report(gpio_marker_write_t write);
+
+/**
+ * @brief Timestamp a hit and update the paths it starts or ends ,
+ *        called by GPIO_MARKER_HIT only
+ * @note Main loop or ISR , the paths are updated with interrupts masked.
+ */
+void GPIO_Marker_Hit(uint8 marker);
+
+#endif
+
+#endif	/* HAL_GPIO_MARKER_H */
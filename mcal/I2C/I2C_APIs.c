@@ -14,6 +14,8 @@
  */
 
 #include"I2C_APIs.h"
+#include"../Power/hal_power.h"
+#include"../GPIO/hal_gpio_marker.h"
 
 static pin_config_t MSSP_I2C_SDA  = { .port = PORTC_INDEX , .pin = PIN4 , .direction = GPIO_DIRECTION_INPUT} ;
 static pin_config_t MSSP_I2C_CLK = { .port = PORTC_INDEX , .pin = PIN3 , .direction = GPIO_DIRECTION_INPUT} ;
@@ -21,12 +23,70 @@ static pin_config_t MSSP_I2C_CLK = { .port = PORTC_INDEX , .pin = PIN3 , .direct
 #if         INTERRUPT_FEATURE_ENABLE == MSSP_I2C_INTERRUPT_FEATURE_ENABLE
     static void (* MSSP_I2C_InterruptHandler) (void) = NULL ;
     static void (* MSSP_I2C_ReceiveOVERFLOW) (void) = NULL ;
+
+/* Asynchronous master transfer engine states , one SSPIF event per step */
+typedef enum{
+    I2C_ENGINE_IDLE = 0 ,
+    I2C_ENGINE_START ,          /* SEN issued */
+    I2C_ENGINE_ADDRESS_WRITE ,  /* addr+W in SSPBUF */
+    I2C_ENGINE_DATA_WRITE ,     /* write_buffer byte in SSPBUF */
+    I2C_ENGINE_REPEATED_START , /* RSEN issued */
+    I2C_ENGINE_ADDRESS_READ ,   /* addr+R in SSPBUF */
+    I2C_ENGINE_DATA_READ ,      /* RCEN issued */
+    I2C_ENGINE_ACK ,            /* ACKEN issued */
+    I2C_ENGINE_STOP             /* PEN issued */
+}i2c_engine_state_t;
+
+    /* SPSC (spsc_queue.h) : MSSP_I2C_Master_Submit produces , the engine consumes the front transfer */
+    static SPSC_QUEUE_TYPE(i2c_transfer_t * , MSSP_I2C_TRANSFER_QUEUE_SIZE) i2c_transfer_queue ;
+    static volatile i2c_engine_state_t i2c_engine_state = I2C_ENGINE_IDLE;
+    static i2c_transfer_status_t i2c_engine_result = I2C_TRANSFER_DONE;
+    static uint8 i2c_engine_index = ZERO_INIT;
+
+    /* Slave register map , NULL when the default handler serves the slave */
+    static const i2c_slave_register_map_t * volatile i2c_slave_map = NULL;
+    static uint8 i2c_slave_pointer = ZERO_INIT;
+    static uint8 i2c_slave_pointer_expected = FALSE;
+
+/* Auto-increment , wraps at the end of the map (no division in the ISR) */
+#define MSSP_I2C_SLAVE_POINTER_NEXT(_map)   do{ i2c_slave_pointer++; if(i2c_slave_pointer >= (_map)->length){ i2c_slave_pointer = ZERO_INIT; } }while(0)
 #endif
 
 #if         INTERRUPT_FEATURE_ENABLE == MSSP_I2C_BUS_COL_INTERRUPT_FEATURE_ENABLE    
     static void (* MSSP_I2C_Bus_Coll_InterruptHandler) (void) = NULL ;
 #endif
 
+/* Last configuration passed to MSSP_I2C_Init , re-applied after a bus recovery */
+static const mssp_i2c_t * i2c_active_obj = NULL ;
+/* Fosc SSPADD is computed for , follows the clock manager through MSSP_I2C_Clock_Update */
+static uint32 i2c_fosc = _XTAL_FREQ ;
+/* Set by a bus wait that expired , cleared by the next START */
+static volatile uint8 i2c_timeout_latched = FALSE ;
+
+#if         MSSP_I2C_TIMEOUT_SOURCE == MSSP_I2C_TIMEOUT_SOURCE_TICK
+#define MSSP_I2C_TIMEOUT_BEGIN(_timer)      ((_timer) = MSSP_I2C_TIMEOUT_TICK_READ())
+#define MSSP_I2C_TIMEOUT_EXPIRED(_timer)    (MSSP_I2C_TIMEOUT_TICKS <= (uint16)(MSSP_I2C_TIMEOUT_TICK_READ() - (_timer)))
+#else
+#define MSSP_I2C_TIMEOUT_BEGIN(_timer)      ((_timer) = ZERO_INIT)
+#define MSSP_I2C_TIMEOUT_EXPIRED(_timer)    (MSSP_I2C_TIMEOUT_LOOPS <= (++(_timer)))
+#endif
+
+/* Poll while _condition holds , latch a timeout instead of hanging. No-op once a timeout is latched */
+#define MSSP_I2C_WAIT_WHILE(_condition)                                     \
+    do{                                                                     \
+        uint16 l_timer ;                                                    \
+        MSSP_I2C_TIMEOUT_BEGIN(l_timer);                                    \
+        while((FALSE == i2c_timeout_latched) && (_condition)){              \
+            if(MSSP_I2C_TIMEOUT_EXPIRED(l_timer)){                          \
+                i2c_timeout_latched = TRUE ;                                \
+            }                                                               \
+            else{ /* Nothing */ }                                           \
+        }                                                                   \
+    }while(0)
+
+/* MSSP idle : no START / RSTART / STOP / RCEN / ACKEN pending and no transmit in progress */
+#define MSSP_I2C_BUS_BUSY()                 ((SSPCON2 & 0x1F) || (SSPSTATbits.R_W))
+
 /* Static Function Declaration */
 
 static void MSSP_I2C_Slave_Mode_General_Call_Configuration(const mssp_i2c_t * i2c_obj);
@@ -34,6 +94,16 @@ static void MSSP_I2C_Slew_Rate_Configuration(const mssp_i2c_t * i2c_obj);
 static void MSSP_I2C_SMBus_Configuration(const mssp_i2c_t * i2c_obj);
 static inline void MSSP_I2C_PIN_CONFIG(void);
 static inline void MSSP_I2C_Master_Mode_Clock_Configuration(const mssp_i2c_t * i2c_obj);
+static void MSSP_I2C_Recovery_Line(pin_config_t * line , direction_t level);
+#if         MSSP_I2C_TIMEOUT_SOURCE == MSSP_I2C_TIMEOUT_SOURCE_TICK
+static inline uint16 MSSP_I2C_Timer1_Ticks(void);
+#endif
+#if         INTERRUPT_FEATURE_ENABLE == MSSP_I2C_INTERRUPT_FEATURE_ENABLE
+static void MSSP_I2C_Engine_Start_Next(void);
+static void MSSP_I2C_Engine_Finish(i2c_transfer_status_t result);
+static void MSSP_I2C_Engine_Step(void);
+static void MSSP_I2C_Slave_Step(void);
+#endif
 
 /* Global Function Definition */
 
@@ -87,24 +157,6 @@ Std_ReturnType MSSP_I2C_Init(const mssp_i2c_t * i2c_obj){
         MSSP_I2C_INTERRUPT_DISABLE();
         /* Clear The Interrupt Flag */
         MSSP_I2C_INTERRUPT_CLEAR_FLAG();
-        /* Default Interrupt Priority COnfiguration */
-#if                     INTERRUPT_FEATURE_DISABLE == INTERRUPT_PRIORITY_LEVELS_ENABLE        
-        /* If Priority Feature Disable */
-        /* Global / Peripheral Interrupt Enable */
-        INTERRUPT_GlobalInterruptEnable();
-        INTERRUPT_PeripheralInterruptEnable();
-#elif                   INTERRUPT_FEATURE_ENABLE == INTERRUPT_PRIORITY_LEVELS_ENABLE 
-        /* If Priority Feature Enable */
-        INTERRUPT_PriorityFeatureEnable();
-        INTERRUPT_GlobalInterruptHighEnable();
-        INTERRUPT_GlobalInterruptLowEnable();
-        if(Interrupt_High_Priority == i2c_obj->mssp_i2c_int_priority_level){
-            MSSP_I2C_INTERRUPT_HIGH_PRIORITY();
-        }
-        else{
-            MSSP_I2C_INTERRUPT_LOW_PRIORITY();
-        }
-#endif  
         MSSP_I2C_InterruptHandler = i2c_obj->MSSP_I2C_DEFAULT_INTERRUPT_HANDLER ;
         MSSP_I2C_ReceiveOVERFLOW  = i2c_obj->MSSP_I2C_REPORT_RECEIVE_OVERFLOW ;
         MSSP_I2C_INTERRUPT_ENABLE();
@@ -116,30 +168,13 @@ Std_ReturnType MSSP_I2C_Init(const mssp_i2c_t * i2c_obj){
         MSSP_I2C_BUS_COLL_INTERRUPT_DISABLE();
         /* Clear The Interrupt Flag */
         MSSP_I2C_BUS_COLL_INTERRUPT_CLEAR_FLAG();
-        
-        /* Bus Collision Interrupt Priority COnfiguration */
-#if                     INTERRUPT_FEATURE_DISABLE == INTERRUPT_PRIORITY_LEVELS_ENABLE        
-        /* If Priority Feature Disable */
-        /* Global / Peripheral Interrupt Enable */
-        INTERRUPT_GlobalInterruptEnable();
-        INTERRUPT_PeripheralInterruptEnable();
-#elif                   INTERRUPT_FEATURE_ENABLE == INTERRUPT_PRIORITY_LEVELS_ENABLE 
-        /* If Priority Feature Enable */
-        INTERRUPT_PriorityFeatureEnable();
-        INTERRUPT_GlobalInterruptHighEnable();
-        INTERRUPT_GlobalInterruptLowEnable();
-        if(Interrupt_High_Priority == i2c_obj->mssp_i2c_Bus_COL_int_priority_level){
-            MSSP_I2C_BUS_COLL_INTERRUPT_HIGH_PRIORITY();
-        }
-        else{
-            MSSP_I2C_BUS_COLL_INTERRUPT_LOW_PRIORITY();
-        }
-#endif  
         MSSP_I2C_Bus_Coll_InterruptHandler = i2c_obj->MSSP_I2C_REPORT_WRITE_COLLISION ;
         MSSP_I2C_BUS_COLL_INTERRUPT_ENABLE();
 #endif        
         /* Enable MSSP I2C Module Enable */
         MSSP_I2C_ENABLE_CFG(); 
+        /* Kept for MSSP_I2C_Bus_Recovery */
+        i2c_active_obj = i2c_obj ;
     }
     return ret ; 
     
@@ -160,6 +195,9 @@ Std_ReturnType MSSP_I2C_DeInit(const mssp_i2c_t * i2c_obj){
 #if                     INTERRUPT_FEATURE_ENABLE == MSSP_I2C_INTERRUPT_FEATURE_ENABLE
         /* Disable the Interrupt */
         MSSP_I2C_INTERRUPT_DISABLE();        
+        /* Detach the slave register map , no more clock stretching */
+        i2c_slave_map = NULL;
+        SSPCON2bits.SEN = 0 ;
 #endif
         
         /* Disable MSSP I2C Bus Collision Interrupt */
@@ -172,22 +210,45 @@ Std_ReturnType MSSP_I2C_DeInit(const mssp_i2c_t * i2c_obj){
     
 }
 
+Std_ReturnType MSSP_I2C_Clock_Update(const mssp_i2c_t * i2c_obj , uint32 fosc){
+    Std_ReturnType ret = E_OK;
+    if((NULL == i2c_obj) || (ZERO_INIT == fosc) || (ZERO_INIT == i2c_obj->i2c_clock)){
+        ret = E_NOT_OK;
+    }
+    else{
+        i2c_fosc = fosc;
+        if(MSSP_I2C_MASTER_MODE == i2c_obj->i2c_cfg.i2c_mode){
+            MSSP_I2C_Master_Mode_Clock_Configuration(i2c_obj);
+        }
+        else{ /* Slave : SCL comes from the master */ }
+    }
+    return ret;
+}
+
 
 
 Std_ReturnType MSSP_I2C_Master_Send_Start(void){
     Std_ReturnType ret = E_OK;
     
+    /* A new transaction starts with a fresh timeout budget */
+    i2c_timeout_latched = FALSE ;
     /* wait until I2C is in IDLE state */
-    while((SSPCON2 & 0x1F) || (SSPSTATbits.R_W));
-    /* Initiates the start condition on SDA and CLK Pin*/
-    SSPCON2bits.SEN = 1 ; /* Initiates Start condition on SDA and SCL pins. Automatically cleared by hardware */ 
-    /* wait for the completion of start condition */
-    while((SSPCON2bits.SEN));
+    MSSP_I2C_WAIT_WHILE(MSSP_I2C_BUS_BUSY());
+    if(FALSE == i2c_timeout_latched){
+        /* Initiates the start condition on SDA and CLK Pin*/
+        SSPCON2bits.SEN = 1 ; /* Initiates Start condition on SDA and SCL pins. Automatically cleared by hardware */ 
+        /* wait for the completion of start condition */
+        MSSP_I2C_WAIT_WHILE(SSPCON2bits.SEN);
+    }
+    else{ /* Nothing */ }
     /* Clear interrupt flag on start condition event */
     MSSP_I2C_INTERRUPT_CLEAR_FLAG();
     
     /* Report the start condition Detection */
-    if( START_CONDITION_DETECTED == SSPSTATbits.S){
+    if(TRUE == i2c_timeout_latched){
+        ret = E_NOT_OK ;
+    }
+    else if( START_CONDITION_DETECTED == SSPSTATbits.S){
         ret = E_OK ;
     }
     else if( START_CONDITION_NOT_DETECTED == SSPSTATbits.S ){
@@ -205,14 +266,22 @@ Std_ReturnType MSSP_I2C_Master_Send_Repeated_Start(void){
     Std_ReturnType ret = E_OK;
     
     /* wait until I2C is in IDLE state */
-    while((SSPCON2 & 0x1F) || (SSPSTATbits.R_W));
-    /* Initiates the repeated start condition on SDA and CLK Pin*/
-    SSPCON2bits.RSEN = 1 ; /* Initiates Repeated Start condition on SDA and SCL pins. Automatically cleared by hardware */
-    /* wait for the completion of repeated start condition */
-    while(SSPCON2bits.RSEN);
+    MSSP_I2C_WAIT_WHILE(MSSP_I2C_BUS_BUSY());
+    if(FALSE == i2c_timeout_latched){
+        /* Initiates the repeated start condition on SDA and CLK Pin*/
+        SSPCON2bits.RSEN = 1 ; /* Initiates Repeated Start condition on SDA and SCL pins. Automatically cleared by hardware */
+        /* wait for the completion of repeated start condition */
+        MSSP_I2C_WAIT_WHILE(SSPCON2bits.RSEN);
+    }
+    else{ /* Nothing */ }
     /* Clear interrupt flag on repeated start condition event */
     MSSP_I2C_INTERRUPT_CLEAR_FLAG();        
     
+    if(TRUE == i2c_timeout_latched){
+        ret = E_NOT_OK ;
+    }
+    else{ /* Nothing */ }
+    
     return ret ; 
 }
 
@@ -221,15 +290,23 @@ Std_ReturnType MSSP_I2C_Master_Send_Repeated_Start(void){
 Std_ReturnType MSSP_I2C_Master_Send_Stop(void){
     Std_ReturnType ret = E_OK;
     /* wait until I2C is in IDLE state */
-    while((SSPCON2 & 0x1F) || (SSPSTATbits.R_W));
-    /* Initiates the Stop condition on SDA and CLK Pin*/
-    SSPCON2bits.PEN = 1 ; /* Initiates Stop condition on SDA and SCL pins. Automatically cleared by hardware */
-    /* wait for the completion of Stop condition */
-    while(SSPCON2bits.PEN);
+    MSSP_I2C_WAIT_WHILE(MSSP_I2C_BUS_BUSY());
+    if(FALSE == i2c_timeout_latched){
+        /* Initiates the Stop condition on SDA and CLK Pin*/
+        SSPCON2bits.PEN = 1 ; /* Initiates Stop condition on SDA and SCL pins. Automatically cleared by hardware */
+        /* wait for the completion of Stop condition */
+        MSSP_I2C_WAIT_WHILE(SSPCON2bits.PEN);
+    }
+    else{ /* Nothing */ }
     /* Clear interrupt flag on Stop condition event */
     MSSP_I2C_INTERRUPT_CLEAR_FLAG();        
     /* Report the Stop condition Detection */
-    if( STOP_CONDITION_DETECTED == SSPSTATbits.P ){
+    if(TRUE == i2c_timeout_latched){
+        /* A wait of this transaction expired : free the bus and restart the MSSP */
+        (void)MSSP_I2C_Bus_Recovery();
+        ret = E_NOT_OK ;
+    }
+    else if( STOP_CONDITION_DETECTED == SSPSTATbits.P ){
         ret = E_OK ;
     }
     else if( STOP_CONDITION_NOT_DETECTED == SSPSTATbits.P ){
@@ -251,23 +328,31 @@ Std_ReturnType MSSP_I2C_Master_Write_Blocking(uint8 i2c_data , uint8 *_ack){
     else{
         MSSP_I2C_BUS_COLL_INTERRUPT_CLEAR_FLAG();
         /* wait until I2C is in IDLE state */
-        while ((SSPCON2 & 0x1F) || (SSPSTATbits.R_W));
-        /* Write data to the Data Register */
-        SSPBUF = i2c_data ;
-        /* Wait the Transmission to be Completed */
-        while(!PIR1bits.SSPIF);
-        /* TODO: Add timeout protection to avoid infinite blocking */
+        MSSP_I2C_WAIT_WHILE(MSSP_I2C_BUS_BUSY());
+        if(FALSE == i2c_timeout_latched){
+            /* Write data to the Data Register */
+            SSPBUF = i2c_data ;
+            /* Wait the Transmission to be Completed */
+            MSSP_I2C_WAIT_WHILE(!PIR1bits.SSPIF);
+        }
+        else{ /* Nothing */ }
         /* Clear The MSSP Interrupt Flag -> SSPIF */
         MSSP_I2C_INTERRUPT_CLEAR_FLAG();
 
         /* Report The acknowledge receive from the Slave */
-        if(I2C_ACK_REC_FROM_SLAVE == SSPCON2bits.ACKSTAT){
+        if(TRUE == i2c_timeout_latched){
+            /* Treated as not acknowledged so the callers stop the sequence */
+            *_ack = I2C_ACK_NOT_REC_FROM_SLAVE ;
+            ret = E_NOT_OK ;
+        }
+        else if(I2C_ACK_REC_FROM_SLAVE == SSPCON2bits.ACKSTAT){
             *_ack = I2C_ACK_REC_FROM_SLAVE ;
+            ret = E_OK ;
         }
         else{
             *_ack = I2C_ACK_NOT_REC_FROM_SLAVE ;
+            ret = E_OK ;
         }
-        ret = E_OK ;
     }
     
     return ret ;
@@ -282,27 +367,36 @@ Std_ReturnType MSSP_I2C_Master_Read_Blocking(uint8 ack ,uint8 * i2c_data){
     }
     else{
         /* wait until I2C is in IDLE state */
-        while ((SSPCON2 & 0x1F) || (SSPSTATbits.R_W));
-        /* Master Mode Receive Enable */
-        I2C_MASTER_RECEIVE_ENABLE_CFG();
-        /* Wait for Buffer Full Flag : A Complete Byte Received */
-        while(!SSPSTATbits.BF);
-        /* TODO: Add timeout protection to avoid infinite blocking */
-        /* Copy The Data Register to buffer variable */
-        *i2c_data = SSPBUF ;
-        /* Send ACK or NACK after read */
-        if(I2C_MASTER_SEND_ACK == ack)
-        {
-            SSPCON2bits.ACKDT = I2C_MASTER_SEND_ACK ;
-            SSPCON2bits.ACKEN = I2C_MASTER_REC_ACK_START ; /* Initiates Acknowledge sequence on SDA and SCL pins and transmit ACKDT data bit. Automatically */
-            while(SSPCON2bits.ACKEN);
-        }   
-        else if(I2C_MASTER_SEND_NOT_ACK == ack){
-            SSPCON2bits.ACKDT = I2C_MASTER_SEND_NOT_ACK ;
-            SSPCON2bits.ACKEN = I2C_MASTER_REC_ACK_START ; /* Initiates Acknowledge sequence on SDA and SCL pins and transmit ACKDT data bit. Automatically */
-            while(SSPCON2bits.ACKEN);
+        MSSP_I2C_WAIT_WHILE(MSSP_I2C_BUS_BUSY());
+        if(FALSE == i2c_timeout_latched){
+            /* Master Mode Receive Enable */
+            I2C_MASTER_RECEIVE_ENABLE_CFG();
+            /* Wait for Buffer Full Flag : A Complete Byte Received */
+            MSSP_I2C_WAIT_WHILE(!SSPSTATbits.BF);
+        }
+        else{ /* Nothing */ }
+        if(FALSE == i2c_timeout_latched){
+            /* Copy The Data Register to buffer variable */
+            *i2c_data = SSPBUF ;
+            /* Send ACK or NACK after read */
+            if(I2C_MASTER_SEND_ACK == ack)
+            {
+                SSPCON2bits.ACKDT = I2C_MASTER_SEND_ACK ;
+                SSPCON2bits.ACKEN = I2C_MASTER_REC_ACK_START ; /* Initiates Acknowledge sequence on SDA and SCL pins and transmit ACKDT data bit. Automatically */
+                MSSP_I2C_WAIT_WHILE(SSPCON2bits.ACKEN);
+            }   
+            else if(I2C_MASTER_SEND_NOT_ACK == ack){
+                SSPCON2bits.ACKDT = I2C_MASTER_SEND_NOT_ACK ;
+                SSPCON2bits.ACKEN = I2C_MASTER_REC_ACK_START ; /* Initiates Acknowledge sequence on SDA and SCL pins and transmit ACKDT data bit. Automatically */
+                MSSP_I2C_WAIT_WHILE(SSPCON2bits.ACKEN);
+            }
+            else { /* Nothing */ }    
+        }
+        else{ /* Nothing */ }
+        if(TRUE == i2c_timeout_latched){
+            ret = E_NOT_OK ;
         }
-        else { /* Nothing */ }    
+        else{ /* Nothing */ }
     }
     
     return ret ; 
@@ -341,8 +435,415 @@ Std_ReturnType MSSP_I2C_Write_Byte_Register(uint8 address, uint8 reg , uint8 dat
     return ret; 
 }
 
+Std_ReturnType MSSP_I2C_Read_Registers(uint8 address, uint8 reg , uint8 * data , uint8 length){
+    Std_ReturnType ret = E_OK;
+    uint8 ack = ZERO_INIT;
+    uint8 l_index = ZERO_INIT;
+    
+    if((NULL == data) || (ZERO_INIT == length)){
+        ret = E_NOT_OK;
+    }
+    else{
+        ret = MSSP_I2C_Master_Send_Start();
+        ret &= MSSP_I2C_Master_Write_Blocking( (address << 1) , &ack);
+        if(I2C_ACK_REC_FROM_SLAVE == ack){
+            ret &= MSSP_I2C_Master_Write_Blocking(reg , &ack);
+            ret &= MSSP_I2C_Master_Send_Repeated_Start();
+            ret &= MSSP_I2C_Master_Write_Blocking( ((address << 1)|1) , &ack);
+        }
+        else{ /* Nothing */ }
+        if(I2C_ACK_REC_FROM_SLAVE == ack){
+            /* ACK keeps the slave auto-incrementing , NACK on the last byte ends the read */
+            for(l_index = ZERO_INIT ; l_index < (length - 1) ; l_index++){
+                ret &= MSSP_I2C_Master_Read_Blocking(I2C_MASTER_SEND_ACK , &data[l_index]);
+            }
+            ret &= MSSP_I2C_Master_Read_Blocking(I2C_MASTER_SEND_NOT_ACK , &data[l_index]);
+        }
+        else{
+            ret = E_NOT_OK;
+        }
+        ret &= MSSP_I2C_Master_Send_Stop();
+    }
+    return ret; 
+}
+
+Std_ReturnType MSSP_I2C_Read_Current(uint8 address, uint8 * data , uint8 length){
+    Std_ReturnType ret = E_OK;
+    uint8 ack = ZERO_INIT;
+    uint8 l_index = ZERO_INIT;
+    
+    if((NULL == data) || (ZERO_INIT == length)){
+        ret = E_NOT_OK;
+    }
+    else{
+        ret = MSSP_I2C_Master_Send_Start();
+        ret &= MSSP_I2C_Master_Write_Blocking( ((address << 1)|1) , &ack);
+        if(I2C_ACK_REC_FROM_SLAVE == ack){
+            for(l_index = ZERO_INIT ; l_index < (length - 1) ; l_index++){
+                ret &= MSSP_I2C_Master_Read_Blocking(I2C_MASTER_SEND_ACK , &data[l_index]);
+            }
+            ret &= MSSP_I2C_Master_Read_Blocking(I2C_MASTER_SEND_NOT_ACK , &data[l_index]);
+        }
+        else{
+            ret = E_NOT_OK;
+        }
+        ret &= MSSP_I2C_Master_Send_Stop();
+    }
+    return ret; 
+}
+
+Std_ReturnType MSSP_I2C_Write_Registers(uint8 address, uint8 reg , const uint8 * data , uint8 length){
+    Std_ReturnType ret = E_OK;
+    uint8 ack = ZERO_INIT;
+    uint8 l_index = ZERO_INIT;
+    
+    if((NULL == data) || (ZERO_INIT == length)){
+        ret = E_NOT_OK;
+    }
+    else{
+        ret = MSSP_I2C_Master_Send_Start();
+        ret &= MSSP_I2C_Master_Write_Blocking( (address << 1) , &ack);
+        if(I2C_ACK_REC_FROM_SLAVE == ack){
+            ret &= MSSP_I2C_Master_Write_Blocking(reg , &ack);
+        }
+        else{ /* Nothing */ }
+        for(l_index = ZERO_INIT ; (l_index < length) && (I2C_ACK_REC_FROM_SLAVE == ack) ; l_index++){
+            ret &= MSSP_I2C_Master_Write_Blocking(data[l_index] , &ack);
+        }
+        if(l_index < length){
+            /* Address , register or a data byte was not acknowledged */
+            ret = E_NOT_OK;
+        }
+        else{ /* Nothing */ }
+        ret &= MSSP_I2C_Master_Send_Stop();
+        GPIO_MARKER_HIT(I2C);
+    }
+    return ret; 
+}
+
+Std_ReturnType MSSP_I2C_Probe(uint8 address){
+    Std_ReturnType ret = E_OK;
+    uint8 ack = I2C_ACK_NOT_REC_FROM_SLAVE;
+    
+    ret = MSSP_I2C_Master_Send_Start();
+    ret &= MSSP_I2C_Master_Write_Blocking( (address << 1) , &ack);
+    ret &= MSSP_I2C_Master_Send_Stop();
+    if(I2C_ACK_NOT_REC_FROM_SLAVE == ack){
+        ret = E_NOT_OK;
+    }
+    else{ /* Nothing */ }
+    
+    return ret; 
+}
+
+Std_ReturnType MSSP_I2C_Bus_Recovery(void){
+    Std_ReturnType ret = E_OK;
+    pin_config_t l_scl = MSSP_I2C_CLK ;
+    pin_config_t l_sda = MSSP_I2C_SDA ;
+    Logic_t l_sda_level = GPIO_PIN_LOW ;
+    uint8 l_clock = ZERO_INIT ;
+    
+    if(NULL == i2c_active_obj){
+        ret = E_NOT_OK;
+    }
+    else{
+        /* Hand SDA / SCL back to the port , the LAT bits stay low (open-drain emulation) */
+        MSSP_I2C_DISABLE_CFG();
+        (void)gpio_pin_write_logic(&l_scl , GPIO_PIN_LOW);
+        (void)gpio_pin_write_logic(&l_sda , GPIO_PIN_LOW);
+        MSSP_I2C_Recovery_Line(&l_sda , GPIO_DIRECTION_INPUT);
+        MSSP_I2C_Recovery_Line(&l_scl , GPIO_DIRECTION_INPUT);
+        (void)gpio_pin_read_logic(&l_sda , &l_sda_level);
+        
+        /* Clock the slave through the rest of its byte until it releases SDA */
+        for(l_clock = ZERO_INIT ; (l_clock < MSSP_I2C_RECOVERY_CLOCKS) && (GPIO_PIN_LOW == l_sda_level) ; l_clock++){
+            MSSP_I2C_Recovery_Line(&l_scl , GPIO_DIRECTION_OUTPUT);
+            MSSP_I2C_Recovery_Line(&l_scl , GPIO_DIRECTION_INPUT);
+            (void)gpio_pin_read_logic(&l_sda , &l_sda_level);
+        }
+        
+        /* STOP : SDA rises while SCL is high */
+        MSSP_I2C_Recovery_Line(&l_scl , GPIO_DIRECTION_OUTPUT);
+        MSSP_I2C_Recovery_Line(&l_sda , GPIO_DIRECTION_OUTPUT);
+        MSSP_I2C_Recovery_Line(&l_scl , GPIO_DIRECTION_INPUT);
+        MSSP_I2C_Recovery_Line(&l_sda , GPIO_DIRECTION_INPUT);
+        (void)gpio_pin_read_logic(&l_sda , &l_sda_level);
+        
+        /* Restart the MSSP with the last configuration */
+        ret = MSSP_I2C_Init(i2c_active_obj);
+        if(GPIO_PIN_LOW == l_sda_level){
+            ret = E_NOT_OK;
+        }
+        else{ /* Nothing */ }
+    }
+    
+    return ret;
+}
+
+Std_ReturnType MSSP_I2C_Get_Last_Error(i2c_error_t * error){
+    Std_ReturnType ret = E_OK;
+    
+    if(NULL == error){
+        ret = E_NOT_OK;
+    }
+    else{
+        *error = (TRUE == i2c_timeout_latched) ? I2C_ERROR_TIMEOUT : I2C_ERROR_NONE ;
+    }
+    return ret;
+}
+
+#if         INTERRUPT_FEATURE_ENABLE == MSSP_I2C_INTERRUPT_FEATURE_ENABLE
+Std_ReturnType MSSP_I2C_Master_Submit_Transfer(i2c_transfer_t * transfer){
+    Std_ReturnType ret = E_OK;
+    
+    if((NULL == transfer) || (MSSP_I2C_MASTER_MODE_DEFINED_CLK != SSPCON1bits.SSPM) || 
+       ((transfer->write_length > 0) && (NULL == transfer->write_buffer)) ||
+       ((transfer->read_length > 0) && (NULL == transfer->read_buffer))){
+        ret = E_NOT_OK;
+    }
+    else{
+        /* The ISR starts the next transfer when it finishes one , keep it out while the idle engine is kicked */
+        MSSP_I2C_INTERRUPT_DISABLE();
+        if(SPSC_QUEUE_IS_FULL(i2c_transfer_queue)){
+            ret = E_NOT_OK;
+        }
+        else{
+            transfer->status = I2C_TRANSFER_PENDING;
+            SPSC_QUEUE_BACK(i2c_transfer_queue) = transfer;
+            SPSC_QUEUE_PUBLISH(i2c_transfer_queue , 1);
+            if(I2C_ENGINE_IDLE == i2c_engine_state){
+                MSSP_I2C_Engine_Start_Next();
+            }
+            else{ /* Nothing */ }
+        }
+        MSSP_I2C_INTERRUPT_ENABLE();
+    }
+    
+    return ret;
+}
+
+Std_ReturnType MSSP_I2C_Master_Is_Idle(uint8 * is_idle){
+    Std_ReturnType ret = E_OK;
+    
+    if(NULL == is_idle){
+        ret = E_NOT_OK;
+    }
+    else{
+        *is_idle = ((I2C_ENGINE_IDLE == i2c_engine_state) && SPSC_QUEUE_IS_EMPTY(i2c_transfer_queue)) ? TRUE : FALSE;
+    }
+    
+    return ret;
+}
+
+Std_ReturnType MSSP_I2C_Slave_Register_Map_Init(const i2c_slave_register_map_t * map){
+    Std_ReturnType ret = E_OK;
+    
+    if(NULL == map){
+        MSSP_I2C_INTERRUPT_DISABLE();
+        i2c_slave_map = NULL;
+        SSPCON2bits.SEN = 0 ;
+        MSSP_I2C_INTERRUPT_ENABLE();
+    }
+    else if((NULL == map->registers) || (ZERO_INIT == map->length) || (!MSSP_I2C_IS_SLAVE_MODE())){
+        ret = E_NOT_OK;
+    }
+    else{
+        MSSP_I2C_INTERRUPT_DISABLE();
+        i2c_slave_pointer = ZERO_INIT;
+        i2c_slave_pointer_expected = FALSE;
+        i2c_slave_map = map;
+        /* Stretch the clock after every byte until the ISR has serviced it */
+        SSPCON2bits.SEN = 1 ;
+        MSSP_I2C_INTERRUPT_ENABLE();
+    }
+    
+    return ret;
+}
+#endif
+
 /* Static Function Definition */
 
+#if         INTERRUPT_FEATURE_ENABLE == MSSP_I2C_INTERRUPT_FEATURE_ENABLE
+/**
+ * @brief Start the transfer at the queue tail , or go idle if the queue is empty
+ */
+static void MSSP_I2C_Engine_Start_Next(void){
+    if(!SPSC_QUEUE_IS_EMPTY(i2c_transfer_queue)){
+        i2c_engine_index = ZERO_INIT;
+        i2c_engine_result = I2C_TRANSFER_DONE;
+        i2c_engine_state = I2C_ENGINE_START;
+        (void)Power_Vote_Busy(POWER_VOTE_I2C);
+        MSSP_I2C_INTERRUPT_CLEAR_FLAG();
+        SSPCON2bits.SEN = 1 ;
+    }
+    else{
+        i2c_engine_state = I2C_ENGINE_IDLE;
+        (void)Power_Vote_Idle(POWER_VOTE_I2C);
+    }
+}
+
+/**
+ * @brief Report the current transfer , dequeue it and start the next one
+ */
+static void MSSP_I2C_Engine_Finish(i2c_transfer_status_t result){
+    i2c_transfer_t * l_transfer = SPSC_QUEUE_FRONT(i2c_transfer_queue);
+    
+    SPSC_QUEUE_RELEASE(i2c_transfer_queue);
+    l_transfer->status = result;
+    if(l_transfer->transfer_complete_callback){
+        l_transfer->transfer_complete_callback(l_transfer);
+    }
+    else{ /* Nothing */ }
+    MSSP_I2C_Engine_Start_Next();
+}
+
+/**
+ * @brief Advance the current transfer by one bus event (called on SSPIF)
+ */
+static void MSSP_I2C_Engine_Step(void){
+    i2c_transfer_t * l_transfer = SPSC_QUEUE_FRONT(i2c_transfer_queue);
+    
+    switch(i2c_engine_state){
+        case I2C_ENGINE_START :
+            if((ZERO_INIT == l_transfer->write_length) && (ZERO_INIT < l_transfer->read_length)){
+                SSPBUF = (uint8)((l_transfer->address << 1) | 1);
+                i2c_engine_state = I2C_ENGINE_ADDRESS_READ;
+            }
+            else{
+                SSPBUF = (uint8)(l_transfer->address << 1);
+                i2c_engine_state = I2C_ENGINE_ADDRESS_WRITE;
+            }
+            break;
+            
+        case I2C_ENGINE_ADDRESS_WRITE :
+        case I2C_ENGINE_DATA_WRITE :
+            if(I2C_ACK_NOT_REC_FROM_SLAVE == SSPCON2bits.ACKSTAT){
+                i2c_engine_result = I2C_TRANSFER_NACK;
+                SSPCON2bits.PEN = 1 ;
+                i2c_engine_state = I2C_ENGINE_STOP;
+            }
+            else if(i2c_engine_index < l_transfer->write_length){
+                SSPBUF = l_transfer->write_buffer[i2c_engine_index++];
+                i2c_engine_state = I2C_ENGINE_DATA_WRITE;
+            }
+            else if(ZERO_INIT < l_transfer->read_length){
+                i2c_engine_index = ZERO_INIT;
+                SSPCON2bits.RSEN = 1 ;
+                i2c_engine_state = I2C_ENGINE_REPEATED_START;
+            }
+            else{
+                SSPCON2bits.PEN = 1 ;
+                i2c_engine_state = I2C_ENGINE_STOP;
+            }
+            break;
+            
+        case I2C_ENGINE_REPEATED_START :
+            SSPBUF = (uint8)((l_transfer->address << 1) | 1);
+            i2c_engine_state = I2C_ENGINE_ADDRESS_READ;
+            break;
+            
+        case I2C_ENGINE_ADDRESS_READ :
+            if(I2C_ACK_NOT_REC_FROM_SLAVE == SSPCON2bits.ACKSTAT){
+                i2c_engine_result = I2C_TRANSFER_NACK;
+                SSPCON2bits.PEN = 1 ;
+                i2c_engine_state = I2C_ENGINE_STOP;
+            }
+            else{
+                I2C_MASTER_RECEIVE_ENABLE_CFG();
+                i2c_engine_state = I2C_ENGINE_DATA_READ;
+            }
+            break;
+            
+        case I2C_ENGINE_DATA_READ :
+            l_transfer->read_buffer[i2c_engine_index++] = SSPBUF;
+            /* ACK every byte except the last one */
+            SSPCON2bits.ACKDT = (i2c_engine_index < l_transfer->read_length) ? I2C_MASTER_SEND_ACK : I2C_MASTER_SEND_NOT_ACK ;
+            SSPCON2bits.ACKEN = I2C_MASTER_REC_ACK_START ;
+            i2c_engine_state = I2C_ENGINE_ACK;
+            break;
+            
+        case I2C_ENGINE_ACK :
+            if(i2c_engine_index < l_transfer->read_length){
+                I2C_MASTER_RECEIVE_ENABLE_CFG();
+                i2c_engine_state = I2C_ENGINE_DATA_READ;
+            }
+            else{
+                SSPCON2bits.PEN = 1 ;
+                i2c_engine_state = I2C_ENGINE_STOP;
+            }
+            break;
+            
+        case I2C_ENGINE_STOP :
+            MSSP_I2C_Engine_Finish(i2c_engine_result);
+            break;
+            
+        default :
+            i2c_engine_state = I2C_ENGINE_IDLE;
+            break;
+    }
+}
+
+/**
+ * @brief Serve one slave event of the register map (called on SSPIF)
+ *
+ * SSPSTAT decodes the event :
+ *  - BF , address  : addr+W -> next byte is the pointer , addr+R -> send the first byte
+ *  - BF , data     : pointer byte or register write
+ *  - R_W , data    : master acknowledged , send the next byte
+ *  - anything else : master NACK (end of read) , START or STOP , nothing to do
+ */
+static void MSSP_I2C_Slave_Step(void){
+    const i2c_slave_register_map_t * l_map = i2c_slave_map;
+    uint8 l_data = ZERO_INIT;
+    uint8 l_mask = 0xFF;
+    
+    if(SSPSTATbits.BF){
+        l_data = SSPBUF;
+        if(SSPSTATbits.R_W){
+            /* Address + Read : load the first byte , then release SCL */
+            SSPCON1bits.WCOL = 0 ;
+            SSPBUF = l_map->registers[i2c_slave_pointer];
+            I2C_CLOCK_STRETCH_DISABLE();
+            MSSP_I2C_SLAVE_POINTER_NEXT(l_map);
+        }
+        else{
+            I2C_CLOCK_STRETCH_DISABLE();
+            if(!SSPSTATbits.D_A){
+                /* Address + Write : the first data byte sets the pointer */
+                i2c_slave_pointer_expected = TRUE;
+            }
+            else if(TRUE == i2c_slave_pointer_expected){
+                i2c_slave_pointer_expected = FALSE;
+                i2c_slave_pointer = (l_data < l_map->length) ? l_data : ZERO_INIT;
+            }
+            else{
+                if(NULL != l_map->write_mask){
+                    l_mask = l_map->write_mask[i2c_slave_pointer];
+                }
+                else{ /* Every bit writable */ }
+                l_map->registers[i2c_slave_pointer] = (uint8)((l_map->registers[i2c_slave_pointer] & (uint8)~l_mask) | (l_data & l_mask));
+                if(NULL != l_map->register_written){
+                    l_map->register_written(i2c_slave_pointer);
+                }
+                else{ /* Nothing */ }
+                MSSP_I2C_SLAVE_POINTER_NEXT(l_map);
+            }
+        }
+    }
+    else if((SSPSTATbits.R_W) && (SSPSTATbits.D_A)){
+        /* Master acknowledged the last byte : keep streaming */
+        SSPCON1bits.WCOL = 0 ;
+        SSPBUF = l_map->registers[i2c_slave_pointer];
+        I2C_CLOCK_STRETCH_DISABLE();
+        MSSP_I2C_SLAVE_POINTER_NEXT(l_map);
+    }
+    else{
+        /* Master NACK , START or STOP : the slave logic is already reset */
+        I2C_CLOCK_STRETCH_DISABLE();
+    }
+}
+#endif
+
 
 static inline void MSSP_I2C_PIN_CONFIG(void){
     gpio_pin_initialize(&MSSP_I2C_SDA) ; /* Serial Data (SDA) is Input */
@@ -380,26 +881,63 @@ static void MSSP_I2C_SMBus_Configuration(const mssp_i2c_t * i2c_obj){
 }
 
 static inline void MSSP_I2C_Master_Mode_Clock_Configuration(const mssp_i2c_t * i2c_obj){
-    SSPADD = (uint8) (( _XTAL_FREQ / (4 * i2c_obj->i2c_clock) ) - 1) ;    
+    uint32 l_divider = i2c_fosc / (4 * i2c_obj->i2c_clock);
+    
+    /* Below 3 the baud generator does not run , SCL is then slower than asked */
+    SSPADD = (uint8)((l_divider > (I2C_SSPADD_MIN + 1)) ? (l_divider - 1) : I2C_SSPADD_MIN) ;    
 }
 
+/**
+ * @brief Release (INPUT , pulled high) or drive low (OUTPUT) one bus line , then hold for half a clock
+ */
+static void MSSP_I2C_Recovery_Line(pin_config_t * line , direction_t level){
+    line->direction = level ;
+    (void)gpio_pin_direction_initialize(line);
+    __delay_us(MSSP_I2C_RECOVERY_HALF_PERIOD_US);
+}
+
+#if         MSSP_I2C_TIMEOUT_SOURCE == MSSP_I2C_TIMEOUT_SOURCE_TICK
+/**
+ * @brief Read Timer1 , the low byte first so TMR1H is latched coherently
+ */
+static inline uint16 MSSP_I2C_Timer1_Ticks(void){
+    uint8 l_tmr1l = TMR1L ;
+    uint8 l_tmr1h = TMR1H ;
+    return (uint16)(((uint16)l_tmr1h << 8) | l_tmr1l) ;
+}
+#endif
+
 /* Interrupt Service Routines */
 
 /**
  * @brief MSSP I2C Interrupt Service Routine
  *
- * Clears interrupt flag and calls user-defined
- * callback if registered.
+ * Advances the asynchronous master transfer engine when a transfer
+ * is on the bus , or serves the slave register map when one is attached.
+ * Otherwise clears interrupt flag and calls user-defined callback if
+ * registered.
  */
 void MSSP_I2C_ISR(void){
 #if                     INTERRUPT_FEATURE_ENABLE == MSSP_I2C_INTERRUPT_FEATURE_ENABLE    
     
-    if(MSSP_I2C_InterruptHandler){
-        MSSP_I2C_InterruptHandler();
-    }    
-    else{ /* Nothing */ }
-    
-    MSSP_I2C_INTERRUPT_CLEAR_FLAG();
+    if(I2C_ENGINE_IDLE != i2c_engine_state){
+        /* Asynchronous master transfer in progress */
+        MSSP_I2C_INTERRUPT_CLEAR_FLAG();
+        MSSP_I2C_Engine_Step();
+    }
+    else if(NULL != i2c_slave_map){
+        /* Slave register map , served without the default handler */
+        MSSP_I2C_INTERRUPT_CLEAR_FLAG();
+        MSSP_I2C_Slave_Step();
+    }
+    else{
+        if(MSSP_I2C_InterruptHandler){
+            MSSP_I2C_InterruptHandler();
+        }    
+        else{ /* Nothing */ }
+
+        MSSP_I2C_INTERRUPT_CLEAR_FLAG();
+    }
     
     if(SSPCON1bits.SSPOV){
         SSPCON1bits.SSPOV = 0;
@@ -419,6 +957,13 @@ void MSSP_I2C_ISR(void){
 void MSSP_I2C_BC_ISR(void){
 #if   INTERRUPT_FEATURE_ENABLE == MSSP_I2C_BUS_COL_INTERRUPT_FEATURE_ENABLE    
     MSSP_I2C_BUS_COLL_INTERRUPT_CLEAR_FLAG();
+#if   INTERRUPT_FEATURE_ENABLE == MSSP_I2C_INTERRUPT_FEATURE_ENABLE
+    /* The master lost the bus : the MSSP returns to idle , abort the current transfer */
+    if(I2C_ENGINE_IDLE != i2c_engine_state){
+        MSSP_I2C_Engine_Finish(I2C_TRANSFER_BUS_COLLISION);
+    }
+    else{ /* Nothing */ }
+#endif
     if(MSSP_I2C_Bus_Coll_InterruptHandler){
         MSSP_I2C_Bus_Coll_InterruptHandler();
     }
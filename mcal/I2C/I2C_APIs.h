@@ -14,7 +14,10 @@
  *  - I2C Slave mode (7-bit / 10-bit)
  *  - Start / Repeated Start / Stop generation
  *  - ACK / NACK control
- *  - Blocking read/write operations
+ *  - Blocking read/write operations with bounded bus waits
+ *  - Bus recovery (9 SCL clocks + STOP) and re-init after a timeout
+ *  - Queued interrupt-driven master transfers
+ *  - Interrupt-driven slave register map with auto-incrementing pointer
  *  - Bus collision detection
  *  - Optional interrupt support with callback mechanism
  *
@@ -31,6 +34,7 @@
 #include"mcal_internal_interrupt.h"
 #include"hal_gpio.h"
 #include"std_types.h"
+#include"spsc_queue.h"
 
 /* Section : Macro Declaration */
 
@@ -78,6 +82,37 @@
 #define I2C_MASTER_REC_ACK_START            1
 #define I2C_MASTER_REC_NO_SEND_ACK          0xFFU
 
+/* Asynchronous master transfer queue depth (descriptors) , MUST be a power of two (2 .. 128) */
+#define MSSP_I2C_TRANSFER_QUEUE_SIZE        4
+
+#if !SPSC_QUEUE_SIZE_VALID(MSSP_I2C_TRANSFER_QUEUE_SIZE)
+#error "MSSP_I2C_TRANSFER_QUEUE_SIZE must be a power of two between 2 and 128"
+#endif
+
+/* Slave register map : SSPM of the four slave modes (6 , 7 , 14 , 15) */
+#define MSSP_I2C_IS_SLAVE_MODE()            (0x06 == (SSPCON1bits.SSPM & 0x06))
+
+/* Bus Wait Timeout Source */
+#define MSSP_I2C_TIMEOUT_SOURCE_LOOP        0   /* Count polling iterations */
+#define MSSP_I2C_TIMEOUT_SOURCE_TICK        1   /* Elapsed ticks of a free-running 16-bit counter */
+
+#define MSSP_I2C_TIMEOUT_SOURCE             MSSP_I2C_TIMEOUT_SOURCE_LOOP
+
+/* Polling iterations before a wait gives up , ~10 instruction cycles each : ~25 ms @ 8 MHz */
+#define MSSP_I2C_TIMEOUT_LOOPS              5000U
+
+/* Tick source : Timer1 free-running , initialized and started by the application */
+#define MSSP_I2C_TIMEOUT_TICK_READ()        MSSP_I2C_Timer1_Ticks()
+/* Ticks before a wait gives up : 25 ms @ Fosc/4 = 2 MHz , prescaler 1:1 */
+#define MSSP_I2C_TIMEOUT_TICKS              50000U
+
+/* SCL half period while clocking a stuck slave off the bus (~100 kHz) */
+#define MSSP_I2C_RECOVERY_HALF_PERIOD_US    5
+#define MSSP_I2C_RECOVERY_CLOCKS            9
+
+/* Smallest SSPADD the baud rate generator accepts , a slow Fosc saturates here */
+#define I2C_SSPADD_MIN                      3
+
 
 /* Section : Macro Functions Declarations */
 
@@ -119,6 +154,70 @@ typedef enum{
     MSSP_I2C_SLAVE_10BIT_ADDR_INT_ENABLE    = 15 ,                        
 }MSSP_I2C_Mode_Select;
 
+/**
+ * @brief Bus error of the last blocking transaction , see MSSP_I2C_Get_Last_Error
+ */
+typedef enum{
+    I2C_ERROR_NONE = 0 ,
+    I2C_ERROR_TIMEOUT                   /* A bus wait expired , the bus was recovered */
+}i2c_error_t;
+
+/**
+ * @brief Asynchronous master transfer status
+ */
+typedef enum{
+    I2C_TRANSFER_IDLE = 0 ,             /* Never submitted */
+    I2C_TRANSFER_PENDING ,              /* Queued or on the bus */
+    I2C_TRANSFER_DONE ,                 /* Completed , every byte acknowledged */
+    I2C_TRANSFER_NACK ,                 /* Address or data byte not acknowledged */
+    I2C_TRANSFER_BUS_COLLISION          /* Aborted by a bus collision */
+}i2c_transfer_status_t;
+
+/**
+ * @brief Asynchronous master transfer descriptor
+ *
+ * Describes one complete bus transaction :
+ * START -> addr+W -> write_buffer -> [RSTART -> addr+R -> read_buffer] -> STOP
+ *  - write_length == 0 : read-only transfer (START -> addr+R -> ...)
+ *  - read_length  == 0 : write-only transfer
+ *  - both 0            : address probe
+ *
+ * The descriptor and both buffers are owned by the caller and must stay
+ * valid until `status` leaves I2C_TRANSFER_PENDING.
+ * The completion callback runs in interrupt context.
+ */
+typedef struct i2c_transfer_s{
+    const uint8 *write_buffer ;
+    uint8 *read_buffer ;
+    void (* transfer_complete_callback)(struct i2c_transfer_s *transfer);
+    uint8 address ;                                 /* 7-bit slave address */
+    uint8 write_length ;
+    uint8 read_length ;
+    volatile i2c_transfer_status_t status ;
+}i2c_transfer_t;
+
+/**
+ * @brief Slave register map emulated by MSSP_I2C_ISR
+ *
+ * The master addresses the map like a register-based device :
+ *  - Write : addr+W -> pointer -> data ... (stored from the pointer on)
+ *  - Read  : addr+R -> data ...            (sent from the pointer on)
+ *  - Write pointer , RSTART , read          : batch read from any register
+ * The pointer auto-increments after every byte and wraps at `length` ,
+ * a pointer byte past the end of the map selects register 0.
+ *
+ * - registers          : Map storage , owned by the application
+ * - write_mask         : Writable bits per register , NULL = every bit writable
+ * - register_written   : Optional , called in interrupt context after a master
+ *                        write to one register
+ */
+typedef struct{
+    volatile uint8 *registers ;
+    const uint8 *write_mask ;
+    void (* register_written)(uint8 reg);
+    uint8 length ;
+}i2c_slave_register_map_t;
+
 /**
  * @brief Low-level I2C configuration structure
  *
@@ -153,18 +252,12 @@ typedef struct{
                     /* Bus Collision Interrupt */
 #if         INTERRUPT_FEATURE_ENABLE == MSSP_I2C_BUS_COL_INTERRUPT_FEATURE_ENABLE     
     void (* MSSP_I2C_REPORT_WRITE_COLLISION)(void);
-#if         INTERRUPT_FEATURE_ENABLE == INTERRUPT_PRIORITY_LEVELS_ENABLE    
-    INTERRUPT_Priority_cfg mssp_i2c_Bus_COL_int_priority_level ;
-#endif    
 #endif
 /* ========================================================= */ 
                     /* I2C Default Interrupt */    
 #if         INTERRUPT_FEATURE_ENABLE == MSSP_I2C_INTERRUPT_FEATURE_ENABLE     
     void (* MSSP_I2C_DEFAULT_INTERRUPT_HANDLER)(void);
     void (* MSSP_I2C_REPORT_RECEIVE_OVERFLOW)(void);
-#if         INTERRUPT_FEATURE_ENABLE == INTERRUPT_PRIORITY_LEVELS_ENABLE    
-    INTERRUPT_Priority_cfg mssp_i2c_int_priority_level ;
-#endif
 #endif       
 /* ========================================================= */    
                 /* End Interrupt Configurations */ 
@@ -207,6 +300,24 @@ Std_ReturnType MSSP_I2C_Init(const mssp_i2c_t * i2c_obj);
  */
 Std_ReturnType MSSP_I2C_DeInit(const mssp_i2c_t * i2c_obj);
 
+/**
+ * @brief Recompute the master baud rate generator for a new Fosc
+ *
+ * @param i2c_obj Pointer to the I2C configuration passed to MSSP_I2C_Init
+ * @param fosc    New oscillator frequency in Hz
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Fosc recorded (SSPADD reloaded in Master mode)
+ *         - E_NOT_OK : Null pointer , zero Fosc or zero bus clock
+ *
+ * @note
+ * Register it behind a Clock_Register_Listener() handler. Clock_Switch()
+ * refuses to run while a transfer holds the I2C power vote , so SSPADD
+ * never changes in the middle of a byte. A slow Fosc clamps SSPADD to
+ * I2C_SSPADD_MIN , the bus then runs below i2c_clock.
+ */
+Std_ReturnType MSSP_I2C_Clock_Update(const mssp_i2c_t * i2c_obj , uint32 fosc);
+
 /**
  * @brief Generate Start condition on I2C bus (Master mode)
  *
@@ -214,6 +325,11 @@ Std_ReturnType MSSP_I2C_DeInit(const mssp_i2c_t * i2c_obj);
  *
  * @note
  * Blocks until Start condition is completed by hardware.
+ * Clears the timeout latch of the previous transaction. Every bus wait of
+ * the driver is bounded by MSSP_I2C_TIMEOUT_LOOPS (or MSSP_I2C_TIMEOUT_TICKS) ,
+ * once one expires the remaining steps of the transaction return
+ * E_NOT_OK without touching the bus (MSSP_I2C_Get_Last_Error then reads
+ * I2C_ERROR_TIMEOUT).
  */
 Std_ReturnType MSSP_I2C_Master_Send_Start(void);
 
@@ -228,6 +344,8 @@ Std_ReturnType MSSP_I2C_Master_Send_Repeated_Start(void);
  * @brief Generate Stop condition on I2C bus (Master mode)
  *
  * @return Std_ReturnType
+ *         - E_NOT_OK : Also when a wait of this transaction expired ,
+ *                      MSSP_I2C_Bus_Recovery has then been run
  */
 Std_ReturnType MSSP_I2C_Master_Send_Stop(void);
 
@@ -242,7 +360,7 @@ Std_ReturnType MSSP_I2C_Master_Send_Stop(void);
  *
  * @note
  * Function waits until transmission is complete.
- * ACK status is stored in `_ack`.
+ * ACK status is stored in `_ack` , a timeout reports I2C_ACK_NOT_REC_FROM_SLAVE.
  */
 Std_ReturnType MSSP_I2C_Master_Write_Blocking( uint8 i2c_data , uint8 *_ack);
 
@@ -271,6 +389,7 @@ Std_ReturnType MSSP_I2C_Master_Read_Blocking(uint8 ack ,uint8 * i2c_data);
  * @return Std_ReturnType
  *         - E_OK     : Read successful
  *         - E_NOT_OK : Error occurred
+ *           (also on a bus timeout , see MSSP_I2C_Get_Last_Error)
  *
  * @note
  * Implements the following I2C sequence:
@@ -297,5 +416,162 @@ Std_ReturnType MSSP_I2C_Read_Byte_Register(uint8 address, uint8 reg , uint8 * da
 
 Std_ReturnType MSSP_I2C_Write_Byte_Register(uint8 address, uint8 reg , uint8 data);
 
+/**
+ * @brief Read a block of consecutive registers   <- Blocking Method ->
+ *
+ * @param address 7-bit I2C slave address
+ * @param reg     First register address
+ * @param data    Pointer to the destination buffer
+ * @param length  Number of registers to read (>= 1)
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Read successful
+ *         - E_NOT_OK : Null pointer , zero length or slave did not acknowledge
+ *           (also on a bus timeout , see MSSP_I2C_Get_Last_Error)
+ *
+ * @note
+ * Uses the slave's register pointer auto-increment :
+ *
+ * START -> Address + Write -> reg -> Repeated START -> Address + Read
+ * -> Read (ACK) x (length - 1) -> Read (NACK) -> STOP
+ */
+Std_ReturnType MSSP_I2C_Read_Registers(uint8 address, uint8 reg , uint8 * data , uint8 length);
+
+/**
+ * @brief Read from the slave's current register pointer   <- Blocking Method ->
+ *
+ * @param address 7-bit I2C slave address
+ * @param data    Pointer to the destination buffer
+ * @param length  Number of bytes to read (>= 1)
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Read successful
+ *         - E_NOT_OK : Null pointer , zero length or slave did not acknowledge
+ *           (also on a bus timeout , see MSSP_I2C_Get_Last_Error)
+ *
+ * @note
+ * No register byte is sent , the slave answers from the pointer left by
+ * the previous access :
+ *
+ * START -> Address + Read -> Read (ACK) x (length - 1) -> Read (NACK) -> STOP
+ */
+Std_ReturnType MSSP_I2C_Read_Current(uint8 address, uint8 * data , uint8 length);
+
+/**
+ * @brief Write a block of consecutive registers   <- Blocking Method ->
+ *
+ * @param address 7-bit I2C slave address
+ * @param reg     First register address
+ * @param data    Pointer to the source buffer
+ * @param length  Number of registers to write (>= 1)
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Write successful
+ *         - E_NOT_OK : Null pointer , zero length or slave did not acknowledge
+ *           (also on a bus timeout , see MSSP_I2C_Get_Last_Error)
+ *
+ * @note
+ * START -> Address + Write -> reg -> data[0] ... data[length - 1] -> STOP
+ */
+Std_ReturnType MSSP_I2C_Write_Registers(uint8 address, uint8 reg , const uint8 * data , uint8 length);
+
+/**
+ * @brief Check that a slave acknowledges its address   <- Blocking Method ->
+ *
+ * @param address 7-bit I2C slave address
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Address acknowledged
+ *         - E_NOT_OK : No acknowledge (absent or busy , e.g. EEPROM write cycle)
+ *           (also on a bus timeout , see MSSP_I2C_Get_Last_Error)
+ *
+ * @note
+ * START -> Address + Write -> STOP
+ */
+Std_ReturnType MSSP_I2C_Probe(uint8 address);
+
+/**
+ * @brief Free a stuck bus and re-initialize the driver without a reset
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : SDA released and the MSSP re-initialized
+ *         - E_NOT_OK : SDA still held low after the recovery clocks ,
+ *                      or MSSP_I2C_Init was never called
+ *
+ * @note
+ * Disables the MSSP , clocks SCL (RC3) up to nine times through GPIO until
+ * the slave releases SDA , drives a STOP (SDA low -> high while SCL is high)
+ * then re-runs MSSP_I2C_Init with the last configuration.
+ * Called automatically by MSSP_I2C_Master_Send_Stop when a wait of the
+ * current transaction timed out.
+ */
+Std_ReturnType MSSP_I2C_Bus_Recovery(void);
+
+/**
+ * @brief Bus error of the last blocking transaction
+ *
+ * @param error Pointer to the returned error
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : error written
+ *         - E_NOT_OK : Null pointer
+ *
+ * @note
+ * The blocking calls return E_OK / E_NOT_OK only , so a NACK and a stuck
+ * bus look the same to a ret &= chain. After E_NOT_OK this tells them
+ * apart. Cleared by the next MSSP_I2C_Master_Send_Start.
+ */
+Std_ReturnType MSSP_I2C_Get_Last_Error(i2c_error_t * error);
+
+#if         INTERRUPT_FEATURE_ENABLE == MSSP_I2C_INTERRUPT_FEATURE_ENABLE
+/**
+ * @brief Queue an asynchronous master transfer   <- Interrupt Method ->
+ *
+ * @param transfer Pointer to a caller-owned transfer descriptor
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Transfer queued , `status` is I2C_TRANSFER_PENDING
+ *         - E_NOT_OK : Null pointer , MSSP not in master mode or queue full
+ *
+ * @note
+ * Returns immediately. The START / address / data / RSTART / STOP sequence
+ * is advanced by MSSP_I2C_ISR , one step per SSPIF event , and the next
+ * queued transfer starts as soon as the STOP completes.
+ * Do not call the blocking APIs while a transfer is in progress.
+ */
+Std_ReturnType MSSP_I2C_Master_Submit_Transfer(i2c_transfer_t * transfer);
+
+/**
+ * @brief Check whether the asynchronous transfer engine is idle
+ *
+ * @param is_idle Pointer to store TRUE (no transfer queued or on the bus) or FALSE
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Status returned
+ *         - E_NOT_OK : Null pointer
+ */
+Std_ReturnType MSSP_I2C_Master_Is_Idle(uint8 * is_idle);
+
+/**
+ * @brief Attach a register map to the slave   <- Interrupt Method ->
+ *
+ * @param map Pointer to the map , NULL detaches it
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Map served by MSSP_I2C_ISR , pointer reset to 0
+ *         - E_NOT_OK : MSSP not in a slave mode , NULL registers or zero length
+ *
+ * @note
+ * Call it after MSSP_I2C_Init. While a map is attached the ISR serves
+ * every address / data / read / write event itself and the default
+ * interrupt handler is not called.
+ * Clock stretching (SSPCON2.SEN) is enabled , every byte is held until
+ * the ISR has read or loaded SSPBUF , and CKP is released right after
+ * that access , before the map is updated. The ISR never waits on BF.
+ * MSSP_I2C_DeInit detaches the map.
+ */
+Std_ReturnType MSSP_I2C_Slave_Register_Map_Init(const i2c_slave_register_map_t * map);
+#endif
+
 #endif	/* I2C_APIS_H */
 
@@ -0,0 +1,86 @@
+/**
+ * @file    I2C_Bus.c
+ * @author  Abdelmoniem Ahmed
+ * @LinkedIn: https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * @brief   I2C bus selector implementation
+ *
+ * Target MCU : PIC18F4620
+ * Compiler   : XC8
+ * Layer      : MCAL
+ */
+
+/* Section : Includes */
+
+#include"I2C_Bus.h"
+
+/* Global Function Definition */
+
+Std_ReturnType I2C_Bus_Read_Registers(i2c_bus_t bus , uint8 address , uint8 reg , uint8 * data , uint8 length){
+    Std_ReturnType ret = E_NOT_OK;
+    
+    switch(bus){
+        case I2C_BUS_MSSP : ret = MSSP_I2C_Read_Registers(address , reg , data , length); break;
+#if         SOFT_I2C_CFG == SOFT_I2C_ENABLE
+        case I2C_BUS_SOFT : ret = SOFT_I2C_Read_Registers(address , reg , data , length); break;
+#endif
+        default : ret = E_NOT_OK; break;
+    }
+    
+    return ret;
+}
+
+Std_ReturnType I2C_Bus_Read_Current(i2c_bus_t bus , uint8 address , uint8 * data , uint8 length){
+    Std_ReturnType ret = E_NOT_OK;
+    
+    switch(bus){
+        case I2C_BUS_MSSP : ret = MSSP_I2C_Read_Current(address , data , length); break;
+#if         SOFT_I2C_CFG == SOFT_I2C_ENABLE
+        case I2C_BUS_SOFT : ret = SOFT_I2C_Read_Current(address , data , length); break;
+#endif
+        default : ret = E_NOT_OK; break;
+    }
+    
+    return ret;
+}
+
+Std_ReturnType I2C_Bus_Write_Registers(i2c_bus_t bus , uint8 address , uint8 reg , const uint8 * data , uint8 length){
+    Std_ReturnType ret = E_NOT_OK;
+    
+    switch(bus){
+        case I2C_BUS_MSSP : ret = MSSP_I2C_Write_Registers(address , reg , data , length); break;
+#if         SOFT_I2C_CFG == SOFT_I2C_ENABLE
+        case I2C_BUS_SOFT : ret = SOFT_I2C_Write_Registers(address , reg , data , length); break;
+#endif
+        default : ret = E_NOT_OK; break;
+    }
+    
+    return ret;
+}
+
+Std_ReturnType I2C_Bus_Probe(i2c_bus_t bus , uint8 address){
+    Std_ReturnType ret = E_NOT_OK;
+    
+    switch(bus){
+        case I2C_BUS_MSSP : ret = MSSP_I2C_Probe(address); break;
+#if         SOFT_I2C_CFG == SOFT_I2C_ENABLE
+        case I2C_BUS_SOFT : ret = SOFT_I2C_Probe(address); break;
+#endif
+        default : ret = E_NOT_OK; break;
+    }
+    
+    return ret;
+}
+
+Std_ReturnType I2C_Bus_Get_Last_Error(i2c_bus_t bus , i2c_error_t * error){
+    Std_ReturnType ret = E_NOT_OK;
+    
+    switch(bus){
+        case I2C_BUS_MSSP : ret = MSSP_I2C_Get_Last_Error(error); break;
+#if         SOFT_I2C_CFG == SOFT_I2C_ENABLE
+        case I2C_BUS_SOFT : ret = SOFT_I2C_Get_Last_Error(error); break;
+#endif
+        default : ret = E_NOT_OK; break;
+    }
+    
+    return ret;
+}
@@ -0,0 +1,79 @@
+/**
+ * @file    I2C_Bus.h
+ * @author  Abdelmoniem Ahmed
+ * @LinkedIn: https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * @brief   I2C bus selector : one API over the MSSP and the software master
+ *
+ * @details
+ * ECUAL device drivers talk through these calls with a bus id , so a
+ * device moves from the MSSP bus to the software bus (I2C_Soft.h) without
+ * a driver change. I2C_BUS_MSSP is 0 : a zero-initialized binding keeps
+ * the MSSP.
+ *
+ * Each bus is initialized by its own driver (MSSP_I2C_Init / SOFT_I2C_Init).
+ *
+ * Target MCU : PIC18F4620
+ * Compiler   : XC8
+ * Layer      : MCAL
+ */
+
+#ifndef I2C_BUS_H
+#define	I2C_BUS_H
+
+/* Section : Includes */
+
+#include"I2C_APIs.h"
+#include"I2C_Soft.h"
+
+/* Section : Macro Declaration */
+
+/* Section : Macro Functions Declarations */
+
+/* Section : Data Types Declarations */
+
+/**
+ * @brief I2C bus a device is wired to
+ */
+typedef enum{
+    I2C_BUS_MSSP = 0 ,                  /* RC3 / RC4 , MSSP_I2C_xxx */
+    I2C_BUS_SOFT                        /* GPIO_FAST_SOFT_I2C_SCL / _SDA , SOFT_I2C_xxx */
+}i2c_bus_t;
+
+/* Section : Function Declarations */
+
+/**
+ * @brief Read a block of consecutive registers on a bus
+ *
+ * @return Std_ReturnType , as MSSP_I2C_Read_Registers. E_NOT_OK for an
+ *         unknown bus or the software bus when SOFT_I2C_CFG is disabled.
+ */
+Std_ReturnType I2C_Bus_Read_Registers(i2c_bus_t bus , uint8 address , uint8 reg , uint8 * data , uint8 length);
+
+/**
+ * @brief Read from the slave's current register pointer on a bus
+ *
+ * @return Std_ReturnType , as MSSP_I2C_Read_Current
+ */
+Std_ReturnType I2C_Bus_Read_Current(i2c_bus_t bus , uint8 address , uint8 * data , uint8 length);
+
+/**
+ * @brief Write a block of consecutive registers on a bus
+ *
+ * @return Std_ReturnType , as MSSP_I2C_Write_Registers
+ */
+Std_ReturnType I2C_Bus_Write_Registers(i2c_bus_t bus , uint8 address , uint8 reg , const uint8 * data , uint8 length);
+
+/**
+ * @brief Check that a slave acknowledges its address on a bus
+ *
+ * @return Std_ReturnType , as MSSP_I2C_Probe
+ */
+Std_ReturnType I2C_Bus_Probe(i2c_bus_t bus , uint8 address);
+
+/**
+ * @brief Bus error of the last transaction on a bus
+ * @return Std_ReturnType , as MSSP_I2C_Get_Last_Error
+ */
+Std_ReturnType I2C_Bus_Get_Last_Error(i2c_bus_t bus , i2c_error_t * error);
+
+#endif	/* I2C_BUS_H */
@@ -0,0 +1,403 @@
+/**
+ * @file    I2C_Soft.c
+ * @author  Abdelmoniem Ahmed
+ * @LinkedIn: https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * @brief   Software (bit-banged) I2C master implementation
+ *
+ * @details
+ * Every bus state ends with SCL low , except the idle bus (both lines
+ * released). Each line access is one BSF / BCF / BTFSC on TRISx / PORTx ,
+ * so an interrupt in the middle of a bit only stretches that bit.
+ *
+ * Target MCU : PIC18F4620
+ * Compiler   : XC8
+ * Layer      : MCAL
+ */
+
+/* Section : Includes */
+
+#include"I2C_Soft.h"
+#include"../GPIO/hal_gpio_marker.h"
+
+#if         SOFT_I2C_CFG == SOFT_I2C_ENABLE
+
+/* Section : Macro Declaration */
+
+/* Open-drain emulation , LATx is kept at 0 */
+#define SOFT_I2C_SCL_LOW()                  GPIO_FAST_PIN_DIRECTION(GPIO_FAST_SOFT_I2C_SCL , GPIO_DIRECTION_OUTPUT)
+#define SOFT_I2C_SCL_RELEASE()              GPIO_FAST_PIN_DIRECTION(GPIO_FAST_SOFT_I2C_SCL , GPIO_DIRECTION_INPUT)
+#define SOFT_I2C_SDA_LOW()                  GPIO_FAST_PIN_DIRECTION(GPIO_FAST_SOFT_I2C_SDA , GPIO_DIRECTION_OUTPUT)
+#define SOFT_I2C_SDA_RELEASE()              GPIO_FAST_PIN_DIRECTION(GPIO_FAST_SOFT_I2C_SDA , GPIO_DIRECTION_INPUT)
+#define SOFT_I2C_SCL_READ()                 GPIO_FAST_PIN_READ(GPIO_FAST_SOFT_I2C_SCL)
+#define SOFT_I2C_SDA_READ()                 GPIO_FAST_PIN_READ(GPIO_FAST_SOFT_I2C_SDA)
+
+#if         SOFT_I2C_HALF_PERIOD_US > 0
+#define SOFT_I2C_DELAY()                    __delay_us(SOFT_I2C_HALF_PERIOD_US)
+#else
+#define SOFT_I2C_DELAY()
+#endif
+
+/* Set by a stretch wait that expired , cleared by the next START */
+static uint8 soft_i2c_timeout_latched = FALSE ;
+
+/* Static Function Declaration */
+
+static void SOFT_I2C_SCL_High(void);
+static void SOFT_I2C_Clock_Pulse(void);
+static Std_ReturnType SOFT_I2C_Start_Condition(void);
+
+/* Global Function Definition */
+
+Std_ReturnType SOFT_I2C_Init(void){
+    Std_ReturnType ret = E_OK;
+
+    /* Both LAT bits low once , the lines only toggle between low and released */
+    GPIO_FAST_PIN_LOW(GPIO_FAST_SOFT_I2C_SCL);
+    GPIO_FAST_PIN_LOW(GPIO_FAST_SOFT_I2C_SDA);
+    SOFT_I2C_SDA_RELEASE();
+    SOFT_I2C_SCL_RELEASE();
+    soft_i2c_timeout_latched = FALSE ;
+    SOFT_I2C_DELAY();
+    if(GPIO_PIN_LOW == SOFT_I2C_SDA_READ()){
+        /* A slave reset mid-read still drives SDA */
+        ret = SOFT_I2C_Bus_Recovery();
+    }
+    else{ /* Nothing */ }
+
+    return ret;
+}
+
+Std_ReturnType SOFT_I2C_Master_Send_Start(void){
+    Std_ReturnType ret = E_OK;
+
+    /* A new transaction starts with a fresh timeout budget */
+    soft_i2c_timeout_latched = FALSE ;
+    ret = SOFT_I2C_Start_Condition();
+
+    return ret;
+}
+
+Std_ReturnType SOFT_I2C_Master_Send_Repeated_Start(void){
+    Std_ReturnType ret = E_OK;
+
+    ret = SOFT_I2C_Start_Condition();
+
+    return ret;
+}
+
+Std_ReturnType SOFT_I2C_Master_Send_Stop(void){
+    Std_ReturnType ret = E_OK;
+
+    SOFT_I2C_SDA_LOW();
+    SOFT_I2C_DELAY();
+    SOFT_I2C_SCL_High();
+    SOFT_I2C_DELAY();
+    SOFT_I2C_SDA_RELEASE();
+    SOFT_I2C_DELAY();
+    if(TRUE == soft_i2c_timeout_latched){
+        /* A wait of this transaction expired : free the bus */
+        (void)SOFT_I2C_Bus_Recovery();
+        ret = E_NOT_OK ;
+    }
+    else{ /* Nothing */ }
+
+    return ret;
+}
+
+Std_ReturnType SOFT_I2C_Master_Write_Blocking(uint8 i2c_data , uint8 *_ack){
+    Std_ReturnType ret = E_OK;
+    uint8 l_bit = ZERO_INIT;
+
+    if(NULL == _ack){
+        ret = E_NOT_OK;
+    }
+    else{
+        for(l_bit = ZERO_INIT ; l_bit < 8 ; l_bit++){
+            /* SDA only changes while SCL is low */
+            if(i2c_data & 0x80){
+                SOFT_I2C_SDA_RELEASE();
+            }
+            else{
+                SOFT_I2C_SDA_LOW();
+            }
+            i2c_data <<= 1 ;
+            SOFT_I2C_Clock_Pulse();
+        }
+        /* Ninth clock : the slave pulls SDA low to acknowledge */
+        SOFT_I2C_SDA_RELEASE();
+        SOFT_I2C_DELAY();
+        SOFT_I2C_SCL_High();
+        SOFT_I2C_DELAY();
+        *_ack = (GPIO_PIN_LOW == SOFT_I2C_SDA_READ()) ? I2C_ACK_REC_FROM_SLAVE : I2C_ACK_NOT_REC_FROM_SLAVE ;
+        SOFT_I2C_SCL_LOW();
+        if(TRUE == soft_i2c_timeout_latched){
+            *_ack = I2C_ACK_NOT_REC_FROM_SLAVE ;
+            ret = E_NOT_OK ;
+        }
+        else{ /* Nothing */ }
+    }
+
+    return ret;
+}
+
+Std_ReturnType SOFT_I2C_Master_Read_Blocking(uint8 ack , uint8 *i2c_data){
+    Std_ReturnType ret = E_OK;
+    uint8 l_bit = ZERO_INIT;
+    uint8 l_data = ZERO_INIT;
+
+    if(NULL == i2c_data){
+        ret = E_NOT_OK;
+    }
+    else{
+        SOFT_I2C_SDA_RELEASE();
+        for(l_bit = ZERO_INIT ; l_bit < 8 ; l_bit++){
+            SOFT_I2C_DELAY();
+            SOFT_I2C_SCL_High();
+            SOFT_I2C_DELAY();
+            l_data = (uint8)((l_data << 1) | SOFT_I2C_SDA_READ());
+            SOFT_I2C_SCL_LOW();
+        }
+        *i2c_data = l_data ;
+        /* Ninth clock : ACK keeps the slave sending , NACK ends the read */
+        if(I2C_MASTER_SEND_ACK == ack){
+            SOFT_I2C_SDA_LOW();
+        }
+        else{ /* Nothing */ }
+        SOFT_I2C_Clock_Pulse();
+        SOFT_I2C_SDA_RELEASE();
+        if(TRUE == soft_i2c_timeout_latched){
+            ret = E_NOT_OK ;
+        }
+        else{ /* Nothing */ }
+    }
+
+    return ret;
+}
+
+Std_ReturnType SOFT_I2C_Read_Byte_Register(uint8 address, uint8 reg , uint8 * data){
+    Std_ReturnType ret = E_OK;
+
+    ret = SOFT_I2C_Read_Registers(address , reg , data , 1);
+
+    return ret;
+}
+
+Std_ReturnType SOFT_I2C_Write_Byte_Register(uint8 address, uint8 reg , uint8 data){
+    Std_ReturnType ret = E_OK;
+
+    ret = SOFT_I2C_Write_Registers(address , reg , &data , 1);
+
+    return ret;
+}
+
+Std_ReturnType SOFT_I2C_Read_Registers(uint8 address, uint8 reg , uint8 * data , uint8 length){
+    Std_ReturnType ret = E_OK;
+    uint8 ack = I2C_ACK_NOT_REC_FROM_SLAVE;
+    uint8 l_index = ZERO_INIT;
+
+    if((NULL == data) || (ZERO_INIT == length)){
+        ret = E_NOT_OK;
+    }
+    else{
+        ret = SOFT_I2C_Master_Send_Start();
+        if(E_OK == ret){
+            ret = SOFT_I2C_Master_Write_Blocking( (uint8)(address << 1) , &ack);
+            if(I2C_ACK_REC_FROM_SLAVE == ack){
+                ret &= SOFT_I2C_Master_Write_Blocking(reg , &ack);
+                ret &= SOFT_I2C_Master_Send_Repeated_Start();
+                ret &= SOFT_I2C_Master_Write_Blocking( (uint8)((address << 1)|1) , &ack);
+            }
+            else{ /* Nothing */ }
+            if(I2C_ACK_REC_FROM_SLAVE == ack){
+                for(l_index = ZERO_INIT ; l_index < (length - 1) ; l_index++){
+                    ret &= SOFT_I2C_Master_Read_Blocking(I2C_MASTER_SEND_ACK , &data[l_index]);
+                }
+                ret &= SOFT_I2C_Master_Read_Blocking(I2C_MASTER_SEND_NOT_ACK , &data[l_index]);
+            }
+            else{
+                ret = E_NOT_OK;
+            }
+            ret &= SOFT_I2C_Master_Send_Stop();
+        }
+        else{ /* Nothing */ }
+    }
+    return ret;
+}
+
+Std_ReturnType SOFT_I2C_Read_Current(uint8 address, uint8 * data , uint8 length){
+    Std_ReturnType ret = E_OK;
+    uint8 ack = I2C_ACK_NOT_REC_FROM_SLAVE;
+    uint8 l_index = ZERO_INIT;
+
+    if((NULL == data) || (ZERO_INIT == length)){
+        ret = E_NOT_OK;
+    }
+    else{
+        ret = SOFT_I2C_Master_Send_Start();
+        if(E_OK == ret){
+            ret = SOFT_I2C_Master_Write_Blocking( (uint8)((address << 1)|1) , &ack);
+            if(I2C_ACK_REC_FROM_SLAVE == ack){
+                for(l_index = ZERO_INIT ; l_index < (length - 1) ; l_index++){
+                    ret &= SOFT_I2C_Master_Read_Blocking(I2C_MASTER_SEND_ACK , &data[l_index]);
+                }
+                ret &= SOFT_I2C_Master_Read_Blocking(I2C_MASTER_SEND_NOT_ACK , &data[l_index]);
+            }
+            else{
+                ret = E_NOT_OK;
+            }
+            ret &= SOFT_I2C_Master_Send_Stop();
+        }
+        else{ /* Nothing */ }
+    }
+    return ret;
+}
+
+Std_ReturnType SOFT_I2C_Write_Registers(uint8 address, uint8 reg , const uint8 * data , uint8 length){
+    Std_ReturnType ret = E_OK;
+    uint8 ack = I2C_ACK_NOT_REC_FROM_SLAVE;
+    uint8 l_index = ZERO_INIT;
+
+    if((NULL == data) || (ZERO_INIT == length)){
+        ret = E_NOT_OK;
+    }
+    else{
+        ret = SOFT_I2C_Master_Send_Start();
+        if(E_OK == ret){
+            ret = SOFT_I2C_Master_Write_Blocking( (uint8)(address << 1) , &ack);
+            if(I2C_ACK_REC_FROM_SLAVE == ack){
+                ret &= SOFT_I2C_Master_Write_Blocking(reg , &ack);
+            }
+            else{ /* Nothing */ }
+            for(l_index = ZERO_INIT ; (l_index < length) && (I2C_ACK_REC_FROM_SLAVE == ack) ; l_index++){
+                ret &= SOFT_I2C_Master_Write_Blocking(data[l_index] , &ack);
+            }
+            if(l_index < length){
+                /* Address , register or a data byte was not acknowledged */
+                ret = E_NOT_OK;
+            }
+            else{ /* Nothing */ }
+            ret &= SOFT_I2C_Master_Send_Stop();
+            GPIO_MARKER_HIT(I2C);
+        }
+        else{ /* Nothing */ }
+    }
+    return ret;
+}
+
+Std_ReturnType SOFT_I2C_Probe(uint8 address){
+    Std_ReturnType ret = E_OK;
+    uint8 ack = I2C_ACK_NOT_REC_FROM_SLAVE;
+
+    ret = SOFT_I2C_Master_Send_Start();
+    if(E_OK == ret){
+        ret = SOFT_I2C_Master_Write_Blocking( (uint8)(address << 1) , &ack);
+        ret &= SOFT_I2C_Master_Send_Stop();
+        if(I2C_ACK_NOT_REC_FROM_SLAVE == ack){
+            ret = E_NOT_OK;
+        }
+        else{ /* Nothing */ }
+    }
+    else{ /* Nothing */ }
+
+    return ret;
+}
+
+Std_ReturnType SOFT_I2C_Bus_Recovery(void){
+    Std_ReturnType ret = E_OK;
+    uint8 l_clock = ZERO_INIT;
+
+    SOFT_I2C_SDA_RELEASE();
+    SOFT_I2C_SCL_RELEASE();
+    SOFT_I2C_DELAY();
+
+    /* Clock the slave through the rest of its byte until it releases SDA */
+    for(l_clock = ZERO_INIT ; (l_clock < SOFT_I2C_RECOVERY_CLOCKS) && (GPIO_PIN_LOW == SOFT_I2C_SDA_READ()) ; l_clock++){
+        SOFT_I2C_SCL_LOW();
+        SOFT_I2C_DELAY();
+        SOFT_I2C_SCL_RELEASE();
+        SOFT_I2C_DELAY();
+    }
+
+    /* STOP : SDA rises while SCL is high */
+    SOFT_I2C_SCL_LOW();
+    SOFT_I2C_SDA_LOW();
+    SOFT_I2C_DELAY();
+    SOFT_I2C_SCL_RELEASE();
+    SOFT_I2C_DELAY();
+    SOFT_I2C_SDA_RELEASE();
+    SOFT_I2C_DELAY();
+
+    if(GPIO_PIN_LOW == SOFT_I2C_SDA_READ()){
+        ret = E_NOT_OK;
+    }
+    else{ /* Nothing */ }
+
+    return ret;
+}
+
+Std_ReturnType SOFT_I2C_Get_Last_Error(i2c_error_t * error){
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == error){
+        ret = E_NOT_OK;
+    }
+    else{
+        *error = (TRUE == soft_i2c_timeout_latched) ? I2C_ERROR_TIMEOUT : I2C_ERROR_NONE ;
+    }
+    return ret;
+}
+
+/* Static Function Definition */
+
+/**
+ * @brief Release SCL and wait for it to rise (clock stretching) , bounded
+ */
+static void SOFT_I2C_SCL_High(void){
+    uint16 l_loops = ZERO_INIT;
+
+    SOFT_I2C_SCL_RELEASE();
+    while((FALSE == soft_i2c_timeout_latched) && (GPIO_PIN_LOW == SOFT_I2C_SCL_READ())){
+        if(SOFT_I2C_STRETCH_LOOPS <= (++l_loops)){
+            soft_i2c_timeout_latched = TRUE ;
+        }
+        else{ /* Nothing */ }
+    }
+}
+
+/**
+ * @brief One clock with SDA already set : low half , high half , back low
+ */
+static void SOFT_I2C_Clock_Pulse(void){
+    SOFT_I2C_DELAY();
+    SOFT_I2C_SCL_High();
+    SOFT_I2C_DELAY();
+    SOFT_I2C_SCL_LOW();
+}
+
+/**
+ * @brief Start / repeated start : SDA falls while SCL is high , ends with SCL low
+ */
+static Std_ReturnType SOFT_I2C_Start_Condition(void){
+    Std_ReturnType ret = E_OK;
+
+    SOFT_I2C_SDA_RELEASE();
+    SOFT_I2C_DELAY();
+    SOFT_I2C_SCL_High();
+    SOFT_I2C_DELAY();
+    if(TRUE == soft_i2c_timeout_latched){
+        ret = E_NOT_OK ;
+    }
+    else if(GPIO_PIN_LOW == SOFT_I2C_SDA_READ()){
+        /* Another device holds SDA , a start now would corrupt its transfer */
+        ret = E_NOT_OK ;
+    }
+    else{
+        SOFT_I2C_SDA_LOW();
+        SOFT_I2C_DELAY();
+        SOFT_I2C_SCL_LOW();
+    }
+
+    return ret;
+}
+
+#endif
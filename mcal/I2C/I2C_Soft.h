@@ -0,0 +1,181 @@
+/**
+ * @file    I2C_Soft.h
+ * @author  Abdelmoniem Ahmed
+ * @LinkedIn: https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * @brief   Software (bit-banged) I2C master for PIC18F4620
+ *
+ * @details
+ * A second I2C bus on any two GPIO pins , next to the MSSP one : slow
+ * devices (EEPROM write cycles) move to this bus and stop holding the MSSP.
+ * Same blocking API shape as the MSSP master (I2C_APIs.h).
+ *
+ * The lines are driven open-drain through the fast pin API : LATx stays 0 ,
+ * TRISx = 0 pulls the line low , TRISx = 1 releases it to the pull-up.
+ * The pins are the GPIO_FAST_SOFT_I2C_SCL / _SDA descriptors of
+ * hal_gpio_cfg.h.
+ *
+ * Supported Features:
+ *  - Start / Repeated Start / Stop , ACK / NACK
+ *  - Clock stretching with a bounded wait
+ *  - Register , burst and current-address transfers , address probe
+ *  - Bus recovery (9 SCL clocks + STOP) after a timeout
+ *
+ * Not re-entrant : run every transfer from the same context.
+ *
+ * Target MCU : PIC18F4620
+ * Compiler   : XC8
+ * Layer      : MCAL
+ */
+
+#ifndef I2C_SOFT_H
+#define	I2C_SOFT_H
+
+/* Section : Includes */
+
+#include"I2C_APIs.h"
+
+/* Section : Macro Declaration */
+
+#define SOFT_I2C_ENABLE                     1
+#define SOFT_I2C_DISABLE                    0
+
+/* Build the software bus (needs GPIO_FAST_PIN_CONFIGURATION) */
+#define SOFT_I2C_CFG                        SOFT_I2C_ENABLE
+
+/*
+ * Delay per SCL half period in us , 0 = none. The bit loop adds its own
+ * instruction time : 5 us gives roughly 50 kHz at 8 MHz , well inside the
+ * 100 kHz of every device on the board.
+ */
+#define SOFT_I2C_HALF_PERIOD_US             5
+
+/* Polls of a stretched SCL (slave holding it low) before the transfer times out */
+#define SOFT_I2C_STRETCH_LOOPS              5000U
+
+/* Clock pulses sent by SOFT_I2C_Bus_Recovery to free SDA */
+#define SOFT_I2C_RECOVERY_CLOCKS            9
+
+#if (SOFT_I2C_CFG == SOFT_I2C_ENABLE) && (CONFIG_ENABLE != GPIO_FAST_PIN_CONFIGURATION)
+#error "SOFT_I2C_CFG needs GPIO_FAST_PIN_CONFIGURATION enabled in hal_gpio_cfg.h"
+#endif
+
+/* Section : Macro Functions Declarations */
+
+/* Section : Data Types Declarations */
+
+/* Section : Function Declarations */
+
+#if         SOFT_I2C_CFG == SOFT_I2C_ENABLE
+/**
+ * @brief Release both lines and free the bus if a slave holds SDA
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Bus idle (SCL and SDA high)
+ *         - E_NOT_OK : SDA still low after the recovery clocks
+ */
+Std_ReturnType SOFT_I2C_Init(void);
+
+/**
+ * @brief Start condition (SDA falls while SCL is high)
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Start sent
+ *         - E_NOT_OK : SDA held low by another device , no start sent
+ *           (also when SCL is held low , see SOFT_I2C_Get_Last_Error)
+ */
+Std_ReturnType SOFT_I2C_Master_Send_Start(void);
+
+/**
+ * @brief Repeated start , inside a transaction
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Repeated start sent
+ *         - E_NOT_OK : SCL held low , see SOFT_I2C_Get_Last_Error
+ */
+Std_ReturnType SOFT_I2C_Master_Send_Repeated_Start(void);
+
+/**
+ * @brief Stop condition (SDA rises while SCL is high)
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Stop sent
+ *         - E_NOT_OK : A wait of this transaction expired , the bus
+ *                      was recovered
+ */
+Std_ReturnType SOFT_I2C_Master_Send_Stop(void);
+
+/**
+ * @brief Send one byte , MSB first , and sample the slave ACK
+ *
+ * @param i2c_data Byte to send
+ * @param _ack     I2C_ACK_REC_FROM_SLAVE / I2C_ACK_NOT_REC_FROM_SLAVE
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Byte sent
+ *         - E_NOT_OK : Null pointer
+ *           (also when SCL is held low , see SOFT_I2C_Get_Last_Error)
+ */
+Std_ReturnType SOFT_I2C_Master_Write_Blocking(uint8 i2c_data , uint8 *_ack);
+
+/**
+ * @brief Receive one byte , then send ACK or NACK
+ *
+ * @param ack      I2C_MASTER_SEND_ACK (more bytes follow) / I2C_MASTER_SEND_NOT_ACK (last byte)
+ * @param i2c_data Pointer to store the received byte
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Byte received
+ *         - E_NOT_OK : Null pointer
+ *           (also when SCL is held low , see SOFT_I2C_Get_Last_Error)
+ */
+Std_ReturnType SOFT_I2C_Master_Read_Blocking(uint8 ack , uint8 *i2c_data);
+
+/**
+ * @brief Read a single register , see MSSP_I2C_Read_Byte_Register
+ */
+Std_ReturnType SOFT_I2C_Read_Byte_Register(uint8 address, uint8 reg , uint8 * data);
+
+/**
+ * @brief Write a single register , see MSSP_I2C_Write_Byte_Register
+ */
+Std_ReturnType SOFT_I2C_Write_Byte_Register(uint8 address, uint8 reg , uint8 data);
+
+/**
+ * @brief Read a block of consecutive registers , see MSSP_I2C_Read_Registers
+ */
+Std_ReturnType SOFT_I2C_Read_Registers(uint8 address, uint8 reg , uint8 * data , uint8 length);
+
+/**
+ * @brief Read from the slave's current register pointer , see MSSP_I2C_Read_Current
+ */
+Std_ReturnType SOFT_I2C_Read_Current(uint8 address, uint8 * data , uint8 length);
+
+/**
+ * @brief Write a block of consecutive registers , see MSSP_I2C_Write_Registers
+ */
+Std_ReturnType SOFT_I2C_Write_Registers(uint8 address, uint8 reg , const uint8 * data , uint8 length);
+
+/**
+ * @brief Check that a slave acknowledges its address , see MSSP_I2C_Probe
+ */
+Std_ReturnType SOFT_I2C_Probe(uint8 address);
+
+/**
+ * @brief Free a stuck bus : up to SOFT_I2C_RECOVERY_CLOCKS clocks until
+ *        SDA is released , then a STOP
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : SDA released
+ *         - E_NOT_OK : SDA still held low
+ *
+ * @note Called automatically by SOFT_I2C_Master_Send_Stop after a timeout.
+ */
+Std_ReturnType SOFT_I2C_Bus_Recovery(void);
+
+/**
+ * @brief Bus error of the last transaction , see MSSP_I2C_Get_Last_Error
+ */
+Std_ReturnType SOFT_I2C_Get_Last_Error(i2c_error_t * error);
+#endif
+
+#endif	/* I2C_SOFT_H */
@@ -21,6 +21,7 @@
  */
 
 #include "mcal_externl_interrupt.h"
+#include "mcal_interrupt_manager.h"
 
 /* ----------------------------------------------------
  * Section : Static Callback Function Pointers
@@ -56,25 +57,14 @@ static Std_ReturnType Interrupt_INTx_SetInterruptHandler(const Interrupt_INTx_t
 static Std_ReturnType Interrupt_INTx_Enable (const Interrupt_INTx_t * interrupt_obj);
 static Std_ReturnType Interrupt_INTx_Disable (const Interrupt_INTx_t * interrupt_obj);
 
-#if INTERRUPT_PRIORITY_LEVELS_ENABLE == INTERRUPT_PRIORITY_ENABLE
-static Std_ReturnType Interrupt_INTx_Priority_Init (const Interrupt_INTx_t * interrupt_obj);
-#endif
-
 static Std_ReturnType Interrupt_INTx_Edge_Init (const Interrupt_INTx_t * interrupt_obj);
 static Std_ReturnType Interrupt_INTx_Pin_Init (const Interrupt_INTx_t * interrupt_obj);
 static Std_ReturnType Interrupt_INTx_Clear_Flag (const Interrupt_INTx_t * interrupt_obj);
 
 /* RBx internal helpers */
 static Std_ReturnType Interrupt_RBx_SetInterruptHandler(const Interrupt_RBx_t * interrupt_obj);
-static Std_ReturnType Interrupt_RBx_Enable (const Interrupt_RBx_t * interrupt_obj);
 static Std_ReturnType Interrupt_RBx_Disable (const Interrupt_RBx_t * interrupt_obj);
 
-#if INTERRUPT_PRIORITY_LEVELS_ENABLE == INTERRUPT_PRIORITY_ENABLE
-static Std_ReturnType Interrupt_RBx_Priority_Init (const Interrupt_RBx_t * interrupt_obj);
-#endif
-
-static Std_ReturnType Interrupt_RBx_Pin_Init (const Interrupt_RBx_t * interrupt_obj);
-
 
 /* ----------------------------------------------------
  * Section : INTx Public APIs
@@ -94,16 +84,6 @@ Std_ReturnType interrupt_INTx_Init(const Interrupt_INTx_t * interrupt_obj){
         ret = Interrupt_INTx_Disable(interrupt_obj);
         /* configure the interrupt triggering edge rising/falling */
         ret = Interrupt_INTx_Edge_Init(interrupt_obj);
-        #if INTERRUPT_PRIORITY_LEVELS_ENABLE == INTERRUPT_FEATURE_ENABLE
-        /* Configuring The Interrupt Priority Level High/Low */
-        ret = Interrupt_INTx_Priority_Init(interrupt_obj);
-        INTERRUPT_PriorityFeatureEnable();
-        INTERRUPT_GlobalInterruptHighEnable();
-        INTERRUPT_GlobalInterruptLowEnable();
-        #else
-        INTERRUPT_GlobalInterruptEnable();
-        INTERRUPT_PeripheralInterruptEnable();
-        #endif
         /* Configure the external interrupt I/O pin */  
         ret = Interrupt_INTx_Pin_Init(interrupt_obj);
         /* Configure default interrupt call back */
@@ -146,20 +126,14 @@ Std_ReturnType interrupt_RBx_Init(const Interrupt_RBx_t * interrupt_obj){
     else{
         /* THIS Function Will DISABLE INTERRUPT FEATURE FOR RBx */
         EXTERNAL_INTERRUPTS_RBx_DISABLE();
-#if INTERRUPT_PRIORITY_LEVELS_ENABLE  ==  INTERRUPT_FEATURE_ENABLE
-        INTERRUPT_PriorityFeatureEnable();
-        INTERRUPT_GlobalInterruptHighEnable();
-        INTERRUPT_GlobalInterruptLowEnable();
-        if( Interrupt_High_Priority == interrupt_obj->priority) { EXTERNAL_INTERRUPT_RBx_HIGH_PRIORITY(); }
-        else if(Interrupt_Low_Priority == interrupt_obj->priority) { EXTERNAL_INTERRUPT_RBx_LOW_PRIORITY(); }
-#else
-        INTERRUPT_GlobalInterruptEnable();
-        INTERRUPT_PeripheralInterruptEnable();
-#endif
         /* THIS Function Will CLEAR FLAG FOR RBx */
         EXTERNAL_INTERRUPTS_RBx_CLEAR_FLAG();
         /* This Function Will Initialize Pin As Input */
         ret = gpio_pin_direction_initialize(&(interrupt_obj->mcu_pin));
+        /* Reference levels for the change decode , only later edges are reported */
+        RBx_Port_Snapshot_Init();
+        /* THIS Function Will CLEAR FLAG FOR RBx (reading PORTB ended the mismatch) */
+        EXTERNAL_INTERRUPTS_RBx_CLEAR_FLAG();
         /* This Function Will Set the ISR Pointer */
         ret = Interrupt_RBx_SetInterruptHandler(interrupt_obj);
         /* THIS Function Will ENABLE INTERRUPT FEATURE FOR RBx */
@@ -258,35 +232,6 @@ static Std_ReturnType Interrupt_INTx_Clear_Flag (const Interrupt_INTx_t * interr
     return ret;
 }
 
-#if INTERRUPT_PRIORITY_LEVELS_ENABLE == INTERRUPT_FEATURE_ENABLE
-
-static Std_ReturnType Interrupt_INTx_Priority_Init (const Interrupt_INTx_t * interrupt_obj){
-    Std_ReturnType ret = E_OK;
-    switch(interrupt_obj->source){
-        case  Interrupt_INT1 :  
-            if(Interrupt_High_Priority == interrupt_obj->priority){
-                EXTERNAL_INTERRUPT_INT1_HIGH_PRIORITY();
-            }
-            else if(Interrupt_Low_Priority == interrupt_obj->priority){
-                EXTERNAL_INTERRUPT_INT1_LOW_PRIORITY();
-            }
-            break;
-        case  Interrupt_INT2 :
-            if(Interrupt_High_Priority == interrupt_obj->priority){
-                EXTERNAL_INTERRUPT_INT2_HIGH_PRIORITY();
-            }
-            else if(Interrupt_Low_Priority == interrupt_obj->priority){
-                EXTERNAL_INTERRUPT_INT2_LOW_PRIORITY();
-            } 
-            break;
-        default : ret = E_NOT_OK;
-    }
-    return ret;
-}
-
-
-#endif
-
 static Std_ReturnType INT0_SetInterruptHandler(void (* InterruptHandler ) (void)){
     Std_ReturnType ret = E_OK;
     if(NULL == InterruptHandler){
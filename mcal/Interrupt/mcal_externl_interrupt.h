@@ -125,7 +125,6 @@ typedef enum{
 typedef struct {
     void (* External_InterruptHandler ) (void) ;
     INTERRUPT_INTx_src source ;
-    INTERRUPT_Priority_cfg priority;
     INTERRUPT_INTx_EDGE_t edge ;
     pin_config_t  mcu_pin ;
 }Interrupt_INTx_t;
@@ -138,7 +137,6 @@ typedef struct {
     void (* External_InterruptHandler_High ) (void) ;
     void (* External_InterruptHandler_Low ) (void) ;
     pin_config_t  mcu_pin ;
-    INTERRUPT_Priority_cfg priority;
 }Interrupt_RBx_t;
 
 /* Section : Function Declarations */
@@ -139,6 +139,22 @@
 #endif
 #endif      /* CCP2_INTERRUPT_FEATURE_ENABLE */
 
+/* --------------------- Data EEPROM Interrupt --------------------- */
+#if  DATA_EEPROM_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+    /* THIS Function Will ENABLE INTERRUPT FEATURE FOR DATA EEPROM */
+    #define DATA_EEPROM_INTERRUPT_ENABLE()             (PIE2bits.EEIE = 1 )
+    /* THIS Function Will DISABLE INTERRUPT FEATURE FOR DATA EEPROM */
+    #define DATA_EEPROM_INTERRUPT_DISABLE()            (PIE2bits.EEIE = 0 )
+    /* THIS Function Will CLEAR FLAG FOR DATA EEPROM */   
+    #define DATA_EEPROM_INTERRUPT_CLEAR_FLAG()         (PIR2bits.EEIF = 0 )
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE  ==  INTERRUPT_FEATURE_ENABLE
+    /* THIS Function Will SET INTERRUPT PRIORITY HIGH FOR DATA EEPROM */
+    #define DATA_EEPROM_INTERRUPT_HIGH_PRIORITY()        (IPR2bits.EEIP = 1 )
+    /* THIS Function Will SET INTERRUPT PRIORITY LOW FOR DATA EEPROM */
+    #define DATA_EEPROM_INTERRUPT_LOW_PRIORITY()         (IPR2bits.EEIP = 0 )
+#endif
+#endif      /* DATA_EEPROM_INTERRUPT_FEATURE_ENABLE */
+
 /* --------------------- EUSART TX/RX Interrupts --------------------- */
 #if  EUSART_TX_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
     /* THIS Function Will ENABLE INTERRUPT FEATURE FOR EUSART TX */
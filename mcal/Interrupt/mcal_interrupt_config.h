@@ -46,6 +46,12 @@
 #define INTERRUPT_PRIORITY_ENABLE        0x01
 #define INTERRUPT_PRIORITY_DISABLE       0x00
 
+/**
+ * @brief Priority map levels (mcal_interrupt_vector_cfg.h) , IPR bit values
+ */
+#define INTERRUPT_LOW_PRIORITY_LEVEL     0x00
+#define INTERRUPT_HIGH_PRIORITY_LEVEL    0x01
+
 
 /* Section : Macro Functions Declarations */
 
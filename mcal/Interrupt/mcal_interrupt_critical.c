@@ -0,0 +1,52 @@
+/**
+ * @file    mcal_interrupt_critical.c
+ * @author  Abdelmoniem Ahmed
+ * @linkedin https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * @brief   Nestable Critical Sections : source set masking
+ */
+
+/* Section : Includes */
+
+#include "mcal_interrupt_critical.h"
+
+/* Section : Function Definitions */
+
+Std_ReturnType Interrupt_Critical_Enter(interrupt_critical_t *section , uint32 sources){
+    Std_ReturnType ret = E_OK;
+    uint8 l_gie = ZERO_INIT;
+
+    if(NULL == section){
+        ret = E_NOT_OK;
+    }
+    else{
+        INTERRUPT_CRITICAL_ENTER_ALL(l_gie);
+        section->pie1 = (uint8)(PIE1 & (uint8)(sources));
+        section->pie2 = (uint8)(PIE2 & (uint8)(sources >> 8));
+        section->intcon = (uint8)(INTCON & (uint8)(sources >> 16));
+        section->intcon3 = (uint8)(INTCON3 & (uint8)(sources >> 24));
+        PIE1 &= (uint8)(~section->pie1);
+        PIE2 &= (uint8)(~section->pie2);
+        INTCON3 &= (uint8)(~section->intcon3);
+        INTCON &= (uint8)(~section->intcon);
+        INTERRUPT_CRITICAL_EXIT_ALL(l_gie);
+    }
+    return ret;
+}
+
+Std_ReturnType Interrupt_Critical_Exit(const interrupt_critical_t *section){
+    Std_ReturnType ret = E_OK;
+    uint8 l_gie = ZERO_INIT;
+
+    if(NULL == section){
+        ret = E_NOT_OK;
+    }
+    else{
+        INTERRUPT_CRITICAL_ENTER_ALL(l_gie);
+        PIE1 |= section->pie1;
+        PIE2 |= section->pie2;
+        INTCON3 |= section->intcon3;
+        INTCON |= section->intcon;
+        INTERRUPT_CRITICAL_EXIT_ALL(l_gie);
+    }
+    return ret;
+}
@@ -0,0 +1,122 @@
+/**
+ * @file    mcal_interrupt_critical.h
+ * @author  Abdelmoniem Ahmed
+ * @linkedin https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * @brief   Nestable Critical Sections : all sources , the low vector , or a source set
+ * @details Three widths of protection , pick the narrowest one that covers
+ *          every handler touching the shared data :
+ *
+ *          - All     : GIE (GIEH) cleared , nothing interrupts the section.
+ *                      For timed sequences (EEPROM / flash unlock) and the
+ *                      check-then-SLEEP race.
+ *          - Low     : GIEL cleared , high priority handlers keep their
+ *                      latency. Without INTERRUPT_PRIORITY_LEVELS_ENABLE
+ *                      there is one vector only and this is All.
+ *          - Sources : the enable bits of a set of sources are cleared ,
+ *                      every other source keeps running. For data shared
+ *                      with known handlers (RCIE for the RX counters ,
+ *                      CCP1IE + TMR1IE for a capture engine ...).
+ *
+ *          Each Enter saves what it found and each Exit restores it , so
+ *          sections nest freely as long as they are left in reverse order :
+ *          an inner section finds the bits already cleared and its Exit
+ *          leaves them cleared.
+ *
+ *          A pending flag is served as soon as its section is left. A
+ *          source masked by the application inside a section is enabled
+ *          again by the Exit if it was enabled at the Enter.
+ */
+
+#ifndef MCAL_INTERRUPT_CRITICAL_H
+#define	MCAL_INTERRUPT_CRITICAL_H
+
+/* Section : Includes */
+
+#include "mcal_interrupt_config.h"
+
+/* Section : Macro Declaration */
+
+/*
+ * Source set bits , OR them together : one byte per enable register
+ * (PIE1 , PIE2 , INTCON , INTCON3) , at the bit position of the enable bit
+ */
+#define INTERRUPT_CRITICAL_PIE1(_BIT)           ((uint32)1 << (_BIT))
+#define INTERRUPT_CRITICAL_PIE2(_BIT)           ((uint32)1 << ((_BIT) + 8))
+#define INTERRUPT_CRITICAL_INTCON(_BIT)         ((uint32)1 << ((_BIT) + 16))
+#define INTERRUPT_CRITICAL_INTCON3(_BIT)        ((uint32)1 << ((_BIT) + 24))
+
+#define INTERRUPT_CRITICAL_TMR1                 INTERRUPT_CRITICAL_PIE1(0)
+#define INTERRUPT_CRITICAL_TMR2                 INTERRUPT_CRITICAL_PIE1(1)
+#define INTERRUPT_CRITICAL_CCP1                 INTERRUPT_CRITICAL_PIE1(2)
+#define INTERRUPT_CRITICAL_MSSP                 INTERRUPT_CRITICAL_PIE1(3)      /* SPI and I2C share SSPIE */
+#define INTERRUPT_CRITICAL_EUSART_TX            INTERRUPT_CRITICAL_PIE1(4)
+#define INTERRUPT_CRITICAL_EUSART_RX            INTERRUPT_CRITICAL_PIE1(5)
+#define INTERRUPT_CRITICAL_ADC                  INTERRUPT_CRITICAL_PIE1(6)
+#define INTERRUPT_CRITICAL_CCP2                 INTERRUPT_CRITICAL_PIE2(0)
+#define INTERRUPT_CRITICAL_TMR3                 INTERRUPT_CRITICAL_PIE2(1)
+#define INTERRUPT_CRITICAL_I2C_BUS_COL          INTERRUPT_CRITICAL_PIE2(3)
+#define INTERRUPT_CRITICAL_EEPROM               INTERRUPT_CRITICAL_PIE2(4)
+#define INTERRUPT_CRITICAL_RBX                  INTERRUPT_CRITICAL_INTCON(3)
+#define INTERRUPT_CRITICAL_INT0                 INTERRUPT_CRITICAL_INTCON(4)
+#define INTERRUPT_CRITICAL_TMR0                 INTERRUPT_CRITICAL_INTCON(5)
+#define INTERRUPT_CRITICAL_INT1                 INTERRUPT_CRITICAL_INTCON3(3)
+#define INTERRUPT_CRITICAL_INT2                 INTERRUPT_CRITICAL_INTCON3(4)
+
+/* Section : Macro Functions Declarations */
+
+/* Every source , _SAVED : uint8 that holds GIE (GIEH) until the exit */
+#define INTERRUPT_CRITICAL_ENTER_ALL(_SAVED)    do{ (_SAVED) = INTCONbits.GIE ; INTCONbits.GIE = 0 ; }while(0)
+#define INTERRUPT_CRITICAL_EXIT_ALL(_SAVED)     (INTCONbits.GIE = (_SAVED))
+
+/* The low priority vector only , high priority handlers keep running */
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE == INTERRUPT_PRIORITY_ENABLE
+#define INTERRUPT_CRITICAL_ENTER_LOW(_SAVED)    do{ (_SAVED) = INTCONbits.GIEL ; INTCONbits.GIEL = 0 ; }while(0)
+#define INTERRUPT_CRITICAL_EXIT_LOW(_SAVED)     (INTCONbits.GIEL = (_SAVED))
+#else
+#define INTERRUPT_CRITICAL_ENTER_LOW(_SAVED)    INTERRUPT_CRITICAL_ENTER_ALL(_SAVED)
+#define INTERRUPT_CRITICAL_EXIT_LOW(_SAVED)     INTERRUPT_CRITICAL_EXIT_ALL(_SAVED)
+#endif
+
+/* Section : Data Types Declarations */
+
+/**
+ * @brief Enable bits cleared by Interrupt_Critical_Enter() , restored by the exit
+ */
+typedef struct{
+    uint8 pie1 ;
+    uint8 pie2 ;
+    uint8 intcon ;
+    uint8 intcon3 ;
+}interrupt_critical_t;
+
+/* Section : Function Declarations */
+
+/**
+ * @brief Mask a set of sources , the others keep interrupting
+ *
+ * @param section Pointer to the saved state , kept by the caller until the exit
+ * @param sources OR of INTERRUPT_CRITICAL_xxx
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Sources masked
+ *         - E_NOT_OK : Null pointer
+ *
+ * @note
+ * The enable bits are read and cleared with GIE held low for a few
+ * cycles : a handler clearing its own enable bit (EUSART TX with an
+ * empty ring) can not slip in between.
+ */
+Std_ReturnType Interrupt_Critical_Enter(interrupt_critical_t *section , uint32 sources);
+
+/**
+ * @brief Enable again the sources masked by the matching Interrupt_Critical_Enter()
+ *
+ * @param section Pointer to the state saved by the enter
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Sources restored
+ *         - E_NOT_OK : Null pointer
+ */
+Std_ReturnType Interrupt_Critical_Exit(const interrupt_critical_t *section);
+
+#endif	/* MCAL_INTERRUPT_CRITICAL_H */
@@ -112,6 +112,16 @@
  */
 #define CCP2_INTERRUPT_FEATURE_ENABLE                    INTERRUPT_FEATURE_DISABLE
 
+/* ----------------------------------------------------
+ * Data EEPROM Interrupt Configuration
+ * ----------------------------------------------------
+ */
+
+/**
+ * @brief Enable/Disable Data EEPROM write complete interrupt (queued writer)
+ */
+#define DATA_EEPROM_INTERRUPT_FEATURE_ENABLE             INTERRUPT_FEATURE_ENABLE
+
 /* ----------------------------------------------------
  * EUSART Interrupt Configuration
  * ----------------------------------------------------
@@ -161,6 +171,70 @@
 #define MSSP_I2C_BUS_COL_INTERRUPT_FEATURE_ENABLE        INTERRUPT_FEATURE_DISABLE
 
 
+/* ----------------------------------------------------
+ * ISR Instrumentation Configuration
+ * ----------------------------------------------------
+ * Timestamps every dispatched handler (mcal_interrupt_instrumentation.h).
+ * Adds an entry and an exit hook per interrupt , keep it disabled in
+ * production builds.
+ */
+
+/**
+ * @brief Enable/Disable ISR execution-time and latency statistics
+ */
+#define INTERRUPT_INSTRUMENTATION_FEATURE_ENABLE         INTERRUPT_FEATURE_DISABLE
+
+/**
+ * @brief Free-running timestamp timer (1 = Timer1 , 3 = Timer3) , not usable by the application
+ */
+#define INTERRUPT_INSTRUMENTATION_TIMER_CFG              3
+
+/**
+ * @brief Enable/Disable the GPIO trace : LAT bit (source id & 7) high while the handler runs
+ */
+#define INTERRUPT_INSTRUMENTATION_GPIO_CFG               INTERRUPT_FEATURE_DISABLE
+#define INTERRUPT_INSTRUMENTATION_GPIO_LAT               LATD
+#define INTERRUPT_INSTRUMENTATION_GPIO_TRIS              TRISD
+
+/* ----------------------------------------------------
+ * Hardware Stack Monitor Configuration
+ * ----------------------------------------------------
+ * Depth of the 31-level return stack per interrupt source and for the
+ * main line (mcal_interrupt_stack_monitor.h). Adds a stack sweep before
+ * and after every handler , keep it disabled in production builds.
+ */
+
+/**
+ * @brief Enable/Disable the return stack high-water marks
+ */
+#define INTERRUPT_STACK_MONITOR_FEATURE_ENABLE           INTERRUPT_FEATURE_DISABLE
+
+/* ----------------------------------------------------
+ * Sampling Profiler Configuration
+ * ----------------------------------------------------
+ * Timer3 interrupts the code every few hundred microseconds and the
+ * interrupted program counter is counted in a histogram of flash buckets
+ * (mcal_interrupt_profiler.h). Timer3 then belongs to the profiler :
+ * TIMER3_INTERRUPT_FEATURE_ENABLE must be disabled.
+ */
+
+/**
+ * @brief Enable/Disable the statistical PC sampling profiler
+ */
+#define INTERRUPT_PROFILER_FEATURE_ENABLE                INTERRUPT_FEATURE_DISABLE
+
+/**
+ * @brief Instruction cycles between two samples (1000 = 2 kHz at 8 MHz) , a 0 .. 63 cycle dither is added
+ */
+#define INTERRUPT_PROFILER_PERIOD_CYCLES                 1000U
+
+/**
+ * @brief Histogram : first sampled byte address , bucket size (2 ^ shift bytes) and bucket count (2 bytes of RAM each)
+ */
+#define INTERRUPT_PROFILER_BASE_ADDRESS                  0x000000UL
+#define INTERRUPT_PROFILER_BUCKET_SHIFT                  8
+#define INTERRUPT_PROFILER_BUCKET_COUNT                  128
+
 #endif	/* MCAL_INTERRUPT_GEN_CFG_H */ 
 
 
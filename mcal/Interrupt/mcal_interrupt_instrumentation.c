@@ -0,0 +1,207 @@
+/**
+ * @file    mcal_interrupt_instrumentation.c
+ * @author  Abdelmoniem Ahmed
+ * @linkedin https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * @brief   Interrupt Latency and ISR Execution-Time Instrumentation
+ * @details The entry / exit hooks run inside the interrupt manager , they
+ *          only read the timestamp timer and update one statistics entry.
+ *          Averages and text formatting are left to the report , which
+ *          runs in the main loop.
+ */
+
+/* Section : Includes */
+
+#include "mcal_interrupt_instrumentation.h"
+#include "report_format.h"
+
+#if INTERRUPT_INSTRUMENTATION_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+
+/* Section : Macro Declaration */
+
+#define INTERRUPT_REPORT_LINE_SIZE      72
+
+/* Section : Static Variables */
+
+static interrupt_isr_stats_t isr_stats[INTERRUPT_SOURCE_COUNT];
+static volatile uint8 isr_nesting_depth = ZERO_INIT;
+
+static const uint8 * const isr_source_names[INTERRUPT_SOURCE_COUNT] = {
+    (const uint8 *)"INT0" , (const uint8 *)"INT1" , (const uint8 *)"INT2" , (const uint8 *)"RBX" ,
+    (const uint8 *)"ADC" , (const uint8 *)"TMR0" , (const uint8 *)"TMR1" , (const uint8 *)"TMR2" ,
+    (const uint8 *)"TMR3" , (const uint8 *)"CCP1" , (const uint8 *)"CCP2" , (const uint8 *)"EEPROM" ,
+    (const uint8 *)"TX" , (const uint8 *)"RX" , (const uint8 *)"SPI" , (const uint8 *)"I2C" ,
+    (const uint8 *)"BCL"
+};
+
+/* Section : Static Function Declarations */
+
+/**
+ * @brief 16-bit timestamp , low byte first so RD16 latches the high byte
+ */
+static uint16 instrumentation_timer_read(void);
+
+
+/* Section : Function Definitions */
+
+Std_ReturnType Interrupt_Instrumentation_Init(void){
+    Std_ReturnType ret = E_OK;
+#if INTERRUPT_INSTRUMENTATION_TIMER_CFG == 1
+    PIE1bits.TMR1IE = 0;
+    T1CONbits.TMR1ON = 0;
+    T1CONbits.RD16 = 1;
+    T1CONbits.T1CKPS = 0;
+    T1CONbits.TMR1CS = 0;
+    T1CONbits.TMR1ON = 1;
+#else
+    PIE2bits.TMR3IE = 0;
+    T3CONbits.TMR3ON = 0;
+    T3CONbits.RD16 = 1;
+    T3CONbits.T3CKPS = 0;
+    T3CONbits.TMR3CS = 0;
+    T3CONbits.TMR3ON = 1;
+#endif
+#if INTERRUPT_INSTRUMENTATION_GPIO_CFG == INTERRUPT_FEATURE_ENABLE
+    INTERRUPT_INSTRUMENTATION_GPIO_LAT = 0x00;
+    INTERRUPT_INSTRUMENTATION_GPIO_TRIS = 0x00;
+#endif
+    ret = Interrupt_Instrumentation_Reset();
+    return ret;
+}
+
+Std_ReturnType Interrupt_Instrumentation_Reset(void){
+    Std_ReturnType ret = E_OK;
+    uint8 l_gie = INTCONbits.GIE;
+    uint8 l_source = ZERO_INIT;
+
+    INTCONbits.GIE = 0;
+    for(l_source = ZERO_INIT ; l_source < INTERRUPT_SOURCE_COUNT ; l_source++){
+        isr_stats[l_source].count = ZERO_INIT;
+        isr_stats[l_source].total_cycles = ZERO_INIT;
+        isr_stats[l_source].min_cycles = 0xFFFF;
+        isr_stats[l_source].max_cycles = ZERO_INIT;
+        isr_stats[l_source].min_interval = 0xFFFF;
+        isr_stats[l_source].max_interval = ZERO_INIT;
+        isr_stats[l_source].last_entry = ZERO_INIT;
+        isr_stats[l_source].nest_count = ZERO_INIT;
+    }
+    INTCONbits.GIE = l_gie;
+    return ret;
+}
+
+Std_ReturnType Interrupt_Instrumentation_Get(interrupt_source_t source , interrupt_isr_stats_t *stats){
+    Std_ReturnType ret = E_OK;
+    uint8 l_gie = ZERO_INIT;
+
+    if((NULL == stats) || (INTERRUPT_SOURCE_COUNT <= source)){
+        ret = E_NOT_OK;
+    }
+    else{
+        l_gie = INTCONbits.GIE;
+        INTCONbits.GIE = 0;
+        *stats = isr_stats[source];
+        INTCONbits.GIE = l_gie;
+    }
+    return ret;
+}
+
+Std_ReturnType Interrupt_Instrumentation_Report(interrupt_report_write_t write){
+    Std_ReturnType ret = E_OK;
+    interrupt_isr_stats_t l_stats;
+    uint8 l_line[INTERRUPT_REPORT_LINE_SIZE];
+    uint8 l_index = ZERO_INIT;
+    uint8 l_source = ZERO_INIT;
+
+    if(NULL == write){
+        ret = E_NOT_OK;
+    }
+    else{
+        for(l_source = ZERO_INIT ; (l_source < INTERRUPT_SOURCE_COUNT) && (E_OK == ret) ; l_source++){
+            ret = Interrupt_Instrumentation_Get((interrupt_source_t)l_source , &l_stats);
+            if((E_OK == ret) && (ZERO_INIT != l_stats.count)){
+                l_index = report_append_text(l_line , INTERRUPT_REPORT_LINE_SIZE , ZERO_INIT , isr_source_names[l_source]);
+                l_index = report_append_text(l_line , INTERRUPT_REPORT_LINE_SIZE , l_index , (const uint8 *)" n=");
+                l_index = report_append_hex(l_line , INTERRUPT_REPORT_LINE_SIZE , l_index , l_stats.count , 8);
+                l_index = report_append_text(l_line , INTERRUPT_REPORT_LINE_SIZE , l_index , (const uint8 *)" min=");
+                l_index = report_append_hex(l_line , INTERRUPT_REPORT_LINE_SIZE , l_index , l_stats.min_cycles , 4);
+                l_index = report_append_text(l_line , INTERRUPT_REPORT_LINE_SIZE , l_index , (const uint8 *)" avg=");
+                l_index = report_append_hex(l_line , INTERRUPT_REPORT_LINE_SIZE , l_index , l_stats.total_cycles / l_stats.count , 4);
+                l_index = report_append_text(l_line , INTERRUPT_REPORT_LINE_SIZE , l_index , (const uint8 *)" max=");
+                l_index = report_append_hex(l_line , INTERRUPT_REPORT_LINE_SIZE , l_index , l_stats.max_cycles , 4);
+                l_index = report_append_text(l_line , INTERRUPT_REPORT_LINE_SIZE , l_index , (const uint8 *)" int=");
+                l_index = report_append_hex(l_line , INTERRUPT_REPORT_LINE_SIZE , l_index , l_stats.min_interval , 4);
+                l_index = report_append_text(l_line , INTERRUPT_REPORT_LINE_SIZE , l_index , (const uint8 *)"..");
+                l_index = report_append_hex(l_line , INTERRUPT_REPORT_LINE_SIZE , l_index , l_stats.max_interval , 4);
+                l_index = report_append_text(l_line , INTERRUPT_REPORT_LINE_SIZE , l_index , (const uint8 *)" nest=");
+                l_index = report_append_hex(l_line , INTERRUPT_REPORT_LINE_SIZE , l_index , l_stats.nest_count , 2);
+                l_index = report_append_text(l_line , INTERRUPT_REPORT_LINE_SIZE , l_index , (const uint8 *)"\r\n");
+                ret = write(l_line , l_index);
+            }
+            else{ /* Never fired */ }
+        }
+    }
+    return ret;
+}
+
+uint16 Interrupt_Instrumentation_Enter(interrupt_source_t source){
+    uint16 l_entry = instrumentation_timer_read();
+    uint16 l_interval = ZERO_INIT;
+    interrupt_isr_stats_t *l_stats = &isr_stats[source];
+
+#if INTERRUPT_INSTRUMENTATION_GPIO_CFG == INTERRUPT_FEATURE_ENABLE
+    INTERRUPT_INSTRUMENTATION_GPIO_LAT |= (uint8)(1 << (source & 0x07));
+#endif
+    isr_nesting_depth++;
+    if((1 < isr_nesting_depth) && (INTERRUPT_INSTRUMENTATION_NEST_MAX > l_stats->nest_count)){
+        l_stats->nest_count++;
+    }
+    else{ /* Nothing */ }
+    if(ZERO_INIT != l_stats->count){
+        l_interval = l_entry - l_stats->last_entry;
+        if(l_interval < l_stats->min_interval){
+            l_stats->min_interval = l_interval;
+        }
+        else{ /* Nothing */ }
+        if(l_interval > l_stats->max_interval){
+            l_stats->max_interval = l_interval;
+        }
+        else{ /* Nothing */ }
+    }
+    else{ /* First entry , no interval yet */ }
+    l_stats->last_entry = l_entry;
+    return l_entry;
+}
+
+void Interrupt_Instrumentation_Exit(interrupt_source_t source , uint16 entry){
+    uint16 l_cycles = instrumentation_timer_read() - entry;
+    interrupt_isr_stats_t *l_stats = &isr_stats[source];
+
+    l_stats->count++;
+    l_stats->total_cycles += l_cycles;
+    if(l_cycles < l_stats->min_cycles){
+        l_stats->min_cycles = l_cycles;
+    }
+    else{ /* Nothing */ }
+    if(l_cycles > l_stats->max_cycles){
+        l_stats->max_cycles = l_cycles;
+    }
+    else{ /* Nothing */ }
+    isr_nesting_depth--;
+#if INTERRUPT_INSTRUMENTATION_GPIO_CFG == INTERRUPT_FEATURE_ENABLE
+    INTERRUPT_INSTRUMENTATION_GPIO_LAT &= (uint8)~(1 << (source & 0x07));
+#endif
+}
+
+/* Section : Static Function Definitions */
+
+static uint16 instrumentation_timer_read(void){
+    uint8 l_low = ZERO_INIT;
+#if INTERRUPT_INSTRUMENTATION_TIMER_CFG == 1
+    l_low = TMR1L;
+    return (uint16)(((uint16)TMR1H << 8) | l_low);
+#else
+    l_low = TMR3L;
+    return (uint16)(((uint16)TMR3H << 8) | l_low);
+#endif
+}
+
+#endif
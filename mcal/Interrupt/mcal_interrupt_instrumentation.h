@@ -0,0 +1,137 @@
+/**
+ * @file    mcal_interrupt_instrumentation.h
+ * @author  Abdelmoniem Ahmed
+ * @linkedin https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * @brief   Interrupt Latency and ISR Execution-Time Instrumentation
+ * @details Optional build (INTERRUPT_INSTRUMENTATION_FEATURE_ENABLE in
+ *          mcal_interrupt_gen_cfg.h) that timestamps the entry and exit
+ *          of every handler dispatched by the interrupt manager.
+ *
+ *          Timestamps come from a free-running Timer1 or Timer3 counting
+ *          instruction cycles (Fosc / 4 , no prescaler) , selected by
+ *          INTERRUPT_INSTRUMENTATION_TIMER_CFG. That timer is dedicated
+ *          to the instrumentation while it is enabled.
+ *
+ *          Per source :
+ *          - count , min / max / total execution cycles
+ *          - min / max cycles between two entries (period jitter)
+ *          - nest count : entries while another handler was running
+ *            (high priority preempting low priority)
+ *
+ *          Optional GPIO trace (INTERRUPT_INSTRUMENTATION_GPIO_CFG) : bit
+ *          (source id & 7) of INTERRUPT_INSTRUMENTATION_GPIO_LAT is high
+ *          while the handler runs , for logic-analyzer capture.
+ */
+
+#ifndef MCAL_INTERRUPT_INSTRUMENTATION_H
+#define	MCAL_INTERRUPT_INSTRUMENTATION_H
+
+/* Section : Includes */
+
+#include "mcal_interrupt_config.h"
+
+/* Section : Macro Declaration */
+
+#if INTERRUPT_INSTRUMENTATION_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+
+/* Saturation value of the nest counter */
+#define INTERRUPT_INSTRUMENTATION_NEST_MAX          0xFF
+
+#if (INTERRUPT_INSTRUMENTATION_TIMER_CFG != 1) && (INTERRUPT_INSTRUMENTATION_TIMER_CFG != 3)
+#error "INTERRUPT_INSTRUMENTATION_TIMER_CFG must be 1 or 3"
+#endif
+
+#endif
+
+/* Section : Data Types Declarations */
+
+/**
+ * @brief Interrupt sources known by the vector table
+ */
+typedef enum{
+    INTERRUPT_SOURCE_INT0 = 0,
+    INTERRUPT_SOURCE_INT1,
+    INTERRUPT_SOURCE_INT2,
+    INTERRUPT_SOURCE_RBX,
+    INTERRUPT_SOURCE_ADC,
+    INTERRUPT_SOURCE_TMR0,
+    INTERRUPT_SOURCE_TMR1,
+    INTERRUPT_SOURCE_TMR2,
+    INTERRUPT_SOURCE_TMR3,
+    INTERRUPT_SOURCE_CCP1,
+    INTERRUPT_SOURCE_CCP2,
+    INTERRUPT_SOURCE_EEPROM,
+    INTERRUPT_SOURCE_EUSART_TX,
+    INTERRUPT_SOURCE_EUSART_RX,
+    INTERRUPT_SOURCE_SPI,
+    INTERRUPT_SOURCE_I2C,
+    INTERRUPT_SOURCE_I2C_BUS_COL,
+    INTERRUPT_SOURCE_COUNT
+}interrupt_source_t;
+
+/**
+ * @brief Byte sink used by the reports (e.g. EUSART_ASYNC_Write_String_Blocking)
+ */
+typedef Std_ReturnType (* interrupt_report_write_t)(const uint8 *data , uint16 length);
+
+#if INTERRUPT_INSTRUMENTATION_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+
+/**
+ * @brief Statistics of one interrupt source , in instruction cycles
+ */
+typedef struct{
+    uint32 count ;
+    uint32 total_cycles ;
+    uint16 min_cycles ;
+    uint16 max_cycles ;
+    uint16 min_interval ;       /* Between two entries , 0xFFFF until two entries */
+    uint16 max_interval ;
+    uint16 last_entry ;
+    uint8  nest_count ;
+}interrupt_isr_stats_t;
+
+/* Section : Function Declarations */
+
+/**
+ * @brief Start the free-running timestamp timer and clear the statistics
+ * @return Std_ReturnType (E_OK)
+ */
+Std_ReturnType Interrupt_Instrumentation_Init(void);
+
+/**
+ * @brief Clear the statistics of every source
+ * @return Std_ReturnType (E_OK)
+ */
+Std_ReturnType Interrupt_Instrumentation_Reset(void);
+
+/**
+ * @brief Copy the statistics of one source (taken with interrupts masked)
+ * @param source Interrupt source
+ * @param stats  Pointer to the returned statistics
+ * @return Std_ReturnType (E_OK / E_NOT_OK on null pointer or bad source)
+ */
+Std_ReturnType Interrupt_Instrumentation_Get(interrupt_source_t source , interrupt_isr_stats_t *stats);
+
+/**
+ * @brief Write one text line per source that has fired (hex values)
+ * @param write Byte sink , e.g. EUSART_ASYNC_Write_String_Blocking
+ * @return Std_ReturnType (E_OK / E_NOT_OK on null pointer or write failure)
+ *
+ * @note Line format : "TMR0 n=00000123 min=0041 avg=0043 max=0050 int=4E1F..4E2A nest=00\r\n"
+ */
+Std_ReturnType Interrupt_Instrumentation_Report(interrupt_report_write_t write);
+
+/**
+ * @brief Handler entry hook , called by the interrupt manager only
+ * @return Entry timestamp , to be passed back to the exit hook
+ */
+uint16 Interrupt_Instrumentation_Enter(interrupt_source_t source);
+
+/**
+ * @brief Handler exit hook , called by the interrupt manager only
+ */
+void Interrupt_Instrumentation_Exit(interrupt_source_t source , uint16 entry);
+
+#endif
+
+#endif	/* MCAL_INTERRUPT_INSTRUMENTATION_H */
@@ -9,7 +9,8 @@
  * Responsibilities:
  * - Acts as the single entry point for all hardware interrupts
  * - Checks interrupt enable bits and interrupt flags
- * - Dispatches execution to the corresponding peripheral ISR
+ * - Dispatches execution to the corresponding peripheral ISR , in the
+ *   order of the vector table (mcal_interrupt_vector_cfg.h)
  *
  * Supported Interrupt Sources:
  * - External interrupts (INT0, INT1, INT2)
@@ -17,6 +18,7 @@
  * - ADC
  * - Timers (TMR0, TMR1, TMR2, TMR3)
  * - CCP modules (CCP1, CCP2)
+ * - Data EEPROM write complete
  * - EUSART (TX, RX)
  * - MSSP (SPI, I2C, I2C Bus Collision)
  *
@@ -32,14 +34,196 @@
  */
 
 #include "mcal_interrupt_manager.h"
+#include "mcal_externl_interrupt.h"
+#include "mcal_interrupt_vector_cfg.h"
+#include "mcal_interrupt_instrumentation.h"
+#include "mcal_interrupt_stack_monitor.h"
+#include "mcal_interrupt_profiler.h"
 
 /* ----------------------------------------------------
- * Section : Static Flags for RBx Change Detection
+ * Section : PORTB Snapshot for RBx Change Detection
  * ----------------------------------------------------
- * These flags are used to detect rising and falling
- * edges manually for PORTB change interrupts.
+ * Last PORTB value seen by the RBx dispatch. Every change interrupt
+ * reads PORTB once and XORs it with this snapshot : the changed pins
+ * and their new level come from that single read.
  */
-uint8 RB4_ISR_Flag = 1 , RB5_ISR_Flag = 1 , RB6_ISR_Flag = 1 , RB7_ISR_Flag = 1;
+
+/* RB4 - RB7 , the only PORTB pins with interrupt-on-change */
+#define RBX_CHANGE_PIN_MASK                 0xF0
+
+static volatile uint8 rbx_port_snapshot = ZERO_INIT;
+
+/* ----------------------------------------------------
+ * Section : Interrupt Vector Entries
+ * ----------------------------------------------------
+ * Each entry tests its enable bit and flag bit directly (bit test
+ * instructions , no table walk). Entries of disabled features are
+ * empty , the order comes from INTERRUPT_VECTOR_ORDER in
+ * mcal_interrupt_vector_cfg.h.
+ *
+ * In priority mode every entry also carries its level from the priority
+ * map. INTERRUPT_VECTOR_LEVEL is defined before each vector , the entries
+ * of the other level fold to a constant false test and generate no code.
+ */
+
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE == INTERRUPT_PRIORITY_ENABLE
+#define INTERRUPT_LEVEL_MATCH(_LEVEL)       (INTERRUPT_VECTOR_LEVEL == (_LEVEL))
+#else
+#define INTERRUPT_LEVEL_MATCH(_LEVEL)       (1)
+#endif
+
+/* Handler call , wrapped by the entry / exit hooks in instrumentation builds */
+#if INTERRUPT_INSTRUMENTATION_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+#define INTERRUPT_CALL_TIMED(_ID , _HANDLER)                                \
+    {                                                                       \
+        uint16 l_isr_entry = Interrupt_Instrumentation_Enter(_ID);          \
+        _HANDLER();                                                         \
+        Interrupt_Instrumentation_Exit(_ID , l_isr_entry);                  \
+    }
+#else
+#define INTERRUPT_CALL_TIMED(_ID , _HANDLER) _HANDLER();
+#endif
+
+/* Outside the timed part , the stack sweeps are not counted in the handler cycles */
+#if INTERRUPT_STACK_MONITOR_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+#define INTERRUPT_CALL(_ID , _HANDLER)                                      \
+    {                                                                       \
+        uint8 l_stack_context = Interrupt_Stack_Monitor_Enter(_ID);         \
+        INTERRUPT_CALL_TIMED(_ID , _HANDLER)                                \
+        Interrupt_Stack_Monitor_Exit(_ID , l_stack_context);                \
+    }
+#else
+#define INTERRUPT_CALL(_ID , _HANDLER)      INTERRUPT_CALL_TIMED(_ID , _HANDLER)
+#endif
+
+/* Call _HANDLER when the source is enabled and its flag is set */
+#define INTERRUPT_DISPATCH(_ID , _LEVEL , _ENABLE , _FLAG , _HANDLER)      \
+    if(INTERRUPT_LEVEL_MATCH(_LEVEL) &&                                     \
+       (INTERRUPT_ENABLE == (_ENABLE)) && (INTERRUPT_OCCUR == (_FLAG))){      \
+        INTERRUPT_CALL(_ID , _HANDLER)                                      \
+    }                                                                       \
+    else{ /* Nothing */ }
+
+/* Same , for sources sharing a flag (MSSP SPI / I2C) */
+#define INTERRUPT_DISPATCH_WHEN(_ID , _LEVEL , _ENABLE , _FLAG , _CONDITION , _HANDLER) \
+    if(INTERRUPT_LEVEL_MATCH(_LEVEL) &&                                     \
+       (INTERRUPT_ENABLE == (_ENABLE)) && (INTERRUPT_OCCUR == (_FLAG)) && (_CONDITION)){ \
+        INTERRUPT_CALL(_ID , _HANDLER)                                      \
+    }                                                                       \
+    else{ /* Nothing */ }
+
+#if EXTERNAL_INTERRUPT_INTx_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+#define INTERRUPT_VECTOR_INT0               INTERRUPT_DISPATCH(INTERRUPT_SOURCE_INT0 , INTERRUPT_HIGH_PRIORITY_LEVEL , INTCONbits.INT0IE , INTCONbits.INT0IF , INT0_ISR)
+#define INTERRUPT_VECTOR_INT1               INTERRUPT_DISPATCH(INTERRUPT_SOURCE_INT1 , INTERRUPT_PRIORITY_MAP_INT1 , INTCON3bits.INT1IE , INTCON3bits.INT1IF , INT1_ISR)
+#define INTERRUPT_VECTOR_INT2               INTERRUPT_DISPATCH(INTERRUPT_SOURCE_INT2 , INTERRUPT_PRIORITY_MAP_INT2 , INTCON3bits.INT2IE , INTCON3bits.INT2IF , INT2_ISR)
+#else
+#define INTERRUPT_VECTOR_INT0
+#define INTERRUPT_VECTOR_INT1
+#define INTERRUPT_VECTOR_INT2
+#endif
+
+#if EXTERNAL_INTERRUPT_OnChange_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+static void Interrupt_RBx_Dispatch(void);
+#define INTERRUPT_VECTOR_RBX                INTERRUPT_DISPATCH(INTERRUPT_SOURCE_RBX , INTERRUPT_PRIORITY_MAP_RBX , INTCONbits.RBIE , INTCONbits.RBIF , Interrupt_RBx_Dispatch)
+#else
+#define INTERRUPT_VECTOR_RBX
+#endif
+
+#if ADC_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+#define INTERRUPT_VECTOR_ADC                INTERRUPT_DISPATCH(INTERRUPT_SOURCE_ADC , INTERRUPT_PRIORITY_MAP_ADC , PIE1bits.ADIE , PIR1bits.ADIF , ADC_ISR)
+#else
+#define INTERRUPT_VECTOR_ADC
+#endif
+
+#if TIMER0_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+#define INTERRUPT_VECTOR_TMR0               INTERRUPT_DISPATCH(INTERRUPT_SOURCE_TMR0 , INTERRUPT_PRIORITY_MAP_TMR0 , INTCONbits.TMR0IE , INTCONbits.TMR0IF , TMR0_ISR)
+#else
+#define INTERRUPT_VECTOR_TMR0
+#endif
+
+#if TIMER1_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+#define INTERRUPT_VECTOR_TMR1               INTERRUPT_DISPATCH(INTERRUPT_SOURCE_TMR1 , INTERRUPT_PRIORITY_MAP_TMR1 , PIE1bits.TMR1IE , PIR1bits.TMR1IF , TMR1_ISR)
+#else
+#define INTERRUPT_VECTOR_TMR1
+#endif
+
+#if TIMER2_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+#define INTERRUPT_VECTOR_TMR2               INTERRUPT_DISPATCH(INTERRUPT_SOURCE_TMR2 , INTERRUPT_PRIORITY_MAP_TMR2 , PIE1bits.TMR2IE , PIR1bits.TMR2IF , TMR2_ISR)
+#else
+#define INTERRUPT_VECTOR_TMR2
+#endif
+
+#if TIMER3_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+#define INTERRUPT_VECTOR_TMR3               INTERRUPT_DISPATCH(INTERRUPT_SOURCE_TMR3 , INTERRUPT_PRIORITY_MAP_TMR3 , PIE2bits.TMR3IE , PIR2bits.TMR3IF , TMR3_ISR)
+#else
+#define INTERRUPT_VECTOR_TMR3
+#endif
+
+#if CCP1_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+#define INTERRUPT_VECTOR_CCP1               INTERRUPT_DISPATCH(INTERRUPT_SOURCE_CCP1 , INTERRUPT_PRIORITY_MAP_CCP1 , PIE1bits.CCP1IE , PIR1bits.CCP1IF , CCP1_ISR)
+#else
+#define INTERRUPT_VECTOR_CCP1
+#endif
+
+#if CCP2_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+#define INTERRUPT_VECTOR_CCP2               INTERRUPT_DISPATCH(INTERRUPT_SOURCE_CCP2 , INTERRUPT_PRIORITY_MAP_CCP2 , PIE2bits.CCP2IE , PIR2bits.CCP2IF , CCP2_ISR)
+#else
+#define INTERRUPT_VECTOR_CCP2
+#endif
+
+#if DATA_EEPROM_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+#define INTERRUPT_VECTOR_EEPROM             INTERRUPT_DISPATCH(INTERRUPT_SOURCE_EEPROM , INTERRUPT_PRIORITY_MAP_EEPROM , PIE2bits.EEIE , PIR2bits.EEIF , DATA_EEPROM_ISR)
+#else
+#define INTERRUPT_VECTOR_EEPROM
+#endif
+
+#if EUSART_TX_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+#define INTERRUPT_VECTOR_EUSART_TX          INTERRUPT_DISPATCH(INTERRUPT_SOURCE_EUSART_TX , INTERRUPT_PRIORITY_MAP_EUSART_TX , PIE1bits.TXIE , PIR1bits.TXIF , EUSART_TX_ISR)
+#else
+#define INTERRUPT_VECTOR_EUSART_TX
+#endif
+
+#if EUSART_RX_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+#define INTERRUPT_VECTOR_EUSART_RX          INTERRUPT_DISPATCH(INTERRUPT_SOURCE_EUSART_RX , INTERRUPT_PRIORITY_MAP_EUSART_RX , PIE1bits.RCIE , PIR1bits.RCIF , EUSART_RX_ISR)
+#else
+#define INTERRUPT_VECTOR_EUSART_RX
+#endif
+
+/* SSPM <= 5 : SPI modes , SSPM >= 6 : I2C modes */
+#if MSSP_SPI_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+#define INTERRUPT_VECTOR_SPI                INTERRUPT_DISPATCH_WHEN(INTERRUPT_SOURCE_SPI , INTERRUPT_PRIORITY_MAP_MSSP , PIE1bits.SSPIE , PIR1bits.SSPIF , (5 >= SSPCON1bits.SSPM) , MSSP_SPI_ISR)
+#else
+#define INTERRUPT_VECTOR_SPI
+#endif
+
+#if MSSP_I2C_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+#define INTERRUPT_VECTOR_I2C                INTERRUPT_DISPATCH_WHEN(INTERRUPT_SOURCE_I2C , INTERRUPT_PRIORITY_MAP_MSSP , PIE1bits.SSPIE , PIR1bits.SSPIF , (6 <= SSPCON1bits.SSPM) , MSSP_I2C_ISR)
+#else
+#define INTERRUPT_VECTOR_I2C
+#endif
+
+#if MSSP_I2C_BUS_COL_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+#define INTERRUPT_VECTOR_I2C_BUS_COL        INTERRUPT_DISPATCH(INTERRUPT_SOURCE_I2C_BUS_COL , INTERRUPT_PRIORITY_MAP_I2C_BUS_COL , PIE2bits.BCLIE , PIR2bits.BCLIF , MSSP_I2C_BC_ISR)
+#else
+#define INTERRUPT_VECTOR_I2C_BUS_COL
+#endif
+
+/*
+ * Profiler sample , first in the vector : no CALL has been made yet , so
+ * the top of the return stack is the interrupted program counter
+ */
+#if INTERRUPT_PROFILER_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+#define INTERRUPT_VECTOR_PROFILER                                           \
+    if((INTERRUPT_ENABLE == PIE2bits.TMR3IE) && (INTERRUPT_OCCUR == PIR2bits.TMR3IF)){ \
+        uint8 l_pcl = TOSL;                                                 \
+        uint8 l_pch = TOSH;                                                 \
+        uint8 l_pcu = TOSU;                                                 \
+        Interrupt_Profiler_Sample(l_pcl , l_pch , l_pcu);                   \
+    }                                                                       \
+    else{ /* Nothing */ }
+#else
+#define INTERRUPT_VECTOR_PROFILER
+#endif
 
 /* ----------------------------------------------------
  * Section : Interrupt Manager with Priority Levels
@@ -49,28 +233,24 @@ uint8 RB4_ISR_Flag = 1 , RB5_ISR_Flag = 1 , RB6_ISR_Flag = 1 , RB7_ISR_Flag = 1;
 #if INTERRUPT_PRIORITY_LEVELS_ENABLE == INTERRUPT_PRIORITY_ENABLE
 
 /**
- * @brief High Priority Interrupt Service Routine
+ * @brief High Priority Interrupt Service Routine , sources mapped high only
  */
+#define INTERRUPT_VECTOR_LEVEL              INTERRUPT_HIGH_PRIORITY_LEVEL
 void __interrupt(high_priority) Interrupt_ManagerHigh(void){
-    if((INTERRUPT_ENABLE == INTCONbits.INT0IE ) && (INTERRUPT_OCCUR == INTCONbits.INT0IF ) ){
-        INT0_ISR();
-    }
-    else{ /* Nothing */ }
-    if((INTERRUPT_ENABLE == INTCON3bits.INT2IE ) && (INTERRUPT_OCCUR == INTCON3bits.INT2IF ) ){
-        INT2_ISR();  
-    }
-    else{ /* Nothing */ }
+    INTERRUPT_VECTOR_PROFILER
+    INTERRUPT_VECTOR_ORDER
 }
+#undef INTERRUPT_VECTOR_LEVEL
 
 /**
- * @brief Low Priority Interrupt Service Routine
+ * @brief Low Priority Interrupt Service Routine , sources mapped low only
+ * @note  GIEH stays set while it runs : any high priority source preempts it
  */
+#define INTERRUPT_VECTOR_LEVEL              INTERRUPT_LOW_PRIORITY_LEVEL
 void __interrupt(low_priority) Interrupt_Managerlow(void){
-    if((INTERRUPT_ENABLE == INTCON3bits.INT1IE ) && (INTERRUPT_OCCUR == INTCON3bits.INT1IF ) ){
-        INT1_ISR();
-    }
-    else{ /* Nothing */ }
+    INTERRUPT_VECTOR_ORDER
 }
+#undef INTERRUPT_VECTOR_LEVEL
 
 #else
 
@@ -79,154 +259,113 @@ void __interrupt(low_priority) Interrupt_Managerlow(void){
  * ----------------------------------------------------
  */
 
-
 /**
  * @brief Global Interrupt Service Routine (No Priority Mode)
  */
 void __interrupt() Interrupt_Manager(void){
-    if((INTERRUPT_ENABLE == INTCONbits.INT0IE ) && (INTERRUPT_OCCUR == INTCONbits.INT0IF ) ){
-        INT0_ISR();
-    }
-    else{ /* Nothing */ }
-    if((INTERRUPT_ENABLE == INTCON3bits.INT1IE ) && (INTERRUPT_OCCUR == INTCON3bits.INT1IF ) ){
-        INT1_ISR();
-    }
-    else{ /* Nothing */ }
-    if((INTERRUPT_ENABLE == INTCON3bits.INT2IE ) && (INTERRUPT_OCCUR == INTCON3bits.INT2IF ) ){
-        INT2_ISR();
-    }
-    else{ /* Nothing */ }
-    if((INTERRUPT_ENABLE == INTCONbits.RBIE ) && (INTERRUPT_OCCUR == INTCONbits.RBIF ) && 
-       ( 1 == PORTBbits.RB4) && (1 == RB4_ISR_Flag) ){
-        RB4_ISR_Flag = 0;
-        RB4_ISR(1);
-    }
-    if((INTERRUPT_ENABLE == INTCONbits.RBIE ) && (INTERRUPT_OCCUR == INTCONbits.RBIF ) && 
-       ( 0 == PORTBbits.RB4)&& (0 == RB4_ISR_Flag)  ){
-        RB4_ISR_Flag = 1;
-        RB4_ISR(0);
-    }
-    else{ /* Nothing */ }
-    if((INTERRUPT_ENABLE == INTCONbits.RBIE ) && (INTERRUPT_OCCUR == INTCONbits.RBIF ) && 
-       ( 1 == PORTBbits.RB5)&& (1 == RB5_ISR_Flag) ){
-        RB5_ISR_Flag = 0;
-        RB5_ISR(1);
-    }
-    else{ /* Nothing */ }
-    if((INTERRUPT_ENABLE == INTCONbits.RBIE ) && (INTERRUPT_OCCUR == INTCONbits.RBIF ) && 
-       ( 0 == PORTBbits.RB5) && (0 == RB5_ISR_Flag) ){
-        RB5_ISR_Flag = 1;
-        RB5_ISR(0);
-    }
-    else{ /* Nothing */ }
-    if((INTERRUPT_ENABLE == INTCONbits.RBIE ) && (INTERRUPT_OCCUR == INTCONbits.RBIF ) && 
-       ( 1 == PORTBbits.RB6)&& (1 == RB6_ISR_Flag) ){
-        RB6_ISR_Flag = 0;
-        RB6_ISR(1);
-    }
-    else{ /* Nothing */ }
-    if((INTERRUPT_ENABLE == INTCONbits.RBIE ) && (INTERRUPT_OCCUR == INTCONbits.RBIF ) && 
-       (0 == PORTBbits.RB6) && (0 == RB6_ISR_Flag) ){
-        RB6_ISR_Flag = 1 ;
-        RB6_ISR(0);
-    }
-    else{ /* Nothing */ }
-    if((INTERRUPT_ENABLE == INTCONbits.RBIE ) && (INTERRUPT_OCCUR == INTCONbits.RBIF ) && 
-       (1 == PORTBbits.RB7) && (1 == RB7_ISR_Flag)){
-        RB7_ISR_Flag = 0;
-        RB7_ISR(1);
-    }
-    else{ /* Nothing */ }
-    if((INTERRUPT_ENABLE == INTCONbits.RBIE ) && (INTERRUPT_OCCUR == INTCONbits.RBIF ) && 
-       (0 == PORTBbits.RB7) && (0 == RB7_ISR_Flag) ){
-        RB7_ISR_Flag = 1;
-        RB7_ISR(0);
-    }
-    else{ /* Nothing */ }   
-/*---------- until implemented will be commented ----------*/
-    
-#if    INTERRUPT_FEATURE_ENABLE == ADC_INTERRUPT_FEATURE_ENABLE    
-    if((INTERRUPT_ENABLE == PIE1bits.ADIE ) && (INTERRUPT_OCCUR == PIR1bits.ADIF )){
-        ADC_ISR();
-    }
-    else{ /* Nothing */ }
-#endif    
-    
-#if    TIMER0_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE 
-    if((INTERRUPT_ENABLE == INTCONbits.TMR0IE) && (INTERRUPT_OCCUR == INTCONbits.TMR0IF)){
-        TMR0_ISR();
-    }
-    else{ /* Nothing */ }
-#endif
+    INTERRUPT_VECTOR_PROFILER
+    INTERRUPT_VECTOR_ORDER
+}
 
-#if    TIMER1_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE 
-    if((INTERRUPT_ENABLE == PIE1bits.TMR1IE) && (INTERRUPT_OCCUR == PIR1bits.TMR1IF)){
-        TMR1_ISR();
-    }
-    else{ /* Nothing */ }
 #endif
 
-#if    TIMER2_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE 
-    if((INTERRUPT_ENABLE == PIE1bits.TMR2IE) && (INTERRUPT_OCCUR == PIR1bits.TMR2IF)){
-        TMR2_ISR();
-    }
-    else{ /* Nothing */ }
-#endif
+/* ----------------------------------------------------
+ * Section : PORTB Change Decode
+ * ----------------------------------------------------
+ */
 
-#if    TIMER3_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE 
-    if((INTERRUPT_ENABLE == PIE2bits.TMR3IE) && (INTERRUPT_OCCUR == PIR2bits.TMR3IF)){
-        TMR3_ISR();
-    }
-    else{ /* Nothing */ }
-#endif    
+/**
+ * @brief Latch the current RB4 - RB7 levels as the reference of the next change
+ */
+void RBx_Port_Snapshot_Init(void){
+    rbx_port_snapshot = PORTB;
+}
 
-#if    CCP1_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE 
-    if((INTERRUPT_ENABLE == PIE1bits.CCP1IE) && (INTERRUPT_OCCUR == PIR1bits.CCP1IF)){
-        CCP1_ISR();
-    }
-    else{ /* Nothing */ }
-#endif
-    
-#if    CCP2_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE 
-    if((INTERRUPT_ENABLE == PIE2bits.CCP2IE) && (INTERRUPT_OCCUR == PIR2bits.CCP2IF)){
-        CCP2_ISR();
-    }
-    else{ /* Nothing */ }
-#endif    
+#if EXTERNAL_INTERRUPT_OnChange_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
 
-#if    EUSART_TX_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE 
-    if((INTERRUPT_ENABLE == PIE1bits.TXIE) && (INTERRUPT_OCCUR == PIR1bits.TXIF)){
-        EUSART_TX_ISR();
+/**
+ * @brief PORTB change dispatch , RBIE and RBIF already checked by the vector entry
+ * @note  PORTB is read once : that read ends the mismatch condition , so
+ *        RBIF can be cleared right after. An edge arriving later sets
+ *        RBIF again and is served by the next interrupt.
+ */
+static void Interrupt_RBx_Dispatch(void){
+    uint8 l_port = PORTB;
+    uint8 l_changed = (uint8)((l_port ^ rbx_port_snapshot) & RBX_CHANGE_PIN_MASK);
+
+    rbx_port_snapshot = l_port;
+    if(ZERO_INIT == l_changed){
+        /* Glitch shorter than the interrupt latency , nothing to report */
+        EXTERNAL_INTERRUPTS_RBx_CLEAR_FLAG();
     }
-    else{ /* Nothing */ }
-#endif
-    
-#if    EUSART_RX_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE 
-    if((INTERRUPT_ENABLE == PIE1bits.RCIE) && (INTERRUPT_OCCUR == PIR1bits.RCIF)){
-        EUSART_RX_ISR();
+    else{
+        if(l_changed & 0x10){ RB4_ISR((uint8)((l_port >> 4) & 0x01)); }
+        else{ /* Nothing */ }
+        if(l_changed & 0x20){ RB5_ISR((uint8)((l_port >> 5) & 0x01)); }
+        else{ /* Nothing */ }
+        if(l_changed & 0x40){ RB6_ISR((uint8)((l_port >> 6) & 0x01)); }
+        else{ /* Nothing */ }
+        if(l_changed & 0x80){ RB7_ISR((uint8)((l_port >> 7) & 0x01)); }
+        else{ /* Nothing */ }
     }
-    else{ /* Nothing */ }
+}
+
 #endif
 
-#if    MSSP_SPI_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE 
-    if((INTERRUPT_ENABLE == PIE1bits.SSPIE) && (INTERRUPT_OCCUR == PIR1bits.SSPIF) && (5 >= SSPCON1bits.SSPM)){
-        MSSP_SPI_ISR();
-    }
-    else{ /* Nothing */ }
+/* ----------------------------------------------------
+ * Section : Interrupt Manager Control
+ * ----------------------------------------------------
+ */
+
+Std_ReturnType Interrupt_Manager_Init(void){
+    Std_ReturnType ret = E_OK;
+
+    /* Masked until Interrupt_Manager_Global_Enable() , after every peripheral init */
+    INTCONbits.GIE = 0;
+    INTCONbits.PEIE = 0;
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE == INTERRUPT_PRIORITY_ENABLE
+    INTERRUPT_PriorityFeatureEnable();
+    INTCON3bits.INT1IP = INTERRUPT_PRIORITY_MAP_INT1;
+    INTCON3bits.INT2IP = INTERRUPT_PRIORITY_MAP_INT2;
+    INTCON2bits.RBIP   = INTERRUPT_PRIORITY_MAP_RBX;
+    INTCON2bits.TMR0IP = INTERRUPT_PRIORITY_MAP_TMR0;
+    IPR1bits.ADIP      = INTERRUPT_PRIORITY_MAP_ADC;
+    IPR1bits.RCIP      = INTERRUPT_PRIORITY_MAP_EUSART_RX;
+    IPR1bits.TXIP      = INTERRUPT_PRIORITY_MAP_EUSART_TX;
+    IPR1bits.SSPIP     = INTERRUPT_PRIORITY_MAP_MSSP;
+    IPR1bits.CCP1IP    = INTERRUPT_PRIORITY_MAP_CCP1;
+    IPR1bits.TMR2IP    = INTERRUPT_PRIORITY_MAP_TMR2;
+    IPR1bits.TMR1IP    = INTERRUPT_PRIORITY_MAP_TMR1;
+    IPR2bits.EEIP      = INTERRUPT_PRIORITY_MAP_EEPROM;
+    IPR2bits.BCLIP     = INTERRUPT_PRIORITY_MAP_I2C_BUS_COL;
+    IPR2bits.TMR3IP    = INTERRUPT_PRIORITY_MAP_TMR3;
+    IPR2bits.CCP2IP    = INTERRUPT_PRIORITY_MAP_CCP2;
+#else
+    /* Compatibility mode , one vector at 0x0008 */
+    RCONbits.IPEN = 0;
 #endif
+    return ret;
+}
 
-#if    MSSP_I2C_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE 
-    if((INTERRUPT_ENABLE == PIE1bits.SSPIE) && (INTERRUPT_OCCUR == PIR1bits.SSPIF) && (6 <= SSPCON1bits.SSPM)){
-        MSSP_I2C_ISR();
-    }
-    else{ /* Nothing */ }
+Std_ReturnType Interrupt_Manager_Global_Enable(void){
+    Std_ReturnType ret = E_OK;
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE == INTERRUPT_PRIORITY_ENABLE
+    INTERRUPT_GlobalInterruptLowEnable();
+    INTERRUPT_GlobalInterruptHighEnable();
+#else
+    INTERRUPT_PeripheralInterruptEnable();
+    INTERRUPT_GlobalInterruptEnable();
 #endif
+    return ret;
+}
 
-#if    MSSP_I2C_BUS_COL_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE 
-    if((INTERRUPT_ENABLE == PIE2bits.BCLIE) && (INTERRUPT_OCCUR == PIR2bits.BCLIF)){
-        MSSP_I2C_BC_ISR();
-    }
-    else{ /* Nothing */ }
+Std_ReturnType Interrupt_Manager_Global_Disable(void){
+    Std_ReturnType ret = E_OK;
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE == INTERRUPT_PRIORITY_ENABLE
+    INTERRUPT_GlobalInterruptHighDisable();
+    INTERRUPT_GlobalInterruptLowDisable();
+#else
+    INTERRUPT_GlobalInterruptDisable();
 #endif
+    return ret;
 }
-#endif
\ No newline at end of file
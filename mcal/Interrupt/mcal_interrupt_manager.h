@@ -11,8 +11,9 @@
  *          - Calling the appropriate peripheral ISR
  *          - Supporting both priority and non-priority interrupt modes
  *
- *          This file only contains ISR prototypes.
- *          ISR implementations are provided in mcal_interrupt_manager.c.
+ *          This file contains the ISR prototypes and the interrupt manager
+ *          control APIs (priority map , global enable). They are
+ *          implemented in mcal_interrupt_manager.c.
  */
 
 #ifndef MCAL_INTERRUPT_MANAGER_H
@@ -30,6 +31,35 @@
 
 /* Section : Function Declarations */
 
+/* ----------------------------------------------------
+ * Section : Interrupt Manager Control APIs
+ * ----------------------------------------------------
+ */
+
+/**
+ * @brief Mask every interrupt and apply the priority map
+ * @details Call it first in the application , before any peripheral init.
+ *          In priority mode , IPEN is set and every IPR bit is written from
+ *          the priority map of mcal_interrupt_vector_cfg.h. Otherwise the
+ *          device runs in compatibility mode (IPEN cleared).
+ * @return Std_ReturnType (E_OK)
+ */
+Std_ReturnType Interrupt_Manager_Init(void);
+
+/**
+ * @brief Enable global interrupts , once every peripheral is initialized
+ * @details GIE / PEIE , or GIEH / GIEL in priority mode. Peripheral inits
+ *          only enable their own source , never the global bits.
+ * @return Std_ReturnType (E_OK)
+ */
+Std_ReturnType Interrupt_Manager_Global_Enable(void);
+
+/**
+ * @brief Disable global interrupts (GIE , or GIEH / GIEL in priority mode)
+ * @return Std_ReturnType (E_OK)
+ */
+Std_ReturnType Interrupt_Manager_Global_Disable(void);
+
 /* ----------------------------------------------------
  * Section : External Interrupt ISR Prototypes
  * ----------------------------------------------------
@@ -77,6 +107,12 @@ void RB6_ISR(uint8 source);
  */
 void RB7_ISR(uint8 source);
 
+/**
+ * @brief Latch the current PORTB levels as the reference of the RBx change decode
+ * @note  Called by interrupt_RBx_Init , once the pin is an input
+ */
+void RBx_Port_Snapshot_Init(void);
+
 /* ----------------------------------------------------
  * Section : Internal Peripheral Interrupt ISR Prototypes
  * ----------------------------------------------------
@@ -117,6 +153,11 @@ void CCP1_ISR(void);
  */
 void CCP2_ISR(void);
 
+/**
+ * @brief ISR for Data EEPROM write complete interrupt
+ */
+void DATA_EEPROM_ISR(void);
+
 /**
  * @brief ISR for EUSART transmit interrupt
  */
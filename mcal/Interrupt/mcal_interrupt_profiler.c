@@ -0,0 +1,217 @@
+/**
+ * @file    mcal_interrupt_profiler.c
+ * @author  Abdelmoniem Ahmed
+ * @linkedin https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * @brief   Statistical Program Counter Sampling Profiler
+ * @details The sample hook counts one bucket and reloads Timer3 relative
+ *          to the count it reached since the overflow , so the interrupt
+ *          latency does not stretch the sample period. Text formatting is
+ *          left to the report , which runs in the main loop.
+ */
+
+/* Section : Includes */
+
+#include "mcal_interrupt_profiler.h"
+#include "report_format.h"
+
+#if INTERRUPT_PROFILER_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+
+/* Section : Macro Declaration */
+
+#define PROFILER_REPORT_LINE_SIZE       96
+
+/* Dither of the period , low bits of an 8-bit Galois LFSR (x^8 + x^6 + x^5 + x^4 + 1) */
+#define PROFILER_DITHER_MASK            0x3F
+#define PROFILER_LFSR_TAPS              0xB8
+#define PROFILER_LFSR_SEED              0x5A
+
+/* Section : Static Variables */
+
+static volatile uint16 profiler_buckets[INTERRUPT_PROFILER_BUCKET_COUNT];
+static volatile uint32 profiler_samples = ZERO_INIT;
+static volatile uint32 profiler_outside = ZERO_INIT;
+static uint8 profiler_lfsr = PROFILER_LFSR_SEED;
+
+/* Section : Static Function Declarations */
+
+static void profiler_timer_reload(void);
+
+/* Section : Function Definitions */
+
+Std_ReturnType Interrupt_Profiler_Init(void){
+    Std_ReturnType ret = E_OK;
+
+    PIE2bits.TMR3IE = 0;
+    T3CONbits.TMR3ON = 0;
+    T3CONbits.RD16 = 1;
+    T3CONbits.T3CKPS = 0;
+    T3CONbits.TMR3CS = 0;
+    PIR2bits.TMR3IF = 0;
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE == INTERRUPT_PRIORITY_ENABLE
+    /* Low priority handlers are sampled too */
+    IPR2bits.TMR3IP = INTERRUPT_HIGH_PRIORITY_LEVEL;
+#endif
+    ret = Interrupt_Profiler_Reset();
+    return ret;
+}
+
+Std_ReturnType Interrupt_Profiler_Start(void){
+    Std_ReturnType ret = E_OK;
+
+    TMR3H = ZERO_INIT;
+    TMR3L = ZERO_INIT;
+    profiler_timer_reload();
+    PIR2bits.TMR3IF = 0;
+    PIE2bits.TMR3IE = 1;
+    T3CONbits.TMR3ON = 1;
+    return ret;
+}
+
+Std_ReturnType Interrupt_Profiler_Stop(void){
+    Std_ReturnType ret = E_OK;
+
+    PIE2bits.TMR3IE = 0;
+    T3CONbits.TMR3ON = 0;
+    PIR2bits.TMR3IF = 0;
+    return ret;
+}
+
+Std_ReturnType Interrupt_Profiler_Reset(void){
+    Std_ReturnType ret = E_OK;
+    uint8 l_gie = INTCONbits.GIE;
+    uint16 l_bucket = ZERO_INIT;
+
+    INTCONbits.GIE = 0;
+    for(l_bucket = ZERO_INIT ; l_bucket < INTERRUPT_PROFILER_BUCKET_COUNT ; l_bucket++){
+        profiler_buckets[l_bucket] = ZERO_INIT;
+    }
+    profiler_samples = ZERO_INIT;
+    profiler_outside = ZERO_INIT;
+    INTCONbits.GIE = l_gie;
+    return ret;
+}
+
+Std_ReturnType Interrupt_Profiler_Get_Totals(uint32 *samples , uint32 *outside){
+    Std_ReturnType ret = E_OK;
+    uint8 l_gie = ZERO_INIT;
+
+    if((NULL == samples) || (NULL == outside)){
+        ret = E_NOT_OK;
+    }
+    else{
+        l_gie = INTCONbits.GIE;
+        INTCONbits.GIE = 0;
+        *samples = profiler_samples;
+        *outside = profiler_outside;
+        INTCONbits.GIE = l_gie;
+    }
+    return ret;
+}
+
+Std_ReturnType Interrupt_Profiler_Get_Bucket(uint16 bucket , uint16 *count){
+    Std_ReturnType ret = E_OK;
+    uint8 l_gie = ZERO_INIT;
+
+    if((NULL == count) || (INTERRUPT_PROFILER_BUCKET_COUNT <= bucket)){
+        ret = E_NOT_OK;
+    }
+    else{
+        l_gie = INTCONbits.GIE;
+        INTCONbits.GIE = 0;
+        *count = profiler_buckets[bucket];
+        INTCONbits.GIE = l_gie;
+    }
+    return ret;
+}
+
+Std_ReturnType Interrupt_Profiler_Report(interrupt_report_write_t write){
+    Std_ReturnType ret = E_OK;
+    uint8 l_line[PROFILER_REPORT_LINE_SIZE];
+    uint8 l_index = ZERO_INIT;
+    uint16 l_bucket = ZERO_INIT;
+    uint16 l_count = ZERO_INIT;
+    uint32 l_samples = ZERO_INIT;
+    uint32 l_outside = ZERO_INIT;
+
+    if(NULL == write){
+        ret = E_NOT_OK;
+    }
+    else{
+        (void)Interrupt_Profiler_Get_Totals(&l_samples , &l_outside);
+        l_index = report_append_text(l_line , PROFILER_REPORT_LINE_SIZE , ZERO_INIT , (const uint8 *)"PROF base=");
+        l_index = report_append_hex(l_line , PROFILER_REPORT_LINE_SIZE , l_index , INTERRUPT_PROFILER_BASE_ADDRESS , 6);
+        l_index = report_append_text(l_line , PROFILER_REPORT_LINE_SIZE , l_index , (const uint8 *)" shift=");
+        l_index = report_append_hex(l_line , PROFILER_REPORT_LINE_SIZE , l_index , INTERRUPT_PROFILER_BUCKET_SHIFT , 2);
+        l_index = report_append_text(l_line , PROFILER_REPORT_LINE_SIZE , l_index , (const uint8 *)" buckets=");
+        l_index = report_append_hex(l_line , PROFILER_REPORT_LINE_SIZE , l_index , INTERRUPT_PROFILER_BUCKET_COUNT , 4);
+        l_index = report_append_text(l_line , PROFILER_REPORT_LINE_SIZE , l_index , (const uint8 *)" period=");
+        l_index = report_append_hex(l_line , PROFILER_REPORT_LINE_SIZE , l_index , INTERRUPT_PROFILER_PERIOD_CYCLES , 4);
+        l_index = report_append_text(l_line , PROFILER_REPORT_LINE_SIZE , l_index , (const uint8 *)" samples=");
+        l_index = report_append_hex(l_line , PROFILER_REPORT_LINE_SIZE , l_index , l_samples , 8);
+        l_index = report_append_text(l_line , PROFILER_REPORT_LINE_SIZE , l_index , (const uint8 *)" outside=");
+        l_index = report_append_hex(l_line , PROFILER_REPORT_LINE_SIZE , l_index , l_outside , 8);
+        l_index = report_append_text(l_line , PROFILER_REPORT_LINE_SIZE , l_index , (const uint8 *)"\r\n");
+        ret = write(l_line , l_index);
+
+        for(l_bucket = ZERO_INIT ; (l_bucket < INTERRUPT_PROFILER_BUCKET_COUNT) && (E_OK == ret) ; l_bucket++){
+            (void)Interrupt_Profiler_Get_Bucket(l_bucket , &l_count);
+            if(ZERO_INIT != l_count){
+                l_index = report_append_text(l_line , PROFILER_REPORT_LINE_SIZE , ZERO_INIT , (const uint8 *)"B ");
+                l_index = report_append_hex(l_line , PROFILER_REPORT_LINE_SIZE , l_index ,
+                                            INTERRUPT_PROFILER_BASE_ADDRESS + ((uint32)l_bucket << INTERRUPT_PROFILER_BUCKET_SHIFT) , 6);
+                l_index = report_append_text(l_line , PROFILER_REPORT_LINE_SIZE , l_index , (const uint8 *)" ");
+                l_index = report_append_hex(l_line , PROFILER_REPORT_LINE_SIZE , l_index , l_count , 4);
+                l_index = report_append_text(l_line , PROFILER_REPORT_LINE_SIZE , l_index , (const uint8 *)"\r\n");
+                ret = write(l_line , l_index);
+            }
+            else{ /* Never sampled */ }
+        }
+
+        if(E_OK == ret){
+            ret = write((const uint8 *)"END\r\n" , 5);
+        }
+        else{ /* Nothing */ }
+    }
+    return ret;
+}
+
+void Interrupt_Profiler_Sample(uint8 pcl , uint8 pch , uint8 pcu){
+    uint32 l_offset = (((uint32)pcu << 16) | ((uint16)pch << 8) | pcl) - INTERRUPT_PROFILER_BASE_ADDRESS;
+    uint32 l_bucket = l_offset >> INTERRUPT_PROFILER_BUCKET_SHIFT;
+
+    PIR2bits.TMR3IF = 0;
+    profiler_timer_reload();
+    profiler_samples++;
+    /* Below the base the offset wraps to a large value , outside as well */
+    if(INTERRUPT_PROFILER_BUCKET_COUNT > l_bucket){
+        if(INTERRUPT_PROFILER_BUCKET_MAX > profiler_buckets[l_bucket]){
+            profiler_buckets[l_bucket]++;
+        }
+        else{ /* Saturated */ }
+    }
+    else{
+        profiler_outside++;
+    }
+}
+
+/* Section : Static Function Definitions */
+
+/**
+ * @brief Next overflow one dithered period after the last one , the counts
+ *        since that overflow (ISR latency) are kept
+ */
+static void profiler_timer_reload(void){
+    uint8 l_low = ZERO_INIT;
+    uint16 l_count = ZERO_INIT;
+
+    profiler_lfsr = (uint8)((profiler_lfsr >> 1) ^ ((profiler_lfsr & 0x01) ? PROFILER_LFSR_TAPS : ZERO_INIT));
+    /* Low byte first , RD16 latches the high byte with it */
+    l_low = TMR3L;
+    l_count = (uint16)(((uint16)TMR3H << 8) | l_low);
+    l_count = (uint16)(l_count - INTERRUPT_PROFILER_PERIOD_CYCLES - (profiler_lfsr & PROFILER_DITHER_MASK));
+    /* High byte first , it is buffered until the low byte write */
+    TMR3H = (uint8)(l_count >> 8);
+    TMR3L = (uint8)(l_count);
+}
+
+#endif
@@ -0,0 +1,130 @@
+/**
+ * @file    mcal_interrupt_profiler.h
+ * @author  Abdelmoniem Ahmed
+ * @linkedin https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * @brief   Statistical Program Counter Sampling Profiler
+ * @details Optional build (INTERRUPT_PROFILER_FEATURE_ENABLE in
+ *          mcal_interrupt_gen_cfg.h) that shows where the CPU time goes.
+ *
+ *          Timer3 counts instruction cycles and interrupts the code every
+ *          INTERRUPT_PROFILER_PERIOD_CYCLES (plus a 0 .. 63 cycle dither ,
+ *          so the samples never lock onto a periodic task). The manager
+ *          reads TOSU:TOSH:TOSL first thing in the vector , before any
+ *          CALL : the top of the return stack is then the address the
+ *          interrupt was taken at.
+ *
+ *          The address is counted in one bucket of a histogram covering
+ *          INTERRUPT_PROFILER_BUCKET_COUNT * 2 ^ INTERRUPT_PROFILER_BUCKET_SHIFT
+ *          bytes from INTERRUPT_PROFILER_BASE_ADDRESS , samples outside it
+ *          are counted apart.
+ *
+ *          With INTERRUPT_PRIORITY_LEVELS_ENABLE Timer3 is a high priority
+ *          source : low priority handlers are sampled too , high priority
+ *          handlers never are (they run with GIEH cleared).
+ *
+ *          The report is text , tools/profiler/profile_report.py maps the
+ *          buckets back to the functions of the XC8 .cof or .map file.
+ */
+
+#ifndef MCAL_INTERRUPT_PROFILER_H
+#define	MCAL_INTERRUPT_PROFILER_H
+
+/* Section : Includes */
+
+#include "mcal_interrupt_instrumentation.h"
+
+/* Section : Macro Declaration */
+
+#if INTERRUPT_PROFILER_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+
+/* Saturation value of a bucket */
+#define INTERRUPT_PROFILER_BUCKET_MAX               0xFFFFU
+
+#if TIMER3_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+#error "The profiler owns Timer3 : disable TIMER3_INTERRUPT_FEATURE_ENABLE"
+#endif
+
+#if (INTERRUPT_INSTRUMENTATION_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE) && (INTERRUPT_INSTRUMENTATION_TIMER_CFG == 3)
+#error "The profiler owns Timer3 : set INTERRUPT_INSTRUMENTATION_TIMER_CFG to 1"
+#endif
+
+#if (INTERRUPT_PROFILER_BUCKET_COUNT < 1) || (INTERRUPT_PROFILER_BUCKET_COUNT > 256)
+#error "INTERRUPT_PROFILER_BUCKET_COUNT must be 1 .. 256"
+#endif
+
+#if (INTERRUPT_PROFILER_PERIOD_CYCLES < 200) || (INTERRUPT_PROFILER_PERIOD_CYCLES > 65000)
+#error "INTERRUPT_PROFILER_PERIOD_CYCLES must be 200 .. 65000"
+#endif
+
+#endif
+
+/* Section : Data Types Declarations */
+
+#if INTERRUPT_PROFILER_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+
+/* Section : Function Declarations */
+
+/**
+ * @brief Set Timer3 up as the sample clock (stopped) and clear the histogram
+ * @return Std_ReturnType (E_OK)
+ * @note  Call it after Interrupt_Manager_Init()
+ */
+Std_ReturnType Interrupt_Profiler_Init(void);
+
+/**
+ * @brief Start taking samples
+ * @return Std_ReturnType (E_OK)
+ */
+Std_ReturnType Interrupt_Profiler_Start(void);
+
+/**
+ * @brief Stop taking samples , the histogram is kept
+ * @return Std_ReturnType (E_OK)
+ */
+Std_ReturnType Interrupt_Profiler_Stop(void);
+
+/**
+ * @brief Clear the histogram and the sample counters
+ * @return Std_ReturnType (E_OK)
+ */
+Std_ReturnType Interrupt_Profiler_Reset(void);
+
+/**
+ * @brief Read the sample counters
+ * @param samples Pointer to the number of samples taken since the last reset
+ * @param outside Pointer to the number of those outside the histogram range
+ * @return Std_ReturnType (E_OK / E_NOT_OK on null pointer)
+ */
+Std_ReturnType Interrupt_Profiler_Get_Totals(uint32 *samples , uint32 *outside);
+
+/**
+ * @brief Read one bucket
+ * @param bucket Bucket index (0 .. INTERRUPT_PROFILER_BUCKET_COUNT - 1)
+ * @param count  Pointer to the returned count (saturates at 0xFFFF)
+ * @return Std_ReturnType (E_OK / E_NOT_OK on null pointer or bad index)
+ */
+Std_ReturnType Interrupt_Profiler_Get_Bucket(uint16 bucket , uint16 *count);
+
+/**
+ * @brief Write the histogram as text lines , non-empty buckets only
+ * @param write Byte sink , e.g. EUSART_ASYNC_Write_String_Blocking
+ * @return Std_ReturnType (E_OK / E_NOT_OK on null pointer or write failure)
+ *
+ * @note
+ * Lines (hex) :
+ *   "PROF base=000000 shift=08 buckets=0080 period=03E8 samples=00001234 outside=00000000\r\n"
+ *   "B 001200 0123\r\n"     bucket start address , count
+ *   "END\r\n"
+ * Stop the profiler first , or the report itself shows up in the samples.
+ */
+Std_ReturnType Interrupt_Profiler_Report(interrupt_report_write_t write);
+
+/**
+ * @brief Sample hook , called by the interrupt manager only
+ * @param pcl / pch / pcu Interrupted program counter , read from TOSL / TOSH / TOSU
+ */
+void Interrupt_Profiler_Sample(uint8 pcl , uint8 pch , uint8 pcu);
+
+#endif
+
+#endif	/* MCAL_INTERRUPT_PROFILER_H */
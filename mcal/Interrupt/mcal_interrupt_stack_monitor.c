@@ -0,0 +1,280 @@
+/**
+ * @file    mcal_interrupt_stack_monitor.c
+ * @author  Abdelmoniem Ahmed
+ * @linkedin https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * @brief   Hardware Return Stack High-Water Marks per Interrupt Source
+ * @details Every sweep moves STKPTR away from the return address of the
+ *          running function , so it runs with interrupts masked and is
+ *          expanded inline (STACK_MONITOR_SWEEP) : a CALL in the middle of
+ *          it would push on the level being painted.
+ *
+ *          Dirty levels above STKPTR are always contiguous : a context can
+ *          only reach level n + 1 through level n , and a sweep cleans all
+ *          of them up to the first painted one.
+ */
+
+/* Section : Includes */
+
+#include "mcal_interrupt_stack_monitor.h"
+#include "report_format.h"
+
+#if INTERRUPT_STACK_MONITOR_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+
+/* Section : Macro Declaration */
+
+#define STACK_MONITOR_PAINT             0x1F    /* TOSU of 0x1Fxxxx , past the 64 KB flash */
+#define STACK_MONITOR_LEVEL_MASK        0x1F    /* STKPTR<4:0> */
+#define STACK_MONITOR_FLAGS_MASK        0xC0    /* STKFUL , STKUNF */
+#define STACK_MONITOR_REPORT_LINE_SIZE  40
+
+/* Section : Macro Functions Declarations */
+
+/* Point TOSU at _LEVEL , STKFUL / STKUNF are written back as read (a 1 keeps them) */
+#define STACK_MONITOR_SELECT(_LEVEL)    (STKPTR = (uint8)((STKPTR & STACK_MONITOR_FLAGS_MASK) | (_LEVEL)))
+
+/* Paint the dirty levels above _BASE , _TOP ends on the highest one (_BASE when none) */
+#define STACK_MONITOR_SWEEP(_BASE , _TOP)                                   \
+    {                                                                       \
+        uint8 l_painted = FALSE;                                            \
+        (_TOP) = (_BASE);                                                   \
+        while((FALSE == l_painted) && (INTERRUPT_STACK_DEPTH > (_TOP))){    \
+            STACK_MONITOR_SELECT((uint8)((_TOP) + 1));                      \
+            if(STACK_MONITOR_PAINT == TOSU){                                \
+                l_painted = TRUE;                                           \
+            }                                                               \
+            else{                                                           \
+                TOSU = STACK_MONITOR_PAINT;                                 \
+                (_TOP)++;                                                   \
+            }                                                               \
+        }                                                                   \
+        STACK_MONITOR_SELECT(_BASE);                                        \
+    }
+
+/* Section : Static Variables */
+
+static interrupt_stack_stats_t stack_stats[INTERRUPT_SOURCE_COUNT + 1];
+static volatile uint8 stack_context = INTERRUPT_STACK_CONTEXT_MAIN;
+static uint8 stack_reset_status = ZERO_INIT;
+
+static const uint8 * const stack_source_names[INTERRUPT_SOURCE_COUNT + 1] = {
+    (const uint8 *)"INT0" , (const uint8 *)"INT1" , (const uint8 *)"INT2" , (const uint8 *)"RBX" ,
+    (const uint8 *)"ADC" , (const uint8 *)"TMR0" , (const uint8 *)"TMR1" , (const uint8 *)"TMR2" ,
+    (const uint8 *)"TMR3" , (const uint8 *)"CCP1" , (const uint8 *)"CCP2" , (const uint8 *)"EEPROM" ,
+    (const uint8 *)"TX" , (const uint8 *)"RX" , (const uint8 *)"SPI" , (const uint8 *)"I2C" ,
+    (const uint8 *)"BCL" , (const uint8 *)"MAIN"
+};
+
+/* Section : Static Function Declarations */
+
+static uint8 stack_monitor_append_level(uint8 *line , uint8 index , const uint8 *label , uint8 level);
+
+/* Section : Function Definitions */
+
+Std_ReturnType Interrupt_Stack_Monitor_Init(void){
+    Std_ReturnType ret = E_OK;
+    uint8 l_gie = INTCONbits.GIE;
+    uint8 l_base = ZERO_INIT;
+    uint8 l_level = ZERO_INIT;
+    uint8 l_source = ZERO_INIT;
+
+    INTCONbits.GIE = 0;
+    stack_reset_status = ZERO_INIT;
+    if(STKPTRbits.STKFUL){
+        stack_reset_status |= INTERRUPT_STACK_STATUS_RESET_OVERFLOW;
+    }
+    else{ /* Nothing */ }
+    if(STKPTRbits.STKUNF){
+        stack_reset_status |= INTERRUPT_STACK_STATUS_RESET_UNDERFLOW;
+    }
+    else{ /* Nothing */ }
+    /* Writing 0 clears the flags , the level is kept */
+    l_base = (uint8)(STKPTR & STACK_MONITOR_LEVEL_MASK);
+    STKPTR = l_base;
+    for(l_level = (uint8)(l_base + 1) ; l_level <= INTERRUPT_STACK_DEPTH ; l_level++){
+        STACK_MONITOR_SELECT(l_level);
+        TOSU = STACK_MONITOR_PAINT;
+    }
+    STACK_MONITOR_SELECT(l_base);
+
+    for(l_source = ZERO_INIT ; l_source <= INTERRUPT_STACK_CONTEXT_MAIN ; l_source++){
+        stack_stats[l_source].entry_level = ZERO_INIT;
+        stack_stats[l_source].peak_level = ZERO_INIT;
+        stack_stats[l_source].handler_levels = ZERO_INIT;
+    }
+    stack_stats[INTERRUPT_STACK_CONTEXT_MAIN].peak_level = l_base;
+    stack_context = INTERRUPT_STACK_CONTEXT_MAIN;
+    INTCONbits.GIE = l_gie;
+    return ret;
+}
+
+Std_ReturnType Interrupt_Stack_Monitor_Sample(void){
+    Std_ReturnType ret = E_OK;
+    uint8 l_gie = INTCONbits.GIE;
+    uint8 l_base = ZERO_INIT;
+    uint8 l_top = ZERO_INIT;
+
+    INTCONbits.GIE = 0;
+    l_base = (uint8)(STKPTR & STACK_MONITOR_LEVEL_MASK);
+    STACK_MONITOR_SWEEP(l_base , l_top);
+    if(l_top > stack_stats[INTERRUPT_STACK_CONTEXT_MAIN].peak_level){
+        stack_stats[INTERRUPT_STACK_CONTEXT_MAIN].peak_level = l_top;
+    }
+    else{ /* Nothing */ }
+    INTCONbits.GIE = l_gie;
+    return ret;
+}
+
+Std_ReturnType Interrupt_Stack_Monitor_Get(uint8 source , interrupt_stack_stats_t *stats){
+    Std_ReturnType ret = E_OK;
+    uint8 l_gie = ZERO_INIT;
+
+    if((NULL == stats) || (INTERRUPT_STACK_CONTEXT_MAIN < source)){
+        ret = E_NOT_OK;
+    }
+    else{
+        l_gie = INTCONbits.GIE;
+        INTCONbits.GIE = 0;
+        *stats = stack_stats[source];
+        INTCONbits.GIE = l_gie;
+    }
+    return ret;
+}
+
+Std_ReturnType Interrupt_Stack_Monitor_Get_Status(uint8 *peak_level , uint8 *status){
+    Std_ReturnType ret = E_OK;
+    uint8 l_gie = INTCONbits.GIE;
+    uint8 l_peak = ZERO_INIT;
+    uint8 l_source = ZERO_INIT;
+
+    INTCONbits.GIE = 0;
+    for(l_source = ZERO_INIT ; l_source <= INTERRUPT_STACK_CONTEXT_MAIN ; l_source++){
+        if(stack_stats[l_source].peak_level > l_peak){
+            l_peak = stack_stats[l_source].peak_level;
+        }
+        else{ /* Nothing */ }
+    }
+    INTCONbits.GIE = l_gie;
+    if(NULL != peak_level){
+        *peak_level = l_peak;
+    }
+    else{ /* Not wanted */ }
+    if(NULL != status){
+        *status = stack_reset_status;
+        if(STKPTRbits.STKFUL){
+            *status |= INTERRUPT_STACK_STATUS_OVERFLOW;
+        }
+        else{ /* Nothing */ }
+        if(STKPTRbits.STKUNF){
+            *status |= INTERRUPT_STACK_STATUS_UNDERFLOW;
+        }
+        else{ /* Nothing */ }
+    }
+    else{ /* Not wanted */ }
+    return ret;
+}
+
+Std_ReturnType Interrupt_Stack_Monitor_Report(interrupt_report_write_t write){
+    Std_ReturnType ret = E_OK;
+    interrupt_stack_stats_t l_stats;
+    uint8 l_line[STACK_MONITOR_REPORT_LINE_SIZE];
+    uint8 l_index = ZERO_INIT;
+    uint8 l_source = ZERO_INIT;
+    uint8 l_peak = ZERO_INIT;
+    uint8 l_status = ZERO_INIT;
+
+    if(NULL == write){
+        ret = E_NOT_OK;
+    }
+    else{
+        for(l_source = ZERO_INIT ; (l_source <= INTERRUPT_STACK_CONTEXT_MAIN) && (E_OK == ret) ; l_source++){
+            ret = Interrupt_Stack_Monitor_Get(l_source , &l_stats);
+            if((E_OK == ret) && ((ZERO_INIT != l_stats.entry_level) || (INTERRUPT_STACK_CONTEXT_MAIN == l_source))){
+                l_index = report_append_text(l_line , STACK_MONITOR_REPORT_LINE_SIZE , ZERO_INIT , stack_source_names[l_source]);
+                if(INTERRUPT_STACK_CONTEXT_MAIN != l_source){
+                    l_index = stack_monitor_append_level(l_line , l_index , (const uint8 *)" entry=" , l_stats.entry_level);
+                }
+                else{ /* The main line has no entry */ }
+                l_index = stack_monitor_append_level(l_line , l_index , (const uint8 *)" peak=" , l_stats.peak_level);
+                if(INTERRUPT_STACK_CONTEXT_MAIN != l_source){
+                    l_index = stack_monitor_append_level(l_line , l_index , (const uint8 *)" used=" , l_stats.handler_levels);
+                }
+                else{ /* Nothing */ }
+                l_index = report_append_text(l_line , STACK_MONITOR_REPORT_LINE_SIZE , l_index , (const uint8 *)"\r\n");
+                ret = write(l_line , l_index);
+            }
+            else{ /* Never fired */ }
+        }
+        if(E_OK == ret){
+            (void)Interrupt_Stack_Monitor_Get_Status(&l_peak , &l_status);
+            l_index = stack_monitor_append_level(l_line , ZERO_INIT , (const uint8 *)"STACK peak=" , l_peak);
+            l_index = stack_monitor_append_level(l_line , l_index , (const uint8 *)"/" , INTERRUPT_STACK_DEPTH);
+            l_index = stack_monitor_append_level(l_line , l_index , (const uint8 *)" status=" , l_status);
+            l_index = report_append_text(l_line , STACK_MONITOR_REPORT_LINE_SIZE , l_index , (const uint8 *)"\r\n");
+            ret = write(l_line , l_index);
+        }
+        else{ /* Nothing */ }
+    }
+    return ret;
+}
+
+uint8 Interrupt_Stack_Monitor_Enter(interrupt_source_t source){
+    uint8 l_gie = INTCONbits.GIE;
+    uint8 l_context = stack_context;
+    uint8 l_base = ZERO_INIT;
+    uint8 l_top = ZERO_INIT;
+    interrupt_stack_stats_t *l_stats = &stack_stats[source];
+
+    /* A low priority handler can be preempted : nothing may push while STKPTR moves */
+    INTCONbits.GIE = 0;
+    l_base = (uint8)(STKPTR & STACK_MONITOR_LEVEL_MASK);
+    if(l_base > l_stats->entry_level){
+        l_stats->entry_level = l_base;
+    }
+    else{ /* Nothing */ }
+    /* Left by the interrupted context since its last sweep */
+    STACK_MONITOR_SWEEP(l_base , l_top);
+    if(l_top > stack_stats[l_context].peak_level){
+        stack_stats[l_context].peak_level = l_top;
+    }
+    else{ /* Nothing */ }
+    stack_context = (uint8)source;
+    INTCONbits.GIE = l_gie;
+    return l_context;
+}
+
+void Interrupt_Stack_Monitor_Exit(interrupt_source_t source , uint8 context){
+    uint8 l_gie = INTCONbits.GIE;
+    uint8 l_base = ZERO_INIT;
+    uint8 l_top = ZERO_INIT;
+    interrupt_stack_stats_t *l_stats = &stack_stats[source];
+
+    INTCONbits.GIE = 0;
+    /* Same level as the handler call : its return address was here */
+    l_base = (uint8)(STKPTR & STACK_MONITOR_LEVEL_MASK);
+    STACK_MONITOR_SWEEP(l_base , l_top);
+    if(l_top > l_stats->peak_level){
+        l_stats->peak_level = l_top;
+    }
+    else{ /* Nothing */ }
+    if((uint8)(l_top - l_base + 1) > l_stats->handler_levels){
+        l_stats->handler_levels = (uint8)(l_top - l_base + 1);
+    }
+    else{ /* Nothing */ }
+    stack_context = context;
+    INTCONbits.GIE = l_gie;
+}
+
+/* Section : Static Function Definitions */
+
+static uint8 stack_monitor_append_level(uint8 *line , uint8 index , const uint8 *label , uint8 level){
+    index = report_append_text(line , STACK_MONITOR_REPORT_LINE_SIZE , index , label);
+    if((STACK_MONITOR_REPORT_LINE_SIZE - 2) >= index){
+        line[index] = (uint8)('0' + ((level / 10) % 10));
+        line[index + 1] = (uint8)('0' + (level % 10));
+        index += 2;
+    }
+    else{ /* Line full */ }
+    return index;
+}
+
+#endif
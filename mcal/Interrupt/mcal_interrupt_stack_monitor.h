@@ -0,0 +1,120 @@
+/**
+ * @file    mcal_interrupt_stack_monitor.h
+ * @author  Abdelmoniem Ahmed
+ * @linkedin https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * @brief   Hardware Return Stack High-Water Marks per Interrupt Source
+ * @details Optional build (INTERRUPT_STACK_MONITOR_FEATURE_ENABLE in
+ *          mcal_interrupt_gen_cfg.h) that measures how deep the 31-level
+ *          return stack goes , per interrupt source and for the main line.
+ *
+ *          Init paints every free level : TOSU = 0x1F , an address past the
+ *          64 KB flash that no CALL can push. A CALL or an interrupt above
+ *          a level overwrites the paint. Sweeping upward from the current
+ *          STKPTR until the first painted level gives the deepest level
+ *          used since the last sweep , and the sweep paints it again.
+ *
+ *          - Before a handler : the levels left by the interrupted context
+ *            (main line , or the low priority handler) are credited to it
+ *          - After a handler  : the levels it used are credited to it
+ *          - Interrupt_Stack_Monitor_Sample() , from the main loop : the
+ *            levels used by the main line since the last sweep
+ *
+ *          STKFUL / STKUNF are reported too. With the STVREN fuse set (the
+ *          default) an overflow resets the device , Init keeps the flags
+ *          found at start-up so that reset can still be reported.
+ *
+ *          Levels are STKPTR values : 0 = empty , 31 = full. The XC8
+ *          compiled stack (locals and parameters) is static , its size is
+ *          in the map file call graph and is not measured here.
+ */
+
+#ifndef MCAL_INTERRUPT_STACK_MONITOR_H
+#define	MCAL_INTERRUPT_STACK_MONITOR_H
+
+/* Section : Includes */
+
+#include "mcal_interrupt_instrumentation.h"
+
+/* Section : Macro Declaration */
+
+#if INTERRUPT_STACK_MONITOR_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+
+/* Hardware return stack size */
+#define INTERRUPT_STACK_DEPTH                       31
+
+/* Statistics index of the main line , after the interrupt sources */
+#define INTERRUPT_STACK_CONTEXT_MAIN                INTERRUPT_SOURCE_COUNT
+
+/* Interrupt_Stack_Monitor_Get_Status() bits */
+#define INTERRUPT_STACK_STATUS_OVERFLOW             0x01    /* STKFUL set since Init */
+#define INTERRUPT_STACK_STATUS_UNDERFLOW            0x02    /* STKUNF set since Init */
+#define INTERRUPT_STACK_STATUS_RESET_OVERFLOW       0x04    /* STKFUL found by Init : stack overflow reset */
+#define INTERRUPT_STACK_STATUS_RESET_UNDERFLOW      0x08    /* STKUNF found by Init : stack underflow reset */
+
+/* Section : Data Types Declarations */
+
+/**
+ * @brief Return stack levels of one interrupt source , or of the main line
+ */
+typedef struct{
+    uint8 entry_level ;         /* Deepest STKPTR at the handler call , the interrupted code is 2 levels below */
+    uint8 peak_level ;          /* Deepest STKPTR reached (main line : by its own calls) */
+    uint8 handler_levels ;      /* Most levels used by the handler , its own call included */
+}interrupt_stack_stats_t;
+
+/* Section : Function Declarations */
+
+/**
+ * @brief Paint the free levels , capture and clear STKFUL / STKUNF , clear the statistics
+ * @return Std_ReturnType (E_OK)
+ * @note  Call it first in main() , with the stack as shallow as it gets
+ */
+Std_ReturnType Interrupt_Stack_Monitor_Init(void);
+
+/**
+ * @brief Sweep the levels above the caller and credit them to the main line
+ * @return Std_ReturnType (E_OK)
+ * @note  Call it from the top of the main loop , where the main line is shallowest
+ */
+Std_ReturnType Interrupt_Stack_Monitor_Sample(void);
+
+/**
+ * @brief Copy the statistics of one source (taken with interrupts masked)
+ * @param source Interrupt source , or INTERRUPT_STACK_CONTEXT_MAIN
+ * @param stats  Pointer to the returned statistics
+ * @return Std_ReturnType (E_OK / E_NOT_OK on null pointer or bad source)
+ */
+Std_ReturnType Interrupt_Stack_Monitor_Get(uint8 source , interrupt_stack_stats_t *stats);
+
+/**
+ * @brief Deepest level reached by any context , and INTERRUPT_STACK_STATUS_xxx bits
+ * @param peak_level Pointer to the returned level (may be NULL)
+ * @param status     Pointer to the returned status bits (may be NULL)
+ * @return Std_ReturnType (E_OK)
+ */
+Std_ReturnType Interrupt_Stack_Monitor_Get_Status(uint8 *peak_level , uint8 *status);
+
+/**
+ * @brief Write one text line per source that has fired , then the main line and the status
+ * @param write Byte sink , e.g. EUSART_ASYNC_Write_String_Blocking
+ * @return Std_ReturnType (E_OK / E_NOT_OK on null pointer or write failure)
+ *
+ * @note Line format : "TMR0 entry=05 peak=08 used=04\r\n" , levels in decimal ,
+ *       last line "STACK peak=12/31 status=00\r\n"
+ */
+Std_ReturnType Interrupt_Stack_Monitor_Report(interrupt_report_write_t write);
+
+/**
+ * @brief Handler entry hook , called by the interrupt manager only
+ * @return Context that was running , to be passed back to the exit hook
+ */
+uint8 Interrupt_Stack_Monitor_Enter(interrupt_source_t source);
+
+/**
+ * @brief Handler exit hook , called by the interrupt manager only
+ */
+void Interrupt_Stack_Monitor_Exit(interrupt_source_t source , uint8 context);
+
+#endif
+
+#endif	/* MCAL_INTERRUPT_STACK_MONITOR_H */
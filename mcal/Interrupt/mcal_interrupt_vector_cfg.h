@@ -0,0 +1,89 @@
+/**
+ * @file    mcal_interrupt_vector_cfg.h
+ * @author  Abdelmoniem Ahmed
+ * @linkedin https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * @brief   Interrupt Vector Table Configuration File
+ * @details This file holds the dispatch order and the priority map of the
+ *          interrupt manager.
+ *
+ *          Every INTERRUPT_VECTOR_xxx entry stands for one source
+ *          (enable bit , flag bit , handler) and is tested in the order
+ *          of the list below : put the sources that need the lowest
+ *          latency first.
+ *
+ *          An entry whose feature switch in mcal_interrupt_gen_cfg.h is
+ *          disabled expands to nothing , so it costs no code and no time.
+ *          Entries must not be listed twice. A source missing from the
+ *          list is never dispatched.
+ *
+ *          With INTERRUPT_PRIORITY_LEVELS_ENABLE , the priority map below
+ *          decides the vector of every source : the high vector only tests
+ *          the sources mapped high , the low vector only the sources mapped
+ *          low , both in INTERRUPT_VECTOR_ORDER. Interrupt_Manager_Init()
+ *          writes the map into the IPR bits , peripheral inits never touch
+ *          them.
+ *
+ *          This configuration file is intended to be modified by the user
+ *          based on project requirements.
+ */
+
+#ifndef MCAL_INTERRUPT_VECTOR_CFG_H
+#define	MCAL_INTERRUPT_VECTOR_CFG_H
+
+/* ----------------------------------------------------
+ * Dispatch Order (No Priority Mode)
+ * ----------------------------------------------------
+ * Available entries :
+ *  INTERRUPT_VECTOR_INT0 , INTERRUPT_VECTOR_INT1 , INTERRUPT_VECTOR_INT2 ,
+ *  INTERRUPT_VECTOR_RBX , INTERRUPT_VECTOR_ADC , INTERRUPT_VECTOR_TMR0 ,
+ *  INTERRUPT_VECTOR_TMR1 , INTERRUPT_VECTOR_TMR2 , INTERRUPT_VECTOR_TMR3 ,
+ *  INTERRUPT_VECTOR_CCP1 , INTERRUPT_VECTOR_CCP2 , INTERRUPT_VECTOR_EEPROM ,
+ *  INTERRUPT_VECTOR_EUSART_TX , INTERRUPT_VECTOR_EUSART_RX ,
+ *  INTERRUPT_VECTOR_SPI , INTERRUPT_VECTOR_I2C , INTERRUPT_VECTOR_I2C_BUS_COL
+ */
+
+#define INTERRUPT_VECTOR_ORDER              \
+    INTERRUPT_VECTOR_EUSART_RX              \
+    INTERRUPT_VECTOR_INT0                   \
+    INTERRUPT_VECTOR_INT1                   \
+    INTERRUPT_VECTOR_INT2                   \
+    INTERRUPT_VECTOR_RBX                    \
+    INTERRUPT_VECTOR_TMR0                   \
+    INTERRUPT_VECTOR_CCP1                   \
+    INTERRUPT_VECTOR_CCP2                   \
+    INTERRUPT_VECTOR_TMR1                   \
+    INTERRUPT_VECTOR_TMR3                   \
+    INTERRUPT_VECTOR_TMR2                   \
+    INTERRUPT_VECTOR_I2C                    \
+    INTERRUPT_VECTOR_I2C_BUS_COL            \
+    INTERRUPT_VECTOR_SPI                    \
+    INTERRUPT_VECTOR_ADC                    \
+    INTERRUPT_VECTOR_EEPROM                 \
+    INTERRUPT_VECTOR_EUSART_TX
+
+/* ----------------------------------------------------
+ * Priority Map (Priority Mode)
+ * ----------------------------------------------------
+ * INTERRUPT_HIGH_PRIORITY_LEVEL or INTERRUPT_LOW_PRIORITY_LEVEL per source.
+ * Keep the high vector short : it preempts every low priority handler.
+ * INT0 has no priority bit and is always high.
+ * MSSP SPI and MSSP I2C share one priority bit (SSPIP).
+ */
+
+#define INTERRUPT_PRIORITY_MAP_INT1             INTERRUPT_LOW_PRIORITY_LEVEL
+#define INTERRUPT_PRIORITY_MAP_INT2             INTERRUPT_HIGH_PRIORITY_LEVEL
+#define INTERRUPT_PRIORITY_MAP_RBX              INTERRUPT_LOW_PRIORITY_LEVEL
+#define INTERRUPT_PRIORITY_MAP_ADC              INTERRUPT_LOW_PRIORITY_LEVEL
+#define INTERRUPT_PRIORITY_MAP_TMR0             INTERRUPT_LOW_PRIORITY_LEVEL
+#define INTERRUPT_PRIORITY_MAP_TMR1             INTERRUPT_LOW_PRIORITY_LEVEL
+#define INTERRUPT_PRIORITY_MAP_TMR2             INTERRUPT_LOW_PRIORITY_LEVEL
+#define INTERRUPT_PRIORITY_MAP_TMR3             INTERRUPT_LOW_PRIORITY_LEVEL
+#define INTERRUPT_PRIORITY_MAP_CCP1             INTERRUPT_LOW_PRIORITY_LEVEL
+#define INTERRUPT_PRIORITY_MAP_CCP2             INTERRUPT_LOW_PRIORITY_LEVEL
+#define INTERRUPT_PRIORITY_MAP_EEPROM           INTERRUPT_LOW_PRIORITY_LEVEL
+#define INTERRUPT_PRIORITY_MAP_EUSART_TX        INTERRUPT_LOW_PRIORITY_LEVEL
+#define INTERRUPT_PRIORITY_MAP_EUSART_RX        INTERRUPT_HIGH_PRIORITY_LEVEL
+#define INTERRUPT_PRIORITY_MAP_MSSP             INTERRUPT_LOW_PRIORITY_LEVEL
+#define INTERRUPT_PRIORITY_MAP_I2C_BUS_COL      INTERRUPT_LOW_PRIORITY_LEVEL
+
+#endif	/* MCAL_INTERRUPT_VECTOR_CFG_H */
@@ -0,0 +1,130 @@
+/**
+ * @file   hal_power.c
+ * @author Abdelmoniem Ahmed
+ * @linkedin https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * @brief  HAL Power Manager implementation
+ *
+ * @details
+ * OSCCONbits.IDLEN selects what the SLEEP instruction enters : 1 = IDLE
+ * (peripherals clocked) , 0 = SLEEP. The wake-up happens with GIE
+ * cleared , the core continues after SLEEP and the handler is vectored
+ * once the caller's GIE state is restored.
+ */
+
+#include"hal_power.h"
+
+/* Section : Static Variables */
+
+static volatile uint8 power_votes = ZERO_INIT;
+
+/* Section : Static Function Declarations */
+
+static uint8 power_sleep_wake_source_enabled(void);
+
+/* Section : Function Definitions */
+
+Std_ReturnType Power_Vote_Busy(uint8 votes){
+    Std_ReturnType ret = E_OK;
+    uint8 l_gie = INTCONbits.GIE;
+    
+    INTCONbits.GIE = 0;
+    power_votes |= votes;
+    INTCONbits.GIE = l_gie;
+    return ret;
+}
+
+Std_ReturnType Power_Vote_Idle(uint8 votes){
+    Std_ReturnType ret = E_OK;
+    uint8 l_gie = INTCONbits.GIE;
+    
+    INTCONbits.GIE = 0;
+    power_votes &= (uint8)~votes;
+    INTCONbits.GIE = l_gie;
+    return ret;
+}
+
+Std_ReturnType Power_Get_Votes(uint8 *votes){
+    Std_ReturnType ret = E_OK;
+    
+    if(NULL == votes){
+        ret = E_NOT_OK;
+    }
+    else{
+        *votes = power_votes;
+    }
+    return ret;
+}
+
+Std_ReturnType Power_Enter(power_mode_t mode , power_mode_t *entered){
+    Std_ReturnType ret = E_OK;
+    uint8 l_gie = ZERO_INIT;
+    
+    if(POWER_MODE_SLEEP < mode){
+        ret = E_NOT_OK;
+    }
+    else if(POWER_MODE_RUN == mode){
+        /* Nothing to do */
+    }
+    else{
+        l_gie = INTCONbits.GIE;
+        INTCONbits.GIE = 0;
+        
+        if((POWER_MODE_SLEEP == mode) &&
+           ((ZERO_INIT != power_votes) || (FALSE == power_sleep_wake_source_enabled()))){
+            mode = POWER_MODE_IDLE;
+        }
+        else{ /* Nothing */ }
+        
+        if(POWER_MODE_SLEEP == mode){
+            /* The EUSART vote drops with the ring , let the last character leave the TSR */
+            while((TXSTAbits.TXEN) && (!TXSTAbits.TRMT));
+            OSCCONbits.IDLEN = 0;
+        }
+        else{
+            OSCCONbits.IDLEN = 1;
+        }
+        SLEEP();
+        NOP();
+        OSCCONbits.IDLEN = 0;
+        
+        INTCONbits.GIE = l_gie;
+    }
+    
+    if(NULL != entered){
+        *entered = mode;
+    }
+    else{ /* Nothing */ }
+    return ret;
+}
+
+/* Section : Static Function Definitions */
+
+/**
+ * @brief At least one interrupt able to wake the core from SLEEP is enabled
+ */
+static uint8 power_sleep_wake_source_enabled(void){
+    uint8 l_enabled = FALSE;
+    
+    if((INTCONbits.INT0IE) || (INTCON3bits.INT1IE) || (INTCON3bits.INT2IE) || (INTCONbits.RBIE)){
+        l_enabled = TRUE;
+    }
+    else if((PIE1bits.TMR1IE) && (T1CONbits.TMR1ON) && (T1CONbits.TMR1CS) && (T1CONbits.T1SYNC)){
+        /* Timer1 on its oscillator / T1CKI , asynchronous to the stopped core clock */
+        l_enabled = TRUE;
+    }
+    else if((PIE1bits.ADIE) && (ADCON0bits.GODONE) && (0x03 == (ADCON2bits.ADCS & 0x03))){
+        /* Conversion running on the internal RC clock */
+        l_enabled = TRUE;
+    }
+    else if((PIE1bits.SSPIE) && (SSPCON1bits.SSPEN) &&
+            (((0x04 <= SSPCON1bits.SSPM) && (0x07 >= SSPCON1bits.SSPM)) || (0x0E <= SSPCON1bits.SSPM))){
+        /* SPI slave or I2C slave , clocked by the bus master */
+        l_enabled = TRUE;
+    }
+    else if((PIE2bits.EEIE) && (EECON1bits.WR)){
+        /* EEPROM write cycle running , EEIF fires at its end */
+        l_enabled = TRUE;
+    }
+    else{ /* Only synchronous sources : SLEEP would never end */ }
+    return l_enabled;
+}
@@ -0,0 +1,99 @@
+/**
+ * @file   hal_power.h
+ * @author Abdelmoniem Ahmed
+ * @linkedin https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * @brief  HAL Power Manager for PIC18F4620 (IDLE / SLEEP)
+ *
+ * @details
+ * Puts the core in a power-managed mode when the application has
+ * nothing to do , and wakes on any enabled interrupt :
+ *  - IDLE  : CPU clock stopped , peripherals clocked (Timer0 tick ,
+ *            EUSART , MSSP , CCP keep running) , any interrupt wakes
+ *  - SLEEP : oscillator stopped , only the asynchronous sources wake :
+ *            INT0 - INT2 , RB port change , Timer1 on its own
+ *            oscillator (T1OSCEN , not synchronized) , ADC on the RC
+ *            clock , MSSP in I2C / SPI slave mode , EEPROM write done
+ *
+ * Busy votes : a driver with a transfer in flight sets its vote bit ,
+ * SLEEP is then downgraded to IDLE so the transfer clock never stops.
+ * The ISR-driven EUSART TX ring , MSSP I2C master queue and MSSP SPI
+ * transfer vote on their own , the application votes with the
+ * POWER_VOTE_APP_x bits.
+ *
+ * SLEEP is also downgraded to IDLE when no SLEEP wake source is enabled ,
+ * the device never sleeps forever.
+ */
+
+#ifndef HAL_POWER_H
+#define	HAL_POWER_H
+
+/* Section : Includes */
+
+#include"std_types.h"
+#include"mcal_internal_interrupt.h"
+
+/* Section : Macro Declaration */
+
+/* Busy vote bits , one per client */
+#define POWER_VOTE_EUSART_TX            0x01
+#define POWER_VOTE_I2C                  0x02
+#define POWER_VOTE_SPI                  0x04
+#define POWER_VOTE_APP_0                0x10
+#define POWER_VOTE_APP_1                0x20
+#define POWER_VOTE_APP_2                0x40
+#define POWER_VOTE_APP_3                0x80
+
+/* Section : Data Types Declarations */
+
+/**
+ * @enum power_mode_t
+ * @brief Requested power-managed mode , lower = lighter
+ */
+typedef enum{
+    POWER_MODE_RUN = 0,
+    POWER_MODE_IDLE,
+    POWER_MODE_SLEEP
+}power_mode_t;
+
+/* Section : Function Declarations */
+
+/**
+ * @brief Set busy vote bits (ISR safe)
+ * @param votes POWER_VOTE_x bits
+ * @return Std_ReturnType (E_OK)
+ */
+Std_ReturnType Power_Vote_Busy(uint8 votes);
+
+/**
+ * @brief Clear busy vote bits (ISR safe)
+ * @param votes POWER_VOTE_x bits
+ * @return Std_ReturnType (E_OK)
+ */
+Std_ReturnType Power_Vote_Idle(uint8 votes);
+
+/**
+ * @brief Read the current busy votes
+ * @param votes Pointer to the returned POWER_VOTE_x bits
+ * @return Std_ReturnType (E_OK / E_NOT_OK on null pointer)
+ */
+Std_ReturnType Power_Get_Votes(uint8 *votes);
+
+/**
+ * @brief Enter IDLE or SLEEP until the next enabled interrupt
+ *
+ * @param mode      Requested mode , SLEEP may be downgraded to IDLE
+ * @param entered   Pointer to the mode actually entered , may be NULL
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Woken up (or RUN requested , nothing done)
+ *         - E_NOT_OK : Invalid mode
+ *
+ * @note
+ * Interrupts are masked from the decision to the SLEEP instruction , an
+ * interrupt raised in between makes SLEEP return at once. The pending
+ * handler runs when the caller's GIE state is restored , right before
+ * returning. Call it with GIE cleared to check "nothing ready" atomically.
+ */
+Std_ReturnType Power_Enter(power_mode_t mode , power_mode_t *entered);
+
+#endif	/* HAL_POWER_H */
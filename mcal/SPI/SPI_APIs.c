@@ -26,6 +26,7 @@
  */
 
 #include "SPI_APIs.h"
+#include "../Power/hal_power.h"
 
 /* ============================= */
 /* Section : Static Declarations */
@@ -37,6 +38,16 @@
     * @brief Pointer to user-defined SPI interrupt handler.
     */
     static void (* MSSP_SPI_InterruptHandler) (void) = NULL ;
+
+    /**
+    * @brief Interrupt-driven transfer state , see MSSP_SPI_Transfer_Start().
+    */
+    static const uint8 * mssp_spi_async_tx = NULL ;
+    static uint8 * mssp_spi_async_rx = NULL ;
+    static uint16 mssp_spi_async_length = ZERO_INIT ;
+    static uint16 mssp_spi_async_index = ZERO_INIT ;
+    static void (* mssp_spi_async_complete) (void) = NULL ;
+    static volatile uint8 mssp_spi_async_busy = ZERO_INIT ;
 #endif
 
 /**
@@ -54,6 +65,17 @@ static pin_config_t MSSP_SPI_SDI  = { .port = PORTC_INDEX , .pin = PIN4 } ;
 static pin_config_t MSSP_SPI_SCLK = { .port = PORTC_INDEX , .pin = PIN3 } ;
 static pin_config_t MSSP_SPI_SS   = { .port = PORTA_INDEX , .pin = PIN5 } ; 
 
+/**
+ * @brief Bus settings in SSPCON1 / SSPSTAT and the device holding the bus.
+ *
+ * Settings image : SSPM (bits 3..0) , CKP (bit 4) , CKE (bit 5) , SMP (bit 6).
+ */
+static uint8 mssp_spi_bus_settings = MSSP_SPI_BUS_SETTINGS_UNKNOWN ;
+static const mssp_spi_device_t * mssp_spi_selected_device = NULL ;
+
+#define MSSP_SPI_BUS_SETTINGS(_SSPM , _CKP , _CKE , _SMP) \
+    ((uint8)(((_SSPM) & 0x0F) | (((_CKP) & 0x01) << 4) | (((_CKE) & 0x01) << 5) | (((_SMP) & 0x01) << 6)))
+
 
 /* ============================= */
 /* Section : Static Prototypes   */
@@ -65,6 +87,7 @@ static void MSSP_SPI_CLOCK_Init(const mssp_spi_t *spi_obj);
 static void MSSP_SPI_Sample_At(const mssp_spi_t *spi_obj);
 static void MSSP_SPI_Slave_Init_Pins(const mssp_spi_t *spi_obj);
 static void MSSP_SPI_Master_Init_Pins(const mssp_spi_t *spi_obj);
+static Std_ReturnType MSSP_SPI_Bulk_Exchange(const uint8 *tx , uint8 *rx , uint16 length , uint8 fill);
 
 /* ============================= */
 /* Section : API Implementations */
@@ -78,14 +101,12 @@ Std_ReturnType MSSP_SPI_Init(mssp_spi_t *spi_obj){
     }
     else{
      
-        uint8 dummy_data = ZERO_INIT;
-        
         MSSP_SPI_DISABLE();
         
         MSSP_SPI_WRITE_COLLISION_CLEAR();
         MSSP_SPI_OVERFLOW_CLEAR();
         
-        dummy_data = SSPBUF ;
+        (void)SSPBUF ;                  /* Clears BF */
         
         MSSP_SPI_Select_Mode_Set(spi_obj);
         MSSP_SPI_CLOCK_Init(spi_obj);
@@ -110,37 +131,15 @@ Std_ReturnType MSSP_SPI_Init(mssp_spi_t *spi_obj){
         MSSP_SPI_INTERRUPT_DISABLE();
         MSSP_SPI_INTERRUPT_CLEAR_FLAG();
         MSSP_SPI_InterruptHandler = spi_obj->MSSP_SPI_DefaultInterruptHandler ;
-
-#if INTERRUPT_PRIORITY_LEVELS_ENABLE  ==  INTERRUPT_FEATURE_DISABLE
-        
-        INTERRUPT_GlobalInterruptEnable();
-        INTERRUPT_PeripheralInterruptEnable();
-#endif
-        
-#if INTERRUPT_PRIORITY_LEVELS_ENABLE  ==  INTERRUPT_FEATURE_ENABLE
-        
-        INTERRUPT_PriorityFeatureEnable();
-        INTERRUPT_GlobalInterruptHighEnable();
-        INTERRUPT_GlobalInterruptLowEnable();
-        
-        if(Interrupt_High_Priority == spi_obj->mssp_spi_int_priority_level){
-            MSSP_SPI_INTERRUPT_HIGH_PRIORITY();
-        }
-        else if(Interrupt_Low_Priority == spi_obj->mssp_spi_int_priority_level){
-            MSSP_SPI_INTERRUPT_LOW_PRIORITY();
-        }
-        else{
-            /* Nothing */
-        }
-        
-#endif        
-      
         MSSP_SPI_INTERRUPT_ENABLE();
         
 #endif        
         
         /* End of Interrupt Configurations Setting */
         
+        mssp_spi_bus_settings = MSSP_SPI_BUS_SETTINGS(spi_obj->spi_master_slave_select , spi_obj->spi_clock_polarity_select ,
+                                                      spi_obj->spi_clock_transmit_edge_select , SSPSTATbits.SMP);
+        mssp_spi_selected_device = NULL ;
         MSSP_SPI_ENABLE();
     }
     return ret ;
@@ -153,12 +152,10 @@ Std_ReturnType MSSP_SPI_DeInit(mssp_spi_t *spi_obj){
     }
     else{
         
-        uint8 dummy_data = ZERO_INIT;
-        
         MSSP_SPI_WRITE_COLLISION_CLEAR();
         MSSP_SPI_OVERFLOW_CLEAR();
         
-        dummy_data = SSPBUF ;
+        (void)SSPBUF ;                  /* Clears BF */
 
 #if         INTERRUPT_FEATURE_ENABLE == MSSP_SPI_INTERRUPT_FEATURE_ENABLE
         
@@ -167,6 +164,8 @@ Std_ReturnType MSSP_SPI_DeInit(mssp_spi_t *spi_obj){
         
 #endif         
         MSSP_SPI_DISABLE();
+        mssp_spi_bus_settings = MSSP_SPI_BUS_SETTINGS_UNKNOWN ;
+        mssp_spi_selected_device = NULL ;
                 
     }
     return ret ;
@@ -191,6 +190,205 @@ Std_ReturnType MSSP_SPI_Transmit_Receive_Byte(uint8 data_transmit , uint8 * data
     return ret ;
 }
 
+Std_ReturnType MSSP_SPI_Transfer(const uint8 *tx , uint8 *rx , uint16 length){
+    Std_ReturnType ret = E_OK;
+    if((NULL == tx) || (NULL == rx)){
+        ret = E_NOT_OK;
+    }
+    else{
+        ret = MSSP_SPI_Bulk_Exchange(tx , rx , length , MSSP_SPI_FILL_BYTE);
+    }
+    return ret ;
+}
+
+Std_ReturnType MSSP_SPI_Write(const uint8 *tx , uint16 length){
+    Std_ReturnType ret = E_OK;
+    if(NULL == tx){
+        ret = E_NOT_OK;
+    }
+    else{
+        ret = MSSP_SPI_Bulk_Exchange(tx , NULL , length , MSSP_SPI_FILL_BYTE);
+    }
+    return ret ;
+}
+
+Std_ReturnType MSSP_SPI_Read(uint8 *rx , uint16 length , uint8 fill){
+    Std_ReturnType ret = E_OK;
+    if(NULL == rx){
+        ret = E_NOT_OK;
+    }
+    else{
+        ret = MSSP_SPI_Bulk_Exchange(NULL , rx , length , fill);
+    }
+    return ret ;
+}
+
+Std_ReturnType MSSP_SPI_Device_Init(mssp_spi_device_t *device){
+    Std_ReturnType ret = E_OK;
+    if((NULL == device) || (SPI_Master_CLK_FTMR2_DIV2 < device->clock_select)){
+        ret = E_NOT_OK;
+    }
+    else{
+        device->cs_pin.direction = GPIO_DIRECTION_OUTPUT ;
+        device->cs_pin.logic = GPIO_PIN_HIGH ;
+        ret = gpio_pin_initialize(&(device->cs_pin));
+    }
+    return ret ;
+}
+
+Std_ReturnType MSSP_SPI_Device_Select(mssp_spi_device_t *device){
+    Std_ReturnType ret = E_OK;
+    uint8 l_settings = ZERO_INIT;
+    if((NULL == device) || ((NULL != mssp_spi_selected_device) && (device != mssp_spi_selected_device))){
+        ret = E_NOT_OK;
+    }
+#if         INTERRUPT_FEATURE_ENABLE == MSSP_SPI_INTERRUPT_FEATURE_ENABLE
+    else if(mssp_spi_async_busy){
+        ret = E_NOT_OK;
+    }
+#endif
+    else{
+        l_settings = MSSP_SPI_BUS_SETTINGS(device->clock_select , device->clock_polarity_select ,
+                                           device->clock_transmit_edge_select , device->master_sample_at_select);
+        if(l_settings != mssp_spi_bus_settings){
+            /* Mode and clock bits change with the port disabled */
+            MSSP_SPI_DISABLE();
+            MSSP_SPI_MODE_SELECT(device->clock_select);
+            SSPCON1bits.CKP = device->clock_polarity_select ;
+            SSPSTATbits.CKE = device->clock_transmit_edge_select ;
+            SSPSTATbits.SMP = device->master_sample_at_select ;
+            MSSP_SPI_ENABLE();
+            mssp_spi_bus_settings = l_settings ;
+        }
+        else{ /* Bus already set for this kind of device */ }
+        mssp_spi_selected_device = device ;
+        ret = gpio_pin_write_logic(&(device->cs_pin) , GPIO_PIN_LOW);
+    }
+    return ret ;
+}
+
+Std_ReturnType MSSP_SPI_Device_Deselect(mssp_spi_device_t *device){
+    Std_ReturnType ret = E_OK;
+    if((NULL == device) || (device != mssp_spi_selected_device)){
+        ret = E_NOT_OK;
+    }
+    else{
+        ret = gpio_pin_write_logic(&(device->cs_pin) , GPIO_PIN_HIGH);
+        mssp_spi_selected_device = NULL ;
+    }
+    return ret ;
+}
+
+#if         INTERRUPT_FEATURE_ENABLE == MSSP_SPI_INTERRUPT_FEATURE_ENABLE
+Std_ReturnType MSSP_SPI_Transfer_Start(const uint8 *tx , uint8 *rx , uint16 length , void (* complete)(void)){
+    Std_ReturnType ret = E_OK;
+    if((ZERO_INIT == length) || (mssp_spi_async_busy)){
+        ret = E_NOT_OK;
+    }
+    else{
+        MSSP_SPI_INTERRUPT_DISABLE();
+        mssp_spi_async_tx = tx ;
+        mssp_spi_async_rx = rx ;
+        mssp_spi_async_length = length ;
+        mssp_spi_async_index = ZERO_INIT ;
+        mssp_spi_async_complete = complete ;
+        
+        MSSP_SPI_WRITE_COLLISION_CLEAR();
+        MSSP_SPI_OVERFLOW_CLEAR();
+        (void)SSPBUF ;                  /* Clears BF */
+        MSSP_SPI_INTERRUPT_CLEAR_FLAG();
+        
+        mssp_spi_async_busy = 1 ;
+        (void)Power_Vote_Busy(POWER_VOTE_SPI);
+        SSPBUF = (NULL != tx) ? tx[0] : MSSP_SPI_FILL_BYTE ;
+        if(MSSP_SPI_IS_WRITE_COLLISION_OCCUR()){
+            MSSP_SPI_WRITE_COLLISION_CLEAR();
+            mssp_spi_async_busy = 0 ;
+            (void)Power_Vote_Idle(POWER_VOTE_SPI);
+            ret = E_NOT_OK;
+        }
+        else{ /* Shifting , the ISR takes over */ }
+        MSSP_SPI_INTERRUPT_ENABLE();
+    }
+    return ret ;
+}
+
+Std_ReturnType MSSP_SPI_Transfer_Is_Busy(uint8 *busy){
+    Std_ReturnType ret = E_OK;
+    if(NULL == busy){
+        ret = E_NOT_OK;
+    }
+    else{
+        *busy = mssp_spi_async_busy ;
+    }
+    return ret ;
+}
+#endif
+
+/**
+ * @brief Blocking exchange loop shared by Transfer / Write / Read.
+ *
+ * @details
+ * tx NULL sends fill , rx NULL discards. The next byte is fetched while
+ * the current one shifts , so SSPBUF is reloaded as soon as BF is
+ * serviced.
+ */
+static Std_ReturnType MSSP_SPI_Bulk_Exchange(const uint8 *tx , uint8 *rx , uint16 length , uint8 fill){
+    Std_ReturnType ret = E_OK;
+    uint16 l_index = ZERO_INIT;
+    uint8 l_next = fill;
+    uint8 l_data = ZERO_INIT;
+#if         INTERRUPT_FEATURE_ENABLE == MSSP_SPI_INTERRUPT_FEATURE_ENABLE
+    uint8 l_sspie = ZERO_INIT;
+    
+    if(mssp_spi_async_busy){
+        ret = E_NOT_OK;
+    }
+    else{
+        l_sspie = PIE1bits.SSPIE;
+        MSSP_SPI_INTERRUPT_DISABLE();
+    }
+#endif
+    if((E_OK == ret) && (ZERO_INIT != length)){
+        MSSP_SPI_WRITE_COLLISION_CLEAR();
+        MSSP_SPI_OVERFLOW_CLEAR();
+        l_data = SSPBUF ;
+        if(NULL != tx){
+            l_next = tx[0];
+        }
+        else{ /* Fill byte */ }
+        for(l_index = ZERO_INIT ; (l_index < length) && (E_OK == ret) ; l_index++){
+            SSPBUF = l_next ;
+            if(MSSP_SPI_IS_WRITE_COLLISION_OCCUR()){
+                MSSP_SPI_WRITE_COLLISION_CLEAR();
+                ret = E_NOT_OK;
+            }
+            else{
+                /* Fetch the next byte while this one shifts out */
+                if((NULL != tx) && ((l_index + 1) < length)){
+                    l_next = tx[l_index + 1];
+                }
+                else{ /* Fill byte */ }
+                while(!MSSP_SPI_IS_BUF_REG_FULL());
+                l_data = SSPBUF ;
+                if(NULL != rx){
+                    rx[l_index] = l_data;
+                }
+                else{ /* Discarded */ }
+            }
+        }
+    }
+    else{ /* Nothing to exchange */ }
+#if         INTERRUPT_FEATURE_ENABLE == MSSP_SPI_INTERRUPT_FEATURE_ENABLE
+    if(!mssp_spi_async_busy){
+        MSSP_SPI_INTERRUPT_CLEAR_FLAG();
+        PIE1bits.SSPIE = l_sspie;
+    }
+    else{ /* Interrupt transfer owns the module */ }
+#endif
+    return ret ;
+}
+
 
 static void MSSP_SPI_Select_Mode_Set(const mssp_spi_t *spi_obj){
     MSSP_SPI_MODE_SELECT(spi_obj->spi_master_slave_select);
@@ -308,6 +506,7 @@ static void MSSP_SPI_Master_Init_Pins(const mssp_spi_t *spi_obj){
 /* ============================= */
 
 
+#if         INTERRUPT_FEATURE_ENABLE == MSSP_SPI_INTERRUPT_FEATURE_ENABLE
 /**
  * @brief MSSP SPI Interrupt Service Routine.
  *
@@ -315,13 +514,37 @@ static void MSSP_SPI_Master_Init_Pins(const mssp_spi_t *spi_obj){
  */
 
 void MSSP_SPI_ISR(void){
+    uint8 l_data = ZERO_INIT;
     
     MSSP_SPI_INTERRUPT_CLEAR_FLAG();
     MSSP_SPI_WRITE_COLLISION_CLEAR();
     MSSP_SPI_OVERFLOW_CLEAR();
     
-    if(MSSP_SPI_InterruptHandler){
+    if(mssp_spi_async_busy){
+        /* Interrupt-driven transfer : store , then load the next byte */
+        l_data = SSPBUF ;
+        if(NULL != mssp_spi_async_rx){
+            mssp_spi_async_rx[mssp_spi_async_index] = l_data;
+        }
+        else{ /* Discarded */ }
+        mssp_spi_async_index++;
+        if(mssp_spi_async_index < mssp_spi_async_length){
+            SSPBUF = (NULL != mssp_spi_async_tx) ? mssp_spi_async_tx[mssp_spi_async_index] : MSSP_SPI_FILL_BYTE ;
+        }
+        else{
+            mssp_spi_async_busy = 0 ;
+            /* Before the callback , it may chain the next transfer */
+            (void)Power_Vote_Idle(POWER_VOTE_SPI);
+            if(mssp_spi_async_complete){
+                mssp_spi_async_complete();
+            }
+            else{ /* Nothing */ }
+        }
+    }
+    else if(MSSP_SPI_InterruptHandler){
         MSSP_SPI_InterruptHandler();
     }
+    else{ /* Nothing */ }
 }
+#endif
 
@@ -87,6 +87,16 @@
 #define SPI_RECEIVE_ENABLE_CFG                      1
 #define SPI_RECEIVE_DISABLE_CFG                     0
 
+/**
+ * Byte clocked out when a transfer has no transmit buffer
+ */
+#define MSSP_SPI_FILL_BYTE                          0xFF
+
+/**
+ * Bus settings cache value meaning "unknown , reprogram on next select"
+ */
+#define MSSP_SPI_BUS_SETTINGS_UNKNOWN               0xFF
+
 
 /* Section : Macro Functions Declarations */
 
@@ -177,9 +187,6 @@ typedef enum{
 typedef struct{
 #if         INTERRUPT_FEATURE_ENABLE == MSSP_SPI_INTERRUPT_FEATURE_ENABLE
     void (* MSSP_SPI_DefaultInterruptHandler) (void);
-#if         INTERRUPT_FEATURE_ENABLE == INTERRUPT_PRIORITY_LEVELS_ENABLE  
-    INTERRUPT_Priority_cfg mssp_spi_int_priority_level ;
-#endif
 #endif 
 //    master select slave to communicate with using pins like this
 //    the one desired to transmit/receive must its pin be logic 0
@@ -193,6 +200,23 @@ typedef struct{
     
 }mssp_spi_t;
 
+/**
+ * @struct mssp_spi_device_t
+ * @brief One SPI device on the bus (master mode).
+ *
+ * A table of these , one per chip , lets the master switch devices with
+ * MSSP_SPI_Device_Select() instead of a full MSSP_SPI_Init().
+ * The chip select is active low.
+ */
+typedef struct{
+    pin_config_t cs_pin ;                            /* Chip select , driven high by MSSP_SPI_Device_Init */
+    SPI_Modes_Select_t clock_select ;                /* Master clock only (SPI_Master_xxx) */
+    uint8 clock_polarity_select             : 1 ;    /* CKP */
+    uint8 clock_transmit_edge_select        : 1 ;    /* CKE */
+    uint8 master_sample_at_select           : 1 ;    /* SMP */
+    uint8 reserved                          : 5 ;
+}mssp_spi_device_t;
+
 /* Section : Function Declarations */
 
 /**
@@ -223,6 +247,121 @@ Std_ReturnType MSSP_SPI_DeInit(mssp_spi_t *spi_obj);
  */
 Std_ReturnType MSSP_SPI_Transmit_Receive_Byte(uint8 data_transmit , uint8 * data_received);
 
+/**
+ * @brief Exchange a buffer , blocking until the last byte is received.
+ *
+ * @details
+ * Each byte is written to SSPBUF , the next one is fetched while it
+ * shifts , then BF is polled and SSPBUF read. The SPI interrupt is
+ * masked for the duration , the user handler does not see these bytes.
+ *
+ * @param tx     Bytes to transmit.
+ * @param rx     Received bytes , may be the same buffer as tx.
+ * @param length Number of bytes , 0 does nothing.
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : All bytes exchanged
+ *         - E_NOT_OK : Null pointer , write collision or interrupt transfer running
+ */
+Std_ReturnType MSSP_SPI_Transfer(const uint8 *tx , uint8 *rx , uint16 length);
+
+/**
+ * @brief Transmit a buffer , received bytes are discarded (blocking).
+ *
+ * @param tx     Bytes to transmit.
+ * @param length Number of bytes.
+ *
+ * @return Std_ReturnType (see MSSP_SPI_Transfer)
+ */
+Std_ReturnType MSSP_SPI_Write(const uint8 *tx , uint16 length);
+
+/**
+ * @brief Receive a buffer , clocking out a constant byte (blocking).
+ *
+ * @param rx     Received bytes.
+ * @param length Number of bytes.
+ * @param fill   Byte transmitted for every byte received (0xFF for SD / flash).
+ *
+ * @return Std_ReturnType (see MSSP_SPI_Transfer)
+ */
+Std_ReturnType MSSP_SPI_Read(uint8 *rx , uint16 length , uint8 fill);
+
+/**
+ * @brief Configure the chip select of one device , deselected (high).
+ *
+ * @param device Pointer to the device entry.
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Chip select ready
+ *         - E_NOT_OK : Null pointer , slave clock selection or GPIO failure
+ */
+Std_ReturnType MSSP_SPI_Device_Init(mssp_spi_device_t *device);
+
+/**
+ * @brief Apply the bus settings of a device and assert its chip select.
+ *
+ * @details
+ * SSPCON1 / SSPSTAT are rewritten only when clock , CKP , CKE or SMP
+ * differ from the settings in use , selecting the same kind of device
+ * again only drives the chip select.
+ *
+ * @param device Pointer to the device entry.
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Device selected
+ *         - E_NOT_OK : Null pointer , another device still selected or transfer running
+ */
+Std_ReturnType MSSP_SPI_Device_Select(mssp_spi_device_t *device);
+
+/**
+ * @brief Release the chip select of the selected device.
+ *
+ * @param device Pointer to the device entry.
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Device deselected
+ *         - E_NOT_OK : Null pointer or device not selected
+ */
+Std_ReturnType MSSP_SPI_Device_Deselect(mssp_spi_device_t *device);
+
+#if         INTERRUPT_FEATURE_ENABLE == MSSP_SPI_INTERRUPT_FEATURE_ENABLE
+/**
+ * @brief Start an interrupt-driven buffer exchange.
+ *
+ * @details
+ * The first byte is written here , MSSP_SPI_ISR() then stores each
+ * received byte and loads the next one. The user handler is not called
+ * while the transfer runs , complete is called from the ISR after the last
+ * byte.
+ *
+ * @param tx       Bytes to transmit , NULL sends MSSP_SPI_FILL_BYTE.
+ * @param rx       Received bytes , NULL discards them.
+ * @param length   Number of bytes , at least 1.
+ * @param complete Called in ISR context when done , may be NULL.
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Transfer started
+ *         - E_NOT_OK : Zero length , write collision or a transfer already running
+ *
+ * @note The buffers must stay valid until the transfer completes. At
+ *       Fosc / 4 a byte takes 8 instruction cycles , less than the ISR :
+ *       the blocking MSSP_SPI_Transfer() is faster there , the interrupt
+ *       variant frees the CPU at the slower clocks.
+ */
+Std_ReturnType MSSP_SPI_Transfer_Start(const uint8 *tx , uint8 *rx , uint16 length , void (* complete)(void));
+
+/**
+ * @brief Tell whether an interrupt-driven transfer is running.
+ *
+ * @param busy Pointer to the result : 1 = running , 0 = idle.
+ *
+ * @return Std_ReturnType
+ *         - E_OK     : Status returned
+ *         - E_NOT_OK : Null pointer
+ */
+Std_ReturnType MSSP_SPI_Transfer_Is_Busy(uint8 *busy);
+#endif
+
 
 #endif	/* SPI_APIS_H */
 
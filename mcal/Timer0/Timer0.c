@@ -14,10 +14,43 @@
 
 #include "Timer0.h"
 
+/* ===================== Configuration Access ===================== */
+
+/*
+ * TIMER0_CFG_xxx : settings applied by timer0_init()
+ * TIMER0_RUN_xxx : settings used at run time , by TMR0_ISR() in particular
+ * Constants with TIMER0_STATIC_CFG_ENABLE , every test on them folds away.
+ */
+#if TIMER0_STATIC_CFG_ENABLE == TIMER0_STATIC_CFG_ENABLED
+#define TIMER0_CFG_RESOLUTION(_timer)          (TIMER0_STATIC_CFG_RESOLUTION)
+#define TIMER0_CFG_PRESCALER_ENABLE(_timer)    (TIMER0_STATIC_CFG_PRESCALER_ENABLE)
+#define TIMER0_CFG_PRESCALER(_timer)           (TIMER0_STATIC_CFG_PRESCALER)
+#define TIMER0_CFG_CLOCK_SOURCE(_timer)        (TIMER0_STATIC_CFG_CLOCK_SOURCE)
+#define TIMER0_CFG_COUNTER_EDGE(_timer)        (TIMER0_STATIC_CFG_COUNTER_EDGE)
+#define TIMER0_CFG_PRELOAD(_timer)             ((uint16)TIMER0_STATIC_CFG_PRELOAD)
+#define TIMER0_RUN_RESOLUTION                  (TIMER0_STATIC_CFG_RESOLUTION)
+#define TIMER0_RUN_PRELOAD                     ((uint16)TIMER0_STATIC_CFG_PRELOAD)
+#define TIMER0_RUN_RELOAD_LATENCY              ((PRESCALER_ASSIGNED_CFG == TIMER0_STATIC_CFG_PRESCALER_ENABLE) ? \
+                                                ZERO_INIT : TIMER0_RELOAD_LATENCY_CYCLES)
+#else
+#define TIMER0_CFG_RESOLUTION(_timer)          ((_timer)->timer_resolution)
+#define TIMER0_CFG_PRESCALER_ENABLE(_timer)    ((_timer)->prescaler_enable)
+#define TIMER0_CFG_PRESCALER(_timer)           ((_timer)->prescaler_division)
+#define TIMER0_CFG_CLOCK_SOURCE(_timer)        ((_timer)->clock_source)
+#define TIMER0_CFG_COUNTER_EDGE(_timer)        ((_timer)->counter_edge_select)
+#define TIMER0_CFG_PRELOAD(_timer)             ((_timer)->timer0_preload_value)
+#define TIMER0_RUN_RESOLUTION                  (timer0_resolution)
+#define TIMER0_RUN_PRELOAD                     (timer0_preload)
+#define TIMER0_RUN_RELOAD_LATENCY              (timer0_reload_latency)
+#endif
+
 /* ===================== Static Variables ===================== */
 
+#if TIMER0_STATIC_CFG_ENABLE != TIMER0_STATIC_CFG_ENABLED
 static uint16 timer0_preload = ZERO_INIT;
 static uint8 timer0_resolution = ZERO_INIT;
+static uint8 timer0_reload_latency = ZERO_INIT;
+#endif
 
 #if   TIMER0_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE 
     static void (* TMR0_InterruptHandler ) (void) = NULL;
@@ -58,32 +91,23 @@ Std_ReturnType timer0_init(const timer0_t * timer){
         timer0_prescaler_config(timer);
         timer0_Timer_OR_Counter_Mode_Set(timer);
         timer0_register_size_set(timer);
+#if TIMER0_STATIC_CFG_ENABLE != TIMER0_STATIC_CFG_ENABLED
         timer0_resolution = timer->timer_resolution;
-        if(TIMER0_16BIT_MODE_CFG == timer->timer_resolution){
-            TMR0H = ((uint8)(timer->timer0_preload_value >> 8)) ;
+        /* With a prescaler , the write clears it : the lost counts are below one tick */
+        timer0_reload_latency = (PRESCALER_ASSIGNED_CFG == timer->prescaler_enable) ?
+                                ZERO_INIT : TIMER0_RELOAD_LATENCY_CYCLES;
+        timer0_preload = timer->timer0_preload_value ;
+#endif
+        if(TIMER0_16BIT_MODE_CFG == TIMER0_CFG_RESOLUTION(timer)){
+            TMR0H = ((uint8)(TIMER0_CFG_PRELOAD(timer) >> 8)) ;
         }
-        TMR0L = ((uint8)(timer->timer0_preload_value)) ;
+        TMR0L = ((uint8)(TIMER0_CFG_PRELOAD(timer))) ;
 #if  TIMER0_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
         TIMER0_INTERRUPT_CLEAR_FLAG();
         TMR0_InterruptHandler = timer->TMR_InterruptHandler;
-#if INTERRUPT_PRIORITY_LEVELS_ENABLE  ==  INTERRUPT_FEATURE_ENABLE
-        if(Interrupt_High_Priority == timer->priority){
-            TIMER0_INTERRUPT_HIGH_PRIORITY();
-            INTERRUPT_GlobalInterruptHighEnable();
-        }
-        else{
-            TIMER0_INTERRUPT_LOW_PRIORITY();
-            INTERRUPT_GlobalInterruptLowEnable();
-        }
-        INTERRUPT_PriorityFeatureEnable();
-#else
-        INTERRUPT_GlobalInterruptEnable();
-        INTERRUPT_PeripheralInterruptEnable();
-#endif     
         TIMER0_INTERRUPT_ENABLE();
 #endif   
         TIMER0_ENABLE();
-        timer0_preload = timer->timer0_preload_value ;
     }
     return ret;
 }
@@ -129,7 +153,7 @@ Std_ReturnType timer0_Write_Value(const timer0_t * timer , uint16 data){
         ret = E_NOT_OK;
     }
     else{
-        if(TIMER0_16BIT_MODE_CFG == timer->timer_resolution){
+        if(TIMER0_16BIT_MODE_CFG == TIMER0_CFG_RESOLUTION(timer)){
             TMR0H = ((uint8)(data >> 8)) ;
         }
         TMR0L = ((uint8)(data)) ;
@@ -140,13 +164,31 @@ Std_ReturnType timer0_Write_Value(const timer0_t * timer , uint16 data){
 
 /**
  * @brief Timer0 Interrupt Service Routine
+ *
+ * @details
+ * Compensated reload : the counts elapsed since the overflow (interrupt
+ * latency and dispatch) are kept , the preload is added to the current
+ * count instead of overwriting it. The period stays 2^n - preload counts
+ * whatever the load , long schedules do not drift.
+ * A zero preload is not rewritten , the timer free-runs.
  */
 void TMR0_ISR (void){
+    uint8 l_tmr0l = ZERO_INIT , l_tmr0h = ZERO_INIT ;
+    uint16 l_count = ZERO_INIT;
     TIMER0_INTERRUPT_CLEAR_FLAG();
-    if( TIMER0_16BIT_MODE_CFG == timer0_resolution){
-        TMR0H = ((uint8)(timer0_preload >> 8)) ;
+    if(ZERO_INIT != TIMER0_RUN_PRELOAD){
+        if( TIMER0_16BIT_MODE_CFG == TIMER0_RUN_RESOLUTION){
+            l_tmr0l = TMR0L;
+            l_tmr0h = TMR0H;
+            l_count = ( (uint16) ( (l_tmr0h << 8) + l_tmr0l ) ) + TIMER0_RUN_PRELOAD + TIMER0_RUN_RELOAD_LATENCY;
+            TMR0H = ((uint8)(l_count >> 8)) ;
+            TMR0L = ((uint8)(l_count)) ;
+        }
+        else{
+            TMR0L = (uint8)(TMR0L + (uint8)TIMER0_RUN_PRELOAD + TIMER0_RUN_RELOAD_LATENCY) ;
+        }
     }
-    TMR0L = ((uint8)(timer0_preload)) ;
+    else{ /* Free-running */ }
     if(TMR0_InterruptHandler){
         TMR0_InterruptHandler();
     }
@@ -156,9 +198,9 @@ void TMR0_ISR (void){
 
 
 static void timer0_prescaler_config(const timer0_t * timer){
-    if(PRESCALER_ASSIGNED_CFG == timer->prescaler_enable){
+    if(PRESCALER_ASSIGNED_CFG == TIMER0_CFG_PRESCALER_ENABLE(timer)){
         PRESCALER_ASSIGNED();
-        T0CONbits.T0PS = timer->prescaler_division;
+        T0CONbits.T0PS = TIMER0_CFG_PRESCALER(timer);
     }
     else{
         PRESCALER_NOT_ASSIGNED();
@@ -166,12 +208,12 @@ static void timer0_prescaler_config(const timer0_t * timer){
 }
 
 static void timer0_Timer_OR_Counter_Mode_Set(const timer0_t * timer){
-    if( TIMER0_INTERNAL_CLK_SRC_CFG == timer->clock_source){
+    if( TIMER0_INTERNAL_CLK_SRC_CFG == TIMER0_CFG_CLOCK_SOURCE(timer)){
         TIMER0_TIMER_MODE();
     }
     else{
         TIMER0_COUNTER_MODE();
-        if(TIMER0_RISING_EDGE_CFG == timer->counter_edge_select){
+        if(TIMER0_RISING_EDGE_CFG == TIMER0_CFG_COUNTER_EDGE(timer)){
             TIMER0_RISING_EDGE_ENABLE();
         }
         else{
@@ -182,7 +224,7 @@ static void timer0_Timer_OR_Counter_Mode_Set(const timer0_t * timer){
 
 
 static void timer0_register_size_set(const timer0_t * timer){
-    if(TIMER0_8BIT_MODE_CFG == timer->timer_resolution){
+    if(TIMER0_8BIT_MODE_CFG == TIMER0_CFG_RESOLUTION(timer)){
         TIMER0_8BIT_Register_MODE_ENABLE();
     }
     else{
@@ -13,6 +13,7 @@
  *  - 8-bit and 16-bit operation
  *  - Prescaler configuration
  *  - Interrupt support with callback mechanism
+ *  - Optional static configuration (Timer0_CFG.h)
  *
  * Layer  : MCAL (Microcontroller Abstraction Layer)
  * Target : PIC18F4620
@@ -29,6 +30,7 @@
 #include"std_types.h"
 #include"hal_gpio.h"
 #include"mcal_internal_interrupt.h"
+#include"Timer0_CFG.h"
 
 /* Section : Macro Declaration */
 
@@ -52,6 +54,14 @@
 #define TIMER0_8BIT_MODE_CFG          0X01
 #define TIMER0_16BIT_MODE_CFG         0X00
 
+/*
+ * Counts missed by the compensated reload in TMR0_ISR , no prescaler only :
+ * instruction cycles from the TMR0L read to the TMR0L write , plus the 2
+ * cycles of increment inhibit that follow a write. Tune it against a
+ * reference clock if the XC8 optimization level changes.
+ */
+#define TIMER0_RELOAD_LATENCY_CYCLES  8
+
 /* Section : Macro Functions Declarations */
 
 /* Enable/Disable Timer0 module */
@@ -97,9 +107,6 @@ typedef struct{
     timer0_prescaler_select_t prescaler_division ;      /* Prescaler division factor */
 #if   TIMER0_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
     void (* TMR_InterruptHandler) (void);               /* ISR callback function */
-#if INTERRUPT_PRIORITY_LEVELS_ENABLE  ==  INTERRUPT_FEATURE_ENABLE
-    INTERRUPT_Priority_cfg priority;                    /* Interrupt priority */
-#endif
 #endif 
     uint16 timer0_preload_value;                        /* Preload value */
     uint8  clock_source        :1;                      /* Internal/External clock */
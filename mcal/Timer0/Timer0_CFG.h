@@ -0,0 +1,63 @@
+/**
+ * @file    Timer0_CFG.h
+ * @brief   Timer0 Driver Configuration File
+ * @author  Abdelmoniem Ahmed
+ *
+ * @details
+ * Compile-time configuration for fixed hardware : with
+ * TIMER0_STATIC_CFG_ENABLE the driver takes the settings below instead of
+ * the timer0_t fields , timer0_init() compiles to straight register writes
+ * and TMR0_ISR() to a reload without any mode test.
+ *
+ * The timer0_t object still provides the interrupt handler , its other
+ * fields are ignored.
+ *
+ * Target MCU: PIC18F4620
+ */
+
+#ifndef TIMER0_CFG_H
+#define	TIMER0_CFG_H
+
+/* Section : Includes */
+
+
+/* Section : Macro Declaration */
+
+/* Static Configuration Options */
+#define TIMER0_STATIC_CFG_DISABLED          0X00
+#define TIMER0_STATIC_CFG_ENABLED           0X01
+
+/**
+ * @brief Select where the Timer0 settings come from
+ *  - TIMER0_STATIC_CFG_DISABLED : timer0_t object (runtime)
+ *  - TIMER0_STATIC_CFG_ENABLED  : macros below
+ */
+#define TIMER0_STATIC_CFG_ENABLE            (TIMER0_STATIC_CFG_DISABLED)
+
+/**
+ * @brief Static settings , same values as the timer0_t fields
+ *  - TIMER0_STATIC_CFG_RESOLUTION       : TIMER0_8BIT_MODE_CFG / TIMER0_16BIT_MODE_CFG
+ *  - TIMER0_STATIC_CFG_PRESCALER_ENABLE : PRESCALER_ASSIGNED_CFG / PRESCALER_NOT_ASSIGNED_CFG
+ *  - TIMER0_STATIC_CFG_PRESCALER        : 0 (div 2) .. 7 (div 256) , timer0_prescaler_select_t
+ *  - TIMER0_STATIC_CFG_CLOCK_SOURCE     : TIMER0_INTERNAL_CLK_SRC_CFG / TIMER0_EXTERNAL_CLK_SRC_CFG
+ *  - TIMER0_STATIC_CFG_COUNTER_EDGE     : TIMER0_RISING_EDGE_CFG / TIMER0_FALLING_EDGE_CFG
+ *  - TIMER0_STATIC_CFG_PRELOAD          : Reload value , 0 = free-running
+ */
+#define TIMER0_STATIC_CFG_RESOLUTION        0X00
+#define TIMER0_STATIC_CFG_PRESCALER_ENABLE  0X00
+#define TIMER0_STATIC_CFG_PRESCALER         0X00
+#define TIMER0_STATIC_CFG_CLOCK_SOURCE      0X00
+#define TIMER0_STATIC_CFG_COUNTER_EDGE      0X00
+#define TIMER0_STATIC_CFG_PRELOAD           0U
+
+
+/* Section : Macro Functions Declarations */
+
+
+/* Section : Data Types Declarations */
+
+
+/* Section : Function Declarations */
+
+
+#endif	/* TIMER0_CFG_H */
@@ -17,13 +17,38 @@
 
 #include "timer1.h"
 
+/* Section : Configuration Access */
+
+/*
+ * TIMER1_CFG_xxx : settings applied by timer1_init()
+ * TIMER1_RUN_PRELOAD : reload value used by TMR1_ISR()
+ * Constants with TIMER1_STATIC_CFG_ENABLE , every test on them folds away.
+ */
+#if TIMER1_STATIC_CFG_ENABLE == TIMER1_STATIC_CFG_ENABLED
+#define TIMER1_CFG_PRESCALER(_timer)           (TIMER1_STATIC_CFG_PRESCALER)
+#define TIMER1_CFG_MODE(_timer)                (TIMER1_STATIC_CFG_MODE)
+#define TIMER1_CFG_COUNTER_MODE(_timer)        (TIMER1_STATIC_CFG_COUNTER_MODE)
+#define TIMER1_CFG_OSC(_timer)                 (TIMER1_STATIC_CFG_OSC)
+#define TIMER1_CFG_PRELOAD(_timer)             ((uint16)TIMER1_STATIC_CFG_PRELOAD)
+#define TIMER1_RUN_PRELOAD                     ((uint16)TIMER1_STATIC_CFG_PRELOAD)
+#else
+#define TIMER1_CFG_PRESCALER(_timer)           ((_timer)->prescaler_division)
+#define TIMER1_CFG_MODE(_timer)                ((_timer)->timer1_mode)
+#define TIMER1_CFG_COUNTER_MODE(_timer)        ((_timer)->timer1_counter_mode)
+#define TIMER1_CFG_OSC(_timer)                 ((_timer)->timer1_osc_cfg)
+#define TIMER1_CFG_PRELOAD(_timer)             ((_timer)->timer1_preload_value)
+#define TIMER1_RUN_PRELOAD                     (timer1_preload)
+#endif
+
 /* Section : Private (Static) Variables */
 
+#if TIMER1_STATIC_CFG_ENABLE != TIMER1_STATIC_CFG_ENABLED
 /** 
  * @brief Preload value for Timer1.
  * Used to reload the timer on overflow for precise periodic timing.
  */
 static uint16 timer1_preload = ZERO_INIT;
+#endif
 
 /**
  * @brief Pointer to user-defined Timer1 overflow callback.
@@ -31,6 +56,11 @@ static uint16 timer1_preload = ZERO_INIT;
  */
 #if   TIMER1_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE 
     static void (* TMR1_InterruptHandler ) (void) = NULL;
+
+/**
+ * @brief Overflows since initialization , read by timer1_Read_Extended().
+ */
+    static volatile uint32 timer1_overflows = ZERO_INIT;
 #endif
 
 /* Section : Private (Static) Functions */
@@ -59,31 +89,20 @@ Std_ReturnType timer1_init(const timer1_t * timer){
     }
     else{
         TIMER1_DISABLE();
-        TIMER1_PRESCALER_SELECT(timer->prescaler_division);
+        TIMER1_PRESCALER_SELECT(TIMER1_CFG_PRESCALER(timer));
         timer1_Timer_OR_Counter_Mode_Set(timer);
         TIMER1_RD_16BIT_MODE_ENABLE();
 #if  TIMER1_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
         TIMER1_INTERRUPT_CLEAR_FLAG();
         TMR1_InterruptHandler = timer->TMR_InterruptHandler ;
-#if INTERRUPT_PRIORITY_LEVELS_ENABLE  ==  INTERRUPT_FEATURE_ENABLE
-        if(Interrupt_High_Priority == timer->priority){
-            TIMER1_INTERRUPT_HIGH_PRIORITY();
-            INTERRUPT_GlobalInterruptHighEnable();
-        }
-        else{
-            TIMER1_INTERRUPT_LOW_PRIORITY();
-            INTERRUPT_GlobalInterruptLowEnable();
-        }
-        INTERRUPT_PriorityFeatureEnable();
-#else
-        INTERRUPT_GlobalInterruptEnable();
-        INTERRUPT_PeripheralInterruptEnable();
-#endif
+        timer1_overflows = ZERO_INIT;
         TIMER1_INTERRUPT_ENABLE();
 #endif     
+#if TIMER1_STATIC_CFG_ENABLE != TIMER1_STATIC_CFG_ENABLED
         timer1_preload = timer->timer1_preload_value ;
-        TMR1H = ((uint8)(timer->timer1_preload_value >> 8)) ;
-        TMR1L = ((uint8)(timer->timer1_preload_value)) ;
+#endif
+        TMR1H = ((uint8)(TIMER1_CFG_PRELOAD(timer) >> 8)) ;
+        TMR1L = ((uint8)(TIMER1_CFG_PRELOAD(timer))) ;
         TIMER1_ENABLE();
     }
     return ret;
@@ -131,20 +150,48 @@ Std_ReturnType timer1_Write_Value(const timer1_t * timer , uint16 data){
 
 
 
+#if  TIMER1_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+Std_ReturnType timer1_Read_Extended(const timer1_t * timer , uint32 * overflows , uint16 * count){
+    Std_ReturnType ret = E_OK;
+    uint8 l_gie = ZERO_INIT;
+    uint8 l_tmr1l = ZERO_INIT , l_tmr1h = ZERO_INIT ;
+    uint32 l_overflows = ZERO_INIT;
+    if((NULL == timer) || (NULL == overflows) || (NULL == count)){
+        ret = E_NOT_OK;
+    }
+    else{
+        l_gie = INTCONbits.GIE;
+        INTCONbits.GIE = 0;
+        l_overflows = timer1_overflows;
+        l_tmr1l = TMR1L;
+        l_tmr1h = TMR1H;
+        /* Wrapped before the read but not serviced yet : count it here */
+        if((PIR1bits.TMR1IF) && (0x80 > l_tmr1h)){
+            l_overflows++;
+        }
+        else{ /* Nothing */ }
+        INTCONbits.GIE = l_gie;
+        *overflows = l_overflows;
+        *count = ( (uint16) ( (l_tmr1h << 8) + l_tmr1l ) );
+    }
+    return ret;
+}
+#endif
+
 static void timer1_Timer_OR_Counter_Mode_Set(const timer1_t * timer){
-    if( TIMER1_TIMER_MODE_CFG == timer->timer1_mode){
+    if( TIMER1_TIMER_MODE_CFG == TIMER1_CFG_MODE(timer)){
         TIMER1_TIMER_MODE();
     }
     else{
         TIMER1_COUNTER_MODE();
-        if(TIMER1_SYNC_COUNTER_MODE_CFG == timer->timer1_counter_mode){
+        if(TIMER1_SYNC_COUNTER_MODE_CFG == TIMER1_CFG_COUNTER_MODE(timer)){
             TIMER1_SYNC_COUNTER_SET();
         }
         else{
             TIMER1_ASYNC_COUNTER_SET();
         }
     }
-    if(TIMER1_OSC_ENABLE == timer->timer1_osc_cfg){
+    if(TIMER1_OSC_ENABLE == TIMER1_CFG_OSC(timer)){
             TIMER1_OSC_MODE_ENABLE();
         }
         else{
@@ -155,14 +202,20 @@ static void timer1_Timer_OR_Counter_Mode_Set(const timer1_t * timer){
 
 /**
  * @brief Timer1 Overflow ISR
- * @details Clears the interrupt flag, reloads the preload value,
- *          and executes the user callback if assigned.
+ * @details Clears the interrupt flag, counts the overflow, reloads the
+ *          preload value and executes the user callback if assigned.
+ *          A zero preload is not rewritten : the timer keeps free-running
+ *          and no count is lost to the ISR latency.
  */
 void TMR1_ISR(void){
     TIMER1_INTERRUPT_CLEAR_FLAG();
+    timer1_overflows++;
     if(TMR1_InterruptHandler){
         TMR1_InterruptHandler();
     }
-    TMR1H = ((uint8)(timer1_preload >> 8)) ;
-    TMR1L = ((uint8)(timer1_preload)) ;
+    if(ZERO_INIT != TIMER1_RUN_PRELOAD){
+        TMR1H = ((uint8)(TIMER1_RUN_PRELOAD >> 8)) ;
+        TMR1L = ((uint8)(TIMER1_RUN_PRELOAD)) ;
+    }
+    else{ /* Free-running */ }
 }
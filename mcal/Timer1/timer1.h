@@ -32,6 +32,7 @@
 #include"std_types.h"
 #include"hal_gpio.h"
 #include"mcal_internal_interrupt.h"
+#include"timer1_CFG.h"
 
 /* Section : Macro Declaration */
 
@@ -105,9 +106,6 @@ typedef struct {
     uint16 timer1_preload_value ;
 #if  TIMER1_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
     void (* TMR_InterruptHandler) (void);
-#if INTERRUPT_PRIORITY_LEVELS_ENABLE  ==  INTERRUPT_FEATURE_ENABLE
-    INTERRUPT_Priority_cfg priority;
-#endif
 #endif  
     timer1_prescaler_select_t prescaler_division ;
     uint8 timer1_mode               : 1 ;
@@ -149,6 +147,23 @@ Std_ReturnType timer1_Read_Value(const timer1_t * timer , uint16 * time);
  */
 Std_ReturnType timer1_Write_Value(const timer1_t * timer , uint16 data);
 
+#if  TIMER1_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+/**
+ * @brief Read a coherent (overflow count , timer count) pair
+ * @param timer: Pointer to Timer1 configuration structure
+ * @param overflows: Pointer to store the overflows counted by TMR1_ISR
+ * @param count: Pointer to store the 16-bit count read with it
+ * @retval E_OK on success, E_NOT_OK on invalid parameters
+ *
+ * @note
+ * Taken with interrupts masked : an overflow whose ISR is still pending
+ * (flag set , count already wrapped) is added to the returned overflows ,
+ * so the pair never steps back , even when called from another ISR.
+ * The count is only monotonic with a zero preload (free-running timer).
+ */
+Std_ReturnType timer1_Read_Extended(const timer1_t * timer , uint32 * overflows , uint16 * count);
+#endif
+
 #endif	/* TIMER1_H */
 
 
@@ -0,0 +1,61 @@
+/**
+ * @file    timer1_CFG.h
+ * @brief   Timer1 Driver Configuration File
+ * @author  Abdelmoniem Ahmed
+ *
+ * @details
+ * Compile-time configuration for fixed hardware : with
+ * TIMER1_STATIC_CFG_ENABLE the driver takes the settings below instead of
+ * the timer1_t fields , timer1_init() compiles to straight register writes
+ * and TMR1_ISR() to a constant reload.
+ *
+ * The timer1_t object still provides the interrupt handler , its other
+ * fields are ignored.
+ *
+ * Target MCU: PIC18F4620
+ */
+
+#ifndef TIMER1_CFG_H
+#define	TIMER1_CFG_H
+
+/* Section : Includes */
+
+
+/* Section : Macro Declaration */
+
+/* Static Configuration Options */
+#define TIMER1_STATIC_CFG_DISABLED          0X00
+#define TIMER1_STATIC_CFG_ENABLED           0X01
+
+/**
+ * @brief Select where the Timer1 settings come from
+ *  - TIMER1_STATIC_CFG_DISABLED : timer1_t object (runtime)
+ *  - TIMER1_STATIC_CFG_ENABLED  : macros below
+ */
+#define TIMER1_STATIC_CFG_ENABLE            (TIMER1_STATIC_CFG_DISABLED)
+
+/**
+ * @brief Static settings , same values as the timer1_t fields
+ *  - TIMER1_STATIC_CFG_PRESCALER    : 0 (div 1) .. 3 (div 8) , timer1_prescaler_select_t
+ *  - TIMER1_STATIC_CFG_MODE         : TIMER1_TIMER_MODE_CFG / TIMER1_COUNTER_MODE_CFG
+ *  - TIMER1_STATIC_CFG_COUNTER_MODE : TIMER1_SYNC_COUNTER_MODE_CFG / TIMER1_ASYNC_COUNTER_MODE_CFG
+ *  - TIMER1_STATIC_CFG_OSC          : TIMER1_OSC_ENABLE / TIMER1_OSC_DISABLE
+ *  - TIMER1_STATIC_CFG_PRELOAD      : Reload value , 0 = free-running
+ */
+#define TIMER1_STATIC_CFG_PRESCALER         0X00
+#define TIMER1_STATIC_CFG_MODE              0X00
+#define TIMER1_STATIC_CFG_COUNTER_MODE      0X00
+#define TIMER1_STATIC_CFG_OSC               0X00
+#define TIMER1_STATIC_CFG_PRELOAD           0U
+
+
+/* Section : Macro Functions Declarations */
+
+
+/* Section : Data Types Declarations */
+
+
+/* Section : Function Declarations */
+
+
+#endif	/* TIMER1_CFG_H */
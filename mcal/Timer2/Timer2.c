@@ -37,6 +37,22 @@ static uint8 timer2_preloaded = ZERO_INIT;
     static void (* TMR2_InterruptHandler ) (void) = NULL;
 #endif
 
+/**
+ * @brief Configuration Timer2 was last initialized with
+ * @details Lets a repeated timer2_init() with the same settings return at once.
+ *          Owned by timer2_init only , the tick overrides live in the ISR
+ *          handler and T2CON , so a running tick survives a repeated init.
+ */
+static timer2_t timer2_active_cfg;
+static uint8 timer2_configured = 0;
+
+/* Section : Private (Static) Functions */
+
+/**
+ * @brief Tell whether Timer2 already runs with this configuration
+ */
+static uint8 timer2_Is_Configured(const timer2_t * timer);
+
 /* Section : Function Definitions */
     
 Std_ReturnType timer2_init(const timer2_t * timer){
@@ -44,6 +60,9 @@ Std_ReturnType timer2_init(const timer2_t * timer){
     if(NULL == timer){
         ret = E_NOT_OK ;
     }
+    else if(timer2_Is_Configured(timer)){
+        /* Already running with these settings : nothing to redo */
+    }
     else{
         TIMER2_DISABLE();
         
@@ -56,23 +75,11 @@ Std_ReturnType timer2_init(const timer2_t * timer){
 #if   TIMER2_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
             TIMER2_INTERRUPT_CLEAR_FLAG();
             TMR2_InterruptHandler = timer->TMR_InterruptHandler ;
-#if   INTERRUPT_PRIORITY_LEVELS_ENABLE  ==  INTERRUPT_FEATURE_ENABLE
-            if(Interrupt_High_Priority == timer->priority){
-                TIMER2_INTERRUPT_HIGH_PRIORITY();
-                INTERRUPT_GlobalInterruptHighEnable();
-            }
-            else{
-                TIMER2_INTERRUPT_LOW_PRIORITY();
-                INTERRUPT_GlobalInterruptLowEnable();
-            }
-                INTERRUPT_PriorityFeatureEnable();
-#else
-            INTERRUPT_GlobalInterruptEnable();
-            INTERRUPT_PeripheralInterruptEnable();        
-#endif
             TIMER2_INTERRUPT_ENABLE();
 #endif 
             TIMER2_ENABLE();
+        timer2_active_cfg = *timer ;
+        timer2_configured = 1 ;
     }
     return ret;
 }
@@ -87,6 +94,7 @@ Std_ReturnType timer2_Deinit(const timer2_t * timer){
 #if  TIMER2_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
         TIMER2_INTERRUPT_DISABLE();
 #endif        
+        timer2_configured = 0 ;
     }
     return ret;
 }
@@ -113,6 +121,54 @@ Std_ReturnType timer2_Write_Value(const timer2_t * timer , uint8 data){
     return ret;
 }
 
+#if   TIMER2_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+Std_ReturnType timer2_Tick_Start(timer2_postscaler_select_t postscaler , void (* tick)(void)){
+    Std_ReturnType ret = E_OK;
+    if((NULL == tick) || (timer2_postscaler_div_16 < postscaler)){
+        ret = E_NOT_OK;
+    }
+    else{
+        TIMER2_INTERRUPT_DISABLE();
+        T2CONbits.TOUTPS = postscaler ;
+        TMR2_InterruptHandler = tick ;
+        TIMER2_INTERRUPT_CLEAR_FLAG();
+        TIMER2_INTERRUPT_ENABLE();
+    }
+    return ret;
+}
+
+Std_ReturnType timer2_Tick_Stop(void){
+    Std_ReturnType ret = E_OK;
+    TIMER2_INTERRUPT_DISABLE();
+    if(1 == timer2_configured){
+        /* Back to the timer2_init settings : postscaler and callback */
+        T2CONbits.TOUTPS = timer2_active_cfg.postscaler_division ;
+        TMR2_InterruptHandler = timer2_active_cfg.TMR_InterruptHandler ;
+        TIMER2_INTERRUPT_CLEAR_FLAG();
+        TIMER2_INTERRUPT_ENABLE();
+    }
+    else{
+        TMR2_InterruptHandler = NULL ;
+    }
+    return ret;
+}
+#endif
+
+static uint8 timer2_Is_Configured(const timer2_t * timer){
+    uint8 l_same = 0;
+    if((1 == timer2_configured) && (TIMER2_ENABLE_CFG == T2CONbits.TMR2ON) &&
+       (timer2_active_cfg.prescaler_division == timer->prescaler_division) &&
+       (timer2_active_cfg.postscaler_division == timer->postscaler_division) &&
+#if   TIMER2_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+       (timer2_active_cfg.TMR_InterruptHandler == timer->TMR_InterruptHandler) &&
+#endif
+       (timer2_active_cfg.preloaded_value == timer->preloaded_value)){
+        l_same = 1;
+    }
+    else{ /* Nothing */ }
+    return l_same;
+}
+
 
 /**
  * @brief Timer2 Overflow Interrupt Service Routine
@@ -121,7 +177,7 @@ Std_ReturnType timer2_Write_Value(const timer2_t * timer , uint8 data){
  * Called automatically on Timer2 overflow. Performs the following:
  *  - Clears Timer2 interrupt flag
  *  - Executes user-defined callback (if assigned)
- *  - Reloads Timer2 with the preloaded value to maintain precise timing
+ *  - Reloads Timer2 with a non-zero preloaded value
  */
 
 #if  TIMER2_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
@@ -130,6 +186,9 @@ void TMR2_ISR(void){
     if(TMR2_InterruptHandler){
         TMR2_InterruptHandler();
     }
-    TMR2 = timer2_preloaded ;
+    if(ZERO_INIT != timer2_preloaded){
+        TMR2 = timer2_preloaded ;
+    }
+    else{ /* PR2 match reset only , PWM period untouched */ }
 }
 #endif
@@ -38,6 +38,13 @@
 #define TIMER2_ENABLE()                         (T2CONbits.TMR2ON = TIMER2_ENABLE_CFG)
 #define TIMER2_DISABLE()                        (T2CONbits.TMR2ON = TIMER2_DISABLE_CFG)
 
+/*
+ * Tick period in us : 4 / Fosc * prescaler * (PR2 + 1) * postscaler
+ * _PRESCALER and _POSTSCALER are division values (1 / 4 / 16 , 1..16)
+ */
+#define TIMER2_TICK_PERIOD_US(_PRESCALER , _PR2 , _POSTSCALER) \
+    ((4UL * (_PRESCALER) * ((uint32)(_PR2) + 1UL) * (_POSTSCALER)) / ((_XTAL_FREQ) / 1000000UL))
+
 /* Section : Data Types Declarations */
 
 /**
@@ -92,19 +99,17 @@ typedef enum{
  *  - Select prescaler and postscaler values
  *  - Provide a preload value for precise timing intervals
  *  - Assign a callback function for interrupt-driven execution (optional)
- *  - Specify interrupt priority if priority levels are enabled
  *
  * @note
  * The preload value is reloaded automatically on every Timer2 overflow.
+ * A zero preload is never rewritten : TMR2 keeps resetting on the PR2
+ * match , as the PWM time base requires.
  */
 typedef struct{
     timer2_prescaler_select_t prescaler_division ;
     timer2_postscaler_select_t postscaler_division ; 
 #if   TIMER2_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
     void (* TMR_InterruptHandler) (void);
-#if INTERRUPT_PRIORITY_LEVELS_ENABLE  ==  INTERRUPT_FEATURE_ENABLE
-    INTERRUPT_Priority_cfg priority;
-#endif
 #endif 
     uint8 preloaded_value ;
 }timer2_t;
@@ -119,11 +124,14 @@ typedef struct{
  *  - Prescaler and postscaler values
  *  - Preload value for periodic timing
  *  - Optional interrupt with callback function
- *  - Optional interrupt priority if enabled
  *
  * The Timer2 counter is disabled during initialization to prevent spurious counts.
- * If interrupts are enabled, the callback is assigned and the global/peripheral
- * interrupts are configured according to the selected priority.
+ * If interrupts are enabled, the callback is assigned and the Timer2 interrupt
+ * is enabled. Its priority comes from the priority map and global interrupts
+ * are enabled by Interrupt_Manager_Global_Enable().
+ *
+ * Calling it again with the same configuration while Timer2 runs does
+ * nothing : the count , the PWM period and the tick are not restarted.
  *
  * @param timer Pointer to a `timer2_t` configuration structure
  * @retval E_OK     Initialization was successful
@@ -173,5 +181,33 @@ Std_ReturnType timer2_Read_Value(const timer2_t * timer , uint8 * time);
  */
 Std_ReturnType timer2_Write_Value(const timer2_t * timer , uint8 data);
 
+#if   TIMER2_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+/**
+ * @brief Start a periodic tick on the running Timer2
+ *
+ * @details
+ * Sets the postscaler and the callback , then enables the Timer2
+ * interrupt , without stopping or reloading the timer. Timer2 can so be
+ * the PWM time base (prescaler , PR2 set by CCP) and the system tick :
+ * the callback runs every postscaler PR2 matches
+ * (TIMER2_TICK_PERIOD_US).
+ * The timer2_init configuration is not changed : a later timer2_init
+ * with the same settings keeps the tick running.
+ *
+ * @param postscaler PR2 matches per tick
+ * @param tick       Callback , runs in the Timer2 ISR
+ * @retval E_OK     Tick running
+ * @retval E_NOT_OK Null callback or invalid postscaler
+ */
+Std_ReturnType timer2_Tick_Start(timer2_postscaler_select_t postscaler , void (* tick)(void));
+
+/**
+ * @brief Stop the periodic tick , Timer2 keeps running
+ * @details The postscaler and callback of the last timer2_init are restored.
+ * @retval E_OK Tick stopped
+ */
+Std_ReturnType timer2_Tick_Stop(void);
+#endif
+
 
 #endif	/* HAL_TIMER2_H */
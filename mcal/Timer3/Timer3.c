@@ -32,6 +32,11 @@ static uint16 timer3_preload = ZERO_INIT;
  */
 #if   TIMER3_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE 
     static void (* TMR3_InterruptHandler ) (void) = NULL;
+
+/**
+ * @brief Overflows since initialization , read by timer3_Read_Extended().
+ */
+    static volatile uint32 timer3_overflows = ZERO_INIT;
 #endif
 
         /* Section : Private (Static) Functions */
@@ -65,20 +70,7 @@ Std_ReturnType timer3_init(const timer3_t * timer){
 #if  TIMER3_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
         TIMER3_INTERRUPT_CLEAR_FLAG();
         TMR3_InterruptHandler = timer->TMR_InterruptHandler ;
-#if INTERRUPT_PRIORITY_LEVELS_ENABLE  ==  INTERRUPT_FEATURE_ENABLE
-        if(Interrupt_High_Priority == timer->priority){
-            TIMER3_INTERRUPT_HIGH_PRIORITY();
-            INTERRUPT_GlobalInterruptHighEnable();
-        }
-        else{
-            TIMER3_INTERRUPT_LOW_PRIORITY();
-            INTERRUPT_GlobalInterruptLowEnable();
-        }
-        INTERRUPT_PriorityFeatureEnable();
-#else
-        INTERRUPT_GlobalInterruptEnable();
-        INTERRUPT_PeripheralInterruptEnable();
-#endif
+        timer3_overflows = ZERO_INIT;
         TIMER3_INTERRUPT_ENABLE();
 #endif        
         timer3_preload = timer->timer3_preloaded_value;
@@ -119,14 +111,14 @@ Std_ReturnType timer3_Deinit(const timer3_t * timer){
  */
 Std_ReturnType timer3_Read_Value(const timer3_t * timer , uint16 * time){
     Std_ReturnType ret = E_OK;
-    uint8 l_tmr1l = ZERO_INIT , l_tmr1h = ZERO_INIT ;    
+    uint8 l_tmr3l = ZERO_INIT , l_tmr3h = ZERO_INIT ;    
     if((NULL == timer) || (NULL == time)){
         ret = E_NOT_OK;
     }
     else{
-        l_tmr1l = TMR1L;
-        l_tmr1h = TMR1H;
-        *time = ( (uint16) ( (l_tmr1h << 8) + l_tmr1l ) );
+        l_tmr3l = TMR3L;
+        l_tmr3h = TMR3H;
+        *time = ( (uint16) ( (l_tmr3h << 8) + l_tmr3l ) );
     }
     return ret ;
 }
@@ -150,6 +142,34 @@ Std_ReturnType timer3_Write_Value(const timer3_t * timer , uint16 data){
     return ret ;
 }
 
+#if  TIMER3_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+Std_ReturnType timer3_Read_Extended(const timer3_t * timer , uint32 * overflows , uint16 * count){
+    Std_ReturnType ret = E_OK;
+    uint8 l_gie = ZERO_INIT;
+    uint8 l_tmr3l = ZERO_INIT , l_tmr3h = ZERO_INIT ;
+    uint32 l_overflows = ZERO_INIT;
+    if((NULL == timer) || (NULL == overflows) || (NULL == count)){
+        ret = E_NOT_OK;
+    }
+    else{
+        l_gie = INTCONbits.GIE;
+        INTCONbits.GIE = 0;
+        l_overflows = timer3_overflows;
+        l_tmr3l = TMR3L;
+        l_tmr3h = TMR3H;
+        /* Wrapped before the read but not serviced yet : count it here */
+        if((PIR2bits.TMR3IF) && (0x80 > l_tmr3h)){
+            l_overflows++;
+        }
+        else{ /* Nothing */ }
+        INTCONbits.GIE = l_gie;
+        *overflows = l_overflows;
+        *count = ( (uint16) ( (l_tmr3h << 8) + l_tmr3l ) );
+    }
+    return ret ;
+}
+#endif
+
 /**
  * @brief Configure Timer3 Timer/Counter mode
  * @param timer Pointer to Timer3 configuration structure
@@ -172,16 +192,24 @@ static void timer3_Timer_OR_Counter_Mode_Set(const timer3_t * timer){
 }
 
 
+#if  TIMER3_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
 /**
  * @brief Timer3 overflow ISR
- * @details Clears the interrupt flag, executes user callback if defined,
- *          and reloads the Timer3 preload value.
+ * @details Clears the interrupt flag, counts the overflow, executes user
+ *          callback if defined, and reloads the Timer3 preload value.
+ *          A zero preload is not rewritten : the timer keeps free-running
+ *          and no count is lost to the ISR latency.
  */
 void TMR3_ISR(void){
     TIMER3_INTERRUPT_CLEAR_FLAG();
+    timer3_overflows++;
     if(TMR3_InterruptHandler){
         TMR3_InterruptHandler();
     }
-    TMR3H = ((uint8)(timer3_preload >> 8 )) ;
-    TMR3L = ((uint8)(timer3_preload));
+    if(ZERO_INIT != timer3_preload){
+        TMR3H = ((uint8)(timer3_preload >> 8 )) ;
+        TMR3L = ((uint8)(timer3_preload));
+    }
+    else{ /* Free-running */ }
 }
+#endif
@@ -103,10 +103,6 @@ typedef struct {
 
 #if TIMER3_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
     void (*TMR_InterruptHandler)(void); /**< Pointer to user callback executed in ISR */
-
-#if INTERRUPT_PRIORITY_LEVELS_ENABLE == INTERRUPT_FEATURE_ENABLE
-    INTERRUPT_Priority_cfg priority; /**< Interrupt priority configuration (high or low) */
-#endif
 #endif
 
     timer3_prescaler_select_t prescaler_division; /**< Input clock prescaler selection */
@@ -161,4 +157,21 @@ Std_ReturnType timer3_Read_Value(const timer3_t * timer , uint16 * time);
  */
 Std_ReturnType timer3_Write_Value(const timer3_t * timer , uint16 data);
 
+#if  TIMER3_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+/**
+ * @brief Read a coherent (overflow count , timer count) pair
+ * @param timer: Pointer to Timer3 configuration structure
+ * @param overflows: Pointer to store the overflows counted by TMR3_ISR
+ * @param count: Pointer to store the 16-bit count read with it
+ * @retval E_OK on success, E_NOT_OK on invalid parameters
+ *
+ * @note
+ * Taken with interrupts masked : an overflow whose ISR is still pending
+ * (flag set , count already wrapped) is added to the returned overflows ,
+ * so the pair never steps back , even when called from another ISR.
+ * The count is only monotonic with a zero preload (free-running timer).
+ */
+Std_ReturnType timer3_Read_Extended(const timer3_t * timer , uint32 * overflows , uint16 * count);
+#endif
+
 #endif	/* HAL_TIMER3_H */
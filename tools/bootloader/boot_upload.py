@@ -0,0 +1,264 @@
+#!/usr/bin/env python3
+"""
+@file    boot_upload.py
+@brief   Host side of the bootloader/ serial protocol
+
+@details
+Reads the Intel HEX of an application linked with --codeoffset above the
+boot block and programs it through the bootloader :
+
+    INFO   until the bootloader answers (reset the board meanwhile)
+    ERASE  the rows up to the last one of the image
+    BLOCK  ... BLOCK_SYNC , one window at a time , go-back-N on a lost block
+    RUN    writes the reset vector row and starts the application
+
+Frames ( host -> bootloader ) :
+    | 0x55 | cmd | seq | arg H | arg L | 64 data (B / S) | CRC H | CRC L |
+Replies ( bootloader -> host ) :
+    | 0xAA | status | next seq | version | window | row H | row L | CRC H | CRC L |
+
+The CRC is CRC-16-CCITT , init 0xFFFF , over cmd .. data (status .. row).
+Rows that stay erased (all 0xFF) are not sent. Records above the program
+flash (configuration words , EEPROM) are ignored.
+
+Usage :
+    python3 tools/bootloader/boot_upload.py /dev/ttyUSB0 app.hex
+            [--baud 115200] [--wait 30] [--retries 5] [--no-run]
+
+Needs pyserial.
+
+Layer: Tools
+Target MCU: PIC18F4620
+
+Author: Abdelmoniem Ahmed
+Linkedin: https://www.linkedin.com/in/abdelmoniem-ahmed/
+Date: 2026
+"""
+
+import argparse
+import binascii
+import sys
+import time
+
+FLASH_SIZE = 0x10000
+ROW_SIZE = 64
+
+FRAME_SYNC = 0x55
+REPLY_SYNC = 0xAA
+REPLY_SIZE = 9
+
+CMD_INFO = ord('I')
+CMD_ERASE = ord('E')
+CMD_BLOCK = ord('B')
+CMD_BLOCK_SYNC = ord('S')
+CMD_RUN = ord('R')
+
+STATUS_OK = 0x00
+STATUS_FRAME = 0x01
+STATUS_NAMES = {
+    0x00: 'ok',
+    0x01: 'block lost',
+    0x02: 'row out of range',
+    0x03: 'verify failed',
+    0x04: 'no application',
+    0x05: 'unknown command',
+}
+
+# Flash cycles on the target , with margin
+ROW_CYCLE_S = 0.006
+REPLY_MARGIN_S = 0.25
+
+
+class UploadError(Exception):
+    pass
+
+
+def crc16(data):
+    return binascii.crc_hqx(bytes(data), 0xFFFF)
+
+
+def read_hex(path):
+    """Map row number -> 64-byte bytearray , erased bytes are 0xFF."""
+    rows = {}
+    base = 0
+    with open(path, encoding='ascii') as image:
+        for number, line in enumerate(image, 1):
+            line = line.strip()
+            if not line:
+                continue
+            if not line.startswith(':'):
+                raise UploadError('%s:%d: not an Intel HEX record' % (path, number))
+            record = bytes.fromhex(line[1:])
+            if len(record) < 5 or len(record) != record[0] + 5 or sum(record) & 0xFF:
+                raise UploadError('%s:%d: bad record length or checksum' % (path, number))
+            kind = record[3]
+            payload = record[4:-1]
+            if kind == 0x00:
+                address = base + ((record[1] << 8) | record[2])
+                for offset, value in enumerate(payload):
+                    where = address + offset
+                    if where >= FLASH_SIZE:
+                        continue
+                    row = rows.setdefault(where // ROW_SIZE, bytearray(b'\xff' * ROW_SIZE))
+                    row[where % ROW_SIZE] = value
+            elif kind == 0x01:
+                break
+            elif kind == 0x02:
+                base = ((payload[0] << 8) | payload[1]) << 4
+            elif kind == 0x04:
+                base = ((payload[0] << 8) | payload[1]) << 16
+            else:
+                # 03 / 05 : start address , meaningless on a PIC18
+                pass
+    return {row: data for row, data in rows.items() if data != b'\xff' * ROW_SIZE}
+
+
+class Bootloader:
+    """One serial link to the bootloader , `link` is a pyserial-like port."""
+
+    def __init__(self, link, baud, verbose=False):
+        self.link = link
+        self.byte_time = 10.0 / baud
+        self.verbose = verbose
+        self.window = 1
+        self.first_row = 0
+        self.version = 0
+
+    def send(self, command, sequence, argument=0, data=b''):
+        body = bytes([command, sequence & 0xFF, (argument >> 8) & 0xFF, argument & 0xFF]) + bytes(data)
+        self.link.write(bytes([FRAME_SYNC]) + body + crc16(body).to_bytes(2, 'big'))
+
+    def receive(self, timeout):
+        """Next valid reply as (status , next seq) , None on timeout."""
+        deadline = time.monotonic() + timeout
+        reply = b''
+        while time.monotonic() < deadline:
+            reply += self.link.read(REPLY_SIZE - len(reply)) or b''
+            while reply and reply[0] != REPLY_SYNC:
+                reply = reply[1:]
+            if len(reply) < REPLY_SIZE:
+                continue
+            if crc16(reply[1:7]) == int.from_bytes(reply[7:9], 'big'):
+                self.version = reply[3]
+                self.window = max(1, reply[4])
+                self.first_row = (reply[5] << 8) | reply[6]
+                return reply[1], reply[2]
+            reply = reply[1:]
+        return None
+
+    def transfer(self, command, sequence, argument=0, data=b'', timeout=REPLY_MARGIN_S):
+        self.link.reset_input_buffer()
+        self.send(command, sequence, argument, data)
+        return self.receive(timeout)
+
+    def frame_time(self, payload):
+        return (8 + payload) * self.byte_time
+
+    def connect(self, wait):
+        deadline = time.monotonic() + wait
+        while time.monotonic() < deadline:
+            if self.transfer(CMD_INFO, 0, timeout=0.1) is not None:
+                return
+        raise UploadError('no bootloader answer within %.0f s' % wait)
+
+    def erase(self, row_count):
+        timeout = REPLY_MARGIN_S + row_count * ROW_CYCLE_S
+        reply = self.transfer(CMD_ERASE, 0, row_count, timeout=timeout)
+        if reply is None:
+            raise UploadError('erase : no answer')
+        if reply[0] != STATUS_OK:
+            raise UploadError('erase : %s' % STATUS_NAMES.get(reply[0], reply[0]))
+
+    def program(self, blocks, retries, progress):
+        """Send (row , data) blocks , the window in flight is resent from the acknowledged sequence."""
+        base = 0
+        failures = 0
+        while base < len(blocks):
+            window = blocks[base:base + self.window]
+            self.link.reset_input_buffer()
+            for index, (row, data) in enumerate(window):
+                command = CMD_BLOCK_SYNC if index == len(window) - 1 else CMD_BLOCK
+                self.send(command, base + index, row, data)
+            timeout = REPLY_MARGIN_S + len(window) * (self.frame_time(ROW_SIZE) + 2 * ROW_CYCLE_S)
+            reply = self.receive(timeout)
+            if reply is None:
+                status, taken = STATUS_FRAME, 0
+            else:
+                status, taken = reply[0], (reply[1] - base) & 0xFF
+                if taken > len(window):
+                    raise UploadError('acknowledge beyond the window sent')
+            base += taken
+            if status not in (STATUS_OK, STATUS_FRAME):
+                row = blocks[base][0] if base < len(blocks) else blocks[-1][0]
+                raise UploadError('row 0x%04X : %s' % (row * ROW_SIZE, STATUS_NAMES.get(status, status)))
+            if status != STATUS_OK and self.verbose:
+                print('window resent from block %d' % base, file=sys.stderr)
+            # A window that moved the acknowledge on is progress , only a stuck block counts
+            failures = 0 if taken else failures + 1
+            if failures > retries:
+                raise UploadError('block %d lost %d times' % (base, failures))
+            progress(base, len(blocks))
+
+    def run(self):
+        reply = self.transfer(CMD_RUN, 0, timeout=REPLY_MARGIN_S + ROW_CYCLE_S * 2)
+        if reply is None:
+            raise UploadError('run : no answer')
+        if reply[0] != STATUS_OK:
+            raise UploadError('run : %s' % STATUS_NAMES.get(reply[0], reply[0]))
+
+
+def upload(loader, rows, wait=30.0, retries=5, start=True, quiet=False):
+    def progress(done, total):
+        if not quiet:
+            print('\r%5d / %d rows' % (done, total), end='', file=sys.stderr, flush=True)
+
+    loader.connect(wait)
+    below = [row for row in rows if row < loader.first_row]
+    if below:
+        raise UploadError('image has code below 0x%04X , link it with --codeoffset=0x%X'
+                          % (loader.first_row * ROW_SIZE, loader.first_row * ROW_SIZE))
+    if loader.first_row not in rows:
+        raise UploadError('image has no reset vector at 0x%04X' % (loader.first_row * ROW_SIZE))
+    if not quiet:
+        print('bootloader v%d , window %d , application at 0x%04X'
+              % (loader.version, loader.window, loader.first_row * ROW_SIZE), file=sys.stderr)
+
+    started = time.monotonic()
+    loader.erase(max(rows) - loader.first_row + 1)
+    blocks = sorted(rows.items())
+    loader.program(blocks, retries, progress)
+    if start:
+        loader.run()
+    if not quiet:
+        print('\n%d rows in %.1f s%s' % (len(blocks), time.monotonic() - started,
+                                          ' , application started' if start else ''), file=sys.stderr)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Program an application through the serial bootloader.')
+    parser.add_argument('port', help='serial device , e.g. /dev/ttyUSB0 or COM3')
+    parser.add_argument('hexfile', help='Intel HEX of the application')
+    parser.add_argument('--baud', type=int, default=115200)
+    parser.add_argument('--wait', type=float, default=30.0, help='seconds to wait for the bootloader')
+    parser.add_argument('--retries', type=int, default=5, help='resends of one window before giving up')
+    parser.add_argument('--no-run', action='store_true', help='leave the reset vector row unwritten')
+    parser.add_argument('--verbose', action='store_true')
+    args = parser.parse_args()
+
+    try:
+        import serial
+    except ImportError:
+        sys.exit('boot_upload.py needs pyserial : pip install pyserial')
+
+    try:
+        rows = read_hex(args.hexfile)
+        if not rows:
+            raise UploadError('%s has no program flash data' % args.hexfile)
+        with serial.Serial(args.port, args.baud, timeout=0.01) as link:
+            upload(Bootloader(link, args.baud, args.verbose), rows, args.wait, args.retries, not args.no_run)
+    except (UploadError, OSError) as error:
+        sys.exit('boot_upload.py: %s' % error)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,464 @@
+#!/usr/bin/env python3
+"""
+@file    footprint_report.py
+@brief   Per-module RAM / flash footprint of every configuration option
+
+@details
+Builds the whole tree with XC8 once per configuration, reads the linker
+map file of each build and prints per-module RAM and flash tables, plus
+the cost of every option against the shipped configuration.
+
+Options are read from the configuration headers, nothing is hard coded :
+ - mcal/Interrupt/mcal_interrupt_gen_cfg.h : every *_FEATURE_ENABLE and
+   INTERRUPT_* flag , and SMART_HOME_NODE (master / slave build)
+ - mcal/CCP/CCP_CFG.h                      : CCP1 / CCP2 capture , compare , PWM
+ - mcal/GPIO/hal_gpio_cfg.h                : every CONFIG_ENABLE / CONFIG_DISABLE flag
+
+Modes :
+ - single (default) : shipped configuration , then each option changed
+                      alone (one build per alternative value)
+ - full             : every combination of the selected options
+                      (use --only to keep the product small)
+
+Symbols are attributed to the source file that defines them (functions ,
+file-scope and function-local statics , compiled-stack autos). Symbols
+from the C runtime and the libraries are reported as "(runtime)".
+
+Usage :
+    python3 tools/footprint/footprint_report.py [--mode single|full]
+            [--only FLAG ...] [--by-file] [-j N] [--xc8 PATH]
+            [--output report.md] [--keep] [--dry-run]
+
+Layer: Tools
+Target MCU: PIC18F4620
+
+Author: Abdelmoniem Ahmed
+Linkedin: https://www.linkedin.com/in/abdelmoniem-ahmed/
+Date: 2026
+"""
+
+import argparse
+import concurrent.futures
+import itertools
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+
+REPO_ROOT = os.path.abspath(os.path.join(os.path.dirname(__file__), '..', '..'))
+MCU = '18F4620'
+RAM_SIZE = 3968             # PIC18F4620 general purpose RAM (bytes)
+FLASH_SIZE = 65536          # PIC18F4620 program memory (bytes)
+
+# bootloader/ is its own image (second main() , vector PSECTs at 0x08 / 0x18)
+SKIP_DIRS = {'.git', 'tools', '_gate_build', '_host_build', 'nbproject', 'dist', 'build', 'bootloader'}
+RUNTIME_MODULE = '(runtime)'
+
+INTERRUPT_CFG = 'mcal/Interrupt/mcal_interrupt_gen_cfg.h'
+CCP_CFG = 'mcal/CCP/CCP_CFG.h'
+GPIO_CFG = 'mcal/GPIO/hal_gpio_cfg.h'
+
+# Binary flags : (header , value pair) , every matching #define is an option
+BINARY_FLAGS = [
+    (INTERRUPT_CFG, ('INTERRUPT_FEATURE_ENABLE', 'INTERRUPT_FEATURE_DISABLE')),
+    (GPIO_CFG, ('CONFIG_ENABLE', 'CONFIG_DISABLE')),
+]
+
+# Multi-valued options : (header , macro , alternatives)
+CHOICE_OPTIONS = [
+    (INTERRUPT_CFG, 'SMART_HOME_NODE', ('SMART_HOME_MASTER_BUILD', 'SMART_HOME_SLAVE_BUILD')),
+    (CCP_CFG, 'CCP1_CFG_SELECTED_MODE', ('(CCP_CFG_CAPTURE_MODE_SELECTED)',
+                                         '(CCP_CFG_COMPARE_MODE_SELECTED)',
+                                         '(CCP_CFG_PWM_MODE_SELECTED)')),
+    (CCP_CFG, 'CCP2_CFG_SELECTED_MODE', ('(CCP_CFG_CAPTURE_MODE_SELECTED)',
+                                         '(CCP_CFG_COMPARE_MODE_SELECTED)',
+                                         '(CCP_CFG_PWM_MODE_SELECTED)')),
+]
+
+# Value used by the single mode to flip a binary flag (per #define , so the
+# node-dependent MSSP_I2C_INTERRUPT_FEATURE_ENABLE keeps one value per node)
+FLIP = '!'
+
+
+# ---------------------------------------------------------------- options
+
+class Option:
+    def __init__(self, header, name, values, shipped):
+        self.header = header
+        self.name = name
+        self.values = values        # allowed values , FLIP for binary flags
+        self.shipped = shipped      # value(s) found in the header
+
+
+def read_options():
+    """Collect every configuration option from the headers."""
+    options = []
+    for header, pair in BINARY_FLAGS:
+        text = open(os.path.join(REPO_ROOT, header)).read()
+        found = {}
+        pattern = r'^\s*#define\s+(\w+)\s+(%s|%s)\s*$' % pair
+        for match in re.finditer(pattern, text, re.M):
+            found.setdefault(match.group(1), []).append(match.group(2))
+        for name, shipped in found.items():
+            options.append(Option(header, name, pair, shipped))
+    for header, name, values in CHOICE_OPTIONS:
+        text = open(os.path.join(REPO_ROOT, header)).read()
+        match = re.search(r'^\s*#define\s+%s\s+(.+?)\s*$' % name, text, re.M)
+        if match:
+            options.append(Option(header, name, values, [match.group(1)]))
+    return options
+
+
+def configurations(options, mode, only):
+    """List of (label , {option name : value}) , the shipped one first."""
+    selected = [o for o in options if not only or o.name in only]
+    configs = [('shipped', {})]
+    if 'single' == mode:
+        for option in selected:
+            if option.values in [pair for _, pair in BINARY_FLAGS]:
+                configs.append(('%s flipped' % option.name, {option.name: FLIP}))
+            else:
+                for value in option.values:
+                    if value != option.shipped[0]:
+                        configs.append(('%s = %s' % (option.name, value.strip('()')),
+                                        {option.name: value}))
+    else:
+        axes = [[(o.name, v) for v in o.values] for o in selected]
+        for combo in itertools.product(*axes):
+            label = ' , '.join('%s=%s' % (n, v.strip('()')) for n, v in combo)
+            configs.append((label, dict(combo)))
+    return configs
+
+
+def patch_tree(tree, options, settings):
+    """Rewrite the configuration headers of a tree copy."""
+    by_name = {o.name: o for o in options}
+    for name, value in settings.items():
+        option = by_name[name]
+        path = os.path.join(tree, option.header)
+        text = open(path).read()
+
+        def replace(match):
+            if FLIP == value:
+                low, high = option.values
+                new = high if match.group(2) == low else low
+            else:
+                new = value
+            return match.group(1) + new
+
+        text = re.sub(r'^(\s*#define\s+%s\s+)(.+?)\s*$' % name, replace, text, flags=re.M)
+        open(path, 'w').write(text)
+
+
+# ---------------------------------------------------------------- build
+
+def source_files(root):
+    sources, include_dirs = [], set()
+    for directory, dirs, files in os.walk(root):
+        dirs[:] = [d for d in dirs if d not in SKIP_DIRS]
+        for name in files:
+            if name.endswith('.c'):
+                sources.append(os.path.join(directory, name))
+            if name.endswith('.h'):
+                include_dirs.add(directory)
+    return sorted(sources), sorted(include_dirs)
+
+
+def copy_tree(destination):
+    def ignore(directory, names):
+        return [n for n in names if n in SKIP_DIRS or
+                (os.path.isfile(os.path.join(directory, n)) and not n.endswith(('.c', '.h')))]
+    shutil.copytree(REPO_ROOT, destination, ignore=ignore)
+
+
+def build(xc8, xc8_flags, options, label, settings, work_dir, keep):
+    """Build one configuration , returns a result dict."""
+    tree = tempfile.mkdtemp(prefix='footprint_', dir=work_dir)
+    source_tree = os.path.join(tree, 'src')
+    copy_tree(source_tree)
+    patch_tree(source_tree, options, settings)
+    sources, include_dirs = source_files(source_tree)
+    map_file = os.path.join(tree, 'footprint.map')
+    command = [xc8, '-mcpu=%s' % MCU, '-Wl,-Map=%s' % map_file,
+               '-o', os.path.join(tree, 'footprint.elf')]
+    command += ['-I%s' % d for d in include_dirs] + xc8_flags + sources
+    process = subprocess.run(command, cwd=tree, capture_output=True, text=True)
+    result = {'label': label, 'ok': 0 == process.returncode and os.path.exists(map_file),
+              'log': process.stdout + process.stderr, 'tree': tree}
+    if result['ok']:
+        result['symbols'] = parse_map(open(map_file, errors='replace').read())
+        result['totals'] = parse_summary(result['log'])
+    if not keep:
+        shutil.rmtree(tree, ignore_errors=True)
+    return result
+
+
+# ---------------------------------------------------------------- map file
+
+HEX = re.compile(r'^[0-9A-Fa-f]+$')
+SYMBOL_ENTRY = re.compile(r'(\S+)\s+([\w.]+)\s+([0-9A-Fa-f]{2,})\b')
+
+SPACE_FLASH = 0
+SPACE_RAM = 1
+
+
+def parse_map(text):
+    """
+    Sized symbols of an XC8 map : [(symbol , space , size)].
+
+    The psect table gives (link address , length , space) per psect ; the
+    symbol table gives (psect , address) per symbol. A symbol spans up to
+    the next symbol of its psect , or to the end of the psect.
+    """
+    head, _, symbol_table = text.partition('Symbol Table')
+    psects = {}
+    for line in head.splitlines():
+        # [object] psect link load length [selector] space scale
+        tokens = line.split()
+        numbers = 0
+        while numbers < len(tokens) and HEX.match(tokens[-1 - numbers]):
+            numbers += 1
+        if numbers not in (5, 6) or numbers == len(tokens):
+            continue
+        name = tokens[-1 - numbers]
+        fields = tokens[-numbers:]
+        if not re.match(r'^[A-Za-z_][\w.]*$', name) or name in ('Name', 'TOTAL'):
+            continue
+        link, length, space = int(fields[0], 16), int(fields[2], 16), int(fields[-2])
+        if length:
+            psects.setdefault(name, []).append((link, length, space))
+
+    placed = {}
+    for line in symbol_table.splitlines():
+        if line.strip() and not line.startswith((' ', '\t')) and 'Symbol Table' not in line:
+            if re.match(r'^[A-Z][A-Za-z ]+$', line.strip()):
+                break                       # next map section
+        for name, psect, value in SYMBOL_ENTRY.findall(line):
+            # __Lxxx / __Hxxx psect bounds would steal the size of the first symbol
+            if psect in psects and not name.startswith('__'):
+                placed.setdefault(psect, []).append((int(value, 16), name))
+
+    symbols = []
+    for psect, entries in placed.items():
+        for link, length, space in psects[psect]:
+            inside = sorted((a, n) for a, n in entries if link <= a < link + length)
+            for index, (address, name) in enumerate(inside):
+                later = [a for a, _ in inside[index + 1:] if a > address]
+                end = later[0] if later else link + length
+                # Aliases (?_f / ??_f at one address) : the size goes to the first one only
+                if index and inside[index - 1][0] == address:
+                    continue
+                symbols.append((name, space, end - address))
+    return symbols
+
+
+def parse_summary(log):
+    """Program / data totals printed by XC8 (include unattributed bytes)."""
+    totals = {}
+    for key, label in (('flash', r'Program space'), ('ram', r'Data space')):
+        match = re.search(label + r'\s+used\s+\w+h\s*\(\s*(\d+)\)', log)
+        if match:
+            totals[key] = int(match.group(1))
+    return totals
+
+
+# ---------------------------------------------------------------- attribution
+
+def strip_code(text):
+    """Source without comments , strings , char literals and directives."""
+    text = re.sub(r'/\*.*?\*/', ' ', text, flags=re.S)
+    text = re.sub(r'//[^\n]*', ' ', text)
+    text = re.sub(r'"(\\.|[^"\\])*"', '""', text)
+    text = re.sub(r"'(\\.|[^'\\])*'", "''", text)
+    text = re.sub(r'^\s*#(?:[^\n]*\\\n)*[^\n]*', ' ', text, flags=re.M)
+    return text
+
+
+def defined_names(text):
+    """Functions and file-scope variables defined by one translation unit."""
+    code = strip_code(text)
+    names, depth, chunk, index = set(), 0, '', 0
+    type_body = False           # Closing '}' ends a typedef / struct / enum body
+    while index < len(code):
+        char = code[index]
+        if 0 == depth and char in ';{':
+            statement = chunk.strip()
+            chunk = ''
+            words = statement.split()
+            skip = (not words) or words[0] in ('typedef', 'extern') or type_body
+            type_body = False
+            if '{' == char:
+                type_body = bool(words) and words[0] in ('typedef', 'struct', 'union', 'enum') \
+                    and '=' not in statement
+                # Function body , or the initializer / body of a declaration
+                params = re.search(r'(\w+)\s*\([^()]*(?:\([^()]*\)[^()]*)*\)\s*$', statement)
+                if params and '=' not in statement:
+                    names.add(params.group(1))
+                elif not skip and '=' in statement:
+                    names.update(declarators(statement))
+                depth = 1
+            elif not skip and not re.search(r'\w\s*\([^*]', statement.split('=')[0]):
+                names.update(declarators(statement))
+        elif char == '{':
+            depth += 1
+        elif char == '}':
+            depth = max(0, depth - 1)
+            if 0 == depth:
+                chunk = ''
+        elif 0 == depth:
+            chunk += char
+        index += 1
+    keywords = {'struct', 'union', 'enum', 'const', 'volatile', 'static', 'unsigned', 'signed'}
+    return {n for n in names if n not in keywords}
+
+
+def declarators(statement):
+    """Names declared by 'type a [= x] , (* b)(void) , c[4]'."""
+    statement = re.sub(r'=[^,]*', '', statement)
+    result = []
+    for part in statement.split(','):
+        pointer = re.search(r'\(\s*\*\s*(\w+)\s*\)', part)
+        plain = re.findall(r'(\w+)\s*(?:\[[^\]]*\]\s*)*$', part.strip())
+        if pointer:
+            result.append(pointer.group(1))
+        elif plain:
+            result.append(plain[0])
+    return result
+
+
+def symbol_owner(symbol):
+    """C name behind an XC8 symbol (_foo , ?_foo , ??_foo , foo@bar , _x$123)."""
+    if symbol.startswith('__'):
+        return None
+    if '@' in symbol:
+        return symbol.split('@', 1)[0].lstrip('?_')     # local bar of function foo
+    name = symbol.lstrip('?')
+    if name.startswith('_'):
+        return re.sub(r'\$\d+$', '', name[1:])
+    return None
+
+
+def module_map(by_file):
+    """C name -> module (directory or file) , ambiguous statics dropped."""
+    owners = {}
+    sources, _ = source_files(REPO_ROOT)
+    for path in sources:
+        relative = os.path.relpath(path, REPO_ROOT)
+        module = relative if by_file else (os.path.dirname(relative) or relative)
+        for name in defined_names(open(path, errors='replace').read()):
+            owners.setdefault(name, set()).add(module)
+    return {name: (modules.pop() if 1 == len(modules) else '(ambiguous)')
+            for name, modules in owners.items()}
+
+
+def per_module(symbols, owners):
+    table = {}
+    for symbol, space, size in symbols:
+        owner = symbol_owner(symbol)
+        module = owners.get(owner, RUNTIME_MODULE) if owner else RUNTIME_MODULE
+        ram, flash = table.get(module, (0, 0))
+        if SPACE_RAM == space:
+            ram += size
+        elif SPACE_FLASH == space:
+            flash += size
+        table[module] = (ram, flash)
+    return table
+
+
+# ---------------------------------------------------------------- report
+
+def totals_of(result, table):
+    ram = result['totals'].get('ram', sum(r for r, _ in table.values()))
+    flash = result['totals'].get('flash', sum(f for _, f in table.values()))
+    return ram, flash
+
+
+def report(results, owners):
+    lines = []
+    shipped = results[0]
+    if not shipped['ok']:
+        return 'Shipped configuration failed to build :\n\n' + shipped['log']
+
+    base = per_module(shipped['symbols'], owners)
+    base_ram, base_flash = totals_of(shipped, base)
+    lines.append('## Shipped configuration\n')
+    lines.append('| Module | RAM (bytes) | Flash (bytes) |')
+    lines.append('|--------|------------:|--------------:|')
+    for module, (ram, flash) in sorted(base.items(), key=lambda item: (-item[1][0], item[0])):
+        lines.append('| %s | %d | %d |' % (module, ram, flash))
+    lines.append('| **Total** | **%d / %d** | **%d / %d** |\n' % (base_ram, RAM_SIZE, base_flash, FLASH_SIZE))
+
+    lines.append('## Option cost (against the shipped configuration)\n')
+    lines.append('| Configuration | RAM | ΔRAM | Flash | ΔFlash | Modules changed |')
+    lines.append('|---------------|----:|-----:|------:|-------:|-----------------|')
+    for result in results[1:]:
+        if not result['ok']:
+            error = re.search(r'error[^\n]*', result['log'])
+            lines.append('| %s | - | - | - | - | build failed : %s |'
+                         % (result['label'], error.group(0) if error else 'see --keep'))
+            continue
+        table = per_module(result['symbols'], owners)
+        ram, flash = totals_of(result, table)
+        changed = []
+        for module in sorted(set(table) | set(base)):
+            now, then = table.get(module, (0, 0)), base.get(module, (0, 0))
+            if now != then:
+                changed.append('%s %+d/%+d' % (module, now[0] - then[0], now[1] - then[1]))
+        lines.append('| %s | %d | %+d | %d | %+d | %s |'
+                     % (result['label'], ram, ram - base_ram, flash, flash - base_flash,
+                        ' , '.join(changed) or '-'))
+    lines.append('\nModule deltas are RAM/flash bytes.')
+    return '\n'.join(lines) + '\n'
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('@details')[0].strip())
+    parser.add_argument('--mode', choices=('single', 'full'), default='single')
+    parser.add_argument('--only', nargs='+', default=[], help='restrict to these options')
+    parser.add_argument('--by-file', action='store_true', help='one row per .c file')
+    parser.add_argument('-j', '--jobs', type=int, default=os.cpu_count() or 1)
+    parser.add_argument('--xc8', default=os.environ.get('XC8', 'xc8-cc'))
+    parser.add_argument('--xc8-flags', default='-O2', help='extra compiler flags')
+    parser.add_argument('--output', help='write the markdown report to this file')
+    parser.add_argument('--keep', action='store_true', help='keep build trees and map files')
+    parser.add_argument('--dry-run', action='store_true', help='list configurations only')
+    args = parser.parse_args()
+
+    options = read_options()
+    unknown = set(args.only) - {o.name for o in options}
+    if unknown:
+        parser.error('unknown option(s) : %s' % ' '.join(sorted(unknown)))
+    configs = configurations(options, args.mode, args.only)
+    if args.dry_run:
+        for label, _ in configs:
+            print(label)
+        return 0
+    if shutil.which(args.xc8) is None:
+        parser.error('XC8 not found (%s) , use --xc8 or set XC8' % args.xc8)
+
+    work_dir = tempfile.mkdtemp(prefix='footprint_')
+    with concurrent.futures.ThreadPoolExecutor(max_workers=args.jobs) as pool:
+        futures = [pool.submit(build, args.xc8, args.xc8_flags.split(), options,
+                               label, settings, work_dir, args.keep)
+                   for label, settings in configs]
+        results = []
+        for index, future in enumerate(futures):
+            results.append(future.result())
+            print('[%d/%d] %s' % (index + 1, len(configs), configs[index][0]), file=sys.stderr)
+    if not args.keep:
+        shutil.rmtree(work_dir, ignore_errors=True)
+    else:
+        print('build trees kept in %s' % work_dir, file=sys.stderr)
+
+    text = report(results, module_map(args.by_file))
+    if args.output:
+        open(args.output, 'w').write(text)
+    else:
+        sys.stdout.write(text)
+    return 0 if results[0]['ok'] else 1
+
+
+if __name__ == '__main__':
+    sys.exit(main())
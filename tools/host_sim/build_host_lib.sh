@@ -0,0 +1,38 @@
+#!/bin/sh
+# Build the drivers against the host SFR model : _host_build/libhost_sim.a
+#
+# Usage : tools/host_sim/build_host_lib.sh [extra gcc flags]
+#   e.g.  tools/host_sim/build_host_lib.sh -O2 -fsanitize=address,undefined
+#
+# A test then links against it :
+#   gcc $(tools/host_sim/build_host_lib.sh --cflags) my_test.c _host_build/libhost_sim.a
+set -e
+
+SIM_DIR=$(cd "$(dirname "$0")" && pwd)
+REPO=$(cd "$SIM_DIR/../.." && pwd)
+OUT="$REPO/_host_build"
+
+# tools/host_sim/include goes first so <xc.h> resolves to the host model ,
+# then every driver directory , like the MPLAB project include list
+INCLUDES="-I$SIM_DIR/include -I$SIM_DIR -I$REPO"
+for dir in $(find "$REPO/common" "$REPO/mcal" "$REPO/ecual" -type d | sort); do
+    INCLUDES="$INCLUDES -I$dir"
+done
+
+CFLAGS="-std=gnu99 -g -Wall -Wno-unknown-pragmas"
+
+if [ "$1" = "--cflags" ]; then
+    echo "$CFLAGS $INCLUDES"
+    exit 0
+fi
+
+mkdir -p "$OUT/obj"
+rm -f "$OUT"/obj/*.o "$OUT/libhost_sim.a"
+
+for src in $(find "$REPO/common" "$REPO/mcal" "$REPO/ecual" -name '*.c' | sort) "$SIM_DIR/host_sim.c"; do
+    obj="$OUT/obj/$(echo "${src#$REPO/}" | tr '/' '_' | sed 's/\.c$/.o/')"
+    gcc $CFLAGS "$@" $INCLUDES -c "$src" -o "$obj"
+done
+
+ar rcs "$OUT/libhost_sim.a" "$OUT"/obj/*.o
+echo "$OUT/libhost_sim.a"
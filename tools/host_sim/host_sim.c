@@ -0,0 +1,1286 @@
+/*
+ * @file    host_sim.c
+ * @brief   Host-side register level model of the PIC18F4620 peripherals
+ *
+ * @details
+ * Access protocol : the hook cannot see whether the driver reads or writes
+ * the cell it returns , so side effects are applied lazily on the next
+ * hook call (or delay) :
+ *  - PORTx changed            -> write to LATx
+ *  - TXREG last accessed      -> write (the drivers never read it)
+ *  - RCREG last accessed      -> read , pops the receive FIFO
+ *  - SSPBUF mark cleared      -> write , mark kept + BF set -> read
+ *  - SEN / RSEN / PEN / RCEN / ACKEN set  -> bus event starts when idle
+ *  - GO_DONE , EECON1 RD / WR rising edge -> conversion / EEPROM access ,
+ *    with EEPGD set a flash row erase / write and its CPU stall
+ *  - asm("TBLRD*+") , asm("TBLWT*+") ...  -> TABLAT <-> flash / holding registers
+ *
+ * Layer: Tools
+ * Target MCU: PIC18F4620 (host model)
+ *
+ * Author: Abdelmoniem Ahmed
+ * Linkedin: https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * Date: 2026
+ */
+
+#define HOST_SIM_MODEL
+#include "host_sim.h"
+
+/* Section : Macro Declaration */
+
+#define SFR_NO_ACCESS                       0x0000
+#define SSPBUF_READ_MARK                    0x0100
+
+#define I2C_OP_NONE                         0
+#define I2C_OP_START                        1
+#define I2C_OP_RESTART                      2
+#define I2C_OP_STOP                         3
+#define I2C_OP_WRITE                        4
+#define I2C_OP_READ                         5
+#define I2C_OP_ACK                          6
+#define SPI_OP_EXCHANGE                     7
+
+#define SSPM_SPI_MASTER_LAST                0x03
+#define SSPM_I2C_MASTER                     0x08
+
+#define ISR_LEVEL_NONE                      0
+#define ISR_LEVEL_LOW                       1
+#define ISR_LEVEL_HIGH                      2
+
+#define EEPROM_WRITE_CYCLES                 (_XTAL_FREQ / 4UL / 250UL)      /* 4 ms typical */
+#define FLASH_CYCLE_CYCLES                  (_XTAL_FREQ / 4UL / 500UL)      /* 2 ms erase or write , CPU stalled */
+#define FLASH_ASM_TEXT_SIZE                 64
+#define ADC_FRC_FOSC_CLOCKS                 (_XTAL_FREQ / 250000UL)         /* Tad = 4 us */
+
+/* Section : Macro Functions Declarations */
+
+#define SFR_RAW(_NAME)                      (host_sim_sfr[HOST_SIM_ADDR_##_NAME - HOST_SIM_SFR_BASE])
+#define BITS_RAW(_NAME)                     (*(volatile _NAME##bits_t *)&SFR_RAW(_NAME))
+#define SHADOW(_NAME)                       (sfr_shadow[HOST_SIM_ADDR_##_NAME - HOST_SIM_SFR_BASE])
+#define SFR_RISING(_NAME , _MASK)           (SFR_RAW(_NAME) & (uint8)~SHADOW(_NAME) & (_MASK))
+#define SFR_FALLING(_NAME , _MASK)          ((uint8)~SFR_RAW(_NAME) & SHADOW(_NAME) & (_MASK))
+#define SFR_CHANGED(_NAME)                  (SFR_RAW(_NAME) != SHADOW(_NAME))
+
+/* Section : Data Types Declarations */
+
+typedef struct{
+    uint8 tsr_busy ;
+    uint8 txreg_full ;
+    uint16 txreg ;                      /* bit 8 = TX9D */
+    uint16 tsr ;
+    uint64 tsr_end ;
+    uint8 log[HOST_SIM_UART_LOG_SIZE] ;
+    uint16 log_head ;
+    uint16 log_tail ;
+    uint8 last_ninth ;
+    uint16 rx_queue[HOST_SIM_UART_RX_QUEUE_SIZE] ;  /* bit 8 = ninth bit , bit 9 = framing error */
+    uint16 rx_head ;
+    uint16 rx_tail ;
+    uint8 rx_busy ;
+    uint16 rx_frame ;
+    uint64 rx_end ;
+    uint16 fifo[2] ;
+    uint8 fifo_count ;
+    uint32 line_baudrate ;              /* Remote sender , measured by auto-baud , 0 = programmed rate */
+}uart_model_t;
+
+typedef struct{
+    uint8 op ;
+    uint64 end ;
+    uint8 data ;
+    uint8 rx_full ;
+    uint8 expect_address ;
+    uint8 read_mode ;
+    host_sim_i2c_device_t *active ;
+}mssp_model_t;
+
+/* Section : Global Variables */
+
+static volatile uint8 host_sim_sfr[HOST_SIM_SFR_SIZE];
+static uint8 sfr_shadow[HOST_SIM_SFR_SIZE];
+static volatile uint16 host_sim_sspbuf = SSPBUF_READ_MARK;
+static uint16 sfr_last_access = SFR_NO_ACCESS;
+static uint64 sim_cycles = ZERO_INIT;
+static uint8 sim_sleeping = FALSE;
+static uint16 sim_reset_requests = ZERO_INIT;
+static uint8 stack_tos[HOST_SIM_STACK_DEPTH + 1][3];     /* TOSL , TOSH , TOSU per level */
+
+static void (* isr_high)(void) = NULL;
+static void (* isr_low)(void) = NULL;
+static uint8 isr_level = ISR_LEVEL_NONE;
+
+static uint8 pin_input[HOST_SIM_PORT_COUNT];
+static host_sim_port_hook_t port_hook = NULL;
+static uint8 portb_level = ZERO_INIT;
+static uint8 portb_latch = ZERO_INIT;
+
+static uint32 timer0_prescaler = ZERO_INIT;
+static uint32 timer1_prescaler = ZERO_INIT;
+static uint32 timer2_prescaler = ZERO_INIT;
+static uint32 timer3_prescaler = ZERO_INIT;
+static uint8 timer2_postscaler = ZERO_INIT;
+
+static uart_model_t uart;
+static mssp_model_t mssp;
+static host_sim_i2c_device_t *i2c_devices[HOST_SIM_I2C_MAX_DEVICES];
+static uint8 i2c_device_count = ZERO_INIT;
+static host_sim_spi_exchange_t spi_slave = NULL;
+
+static uint16 adc_value[HOST_SIM_ADC_CHANNELS];
+static uint8 adc_busy = FALSE;
+static uint64 adc_end = ZERO_INIT;
+
+static uint8 eeprom[HOST_SIM_EEPROM_SIZE];
+static uint8 eeprom_initialized = FALSE;
+static uint8 eeprom_busy = FALSE;
+static uint16 eeprom_address = ZERO_INIT;
+static uint8 eeprom_data = ZERO_INIT;
+static uint64 eeprom_end = ZERO_INIT;
+static uint16 eeprom_write_starts = ZERO_INIT;
+
+static uint8 flash[HOST_SIM_FLASH_SIZE];
+static uint8 flash_holding[HOST_SIM_FLASH_ROW_SIZE];
+static uint8 flash_initialized = FALSE;
+static uint32 flash_stall = ZERO_INIT;
+static uint8 sim_stalled = FALSE;
+static char asm_last[FLASH_ASM_TEXT_SIZE];
+
+/* Section : Helper Function Declarations */
+
+static void sfr_apply(void);
+static void model_advance(uint64 cycles);
+static void gpio_refresh(void);
+static void timers_step(uint64 cycles);
+static uint8 counter_add(uint8 low , uint8 high , uint8 is_16bit , uint32 ticks);
+static uint32 prescale(uint32 *accumulator , uint64 cycles , uint32 ratio);
+static uint32 uart_bit_cycles(void);
+static uint32 uart_brg_multiplier(void);
+static void uart_auto_baud_complete(void);
+static void uart_tx_write(uint8 data);
+static void uart_step(void);
+static void mssp_sspbuf_write(uint8 data);
+static void mssp_step(void);
+static uint32 mssp_bit_cycles(void);
+static void i2c_complete(void);
+static void adc_step(void);
+static void eeprom_step(void);
+static void eeprom_erase_once(void);
+static void flash_erase_once(void);
+static void flash_cycle(void);
+static uint32 table_pointer(void);
+static void interrupt_dispatch(void);
+static uint8 wake_pending(void);
+
+/* Section : Function Definitions */
+
+volatile unsigned char *host_sim_sfr_access(unsigned short address){
+    sfr_apply();
+    model_advance(HOST_SIM_SFR_ACCESS_CYCLES);
+    sfr_last_access = address;
+    if(HOST_SIM_ADDR_PORTB == address){
+        /* Reading PORTB ends the RB4..RB7 mismatch */
+        portb_latch = portb_level;
+    }
+    else{ /* Nothing */ }
+    memcpy(sfr_shadow , (const void *)host_sim_sfr , sizeof(sfr_shadow));
+    if((HOST_SIM_ADDR_TOSL <= address) && (HOST_SIM_ADDR_TOSU >= address)){
+        /* Top of stack is the level selected by STKPTR<4:0> */
+        return &stack_tos[SFR_RAW(STKPTR) & 0x1F][address - HOST_SIM_ADDR_TOSL];
+    }
+    else{ /* Nothing */ }
+    return &host_sim_sfr[address - HOST_SIM_SFR_BASE];
+}
+
+volatile unsigned short *host_sim_sspbuf_access(void){
+    sfr_apply();
+    model_advance(HOST_SIM_SFR_ACCESS_CYCLES);
+    memcpy(sfr_shadow , (const void *)host_sim_sfr , sizeof(sfr_shadow));
+    sfr_last_access = HOST_SIM_ADDR_SSPBUF;
+    host_sim_sspbuf = (uint16)(SSPBUF_READ_MARK | (host_sim_sspbuf & 0xFF));
+    return &host_sim_sspbuf;
+}
+
+volatile unsigned char * const *host_sim_port_registers(unsigned short base){
+    static volatile unsigned char * l_table[3][HOST_SIM_PORT_COUNT];
+    uint8 l_kind = (HOST_SIM_ADDR_PORTA == base) ? 0 : (HOST_SIM_ADDR_LATA == base) ? 1 : 2;
+    uint8 l_port = ZERO_INIT;
+
+    (void)host_sim_sfr_access(base);
+    sfr_last_access = SFR_NO_ACCESS;
+    for(l_port = ZERO_INIT ; l_port < HOST_SIM_PORT_COUNT ; l_port++){
+        l_table[l_kind][l_port] = &host_sim_sfr[base - HOST_SIM_SFR_BASE + l_port];
+    }
+    return (volatile unsigned char * const *)l_table[l_kind];
+}
+
+void host_sim_reset(void){
+    memset((void *)host_sim_sfr , 0 , sizeof(sfr_shadow));
+    SFR_RAW(TRISA) = 0xFF;
+    SFR_RAW(TRISB) = 0xFF;
+    SFR_RAW(TRISC) = 0xFF;
+    SFR_RAW(TRISD) = 0xFF;
+    SFR_RAW(TRISE) = 0x07;
+    SFR_RAW(T0CON) = 0xFF;
+    SFR_RAW(PR2) = 0xFF;
+    SFR_RAW(TXSTA) = 0x02;              /* TRMT */
+    SFR_RAW(BAUDCON) = 0x40;            /* RCIDL */
+    SFR_RAW(OSCCON) = 0x40;
+    SFR_RAW(RCON) = 0x1C;
+    SFR_RAW(INTCON2) = 0xF5;
+    SFR_RAW(INTCON3) = 0xC0;
+    SFR_RAW(IPR1) = 0xFF;
+    SFR_RAW(IPR2) = 0xDF;
+    memcpy(sfr_shadow , (const void *)host_sim_sfr , sizeof(sfr_shadow));
+    host_sim_sspbuf = SSPBUF_READ_MARK;
+    sfr_last_access = SFR_NO_ACCESS;
+    sim_cycles = ZERO_INIT;
+    sim_sleeping = FALSE;
+    isr_level = ISR_LEVEL_NONE;
+    memset(stack_tos , 0 , sizeof(stack_tos));
+
+    timer0_prescaler = ZERO_INIT;
+    timer1_prescaler = ZERO_INIT;
+    timer2_prescaler = ZERO_INIT;
+    timer3_prescaler = ZERO_INIT;
+    timer2_postscaler = ZERO_INIT;
+
+    memset(&uart , 0 , sizeof(uart));
+    memset(&mssp , 0 , sizeof(mssp));
+    adc_busy = FALSE;
+    eeprom_busy = FALSE;
+    eeprom_erase_once();
+    flash_erase_once();
+    memset(flash_holding , 0xFF , sizeof(flash_holding));
+    flash_stall = ZERO_INIT;
+    asm_last[0] = '\0';
+    gpio_refresh();
+    portb_latch = portb_level;
+    memcpy(sfr_shadow , (const void *)host_sim_sfr , sizeof(sfr_shadow));
+}
+
+void host_sim_set_isr(void (* high)(void) , void (* low)(void)){
+    isr_high = high;
+    isr_low = low;
+}
+
+uint64 host_sim_cycles(void){
+    return sim_cycles;
+}
+
+void host_sim_delay_cycles(unsigned long cycles){
+    uint64 l_step = ZERO_INIT;
+
+    sfr_apply();
+    while(cycles){
+        l_step = (cycles > HOST_SIM_DELAY_STEP_CYCLES) ? HOST_SIM_DELAY_STEP_CYCLES : cycles;
+        model_advance(l_step);
+        cycles -= (unsigned long)l_step;
+    }
+    memcpy(sfr_shadow , (const void *)host_sim_sfr , sizeof(sfr_shadow));
+}
+
+void host_sim_sleep(void){
+    uint64 l_start = sim_cycles;
+
+    sfr_apply();
+    /* IDLEN = 1 : peripherals keep their clock , IDLEN = 0 : only the RC-clocked ones */
+    sim_sleeping = (BITS_RAW(OSCCON).IDLEN) ? FALSE : TRUE;
+    while((FALSE == wake_pending()) && ((sim_cycles - l_start) < HOST_SIM_SLEEP_LIMIT_CYCLES)){
+        model_advance(HOST_SIM_DELAY_STEP_CYCLES);
+    }
+    sim_sleeping = FALSE;
+    memcpy(sfr_shadow , (const void *)host_sim_sfr , sizeof(sfr_shadow));
+}
+
+void host_sim_reset_request(void){
+    sim_reset_requests++;
+}
+
+uint16 host_sim_reset_requests(void){
+    return sim_reset_requests;
+}
+
+void host_sim_stack_push(void){
+    uint8 l_level = (uint8)(SFR_RAW(STKPTR) & 0x1F);
+
+    sfr_apply();
+    if(HOST_SIM_STACK_DEPTH > l_level){
+        l_level++;
+        memset(stack_tos[l_level] , 0 , sizeof(stack_tos[l_level]));     /* Return address in the 64 KB flash */
+        SFR_RAW(STKPTR) = (uint8)((SFR_RAW(STKPTR) & 0xE0) | l_level);
+    }
+    else{
+        SFR_RAW(STKPTR) |= 0x80;                                          /* STKFUL */
+    }
+    memcpy(sfr_shadow , (const void *)host_sim_sfr , sizeof(sfr_shadow));
+}
+
+void host_sim_stack_pop(void){
+    uint8 l_level = (uint8)(SFR_RAW(STKPTR) & 0x1F);
+
+    sfr_apply();
+    if(ZERO_INIT < l_level){
+        SFR_RAW(STKPTR) = (uint8)((SFR_RAW(STKPTR) & 0xE0) | (l_level - 1));
+    }
+    else{
+        SFR_RAW(STKPTR) |= 0x40;                                          /* STKUNF */
+    }
+    memcpy(sfr_shadow , (const void *)host_sim_sfr , sizeof(sfr_shadow));
+}
+
+void host_sim_pin_set(uint8 port , uint8 pin , uint8 level){
+    if((port < HOST_SIM_PORT_COUNT) && (pin < 8)){
+        sfr_apply();
+        if(level){
+            pin_input[port] |= (uint8)(1 << pin);
+        }
+        else{
+            pin_input[port] &= (uint8)~(1 << pin);
+        }
+        gpio_refresh();
+    }
+    else{ /* Nothing */ }
+}
+
+void host_sim_port_set(uint8 port , uint8 levels){
+    if(port < HOST_SIM_PORT_COUNT){
+        sfr_apply();
+        pin_input[port] = levels;
+        gpio_refresh();
+    }
+    else{ /* Nothing */ }
+}
+
+uint8 host_sim_pin_get(uint8 port , uint8 pin){
+    uint8 l_level = ZERO_INIT;
+
+    if((port < HOST_SIM_PORT_COUNT) && (pin < 8)){
+        sfr_apply();
+        gpio_refresh();
+        l_level = (uint8)((host_sim_sfr[HOST_SIM_ADDR_PORTA - HOST_SIM_SFR_BASE + port] >> pin) & 0x01);
+    }
+    else{ /* Nothing */ }
+    return l_level;
+}
+
+void host_sim_set_port_hook(host_sim_port_hook_t hook){
+    port_hook = hook;
+}
+
+void host_sim_uart_rx_push(const uint8 *data , uint16 length){
+    uint16 l_index = ZERO_INIT;
+
+    if(NULL != data){
+        for(l_index = ZERO_INIT ; l_index < length ; l_index++){
+            host_sim_uart_rx_push_frame(data[l_index] , 0 , FALSE);
+        }
+    }
+    else{ /* Nothing */ }
+}
+
+void host_sim_uart_rx_push_frame(uint8 data , uint8 ninth_bit , uint8 framing_error){
+    uint16 l_next = (uint16)((uart.rx_head + 1) % HOST_SIM_UART_RX_QUEUE_SIZE);
+
+    if(l_next != uart.rx_tail){
+        uart.rx_queue[uart.rx_head] = (uint16)(data | ((ninth_bit & 0x01) << 8) | ((framing_error ? 1 : 0) << 9));
+        uart.rx_head = l_next;
+    }
+    else{ /* Queue full , the byte is lost on the line */ }
+}
+
+uint16 host_sim_uart_tx_count(void){
+    return (uint16)((uart.log_head + HOST_SIM_UART_LOG_SIZE - uart.log_tail) % HOST_SIM_UART_LOG_SIZE);
+}
+
+uint16 host_sim_uart_tx_read(uint8 *buffer , uint16 size){
+    uint16 l_count = ZERO_INIT;
+
+    sfr_apply();
+    while((NULL != buffer) && (l_count < size) && (uart.log_tail != uart.log_head)){
+        buffer[l_count++] = uart.log[uart.log_tail];
+        uart.log_tail = (uint16)((uart.log_tail + 1) % HOST_SIM_UART_LOG_SIZE);
+    }
+    return l_count;
+}
+
+uint8 host_sim_uart_tx_ninth_bit(void){
+    return uart.last_ninth;
+}
+
+void host_sim_uart_set_line_baudrate(uint32 baudrate){
+    uart.line_baudrate = baudrate;
+}
+
+static uint8 i2c_register_file_start(host_sim_i2c_device_t *device , uint8 read){
+    device->pointer_pending = read ? FALSE : TRUE;
+    return TRUE;
+}
+
+static uint8 i2c_register_file_write(host_sim_i2c_device_t *device , uint8 data){
+    if(device->pointer_pending){
+        device->pointer = (uint16)(data % device->register_count);
+        device->pointer_pending = FALSE;
+    }
+    else{
+        device->registers[device->pointer] = data;
+        device->pointer = (uint16)((device->pointer + 1) % device->register_count);
+    }
+    return TRUE;
+}
+
+static uint8 i2c_register_file_read(host_sim_i2c_device_t *device){
+    uint8 l_data = device->registers[device->pointer];
+
+    device->pointer = (uint16)((device->pointer + 1) % device->register_count);
+    return l_data;
+}
+
+void host_sim_i2c_register_file(host_sim_i2c_device_t *device , uint8 address , uint8 *registers , uint16 register_count){
+    if((NULL != device) && (NULL != registers) && (ZERO_INIT != register_count)){
+        device->address = address;
+        device->start = i2c_register_file_start;
+        device->write = i2c_register_file_write;
+        device->read = i2c_register_file_read;
+        device->stop = NULL;
+        device->registers = registers;
+        device->register_count = register_count;
+        device->pointer = ZERO_INIT;
+        device->pointer_pending = FALSE;
+    }
+    else{ /* Nothing */ }
+}
+
+Std_ReturnType host_sim_i2c_attach(host_sim_i2c_device_t *device){
+    Std_ReturnType ret = E_OK;
+
+    if((NULL == device) || (i2c_device_count >= HOST_SIM_I2C_MAX_DEVICES)){
+        ret = E_NOT_OK;
+    }
+    else{
+        i2c_devices[i2c_device_count++] = device;
+    }
+    return ret;
+}
+
+void host_sim_i2c_detach_all(void){
+    i2c_device_count = ZERO_INIT;
+    mssp.active = NULL;
+}
+
+void host_sim_spi_set_slave(host_sim_spi_exchange_t exchange){
+    spi_slave = exchange;
+}
+
+void host_sim_adc_set(uint8 channel , uint16 value){
+    if(channel < HOST_SIM_ADC_CHANNELS){
+        adc_value[channel] = (uint16)(value & 0x03FF);
+    }
+    else{ /* Nothing */ }
+}
+
+uint8 host_sim_eeprom_get(uint16 address){
+    eeprom_erase_once();
+    return eeprom[address % HOST_SIM_EEPROM_SIZE];
+}
+
+void host_sim_eeprom_set(uint16 address , uint8 value){
+    eeprom_erase_once();
+    eeprom[address % HOST_SIM_EEPROM_SIZE] = value;
+}
+
+uint16 host_sim_eeprom_write_starts(void){
+    return eeprom_write_starts;
+}
+
+uint8 host_sim_flash_get(uint32 address){
+    flash_erase_once();
+    return flash[address % HOST_SIM_FLASH_SIZE];
+}
+
+void host_sim_flash_set(uint32 address , uint8 value){
+    flash_erase_once();
+    flash[address % HOST_SIM_FLASH_SIZE] = value;
+}
+
+const char *host_sim_asm_last(void){
+    return asm_last;
+}
+
+void host_sim_asm(const char *text){
+    uint32 l_pointer = ZERO_INIT;
+    uint8 l_is_read = (0 == strncmp(text , "TBLRD" , 5)) ? TRUE : FALSE;
+    uint8 l_is_write = (0 == strncmp(text , "TBLWT" , 5)) ? TRUE : FALSE;
+    const char *l_mode = text + 5;
+
+    sfr_apply();
+    l_pointer = table_pointer();
+    if((l_is_read) || (l_is_write)){
+        /* "+*" increments first , "*+" / "*-" after the access */
+        if(0 == strcmp(l_mode , "+*")){
+            l_pointer++;
+        }
+        else{ /* Nothing */ }
+        if(l_is_read){
+            /* Beyond the 64 KB array (ID / configuration space) reads as erased */
+            SFR_RAW(TABLAT) = (l_pointer < HOST_SIM_FLASH_SIZE) ? flash[l_pointer] : 0xFF;
+        }
+        else{
+            flash_holding[l_pointer % HOST_SIM_FLASH_ROW_SIZE] = SFR_RAW(TABLAT);
+        }
+        if(0 == strcmp(l_mode , "*+")){
+            l_pointer++;
+        }
+        else if(0 == strcmp(l_mode , "*-")){
+            l_pointer--;
+        }
+        else{ /* Nothing */ }
+        l_pointer &= 0x3FFFFFUL;
+        SFR_RAW(TBLPTRU) = (uint8)(l_pointer >> 16);
+        SFR_RAW(TBLPTRH) = (uint8)(l_pointer >> 8);
+        SFR_RAW(TBLPTRL) = (uint8)l_pointer;
+        model_advance(2);               /* TBLRD / TBLWT take two cycles */
+    }
+    else{
+        strncpy(asm_last , text , sizeof(asm_last) - 1);
+        asm_last[sizeof(asm_last) - 1] = '\0';
+        model_advance(1);
+    }
+    memcpy(sfr_shadow , (const void *)host_sim_sfr , sizeof(sfr_shadow));
+}
+
+/* Section : Helper Function Definitions */
+
+/**
+ * @brief Side effects of the software access since the last hook call
+ */
+static void sfr_apply(void){
+    uint8 l_port = ZERO_INIT;
+
+    /* PORTx writes land in LATx */
+    for(l_port = ZERO_INIT ; l_port < HOST_SIM_PORT_COUNT ; l_port++){
+        if(host_sim_sfr[HOST_SIM_ADDR_PORTA - HOST_SIM_SFR_BASE + l_port] !=
+           sfr_shadow[HOST_SIM_ADDR_PORTA - HOST_SIM_SFR_BASE + l_port]){
+            host_sim_sfr[HOST_SIM_ADDR_LATA - HOST_SIM_SFR_BASE + l_port] =
+                host_sim_sfr[HOST_SIM_ADDR_PORTA - HOST_SIM_SFR_BASE + l_port];
+        }
+        else{ /* Nothing */ }
+    }
+
+    /* A timer write clears its prescaler */
+    if(SFR_CHANGED(TMR0L)){ timer0_prescaler = ZERO_INIT; } else{ /* Nothing */ }
+    if(SFR_CHANGED(TMR1L)){ timer1_prescaler = ZERO_INIT; } else{ /* Nothing */ }
+    if(SFR_CHANGED(TMR2)){ timer2_prescaler = ZERO_INIT; } else{ /* Nothing */ }
+    if(SFR_CHANGED(TMR3L)){ timer3_prescaler = ZERO_INIT; } else{ /* Nothing */ }
+
+    if(HOST_SIM_ADDR_TXREG == sfr_last_access){
+        uart_tx_write(SFR_RAW(TXREG));
+    }
+    else if((HOST_SIM_ADDR_RCREG == sfr_last_access) && (uart.fifo_count > 0)){
+        uart.fifo[0] = uart.fifo[1];
+        uart.fifo_count--;
+    }
+    else if(HOST_SIM_ADDR_SSPBUF == sfr_last_access){
+        if(ZERO_INIT == (host_sim_sspbuf & SSPBUF_READ_MARK)){
+            mssp_sspbuf_write((uint8)host_sim_sspbuf);
+        }
+        else if(mssp.rx_full){
+            mssp.rx_full = FALSE;
+            BITS_RAW(SSPSTAT).BF = 0;
+        }
+        else{ /* Dummy read */ }
+    }
+    else{ /* Nothing */ }
+
+    if(SFR_FALLING(RCSTA , 0x10)){
+        /* Clearing CREN resets an overrun */
+        BITS_RAW(RCSTA).OERR = 0;
+    }
+    else{ /* Nothing */ }
+    if(SFR_FALLING(RCSTA , 0x80)){
+        uart.tsr_busy = FALSE;
+        uart.txreg_full = FALSE;
+        uart.rx_busy = FALSE;
+        uart.fifo_count = ZERO_INIT;
+    }
+    else{ /* Nothing */ }
+
+    if(SFR_RISING(ADCON0 , 0x02)){
+        if(BITS_RAW(ADCON0).ADON){
+            uint32 l_tad = ZERO_INIT;
+            uint32 l_acq = ZERO_INIT;
+            static const uint8 l_div[8] = {2 , 8 , 32 , 0 , 4 , 16 , 64 , 0};
+            static const uint8 l_acq_tad[8] = {0 , 2 , 4 , 6 , 8 , 12 , 16 , 20};
+
+            l_tad = l_div[BITS_RAW(ADCON2).ADCS] ? l_div[BITS_RAW(ADCON2).ADCS] : ADC_FRC_FOSC_CLOCKS;
+            l_acq = l_acq_tad[BITS_RAW(ADCON2).ACQT];
+            adc_busy = TRUE;
+            adc_end = sim_cycles + (((uint64)l_tad * (11 + l_acq)) + 3) / 4;
+        }
+        else{
+            BITS_RAW(ADCON0).GO_DONE = 0;
+        }
+    }
+    else{ /* Nothing */ }
+
+    if(SFR_RISING(EECON1 , 0x01)){
+        if((!BITS_RAW(EECON1).EEPGD) && (!BITS_RAW(EECON1).CFGS)){
+            SFR_RAW(EEDATA) = eeprom[((SFR_RAW(EEADRH) & 0x03) << 8) | SFR_RAW(EEADR)];
+        }
+        else{ /* Program memory reads are not modelled */ }
+        BITS_RAW(EECON1).RD = 0;
+    }
+    else{ /* Nothing */ }
+    if((SFR_RISING(EECON1 , 0x02)) && (BITS_RAW(EECON1).EEPGD) && (!BITS_RAW(EECON1).CFGS)){
+        if((BITS_RAW(EECON1).WREN) && (FALSE == eeprom_busy)){
+            flash_cycle();
+        }
+        else{ /* Wrong unlock state , the cycle does not start */ }
+        BITS_RAW(EECON1).WR = 0;
+    }
+    else if(SFR_RISING(EECON1 , 0x02)){
+        if((BITS_RAW(EECON1).WREN) && (!BITS_RAW(EECON1).CFGS) && (FALSE == eeprom_busy)){
+            eeprom_write_starts++;
+            eeprom_address = (uint16)(((SFR_RAW(EEADRH) & 0x03) << 8) | SFR_RAW(EEADR));
+            eeprom_data = SFR_RAW(EEDATA);
+            eeprom_busy = TRUE;
+            eeprom_end = sim_cycles + EEPROM_WRITE_CYCLES;
+        }
+        else{
+            BITS_RAW(EECON1).WR = 0;
+        }
+    }
+    else{ /* Nothing */ }
+
+    sfr_last_access = SFR_NO_ACCESS;
+    memcpy(sfr_shadow , (const void *)host_sim_sfr , sizeof(sfr_shadow));
+
+    if(flash_stall){
+        /* No instruction runs , interrupts wait for the end of the cycle */
+        uint64 l_step = ZERO_INIT;
+
+        sim_stalled = TRUE;
+        while(flash_stall){
+            l_step = (flash_stall > HOST_SIM_DELAY_STEP_CYCLES) ? HOST_SIM_DELAY_STEP_CYCLES : flash_stall;
+            model_advance(l_step);
+            flash_stall -= (uint32)l_step;
+        }
+        /* Flash cycles end with EEIF too */
+        BITS_RAW(PIR2).EEIF = 1;
+        sim_stalled = FALSE;
+        memcpy(sfr_shadow , (const void *)host_sim_sfr , sizeof(sfr_shadow));
+    }
+    else{ /* Nothing */ }
+}
+
+static void model_advance(uint64 cycles){
+    sim_cycles += cycles;
+    if(FALSE == sim_sleeping){
+        timers_step(cycles);
+        uart_step();
+        mssp_step();
+    }
+    else{ /* Instruction clock stopped */ }
+    adc_step();
+    eeprom_step();
+    gpio_refresh();
+    if(FALSE == sim_stalled){
+        interrupt_dispatch();
+    }
+    else{ /* Served once the flash cycle ends */ }
+}
+
+static void gpio_refresh(void){
+    uint8 l_lat[HOST_SIM_PORT_COUNT];
+    uint8 l_tris[HOST_SIM_PORT_COUNT];
+    uint8 l_input = ZERO_INIT;
+    uint8 l_level = ZERO_INIT;
+    uint8 l_rising = ZERO_INIT;
+    uint8 l_falling = ZERO_INIT;
+    uint8 l_port = ZERO_INIT;
+
+    for(l_port = ZERO_INIT ; l_port < HOST_SIM_PORT_COUNT ; l_port++){
+        l_lat[l_port] = host_sim_sfr[HOST_SIM_ADDR_LATA - HOST_SIM_SFR_BASE + l_port];
+        l_tris[l_port] = host_sim_sfr[HOST_SIM_ADDR_TRISA - HOST_SIM_SFR_BASE + l_port];
+    }
+    for(l_port = ZERO_INIT ; l_port < HOST_SIM_PORT_COUNT ; l_port++){
+        l_input = (NULL != port_hook) ? port_hook(l_port , l_lat , l_tris) : pin_input[l_port];
+        l_level = (uint8)((l_lat[l_port] & (uint8)~l_tris[l_port]) | (l_input & l_tris[l_port]));
+        host_sim_sfr[HOST_SIM_ADDR_PORTA - HOST_SIM_SFR_BASE + l_port] = l_level;
+        sfr_shadow[HOST_SIM_ADDR_PORTA - HOST_SIM_SFR_BASE + l_port] = l_level;
+        if(HOST_SIM_PORTB == l_port){
+            l_rising = (uint8)(l_level & (uint8)~portb_level);
+            l_falling = (uint8)((uint8)~l_level & portb_level);
+            if((BITS_RAW(INTCON2).INTEDG0) ? (l_rising & 0x01) : (l_falling & 0x01)){
+                BITS_RAW(INTCON).INT0IF = 1;
+            }
+            else{ /* Nothing */ }
+            if((BITS_RAW(INTCON2).INTEDG1) ? (l_rising & 0x02) : (l_falling & 0x02)){
+                BITS_RAW(INTCON3).INT1IF = 1;
+            }
+            else{ /* Nothing */ }
+            if((BITS_RAW(INTCON2).INTEDG2) ? (l_rising & 0x04) : (l_falling & 0x04)){
+                BITS_RAW(INTCON3).INT2IF = 1;
+            }
+            else{ /* Nothing */ }
+            portb_level = l_level;
+            if((l_level ^ portb_latch) & l_tris[l_port] & 0xF0){
+                BITS_RAW(INTCON).RBIF = 1;
+            }
+            else{ /* Nothing */ }
+        }
+        else{ /* Nothing */ }
+    }
+}
+
+static uint32 prescale(uint32 *accumulator , uint64 cycles , uint32 ratio){
+    uint64 l_total = *accumulator + cycles;
+
+    *accumulator = (uint32)(l_total % ratio);
+    return (uint32)(l_total / ratio);
+}
+
+/**
+ * @brief Add ticks to TMRxL (and TMRxH) , returns TRUE on overflow
+ */
+static uint8 counter_add(uint8 low , uint8 high , uint8 is_16bit , uint32 ticks){
+    uint32 l_value = host_sim_sfr[low];
+    uint32 l_limit = is_16bit ? 0x10000UL : 0x100UL;
+    uint8 l_overflow = FALSE;
+
+    if(is_16bit){
+        l_value |= ((uint32)host_sim_sfr[high] << 8);
+    }
+    else{ /* Nothing */ }
+    l_value += ticks;
+    if(l_value >= l_limit){
+        l_overflow = TRUE;
+        l_value %= l_limit;
+    }
+    else{ /* Nothing */ }
+    host_sim_sfr[low] = (uint8)l_value;
+    if(is_16bit){
+        host_sim_sfr[high] = (uint8)(l_value >> 8);
+    }
+    else{ /* Nothing */ }
+    return l_overflow;
+}
+
+static void timers_step(uint64 cycles){
+    uint32 l_ticks = ZERO_INIT;
+    uint32 l_period = ZERO_INIT;
+    uint32 l_to_match = ZERO_INIT;
+    uint32 l_matches = ZERO_INIT;
+    static const uint8 l_t2_ratio[4] = {1 , 4 , 16 , 16};
+
+    if((BITS_RAW(T0CON).TMR0ON) && (!BITS_RAW(T0CON).T0CS)){
+        l_ticks = prescale(&timer0_prescaler , cycles , (BITS_RAW(T0CON).PSA) ? 1UL : (2UL << BITS_RAW(T0CON).T0PS));
+        if(counter_add(HOST_SIM_ADDR_TMR0L - HOST_SIM_SFR_BASE , HOST_SIM_ADDR_TMR0H - HOST_SIM_SFR_BASE ,
+                       !BITS_RAW(T0CON).T08BIT , l_ticks)){
+            BITS_RAW(INTCON).TMR0IF = 1;
+        }
+        else{ /* Nothing */ }
+    }
+    else{ /* Stopped or external clock */ }
+
+    if((BITS_RAW(T1CON).TMR1ON) && (!BITS_RAW(T1CON).TMR1CS)){
+        l_ticks = prescale(&timer1_prescaler , cycles , 1UL << BITS_RAW(T1CON).T1CKPS);
+        if(counter_add(HOST_SIM_ADDR_TMR1L - HOST_SIM_SFR_BASE , HOST_SIM_ADDR_TMR1H - HOST_SIM_SFR_BASE , TRUE , l_ticks)){
+            BITS_RAW(PIR1).TMR1IF = 1;
+        }
+        else{ /* Nothing */ }
+    }
+    else{ /* Stopped or external clock */ }
+
+    if((BITS_RAW(T3CON).TMR3ON) && (!BITS_RAW(T3CON).TMR3CS)){
+        l_ticks = prescale(&timer3_prescaler , cycles , 1UL << BITS_RAW(T3CON).T3CKPS);
+        if(counter_add(HOST_SIM_ADDR_TMR3L - HOST_SIM_SFR_BASE , HOST_SIM_ADDR_TMR3H - HOST_SIM_SFR_BASE , TRUE , l_ticks)){
+            BITS_RAW(PIR2).TMR3IF = 1;
+        }
+        else{ /* Nothing */ }
+    }
+    else{ /* Stopped or external clock */ }
+
+    if(BITS_RAW(T2CON).TMR2ON){
+        l_ticks = prescale(&timer2_prescaler , cycles , l_t2_ratio[BITS_RAW(T2CON).T2CKPS]);
+        l_period = (uint32)SFR_RAW(PR2) + 1;
+        /* TMR2 above PR2 runs up to 0xFF and wraps before it can match */
+        l_to_match = (SFR_RAW(TMR2) <= SFR_RAW(PR2)) ? (uint32)(SFR_RAW(PR2) - SFR_RAW(TMR2)) + 1 :
+                                                       (uint32)(0x100 - SFR_RAW(TMR2)) + l_period;
+        if(l_ticks < l_to_match){
+            SFR_RAW(TMR2) = (uint8)(SFR_RAW(TMR2) + l_ticks);
+        }
+        else{
+            l_ticks -= l_to_match;
+            l_matches = 1 + (l_ticks / l_period);
+            SFR_RAW(TMR2) = (uint8)(l_ticks % l_period);
+            l_matches += timer2_postscaler;
+            if(l_matches > BITS_RAW(T2CON).TOUTPS){
+                BITS_RAW(PIR1).TMR2IF = 1;
+            }
+            else{ /* Nothing */ }
+            timer2_postscaler = (uint8)(l_matches % ((uint32)BITS_RAW(T2CON).TOUTPS + 1));
+        }
+    }
+    else{ /* Stopped */ }
+}
+
+static uint32 uart_bit_cycles(void){
+    uint32 l_n = SFR_RAW(SPBRG);
+
+    if(BITS_RAW(BAUDCON).BRG16){
+        l_n |= ((uint32)SFR_RAW(SPBRGH) << 8);
+    }
+    else{ /* Nothing */ }
+    return uart_brg_multiplier() * (l_n + 1);
+}
+
+/* Instruction cycles per BRG count */
+static uint32 uart_brg_multiplier(void){
+    uint32 l_multiplier = ZERO_INIT;
+
+    if(BITS_RAW(TXSTA).SYNC){
+        l_multiplier = 1;
+    }
+    else if((!BITS_RAW(BAUDCON).BRG16) && (!BITS_RAW(TXSTA).BRGH)){
+        l_multiplier = 16;
+    }
+    else if((BITS_RAW(BAUDCON).BRG16) && (BITS_RAW(TXSTA).BRGH)){
+        l_multiplier = 1;
+    }
+    else{
+        l_multiplier = 4;
+    }
+    return l_multiplier;
+}
+
+/* ABDEN : the 'U' just received loads the BRG count of the line rate , or overflows it */
+static void uart_auto_baud_complete(void){
+    uint32 l_count = uart_bit_cycles() / uart_brg_multiplier();
+    uint32 l_max = (BITS_RAW(BAUDCON).BRG16) ? 0xFFFFUL : 0x00FFUL;
+    uint32 l_step = ZERO_INIT;
+
+    if(uart.line_baudrate){
+        l_step = uart_brg_multiplier() * uart.line_baudrate;
+        l_count = ((_XTAL_FREQ / 4UL) + (l_step / 2UL)) / l_step;
+    }
+    else{ /* Measures the programmed rate */ }
+    if((ZERO_INIT == l_count) || (l_max < (l_count - 1))){
+        /* Counter rolled over , ABDEN stays set */
+        BITS_RAW(BAUDCON).ABDOVF = 1;
+    }
+    else{
+        SFR_RAW(SPBRG) = (uint8)(l_count - 1);
+        if(BITS_RAW(BAUDCON).BRG16){
+            SFR_RAW(SPBRGH) = (uint8)((l_count - 1) >> 8);
+        }
+        else{ /* Nothing */ }
+        BITS_RAW(BAUDCON).ABDEN = 0;
+        if(uart.fifo_count < 2){
+            uart.fifo[uart.fifo_count++] = uart.rx_frame;
+        }
+        else{ /* Nothing */ }
+    }
+}
+
+static uint32 uart_frame_cycles(uint8 nine_bits){
+    uint32 l_bits = nine_bits ? 9 : 8;
+
+    if(!BITS_RAW(TXSTA).SYNC){
+        l_bits += 2;                    /* Start + stop */
+    }
+    else{ /* Clocked , no framing */ }
+    return l_bits * uart_bit_cycles();
+}
+
+static void uart_tx_write(uint8 data){
+    uint16 l_frame = (uint16)(data | (BITS_RAW(TXSTA).TX9D << 8));
+
+    if((BITS_RAW(RCSTA).SPEN) && (BITS_RAW(TXSTA).TXEN)){
+        if(FALSE == uart.tsr_busy){
+            uart.tsr = l_frame;
+            uart.tsr_busy = TRUE;
+            uart.tsr_end = sim_cycles + uart_frame_cycles(BITS_RAW(TXSTA).TX9);
+            BITS_RAW(TXSTA).TRMT = 0;
+        }
+        else{
+            /* A write on a full TXREG overwrites it , like the hardware */
+            uart.txreg = l_frame;
+            uart.txreg_full = TRUE;
+            BITS_RAW(PIR1).TXIF = 0;
+        }
+    }
+    else{ /* Transmitter off , the byte is lost */ }
+}
+
+static void uart_log(uint16 frame){
+    uint16 l_next = (uint16)((uart.log_head + 1) % HOST_SIM_UART_LOG_SIZE);
+
+    uart.log[uart.log_head] = (uint8)frame;
+    uart.last_ninth = (uint8)((frame >> 8) & 0x01);
+    uart.log_head = l_next;
+    if(l_next == uart.log_tail){
+        /* Log full : drop the oldest byte */
+        uart.log_tail = (uint16)((uart.log_tail + 1) % HOST_SIM_UART_LOG_SIZE);
+    }
+    else{ /* Nothing */ }
+}
+
+static void uart_step(void){
+    uint16 l_frame = ZERO_INIT;
+
+    /* Transmitter : TXREG -> TSR -> line */
+    while((uart.tsr_busy) && (sim_cycles >= uart.tsr_end)){
+        uart_log(uart.tsr);
+        if(uart.txreg_full){
+            uart.tsr = uart.txreg;
+            uart.txreg_full = FALSE;
+            uart.tsr_end += uart_frame_cycles(BITS_RAW(TXSTA).TX9);
+        }
+        else{
+            uart.tsr_busy = FALSE;
+            BITS_RAW(TXSTA).TRMT = 1;
+        }
+    }
+    if(BITS_RAW(TXSTA).TXEN){
+        BITS_RAW(PIR1).TXIF = (uart.txreg_full) ? 0 : 1;
+    }
+    else{ /* Nothing */ }
+
+    /* Receiver : line -> RSR -> 2 deep FIFO. The sender does not wait , a frame that
+       ends while CREN is clear or OERR is set is lost */
+    if((BITS_RAW(RCSTA).SPEN) && (!BITS_RAW(TXSTA).SYNC)){
+        for(;;){
+            if((FALSE == uart.rx_busy) && (uart.rx_tail != uart.rx_head)){
+                uart.rx_frame = uart.rx_queue[uart.rx_tail];
+                uart.rx_tail = (uint16)((uart.rx_tail + 1) % HOST_SIM_UART_RX_QUEUE_SIZE);
+                uart.rx_end = ((uart.rx_end > sim_cycles) ? uart.rx_end : sim_cycles) +
+                              uart_frame_cycles(BITS_RAW(RCSTA).RX9);
+                uart.rx_busy = TRUE;
+            }
+            else{ /* Nothing */ }
+            if((uart.rx_busy) && (sim_cycles >= uart.rx_end)){
+                uart.rx_busy = FALSE;
+                if((!BITS_RAW(RCSTA).CREN) || (BITS_RAW(RCSTA).OERR)){
+                    /* Receiver stopped : frame lost */
+                }
+                else if(BITS_RAW(BAUDCON).ABDEN){
+                    uart_auto_baud_complete();
+                }
+                else if((BITS_RAW(RCSTA).RX9) && (BITS_RAW(RCSTA).ADDEN) && (!(uart.rx_frame & 0x100))){
+                    /* Address detect : a data frame is not loaded , no RCIF */
+                }
+                else if(uart.fifo_count < 2){
+                    uart.fifo[uart.fifo_count++] = uart.rx_frame;
+                }
+                else{
+                    BITS_RAW(RCSTA).OERR = 1;
+                }
+            }
+            else{
+                break;
+            }
+        }
+    }
+    else{
+        uart.rx_busy = FALSE;
+    }
+    l_frame = uart.fifo[0];
+    SFR_RAW(RCREG) = (uint8)l_frame;
+    BITS_RAW(RCSTA).RX9D = (uart.fifo_count > 0) ? ((l_frame >> 8) & 0x01) : 0;
+    BITS_RAW(RCSTA).FERR = (uart.fifo_count > 0) ? ((l_frame >> 9) & 0x01) : 0;
+    BITS_RAW(PIR1).RCIF = (uart.fifo_count > 0) ? 1 : 0;
+    BITS_RAW(BAUDCON).RCIDL = (uart.rx_busy) ? 0 : 1;
+}
+
+static uint8 mssp_is_i2c_master(void){
+    return (uint8)((BITS_RAW(SSPCON1).SSPEN) && (SSPM_I2C_MASTER == BITS_RAW(SSPCON1).SSPM));
+}
+
+static uint8 mssp_is_spi_master(void){
+    return (uint8)((BITS_RAW(SSPCON1).SSPEN) && (BITS_RAW(SSPCON1).SSPM <= SSPM_SPI_MASTER_LAST));
+}
+
+static uint32 mssp_bit_cycles(void){
+    uint32 l_cycles = ZERO_INIT;
+    static const uint8 l_t2_ratio[4] = {1 , 4 , 16 , 16};
+
+    if(mssp_is_i2c_master()){
+        l_cycles = (uint32)SFR_RAW(SSPADD) + 1;
+    }
+    else{
+        switch(BITS_RAW(SSPCON1).SSPM){
+            case 0x00 : l_cycles = 1; break;
+            case 0x01 : l_cycles = 4; break;
+            case 0x02 : l_cycles = 16; break;
+            default   : l_cycles = 2 * ((uint32)SFR_RAW(PR2) + 1) * l_t2_ratio[BITS_RAW(T2CON).T2CKPS]; break;
+        }
+    }
+    return l_cycles;
+}
+
+static void mssp_sspbuf_write(uint8 data){
+    host_sim_sspbuf = data;
+    if(I2C_OP_NONE != mssp.op){
+        BITS_RAW(SSPCON1).WCOL = 1;
+    }
+    else if(mssp_is_i2c_master()){
+        mssp.op = I2C_OP_WRITE;
+        mssp.data = data;
+        mssp.end = sim_cycles + (9 * mssp_bit_cycles());
+        BITS_RAW(SSPSTAT).BF = 1;
+        BITS_RAW(SSPSTAT).R_W = 1;      /* Transmit in progress */
+    }
+    else if(mssp_is_spi_master()){
+        mssp.op = SPI_OP_EXCHANGE;
+        mssp.data = data;
+        mssp.end = sim_cycles + (8 * mssp_bit_cycles());
+    }
+    else{ /* Slave modes are not modelled */ }
+}
+
+static void i2c_end_transfer(void){
+    if((NULL != mssp.active) && (NULL != mssp.active->stop)){
+        mssp.active->stop(mssp.active);
+    }
+    else{ /* Nothing */ }
+    mssp.active = NULL;
+}
+
+static void i2c_complete(void){
+    uint8 l_ack = FALSE;
+    uint8 l_index = ZERO_INIT;
+
+    switch(mssp.op){
+        case I2C_OP_START :
+        case I2C_OP_RESTART :
+            i2c_end_transfer();
+            SFR_RAW(SSPCON2) &= (uint8)~0x03;
+            BITS_RAW(SSPSTAT).S = 1;
+            BITS_RAW(SSPSTAT).P = 0;
+            mssp.expect_address = TRUE;
+            break;
+        case I2C_OP_STOP :
+            i2c_end_transfer();
+            BITS_RAW(SSPCON2).PEN = 0;
+            BITS_RAW(SSPSTAT).S = 0;
+            BITS_RAW(SSPSTAT).P = 1;
+            break;
+        case I2C_OP_WRITE :
+            if(mssp.expect_address){
+                mssp.expect_address = FALSE;
+                mssp.read_mode = (uint8)(mssp.data & 0x01);
+                for(l_index = ZERO_INIT ; l_index < i2c_device_count ; l_index++){
+                    if(i2c_devices[l_index]->address == (mssp.data >> 1)){
+                        mssp.active = i2c_devices[l_index];
+                        break;
+                    }
+                    else{ /* Nothing */ }
+                }
+                l_ack = (NULL == mssp.active) ? FALSE :
+                        (NULL == mssp.active->start) ? TRUE : mssp.active->start(mssp.active , mssp.read_mode);
+            }
+            else if((NULL != mssp.active) && (!mssp.read_mode) && (NULL != mssp.active->write)){
+                l_ack = mssp.active->write(mssp.active , mssp.data);
+            }
+            else{ /* No slave listening */ }
+            BITS_RAW(SSPSTAT).BF = 0;
+            BITS_RAW(SSPSTAT).R_W = 0;
+            BITS_RAW(SSPCON2).ACKSTAT = (l_ack) ? 0 : 1;
+            break;
+        case I2C_OP_READ :
+            host_sim_sspbuf = ((NULL != mssp.active) && (mssp.read_mode) && (NULL != mssp.active->read)) ?
+                              mssp.active->read(mssp.active) : 0xFF;
+            BITS_RAW(SSPCON2).RCEN = 0;
+            BITS_RAW(SSPSTAT).BF = 1;
+            mssp.rx_full = TRUE;
+            break;
+        case I2C_OP_ACK :
+            BITS_RAW(SSPCON2).ACKEN = 0;
+            break;
+        default :
+            break;
+    }
+    BITS_RAW(PIR1).SSPIF = 1;
+}
+
+static void mssp_step(void){
+    uint32 l_bit = ZERO_INIT;
+
+    if((I2C_OP_NONE != mssp.op) && (sim_cycles >= mssp.end)){
+        if(SPI_OP_EXCHANGE == mssp.op){
+            host_sim_sspbuf = (NULL != spi_slave) ? spi_slave(mssp.data) : 0xFF;
+            BITS_RAW(SSPSTAT).BF = 1;
+            mssp.rx_full = TRUE;
+            BITS_RAW(PIR1).SSPIF = 1;
+        }
+        else{
+            i2c_complete();
+        }
+        mssp.op = I2C_OP_NONE;
+    }
+    else{ /* Nothing */ }
+
+    if(!BITS_RAW(SSPCON1).SSPEN){
+        mssp.op = I2C_OP_NONE;
+        mssp.rx_full = FALSE;
+        i2c_end_transfer();
+    }
+    else if((I2C_OP_NONE == mssp.op) && (mssp_is_i2c_master())){
+        /* Start the requested bus event , one at a time like the hardware */
+        l_bit = mssp_bit_cycles();
+        if(BITS_RAW(SSPCON2).SEN){
+            mssp.op = I2C_OP_START;
+            mssp.end = sim_cycles + (2 * l_bit);
+        }
+        else if(BITS_RAW(SSPCON2).RSEN){
+            mssp.op = I2C_OP_RESTART;
+            mssp.end = sim_cycles + (3 * l_bit);
+        }
+        else if(BITS_RAW(SSPCON2).PEN){
+            mssp.op = I2C_OP_STOP;
+            mssp.end = sim_cycles + (2 * l_bit);
+        }
+        else if(BITS_RAW(SSPCON2).RCEN){
+            mssp.op = I2C_OP_READ;
+            mssp.end = sim_cycles + (8 * l_bit);
+        }
+        else if(BITS_RAW(SSPCON2).ACKEN){
+            mssp.op = I2C_OP_ACK;
+            mssp.end = sim_cycles + l_bit;
+        }
+        else{ /* Bus idle */ }
+    }
+    else{ /* Busy or not an I2C master */ }
+}
+
+static void adc_step(void){
+    uint16 l_value = ZERO_INIT;
+
+    if((adc_busy) && (sim_cycles >= adc_end)){
+        adc_busy = FALSE;
+        l_value = (BITS_RAW(ADCON0).CHS < HOST_SIM_ADC_CHANNELS) ? adc_value[BITS_RAW(ADCON0).CHS] : 0;
+        if(BITS_RAW(ADCON2).ADFM){
+            SFR_RAW(ADRESH) = (uint8)(l_value >> 8);
+            SFR_RAW(ADRESL) = (uint8)l_value;
+        }
+        else{
+            SFR_RAW(ADRESH) = (uint8)(l_value >> 2);
+            SFR_RAW(ADRESL) = (uint8)(l_value << 6);
+        }
+        BITS_RAW(ADCON0).GO_DONE = 0;
+        BITS_RAW(PIR1).ADIF = 1;
+    }
+    else{ /* Nothing */ }
+}
+
+/**
+ * @brief Blank (0xFF) EEPROM on first use , contents then survive resets
+ */
+static void eeprom_erase_once(void){
+    if(FALSE == eeprom_initialized){
+        memset(eeprom , 0xFF , sizeof(eeprom));
+        eeprom_initialized = TRUE;
+    }
+    else{ /* Nothing */ }
+}
+
+/**
+ * @brief Blank (0xFF) program flash on first use , contents then survive resets
+ */
+static void flash_erase_once(void){
+    if(FALSE == flash_initialized){
+        memset(flash , 0xFF , sizeof(flash));
+        flash_initialized = TRUE;
+    }
+    else{ /* Nothing */ }
+}
+
+static uint32 table_pointer(void){
+    return ((uint32)(SFR_RAW(TBLPTRU) & 0x3F) << 16) | ((uint32)SFR_RAW(TBLPTRH) << 8) | SFR_RAW(TBLPTRL);
+}
+
+/**
+ * @brief Erase (FREE) or write of the row TBLPTR points into , then the stall
+ */
+static void flash_cycle(void){
+    uint32 l_row = table_pointer() & ~(uint32)(HOST_SIM_FLASH_ROW_SIZE - 1);
+    uint8 l_index = ZERO_INIT;
+
+    if(l_row < HOST_SIM_FLASH_SIZE){
+        for(l_index = ZERO_INIT ; l_index < HOST_SIM_FLASH_ROW_SIZE ; l_index++){
+            /* Programming only clears bits */
+            flash[l_row + l_index] = (BITS_RAW(EECON1).FREE) ? 0xFF : (uint8)(flash[l_row + l_index] & flash_holding[l_index]);
+        }
+    }
+    else{ /* Configuration space is not modelled */ }
+    memset(flash_holding , 0xFF , sizeof(flash_holding));
+    flash_stall = FLASH_CYCLE_CYCLES;
+}
+
+static void eeprom_step(void){
+    if((eeprom_busy) && (sim_cycles >= eeprom_end)){
+        eeprom_busy = FALSE;
+        eeprom[eeprom_address] = eeprom_data;
+        BITS_RAW(EECON1).WR = 0;
+        BITS_RAW(PIR2).EEIF = 1;
+    }
+    else{ /* Nothing */ }
+}
+
+/**
+ * @brief Pending flags with their enable bit set , INTCON / INTCON3 keep
+ *        each enable 3 bits above its flag
+ */
+static uint8 core_pending(uint8 intcon , uint8 intcon3){
+    return (uint8)(((intcon >> 3) & intcon & 0x07) | ((((intcon3 >> 3) & intcon3) & 0x03) << 3));
+}
+
+static uint8 wake_pending(void){
+    return (uint8)(core_pending(SFR_RAW(INTCON) , SFR_RAW(INTCON3)) ||
+                   (SFR_RAW(PIE1) & SFR_RAW(PIR1)) || (SFR_RAW(PIE2) & SFR_RAW(PIR2)));
+}
+
+static void isr_call(void (* isr)(void) , uint8 level , uint8 enable_mask){
+    uint8 l_previous = isr_level;
+
+    isr_level = level;
+    SFR_RAW(INTCON) &= (uint8)~enable_mask;
+    host_sim_stack_push();              /* Return address of the interrupted code */
+    isr();
+    sfr_apply();                        /* Last ISR access */
+    host_sim_stack_pop();
+    SFR_RAW(INTCON) |= enable_mask;     /* RETFIE */
+    memcpy(sfr_shadow , (const void *)host_sim_sfr , sizeof(sfr_shadow));
+    isr_level = l_previous;
+}
+
+static void interrupt_dispatch(void){
+    uint8 l_intcon = SFR_RAW(INTCON);
+    uint8 l_core = core_pending(l_intcon , SFR_RAW(INTCON3));
+    uint8 l_periph1 = SFR_RAW(PIE1) & SFR_RAW(PIR1);
+    uint8 l_periph2 = SFR_RAW(PIE2) & SFR_RAW(PIR2);
+    uint8 l_core_high = ZERO_INIT;
+
+    if(!BITS_RAW(RCON).IPEN){
+        if((ISR_LEVEL_NONE == isr_level) && (NULL != isr_high) && (l_intcon & 0x80) &&
+           ((l_core) || ((l_intcon & 0x40) && (l_periph1 || l_periph2)))){
+            isr_call(isr_high , ISR_LEVEL_HIGH , 0x80);
+        }
+        else{ /* Nothing */ }
+    }
+    else{
+        /* core_pending bits : 0 RB , 1 INT0 , 2 TMR0 , 3 INT1 , 4 INT2 */
+        l_core_high = (uint8)(0x02 | ((BITS_RAW(INTCON2).RBIP) ? 0x01 : 0) | ((BITS_RAW(INTCON2).TMR0IP) ? 0x04 : 0) |
+                              ((BITS_RAW(INTCON3).INT1IP) ? 0x08 : 0) | ((BITS_RAW(INTCON3).INT2IP) ? 0x10 : 0));
+        if((ISR_LEVEL_HIGH != isr_level) && (NULL != isr_high) && (l_intcon & 0x80) &&
+           ((l_core & l_core_high) || (l_periph1 & SFR_RAW(IPR1)) || (l_periph2 & SFR_RAW(IPR2)))){
+            isr_call(isr_high , ISR_LEVEL_HIGH , 0x80);
+        }
+        else if((ISR_LEVEL_NONE == isr_level) && (NULL != isr_low) && ((l_intcon & 0xC0) == 0xC0) &&
+                ((l_core & (uint8)~l_core_high) || (l_periph1 & (uint8)~SFR_RAW(IPR1)) ||
+                 (l_periph2 & (uint8)~SFR_RAW(IPR2)))){
+            isr_call(isr_low , ISR_LEVEL_LOW , 0x40);
+        }
+        else{ /* Nothing */ }
+    }
+}
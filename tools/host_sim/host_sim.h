@@ -0,0 +1,170 @@
+/*
+ * @file    host_sim.h
+ * @brief   Host-side register level model of the PIC18F4620 peripherals
+ *
+ * @details
+ * The drivers are compiled with gcc against include/xc.h , where every
+ * register name is routed through host_sim_sfr_access(). The hook :
+ *  - charges HOST_SIM_SFR_ACCESS_CYCLES instruction cycles to the clock ,
+ *  - applies the side effects of the previous access (TXREG / SSPBUF
+ *    writes , RCREG / SSPBUF reads , SEN / PEN / GO_DONE / WR edges ...) ,
+ *  - steps the peripheral models to the new time ,
+ *  - calls the registered ISR when an enabled flag is pending.
+ *
+ * Modelled : GPIO (LAT / TRIS / PORT , INT0..2 edges , RB change) ,
+ * Timer0/1/2/3 , EUSART async + sync master , MSSP I2C master and SPI master ,
+ * ADC , data EEPROM , interrupt priorities.
+ * Not modelled : slave MSSP modes , CCP capture / compare outputs , flash
+ * self write , oscillator switching (SFRs exist , no behaviour).
+ *
+ * Time is counted in instruction cycles (Fosc / 4). Loop bodies between
+ * two register accesses cost nothing , so cycle counts are a lower bound
+ * that moves with the number of SFR accesses : good for regressions ,
+ * not a cycle accurate replacement of the MPLAB simulator.
+ *
+ * Layer: Tools
+ * Target MCU: PIC18F4620 (host model)
+ *
+ * Author: Abdelmoniem Ahmed
+ * Linkedin: https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * Date: 2026
+ */
+
+#ifndef HOST_SIM_H
+#define	HOST_SIM_H
+
+/* Section : Includes */
+#include <xc.h>
+#include "../../common/std_types.h"
+#include "../../common/device_config.h"
+
+/* Section : Macro Declaration */
+
+#define HOST_SIM_SFR_ACCESS_CYCLES          1UL     /* Cost of one register read or write */
+#define HOST_SIM_DELAY_STEP_CYCLES          16UL    /* Model resolution inside __delay_xx() */
+#define HOST_SIM_SLEEP_LIMIT_CYCLES         (_XTAL_FREQ / 4UL)  /* SLEEP() without wake source returns after 1 s */
+
+#define HOST_SIM_PORT_COUNT                 5       /* PORTA .. PORTE */
+#define HOST_SIM_ADC_CHANNELS               13
+#define HOST_SIM_EEPROM_SIZE                1024
+#define HOST_SIM_FLASH_SIZE                 0x10000UL
+#define HOST_SIM_FLASH_ROW_SIZE             64
+#define HOST_SIM_UART_LOG_SIZE              4096
+#define HOST_SIM_UART_RX_QUEUE_SIZE         256
+#define HOST_SIM_I2C_MAX_DEVICES            8
+
+/* Hardware return stack : STKPTR 0 (empty) .. 31 */
+#define HOST_SIM_STACK_DEPTH                31
+
+#define HOST_SIM_PORTA                      0
+#define HOST_SIM_PORTB                      1
+#define HOST_SIM_PORTC                      2
+#define HOST_SIM_PORTD                      3
+#define HOST_SIM_PORTE                      4
+
+/* Section : Data Types Declarations */
+
+/**
+ * @brief External circuit on a port : returns the input pin levels
+ *
+ * @param port HOST_SIM_PORTA .. HOST_SIM_PORTE
+ * @param lat  Latch of every port , index = port
+ * @param tris Direction of every port , index = port (1 = input)
+ *
+ * @note Lets a test wire pins together , e.g. a keypad matrix whose columns
+ *       read the row that the driver drives low.
+ */
+typedef uint8 (* host_sim_port_hook_t)(uint8 port , const uint8 *lat , const uint8 *tris);
+
+/**
+ * @brief SPI slave : one byte out of SDO , returns the byte on SDI
+ */
+typedef uint8 (* host_sim_spi_exchange_t)(uint8 sent);
+
+/**
+ * @struct host_sim_i2c_device_t
+ * @brief One slave on the simulated I2C bus
+ *
+ * @details
+ * - start : address matched , read = R/W bit , return TRUE to ACK
+ * - write : data byte from the master , return TRUE to ACK
+ * - read  : next byte for the master
+ * - stop  : stop or repeated start ends the transfer , may be NULL
+ * host_sim_i2c_register_file() fills the callbacks for the common
+ * "register pointer then auto-increment" slave (TC74 , DS1307 , EEPROMs).
+ */
+typedef struct host_sim_i2c_device{
+    uint8 address ;                                                     /* 7-bit */
+    uint8 (* start)(struct host_sim_i2c_device *device , uint8 read) ;
+    uint8 (* write)(struct host_sim_i2c_device *device , uint8 data) ;
+    uint8 (* read)(struct host_sim_i2c_device *device) ;
+    void (* stop)(struct host_sim_i2c_device *device) ;
+    uint8 *registers ;
+    uint16 register_count ;
+    uint16 pointer ;
+    uint8 pointer_pending ;
+}host_sim_i2c_device_t;
+
+/* Section : Function Declarations */
+
+/**
+ * @brief Power-on reset : SFRs to their reset values , clock to 0 , models idle
+ * @note  EEPROM contents , attached devices , hooks and ISRs are kept.
+ */
+void host_sim_reset(void);
+
+/**
+ * @brief Register the interrupt vectors
+ *
+ * @param high Vector 0x08 , Interrupt_ManagerHigh / Interrupt_Manager
+ * @param low  Vector 0x18 , Interrupt_Managerlow , may be NULL
+ */
+void host_sim_set_isr(void (* high)(void) , void (* low)(void));
+
+/* Clock */
+uint64 host_sim_cycles(void);
+void host_sim_delay_cycles(unsigned long cycles);
+
+/* GPIO */
+void host_sim_pin_set(uint8 port , uint8 pin , uint8 level);
+void host_sim_port_set(uint8 port , uint8 levels);
+uint8 host_sim_pin_get(uint8 port , uint8 pin);
+void host_sim_set_port_hook(host_sim_port_hook_t hook);
+
+/* EUSART */
+void host_sim_uart_rx_push(const uint8 *data , uint16 length);
+void host_sim_uart_rx_push_frame(uint8 data , uint8 ninth_bit , uint8 framing_error);
+uint16 host_sim_uart_tx_count(void);
+uint16 host_sim_uart_tx_read(uint8 *buffer , uint16 size);
+uint8 host_sim_uart_tx_ninth_bit(void);
+void host_sim_uart_set_line_baudrate(uint32 baudrate);        /* Rate auto-baud measures , 0 = programmed rate */
+
+/* MSSP */
+Std_ReturnType host_sim_i2c_attach(host_sim_i2c_device_t *device);
+void host_sim_i2c_detach_all(void);
+void host_sim_i2c_register_file(host_sim_i2c_device_t *device , uint8 address , uint8 *registers , uint16 register_count);
+void host_sim_spi_set_slave(host_sim_spi_exchange_t exchange);
+
+/* ADC : 10-bit result returned for a channel */
+void host_sim_adc_set(uint8 channel , uint16 value);
+
+/* Data EEPROM */
+uint8 host_sim_eeprom_get(uint16 address);
+void host_sim_eeprom_set(uint16 address , uint8 value);
+uint16 host_sim_eeprom_write_starts(void);                    /* Write cycles started since the first run */
+
+/* Program flash , erased (0xFF) on first use , kept over host_sim_reset() */
+uint8 host_sim_flash_get(uint32 address);
+void host_sim_flash_set(uint32 address , uint8 value);
+
+/* Last asm() text that is not a table read / write (e.g. a goto) , "" when none */
+const char *host_sim_asm_last(void);
+
+/* Return stack : a CALL / RETURN of the simulated code , TOSx follow STKPTR */
+void host_sim_stack_push(void);
+void host_sim_stack_pop(void);
+
+/* Reset requests from RESET() , counted so a test can assert on them */
+uint16 host_sim_reset_requests(void);
+
+#endif	/* HOST_SIM_H */
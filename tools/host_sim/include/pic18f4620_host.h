@@ -0,0 +1,504 @@
+/*
+ * @file    pic18f4620_host.h
+ * @brief   PIC18F4620 special function registers for the host build
+ *
+ * @details
+ * Same names and bit layouts as the XC8 device header , so the drivers
+ * compile unchanged. Every register name expands to a call of
+ * host_sim_sfr_access() : each access advances the simulated clock and
+ * lets the peripheral models react (see host_sim.h).
+ *
+ * Bit fields are unsigned char based , one register = one byte , LSB first
+ * like XC8 on the PIC18.
+ *
+ * Layer: Tools
+ * Target MCU: PIC18F4620 (host model)
+ *
+ * Author: Abdelmoniem Ahmed
+ * Linkedin: https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * Date: 2026
+ */
+
+#ifndef PIC18F4620_HOST_H
+#define	PIC18F4620_HOST_H
+
+/* Section : Macro Declaration */
+
+/* Access bank SFR window : 0xF80 .. 0xFFF */
+#define HOST_SIM_SFR_BASE                   0xF80
+#define HOST_SIM_SFR_SIZE                   0x80
+
+/* Section : Function Declarations */
+
+/**
+ * @brief Hook behind every register name , returns the register cell
+ * @note  Implemented in host_sim.c , never called directly by drivers
+ */
+volatile unsigned char *host_sim_sfr_access(unsigned short address);
+
+/**
+ * @brief Hook behind SSPBUF
+ * @note  SSPBUF reads and writes have different side effects (BF clear vs
+ *        start of a transfer) and a write may repeat the value just read ,
+ *        so the cell is 16-bit : the hook marks the high byte , a write of
+ *        any byte clears the mark.
+ */
+volatile unsigned short *host_sim_sspbuf_access(void);
+
+/**
+ * @brief Hook behind the PORTx / LATx / TRISx lookup tables of hal_gpio.c
+ * @param base HOST_SIM_ADDR_PORTA , HOST_SIM_ADDR_LATA or HOST_SIM_ADDR_TRISA
+ * @note  XC8 takes the register addresses at compile time , the host build
+ *        returns the same 5 entry table after a regular hook call.
+ */
+volatile unsigned char * const *host_sim_port_registers(unsigned short base);
+
+/* Section : Macro Functions Declarations */
+
+#define HOST_SIM_SFR8(_ADDR)                (*host_sim_sfr_access(_ADDR))
+#define HOST_SIM_SFR_BITS(_TYPE , _ADDR)    (*(volatile _TYPE *)host_sim_sfr_access(_ADDR))
+
+/* Section : Register Addresses */
+
+#define HOST_SIM_ADDR_PORTA                0xF80
+#define HOST_SIM_ADDR_PORTB                0xF81
+#define HOST_SIM_ADDR_PORTC                0xF82
+#define HOST_SIM_ADDR_PORTD                0xF83
+#define HOST_SIM_ADDR_PORTE                0xF84
+#define HOST_SIM_ADDR_LATA                 0xF89
+#define HOST_SIM_ADDR_LATB                 0xF8A
+#define HOST_SIM_ADDR_LATC                 0xF8B
+#define HOST_SIM_ADDR_LATD                 0xF8C
+#define HOST_SIM_ADDR_LATE                 0xF8D
+#define HOST_SIM_ADDR_TRISA                0xF92
+#define HOST_SIM_ADDR_TRISB                0xF93
+#define HOST_SIM_ADDR_TRISC                0xF94
+#define HOST_SIM_ADDR_TRISD                0xF95
+#define HOST_SIM_ADDR_TRISE                0xF96
+#define HOST_SIM_ADDR_OSCTUNE              0xF9B
+#define HOST_SIM_ADDR_PIE1                 0xF9D
+#define HOST_SIM_ADDR_PIR1                 0xF9E
+#define HOST_SIM_ADDR_IPR1                 0xF9F
+#define HOST_SIM_ADDR_PIE2                 0xFA0
+#define HOST_SIM_ADDR_PIR2                 0xFA1
+#define HOST_SIM_ADDR_IPR2                 0xFA2
+#define HOST_SIM_ADDR_EECON1               0xFA6
+#define HOST_SIM_ADDR_EECON2               0xFA7
+#define HOST_SIM_ADDR_EEDATA               0xFA8
+#define HOST_SIM_ADDR_EEADR                0xFA9
+#define HOST_SIM_ADDR_EEADRH               0xFAA
+#define HOST_SIM_ADDR_RCSTA                0xFAB
+#define HOST_SIM_ADDR_TXSTA                0xFAC
+#define HOST_SIM_ADDR_TXREG                0xFAD
+#define HOST_SIM_ADDR_RCREG                0xFAE
+#define HOST_SIM_ADDR_SPBRG                0xFAF
+#define HOST_SIM_ADDR_SPBRGH               0xFB0
+#define HOST_SIM_ADDR_T3CON                0xFB1
+#define HOST_SIM_ADDR_TMR3L                0xFB2
+#define HOST_SIM_ADDR_TMR3H                0xFB3
+#define HOST_SIM_ADDR_CMCON                0xFB4
+#define HOST_SIM_ADDR_CVRCON               0xFB5
+#define HOST_SIM_ADDR_ECCP1AS              0xFB6
+#define HOST_SIM_ADDR_PWM1CON              0xFB7
+#define HOST_SIM_ADDR_BAUDCON              0xFB8
+#define HOST_SIM_ADDR_CCP2CON              0xFBA
+#define HOST_SIM_ADDR_CCPR2L               0xFBB
+#define HOST_SIM_ADDR_CCPR2H               0xFBC
+#define HOST_SIM_ADDR_CCP1CON              0xFBD
+#define HOST_SIM_ADDR_CCPR1L               0xFBE
+#define HOST_SIM_ADDR_CCPR1H               0xFBF
+#define HOST_SIM_ADDR_ADCON2               0xFC0
+#define HOST_SIM_ADDR_ADCON1               0xFC1
+#define HOST_SIM_ADDR_ADCON0               0xFC2
+#define HOST_SIM_ADDR_ADRESL               0xFC3
+#define HOST_SIM_ADDR_ADRESH               0xFC4
+#define HOST_SIM_ADDR_SSPCON2              0xFC5
+#define HOST_SIM_ADDR_SSPCON1              0xFC6
+#define HOST_SIM_ADDR_SSPSTAT              0xFC7
+#define HOST_SIM_ADDR_SSPADD               0xFC8
+#define HOST_SIM_ADDR_SSPBUF               0xFC9
+#define HOST_SIM_ADDR_T2CON                0xFCA
+#define HOST_SIM_ADDR_PR2                  0xFCB
+#define HOST_SIM_ADDR_TMR2                 0xFCC
+#define HOST_SIM_ADDR_T1CON                0xFCD
+#define HOST_SIM_ADDR_TMR1L                0xFCE
+#define HOST_SIM_ADDR_TMR1H                0xFCF
+#define HOST_SIM_ADDR_RCON                 0xFD0
+#define HOST_SIM_ADDR_WDTCON               0xFD1
+#define HOST_SIM_ADDR_HLVDCON              0xFD2
+#define HOST_SIM_ADDR_OSCCON               0xFD3
+#define HOST_SIM_ADDR_T0CON                0xFD5
+#define HOST_SIM_ADDR_TMR0L                0xFD6
+#define HOST_SIM_ADDR_TMR0H                0xFD7
+#define HOST_SIM_ADDR_STATUS               0xFD8
+#define HOST_SIM_ADDR_WREG                 0xFE8
+#define HOST_SIM_ADDR_INTCON3              0xFF0
+#define HOST_SIM_ADDR_INTCON2              0xFF1
+#define HOST_SIM_ADDR_INTCON               0xFF2
+#define HOST_SIM_ADDR_PRODL                0xFF3
+#define HOST_SIM_ADDR_PRODH                0xFF4
+#define HOST_SIM_ADDR_TABLAT               0xFF5
+#define HOST_SIM_ADDR_TBLPTRL              0xFF6
+#define HOST_SIM_ADDR_TBLPTRH              0xFF7
+#define HOST_SIM_ADDR_TBLPTRU              0xFF8
+#define HOST_SIM_ADDR_STKPTR               0xFFC
+#define HOST_SIM_ADDR_TOSL                 0xFFD
+#define HOST_SIM_ADDR_TOSH                 0xFFE
+#define HOST_SIM_ADDR_TOSU                 0xFFF
+
+/* Section : Data Types Declarations */
+
+typedef union{
+    struct{ unsigned char RA0:1 ; unsigned char RA1:1 ; unsigned char RA2:1 ; unsigned char RA3:1 ; unsigned char RA4:1 ; unsigned char RA5:1 ; unsigned char RA6:1 ; unsigned char RA7:1 ; };
+}PORTAbits_t;
+
+typedef union{
+    struct{ unsigned char RB0:1 ; unsigned char RB1:1 ; unsigned char RB2:1 ; unsigned char RB3:1 ; unsigned char RB4:1 ; unsigned char RB5:1 ; unsigned char RB6:1 ; unsigned char RB7:1 ; };
+}PORTBbits_t;
+
+typedef union{
+    struct{ unsigned char RC0:1 ; unsigned char RC1:1 ; unsigned char RC2:1 ; unsigned char RC3:1 ; unsigned char RC4:1 ; unsigned char RC5:1 ; unsigned char RC6:1 ; unsigned char RC7:1 ; };
+}PORTCbits_t;
+
+typedef union{
+    struct{ unsigned char RD0:1 ; unsigned char RD1:1 ; unsigned char RD2:1 ; unsigned char RD3:1 ; unsigned char RD4:1 ; unsigned char RD5:1 ; unsigned char RD6:1 ; unsigned char RD7:1 ; };
+}PORTDbits_t;
+
+typedef union{
+    struct{ unsigned char RE0:1 ; unsigned char RE1:1 ; unsigned char RE2:1 ; unsigned char RE3:1 ; unsigned char RE4:1 ; unsigned char RE5:1 ; unsigned char RE6:1 ; unsigned char RE7:1 ; };
+}PORTEbits_t;
+
+typedef union{
+    struct{ unsigned char LATA0:1 ; unsigned char LATA1:1 ; unsigned char LATA2:1 ; unsigned char LATA3:1 ; unsigned char LATA4:1 ; unsigned char LATA5:1 ; unsigned char LATA6:1 ; unsigned char LATA7:1 ; };
+    struct{ unsigned char LA0:1 ; unsigned char LA1:1 ; unsigned char LA2:1 ; unsigned char LA3:1 ; unsigned char LA4:1 ; unsigned char LA5:1 ; unsigned char LA6:1 ; unsigned char LA7:1 ; };
+}LATAbits_t;
+
+typedef union{
+    struct{ unsigned char LATB0:1 ; unsigned char LATB1:1 ; unsigned char LATB2:1 ; unsigned char LATB3:1 ; unsigned char LATB4:1 ; unsigned char LATB5:1 ; unsigned char LATB6:1 ; unsigned char LATB7:1 ; };
+    struct{ unsigned char LB0:1 ; unsigned char LB1:1 ; unsigned char LB2:1 ; unsigned char LB3:1 ; unsigned char LB4:1 ; unsigned char LB5:1 ; unsigned char LB6:1 ; unsigned char LB7:1 ; };
+}LATBbits_t;
+
+typedef union{
+    struct{ unsigned char LATC0:1 ; unsigned char LATC1:1 ; unsigned char LATC2:1 ; unsigned char LATC3:1 ; unsigned char LATC4:1 ; unsigned char LATC5:1 ; unsigned char LATC6:1 ; unsigned char LATC7:1 ; };
+    struct{ unsigned char LC0:1 ; unsigned char LC1:1 ; unsigned char LC2:1 ; unsigned char LC3:1 ; unsigned char LC4:1 ; unsigned char LC5:1 ; unsigned char LC6:1 ; unsigned char LC7:1 ; };
+}LATCbits_t;
+
+typedef union{
+    struct{ unsigned char LATD0:1 ; unsigned char LATD1:1 ; unsigned char LATD2:1 ; unsigned char LATD3:1 ; unsigned char LATD4:1 ; unsigned char LATD5:1 ; unsigned char LATD6:1 ; unsigned char LATD7:1 ; };
+    struct{ unsigned char LD0:1 ; unsigned char LD1:1 ; unsigned char LD2:1 ; unsigned char LD3:1 ; unsigned char LD4:1 ; unsigned char LD5:1 ; unsigned char LD6:1 ; unsigned char LD7:1 ; };
+}LATDbits_t;
+
+typedef union{
+    struct{ unsigned char LATE0:1 ; unsigned char LATE1:1 ; unsigned char LATE2:1 ; unsigned char LATE3:1 ; unsigned char LATE4:1 ; unsigned char LATE5:1 ; unsigned char LATE6:1 ; unsigned char LATE7:1 ; };
+    struct{ unsigned char LE0:1 ; unsigned char LE1:1 ; unsigned char LE2:1 ; unsigned char LE3:1 ; unsigned char LE4:1 ; unsigned char LE5:1 ; unsigned char LE6:1 ; unsigned char LE7:1 ; };
+}LATEbits_t;
+
+typedef union{
+    struct{ unsigned char TRISA0:1 ; unsigned char TRISA1:1 ; unsigned char TRISA2:1 ; unsigned char TRISA3:1 ; unsigned char TRISA4:1 ; unsigned char TRISA5:1 ; unsigned char TRISA6:1 ; unsigned char TRISA7:1 ; };
+    struct{ unsigned char RA0:1 ; unsigned char RA1:1 ; unsigned char RA2:1 ; unsigned char RA3:1 ; unsigned char RA4:1 ; unsigned char RA5:1 ; unsigned char RA6:1 ; unsigned char RA7:1 ; };
+}TRISAbits_t;
+
+typedef union{
+    struct{ unsigned char TRISB0:1 ; unsigned char TRISB1:1 ; unsigned char TRISB2:1 ; unsigned char TRISB3:1 ; unsigned char TRISB4:1 ; unsigned char TRISB5:1 ; unsigned char TRISB6:1 ; unsigned char TRISB7:1 ; };
+    struct{ unsigned char RB0:1 ; unsigned char RB1:1 ; unsigned char RB2:1 ; unsigned char RB3:1 ; unsigned char RB4:1 ; unsigned char RB5:1 ; unsigned char RB6:1 ; unsigned char RB7:1 ; };
+}TRISBbits_t;
+
+typedef union{
+    struct{ unsigned char TRISC0:1 ; unsigned char TRISC1:1 ; unsigned char TRISC2:1 ; unsigned char TRISC3:1 ; unsigned char TRISC4:1 ; unsigned char TRISC5:1 ; unsigned char TRISC6:1 ; unsigned char TRISC7:1 ; };
+    struct{ unsigned char RC0:1 ; unsigned char RC1:1 ; unsigned char RC2:1 ; unsigned char RC3:1 ; unsigned char RC4:1 ; unsigned char RC5:1 ; unsigned char RC6:1 ; unsigned char RC7:1 ; };
+}TRISCbits_t;
+
+typedef union{
+    struct{ unsigned char TRISD0:1 ; unsigned char TRISD1:1 ; unsigned char TRISD2:1 ; unsigned char TRISD3:1 ; unsigned char TRISD4:1 ; unsigned char TRISD5:1 ; unsigned char TRISD6:1 ; unsigned char TRISD7:1 ; };
+    struct{ unsigned char RD0:1 ; unsigned char RD1:1 ; unsigned char RD2:1 ; unsigned char RD3:1 ; unsigned char RD4:1 ; unsigned char RD5:1 ; unsigned char RD6:1 ; unsigned char RD7:1 ; };
+}TRISDbits_t;
+
+typedef union{
+    struct{ unsigned char TRISE0:1 ; unsigned char TRISE1:1 ; unsigned char TRISE2:1 ; unsigned char :1 ; unsigned char PSPMODE:1 ; unsigned char IBOV:1 ; unsigned char OBF:1 ; unsigned char IBF:1 ; };
+    struct{ unsigned char RE0:1 ; unsigned char RE1:1 ; unsigned char RE2:1 ; };
+}TRISEbits_t;
+
+typedef union{
+    struct{ unsigned char TUN:5 ; unsigned char :1 ; unsigned char PLLEN:1 ; unsigned char INTSRC:1 ; };
+}OSCTUNEbits_t;
+
+typedef union{
+    struct{ unsigned char TMR1IE:1 ; unsigned char TMR2IE:1 ; unsigned char CCP1IE:1 ; unsigned char SSPIE:1 ; unsigned char TXIE:1 ; unsigned char RCIE:1 ; unsigned char ADIE:1 ; unsigned char PSPIE:1 ; };
+}PIE1bits_t;
+
+typedef union{
+    struct{ unsigned char TMR1IF:1 ; unsigned char TMR2IF:1 ; unsigned char CCP1IF:1 ; unsigned char SSPIF:1 ; unsigned char TXIF:1 ; unsigned char RCIF:1 ; unsigned char ADIF:1 ; unsigned char PSPIF:1 ; };
+}PIR1bits_t;
+
+typedef union{
+    struct{ unsigned char TMR1IP:1 ; unsigned char TMR2IP:1 ; unsigned char CCP1IP:1 ; unsigned char SSPIP:1 ; unsigned char TXIP:1 ; unsigned char RCIP:1 ; unsigned char ADIP:1 ; unsigned char PSPIP:1 ; };
+}IPR1bits_t;
+
+typedef union{
+    struct{ unsigned char CCP2IE:1 ; unsigned char TMR3IE:1 ; unsigned char HLVDIE:1 ; unsigned char BCLIE:1 ; unsigned char EEIE:1 ; unsigned char :1 ; unsigned char CMIE:1 ; unsigned char OSCFIE:1 ; };
+}PIE2bits_t;
+
+typedef union{
+    struct{ unsigned char CCP2IF:1 ; unsigned char TMR3IF:1 ; unsigned char HLVDIF:1 ; unsigned char BCLIF:1 ; unsigned char EEIF:1 ; unsigned char :1 ; unsigned char CMIF:1 ; unsigned char OSCFIF:1 ; };
+}PIR2bits_t;
+
+typedef union{
+    struct{ unsigned char CCP2IP:1 ; unsigned char TMR3IP:1 ; unsigned char HLVDIP:1 ; unsigned char BCLIP:1 ; unsigned char EEIP:1 ; unsigned char :1 ; unsigned char CMIP:1 ; unsigned char OSCFIP:1 ; };
+}IPR2bits_t;
+
+typedef union{
+    struct{ unsigned char RD:1 ; unsigned char WR:1 ; unsigned char WREN:1 ; unsigned char WRERR:1 ; unsigned char FREE:1 ; unsigned char :1 ; unsigned char CFGS:1 ; unsigned char EEPGD:1 ; };
+}EECON1bits_t;
+
+typedef union{
+    struct{ unsigned char RX9D:1 ; unsigned char OERR:1 ; unsigned char FERR:1 ; unsigned char ADDEN:1 ; unsigned char CREN:1 ; unsigned char SREN:1 ; unsigned char RX9:1 ; unsigned char SPEN:1 ; };
+}RCSTAbits_t;
+
+typedef union{
+    struct{ unsigned char TX9D:1 ; unsigned char TRMT:1 ; unsigned char BRGH:1 ; unsigned char SENDB:1 ; unsigned char SYNC:1 ; unsigned char TXEN:1 ; unsigned char TX9:1 ; unsigned char CSRC:1 ; };
+}TXSTAbits_t;
+
+typedef union{
+    struct{ unsigned char TMR3ON:1 ; unsigned char TMR3CS:1 ; unsigned char T3SYNC:1 ; unsigned char T3CCP1:1 ; unsigned char T3CKPS:2 ; unsigned char T3CCP2:1 ; unsigned char RD16:1 ; };
+}T3CONbits_t;
+
+typedef union{
+    struct{ unsigned char CM:3 ; unsigned char CIS:1 ; unsigned char C1INV:1 ; unsigned char C2INV:1 ; unsigned char C1OUT:1 ; unsigned char C2OUT:1 ; };
+}CMCONbits_t;
+
+typedef union{
+    struct{ unsigned char CVR:4 ; unsigned char CVRSS:1 ; unsigned char CVRR:1 ; unsigned char CVROE:1 ; unsigned char CVREN:1 ; };
+}CVRCONbits_t;
+
+typedef union{
+    struct{ unsigned char ABDEN:1 ; unsigned char WUE:1 ; unsigned char :1 ; unsigned char BRG16:1 ; unsigned char SCKP:1 ; unsigned char :1 ; unsigned char RCIDL:1 ; unsigned char ABDOVF:1 ; };
+}BAUDCONbits_t;
+
+typedef union{
+    struct{ unsigned char CCP2M:4 ; unsigned char DC2B:2 ; unsigned char :2 ; };
+}CCP2CONbits_t;
+
+typedef union{
+    struct{ unsigned char CCP1M:4 ; unsigned char DC1B:2 ; unsigned char P1M:2 ; };
+}CCP1CONbits_t;
+
+typedef union{
+    struct{ unsigned char ADCS:3 ; unsigned char ACQT:3 ; unsigned char :1 ; unsigned char ADFM:1 ; };
+}ADCON2bits_t;
+
+typedef union{
+    struct{ unsigned char PCFG:4 ; unsigned char VCFG0:1 ; unsigned char VCFG1:1 ; unsigned char :2 ; };
+}ADCON1bits_t;
+
+typedef union{
+    struct{ unsigned char ADON:1 ; unsigned char GO_DONE:1 ; unsigned char CHS:4 ; unsigned char :2 ; };
+    struct{ unsigned char :1 ; unsigned char GODONE:1 ; };
+    struct{ unsigned char :1 ; unsigned char GO:1 ; };
+}ADCON0bits_t;
+
+typedef union{
+    struct{ unsigned char SEN:1 ; unsigned char RSEN:1 ; unsigned char PEN:1 ; unsigned char RCEN:1 ; unsigned char ACKEN:1 ; unsigned char ACKDT:1 ; unsigned char ACKSTAT:1 ; unsigned char GCEN:1 ; };
+}SSPCON2bits_t;
+
+typedef union{
+    struct{ unsigned char SSPM:4 ; unsigned char CKP:1 ; unsigned char SSPEN:1 ; unsigned char SSPOV:1 ; unsigned char WCOL:1 ; };
+}SSPCON1bits_t;
+
+typedef union{
+    struct{ unsigned char BF:1 ; unsigned char UA:1 ; unsigned char R_W:1 ; unsigned char S:1 ; unsigned char P:1 ; unsigned char D_A:1 ; unsigned char CKE:1 ; unsigned char SMP:1 ; };
+    struct{ unsigned char :2 ; unsigned char R_nW:1 ; unsigned char :2 ; unsigned char D_nA:1 ; };
+}SSPSTATbits_t;
+
+typedef union{
+    struct{ unsigned char T2CKPS:2 ; unsigned char TMR2ON:1 ; unsigned char TOUTPS:4 ; unsigned char :1 ; };
+}T2CONbits_t;
+
+typedef union{
+    struct{ unsigned char TMR1ON:1 ; unsigned char TMR1CS:1 ; unsigned char T1SYNC:1 ; unsigned char T1OSCEN:1 ; unsigned char T1CKPS:2 ; unsigned char T1RUN:1 ; unsigned char RD16:1 ; };
+}T1CONbits_t;
+
+typedef union{
+    struct{ unsigned char BOR:1 ; unsigned char POR:1 ; unsigned char PD:1 ; unsigned char TO:1 ; unsigned char RI:1 ; unsigned char :1 ; unsigned char SBOREN:1 ; unsigned char IPEN:1 ; };
+}RCONbits_t;
+
+typedef union{
+    struct{ unsigned char SWDTEN:1 ; unsigned char :7 ; };
+}WDTCONbits_t;
+
+typedef union{
+    struct{ unsigned char HLVDL:4 ; unsigned char HLVDEN:1 ; unsigned char IRVST:1 ; unsigned char :1 ; unsigned char VDIRMAG:1 ; };
+}HLVDCONbits_t;
+
+typedef union{
+    struct{ unsigned char SCS:2 ; unsigned char IOFS:1 ; unsigned char OSTS:1 ; unsigned char IRCF:3 ; unsigned char IDLEN:1 ; };
+}OSCCONbits_t;
+
+typedef union{
+    struct{ unsigned char T0PS:3 ; unsigned char PSA:1 ; unsigned char T0SE:1 ; unsigned char T0CS:1 ; unsigned char T08BIT:1 ; unsigned char TMR0ON:1 ; };
+}T0CONbits_t;
+
+typedef union{
+    struct{ unsigned char C:1 ; unsigned char DC:1 ; unsigned char Z:1 ; unsigned char OV:1 ; unsigned char N:1 ; unsigned char :3 ; };
+}STATUSbits_t;
+
+typedef union{
+    struct{ unsigned char INT1IF:1 ; unsigned char INT2IF:1 ; unsigned char :1 ; unsigned char INT1IE:1 ; unsigned char INT2IE:1 ; unsigned char :1 ; unsigned char INT1IP:1 ; unsigned char INT2IP:1 ; };
+}INTCON3bits_t;
+
+typedef union{
+    struct{ unsigned char RBIP:1 ; unsigned char :1 ; unsigned char TMR0IP:1 ; unsigned char :1 ; unsigned char INTEDG2:1 ; unsigned char INTEDG1:1 ; unsigned char INTEDG0:1 ; unsigned char RBPU:1 ; };
+}INTCON2bits_t;
+
+typedef union{
+    struct{ unsigned char RBIF:1 ; unsigned char INT0IF:1 ; unsigned char TMR0IF:1 ; unsigned char RBIE:1 ; unsigned char INT0IE:1 ; unsigned char TMR0IE:1 ; unsigned char PEIE:1 ; unsigned char GIE:1 ; };
+    struct{ unsigned char :6 ; unsigned char GIEL:1 ; unsigned char GIEH:1 ; };
+}INTCONbits_t;
+
+typedef union{
+    struct{ unsigned char SP0:1 ; unsigned char SP1:1 ; unsigned char SP2:1 ; unsigned char SP3:1 ; unsigned char SP4:1 ; unsigned char :1 ; unsigned char STKUNF:1 ; unsigned char STKFUL:1 ; };
+    struct{ unsigned char STKPTR0:1 ; unsigned char STKPTR1:1 ; unsigned char STKPTR2:1 ; unsigned char STKPTR3:1 ; unsigned char STKPTR4:1 ; unsigned char :2 ; unsigned char STKOVF:1 ; };
+}STKPTRbits_t;
+
+/* Section : Registers */
+
+/* host_sim.c defines HOST_SIM_MODEL and works on the raw cells instead */
+#ifndef HOST_SIM_MODEL
+
+#define PORTA                    HOST_SIM_SFR8(HOST_SIM_ADDR_PORTA)
+#define PORTAbits                HOST_SIM_SFR_BITS(PORTAbits_t , HOST_SIM_ADDR_PORTA)
+#define PORTB                    HOST_SIM_SFR8(HOST_SIM_ADDR_PORTB)
+#define PORTBbits                HOST_SIM_SFR_BITS(PORTBbits_t , HOST_SIM_ADDR_PORTB)
+#define PORTC                    HOST_SIM_SFR8(HOST_SIM_ADDR_PORTC)
+#define PORTCbits                HOST_SIM_SFR_BITS(PORTCbits_t , HOST_SIM_ADDR_PORTC)
+#define PORTD                    HOST_SIM_SFR8(HOST_SIM_ADDR_PORTD)
+#define PORTDbits                HOST_SIM_SFR_BITS(PORTDbits_t , HOST_SIM_ADDR_PORTD)
+#define PORTE                    HOST_SIM_SFR8(HOST_SIM_ADDR_PORTE)
+#define PORTEbits                HOST_SIM_SFR_BITS(PORTEbits_t , HOST_SIM_ADDR_PORTE)
+#define LATA                     HOST_SIM_SFR8(HOST_SIM_ADDR_LATA)
+#define LATAbits                 HOST_SIM_SFR_BITS(LATAbits_t , HOST_SIM_ADDR_LATA)
+#define LATB                     HOST_SIM_SFR8(HOST_SIM_ADDR_LATB)
+#define LATBbits                 HOST_SIM_SFR_BITS(LATBbits_t , HOST_SIM_ADDR_LATB)
+#define LATC                     HOST_SIM_SFR8(HOST_SIM_ADDR_LATC)
+#define LATCbits                 HOST_SIM_SFR_BITS(LATCbits_t , HOST_SIM_ADDR_LATC)
+#define LATD                     HOST_SIM_SFR8(HOST_SIM_ADDR_LATD)
+#define LATDbits                 HOST_SIM_SFR_BITS(LATDbits_t , HOST_SIM_ADDR_LATD)
+#define LATE                     HOST_SIM_SFR8(HOST_SIM_ADDR_LATE)
+#define LATEbits                 HOST_SIM_SFR_BITS(LATEbits_t , HOST_SIM_ADDR_LATE)
+#define TRISA                    HOST_SIM_SFR8(HOST_SIM_ADDR_TRISA)
+#define TRISAbits                HOST_SIM_SFR_BITS(TRISAbits_t , HOST_SIM_ADDR_TRISA)
+#define TRISB                    HOST_SIM_SFR8(HOST_SIM_ADDR_TRISB)
+#define TRISBbits                HOST_SIM_SFR_BITS(TRISBbits_t , HOST_SIM_ADDR_TRISB)
+#define TRISC                    HOST_SIM_SFR8(HOST_SIM_ADDR_TRISC)
+#define TRISCbits                HOST_SIM_SFR_BITS(TRISCbits_t , HOST_SIM_ADDR_TRISC)
+#define TRISD                    HOST_SIM_SFR8(HOST_SIM_ADDR_TRISD)
+#define TRISDbits                HOST_SIM_SFR_BITS(TRISDbits_t , HOST_SIM_ADDR_TRISD)
+#define TRISE                    HOST_SIM_SFR8(HOST_SIM_ADDR_TRISE)
+#define TRISEbits                HOST_SIM_SFR_BITS(TRISEbits_t , HOST_SIM_ADDR_TRISE)
+#define OSCTUNE                  HOST_SIM_SFR8(HOST_SIM_ADDR_OSCTUNE)
+#define OSCTUNEbits              HOST_SIM_SFR_BITS(OSCTUNEbits_t , HOST_SIM_ADDR_OSCTUNE)
+#define PIE1                     HOST_SIM_SFR8(HOST_SIM_ADDR_PIE1)
+#define PIE1bits                 HOST_SIM_SFR_BITS(PIE1bits_t , HOST_SIM_ADDR_PIE1)
+#define PIR1                     HOST_SIM_SFR8(HOST_SIM_ADDR_PIR1)
+#define PIR1bits                 HOST_SIM_SFR_BITS(PIR1bits_t , HOST_SIM_ADDR_PIR1)
+#define IPR1                     HOST_SIM_SFR8(HOST_SIM_ADDR_IPR1)
+#define IPR1bits                 HOST_SIM_SFR_BITS(IPR1bits_t , HOST_SIM_ADDR_IPR1)
+#define PIE2                     HOST_SIM_SFR8(HOST_SIM_ADDR_PIE2)
+#define PIE2bits                 HOST_SIM_SFR_BITS(PIE2bits_t , HOST_SIM_ADDR_PIE2)
+#define PIR2                     HOST_SIM_SFR8(HOST_SIM_ADDR_PIR2)
+#define PIR2bits                 HOST_SIM_SFR_BITS(PIR2bits_t , HOST_SIM_ADDR_PIR2)
+#define IPR2                     HOST_SIM_SFR8(HOST_SIM_ADDR_IPR2)
+#define IPR2bits                 HOST_SIM_SFR_BITS(IPR2bits_t , HOST_SIM_ADDR_IPR2)
+#define EECON1                   HOST_SIM_SFR8(HOST_SIM_ADDR_EECON1)
+#define EECON1bits               HOST_SIM_SFR_BITS(EECON1bits_t , HOST_SIM_ADDR_EECON1)
+#define EECON2                   HOST_SIM_SFR8(HOST_SIM_ADDR_EECON2)
+#define EEDATA                   HOST_SIM_SFR8(HOST_SIM_ADDR_EEDATA)
+#define EEADR                    HOST_SIM_SFR8(HOST_SIM_ADDR_EEADR)
+#define EEADRH                   HOST_SIM_SFR8(HOST_SIM_ADDR_EEADRH)
+#define RCSTA                    HOST_SIM_SFR8(HOST_SIM_ADDR_RCSTA)
+#define RCSTAbits                HOST_SIM_SFR_BITS(RCSTAbits_t , HOST_SIM_ADDR_RCSTA)
+#define TXSTA                    HOST_SIM_SFR8(HOST_SIM_ADDR_TXSTA)
+#define TXSTAbits                HOST_SIM_SFR_BITS(TXSTAbits_t , HOST_SIM_ADDR_TXSTA)
+#define TXREG                    HOST_SIM_SFR8(HOST_SIM_ADDR_TXREG)
+#define RCREG                    HOST_SIM_SFR8(HOST_SIM_ADDR_RCREG)
+#define SPBRG                    HOST_SIM_SFR8(HOST_SIM_ADDR_SPBRG)
+#define SPBRGH                   HOST_SIM_SFR8(HOST_SIM_ADDR_SPBRGH)
+#define T3CON                    HOST_SIM_SFR8(HOST_SIM_ADDR_T3CON)
+#define T3CONbits                HOST_SIM_SFR_BITS(T3CONbits_t , HOST_SIM_ADDR_T3CON)
+#define TMR3L                    HOST_SIM_SFR8(HOST_SIM_ADDR_TMR3L)
+#define TMR3H                    HOST_SIM_SFR8(HOST_SIM_ADDR_TMR3H)
+#define CMCON                    HOST_SIM_SFR8(HOST_SIM_ADDR_CMCON)
+#define CMCONbits                HOST_SIM_SFR_BITS(CMCONbits_t , HOST_SIM_ADDR_CMCON)
+#define CVRCON                   HOST_SIM_SFR8(HOST_SIM_ADDR_CVRCON)
+#define CVRCONbits               HOST_SIM_SFR_BITS(CVRCONbits_t , HOST_SIM_ADDR_CVRCON)
+#define ECCP1AS                  HOST_SIM_SFR8(HOST_SIM_ADDR_ECCP1AS)
+#define PWM1CON                  HOST_SIM_SFR8(HOST_SIM_ADDR_PWM1CON)
+#define BAUDCON                  HOST_SIM_SFR8(HOST_SIM_ADDR_BAUDCON)
+#define BAUDCONbits              HOST_SIM_SFR_BITS(BAUDCONbits_t , HOST_SIM_ADDR_BAUDCON)
+#define CCP2CON                  HOST_SIM_SFR8(HOST_SIM_ADDR_CCP2CON)
+#define CCP2CONbits              HOST_SIM_SFR_BITS(CCP2CONbits_t , HOST_SIM_ADDR_CCP2CON)
+#define CCPR2L                   HOST_SIM_SFR8(HOST_SIM_ADDR_CCPR2L)
+#define CCPR2H                   HOST_SIM_SFR8(HOST_SIM_ADDR_CCPR2H)
+#define CCP1CON                  HOST_SIM_SFR8(HOST_SIM_ADDR_CCP1CON)
+#define CCP1CONbits              HOST_SIM_SFR_BITS(CCP1CONbits_t , HOST_SIM_ADDR_CCP1CON)
+#define CCPR1L                   HOST_SIM_SFR8(HOST_SIM_ADDR_CCPR1L)
+#define CCPR1H                   HOST_SIM_SFR8(HOST_SIM_ADDR_CCPR1H)
+#define ADCON2                   HOST_SIM_SFR8(HOST_SIM_ADDR_ADCON2)
+#define ADCON2bits               HOST_SIM_SFR_BITS(ADCON2bits_t , HOST_SIM_ADDR_ADCON2)
+#define ADCON1                   HOST_SIM_SFR8(HOST_SIM_ADDR_ADCON1)
+#define ADCON1bits               HOST_SIM_SFR_BITS(ADCON1bits_t , HOST_SIM_ADDR_ADCON1)
+#define ADCON0                   HOST_SIM_SFR8(HOST_SIM_ADDR_ADCON0)
+#define ADCON0bits               HOST_SIM_SFR_BITS(ADCON0bits_t , HOST_SIM_ADDR_ADCON0)
+#define ADRESL                   HOST_SIM_SFR8(HOST_SIM_ADDR_ADRESL)
+#define ADRESH                   HOST_SIM_SFR8(HOST_SIM_ADDR_ADRESH)
+#define SSPCON2                  HOST_SIM_SFR8(HOST_SIM_ADDR_SSPCON2)
+#define SSPCON2bits              HOST_SIM_SFR_BITS(SSPCON2bits_t , HOST_SIM_ADDR_SSPCON2)
+#define SSPCON1                  HOST_SIM_SFR8(HOST_SIM_ADDR_SSPCON1)
+#define SSPCON1bits              HOST_SIM_SFR_BITS(SSPCON1bits_t , HOST_SIM_ADDR_SSPCON1)
+#define SSPSTAT                  HOST_SIM_SFR8(HOST_SIM_ADDR_SSPSTAT)
+#define SSPSTATbits              HOST_SIM_SFR_BITS(SSPSTATbits_t , HOST_SIM_ADDR_SSPSTAT)
+#define SSPADD                   HOST_SIM_SFR8(HOST_SIM_ADDR_SSPADD)
+#define SSPBUF                   (*host_sim_sspbuf_access())
+#define T2CON                    HOST_SIM_SFR8(HOST_SIM_ADDR_T2CON)
+#define T2CONbits                HOST_SIM_SFR_BITS(T2CONbits_t , HOST_SIM_ADDR_T2CON)
+#define PR2                      HOST_SIM_SFR8(HOST_SIM_ADDR_PR2)
+#define TMR2                     HOST_SIM_SFR8(HOST_SIM_ADDR_TMR2)
+#define T1CON                    HOST_SIM_SFR8(HOST_SIM_ADDR_T1CON)
+#define T1CONbits                HOST_SIM_SFR_BITS(T1CONbits_t , HOST_SIM_ADDR_T1CON)
+#define TMR1L                    HOST_SIM_SFR8(HOST_SIM_ADDR_TMR1L)
+#define TMR1H                    HOST_SIM_SFR8(HOST_SIM_ADDR_TMR1H)
+#define RCON                     HOST_SIM_SFR8(HOST_SIM_ADDR_RCON)
+#define RCONbits                 HOST_SIM_SFR_BITS(RCONbits_t , HOST_SIM_ADDR_RCON)
+#define WDTCON                   HOST_SIM_SFR8(HOST_SIM_ADDR_WDTCON)
+#define WDTCONbits               HOST_SIM_SFR_BITS(WDTCONbits_t , HOST_SIM_ADDR_WDTCON)
+#define HLVDCON                  HOST_SIM_SFR8(HOST_SIM_ADDR_HLVDCON)
+#define HLVDCONbits              HOST_SIM_SFR_BITS(HLVDCONbits_t , HOST_SIM_ADDR_HLVDCON)
+#define OSCCON                   HOST_SIM_SFR8(HOST_SIM_ADDR_OSCCON)
+#define OSCCONbits               HOST_SIM_SFR_BITS(OSCCONbits_t , HOST_SIM_ADDR_OSCCON)
+#define T0CON                    HOST_SIM_SFR8(HOST_SIM_ADDR_T0CON)
+#define T0CONbits                HOST_SIM_SFR_BITS(T0CONbits_t , HOST_SIM_ADDR_T0CON)
+#define TMR0L                    HOST_SIM_SFR8(HOST_SIM_ADDR_TMR0L)
+#define TMR0H                    HOST_SIM_SFR8(HOST_SIM_ADDR_TMR0H)
+#define STATUS                   HOST_SIM_SFR8(HOST_SIM_ADDR_STATUS)
+#define STATUSbits               HOST_SIM_SFR_BITS(STATUSbits_t , HOST_SIM_ADDR_STATUS)
+#define WREG                     HOST_SIM_SFR8(HOST_SIM_ADDR_WREG)
+#define INTCON3                  HOST_SIM_SFR8(HOST_SIM_ADDR_INTCON3)
+#define INTCON3bits              HOST_SIM_SFR_BITS(INTCON3bits_t , HOST_SIM_ADDR_INTCON3)
+#define INTCON2                  HOST_SIM_SFR8(HOST_SIM_ADDR_INTCON2)
+#define INTCON2bits              HOST_SIM_SFR_BITS(INTCON2bits_t , HOST_SIM_ADDR_INTCON2)
+#define INTCON                   HOST_SIM_SFR8(HOST_SIM_ADDR_INTCON)
+#define INTCONbits               HOST_SIM_SFR_BITS(INTCONbits_t , HOST_SIM_ADDR_INTCON)
+#define PRODL                    HOST_SIM_SFR8(HOST_SIM_ADDR_PRODL)
+#define PRODH                    HOST_SIM_SFR8(HOST_SIM_ADDR_PRODH)
+#define TABLAT                   HOST_SIM_SFR8(HOST_SIM_ADDR_TABLAT)
+#define TBLPTRL                  HOST_SIM_SFR8(HOST_SIM_ADDR_TBLPTRL)
+#define TBLPTRH                  HOST_SIM_SFR8(HOST_SIM_ADDR_TBLPTRH)
+#define TBLPTRU                  HOST_SIM_SFR8(HOST_SIM_ADDR_TBLPTRU)
+#define STKPTR                   HOST_SIM_SFR8(HOST_SIM_ADDR_STKPTR)
+#define STKPTRbits               HOST_SIM_SFR_BITS(STKPTRbits_t , HOST_SIM_ADDR_STKPTR)
+#define TOSL                     HOST_SIM_SFR8(HOST_SIM_ADDR_TOSL)
+#define TOSH                     HOST_SIM_SFR8(HOST_SIM_ADDR_TOSH)
+#define TOSU                     HOST_SIM_SFR8(HOST_SIM_ADDR_TOSU)
+
+#endif /* HOST_SIM_MODEL */
+
+#endif	/* PIC18F4620_HOST_H */
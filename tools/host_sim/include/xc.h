@@ -0,0 +1,71 @@
+/*
+ * @file    xc.h
+ * @brief   Host replacement of the XC8 <xc.h> for the simulation build
+ *
+ * @details
+ * Put tools/host_sim/include first on the include path : common/compiler.h
+ * then picks this file instead of the XC8 one. It maps the register names
+ * to the host SFR model and the XC8 built-ins (delays , NOP , SLEEP ,
+ * interrupt qualifiers , table read / write asm) to their host
+ * equivalents , so the drivers build with gcc unchanged.
+ *
+ * Layer: Tools
+ * Target MCU: PIC18F4620 (host model)
+ *
+ * Author: Abdelmoniem Ahmed
+ * Linkedin: https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * Date: 2026
+ */
+
+#ifndef HOST_SIM_XC_H
+#define	HOST_SIM_XC_H
+
+/* Section : Macro Declaration */
+
+/* Selects the host integer widths in common/std_types.h */
+#define HOST_SIM_BUILD
+
+/* Section : Includes */
+#include "pic18f4620_host.h"
+
+/* Section : Function Declarations */
+
+/* Cycle model entry points used by the built-ins below (host_sim.c) */
+void host_sim_delay_cycles(unsigned long cycles);
+void host_sim_sleep(void);
+void host_sim_reset_request(void);
+void host_sim_asm(const char *text);
+
+/* Section : Macro Functions Declarations */
+
+/* Interrupt and placement qualifiers have no meaning on the host */
+#define __interrupt(...)
+#define __at(_ADDR)
+#define __section(_NAME)
+#define __persistent
+#define __far
+#define __near
+#define __reentrant
+#define __nonreentrant
+
+/* Busy waits become simulated time , _XTAL_FREQ comes from device_config.h */
+#define __delay_ms(_X)              host_sim_delay_cycles((unsigned long)(_X) * (_XTAL_FREQ / 4000UL))
+#define __delay_us(_X)              host_sim_delay_cycles((unsigned long)(_X) * (_XTAL_FREQ / 4000000UL))
+#define _delay(_X)                  host_sim_delay_cycles((unsigned long)(_X))
+
+#define NOP()                       host_sim_delay_cycles(1UL)
+#define Nop()                       NOP()
+#define CLRWDT()                    host_sim_delay_cycles(1UL)
+#define SLEEP()                     host_sim_sleep()
+#define RESET()                     host_sim_reset_request()
+
+/* Inline assembly : TBLRD / TBLWT act on the flash model , other text is only recorded */
+#define asm(_TEXT)                  host_sim_asm(_TEXT)
+#define __asm(_TEXT)                host_sim_asm(_TEXT)
+#define ___mkstr1(_X)               #_X
+#define ___mkstr(_X)                ___mkstr1(_X)
+
+#define di()                        (INTCONbits.GIE = 0)
+#define ei()                        (INTCONbits.GIE = 1)
+
+#endif	/* HOST_SIM_XC_H */
@@ -0,0 +1,40 @@
+#!/bin/sh
+# Build the host library , then build and run every tests/test_*.c
+#
+# Usage : tools/host_sim/run_tests.sh [extra gcc flags]
+#   e.g.  tools/host_sim/run_tests.sh -O2 -fsanitize=address,undefined
+#
+# The flags go to the library and to the tests. Each test runs under
+# timeout (a poll on a flag nothing sets never ends). Exit status is the
+# number of failed tests , 0 when all passed.
+set -e
+
+SIM_DIR=$(cd "$(dirname "$0")" && pwd)
+REPO=$(cd "$SIM_DIR/../.." && pwd)
+OUT="$REPO/_host_build/tests"
+TIMEOUT=${HOST_SIM_TEST_TIMEOUT:-120}
+
+"$SIM_DIR/build_host_lib.sh" "$@" > /dev/null
+CFLAGS=$("$SIM_DIR/build_host_lib.sh" --cflags)
+mkdir -p "$OUT"
+
+set +e
+failed=0
+for src in "$SIM_DIR"/tests/test_*.c; do
+    name=$(basename "$src" .c)
+    if ! gcc $CFLAGS "$@" -I"$SIM_DIR/tests" "$src" "$REPO/_host_build/libhost_sim.a" -lm -o "$OUT/$name"; then
+        echo "FAIL $name (build)"
+        failed=$((failed + 1))
+        continue
+    fi
+    if timeout "$TIMEOUT" "$OUT/$name" > "$OUT/$name.log" 2>&1; then
+        echo "PASS $name"
+    else
+        echo "FAIL $name"
+        cat "$OUT/$name.log"
+        failed=$((failed + 1))
+    fi
+done
+
+echo "$failed test(s) failed"
+exit $failed
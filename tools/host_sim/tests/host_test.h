@@ -0,0 +1,58 @@
+/*
+ * @file    host_test.h
+ * @brief   Minimal check macros for the host_sim test programs
+ * @details
+ * Each test program is one executable. HOST_TEST_CHECK() records a failed
+ * condition with its file and line and goes on , HOST_TEST_EXIT() prints the
+ * summary and gives the process exit code (0 = every check passed) that
+ * run_tests.sh collects.
+ * Layer: Tools
+ * Target MCU: PIC18F4620 (host model)
+ * Author: Abdelmoniem Ahmed
+ * Linkedin: https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * Date: 2026
+ */
+
+#ifndef HOST_TEST_H
+#define	HOST_TEST_H
+
+/* Section : Includes */
+#include <stdio.h>
+#include "host_sim.h"
+
+/* Section : Macro Declaration */
+
+/* Section : Macro Functions Declarations */
+
+#define HOST_TEST_CHECK(_COND)                                                      \
+    do{                                                                             \
+        host_test_checks++;                                                         \
+        if(!(_COND)){                                                               \
+            host_test_failures++;                                                   \
+            printf("%s:%d: check failed : %s\n" , __FILE__ , __LINE__ , #_COND);   \
+        }                                                                           \
+    }while(0)
+
+#define HOST_TEST_CHECK_EQ(_ACTUAL , _EXPECTED)                                     \
+    do{                                                                             \
+        long _actual = (long)(_ACTUAL) , _expected = (long)(_EXPECTED);             \
+        host_test_checks++;                                                         \
+        if(_actual != _expected){                                                   \
+            host_test_failures++;                                                   \
+            printf("%s:%d: check failed : %s == %ld , expected %ld\n" ,             \
+                   __FILE__ , __LINE__ , #_ACTUAL , _actual , _expected);           \
+        }                                                                           \
+    }while(0)
+
+/* Exit code of main() : 0 when every check passed */
+#define HOST_TEST_EXIT()                                                            \
+    (printf("%s : %u checks , %u failed\n" , __FILE__ , host_test_checks ,          \
+            host_test_failures) , ((0U == host_test_failures) ? 0 : 1))
+
+/* Section : Data Types Declarations */
+
+/* One pair per test program , the header is included once */
+static unsigned host_test_checks = 0;
+static unsigned host_test_failures = 0;
+
+#endif	/* HOST_TEST_H */
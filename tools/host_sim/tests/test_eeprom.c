@@ -0,0 +1,129 @@
+/*
+ * @file    test_eeprom.c
+ * @brief   Data EEPROM queued writer next to blocking writes and flash cycles
+ * @details
+ * A blocking Data_EEPROM_Write_Byte() or a flash erase / write ends with
+ * EEIF set. Data_EEPROM_Submit_Write() must not take that flag for the end
+ * of its own first cycle : exactly one write cycle starts at submit , and
+ * every byte of the request is written once. host_sim_eeprom_write_starts()
+ * counts the write cycles the model started.
+ * Layer: Tools
+ * Target MCU: PIC18F4620 (host model)
+ * Author: Abdelmoniem Ahmed
+ * Linkedin: https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * Date: 2026
+ */
+
+#include <string.h>
+#include "host_test.h"
+#include "hal_eeprom.h"
+#include "hal_flash.h"
+#include "mcal_interrupt_manager.h"
+
+/* Vector 0x08 , defined in mcal_interrupt_manager.c without a prototype */
+void Interrupt_Manager(void);
+
+#define EEPROM_REQUEST_ADDRESS  0x20
+#define EEPROM_REQUEST_LENGTH   4
+#define EEPROM_BYTE_ADDRESS     0x10
+#define EEPROM_FLASH_ROW        0x8000UL
+
+/* Longer than EEPROM_REQUEST_LENGTH cycles of 4 ms */
+#define EEPROM_IDLE_POLL_MAX    200
+#define EEPROM_IDLE_POLL_CYCLES 1000
+
+#if     INTERRUPT_FEATURE_ENABLE == DATA_EEPROM_INTERRUPT_FEATURE_ENABLE
+static uint8 request_data[EEPROM_REQUEST_LENGTH];
+static data_eeprom_write_t request;
+
+static void eeprom_restart(uint8 seed){
+    uint8 index = 0;
+
+    host_sim_reset();
+    host_sim_set_isr(Interrupt_Manager , NULL);
+    for(index = 0 ; index < EEPROM_REQUEST_LENGTH ; index++){
+        host_sim_eeprom_set(EEPROM_REQUEST_ADDRESS + index , 0xFF);
+        request_data[index] = (uint8)(seed + index);
+    }
+    memset(&request , 0 , sizeof(request));
+    request.data = request_data;
+    request.address = EEPROM_REQUEST_ADDRESS;
+    request.length = EEPROM_REQUEST_LENGTH;
+    INTERRUPT_PeripheralInterruptEnable();
+    INTERRUPT_GlobalInterruptEnable();
+}
+
+static void eeprom_wait_idle(void){
+    uint8 idle = FALSE;
+    unsigned polls = 0;
+
+    for(polls = 0 ; (polls < EEPROM_IDLE_POLL_MAX) && (FALSE == idle) ; polls++){
+        host_sim_delay_cycles(EEPROM_IDLE_POLL_CYCLES);
+        HOST_TEST_CHECK_EQ(Data_EEPROM_Is_Idle(&idle) , E_OK);
+    }
+    HOST_TEST_CHECK_EQ(idle , TRUE);
+}
+
+/* Submit with EEIF left over : one cycle starts , the request lands whole */
+static void eeprom_submit_checked(void){
+    uint16 starts = 0;
+    uint8 index = 0;
+
+    HOST_TEST_CHECK_EQ(PIR2bits.EEIF , 0);
+    starts = host_sim_eeprom_write_starts();
+    HOST_TEST_CHECK_EQ(Data_EEPROM_Submit_Write(&request) , E_OK);
+    /* SFR access first : a pending EEIF is dispatched on it */
+    HOST_TEST_CHECK_EQ(EECON1bits.WR , 1);
+    HOST_TEST_CHECK_EQ(host_sim_eeprom_write_starts() - starts , 1);
+    eeprom_wait_idle();
+    HOST_TEST_CHECK_EQ(request.status , DATA_EEPROM_WRITE_DONE);
+    HOST_TEST_CHECK_EQ(request.written_count , EEPROM_REQUEST_LENGTH);
+    HOST_TEST_CHECK_EQ(host_sim_eeprom_write_starts() - starts , EEPROM_REQUEST_LENGTH);
+    for(index = 0 ; index < EEPROM_REQUEST_LENGTH ; index++){
+        HOST_TEST_CHECK_EQ(host_sim_eeprom_get(EEPROM_REQUEST_ADDRESS + index) , request_data[index]);
+    }
+}
+
+static void test_write_byte_then_submit(void){
+    eeprom_restart(0x10);
+    HOST_TEST_CHECK_EQ(Data_EEPROM_Write_Byte(EEPROM_BYTE_ADDRESS , 0x5A) , E_OK);
+    eeprom_submit_checked();
+    HOST_TEST_CHECK_EQ(host_sim_eeprom_get(EEPROM_BYTE_ADDRESS) , 0x5A);
+}
+
+static void test_flash_then_submit(void){
+    eeprom_restart(0x20);
+    HOST_TEST_CHECK_EQ(Flash_Erase_Row(EEPROM_FLASH_ROW) , E_OK);
+    eeprom_submit_checked();
+}
+
+/* A blocking write in the middle of a queued request holds the writer off , then restarts it */
+static void test_write_byte_during_request(void){
+    uint16 starts = 0;
+    uint8 index = 0;
+
+    eeprom_restart(0x30);
+    starts = host_sim_eeprom_write_starts();
+    HOST_TEST_CHECK_EQ(Data_EEPROM_Submit_Write(&request) , E_OK);
+    HOST_TEST_CHECK_EQ(Data_EEPROM_Write_Byte(EEPROM_BYTE_ADDRESS , 0xA5) , E_OK);
+    eeprom_wait_idle();
+    HOST_TEST_CHECK_EQ(request.status , DATA_EEPROM_WRITE_DONE);
+    HOST_TEST_CHECK_EQ(request.written_count , EEPROM_REQUEST_LENGTH);
+    HOST_TEST_CHECK_EQ(host_sim_eeprom_write_starts() - starts , EEPROM_REQUEST_LENGTH + 1);
+    HOST_TEST_CHECK_EQ(host_sim_eeprom_get(EEPROM_BYTE_ADDRESS) , 0xA5);
+    for(index = 0 ; index < EEPROM_REQUEST_LENGTH ; index++){
+        HOST_TEST_CHECK_EQ(host_sim_eeprom_get(EEPROM_REQUEST_ADDRESS + index) , request_data[index]);
+    }
+}
+#endif
+
+int main(void){
+#if     INTERRUPT_FEATURE_ENABLE == DATA_EEPROM_INTERRUPT_FEATURE_ENABLE
+    test_write_byte_then_submit();
+    test_flash_then_submit();
+    test_write_byte_during_request();
+    INTERRUPT_GlobalInterruptDisable();
+    host_sim_set_isr(NULL , NULL);
+#endif
+    return HOST_TEST_EXIT();
+}
@@ -0,0 +1,223 @@
+/*
+ * @file    test_eusart_fuzz.c
+ * @brief   EUSART receive / transmit under random traffic
+ * @details
+ * Random bursts (length , payload , framing errors , gaps) are pushed on RX
+ * from a fixed seed , pass another seed as argv[1] to explore. Invariants :
+ * - Polled reader faster than the line : every byte , in order.
+ * - Polled reader slower than the line : what is read is an in-order
+ *   subsequence of what was sent (OERR drops bytes , never invents or
+ *   reorders them) , and the receiver always restarts after an overrun.
+ * - RX ring (EUSART_RX_INTERRUPT_FEATURE_ENABLE) : read + buffer_overflow_count
+ *   equals the bytes sent , framing_error_count equals the bad frames sent.
+ * - Blocking TX : the line carries exactly the bytes written.
+ * Layer: Tools
+ * Target MCU: PIC18F4620 (host model)
+ * Author: Abdelmoniem Ahmed
+ * Linkedin: https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * Date: 2026
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "host_test.h"
+#include "hal_eusart.h"
+#include "mcal_interrupt_manager.h"
+
+#define FUZZ_BURSTS             400
+#define FUZZ_BURST_MAX          16
+#define FUZZ_STREAM_SIZE        (FUZZ_BURSTS * FUZZ_BURST_MAX)
+
+/* 9600 baud , 10 bits per frame at Fosc / 4 = 2 MHz */
+#define FUZZ_BYTE_CYCLES        ((10UL * (_XTAL_FREQ / 4UL)) / 9600UL)
+
+/* Vector 0x08 , defined in mcal_interrupt_manager.c without a prototype */
+void Interrupt_Manager(void);
+
+static uint32 fuzz_seed = 0x2026;
+
+static uint8 sent[FUZZ_STREAM_SIZE];
+static uint8 received[FUZZ_STREAM_SIZE];
+static unsigned sent_count = 0 , received_count = 0 , bad_frames = 0;
+
+static usart_t uart_obj = {
+    .baudrate = 9600,
+    .baudrate_cfg = BAUDRATE_ASYNC_16BIT_HIGH_SPEED,
+    .usart_tx_cfg.usart_tx_enable = EUSART_ASYNCHRONOUS_TX_ENABLE,
+    .usart_tx_cfg.usart_tx_9bit_enable = EUSART_ASYNCHRONOUS_9BIT_TX_DISABLE,
+    .usart_tx_cfg.usart_tx_interrupt_enable = EUSART_ASYNCHRONOUS_INTERRUPT_TX_DISABLE,
+    .usart_rx_cfg.usart_rx_enable = EUSART_ASYNCHRONOUS_RX_ENABLE,
+    .usart_rx_cfg.usart_rx_9bit_enable = EUSART_ASYNCHRONOUS_9BIT_RX_DISABLE,
+    .usart_rx_cfg.usart_rx_interrupt_enable = EUSART_ASYNCHRONOUS_INTERRUPT_RX_DISABLE,
+};
+
+static uint32 fuzz_random(uint32 range){
+    fuzz_seed = (fuzz_seed * 1103515245UL) + 12345UL;
+    return ((fuzz_seed >> 8) & 0x00FFFFFFUL) % range;
+}
+
+static void fuzz_restart(uint8 rx_interrupt){
+    host_sim_reset();
+    sent_count = 0;
+    received_count = 0;
+    bad_frames = 0;
+    uart_obj.usart_rx_cfg.usart_rx_interrupt_enable = rx_interrupt;
+    HOST_TEST_CHECK_EQ(EUSART_ASYNC_Init(&uart_obj) , E_OK);
+}
+
+/* Random burst on RX , one frame in 16 with a framing error when asked */
+static void fuzz_push_burst(uint8 framing_errors){
+    unsigned length = 1 + fuzz_random(FUZZ_BURST_MAX) , index = 0;
+    uint8 data = 0 , bad = 0;
+    for(index = 0 ; (index < length) && (sent_count < FUZZ_STREAM_SIZE) ; index++){
+        data = (uint8)fuzz_random(256);
+        bad = (uint8)(framing_errors && (0 == fuzz_random(16)));
+        host_sim_uart_rx_push_frame(data , 0 , bad);
+        sent[sent_count++] = data;
+        bad_frames += bad;
+    }
+}
+
+/* received[] is an in-order subsequence of sent[] */
+static unsigned fuzz_is_subsequence(void){
+    unsigned sent_index = 0 , received_index = 0;
+    for(received_index = 0 ; received_index < received_count ; received_index++){
+        while((sent_index < sent_count) && (sent[sent_index] != received[received_index])){
+            sent_index++;
+        }
+        if(sent_index == sent_count){
+            break;
+        }
+        sent_index++;
+    }
+    return (received_index == received_count) ? TRUE : FALSE;
+}
+
+/* Poll with a random gap , until line and FIFO are empty and nothing was read for `quiet` cycles */
+static void fuzz_poll(unsigned long max_gap , unsigned long quiet){
+    uint8 data = 0;
+    uint64 last = host_sim_cycles();
+    while(((host_sim_cycles() - last) < quiet) || (0 == BAUDCONbits.RCIDL) ||
+          (PIR1bits.RCIF) || (RCSTAbits.OERR)){
+        if(E_OK == EUSART_ASYNC_Read_Byte_Polled(&data)){
+            if(received_count < FUZZ_STREAM_SIZE){
+                received[received_count++] = data;
+            }
+            last = host_sim_cycles();
+        }
+        else{
+            host_sim_delay_cycles(fuzz_random(max_gap) + 1);
+        }
+    }
+}
+
+static void test_polled_lossless(void){
+    unsigned burst = 0;
+    uint8 data = 0;
+
+    fuzz_restart(EUSART_ASYNCHRONOUS_INTERRUPT_RX_DISABLE);
+    HOST_TEST_CHECK_EQ(EUSART_ASYNC_Read_Byte_Polled(&data) , E_NOT_OK);         /* Nothing yet */
+    HOST_TEST_CHECK_EQ(EUSART_ASYNC_Read_Byte_Polled(NULL) , E_NOT_OK);
+    for(burst = 0 ; burst < FUZZ_BURSTS ; burst++){
+        fuzz_push_burst(TRUE);
+        /* Two gaps fit in one frame time : the 2-deep FIFO never overflows */
+        fuzz_poll(FUZZ_BYTE_CYCLES / 2 , 2 * FUZZ_BYTE_CYCLES);
+    }
+    HOST_TEST_CHECK_EQ(received_count , sent_count);
+    HOST_TEST_CHECK(0 == memcmp(received , sent , sent_count));
+    HOST_TEST_CHECK_EQ(RCSTAbits.OERR , 0);
+}
+
+static void test_polled_overrun(void){
+    unsigned burst = 0 , before = 0 , sent_before = 0;
+
+    fuzz_restart(EUSART_ASYNCHRONOUS_INTERRUPT_RX_DISABLE);
+    for(burst = 0 ; burst < FUZZ_BURSTS ; burst++){
+        fuzz_push_burst(TRUE);
+        /* Up to 6 frame times between polls : overruns on purpose */
+        fuzz_poll(6 * FUZZ_BYTE_CYCLES , 8 * FUZZ_BYTE_CYCLES);
+    }
+    HOST_TEST_CHECK(received_count < sent_count);
+    HOST_TEST_CHECK(received_count > 0);
+    HOST_TEST_CHECK(fuzz_is_subsequence());
+
+    /* Receiver restarted : a burst polled fast arrives whole */
+    before = received_count;
+    sent_before = sent_count;
+    fuzz_push_burst(FALSE);
+    fuzz_poll(FUZZ_BYTE_CYCLES / 2 , 2 * FUZZ_BYTE_CYCLES);
+    HOST_TEST_CHECK_EQ(received_count - before , sent_count - sent_before);
+    HOST_TEST_CHECK(0 == memcmp(&received[before] , &sent[sent_before] , sent_count - sent_before));
+    HOST_TEST_CHECK_EQ(RCSTAbits.OERR , 0);
+    HOST_TEST_CHECK_EQ(RCSTAbits.CREN , 1);
+}
+
+#if     INTERRUPT_FEATURE_ENABLE == EUSART_RX_INTERRUPT_FEATURE_ENABLE
+static void test_rx_ring(void){
+    usart_rx_counters_t counters;
+    unsigned burst = 0;
+    uint8 length = 0 , max_length = 0;
+
+    host_sim_set_isr(Interrupt_Manager , NULL);
+    fuzz_restart(EUSART_ASYNCHRONOUS_INTERRUPT_RX_ENABLE);
+    INTERRUPT_PeripheralInterruptEnable();
+    INTERRUPT_GlobalInterruptEnable();
+    for(burst = 0 ; burst < FUZZ_BURSTS ; burst++){
+        fuzz_push_burst(TRUE);
+        host_sim_delay_cycles(FUZZ_BURST_MAX * FUZZ_BYTE_CYCLES);
+        /* Reader slower than the line on average : the ring fills and drops */
+        max_length = (uint8)(1 + fuzz_random(FUZZ_BURST_MAX / 2));
+        HOST_TEST_CHECK_EQ(EUSART_ASYNC_Read_Buffer(&received[received_count] , max_length , &length) , E_OK);
+        received_count += length;
+    }
+    host_sim_delay_cycles((FUZZ_BURST_MAX + 2) * FUZZ_BYTE_CYCLES);
+    do{
+        HOST_TEST_CHECK_EQ(EUSART_ASYNC_Read_Buffer(&received[received_count] , 255 , &length) , E_OK);
+        received_count += length;
+    }while(0 != length);
+
+    HOST_TEST_CHECK_EQ(EUSART_ASYNC_RX_Get_Counters(&counters) , E_OK);
+    HOST_TEST_CHECK(fuzz_is_subsequence());
+    HOST_TEST_CHECK(0 != counters.buffer_overflow_count);
+    HOST_TEST_CHECK_EQ(received_count + counters.buffer_overflow_count , sent_count);
+    HOST_TEST_CHECK_EQ(counters.framing_error_count , bad_frames);
+    HOST_TEST_CHECK_EQ(counters.hw_overrun_count , 0);                           /* ISR keeps up */
+    INTERRUPT_GlobalInterruptDisable();
+    host_sim_set_isr(NULL , NULL);
+}
+#endif
+
+static void test_tx_blocking(void){
+    uint8 message[64] , line[64];
+    unsigned round = 0 , length = 0 , index = 0;
+    uint8 idle = FALSE;
+
+    fuzz_restart(EUSART_ASYNCHRONOUS_INTERRUPT_RX_DISABLE);
+    for(round = 0 ; round < 100 ; round++){
+        length = fuzz_random(sizeof(message) + 1);
+        for(index = 0 ; index < length ; index++){
+            message[index] = (uint8)fuzz_random(256);
+        }
+        HOST_TEST_CHECK_EQ(EUSART_ASYNC_Write_String_Blocking(message , (uint16)length) , E_OK);
+        do{
+            HOST_TEST_CHECK_EQ(EUSART_ASYNC_TX_Is_Idle(&idle) , E_OK);
+        }while(FALSE == idle);
+        HOST_TEST_CHECK_EQ(host_sim_uart_tx_read(line , sizeof(line)) , length);
+        HOST_TEST_CHECK(0 == memcmp(line , message , length));
+    }
+}
+
+int main(int argc , char **argv){
+    if(argc > 1){
+        fuzz_seed = (uint32)strtoul(argv[1] , NULL , 0);
+    }
+    printf("seed 0x%lX\n" , (unsigned long)fuzz_seed);
+
+    test_polled_lossless();
+    test_polled_overrun();
+#if     INTERRUPT_FEATURE_ENABLE == EUSART_RX_INTERRUPT_FEATURE_ENABLE
+    test_rx_ring();
+#endif
+    test_tx_blocking();
+    return HOST_TEST_EXIT();
+}
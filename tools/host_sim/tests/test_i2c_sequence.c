@@ -0,0 +1,292 @@
+/*
+ * @file    test_i2c_sequence.c
+ * @brief   I2C transaction sequences on the MSSP master and the bit-banged bus
+ * @details
+ * - MSSP : a logging slave records every bus event (start + R/W , byte
+ *   written , byte read , end of transfer). Each register helper must give
+ *   exactly the expected sequence , stop after a NACK and report
+ *   I2C_ERROR_NONE for a missing device.
+ * - SOFT_I2C : a bit level slave on RD6 (SCL) / RD7 (SDA) in the port hook ,
+ *   then SCL held low by "another device" : the helpers must give up with
+ *   E_NOT_OK and SOFT_I2C_Get_Last_Error() must read I2C_ERROR_TIMEOUT.
+ * Layer: Tools
+ * Target MCU: PIC18F4620 (host model)
+ * Author: Abdelmoniem Ahmed
+ * Linkedin: https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * Date: 2026
+ */
+
+#include <string.h>
+#include "host_test.h"
+#include "I2C_Bus.h"
+
+#define LOG_ADDRESS             0x48
+#define LOG_SIZE                512
+
+/* ---------------- MSSP : logging slave ---------------- */
+
+static char bus_log[LOG_SIZE];
+static uint8 log_registers[16];
+static uint8 log_pointer = 0;
+static uint8 log_pointer_pending = FALSE;
+static int log_nack_data = -1;                  /* Data byte the slave NACKs , -1 = none */
+
+static void log_append(const char *text){
+    size_t used = strlen(bus_log);
+    snprintf(bus_log + used , LOG_SIZE - used , "%s%s" , (0 == used) ? "" : " " , text);
+}
+
+static uint8 log_start(host_sim_i2c_device_t *device , uint8 read){
+    char text[8];
+    snprintf(text , sizeof(text) , "S%02X%c" , device->address , read ? 'r' : 'w');
+    log_append(text);
+    log_pointer_pending = read ? FALSE : TRUE;
+    return TRUE;
+}
+
+static uint8 log_write(host_sim_i2c_device_t *device , uint8 data){
+    char text[8];
+    snprintf(text , sizeof(text) , "W%02X" , data);
+    log_append(text);
+    if(log_pointer_pending){
+        log_pointer = data & 0x0F;
+        log_pointer_pending = FALSE;
+    }
+    else{
+        log_registers[log_pointer] = data;
+        log_pointer = (log_pointer + 1) & 0x0F;
+    }
+    return (data == log_nack_data) ? FALSE : TRUE;
+}
+
+static uint8 log_read(host_sim_i2c_device_t *device){
+    char text[8];
+    uint8 data = log_registers[log_pointer];
+    snprintf(text , sizeof(text) , "R%02X" , data);
+    log_append(text);
+    log_pointer = (log_pointer + 1) & 0x0F;
+    return data;
+}
+
+static void log_stop(host_sim_i2c_device_t *device){
+    log_append("P");
+}
+
+static host_sim_i2c_device_t log_device = {
+    .address = LOG_ADDRESS , .start = log_start , .write = log_write ,
+    .read = log_read , .stop = log_stop
+};
+
+static mssp_i2c_t i2c_obj = {
+    .i2c_clock  = 100000,
+    .i2c_cfg.i2c_mode = MSSP_I2C_MASTER_MODE,
+    .i2c_cfg.i2c_mode_cfg = MSSP_I2C_MASTER_MODE_DEFINED_CLK,
+    .i2c_cfg.i2c_slew_rate = I2C_SLEW_RATE_DISABLE_100kHZ,
+    .i2c_cfg.i2c_SMBus_Control = I2C_SMBUS_DISABLE,
+};
+
+#define CHECK_LOG(_EXPECTED)                                                    \
+    do{                                                                         \
+        HOST_TEST_CHECK(0 == strcmp(bus_log , (_EXPECTED)));                    \
+        if(0 != strcmp(bus_log , (_EXPECTED))){                                 \
+            printf("    log      : %s\n    expected : %s\n" , bus_log , (_EXPECTED)); \
+        }                                                                       \
+        bus_log[0] = '\0';                                                      \
+    }while(0)
+
+static void test_mssp_sequences(void){
+    static const uint8 pattern[3] = {0xAA , 0xBB , 0xCC};
+    uint8 data[4] = {0};
+    i2c_error_t error = I2C_ERROR_TIMEOUT;
+
+    host_sim_reset();
+    host_sim_i2c_detach_all();
+    HOST_TEST_CHECK_EQ(host_sim_i2c_attach(&log_device) , E_OK);
+    HOST_TEST_CHECK_EQ(MSSP_I2C_Init(&i2c_obj) , E_OK);
+    bus_log[0] = '\0';
+
+    HOST_TEST_CHECK_EQ(MSSP_I2C_Write_Registers(LOG_ADDRESS , 0x02 , pattern , 3) , E_OK);
+    CHECK_LOG("S48w W02 WAA WBB WCC P");
+    HOST_TEST_CHECK_EQ(log_registers[2] , 0xAA);
+    HOST_TEST_CHECK_EQ(log_registers[4] , 0xCC);
+
+    memset(data , 0 , sizeof(data));
+    HOST_TEST_CHECK_EQ(MSSP_I2C_Read_Registers(LOG_ADDRESS , 0x02 , data , 3) , E_OK);
+    CHECK_LOG("S48w W02 P S48r RAA RBB RCC P");                    /* Repeated start ends the write phase */
+    HOST_TEST_CHECK(0 == memcmp(data , pattern , 3));
+
+    HOST_TEST_CHECK_EQ(MSSP_I2C_Read_Byte_Register(LOG_ADDRESS , 0x03 , data) , E_OK);
+    CHECK_LOG("S48w W03 P S48r RBB P");
+    HOST_TEST_CHECK_EQ(data[0] , 0xBB);
+
+    HOST_TEST_CHECK_EQ(MSSP_I2C_Write_Byte_Register(LOG_ADDRESS , 0x07 , 0x5A) , E_OK);
+    CHECK_LOG("S48w W07 W5A P");
+
+    HOST_TEST_CHECK_EQ(MSSP_I2C_Read_Current(LOG_ADDRESS , data , 2) , E_OK);
+    CHECK_LOG("S48r R00 R00 P");
+
+    HOST_TEST_CHECK_EQ(MSSP_I2C_Probe(LOG_ADDRESS) , E_OK);
+    CHECK_LOG("S48w P");
+
+    /* Data NACK : the transfer stops at once , the bus is released */
+    log_nack_data = 0xBB;
+    HOST_TEST_CHECK_EQ(MSSP_I2C_Write_Registers(LOG_ADDRESS , 0x02 , pattern , 3) , E_NOT_OK);
+    CHECK_LOG("S48w W02 WAA WBB P");
+    log_nack_data = -1;
+    HOST_TEST_CHECK_EQ(MSSP_I2C_Get_Last_Error(&error) , E_OK);
+    HOST_TEST_CHECK_EQ(error , I2C_ERROR_NONE);
+
+    /* Missing device : address NACK , no slave callback , no timeout */
+    HOST_TEST_CHECK_EQ(MSSP_I2C_Probe(0x22) , E_NOT_OK);
+    HOST_TEST_CHECK_EQ(MSSP_I2C_Read_Registers(0x22 , 0x00 , data , 2) , E_NOT_OK);
+    HOST_TEST_CHECK_EQ(MSSP_I2C_Write_Registers(0x22 , 0x00 , pattern , 2) , E_NOT_OK);
+    CHECK_LOG("");
+    HOST_TEST_CHECK_EQ(MSSP_I2C_Get_Last_Error(&error) , E_OK);
+    HOST_TEST_CHECK_EQ(error , I2C_ERROR_NONE);
+
+    /* Bus selector : same sequence through I2C_BUS_MSSP */
+    HOST_TEST_CHECK_EQ(I2C_Bus_Write_Registers(I2C_BUS_MSSP , LOG_ADDRESS , 0x01 , pattern , 1) , E_OK);
+    CHECK_LOG("S48w W01 WAA P");
+    HOST_TEST_CHECK_EQ(I2C_Bus_Get_Last_Error(I2C_BUS_MSSP , &error) , E_OK);
+    HOST_TEST_CHECK_EQ(error , I2C_ERROR_NONE);
+
+    /* Argument checks */
+    HOST_TEST_CHECK_EQ(MSSP_I2C_Read_Registers(LOG_ADDRESS , 0x00 , NULL , 1) , E_NOT_OK);
+    HOST_TEST_CHECK_EQ(MSSP_I2C_Write_Registers(LOG_ADDRESS , 0x00 , NULL , 1) , E_NOT_OK);
+    HOST_TEST_CHECK_EQ(MSSP_I2C_Get_Last_Error(NULL) , E_NOT_OK);
+    HOST_TEST_CHECK_EQ(I2C_Bus_Get_Last_Error((i2c_bus_t)5 , &error) , E_NOT_OK);
+    CHECK_LOG("");
+
+    host_sim_i2c_detach_all();
+}
+
+/* ---------------- SOFT_I2C : bit level slave in the port hook ---------------- */
+
+#define SOFT_SLAVE_ADDRESS      0x50
+#define SOFT_SCL_BIT            6                   /* RD6 */
+#define SOFT_SDA_BIT            7                   /* RD7 */
+
+enum { SOFT_PHASE_ADDRESS , SOFT_PHASE_REGISTER , SOFT_PHASE_DATA };
+
+static uint8 soft_registers[256];
+static uint8 soft_pointer = 0;
+static uint8 soft_slave_low = 0 , soft_prev_scl = 1 , soft_prev_sda = 1;
+static uint8 soft_scl_stuck = FALSE;
+static int soft_bits = 0 , soft_phase = 0 , soft_byte = 0;
+static int soft_ack_slot = 0 , soft_reading = 0 , soft_active = 0;
+
+/* Open drain : a line is high unless the master (TRIS = 0 , LAT = 0) or a slave pulls it low */
+static uint8 soft_wiring(uint8 port , const uint8 *lat , const uint8 *tris){
+    uint8 master_scl = 0 , master_sda = 0 , scl = 0 , sda = 0 , ack = 0;
+    if(HOST_SIM_PORTD != port){
+        return 0;
+    }
+    master_scl = ((tris[port] >> SOFT_SCL_BIT) & 1) ? 1 : ((lat[port] >> SOFT_SCL_BIT) & 1);
+    master_sda = ((tris[port] >> SOFT_SDA_BIT) & 1) ? 1 : ((lat[port] >> SOFT_SDA_BIT) & 1);
+    scl = (uint8)(master_scl && !soft_scl_stuck);
+    sda = (uint8)(master_sda && !soft_slave_low);
+
+    if(scl && soft_prev_scl && soft_prev_sda && !sda){                     /* START */
+        soft_active = 1; soft_phase = SOFT_PHASE_ADDRESS; soft_bits = 0; soft_byte = 0;
+        soft_ack_slot = 0; soft_reading = 0; soft_slave_low = 0;
+    }
+    else if(scl && soft_prev_scl && !soft_prev_sda && sda){                /* STOP */
+        soft_active = 0; soft_slave_low = 0;
+    }
+    else if(soft_active && scl && !soft_prev_scl){                         /* Rising edge */
+        if(soft_ack_slot){
+            if(soft_reading && sda){ soft_active = 0; }                     /* Master NACK : last byte */
+        }
+        else if(!soft_reading){ soft_byte = (soft_byte << 1) | sda; soft_bits++; }
+    }
+    else if(soft_active && !scl && soft_prev_scl){                         /* Falling edge */
+        if(soft_ack_slot){
+            soft_ack_slot = 0; soft_slave_low = 0;
+            if(soft_reading){
+                soft_byte = soft_registers[soft_pointer++]; soft_bits = 0;
+                soft_slave_low = !(soft_byte & 0x80);
+            }
+        }
+        else if(!soft_reading && (8 == soft_bits)){
+            ack = 1;
+            if(SOFT_PHASE_ADDRESS == soft_phase){
+                if(SOFT_SLAVE_ADDRESS != (soft_byte >> 1)){ ack = 0; }
+                else if(soft_byte & 1){ soft_reading = 1; }
+                soft_phase = SOFT_PHASE_REGISTER;
+            }
+            else if(SOFT_PHASE_REGISTER == soft_phase){ soft_pointer = (uint8)soft_byte; soft_phase = SOFT_PHASE_DATA; }
+            else{ soft_registers[soft_pointer++] = (uint8)soft_byte; }
+            soft_bits = 0; soft_byte = 0; soft_ack_slot = 1; soft_slave_low = ack;
+            if(!ack){ soft_active = 0; }
+        }
+        else if(soft_reading){
+            soft_bits++;
+            if(8 == soft_bits){ soft_ack_slot = 1; soft_slave_low = 0; }
+            else{ soft_slave_low = !((soft_byte << soft_bits) & 0x80); }
+        }
+    }
+    sda = (uint8)(master_sda && !soft_slave_low);
+    soft_prev_scl = scl;
+    soft_prev_sda = sda;
+    return (uint8)((scl << SOFT_SCL_BIT) | (sda << SOFT_SDA_BIT));
+}
+
+static void test_soft_sequences(void){
+    static const uint8 pattern[3] = {0x11 , 0x22 , 0x33};
+    uint8 data[3] = {0};
+    i2c_error_t error = I2C_ERROR_TIMEOUT;
+
+    host_sim_reset();
+    host_sim_set_port_hook(soft_wiring);
+    HOST_TEST_CHECK_EQ(SOFT_I2C_Init() , E_OK);
+
+    HOST_TEST_CHECK_EQ(I2C_Bus_Write_Registers(I2C_BUS_SOFT , SOFT_SLAVE_ADDRESS , 0x10 , pattern , 3) , E_OK);
+    HOST_TEST_CHECK(0 == memcmp(&soft_registers[0x10] , pattern , 3));
+    HOST_TEST_CHECK_EQ(I2C_Bus_Read_Registers(I2C_BUS_SOFT , SOFT_SLAVE_ADDRESS , 0x10 , data , 3) , E_OK);
+    HOST_TEST_CHECK(0 == memcmp(data , pattern , 3));
+    HOST_TEST_CHECK_EQ(SOFT_I2C_Read_Byte_Register(SOFT_SLAVE_ADDRESS , 0x12 , data) , E_OK);
+    HOST_TEST_CHECK_EQ(data[0] , 0x33);
+    HOST_TEST_CHECK_EQ(I2C_Bus_Probe(I2C_BUS_SOFT , SOFT_SLAVE_ADDRESS) , E_OK);
+
+    /* Missing device : NACK , not a timeout */
+    HOST_TEST_CHECK_EQ(I2C_Bus_Probe(I2C_BUS_SOFT , 0x51) , E_NOT_OK);
+    HOST_TEST_CHECK_EQ(I2C_Bus_Read_Registers(I2C_BUS_SOFT , 0x51 , 0x00 , data , 1) , E_NOT_OK);
+    HOST_TEST_CHECK_EQ(I2C_Bus_Get_Last_Error(I2C_BUS_SOFT , &error) , E_OK);
+    HOST_TEST_CHECK_EQ(error , I2C_ERROR_NONE);
+    /* Both lines released after the failed transfer */
+    HOST_TEST_CHECK_EQ(host_sim_pin_get(HOST_SIM_PORTD , SOFT_SCL_BIT) , 1);
+    HOST_TEST_CHECK_EQ(host_sim_pin_get(HOST_SIM_PORTD , SOFT_SDA_BIT) , 1);
+
+    /* SCL held low : every helper gives up , the error reads TIMEOUT */
+    soft_scl_stuck = TRUE;
+    HOST_TEST_CHECK_EQ(SOFT_I2C_Probe(SOFT_SLAVE_ADDRESS) , E_NOT_OK);
+    HOST_TEST_CHECK_EQ(SOFT_I2C_Get_Last_Error(&error) , E_OK);
+    HOST_TEST_CHECK_EQ(error , I2C_ERROR_TIMEOUT);
+    error = I2C_ERROR_NONE;
+    HOST_TEST_CHECK_EQ(I2C_Bus_Write_Registers(I2C_BUS_SOFT , SOFT_SLAVE_ADDRESS , 0x00 , pattern , 3) , E_NOT_OK);
+    HOST_TEST_CHECK_EQ(I2C_Bus_Get_Last_Error(I2C_BUS_SOFT , &error) , E_OK);
+    HOST_TEST_CHECK_EQ(error , I2C_ERROR_TIMEOUT);
+    error = I2C_ERROR_NONE;
+    HOST_TEST_CHECK_EQ(I2C_Bus_Read_Registers(I2C_BUS_SOFT , SOFT_SLAVE_ADDRESS , 0x10 , data , 3) , E_NOT_OK);
+    HOST_TEST_CHECK_EQ(SOFT_I2C_Get_Last_Error(&error) , E_OK);
+    HOST_TEST_CHECK_EQ(error , I2C_ERROR_TIMEOUT);
+
+    /* Released : the next transfer works and clears the error */
+    soft_scl_stuck = FALSE;
+    soft_active = 0; soft_slave_low = 0;
+    HOST_TEST_CHECK_EQ(SOFT_I2C_Bus_Recovery() , E_OK);
+    HOST_TEST_CHECK_EQ(I2C_Bus_Read_Registers(I2C_BUS_SOFT , SOFT_SLAVE_ADDRESS , 0x10 , data , 3) , E_OK);
+    HOST_TEST_CHECK(0 == memcmp(data , pattern , 3));
+    HOST_TEST_CHECK_EQ(SOFT_I2C_Get_Last_Error(&error) , E_OK);
+    HOST_TEST_CHECK_EQ(error , I2C_ERROR_NONE);
+
+    host_sim_set_port_hook(NULL);
+}
+
+int main(void){
+    test_mssp_sequences();
+#if SOFT_I2C_CFG == SOFT_I2C_ENABLE
+    test_soft_sequences();
+#endif
+    return HOST_TEST_EXIT();
+}
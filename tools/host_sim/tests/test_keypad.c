@@ -0,0 +1,276 @@
+/*
+ * @file    test_keypad.c
+ * @brief   Keypad_Update : debounce , press / release / repeat events , FIFO
+ *          overflow and the interrupt-on-change event mode
+ * @details
+ * Rows on RD0..RD3 (outputs) , columns on RB4..RB7 (inputs , pull-downs).
+ * The port hook closes the held keys : a column reads the latch of every
+ * row whose key in that column is held.
+ * Layer: Tools
+ * Target MCU: PIC18F4620 (host model)
+ * Author: Abdelmoniem Ahmed
+ * Linkedin: https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * Date: 2026
+ */
+
+#include "host_test.h"
+#include "ecu_keypad.h"
+#include "mcal_interrupt_manager.h"
+
+/* Key bitmap , bit = row * KEYPAD_COLUMN + column , as keypad_t.stable_keys */
+#define KEY_BIT(_ROW , _COLUMN)     ((uint16)(1U << (((_ROW) * KEYPAD_COLUMN) + (_COLUMN))))
+
+/* Vector 0x08 , defined in mcal_interrupt_manager.c without a prototype */
+void Interrupt_Manager(void);
+
+static uint16 held_keys = 0;
+
+static keypad_t keypad = {
+    .keypad_row_pins[0].port = PORTD_INDEX , .keypad_row_pins[0].pin = PIN0 ,
+    .keypad_row_pins[0].direction = GPIO_DIRECTION_OUTPUT , .keypad_row_pins[0].logic = GPIO_PIN_LOW ,
+    .keypad_row_pins[1].port = PORTD_INDEX , .keypad_row_pins[1].pin = PIN1 ,
+    .keypad_row_pins[1].direction = GPIO_DIRECTION_OUTPUT , .keypad_row_pins[1].logic = GPIO_PIN_LOW ,
+    .keypad_row_pins[2].port = PORTD_INDEX , .keypad_row_pins[2].pin = PIN2 ,
+    .keypad_row_pins[2].direction = GPIO_DIRECTION_OUTPUT , .keypad_row_pins[2].logic = GPIO_PIN_LOW ,
+    .keypad_row_pins[3].port = PORTD_INDEX , .keypad_row_pins[3].pin = PIN3 ,
+    .keypad_row_pins[3].direction = GPIO_DIRECTION_OUTPUT , .keypad_row_pins[3].logic = GPIO_PIN_LOW ,
+    .keypad_column_pins[0].port = PORTB_INDEX , .keypad_column_pins[0].pin = PIN4 ,
+    .keypad_column_pins[0].direction = GPIO_DIRECTION_INPUT , .keypad_column_pins[0].logic = GPIO_PIN_LOW ,
+    .keypad_column_pins[1].port = PORTB_INDEX , .keypad_column_pins[1].pin = PIN5 ,
+    .keypad_column_pins[1].direction = GPIO_DIRECTION_INPUT , .keypad_column_pins[1].logic = GPIO_PIN_LOW ,
+    .keypad_column_pins[2].port = PORTB_INDEX , .keypad_column_pins[2].pin = PIN6 ,
+    .keypad_column_pins[2].direction = GPIO_DIRECTION_INPUT , .keypad_column_pins[2].logic = GPIO_PIN_LOW ,
+    .keypad_column_pins[3].port = PORTB_INDEX , .keypad_column_pins[3].pin = PIN7 ,
+    .keypad_column_pins[3].direction = GPIO_DIRECTION_INPUT , .keypad_column_pins[3].logic = GPIO_PIN_LOW ,
+};
+
+static uint8 keypad_wiring(uint8 port , const uint8 *lat , const uint8 *tris){
+    uint8 columns = 0 , row = 0 , column = 0;
+    if(HOST_SIM_PORTB == port){
+        for(row = 0 ; row < KEYPAD_ROW ; row++){
+            if((0 == (tris[HOST_SIM_PORTD] & (1U << row))) && (lat[HOST_SIM_PORTD] & (1U << row))){
+                for(column = 0 ; column < KEYPAD_COLUMN ; column++){
+                    if(held_keys & KEY_BIT(row , column)){
+                        columns |= (uint8)(1U << (PIN4 + column));
+                    }
+                }
+            }
+        }
+    }
+    return columns;
+}
+
+static void scans(unsigned count , uint8 *value){
+    while(count--){
+        HOST_TEST_CHECK_EQ(Keypad_Update(&keypad , value) , E_OK);
+    }
+}
+
+static unsigned drain(keypad_event_t *events , unsigned size){
+    unsigned count = 0;
+    keypad_event_t event;
+    while(E_OK == Keypad_Get_Event(&keypad , &event)){
+        if(count < size){
+            events[count] = event;
+        }
+        count++;
+    }
+    return count;
+}
+
+static void restart(void){
+    host_sim_reset();
+    host_sim_set_port_hook(keypad_wiring);
+    held_keys = 0;
+    HOST_TEST_CHECK_EQ(keypad_initialize(&keypad) , E_OK);
+}
+
+static void test_debounce(void){
+    keypad_event_t events[4];
+    uint8 value = 0;
+    unsigned scan = 0;
+
+    restart();
+    scans(20 , &value);
+    HOST_TEST_CHECK_EQ(value , NO_KEY);
+    HOST_TEST_CHECK_EQ(drain(events , 4) , 0);
+
+    /* '5' : row 1 , column 1 , stable after THRESHOLD_VAL scans */
+    held_keys = KEY_BIT(1 , 1);
+    scans(THRESHOLD_VAL - 1 , &value);
+    HOST_TEST_CHECK_EQ(value , NO_KEY);
+    HOST_TEST_CHECK_EQ(drain(events , 4) , 0);
+    scans(1 , &value);
+    HOST_TEST_CHECK_EQ(value , '5');
+    HOST_TEST_CHECK_EQ(drain(events , 4) , 1);
+    HOST_TEST_CHECK_EQ(events[0].key , '5');
+    HOST_TEST_CHECK_EQ(events[0].type , KEYPAD_EVENT_PRESS);
+
+    /* Contact bounce on release : no scan run reaches the threshold */
+    for(scan = 0 ; scan < 40 ; scan++){
+        held_keys = (scan % (THRESHOLD_VAL - 1)) ? 0 : KEY_BIT(1 , 1);
+        scans(1 , &value);
+        HOST_TEST_CHECK_EQ(value , '5');
+    }
+    HOST_TEST_CHECK_EQ(drain(events , 4) , 0);
+
+    held_keys = 0;
+    scans(THRESHOLD_VAL , &value);
+    HOST_TEST_CHECK_EQ(value , NO_KEY);
+    HOST_TEST_CHECK_EQ(drain(events , 4) , 1);
+    HOST_TEST_CHECK_EQ(events[0].key , '5');
+    HOST_TEST_CHECK_EQ(events[0].type , KEYPAD_EVENT_RELEASE);
+}
+
+static void test_repeat(void){
+    keypad_event_t events[16];
+    uint8 value = 0;
+    unsigned count = 0 , index = 0;
+
+    restart();
+    held_keys = KEY_BIT(3 , 1);                                 /* '0' */
+    scans(THRESHOLD_VAL , &value);
+    HOST_TEST_CHECK_EQ(drain(events , 16) , 1);
+
+    /* First repeat KEYPAD_REPEAT_DELAY scans after the press (the press scan counts) */
+    scans(KEYPAD_REPEAT_DELAY - 2 , &value);
+    HOST_TEST_CHECK_EQ(drain(events , 16) , 0);
+    scans(1 , &value);
+    HOST_TEST_CHECK_EQ(drain(events , 16) , 1);
+    HOST_TEST_CHECK_EQ(events[0].key , '0');
+    HOST_TEST_CHECK_EQ(events[0].type , KEYPAD_EVENT_REPEAT);
+
+    /* Then one every KEYPAD_REPEAT_PERIOD scans */
+    scans(KEYPAD_REPEAT_PERIOD - 1 , &value);
+    HOST_TEST_CHECK_EQ(drain(events , 16) , 0);
+    scans(1 , &value);
+    HOST_TEST_CHECK_EQ(drain(events , 16) , 1);
+    scans(KEYPAD_REPEAT_PERIOD * 5 , &value);
+    count = drain(events , 16);
+    HOST_TEST_CHECK_EQ(count , 5);
+
+    /* A second key takes the repeat over , releasing the first one does not stop it */
+    held_keys |= KEY_BIT(0 , 3);                                /* '/' */
+    scans(THRESHOLD_VAL , &value);
+    drain(events , 16);
+    held_keys = KEY_BIT(0 , 3);
+    scans(THRESHOLD_VAL , &value);
+    count = drain(events , 16);
+    HOST_TEST_CHECK(count >= 1);
+    for(index = 0 ; index < count ; index++){
+        if(KEYPAD_EVENT_REPEAT == events[index].type){
+            HOST_TEST_CHECK_EQ(events[index].key , '/');
+        }
+    }
+    HOST_TEST_CHECK_EQ(events[count - 1].key , '0');
+    HOST_TEST_CHECK_EQ(events[count - 1].type , KEYPAD_EVENT_RELEASE);
+    scans(KEYPAD_REPEAT_DELAY , &value);
+    count = drain(events , 16);
+    HOST_TEST_CHECK(count >= 1);
+    HOST_TEST_CHECK_EQ(events[0].key , '/');
+    HOST_TEST_CHECK_EQ(events[0].type , KEYPAD_EVENT_REPEAT);
+}
+
+static void test_simultaneous(void){
+    keypad_event_t events[4];
+    uint8 value = 0;
+
+    restart();
+    held_keys = KEY_BIT(2 , 2) | KEY_BIT(0 , 0);                /* '3' and '7' */
+    scans(THRESHOLD_VAL , &value);
+    HOST_TEST_CHECK_EQ(value , '7');                            /* First key in scan order */
+    HOST_TEST_CHECK_EQ(drain(events , 4) , 2);
+    HOST_TEST_CHECK_EQ(events[0].key , '7');
+    HOST_TEST_CHECK_EQ(events[1].key , '3');
+    HOST_TEST_CHECK_EQ(keypad.stable_keys , KEY_BIT(2 , 2) | KEY_BIT(0 , 0));
+}
+
+static void test_fifo_overflow(void){
+    keypad_event_t events[KEYPAD_EVENT_QUEUE_SIZE * 2];
+    uint8 value = 0;
+    unsigned round = 0 , count = 0 , index = 0;
+
+    /* Press + release of '1' , '2' , '3' ... nobody drains : the oldest stay */
+    restart();
+    for(round = 0 ; round < KEYPAD_EVENT_QUEUE_SIZE ; round++){
+        held_keys = KEY_BIT(2 , round % 3);
+        scans(THRESHOLD_VAL , &value);
+        held_keys = 0;
+        scans(THRESHOLD_VAL , &value);
+    }
+    count = drain(events , KEYPAD_EVENT_QUEUE_SIZE * 2);
+    HOST_TEST_CHECK_EQ(count , KEYPAD_EVENT_QUEUE_SIZE);
+    for(index = 0 ; index < count ; index++){
+        HOST_TEST_CHECK_EQ(events[index].key , '1' + ((index / 2) % 3));
+        HOST_TEST_CHECK_EQ(events[index].type , (index & 1) ? KEYPAD_EVENT_RELEASE : KEYPAD_EVENT_PRESS);
+    }
+
+    /* Drained : events flow again */
+    held_keys = KEY_BIT(3 , 3);
+    scans(THRESHOLD_VAL , &value);
+    HOST_TEST_CHECK_EQ(drain(events , 4) , 1);
+    HOST_TEST_CHECK_EQ(events[0].key , '+');
+}
+
+#if EXTERNAL_INTERRUPT_OnChange_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+static void test_event_mode(void){
+    keypad_event_t events[4];
+    uint8 value = 0 , idle = FALSE;
+    uint64 start = 0;
+
+    restart();
+    host_sim_set_isr(Interrupt_Manager , NULL);
+    HOST_TEST_CHECK_EQ(keypad_event_mode_initialize(&keypad) , E_OK);
+    INTERRUPT_GlobalInterruptEnable();
+    scans(2 , &value);
+    HOST_TEST_CHECK_EQ(Keypad_Is_Idle(&keypad , &idle) , E_OK);
+    HOST_TEST_CHECK_EQ(idle , TRUE);
+
+    /* Idle : the scan is skipped , no register is touched */
+    start = host_sim_cycles();
+    scans(10 , &value);
+    HOST_TEST_CHECK_EQ(host_sim_cycles() - start , 0);
+
+    /* A press raises its column (rows idle high) : RB change wakes the scans */
+    held_keys = KEY_BIT(1 , 2);                                 /* '6' */
+    host_sim_delay_cycles(10);
+    HOST_TEST_CHECK_EQ(keypad.event_pending , TRUE);
+    scans(THRESHOLD_VAL , &value);
+    HOST_TEST_CHECK_EQ(value , '6');
+    HOST_TEST_CHECK_EQ(drain(events , 4) , 1);
+    HOST_TEST_CHECK_EQ(events[0].type , KEYPAD_EVENT_PRESS);
+
+    held_keys = 0;
+    scans(THRESHOLD_VAL , &value);
+    HOST_TEST_CHECK_EQ(drain(events , 4) , 1);
+    HOST_TEST_CHECK_EQ(events[0].type , KEYPAD_EVENT_RELEASE);
+    scans(1 , &value);
+    HOST_TEST_CHECK_EQ(Keypad_Is_Idle(&keypad , &idle) , E_OK);
+    HOST_TEST_CHECK_EQ(idle , TRUE);
+
+    /* Column off RB4..RB7 is refused */
+    keypad.keypad_column_pins[0].pin = PIN0;
+    HOST_TEST_CHECK_EQ(keypad_event_mode_initialize(&keypad) , E_NOT_OK);
+    keypad.keypad_column_pins[0].pin = PIN4;
+    INTERRUPT_GlobalInterruptDisable();
+    host_sim_set_isr(NULL , NULL);
+}
+#endif
+
+int main(void){
+    keypad_event_t event;
+    uint8 value = 0;
+
+    HOST_TEST_CHECK_EQ(keypad_initialize(NULL) , E_NOT_OK);
+    HOST_TEST_CHECK_EQ(Keypad_Update(NULL , &value) , E_NOT_OK);
+    HOST_TEST_CHECK_EQ(Keypad_Get_Event(NULL , &event) , E_NOT_OK);
+
+    test_debounce();
+    test_repeat();
+    test_simultaneous();
+    test_fifo_overflow();
+#if EXTERNAL_INTERRUPT_OnChange_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+    test_event_mode();
+#endif
+    return HOST_TEST_EXIT();
+}
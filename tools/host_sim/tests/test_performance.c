@@ -0,0 +1,200 @@
+/*
+ * @file    test_performance.c
+ * @brief   Cycle budgets of the hot driver paths
+ * @details
+ * Each case runs a call a few times and keeps its worst instruction-cycle
+ * count from host_sim_cycles(). The run fails when a count goes over its
+ * budget , or under the physical floor for bus-bound cases (a transfer that
+ * finishes faster than its bits take on the wire skipped a wait).
+ * Counts follow the number of register accesses (see README) :
+ * the budgets catch an extra poll or a longer wait , they are not the
+ * target timings. Raise a budget with the change that needs it.
+ * Layer: Tools
+ * Target MCU: PIC18F4620 (host model)
+ * Author: Abdelmoniem Ahmed
+ * Linkedin: https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * Date: 2026
+ */
+
+#include "host_test.h"
+#include "ecu_keypad.h"
+#include "hal_adc.h"
+#include "hal_eusart.h"
+#include "I2C_Bus.h"
+#include "mcal_interrupt_manager.h"
+
+/* Vector 0x08 , defined in mcal_interrupt_manager.c without a prototype */
+void Interrupt_Manager(void);
+
+#define PERF_RUNS               8
+
+/* 9600 baud , 10 bits per frame at Fosc / 4 = 2 MHz , the BRG is within 2 % */
+#define PERF_UART_BYTE_CYCLES   ((10UL * (_XTAL_FREQ / 4UL)) / 9600UL)
+#define PERF_UART_LENGTH        16
+
+/* 12 Tad acquisition + 11 Tad conversion , Tad = 16 / Fosc = 4 cycles */
+#define PERF_ADC_TAD_COUNT      (12UL + 11UL)
+#define PERF_ADC_TAD_CYCLES     4UL
+
+/* 100 kHz I2C : (S + 2 bytes * 9 + Sr + 2 bytes * 9 + P) bits of 20 cycles */
+#define PERF_I2C_BIT_CYCLES     ((_XTAL_FREQ / 4UL) / 100000UL)
+#define PERF_I2C_READ_BITS      (1 + (2 * 9) + 1 + (2 * 9) + 1)
+
+typedef struct{
+    const char *name ;
+    void (* run)(void) ;
+    uint64 floor ;              /* Minimum cycles , 0 = none */
+    uint64 budget ;             /* Maximum cycles */
+}perf_case_t;
+
+static keypad_t keypad = {
+    .keypad_row_pins[0].port = PORTD_INDEX , .keypad_row_pins[0].pin = PIN0 ,
+    .keypad_row_pins[1].port = PORTD_INDEX , .keypad_row_pins[1].pin = PIN1 ,
+    .keypad_row_pins[2].port = PORTD_INDEX , .keypad_row_pins[2].pin = PIN2 ,
+    .keypad_row_pins[3].port = PORTD_INDEX , .keypad_row_pins[3].pin = PIN3 ,
+    .keypad_column_pins[0].port = PORTB_INDEX , .keypad_column_pins[0].pin = PIN4 ,
+    .keypad_column_pins[0].direction = GPIO_DIRECTION_INPUT ,
+    .keypad_column_pins[1].port = PORTB_INDEX , .keypad_column_pins[1].pin = PIN5 ,
+    .keypad_column_pins[1].direction = GPIO_DIRECTION_INPUT ,
+    .keypad_column_pins[2].port = PORTB_INDEX , .keypad_column_pins[2].pin = PIN6 ,
+    .keypad_column_pins[2].direction = GPIO_DIRECTION_INPUT ,
+    .keypad_column_pins[3].port = PORTB_INDEX , .keypad_column_pins[3].pin = PIN7 ,
+    .keypad_column_pins[3].direction = GPIO_DIRECTION_INPUT ,
+};
+
+static const pin_config_t led = { .port = PORTC_INDEX , .pin = PIN0 , .direction = GPIO_DIRECTION_OUTPUT };
+
+static adc_conf_t adc_obj = {
+    .acquisition_time = ADC_12_TAD ,
+    .conversion_clock = ADC_CONVERSION_CLOCK_FOSC_DIV_16 ,
+    .adc_channel = ADC_CHANNEL_AN0 ,
+    .result_format = ADC_RESULT_RIGHT ,
+};
+
+static usart_t uart_obj = {
+    .baudrate = 9600,
+    .baudrate_cfg = BAUDRATE_ASYNC_16BIT_HIGH_SPEED,
+    .usart_tx_cfg.usart_tx_enable = EUSART_ASYNCHRONOUS_TX_ENABLE,
+    .usart_rx_cfg.usart_rx_enable = EUSART_ASYNCHRONOUS_RX_ENABLE,
+};
+
+static mssp_i2c_t i2c_obj = {
+    .i2c_clock  = 100000,
+    .i2c_cfg.i2c_mode = MSSP_I2C_MASTER_MODE,
+    .i2c_cfg.i2c_mode_cfg = MSSP_I2C_MASTER_MODE_DEFINED_CLK,
+    .i2c_cfg.i2c_slew_rate = I2C_SLEW_RATE_DISABLE_100kHZ,
+    .i2c_cfg.i2c_SMBus_Control = I2C_SMBUS_DISABLE,
+};
+
+static uint8 tc74_registers[2] = {25 , 0x40};
+static host_sim_i2c_device_t tc74;
+
+static void perf_gpio_write(void){
+    (void)gpio_pin_write_logic(&led , GPIO_PIN_HIGH);
+}
+
+static void perf_gpio_toggle(void){
+    (void)gpio_pin_toggle_logic(&led);
+}
+
+static void perf_keypad_scan(void){
+    uint8 value = NO_KEY;
+    (void)Keypad_Update(&keypad , &value);
+}
+
+#if EXTERNAL_INTERRUPT_OnChange_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+static void perf_keypad_event_idle(void){
+    uint8 value = NO_KEY;
+    (void)Keypad_Update(&keypad , &value);
+}
+#endif
+
+static void perf_adc_conversion(void){
+    adc_result_t result = 0;
+    (void)ADC_GetConversion_Blocking(&adc_obj , ADC_CHANNEL_AN0 , &result);
+}
+
+static void perf_uart_string(void){
+    static const uint8 message[PERF_UART_LENGTH] = "0123456789ABCDEF";
+    uint8 idle = FALSE;
+    (void)EUSART_ASYNC_Write_String_Blocking(message , PERF_UART_LENGTH);
+    do{
+        (void)EUSART_ASYNC_TX_Is_Idle(&idle);
+    }while(FALSE == idle);
+}
+
+static void perf_mssp_read_register(void){
+    uint8 data = 0;
+    (void)MSSP_I2C_Read_Registers(0x4D , 0x00 , &data , 1);
+}
+
+static void perf_mssp_probe_absent(void){
+    (void)MSSP_I2C_Probe(0x22);
+}
+
+static const perf_case_t perf_cases[] = {
+    { "gpio_pin_write_logic"         , perf_gpio_write         , 0 , 2 } ,
+    { "gpio_pin_toggle_logic"        , perf_gpio_toggle        , 0 , 2 } ,
+    { "Keypad_Update (scan)"         , perf_keypad_scan        , 0 , 40 } ,
+    { "ADC_GetConversion_Blocking"   , perf_adc_conversion     , PERF_ADC_TAD_COUNT * PERF_ADC_TAD_CYCLES , 140 } ,
+    { "Write_String_Blocking 16 B"   , perf_uart_string        ,
+      (PERF_UART_LENGTH * PERF_UART_BYTE_CYCLES * 98UL) / 100UL , (PERF_UART_LENGTH + 1) * PERF_UART_BYTE_CYCLES } ,
+    { "MSSP_I2C_Read_Registers 1 B"  , perf_mssp_read_register , PERF_I2C_READ_BITS * PERF_I2C_BIT_CYCLES , 1130 } ,
+    { "MSSP_I2C_Probe (absent)"      , perf_mssp_probe_absent  , 11 * PERF_I2C_BIT_CYCLES , 350 } ,
+};
+
+static uint64 perf_measure(void (* run)(void)){
+    uint64 worst = 0 , start = 0 , cycles = 0;
+    unsigned index = 0;
+    for(index = 0 ; index < PERF_RUNS ; index++){
+        start = host_sim_cycles();
+        run();
+        cycles = host_sim_cycles() - start;
+        worst = (cycles > worst) ? cycles : worst;
+    }
+    return worst;
+}
+
+static void perf_check(const char *name , uint64 cycles , uint64 floor , uint64 budget){
+    const char *verdict = "ok";
+    if(cycles > budget){
+        verdict = "OVER BUDGET";
+    }
+    else if(cycles < floor){
+        verdict = "UNDER FLOOR";
+    }
+    printf("  %-30s %8llu cycles  (floor %6llu , budget %6llu)  %s\n" , name ,
+           (unsigned long long)cycles , (unsigned long long)floor , (unsigned long long)budget , verdict);
+    HOST_TEST_CHECK((cycles <= budget) && (cycles >= floor));
+}
+
+int main(void){
+    unsigned index = 0;
+
+    host_sim_reset();
+    HOST_TEST_CHECK_EQ(gpio_pin_initialize(&led) , E_OK);
+    HOST_TEST_CHECK_EQ(keypad_initialize(&keypad) , E_OK);
+    HOST_TEST_CHECK_EQ(ADC_Init(&adc_obj) , E_OK);
+    host_sim_adc_set(ADC_CHANNEL_AN0 , 512);
+    HOST_TEST_CHECK_EQ(EUSART_ASYNC_Init(&uart_obj) , E_OK);
+    host_sim_i2c_detach_all();
+    host_sim_i2c_register_file(&tc74 , 0x4D , tc74_registers , sizeof(tc74_registers));
+    HOST_TEST_CHECK_EQ(host_sim_i2c_attach(&tc74) , E_OK);
+    HOST_TEST_CHECK_EQ(MSSP_I2C_Init(&i2c_obj) , E_OK);
+
+    printf("worst of %u runs :\n" , PERF_RUNS);
+    for(index = 0 ; index < (sizeof(perf_cases) / sizeof(perf_cases[0])) ; index++){
+        perf_check(perf_cases[index].name , perf_measure(perf_cases[index].run) ,
+                   perf_cases[index].floor , perf_cases[index].budget);
+    }
+
+#if EXTERNAL_INTERRUPT_OnChange_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+    /* Event mode , nothing held : the scan is skipped */
+    host_sim_set_isr(Interrupt_Manager , NULL);
+    HOST_TEST_CHECK_EQ(keypad_event_mode_initialize(&keypad) , E_OK);
+    perf_keypad_event_idle();
+    perf_check("Keypad_Update (event idle)" , perf_measure(perf_keypad_event_idle) , 0 , 0);
+    host_sim_set_isr(NULL , NULL);
+#endif
+    return HOST_TEST_EXIT();
+}
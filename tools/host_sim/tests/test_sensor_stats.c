@@ -0,0 +1,121 @@
+/*
+ * @file    test_sensor_stats.c
+ * @brief   Sensor_Stats mean and variance against a double reference
+ * @details
+ * Each case pushes a sample sequence and compares the total aggregate with
+ * the mean and population variance computed in double. Cases cover
+ * temperatures , 10-bit ADC codes , +/- 1000 counts over an hour and more
+ * (the sum of squares passes 32 bits) , the deviation clamp range and a
+ * step. The 1 h window must close with the same result as the total.
+ * Layer: Tools
+ * Target MCU: PIC18F4620 (host model)
+ * Author: Abdelmoniem Ahmed
+ * Linkedin: https://www.linkedin.com/in/abdelmoniem-ahmed/
+ * Date: 2026
+ */
+
+#include "host_test.h"
+#include "ecu_sensor_stats.h"
+
+/* Variance error allowed : relative , plus the Q4 rounding of each deviation */
+#define STATS_VARIANCE_TOLERANCE    1e-4
+#define STATS_VARIANCE_ROUNDING     (1.0 / 32.0)
+
+typedef struct{
+    const char *name ;
+    sint16 (* sample)(uint32 index) ;
+    uint32 count ;
+}stats_case_t;
+
+static uint32 stats_seed = 0x2026;
+
+static sint16 stats_temperature(uint32 index){
+    return (sint16)(19 + ((index * 7919UL) % 7) + (index / 2000));
+}
+
+static sint16 stats_adc(uint32 index){
+    return (sint16)((index * 37UL) % 1024);
+}
+
+static sint16 stats_alternate_1000(uint32 index){
+    return (index & 1) ? 1000 : -1000;
+}
+
+static sint16 stats_random_1000(uint32 index){
+    (void)index;
+    stats_seed = (stats_seed * 1103515245UL) + 12345UL;
+    return (sint16)((sint32)((stats_seed >> 8) % 2001) - 1000);
+}
+
+static sint16 stats_alternate_clamp(uint32 index){
+    return (index & 1) ? (SENSOR_STATS_DEVIATION_MAX - 1) : -(SENSOR_STATS_DEVIATION_MAX - 1);
+}
+
+static sint16 stats_step_1000(uint32 index){
+    return (index < 20000) ? -1000 : 1000;
+}
+
+static const stats_case_t stats_cases[] = {
+    { "temperature"       , stats_temperature     , 7300 } ,
+    { "adc 10-bit"        , stats_adc             , 3600 } ,
+    { "+/-1000 alternate" , stats_alternate_1000  , 3600 } ,
+    { "+/-1000 alternate" , stats_alternate_1000  , 100000 } ,
+    { "+/-1000 random"    , stats_random_1000     , 3600 } ,
+    { "+/-1000 random"    , stats_random_1000     , 500000 } ,
+    { "deviation clamp"   , stats_alternate_clamp , 200000 } ,
+    { "+/-1000 step"      , stats_step_1000       , 40000 } ,
+};
+
+static void stats_check_case(const stats_case_t *test){
+    sensor_stats_t stats;
+    sensor_stats_summary_t total , hour;
+    double sum = 0.0 , squares = 0.0 , mean = 0.0 , variance = 0.0 , error = 0.0;
+    uint32 index = 0;
+    sint16 sample = 0;
+    Std_ReturnType ret = E_OK;
+
+    HOST_TEST_CHECK_EQ(Sensor_Stats_Init(&stats) , E_OK);
+    for(index = 0 ; index < test->count ; index++){
+        sample = test->sample(index);
+        ret &= Sensor_Stats_Push(&stats , sample , index , NULL);
+        sum += sample;
+        squares += (double)sample * sample;
+    }
+    HOST_TEST_CHECK_EQ(ret , E_OK);
+    mean = sum / test->count;
+    variance = (squares / test->count) - (mean * mean);
+
+    HOST_TEST_CHECK_EQ(Sensor_Stats_Get(&stats , SENSOR_STATS_TOTAL , &total) , E_OK);
+    error = (total.variance_q8 / 256.0) - variance;
+    printf("  %-18s n=%7lu  mean %10.3f (ref %10.3f)  variance %12.2f (ref %12.2f)\n" , test->name ,
+           (unsigned long)total.count , total.mean_q8 / 256.0 , mean , total.variance_q8 / 256.0 , variance);
+    HOST_TEST_CHECK_EQ(total.count , test->count);
+    HOST_TEST_CHECK((total.mean_q8 / 256.0 - mean) < (1.0 / 256.0));
+    HOST_TEST_CHECK((mean - total.mean_q8 / 256.0) < (1.0 / 256.0));
+    HOST_TEST_CHECK((error < ((STATS_VARIANCE_TOLERANCE * variance) + STATS_VARIANCE_ROUNDING)) &&
+                    (error > -((STATS_VARIANCE_TOLERANCE * variance) + STATS_VARIANCE_ROUNDING)));
+
+    /* The first hour closes on sample 3600 , a one-hour case is read there */
+    if(SENSOR_STATS_HOUR_S == test->count){
+        stats_seed = 0x2026;
+        HOST_TEST_CHECK_EQ(Sensor_Stats_Init(&stats) , E_OK);
+        for(index = 0 ; index <= test->count ; index++){
+            ret &= Sensor_Stats_Push(&stats , test->sample(index) , index , NULL);
+        }
+        HOST_TEST_CHECK_EQ(ret , E_OK);
+        HOST_TEST_CHECK_EQ(Sensor_Stats_Get(&stats , SENSOR_STATS_HOUR , &hour) , E_OK);
+        HOST_TEST_CHECK_EQ(hour.count , total.count);
+        HOST_TEST_CHECK_EQ(hour.mean_q8 , total.mean_q8);
+        HOST_TEST_CHECK_EQ(hour.variance_q8 , total.variance_q8);
+    }
+}
+
+int main(void){
+    unsigned index = 0;
+
+    for(index = 0 ; index < (sizeof(stats_cases) / sizeof(stats_cases[0])) ; index++){
+        stats_seed = 0x2026;
+        stats_check_case(&stats_cases[index]);
+    }
+    return HOST_TEST_EXIT();
+}
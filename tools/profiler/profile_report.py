@@ -0,0 +1,236 @@
+#!/usr/bin/env python3
+"""
+@file    profile_report.py
+@brief   Function-level report of the mcal_interrupt_profiler histogram
+
+@details
+Reads the text report of Interrupt_Profiler_Report() from a capture file ,
+a serial device already set up with stty , or stdin :
+
+    PROF base=000000 shift=08 buckets=0080 period=03E8 samples=00001234 outside=00000000
+    B 001200 0123
+    END
+
+and maps every bucket back to the functions of the build , read from the
+XC8 output of the same build :
+ - .cof : Microchip COFF (v1 or v2) , the file kept in the Builds folders
+ - .map : XC8 map file (symbol table + psect table)
+
+A function spans up to the next function. A bucket that covers several
+functions is split between them in proportion to the bytes each one has
+in the bucket , so small functions are estimates of the bucket size
+(2 ^ shift bytes) : lower INTERRUPT_PROFILER_BUCKET_SHIFT to sharpen them.
+Other text around the report is ignored , the last complete report wins.
+
+Usage :
+    python3 tools/profiler/profile_report.py [capture.txt | /dev/ttyUSB0 | -]
+            --symbols Example_projects/Smart_Home/Master_Builds/pic18f4620-baremetal-drivers.production.cof
+            [--top 30] [--buckets]
+
+Layer: Tools
+Target MCU: PIC18F4620
+
+Author: Abdelmoniem Ahmed
+Linkedin: https://www.linkedin.com/in/abdelmoniem-ahmed/
+Date: 2026
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+HEADER_RE = re.compile(r'PROF base=([0-9A-F]+) shift=([0-9A-F]+) buckets=([0-9A-F]+) period=([0-9A-F]+)'
+                       r' samples=([0-9A-F]+) outside=([0-9A-F]+)')
+BUCKET_RE = re.compile(r'^B ([0-9A-F]+) ([0-9A-F]+)$')
+
+# COFF : magic -> (symbol entry size , n_type format)
+COFF_MAGIC = {0x1234: (18, 'H'), 0x1240: (20, 'I')}
+COFF_SECTION_SIZE = 40
+COFF_STYP_TEXT = 0x20
+COFF_C_EXT = 2
+COFF_C_STAT = 3
+
+FLASH_SIZE = 0x10000
+RESET_VECTOR_END = 0x08
+
+MAP_SYMBOL_RE = re.compile(r'(\S+)\s+([\w.]+)\s+([0-9A-Fa-f]{2,})\b')
+MAP_HEX_RE = re.compile(r'^[0-9A-Fa-f]+$')
+
+
+# ---------------------------------------------------------------- report
+
+def read_report(stream):
+    """Last complete report of the stream : (header dict , {address: count})."""
+    report = None
+    current = None
+    for raw in stream:
+        line = raw.decode('latin-1').strip()
+        match = HEADER_RE.search(line)
+        if match:
+            base, shift, buckets, period, samples, outside = (int(x, 16) for x in match.groups())
+            current = ({'base': base, 'shift': shift, 'buckets': buckets, 'period': period,
+                        'samples': samples, 'outside': outside}, {})
+            continue
+        if current is None:
+            continue
+        match = BUCKET_RE.match(line)
+        if match:
+            current[1][int(match.group(1), 16)] = int(match.group(2), 16)
+        elif line == 'END':
+            report = current
+            current = None
+    return report
+
+
+# ---------------------------------------------------------------- symbols
+
+def read_cof(path):
+    """Code symbols of a Microchip COFF file : [(address , name , section end)]."""
+    with open(path, 'rb') as cof:
+        data = cof.read()
+    magic, nscns, _, symptr, nsyms, opthdr, _ = struct.unpack_from('<HHIIIHH', data, 0)
+    if magic not in COFF_MAGIC:
+        raise ValueError('%s : not a Microchip COFF file (magic 0x%04X)' % (path, magic))
+    entry_size, type_format = COFF_MAGIC[magic]
+    strtab = symptr + nsyms * entry_size
+
+    def name_of(raw):
+        if raw[:4] == b'\0\0\0\0':
+            offset = strtab + struct.unpack_from('<I', raw, 4)[0]
+            return data[offset:data.index(b'\0', offset)].decode('latin-1')
+        return raw.split(b'\0')[0].decode('latin-1')
+
+    sections = []
+    offset = 20 + opthdr
+    for _ in range(nscns):
+        paddr, _, size = struct.unpack_from('<III', data, offset + 8)
+        flags = struct.unpack_from('<I', data, offset + COFF_SECTION_SIZE - 4)[0]
+        sections.append((paddr, size, flags))
+        offset += COFF_SECTION_SIZE
+
+    symbols = set()
+    index = 0
+    while index < nsyms:
+        offset = symptr + index * entry_size
+        value, scnum = struct.unpack_from('<Ih', data, offset + 8)
+        sclass, numaux = struct.unpack_from('<BB', data, offset + 14 + struct.calcsize(type_format))
+        name = name_of(data[offset:offset + 8])
+        if (0 < scnum <= len(sections)) and (sections[scnum - 1][2] & COFF_STYP_TEXT) and \
+           sclass in (COFF_C_EXT, COFF_C_STAT) and not name.startswith('.'):
+            paddr, size, _ = sections[scnum - 1]
+            # Functions removed by the linker are left at address 0
+            if value or paddr:
+                symbols.add((value, name, paddr + size))
+        index += 1 + numaux
+    return sorted(symbols)
+
+
+def read_map(path):
+    """Code symbols of an XC8 map file : [(address , name , psect end)]."""
+    with open(path, encoding='latin-1') as map_file:
+        text = map_file.read()
+    head, _, table = text.partition('Symbol Table')
+    psects = {}
+    for line in head.splitlines():
+        tokens = line.split()
+        numbers = 0
+        while numbers < len(tokens) and MAP_HEX_RE.match(tokens[-1 - numbers]):
+            numbers += 1
+        if numbers not in (5, 6) or numbers == len(tokens):
+            continue
+        name = tokens[-1 - numbers]
+        link, length, space = int(tokens[-numbers], 16), int(tokens[-numbers + 2], 16), int(tokens[-2])
+        if space == 0 and length and name.startswith(('text', 'intcode')):
+            psects.setdefault(name, []).append((link, link + length))
+    symbols = set()
+    for line in table.splitlines():
+        for name, psect, value in MAP_SYMBOL_RE.findall(line):
+            if psect in psects and not name.startswith('__'):
+                address = int(value, 16)
+                for link, end in psects[psect]:
+                    if link <= address < end:
+                        symbols.add((address, name[1:] if name.startswith('_') else name, end))
+    return sorted(symbols)
+
+
+def function_ranges(symbols):
+    """[(start , end , name)] , one name per address , each ending at the next start."""
+    ranges = [(0, RESET_VECTOR_END, '(reset vector)')]
+    by_address = {}
+    for address, name, limit in symbols:
+        if address >= RESET_VECTOR_END:
+            by_address.setdefault(address, (name, limit))
+    starts = sorted(by_address)
+    for index, address in enumerate(starts):
+        name, limit = by_address[address]
+        end = starts[index + 1] if index + 1 < len(starts) else limit
+        ranges.append((address, max(address + 1, min(end, limit)), name))
+    return ranges
+
+
+# ---------------------------------------------------------------- attribution
+
+def attribute(header, buckets, ranges):
+    """{name: estimated samples} , bucket counts split by overlapped bytes."""
+    size = 1 << header['shift']
+    totals = {}
+    for address, count in buckets.items():
+        end = address + size
+        shares = [(min(end, r_end) - max(address, r_start), name)
+                  for r_start, r_end, name in ranges if r_start < end and r_end > address]
+        covered = sum(bytes_in for bytes_in, _ in shares)
+        if covered < size:
+            shares.append((size - covered, '(no symbol)'))
+        for bytes_in, name in shares:
+            totals[name] = totals.get(name, 0.0) + count * bytes_in / float(size)
+    return totals
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('@details')[0].strip())
+    parser.add_argument('input', nargs='?', default='-', help='capture file , serial device or - (stdin)')
+    parser.add_argument('--symbols', help='XC8 .cof or .map of the profiled build')
+    parser.add_argument('--top', type=int, default=30, help='functions to print (0 = all)')
+    parser.add_argument('--buckets', action='store_true', help='print the raw buckets too')
+    args = parser.parse_args()
+
+    stream = sys.stdin.buffer if args.input == '-' else open(args.input, 'rb', buffering=0)
+    try:
+        report = read_report(stream)
+    except KeyboardInterrupt:
+        report = None
+    finally:
+        if stream is not sys.stdin.buffer:
+            stream.close()
+    if report is None:
+        sys.exit('no complete PROF ... END report in %s' % args.input)
+    header, buckets = report
+
+    samples = header['samples']
+    inside = sum(buckets.values())
+    print('%u samples , %u cycles apart (+0..63 dither) , %u outside 0x%06X..0x%06X' %
+          (samples, header['period'], header['outside'], header['base'],
+           header['base'] + (header['buckets'] << header['shift']) - 1))
+    if inside + header['outside'] < samples:
+        print('(%u samples lost to saturated buckets)' % (samples - inside - header['outside']))
+
+    if args.symbols:
+        symbols = read_cof(args.symbols) if args.symbols.lower().endswith('.cof') else read_map(args.symbols)
+        totals = attribute(header, buckets, function_ranges(symbols))
+        ordered = sorted(totals.items(), key=lambda item: -item[1])
+        if args.top:
+            ordered = ordered[:args.top]
+        print('\n%8s %7s  %s' % ('samples', '%', 'function'))
+        for name, count in ordered:
+            print('%8.1f %6.1f%%  %s' % (count, 100.0 * count / max(samples, 1), name))
+
+    if args.buckets or not args.symbols:
+        print('\n%8s %8s %7s' % ('address', 'samples', '%'))
+        for address in sorted(buckets):
+            print('  %06X %8u %6.1f%%' % (address, buckets[address], 100.0 * buckets[address] / max(samples, 1)))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,165 @@
+#!/usr/bin/env python3
+"""
+@file    trace_decode.py
+@brief   Decoder for the ecual/Trace binary records
+
+@details
+Reads the EUSART byte stream (a capture file , a serial device already set
+up with stty , or stdin) and prints one line per 8-byte record :
+
+    | 0xA5 | event id | tick L | tick H | arg8 | arg16 L | arg16 H | check |
+
+A record is accepted when its sync byte and XOR check match , anything else
+is skipped one byte at a time. Skipped bytes are printed as text , so the
+ASCII output of blocking writes stays readable in the same stream.
+
+Event names and formats come from the headers given with --events :
+
+    #define SMART_HOME_TRACE_TEMP   0x13    /* trace: "temperature {s8} C" */
+
+ - the name is printed without everything up to TRACE_
+ - the format is a Python str.format() string over the fields
+   {tick} {time} {a8} {s8} {a16} {s16} {hi} {lo} {shi} {slo}
+   (hi / lo : bytes of arg16 , shi / slo : the same , signed)
+ - ecual/Trace/ecu_trace.h is always read for the reserved events
+
+The 16-bit tick is unwrapped into seconds (--tick-ms , default 1) and
+restarts at zero on a TRACE_EVENT_START record.
+
+Usage :
+    python3 tools/trace/trace_decode.py [capture.bin | /dev/ttyUSB0 | -]
+            [--events Example_projects/Smart_Home/Smart_Home_app.h ...]
+            [--tick-ms 1] [--raw] [--no-text]
+
+Layer: Tools
+Target MCU: PIC18F4620
+
+Author: Abdelmoniem Ahmed
+Linkedin: https://www.linkedin.com/in/abdelmoniem-ahmed/
+Date: 2026
+"""
+
+import argparse
+import os
+import re
+import sys
+
+ROOT = os.path.abspath(os.path.join(os.path.dirname(__file__), '..', '..'))
+TRACE_HEADER = os.path.join(ROOT, 'ecual', 'Trace', 'ecu_trace.h')
+
+SYNC_BYTE = 0xA5
+RECORD_SIZE = 8
+EVENT_START = 0x01
+
+DEFINE_RE = re.compile(r'^\s*#define\s+(\w+)\s+(0[xX][0-9a-fA-F]+|\d+)\b(?:.*?/\*\s*trace:\s*"(.*)"\s*\*/)?')
+
+
+def read_events(paths):
+    """Map event id -> (name , format) from the #define lines with a trace: comment."""
+    events = {}
+    for path in paths:
+        with open(path, encoding='utf-8', errors='replace') as header:
+            for line in header:
+                match = DEFINE_RE.match(line)
+                if match and match.group(3) is not None:
+                    name = match.group(1)
+                    if 'TRACE_' in name:
+                        name = name.split('TRACE_', 1)[1]
+                    if name.startswith('EVENT_'):
+                        name = name[len('EVENT_'):]
+                    events[int(match.group(2), 0)] = (name, match.group(3))
+    return events
+
+
+def records(stream, on_text):
+    """Yield the valid records of the stream , hand the skipped bytes to on_text."""
+    window = bytearray()
+    skipped = bytearray()
+    while True:
+        chunk = stream.read(1) if len(window) < RECORD_SIZE else b''
+        if chunk:
+            window += chunk
+            continue
+        if len(window) < RECORD_SIZE:
+            break
+        check = 0
+        for byte in window[:RECORD_SIZE - 1]:
+            check ^= byte
+        if window[0] == SYNC_BYTE and check == window[RECORD_SIZE - 1]:
+            if skipped:
+                on_text(bytes(skipped))
+                skipped.clear()
+            yield bytes(window[:RECORD_SIZE])
+            del window[:RECORD_SIZE]
+        else:
+            skipped.append(window.pop(0))
+    skipped += window
+    if skipped:
+        on_text(bytes(skipped))
+
+
+def decode(record, events, clock, tick_ms):
+    event = record[1]
+    tick = record[2] | (record[3] << 8)
+    arg8 = record[4]
+    arg16 = record[5] | (record[6] << 8)
+
+    if event == EVENT_START:
+        clock['base'] = 0
+        clock['last'] = tick
+    elif clock['last'] is not None and tick < clock['last']:
+        clock['base'] += 0x10000
+    clock['last'] = tick
+    seconds = (clock['base'] + tick) * tick_ms / 1000.0
+
+    fields = {
+        'tick': tick, 'time': seconds,
+        'a8': arg8, 's8': arg8 - 0x100 if arg8 & 0x80 else arg8,
+        'a16': arg16, 's16': arg16 - 0x10000 if arg16 & 0x8000 else arg16,
+        'hi': arg16 >> 8, 'lo': arg16 & 0xFF,
+        'shi': (arg16 >> 8) - 0x100 if arg16 & 0x8000 else arg16 >> 8,
+        'slo': (arg16 & 0xFF) - 0x100 if arg16 & 0x80 else arg16 & 0xFF,
+    }
+    name, fmt = events.get(event, ('0x%02X' % event, 'a8 {a8} a16 {a16}'))
+    try:
+        text = fmt.format(**fields)
+    except (KeyError, ValueError, IndexError) as error:
+        text = 'bad format "%s" (%s) , a8 %u a16 %u' % (fmt, error, arg8, arg16)
+    return '%10.3f  %-12s %s' % (seconds, name, text)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('@details')[0].strip())
+    parser.add_argument('input', nargs='?', default='-', help='capture file , serial device or - (stdin)')
+    parser.add_argument('--events', nargs='+', default=[], help='headers with trace: event comments')
+    parser.add_argument('--tick-ms', type=float, default=1.0, help='SCHEDULER_TICK_MS of the build')
+    parser.add_argument('--raw', action='store_true', help='append the record bytes to each line')
+    parser.add_argument('--no-text', action='store_true', help='do not print the skipped bytes')
+    args = parser.parse_args()
+
+    events = read_events([TRACE_HEADER] + args.events)
+    clock = {'base': 0, 'last': None}
+
+    def on_text(data):
+        if not args.no_text:
+            for line in data.decode('latin-1').splitlines():
+                if line.strip():
+                    print('%10s  %-12s %s' % ('', '(text)', line.rstrip()))
+
+    stream = sys.stdin.buffer if args.input == '-' else open(args.input, 'rb', buffering=0)
+    try:
+        for record in records(stream, on_text):
+            line = decode(record, events, clock, args.tick_ms)
+            if args.raw:
+                line += '  [' + ' '.join('%02X' % byte for byte in record) + ']'
+            print(line, flush=True)
+    except KeyboardInterrupt:
+        pass
+    finally:
+        if stream is not sys.stdin.buffer:
+            stream.close()
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())